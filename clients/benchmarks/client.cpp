@@ -65,6 +65,14 @@ try
             "Set the default device to be used for subsequent program runs.\n"
             "                           ")
 
+        ("device_init",
+         value<rocblas_int>(&argus.device_init)->default_value(0),
+            "Generate the input matrices on the device? 0 = No, 1 = Yes.\n"
+            "                           The matrices are then copied to the host only for --verify and CPU timing.\n"
+            "                           Applies to getrf, getrs, potrf and syevd/heevd; other functions always\n"
+            "                           generate their inputs on the host.\n"
+            "                           ")
+
         ("function,f",
          value<std::string>(&function)->default_value("getrf"),
             "The LAPACK function to test.\n"
@@ -147,6 +155,12 @@ try
             "                           Leading dimension of matrices C.\n"
             "                           ")
 
+        ("ldr",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Leading dimension of matrices R.\n"
+            "                           ")
+
         // ("ldt",
         //  value<rocblas_int>(),
         //     "Matrix size parameter.\n"
@@ -171,11 +185,11 @@ try
         //     "                           Leading dimension of matrices W.\n"
         //     "                           ")
 
-        // ("ldx",
-        //  value<rocblas_int>(),
-        //     "Matrix size parameter.\n"
-        //     "                           Leading dimension of matrices X.\n"
-        //     "                           ")
+        ("ldx",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Leading dimension of matrices X.\n"
+            "                           ")
 
         // ("ldy",
         //  value<rocblas_int>(),
@@ -270,6 +284,13 @@ try
         //     "                           Only applicable to laswp.\n"
         //     "                           ")
 
+        // out-of-core options
+        ("budget",
+         value<rocblas_int>(),
+            "Device memory budget in KiB.\n"
+            "                           Only applicable to the out-of-core functions.\n"
+            "                           ")
+
         // gesvd options
         ("jobu",
          value<char>()->default_value('N'),
@@ -0,0 +1,462 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "../include/clientcommon.hpp"
+#include "../rocblascommon/program_options.hpp"
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+
+using namespace roc;
+
+// clang-format off
+const char* help_str = R"HELP_STR(
+hipSOLVER tuning client help.
+
+Usage: ./hipsolver-tune <options>
+
+Measures the settings of hipSOLVER that depend on the system and writes them to a tuning file,
+which hipsolverCreate loads if the HIPSOLVER_TUNING_FILE environment variable names it, and
+hipsolverLoadTuningFile loads into an existing handle. Two sweeps are run on the current device:
+
+- For potrf, getrf and getrs in each precision, the problems of the sizes up to max_n are timed
+  on the host, in HIPSOLVER_DISPATCH_MODE_AUTO with pinned memory, and on the device; the
+  crossover threshold is the largest size up to which the host is faster.
+- potrf and getrf of order tile_n in double precision are timed with tiled execution for each
+  tile size; the fastest tile size is kept. Set tile_n to 0 to skip this sweep.
+
+Example: ./hipsolver-tune -o tuning.txt --max_n 128
+This will tune the crossover thresholds up to size 128 and the tile size, and write them to
+tuning.txt.
+
+Options:
+)HELP_STR";
+// clang-format on
+
+// version of the tuning files read by hipsolverLoadTuningFile
+#define TUNE_VERSION 1
+
+// sizes of the crossover sweep, and tile sizes of the blocking sweep
+const std::vector<int> tune_sizes      = {4, 8, 16, 24, 32, 48, 64, 96, 128, 192, 256, 384, 512};
+const std::vector<int> tune_blocksizes = {256, 384, 512, 768, 1024};
+
+struct tune_options
+{
+    int iters;
+    int max_n;
+    int tile_n;
+    int tile_streams;
+};
+
+inline void tune_check(hipsolverStatus_t status, const char* call)
+{
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        throw std::runtime_error(std::string(call) + " failed with "
+                                 + hipsolver2string_status(status));
+}
+
+// n elements in pinned host memory or device memory
+template <typename T>
+class tune_array
+{
+public:
+    tune_array(size_t count, bool host)
+        : count_(std::max(count, size_t(1)))
+        , host_(host)
+    {
+        hipError_t err = host_ ? hipHostMalloc((void**)&data_, sizeof(T) * count_, 0)
+                               : hipMalloc((void**)&data_, sizeof(T) * count_);
+        if(err != hipSuccess)
+            throw std::bad_alloc();
+    }
+    ~tune_array()
+    {
+        if(host_)
+            hipHostFree(data_);
+        else
+            hipFree(data_);
+    }
+
+    tune_array(const tune_array&) = delete;
+    tune_array& operator=(const tune_array&) = delete;
+
+    T* data()
+    {
+        return data_;
+    }
+
+    void write(const std::vector<T>& v)
+    {
+        if(hipMemcpy(data_, v.data(), sizeof(T) * v.size(), hipMemcpyHostToDevice) != hipSuccess)
+            throw std::runtime_error("hipMemcpy failed");
+    }
+
+private:
+    T*     data_ = nullptr;
+    size_t count_;
+    bool   host_;
+};
+
+/* Average time in microseconds of call over iters calls, after a cold call;
+   reset restores the inputs before each call and is not timed. */
+double tune_time(hipsolverHandle_t            handle,
+                 int                          iters,
+                 const std::function<void()>& reset,
+                 const std::function<void()>& call)
+{
+    hipStream_t stream;
+    tune_check(hipsolverGetStream(handle, &stream), "hipsolverGetStream");
+
+    reset();
+    call();
+
+    double time = 0;
+    for(int iter = 0; iter < iters; iter++)
+    {
+        reset();
+        double start = get_time_us_sync(stream);
+        call();
+        time += get_time_us_sync(stream) - start;
+    }
+    return time / iters;
+}
+
+// a Hermitian positive definite matrix if spd, or a general matrix
+template <typename T>
+std::vector<T> tune_matrix(int n, bool spd)
+{
+    std::vector<T> A(size_t(n) * n);
+    for(int j = 0; j < n; j++)
+    {
+        for(int i = 0; i < n; i++)
+        {
+            if(!spd)
+                A[i + size_t(j) * n] = random_generator<T>();
+            else if(i == j)
+                A[i + size_t(j) * n] = T(10 * n + rand() % 10);
+            else if(i > j)
+                A[i + size_t(j) * n] = A[j + size_t(i) * n] = T(rand() % 10);
+        }
+    }
+    return A;
+}
+
+/* Time of routine on a problem of size n, on the host (in pinned memory, with
+   the threshold of the routine at n) or on the device. */
+template <typename T>
+double tune_dispatch_time(hipsolverHandle_t          handle,
+                          hipsolverDispatchRoutine_t routine,
+                          hipsolverPrecision_t       precision,
+                          int                        n,
+                          bool                       host,
+                          int                        iters)
+{
+    tune_check(hipsolverSetDispatchMode(handle,
+                                        host ? HIPSOLVER_DISPATCH_MODE_AUTO
+                                             : HIPSOLVER_DISPATCH_MODE_DEVICE),
+               "hipsolverSetDispatchMode");
+    tune_check(hipsolverSetDispatchThreshold(handle, routine, precision, n),
+               "hipsolverSetDispatchThreshold");
+
+    std::vector<T>  hA = tune_matrix<T>(n, routine == HIPSOLVER_DISPATCH_POTRF);
+    std::vector<T>  hB(n, T(1));
+    tune_array<T>   A(hA.size(), host);
+    tune_array<T>   B(hB.size(), host);
+    tune_array<int> ipiv(n, host);
+    tune_array<int> info(1, host);
+
+    auto potrf = [&] {
+        tune_check(hipsolver_potrf(false,
+                                   handle,
+                                   HIPSOLVER_FILL_MODE_LOWER,
+                                   n,
+                                   A.data(),
+                                   n,
+                                   0,
+                                   nullptr,
+                                   0,
+                                   info.data(),
+                                   1),
+                   "hipsolverXpotrf");
+    };
+    auto getrf = [&] {
+        tune_check(hipsolver_getrf(false,
+                                   false,
+                                   handle,
+                                   n,
+                                   n,
+                                   A.data(),
+                                   n,
+                                   0,
+                                   nullptr,
+                                   0,
+                                   ipiv.data(),
+                                   0,
+                                   info.data(),
+                                   1),
+                   "hipsolverXgetrf");
+    };
+    auto getrs = [&] {
+        tune_check(hipsolver_getrs(false,
+                                   handle,
+                                   HIPSOLVER_OP_N,
+                                   n,
+                                   1,
+                                   A.data(),
+                                   n,
+                                   0,
+                                   ipiv.data(),
+                                   0,
+                                   B.data(),
+                                   n,
+                                   0,
+                                   nullptr,
+                                   0,
+                                   info.data(),
+                                   1),
+                   "hipsolverXgetrs");
+    };
+
+    if(routine == HIPSOLVER_DISPATCH_POTRF)
+        return tune_time(handle, iters, [&] { A.write(hA); }, potrf);
+    if(routine == HIPSOLVER_DISPATCH_GETRF)
+        return tune_time(handle, iters, [&] { A.write(hA); }, getrf);
+
+    // getrs solves with the factors of A, computed once
+    A.write(hA);
+    getrf();
+    return tune_time(handle, iters, [&] { B.write(hB); }, getrs);
+}
+
+/* The largest size of the sweep up to which routine is faster on the host,
+   or 0 if it is faster on the device already for the smallest size. */
+template <typename T>
+int tune_dispatch(hipsolverHandle_t          handle,
+                  hipsolverDispatchRoutine_t routine,
+                  hipsolverPrecision_t       precision,
+                  const char*                name,
+                  const tune_options&        options)
+{
+    int threshold = 0;
+    for(int n : tune_sizes)
+    {
+        if(n > options.max_n)
+            break;
+
+        double host   = tune_dispatch_time<T>(handle, routine, precision, n, true, options.iters);
+        double device = tune_dispatch_time<T>(handle, routine, precision, n, false, options.iters);
+        rocsolver_bench_output(name, n, host, device);
+
+        if(host > device)
+            break;
+        threshold = n;
+    }
+    return threshold;
+}
+
+// tune_dispatch in precision p, in the order of hipsolverPrecision_t
+int tune_dispatch_precision(hipsolverHandle_t          handle,
+                            hipsolverDispatchRoutine_t routine,
+                            int                        p,
+                            const char*                name,
+                            const tune_options&        options)
+{
+    auto precision = hipsolverPrecision_t(HIPSOLVER_PRECISION_SINGLE + p);
+    if(p == 0)
+        return tune_dispatch<float>(handle, routine, precision, name, options);
+    else if(p == 1)
+        return tune_dispatch<double>(handle, routine, precision, name, options);
+    else if(p == 2)
+        return tune_dispatch<hipsolverComplex>(handle, routine, precision, name, options);
+    else
+        return tune_dispatch<hipsolverDoubleComplex>(handle, routine, precision, name, options);
+}
+
+/* The tile size of the sweep for which potrf and getrf of order tile_n take
+   the least time together, or 0 if none fits. */
+int tune_blocksize(hipsolverHandle_t handle, const tune_options& options)
+{
+    int n = options.tile_n;
+    tune_check(hipsolverSetDispatchMode(handle, HIPSOLVER_DISPATCH_MODE_DEVICE),
+               "hipsolverSetDispatchMode");
+    tune_check(hipsolverSetTileExecution(handle, options.tile_streams, 1),
+               "hipsolverSetTileExecution");
+
+    std::vector<double> hS = tune_matrix<double>(n, true);
+    std::vector<double> hG = tune_matrix<double>(n, false);
+    tune_array<double>  A(hS.size(), false);
+    tune_array<int>     ipiv(n, false);
+    tune_array<int>     info(1, false);
+
+    int    best      = 0;
+    double best_time = 0;
+    for(int nb : tune_blocksizes)
+    {
+        // the factorizations are only tiled with at least two tiles in each dimension
+        if(2 * nb > n)
+            break;
+        tune_check(hipsolverSetTileBlockSize(handle, nb), "hipsolverSetTileBlockSize");
+
+        auto potrf = [&] {
+            tune_check(hipsolver_potrf(false,
+                                       handle,
+                                       HIPSOLVER_FILL_MODE_LOWER,
+                                       n,
+                                       A.data(),
+                                       n,
+                                       0,
+                                       nullptr,
+                                       0,
+                                       info.data(),
+                                       1),
+                       "hipsolverDpotrf");
+        };
+        auto getrf = [&] {
+            tune_check(hipsolver_getrf(false,
+                                       false,
+                                       handle,
+                                       n,
+                                       n,
+                                       A.data(),
+                                       n,
+                                       0,
+                                       nullptr,
+                                       0,
+                                       ipiv.data(),
+                                       0,
+                                       info.data(),
+                                       1),
+                       "hipsolverDgetrf");
+        };
+
+        double time = tune_time(handle, options.iters, [&] { A.write(hS); }, potrf)
+                      + tune_time(handle, options.iters, [&] { A.write(hG); }, getrf);
+        rocsolver_bench_output("tile", nb, time);
+
+        if(best == 0 || time < best_time)
+        {
+            best      = nb;
+            best_time = time;
+        }
+    }
+
+    tune_check(hipsolverSetTileExecution(handle, 0, 0), "hipsolverSetTileExecution");
+    return best;
+}
+
+int main(int argc, char* argv[])
+try
+{
+    tune_options options;
+    std::string  output;
+    int          device_id;
+
+    // clang-format off
+    options_description desc("hipsolver tuning client command line options");
+    desc.add_options()("help,h", "Produces this help message.")
+
+        ("device",
+         value<int>(&device_id)->default_value(0),
+            "Set the device to be tuned.\n"
+            "                           ")
+
+        ("iters,i",
+         value<int>(&options.iters)->default_value(10),
+            "Iterations to run for each measurement.\n"
+            "                           Reported times will be the average.\n"
+            "                           ")
+
+        ("max_n",
+         value<int>(&options.max_n)->default_value(256),
+            "Largest size of the crossover sweep.\n"
+            "                           ")
+
+        ("output,o",
+         value<std::string>(&output)->default_value("hipsolver_tuning.txt"),
+            "The tuning file to write.\n"
+            "                           ")
+
+        ("tile_n",
+         value<int>(&options.tile_n)->default_value(4096),
+            "Order of the matrices of the tile size sweep; 0 skips the sweep.\n"
+            "                           ")
+
+        ("tile_streams",
+         value<int>(&options.tile_streams)->default_value(2),
+            "Number of streams of the tile size sweep.\n"
+            "                           ");
+    // clang-format on
+
+    variables_map vm;
+    store(parse_command_line(argc, argv, desc), vm);
+    notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << help_str << desc << std::endl;
+        return 0;
+    }
+
+    if(options.iters < 1 || options.max_n < 0 || options.tile_n < 0 || options.tile_streams < 1)
+        throw std::invalid_argument("Invalid value in arguments");
+    if(query_device_property() <= device_id)
+        throw std::invalid_argument("Invalid Device ID");
+    set_device(device_id);
+
+    hipsolver_local_handle handle;
+
+    std::cerr << "\nCrossover thresholds (times in us):\n";
+    std::cerr << "============================================\n";
+    rocsolver_bench_output("routine", "n", "host_time", "device_time");
+
+    const char* routines[]   = {"potrf", "getrf", "getrs"};
+    const char  precisions[] = {'s', 'd', 'c', 'z'};
+    int         thresholds[3][4];
+    for(int r = 0; r < 3; r++)
+    {
+        auto routine = hipsolverDispatchRoutine_t(HIPSOLVER_DISPATCH_POTRF + r);
+        for(int p = 0; p < 4; p++)
+        {
+            std::string name = std::string(routines[r]) + '_' + precisions[p];
+            thresholds[r][p] = tune_dispatch_precision(handle, routine, p, name.c_str(), options);
+        }
+    }
+
+    int blocksize = 0;
+    if(options.tile_n > 0)
+    {
+        std::cerr << "\nTile sizes (times in us):\n";
+        std::cerr << "============================================\n";
+        rocsolver_bench_output("", "nb", "time");
+        blocksize = tune_blocksize(handle, options);
+    }
+
+    // write the tuning file
+    {
+        std::ofstream file(output);
+        file << "# hipSOLVER tuning file, written by hipsolver-tune\n";
+        file << "hipsolver_tuning " << TUNE_VERSION << "\n";
+        for(int r = 0; r < 3; r++)
+            for(int p = 0; p < 4; p++)
+                file << "dispatch " << routines[r] << ' ' << precisions[p] << ' '
+                     << thresholds[r][p] << "\n";
+        if(blocksize > 0)
+            file << "tile_blocksize " << blocksize << "\n";
+        if(!file)
+            throw std::runtime_error("Could not write " + output);
+    }
+
+    // check that the library accepts the file
+    tune_check(hipsolverLoadTuningFile(handle, output.c_str()), "hipsolverLoadTuningFile");
+    std::cerr << "\nWrote " << output << std::endl;
+
+    return 0;
+}
+
+catch(const std::exception& exp)
+{
+    std::cerr << exp.what() << std::endl;
+    return -1;
+}
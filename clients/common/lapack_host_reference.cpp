@@ -5,12 +5,73 @@
 #include "../include/lapack_host_reference.hpp"
 #include "cblas.h"
 #include "hipsolver.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 /*!\file
  * \brief provide template functions interfaces to BLAS and LAPACK interfaces, it is
  * only used for testing, not part of the GPU library
  */
 
+/*************************************************************************/
+// Batch execution of the reference over host threads
+
+int cblas_batch_threads()
+{
+    const char* env = std::getenv("HIPSOLVER_REFERENCE_THREADS");
+    if(env && env[0])
+        return std::max(std::atoi(env), 1);
+    return std::max(int(std::thread::hardware_concurrency()), 1);
+}
+
+void cblas_batch(int bc, const std::function<void(int)>& func)
+{
+    int threads = std::min(cblas_batch_threads(), bc);
+    if(threads <= 1)
+    {
+        for(int b = 0; b < bc; ++b)
+            func(b);
+        return;
+    }
+
+    // problems are taken in order by the first idle thread, so that the
+    // threads stay busy when the problems of a batch differ in cost
+    std::atomic<int>   next(0);
+    std::exception_ptr error;
+    std::mutex         error_mutex;
+    auto               worker = [&] {
+        for(int b = next++; b < bc; b = next++)
+        {
+            try
+            {
+                func(b);
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if(!error)
+                    error = std::current_exception();
+                next = bc;
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for(int t = 1; t < threads; t++)
+        pool.emplace_back(worker);
+    worker();
+    for(std::thread& thread : pool)
+        thread.join();
+
+    if(error)
+        std::rethrow_exception(error);
+}
+
 /*************************************************************************/
 // These are C wrapper calls to CBLAS and fortran LAPACK
 
@@ -377,6 +438,83 @@ void zgebrd_(int*                    m,
              int*                    size_w,
              int*                    info);
 
+void sgels_(char*  trans,
+            int*   m,
+            int*   n,
+            int*   nrhs,
+            float* A,
+            int*   lda,
+            float* B,
+            int*   ldb,
+            float* work,
+            int*   lwork,
+            int*   info);
+void dgels_(char*   trans,
+            int*    m,
+            int*    n,
+            int*    nrhs,
+            double* A,
+            int*    lda,
+            double* B,
+            int*    ldb,
+            double* work,
+            int*    lwork,
+            int*    info);
+void cgels_(char*             trans,
+            int*              m,
+            int*              n,
+            int*              nrhs,
+            hipsolverComplex* A,
+            int*              lda,
+            hipsolverComplex* B,
+            int*              ldb,
+            hipsolverComplex* work,
+            int*              lwork,
+            int*              info);
+void zgels_(char*                   trans,
+            int*                    m,
+            int*                    n,
+            int*                    nrhs,
+            hipsolverDoubleComplex* A,
+            int*                    lda,
+            hipsolverDoubleComplex* B,
+            int*                    ldb,
+            hipsolverDoubleComplex* work,
+            int*                    lwork,
+            int*                    info);
+
+void sgeqp3_(
+    int* m, int* n, float* A, int* lda, int* jpvt, float* tau, float* work, int* lwork, int* info);
+void dgeqp3_(int*    m,
+             int*    n,
+             double* A,
+             int*    lda,
+             int*    jpvt,
+             double* tau,
+             double* work,
+             int*    lwork,
+             int*    info);
+void cgeqp3_(int*              m,
+             int*              n,
+             hipsolverComplex* A,
+             int*              lda,
+             int*              jpvt,
+             hipsolverComplex* tau,
+             hipsolverComplex* work,
+             int*              lwork,
+             float*            rwork,
+             int*              info);
+void zgeqp3_(int*                    m,
+             int*                    n,
+             hipsolverDoubleComplex* A,
+             int*                    lda,
+             int*                    jpvt,
+             hipsolverDoubleComplex* tau,
+             hipsolverDoubleComplex* work,
+             int*                    lwork,
+             double*                 rwork,
+             int*                    info);
+
 void sgeqrf_(int* m, int* n, float* A, int* lda, float* ipiv, float* work, int* lwork, int* info);
 void dgeqrf_(
     int* m, int* n, double* A, int* lda, double* ipiv, double* work, int* lwork, int* info);
@@ -489,6 +627,25 @@ void dpotrf_(char* uplo, int* m, double* A, int* lda, int* info);
 void cpotrf_(char* uplo, int* m, hipsolverComplex* A, int* lda, int* info);
 void zpotrf_(char* uplo, int* m, hipsolverDoubleComplex* A, int* lda, int* info);
 
+void spotrs_(char* uplo, int* n, int* nrhs, float* A, int* lda, float* B, int* ldb, int* info);
+void dpotrs_(char* uplo, int* n, int* nrhs, double* A, int* lda, double* B, int* ldb, int* info);
+void cpotrs_(char*             uplo,
+             int*              n,
+             int*              nrhs,
+             hipsolverComplex* A,
+             int*              lda,
+             hipsolverComplex* B,
+             int*              ldb,
+             int*              info);
+void zpotrs_(char*                   uplo,
+             int*                    n,
+             int*                    nrhs,
+             hipsolverDoubleComplex* A,
+             int*                    lda,
+             hipsolverDoubleComplex* B,
+             int*                    ldb,
+             int*                    info);
+
 void ssyevd_(char*  evect,
              char*  uplo,
              int*   n,
@@ -640,6 +797,49 @@ void zhetrd_(char*                   uplo,
              int*                    size_w,
              int*                    info);
 
+void ssytrf_(char* uplo, int* n, float* A, int* lda, int* ipiv, float* work, int* lwork, int* info);
+void dsytrf_(
+    char* uplo, int* n, double* A, int* lda, int* ipiv, double* work, int* lwork, int* info);
+void csytrf_(char*             uplo,
+             int*              n,
+             hipsolverComplex* A,
+             int*              lda,
+             int*              ipiv,
+             hipsolverComplex* work,
+             int*              lwork,
+             int*              info);
+void zsytrf_(char*                   uplo,
+             int*                    n,
+             hipsolverDoubleComplex* A,
+             int*                    lda,
+             int*                    ipiv,
+             hipsolverDoubleComplex* work,
+             int*                    lwork,
+             int*                    info);
+
+void ssytrs_(
+    char* uplo, int* n, int* nrhs, float* A, int* lda, int* ipiv, float* B, int* ldb, int* info);
+void dsytrs_(
+    char* uplo, int* n, int* nrhs, double* A, int* lda, int* ipiv, double* B, int* ldb, int* info);
+void csytrs_(char*             uplo,
+             int*              n,
+             int*              nrhs,
+             hipsolverComplex* A,
+             int*              lda,
+             int*              ipiv,
+             hipsolverComplex* B,
+             int*              ldb,
+             int*              info);
+void zsytrs_(char*                   uplo,
+             int*                    n,
+             int*                    nrhs,
+             hipsolverDoubleComplex* A,
+             int*                    lda,
+             int*                    ipiv,
+             hipsolverDoubleComplex* B,
+             int*                    ldb,
+             int*                    info);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1404,6 +1604,129 @@ void cblas_gebrd<hipsolverDoubleComplex, double>(int                     m,
     zgebrd_(&m, &n, A, &lda, D, E, tauq, taup, work, &size_w, &info);
 }
 
+// gels
+template <>
+void cblas_gels<float>(hipsolverOperation_t trans,
+                       int                  m,
+                       int                  n,
+                       int                  nrhs,
+                       float*               A,
+                       int                  lda,
+                       float*               B,
+                       int                  ldb,
+                       float*               work,
+                       int                  lwork,
+                       int*                 info)
+{
+    char transC = hipsolver2char_operation(trans);
+    sgels_(&transC, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cblas_gels<double>(hipsolverOperation_t trans,
+                        int                  m,
+                        int                  n,
+                        int                  nrhs,
+                        double*              A,
+                        int                  lda,
+                        double*              B,
+                        int                  ldb,
+                        double*              work,
+                        int                  lwork,
+                        int*                 info)
+{
+    char transC = hipsolver2char_operation(trans);
+    dgels_(&transC, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cblas_gels<hipsolverComplex>(hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  int                  nrhs,
+                                  hipsolverComplex*    A,
+                                  int                  lda,
+                                  hipsolverComplex*    B,
+                                  int                  ldb,
+                                  hipsolverComplex*    work,
+                                  int                  lwork,
+                                  int*                 info)
+{
+    char transC = hipsolver2char_operation(trans);
+    cgels_(&transC, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cblas_gels<hipsolverDoubleComplex>(hipsolverOperation_t    trans,
+                                        int                     m,
+                                        int                     n,
+                                        int                     nrhs,
+                                        hipsolverDoubleComplex* A,
+                                        int                     lda,
+                                        hipsolverDoubleComplex* B,
+                                        int                     ldb,
+                                        hipsolverDoubleComplex* work,
+                                        int                     lwork,
+                                        int*                    info)
+{
+    char transC = hipsolver2char_operation(trans);
+    zgels_(&transC, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+// geqp3
+template <>
+void cblas_geqp3<float, float>(
+    int m, int n, float* A, int lda, int* jpvt, float* tau, float* work, int lwork, float* rwork)
+{
+    int info;
+    sgeqp3_(&m, &n, A, &lda, jpvt, tau, work, &lwork, &info);
+}
+
+template <>
+void cblas_geqp3<double, double>(int     m,
+                                 int     n,
+                                 double* A,
+                                 int     lda,
+                                 int*    jpvt,
+                                 double* tau,
+                                 double* work,
+                                 int     lwork,
+                                 double* rwork)
+{
+    int info;
+    dgeqp3_(&m, &n, A, &lda, jpvt, tau, work, &lwork, &info);
+}
+
+template <>
+void cblas_geqp3<hipsolverComplex, float>(int               m,
+                                          int               n,
+                                          hipsolverComplex* A,
+                                          int               lda,
+                                          int*              jpvt,
+                                          hipsolverComplex* tau,
+                                          hipsolverComplex* work,
+                                          int               lwork,
+                                          float*            rwork)
+{
+    int info;
+    cgeqp3_(&m, &n, A, &lda, jpvt, tau, work, &lwork, rwork, &info);
+}
+
+template <>
+void cblas_geqp3<hipsolverDoubleComplex, double>(int                     m,
+                                                 int                     n,
+                                                 hipsolverDoubleComplex* A,
+                                                 int                     lda,
+                                                 int*                    jpvt,
+                                                 hipsolverDoubleComplex* tau,
+                                                 hipsolverDoubleComplex* work,
+                                                 int                     lwork,
+                                                 double*                 rwork)
+{
+    int info;
+    zgeqp3_(&m, &n, A, &lda, jpvt, tau, work, &lwork, rwork, &info);
+}
+
 // geqrf
 template <>
 void cblas_geqrf<float>(int m, int n, float* A, int lda, float* ipiv, float* work, int lwork)
@@ -1632,6 +1955,53 @@ void cblas_potrf<hipsolverDoubleComplex>(
     zpotrf_(&uploC, &n, A, &lda, info);
 }
 
+// potrs
+template <>
+void cblas_potrs<float>(
+    hipsolverFillMode_t uplo, int n, int nrhs, float* A, int lda, float* B, int ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    spotrs_(&uploC, &n, &nrhs, A, &lda, B, &ldb, &info);
+}
+
+template <>
+void cblas_potrs<double>(
+    hipsolverFillMode_t uplo, int n, int nrhs, double* A, int lda, double* B, int ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    dpotrs_(&uploC, &n, &nrhs, A, &lda, B, &ldb, &info);
+}
+
+template <>
+void cblas_potrs<hipsolverComplex>(hipsolverFillMode_t uplo,
+                                   int                 n,
+                                   int                 nrhs,
+                                   hipsolverComplex*   A,
+                                   int                 lda,
+                                   hipsolverComplex*   B,
+                                   int                 ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    cpotrs_(&uploC, &n, &nrhs, A, &lda, B, &ldb, &info);
+}
+
+template <>
+void cblas_potrs<hipsolverDoubleComplex>(hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    zpotrs_(&uploC, &n, &nrhs, A, &lda, B, &ldb, &info);
+}
+
 // syevd & heevd
 template <>
 void cblas_syevd_heevd<float, float>(hipsolverEigMode_t  evect,
@@ -1906,3 +2276,109 @@ void cblas_sytrd_hetrd<hipsolverDoubleComplex, double>(hipsolverFillMode_t     u
     char uploC = hipsolver2char_fill(uplo);
     zhetrd_(&uploC, &n, A, &lda, D, E, tau, work, &size_w, &info);
 }
+
+// sytrf
+template <>
+void cblas_sytrf<float>(hipsolverFillMode_t uplo,
+                        int                 n,
+                        float*              A,
+                        int                 lda,
+                        int*                ipiv,
+                        float*              work,
+                        int                 lwork,
+                        int*                info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    ssytrf_(&uploC, &n, A, &lda, ipiv, work, &lwork, info);
+}
+
+template <>
+void cblas_sytrf<double>(hipsolverFillMode_t uplo,
+                         int                 n,
+                         double*             A,
+                         int                 lda,
+                         int*                ipiv,
+                         double*             work,
+                         int                 lwork,
+                         int*                info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    dsytrf_(&uploC, &n, A, &lda, ipiv, work, &lwork, info);
+}
+
+template <>
+void cblas_sytrf<hipsolverComplex>(hipsolverFillMode_t uplo,
+                                   int                 n,
+                                   hipsolverComplex*   A,
+                                   int                 lda,
+                                   int*                ipiv,
+                                   hipsolverComplex*   work,
+                                   int                 lwork,
+                                   int*                info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    csytrf_(&uploC, &n, A, &lda, ipiv, work, &lwork, info);
+}
+
+template <>
+void cblas_sytrf<hipsolverDoubleComplex>(hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int*                    ipiv,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    zsytrf_(&uploC, &n, A, &lda, ipiv, work, &lwork, info);
+}
+
+// sytrs
+template <>
+void cblas_sytrs<float>(
+    hipsolverFillMode_t uplo, int n, int nrhs, float* A, int lda, int* ipiv, float* B, int ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    ssytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cblas_sytrs<double>(
+    hipsolverFillMode_t uplo, int n, int nrhs, double* A, int lda, int* ipiv, double* B, int ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    dsytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cblas_sytrs<hipsolverComplex>(hipsolverFillMode_t uplo,
+                                   int                 n,
+                                   int                 nrhs,
+                                   hipsolverComplex*   A,
+                                   int                 lda,
+                                   int*                ipiv,
+                                   hipsolverComplex*   B,
+                                   int                 ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    csytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cblas_sytrs<hipsolverDoubleComplex>(hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int*                    ipiv,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    zsytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
@@ -0,0 +1,173 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "../include/reference_cache.hpp"
+#include "../include/utility.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*************************************************************************/
+// Layout of an entry: the header, the key, the sizes of the outputs and the
+// outputs themselves, in the order in which they were added
+
+struct hipsolver_reference_header
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t key_size;
+    uint64_t hash;
+    uint64_t outputs;
+};
+
+static const char hipsolver_reference_magic[8] = {'h', 's', 'r', 'e', 'f', 'c', 'a', 'c'};
+
+static std::string hipsolver_reference_dir;
+
+bool hipsolver_reference_cache_open(const std::string& dir)
+{
+    hipsolver_reference_dir.clear();
+    if(dir.empty())
+        return false;
+
+    // create dir and its missing parents
+    for(size_t pos = dir.find('/', 1);; pos = dir.find('/', pos + 1))
+    {
+        std::string parent = dir.substr(0, pos);
+        if(mkdir(parent.c_str(), 0755) != 0 && errno != EEXIST)
+            return false;
+        if(pos == std::string::npos)
+            break;
+    }
+
+    struct stat info;
+    if(stat(dir.c_str(), &info) != 0 || !S_ISDIR(info.st_mode))
+        return false;
+
+    hipsolver_reference_dir = dir;
+    return true;
+}
+
+bool hipsolver_reference_cache_enabled()
+{
+    return !hipsolver_reference_dir.empty();
+}
+
+const std::string& hipsolver_reference_cache_dir()
+{
+    return hipsolver_reference_dir;
+}
+
+uint64_t hipsolver_reference_seed()
+{
+    return hipsolver_counter_seed;
+}
+
+uint64_t hipsolver_reference_hash(const void* data, size_t size, uint64_t hash)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    for(size_t i = 0; i < size; i++)
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    return hash;
+}
+
+std::string hipsolver_reference_cache::path() const
+{
+    char name[32];
+    snprintf(name, sizeof(name), "/%016llx.bin", (unsigned long long)hash);
+    return hipsolver_reference_dir + name;
+}
+
+bool hipsolver_reference_cache::load()
+{
+    if(!enabled)
+        return false;
+
+    int fd = open(path().c_str(), O_RDONLY);
+    if(fd < 0)
+        return false;
+
+    struct stat info;
+    void*       map = MAP_FAILED;
+    if(fstat(fd, &info) == 0 && info.st_size > 0)
+        map = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(map == MAP_FAILED)
+        return false;
+
+    // check that the entry matches, as a whole, before any output is written
+    const char*                       data   = (const char*)map;
+    size_t                            size   = info.st_size;
+    const hipsolver_reference_header* header = (const hipsolver_reference_header*)data;
+    size_t                            offset = sizeof(hipsolver_reference_header);
+
+    bool valid = size >= offset && !memcmp(header->magic, hipsolver_reference_magic, 8)
+                 && header->version == HIPSOLVER_REFERENCE_CACHE_VERSION
+                 && header->key_size == key.size() && header->hash == hash
+                 && header->outputs == outputs.size();
+    if(valid)
+    {
+        valid  = size >= offset + key.size() && !memcmp(data + offset, key.data(), key.size());
+        offset = offset + key.size();
+    }
+    if(valid)
+    {
+        // the sizes are not aligned in the file
+        size_t total = offset + outputs.size() * sizeof(uint64_t);
+        for(size_t k = 0; valid && k < outputs.size(); k++)
+        {
+            uint64_t bytes;
+            memcpy(&bytes, data + offset + k * sizeof(uint64_t), sizeof(uint64_t));
+            valid = bytes == outputs[k].second;
+            total += bytes;
+        }
+        valid  = valid && size == total;
+        offset = offset + outputs.size() * sizeof(uint64_t);
+    }
+    if(valid)
+    {
+        for(auto& out : outputs)
+        {
+            memcpy(out.first, data + offset, out.second);
+            offset += out.second;
+        }
+    }
+
+    munmap(map, size);
+    return valid;
+}
+
+void hipsolver_reference_cache::store() const
+{
+    if(!enabled)
+        return;
+
+    // the entry is complete before it becomes visible under its name
+    std::string name = path();
+    std::string temp = name + ".tmp" + std::to_string(getpid());
+    FILE*       file = fopen(temp.c_str(), "wb");
+    if(!file)
+        return;
+
+    hipsolver_reference_header header;
+    memcpy(header.magic, hipsolver_reference_magic, 8);
+    header.version  = HIPSOLVER_REFERENCE_CACHE_VERSION;
+    header.key_size = key.size();
+    header.hash     = hash;
+    header.outputs  = outputs.size();
+
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1
+                   && fwrite(key.data(), 1, key.size(), file) == key.size();
+    for(auto& out : outputs)
+        written = written && fwrite(&out.second, sizeof(uint64_t), 1, file) == 1;
+    for(auto& out : outputs)
+        written = written && fwrite(out.first, 1, out.second, file) == out.second;
+
+    if(fclose(file) != 0 || !written || rename(temp.c_str(), name.c_str()) != 0)
+        remove(temp.c_str());
+}
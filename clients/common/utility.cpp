@@ -9,6 +9,9 @@
 hipsolver_rng_t hipsolver_rng(69069);
 hipsolver_rng_t hipsolver_seed(hipsolver_rng);
 
+uint64_t hipsolver_counter_seed   = 69069;
+uint32_t hipsolver_counter_stream = 0;
+
 template <>
 char type2char<float>()
 {
@@ -0,0 +1,111 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+
+#include "clientcommon.hpp"
+#include "stream_gate.hpp"
+
+using namespace std;
+
+/* The tests in this file run getrf with work == nullptr on a handle in
+   HIPSOLVER_ALLOC_MODE_STREAM_ORDERED, on two streams in turn and with growing
+   sizes, so that the workspace of the handle is freed and allocated again on
+   each stream. Each of these calls is made while its stream is held by a host
+   callback: it must return without waiting for the stream, which a synchronous
+   hipMalloc or hipFree would do. The results are checked against LAPACK. The
+   stream-ordered mode is only supported by the rocSOLVER backend, with HIP 5.2
+   or later. */
+
+// factorizes an n-by-n matrix with getrf on stream, optionally while the stream is held
+template <typename T>
+void alloc_mode_run(hipsolverHandle_t handle, hipStream_t stream, int n, bool gated)
+{
+    device_strided_batch_vector<T>   dA(n * n, 1, n * n, 1);
+    device_strided_batch_vector<int> dIpiv(n, 1, n, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    host_strided_batch_vector<T>     hA(n * n, 1, n * n, 1);
+    host_strided_batch_vector<T>     hARes(n * n, 1, n * n, 1);
+    host_strided_batch_vector<int>   hIpiv(n, 1, n, 1);
+    host_strided_batch_vector<int>   hIpivRes(n, 1, n, 1);
+    host_strided_batch_vector<int>   hInfoRes(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    ASSERT_EQ(hipsolverSetStream(handle, stream), HIPSOLVER_STATUS_SUCCESS);
+    hipsolver_seedrand();
+    device_init_dominant<T>(handle, n, n, dA, n, true);
+    CHECK_HIP_ERROR(hA.transfer_from(dA));
+
+    int info;
+    cblas_getrf<T>(n, n, hA[0], n, hIpiv[0], &info);
+    ASSERT_EQ(info, 0);
+
+    stream_gate gate;
+    if(gated)
+        CHECK_HIP_ERROR(gate.hold(stream));
+    EXPECT_EQ(hipsolver_getrf(false,
+                              false,
+                              handle,
+                              n,
+                              n,
+                              dA.data(),
+                              n,
+                              0,
+                              (T*)nullptr,
+                              0,
+                              dIpiv.data(),
+                              0,
+                              dInfo.data(),
+                              1),
+              HIPSOLVER_STATUS_SUCCESS);
+    gate.release();
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    EXPECT_FALSE(gate.timed_out()) << "getrf of size " << n << " waited for its stream";
+
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+    EXPECT_EQ(hInfoRes[0][0], 0);
+    for(int i = 0; i < n; i++)
+        EXPECT_EQ(hIpivRes[0][i], hIpiv[0][i]);
+    double err = norm_error('F', n, n, n, hA[0], hARes[0]);
+    ROCSOLVER_TEST_CHECK(T, err, n);
+}
+
+template <typename T>
+void alloc_mode_test()
+{
+    hipsolver_local_handle handle;
+    hipsolverStatus_t status = hipsolverSetAllocMode(handle, HIPSOLVER_ALLOC_MODE_STREAM_ORDERED);
+    if(status == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        GTEST_SKIP() << "stream-ordered allocation requires HIP 5.2";
+    ASSERT_EQ(status, HIPSOLVER_STATUS_SUCCESS);
+
+    hipStream_t streams[2];
+    CHECK_HIP_ERROR(hipStreamCreate(&streams[0]));
+    CHECK_HIP_ERROR(hipStreamCreate(&streams[1]));
+
+    // the first call hands the workspace of the handle over from rocBLAS, which may synchronize
+    alloc_mode_run<T>(handle, streams[0], 8, false);
+    alloc_mode_run<T>(handle, streams[0], 64, true);
+    alloc_mode_run<T>(handle, streams[1], 150, true);
+    alloc_mode_run<T>(handle, streams[0], 200, true);
+
+    ASSERT_EQ(hipsolverSetStream(handle, 0), HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipStreamDestroy(streams[0]));
+    CHECK_HIP_ERROR(hipStreamDestroy(streams[1]));
+}
+
+TEST(ALLOC_MODE, __float)
+{
+    alloc_mode_test<float>();
+}
+
+TEST(ALLOC_MODE, __double_complex)
+{
+    alloc_mode_test<hipsolverDoubleComplex>();
+}
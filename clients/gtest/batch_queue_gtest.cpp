@@ -0,0 +1,400 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+
+#include "batch_queue.hpp"
+#include <atomic>
+#include <complex>
+#include <memory>
+#include <random>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* The tests in this file submit Cholesky solves to the request-coalescing queue
+   from several threads, with a stand-in for the device that computes each batch
+   on the host and logs it, and check both the results of the requests and how
+   they were batched. */
+
+typedef std::tuple<vector<int>, int> batch_queue_tuple;
+
+// each queue_range is a {max_batch, window_us}
+// each thread_range is the number of submitting threads
+
+const vector<vector<int>> queue_range = {
+    // normal (valid) samples
+    {1, 0},
+    {4, 0},
+    {4, 200},
+    {16, 2000},
+    {8, 1000000}};
+
+const vector<int> thread_range = {1, 8};
+
+// number of requests submitted by each thread
+const int batch_requests = 24;
+
+inline double batch_real(double x)
+{
+    return x;
+}
+
+inline double batch_real(complex<double> x)
+{
+    return x.real();
+}
+
+inline double batch_conj(double x)
+{
+    return x;
+}
+
+inline complex<double> batch_conj(complex<double> x)
+{
+    return std::conj(x);
+}
+
+// imaginary unit, or zero for real types
+inline double batch_unit(double)
+{
+    return 0;
+}
+
+inline complex<double> batch_unit(complex<double>)
+{
+    return complex<double>(0, 1);
+}
+
+template <typename T>
+constexpr hipsolver_batch_precision batch_precision()
+{
+    return std::is_same<T, double>::value ? hipsolver_batch_double
+                                          : hipsolver_batch_double_complex;
+}
+
+// the batches computed by the host device
+struct batch_log
+{
+    mutex          access;
+    vector<size_t> sizes;
+    int            mixed = 0; // batches with incompatible requests
+};
+
+/* Computes a batch with the unblocked Cholesky factorization and substitutions,
+   writing the info of each request. */
+template <typename T>
+rocblas_status batch_host_dispatch(const vector<hipsolver_batch_request*>& batch,
+                                   int*                                    info,
+                                   batch_log&                              log)
+{
+    const hipsolver_batch_request& first = *batch[0];
+    {
+        lock_guard<mutex> lock(log.access);
+        log.sizes.push_back(batch.size());
+        for(hipsolver_batch_request* request : batch)
+            if(request->precision != first.precision || request->uplo != first.uplo
+               || request->n != first.n || request->lda != first.lda)
+                log.mixed++;
+    }
+
+    for(size_t b = 0; b < batch.size(); b++)
+    {
+        hipsolver_batch_request& r     = *batch[b];
+        T*                       A     = (T*)r.A;
+        bool                     upper = r.uplo == rocblas_fill_upper;
+        int                      n = r.n, lda = r.lda;
+
+        // L(i, j) of the lower triangular factor, which is the adjoint of U
+        auto L = [&](int i, int j) -> T& { return upper ? A[j + i * lda] : A[i + j * lda]; };
+        auto Lc
+            = [&](int i, int j) { return upper ? batch_conj(A[j + i * lda]) : A[i + j * lda]; };
+
+        info[b] = 0;
+        for(int j = 0; j < n && info[b] == 0; j++)
+        {
+            double d = batch_real(L(j, j));
+            for(int k = 0; k < j; k++)
+                d -= std::norm(Lc(j, k));
+            if(d <= 0)
+            {
+                info[b] = j + 1;
+                break;
+            }
+            L(j, j) = std::sqrt(d);
+            for(int i = j + 1; i < n; i++)
+            {
+                T s = Lc(i, j);
+                for(int k = 0; k < j; k++)
+                    s -= Lc(i, k) * batch_conj(Lc(j, k));
+                T v = s / batch_real(L(j, j));
+                L(i, j) = upper ? batch_conj(v) : v;
+            }
+        }
+
+        if(info[b] != 0)
+            continue;
+        for(int c = 0; c < r.nrhs; c++)
+        {
+            T* x = (T*)r.B + size_t(c) * r.ldb;
+            for(int i = 0; i < n; i++)
+            {
+                for(int k = 0; k < i; k++)
+                    x[i] -= Lc(i, k) * x[k];
+                x[i] /= batch_real(L(i, i));
+            }
+            for(int i = n - 1; i >= 0; i--)
+            {
+                for(int k = i + 1; k < n; k++)
+                    x[i] -= batch_conj(Lc(k, i)) * x[k];
+                x[i] /= batch_real(L(i, i));
+            }
+        }
+    }
+    return rocblas_status_success;
+}
+
+// a request with its matrices and expected results
+template <typename T>
+struct batch_problem
+{
+    hipsolver_batch_request* request;
+    vector<T>                M, A, X, B;
+    int                      singular; // expected info
+};
+
+// a random problem, or one compatible with all the others made with compatible
+template <typename T>
+batch_problem<T> batch_make_problem(mt19937& rng, bool compatible = false)
+{
+    uniform_real_distribution<double> u(-1, 1);
+    uniform_int_distribution<int>     pick(0, 7);
+
+    batch_problem<T> p;
+    int              n     = compatible || pick(rng) < 4 ? 4 : 7;
+    int              lda   = compatible ? n : n + pick(rng) % 2;
+    int              nrhs  = pick(rng) % 3;
+    int              ldb   = n + pick(rng) % 2;
+    bool             upper = compatible ? false : pick(rng) % 2;
+
+    // hermitian positive definite, or indefinite at a random position
+    p.M.assign(size_t(lda) * n, T(0));
+    for(int j = 0; j < n; j++)
+        for(int i = j; i < n; i++)
+        {
+            T v              = i == j ? T(2 * n) : T(u(rng)) + batch_unit(T()) * u(rng);
+            p.M[i + j * lda] = v;
+            p.M[j + i * lda] = batch_conj(v);
+        }
+    p.singular = pick(rng) == 0 ? 1 + pick(rng) % n : 0;
+    if(p.singular)
+        p.M[(p.singular - 1) * (lda + 1)] = T(-1000);
+
+    // the rows of B past n are left untouched
+    p.X.assign(size_t(ldb) * nrhs, T(0));
+    for(int c = 0; c < nrhs; c++)
+        for(int i = 0; i < n; i++)
+            p.X[i + c * ldb] = T(u(rng)) + batch_unit(T()) * u(rng);
+    p.B.assign(size_t(ldb) * nrhs, T(0));
+    for(int c = 0; c < nrhs; c++)
+        for(int i = 0; i < n; i++)
+            for(int k = 0; k < n; k++)
+                p.B[i + c * ldb] += p.M[i + k * lda] * p.X[k + c * ldb];
+    p.A = p.M;
+
+    p.request            = new hipsolver_batch_request;
+    p.request->precision = batch_precision<T>();
+    p.request->uplo      = upper ? rocblas_fill_upper : rocblas_fill_lower;
+    p.request->n         = n;
+    p.request->nrhs      = nrhs;
+    p.request->A         = p.A.data();
+    p.request->lda       = lda;
+    p.request->B         = p.B.data();
+    p.request->ldb       = ldb;
+    return p;
+}
+
+template <typename T>
+void batch_queue_test(int max_batch, int window_us, int nthreads)
+{
+    batch_log log;
+    auto      queue = make_unique<hipsolver_batch_queue>(
+        max_batch,
+        window_us,
+        [&log](const vector<hipsolver_batch_request*>& batch, int* info) {
+            return batch_host_dispatch<T>(batch, info, log);
+        });
+
+    // each thread submits its requests one at a time, and waits for each of them
+    vector<vector<batch_problem<T>>> problems(nthreads);
+    atomic<int>                      failed(0);
+    vector<thread>                   threads;
+    for(int t = 0; t < nthreads; t++)
+        threads.emplace_back([&, t] {
+            mt19937 rng(t);
+            for(int r = 0; r < batch_requests; r++)
+            {
+                problems[t].push_back(batch_make_problem<T>(rng));
+                batch_problem<T>& p = problems[t].back();
+                queue->submit(p.request);
+
+                // a window that would not expire in the test is flushed
+                if(window_us >= 1000000)
+                    queue->flush();
+
+                int info = -1;
+                if(p.request->wait(&info) != rocblas_status_success || info != p.singular)
+                    failed++;
+                EXPECT_TRUE(p.request->query());
+            }
+        });
+    for(thread& t : threads)
+        t.join();
+    EXPECT_EQ(failed, 0);
+
+    // the results are those of the individual solves
+    for(auto& requests : problems)
+        for(batch_problem<T>& p : requests)
+        {
+            if(!p.singular)
+            {
+                for(size_t k = 0; k < p.B.size(); k++)
+                    EXPECT_LE(std::abs(p.B[k] - p.X[k]), 1e-10);
+            }
+            delete p.request;
+        }
+
+    // batches are compatible and within the limit
+    size_t total = 0;
+    EXPECT_EQ(log.mixed, 0);
+    for(size_t size : log.sizes)
+    {
+        EXPECT_LE(size, size_t(max_batch));
+        total += size;
+    }
+    EXPECT_EQ(total, size_t(nthreads) * batch_requests);
+}
+
+// a batch is dispatched as soon as it is full, without waiting for the window
+template <typename T>
+void batch_queue_full_test(int max_batch)
+{
+    batch_log             log;
+    mt19937               rng(5);
+    hipsolver_batch_queue queue(
+        max_batch,
+        1000000000,
+        [&log](const vector<hipsolver_batch_request*>& batch, int* info) {
+            return batch_host_dispatch<T>(batch, info, log);
+        });
+
+    vector<batch_problem<T>> problems;
+    for(int r = 0; r < 2 * max_batch; r++)
+    {
+        problems.push_back(batch_make_problem<T>(rng, true));
+        queue.submit(problems.back().request);
+    }
+    for(batch_problem<T>& p : problems)
+    {
+        int info = -1;
+        EXPECT_EQ(p.request->wait(&info), rocblas_status_success);
+        EXPECT_EQ(info, p.singular);
+        delete p.request;
+    }
+
+    lock_guard<mutex> lock(log.access);
+    EXPECT_EQ(log.sizes, vector<size_t>(2, max_batch));
+}
+
+// requests pending when the queue is destroyed are completed
+template <typename T>
+void batch_queue_destroy_test(int max_batch)
+{
+    batch_log                log;
+    mt19937                  rng(7);
+    vector<batch_problem<T>> problems;
+    {
+        hipsolver_batch_queue queue(
+            max_batch,
+            1000000000,
+            [&log](const vector<hipsolver_batch_request*>& batch, int* info) {
+                return batch_host_dispatch<T>(batch, info, log);
+            });
+        for(int r = 0; r < 2 * max_batch + 1; r++)
+        {
+            problems.push_back(batch_make_problem<T>(rng));
+            queue.submit(problems.back().request);
+        }
+    }
+
+    for(batch_problem<T>& p : problems)
+    {
+        int info = -1;
+        EXPECT_TRUE(p.request->query());
+        EXPECT_EQ(p.request->wait(&info), rocblas_status_success);
+        EXPECT_EQ(info, p.singular);
+        delete p.request;
+    }
+}
+
+// the status returned by the device is that of all the requests of the batch
+template <typename T>
+void batch_queue_error_test(int max_batch)
+{
+    mt19937          rng(3);
+    batch_problem<T> p = batch_make_problem<T>(rng);
+    {
+        hipsolver_batch_queue queue(
+            max_batch, 0, [](const vector<hipsolver_batch_request*>&, int*) {
+                return rocblas_status_memory_error;
+            });
+        queue.submit(p.request);
+
+        int info;
+        EXPECT_EQ(p.request->wait(&info), rocblas_status_memory_error);
+    }
+    delete p.request;
+}
+
+class BATCH_QUEUE : public ::TestWithParam<batch_queue_tuple>
+{
+protected:
+    BATCH_QUEUE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        vector<int> queue    = std::get<0>(GetParam());
+        int         nthreads = std::get<1>(GetParam());
+
+        batch_queue_test<T>(queue[0], queue[1], nthreads);
+        batch_queue_full_test<T>(queue[0]);
+        batch_queue_destroy_test<T>(queue[0]);
+        batch_queue_error_test<T>(queue[0]);
+    }
+};
+
+TEST_P(BATCH_QUEUE, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(BATCH_QUEUE, __double_complex)
+{
+    run_tests<complex<double>>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         BATCH_QUEUE,
+                         Combine(ValuesIn(queue_range), ValuesIn(thread_range)));
+
+#endif
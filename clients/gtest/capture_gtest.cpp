@@ -0,0 +1,177 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+
+#include "clientcommon.hpp"
+#include <algorithm>
+
+using namespace std;
+
+/* The tests in this file capture potrf and getrf into a HIP graph with the
+   handle in HIPSOLVER_CAPTURE_MODE_SAFE, replay the graph and check the
+   results against LAPACK. The workspace is reserved beforehand with
+   hipsolverReserveWorkspace, after which the capture query must report that
+   the calls need no allocation. Graphs are only captured by the rocSOLVER
+   backend, so these tests are not built for the other ones. */
+
+// restores A and G from A0 and G0, and factorizes A with potrf and G with getrf
+template <typename T>
+hipsolverStatus_t capture_run(hipsolverHandle_t                 handle,
+                              hipStream_t                       stream,
+                              int                               n,
+                              int                               lda,
+                              device_strided_batch_vector<T>&   dA0,
+                              device_strided_batch_vector<T>&   dG0,
+                              device_strided_batch_vector<T>&   dA,
+                              device_strided_batch_vector<T>&   dG,
+                              device_strided_batch_vector<int>& dIpiv,
+                              device_strided_batch_vector<int>& dInfo)
+{
+    size_t size = sizeof(T) * lda * n;
+    if(hipMemcpyAsync(dA.data(), dA0.data(), size, hipMemcpyDeviceToDevice, stream) != hipSuccess
+       || hipMemcpyAsync(dG.data(), dG0.data(), size, hipMemcpyDeviceToDevice, stream)
+              != hipSuccess)
+        return HIPSOLVER_STATUS_EXECUTION_FAILED;
+
+    // work is null, so the calls use the workspace of the handle
+    hipsolverStatus_t status = hipsolver_potrf(false,
+                                               handle,
+                                               HIPSOLVER_FILL_MODE_UPPER,
+                                               n,
+                                               dA.data(),
+                                               lda,
+                                               0,
+                                               (T*)nullptr,
+                                               0,
+                                               dInfo[0],
+                                               1);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    return hipsolver_getrf(false,
+                           false,
+                           handle,
+                           n,
+                           n,
+                           dG.data(),
+                           lda,
+                           0,
+                           (T*)nullptr,
+                           0,
+                           dIpiv.data(),
+                           0,
+                           dInfo[0] + 1,
+                           1);
+}
+
+template <typename T>
+void capture_test(int n, int lda)
+{
+    hipsolver_local_handle handle;
+    hipStream_t            stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    ASSERT_EQ(hipsolverSetStream(handle, stream), HIPSOLVER_STATUS_SUCCESS);
+
+    size_t                           size_A = size_t(lda) * n;
+    device_strided_batch_vector<T>   dA0(size_A, 1, size_A, 1);
+    device_strided_batch_vector<T>   dG0(size_A, 1, size_A, 1);
+    device_strided_batch_vector<T>   dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<T>   dG(size_A, 1, size_A, 1);
+    device_strided_batch_vector<int> dIpiv(n, 1, n, 1);
+    device_strided_batch_vector<int> dInfo(2, 1, 2, 1);
+    host_strided_batch_vector<T>     hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T>     hG(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T>     hARes(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T>     hGRes(size_A, 1, size_A, 1);
+    host_strided_batch_vector<int>   hIpiv(n, 1, n, 1);
+    host_strided_batch_vector<int>   hIpivRes(n, 1, n, 1);
+    host_strided_batch_vector<int>   hInfoRes(2, 1, 2, 1);
+    CHECK_HIP_ERROR(dA0.memcheck());
+    CHECK_HIP_ERROR(dG0.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dG.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // an SPD matrix for potrf and a matrix on which getrf must pivot, with their factors
+    hipsolver_seedrand();
+    device_init_hpd<T>(handle, n, dA0, lda);
+    device_init_dominant<T>(handle, n, n, dG0, lda, true);
+    CHECK_HIP_ERROR(hA.transfer_from(dA0));
+    CHECK_HIP_ERROR(hG.transfer_from(dG0));
+
+    int info;
+    cblas_potrf<T>(HIPSOLVER_FILL_MODE_UPPER, n, hA[0], lda, &info);
+    ASSERT_EQ(info, 0);
+    cblas_getrf<T>(n, n, hG[0], lda, hIpiv[0], &info);
+    ASSERT_EQ(info, 0);
+
+    // reserving the workspace of both calls lets them be captured
+    int lwork_potrf, lwork_getrf;
+    ASSERT_EQ(hipsolver_potrf_bufferSize(
+                  false, handle, HIPSOLVER_FILL_MODE_UPPER, n, dA.data(), lda, &lwork_potrf, 1),
+              HIPSOLVER_STATUS_SUCCESS);
+    ASSERT_EQ(hipsolver_getrf_bufferSize(false, handle, n, n, dG.data(), lda, &lwork_getrf),
+              HIPSOLVER_STATUS_SUCCESS);
+    ASSERT_EQ(hipsolverSetCaptureMode(handle, HIPSOLVER_CAPTURE_MODE_SAFE),
+              HIPSOLVER_STATUS_SUCCESS);
+    ASSERT_EQ(hipsolverReserveWorkspace(handle, sizeof(T) * max(lwork_potrf, lwork_getrf)),
+              HIPSOLVER_STATUS_SUCCESS);
+
+    int capturable = 0;
+    ASSERT_EQ(hipsolverStartCaptureQuery(handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(capture_run<T>(handle, stream, n, lda, dA0, dG0, dA, dG, dIpiv, dInfo),
+              HIPSOLVER_STATUS_SUCCESS);
+    ASSERT_EQ(hipsolverStopCaptureQuery(handle, &capturable), HIPSOLVER_STATUS_SUCCESS);
+    ASSERT_EQ(capturable, 1);
+
+    // the capture fails if a call allocates or synchronizes
+    hipGraph_t     graph;
+    hipGraphExec_t exec;
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    hipsolverStatus_t status
+        = capture_run<T>(handle, stream, n, lda, dA0, dG0, dA, dG, dIpiv, dInfo);
+    CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+    ASSERT_EQ(status, HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0));
+
+    // every replay starts again from A0 and G0
+    for(int replay = 0; replay < 2; replay++)
+    {
+        CHECK_HIP_ERROR(hipMemset(dA.data(), 0, sizeof(T) * size_A));
+        CHECK_HIP_ERROR(hipMemset(dInfo.data(), -1, sizeof(int) * 2));
+        CHECK_HIP_ERROR(hipGraphLaunch(exec, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        CHECK_HIP_ERROR(hARes.transfer_from(dA));
+        CHECK_HIP_ERROR(hGRes.transfer_from(dG));
+        CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+        CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+        EXPECT_EQ(hInfoRes[0][0], 0);
+        EXPECT_EQ(hInfoRes[0][1], 0);
+        for(int i = 0; i < n; i++)
+            EXPECT_EQ(hIpivRes[0][i], hIpiv[0][i]);
+
+        // the lower triangle of A is not referenced by potrf
+        double err = max(norm_error_upperTr('F', n, n, lda, hA[0], hARes[0]),
+                         norm_error('F', n, n, lda, hG[0], hGRes[0]));
+        ROCSOLVER_TEST_CHECK(T, err, n);
+    }
+
+    CHECK_HIP_ERROR(hipGraphExecDestroy(exec));
+    CHECK_HIP_ERROR(hipGraphDestroy(graph));
+    ASSERT_EQ(hipsolverSetStream(handle, 0), HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
+
+TEST(CAPTURE, __graph)
+{
+    capture_test<float>(40, 40);
+    capture_test<double>(65, 70);
+    capture_test<hipsolverComplex>(33, 40);
+    capture_test<hipsolverDoubleComplex>(64, 64);
+}
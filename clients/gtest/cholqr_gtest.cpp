@@ -0,0 +1,218 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_cholqr.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> cholqr_tuple;
+
+// each matrix_size_range is a {m, lda}
+// each n_size_range is a {n, ldr}
+
+// case when m = n = -1 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    {50, 50},
+    {600, 610},
+    {3000, 3000},
+    {20000, 20010}};
+
+const vector<vector<int>> n_size_range = {
+    // invalid
+    {-1, 1},
+    {16, 8},
+    // normal (valid) samples
+    {1, 1},
+    {4, 10},
+    {16, 16},
+    {32, 40}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_size_range = {
+//     {100000, 100000},
+//     {1000000, 1000000},
+// };
+
+// const vector<vector<int>> large_n_size_range = {{64, 64}, {128, 130}};
+
+Arguments cholqr_setup_arguments(cholqr_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> n_size      = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", matrix_size[0]);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+    arg.set<rocblas_int>("n", n_size[0]);
+    arg.set<rocblas_int>("ldr", n_size[1]);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <bool FORTRAN, bool SHIFTED>
+class CHOLQR_BASE : public ::TestWithParam<cholqr_tuple>
+{
+protected:
+    CHOLQR_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = cholqr_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == -1 && arg.peek<rocblas_int>("n") == -1)
+            testing_cholqr_bad_arg<FORTRAN, SHIFTED, T>();
+
+        testing_cholqr<FORTRAN, SHIFTED, T>(arg);
+    }
+};
+
+class CHOLQR2 : public CHOLQR_BASE<false, false>
+{
+};
+
+class CHOLQR2_FORTRAN : public CHOLQR_BASE<true, false>
+{
+};
+
+class CHOLQR3 : public CHOLQR_BASE<false, true>
+{
+};
+
+class CHOLQR3_FORTRAN : public CHOLQR_BASE<true, true>
+{
+};
+
+// cholqr2 and cholqr3 are not provided by the cuSOLVER backend
+#if !defined(__HIP_PLATFORM_NVCC__)
+
+TEST_P(CHOLQR2, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(CHOLQR2, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(CHOLQR2, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(CHOLQR2, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+TEST_P(CHOLQR2_FORTRAN, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(CHOLQR2_FORTRAN, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(CHOLQR2_FORTRAN, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(CHOLQR2_FORTRAN, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+TEST_P(CHOLQR3, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(CHOLQR3, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(CHOLQR3, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(CHOLQR3, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+TEST_P(CHOLQR3_FORTRAN, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(CHOLQR3_FORTRAN, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(CHOLQR3_FORTRAN, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(CHOLQR3_FORTRAN, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          CHOLQR2,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         CHOLQR2,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          CHOLQR2_FORTRAN,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         CHOLQR2_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          CHOLQR3,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         CHOLQR3,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          CHOLQR3_FORTRAN,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         CHOLQR3_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+#endif
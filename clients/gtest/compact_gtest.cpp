@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_compact.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<char>> compact_tuple;
+
+// each size_range vector is a {n, nrhs, bc}
+// (the batch sizes cover full groups of the compact layout and a partial last group)
+
+// each opt_range vector is a {uplo, trans}
+
+// case when n = -1 and uplo = L will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<vector<char>> opt_range = {{'L', 'N'}, {'U', 'T'}, {'U', 'C'}};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // invalid
+    {-1, 1, 1},
+    {17, 1, 1},
+    {4, 1, -1},
+    // normal (valid) samples
+    {0, 1, 3},
+    {4, 0, 3},
+    {1, 1, 1},
+    {4, 2, 7},
+    {8, 1, 17},
+    {11, 3, 32},
+    {16, 5, 40}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_size_range = {
+//     {16, 16, 100000},
+// };
+
+Arguments compact_setup_arguments(compact_tuple tup)
+{
+    vector<int>  matrix_size = std::get<0>(tup);
+    vector<char> opt         = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("nrhs", matrix_size[1]);
+    arg.batch_count = matrix_size[2];
+
+    arg.set<char>("uplo", opt[0]);
+    arg.set<char>("trans", opt[1]);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <bool FORTRAN>
+class COMPACT_BASE : public ::TestWithParam<compact_tuple>
+{
+protected:
+    COMPACT_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = compact_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == -1 && arg.peek<char>("uplo") == 'L')
+            testing_compact_bad_arg<FORTRAN, T>();
+
+        testing_compact<FORTRAN, T>(arg);
+    }
+};
+
+class COMPACT : public COMPACT_BASE<false>
+{
+};
+
+class COMPACT_FORTRAN : public COMPACT_BASE<true>
+{
+};
+
+// the compact layout functions are not provided by the cuSOLVER backend
+#if !defined(__HIP_PLATFORM_NVCC__)
+
+TEST_P(COMPACT, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(COMPACT, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(COMPACT, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(COMPACT, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+TEST_P(COMPACT_FORTRAN, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(COMPACT_FORTRAN, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(COMPACT_FORTRAN, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(COMPACT_FORTRAN, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          COMPACT,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(opt_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         COMPACT,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(opt_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          COMPACT_FORTRAN,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(opt_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         COMPACT_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(opt_range)));
+
+#endif
@@ -0,0 +1,143 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+
+#include "clientcommon.hpp"
+#include "stream_gate.hpp"
+#include <mutex>
+
+using namespace std;
+
+/* The tests in this file record a completion right after getrf on matrices
+   with known zero pivots, while the stream of the handle is held so that the
+   factorizations are still pending, and check that the completion is only
+   reported as done, with the info and a single call of its callback, once
+   the stream is let go. The host backend computes the calls before they
+   return, so these tests are only built for the rocSOLVER backend. */
+
+struct completion_calls
+{
+    std::mutex        mutex;
+    int               calls  = 0;
+    hipsolverStatus_t status = HIPSOLVER_STATUS_NOT_INITIALIZED;
+    vector<int>       info;
+};
+
+void completion_callback(hipsolverStatus_t status, const int* info, int count, void* data)
+{
+    completion_calls*           c = (completion_calls*)data;
+    std::lock_guard<std::mutex> lock(c->mutex);
+    c->calls++;
+    c->status = status;
+    c->info.assign(info, info + count);
+}
+
+template <typename T>
+void completion_test(int n, int bc)
+{
+    hipsolver_local_handle handle;
+    hipStream_t            stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    ASSERT_EQ(hipsolverSetStream(handle, stream), HIPSOLVER_STATUS_SUCCESS);
+
+    device_strided_batch_vector<T>   dA(n * n, 1, n * n, bc);
+    device_strided_batch_vector<int> dIpiv(n, 1, n, bc);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+    host_strided_batch_vector<T>     hA(n * n, 1, n * n, bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // matrix b > 0 has a zero column 2 b - 1, so that its info is 2 b; matrix 0 is regular
+    vector<int> expected(bc, 0);
+    hipsolver_seedrand();
+    device_init_dominant<T>(handle, n, n, dA, n);
+    CHECK_HIP_ERROR(hA.transfer_from(dA));
+    for(int b = 1; b < bc; b++)
+    {
+        for(int i = 0; i < n; i++)
+            hA[b][i + (2 * b - 1) * n] = T(0);
+        expected[b] = 2 * b;
+    }
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    auto factorize = [&]() {
+        for(int b = 0; b < bc; b++)
+            ASSERT_EQ(hipsolver_getrf(false,
+                                      false,
+                                      handle,
+                                      n,
+                                      n,
+                                      dA[b],
+                                      n,
+                                      0,
+                                      (T*)nullptr,
+                                      0,
+                                      dIpiv[b],
+                                      0,
+                                      dInfo[b],
+                                      1),
+                      HIPSOLVER_STATUS_SUCCESS);
+    };
+
+    // the first call may allocate the workspace of the handle, which synchronizes
+    factorize();
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    completion_calls      calls;
+    hipsolverCompletion_t completion;
+    ASSERT_EQ(hipsolverCreateCompletion(&completion), HIPSOLVER_STATUS_SUCCESS);
+    ASSERT_EQ(hipsolverSetCompletionCallback(completion, completion_callback, &calls),
+              HIPSOLVER_STATUS_SUCCESS);
+
+    stream_gate gate;
+    CHECK_HIP_ERROR(gate.hold(stream));
+    factorize();
+    ASSERT_EQ(hipsolverRecordCompletion(handle, dInfo.data(), bc, completion),
+              HIPSOLVER_STATUS_SUCCESS);
+
+    // nothing is reported while the factorizations are pending
+    int         done = 1;
+    vector<int> info(bc, -1);
+    EXPECT_EQ(hipsolverQueryCompletion(completion, &done, info.data()), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(done, 0);
+    {
+        std::lock_guard<std::mutex> lock(calls.mutex);
+        EXPECT_EQ(calls.calls, 0);
+    }
+
+    gate.release();
+    EXPECT_EQ(hipsolverWaitCompletion(completion, info.data()), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(info, expected);
+    {
+        std::lock_guard<std::mutex> lock(calls.mutex);
+        EXPECT_EQ(calls.calls, 1);
+        EXPECT_EQ(calls.status, HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_EQ(calls.info, expected);
+    }
+
+    info.assign(bc, -1);
+    EXPECT_EQ(hipsolverQueryCompletion(completion, &done, info.data()), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(done, 1);
+    EXPECT_EQ(info, expected);
+
+    EXPECT_EQ(hipsolverDestroyCompletion(completion), HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    EXPECT_FALSE(gate.timed_out());
+    {
+        std::lock_guard<std::mutex> lock(calls.mutex);
+        EXPECT_EQ(calls.calls, 1);
+    }
+
+    ASSERT_EQ(hipsolverSetStream(handle, 0), HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
+
+TEST(COMPLETION, __record)
+{
+    completion_test<float>(20, 4);
+    completion_test<hipsolverDoubleComplex>(33, 6);
+}
@@ -0,0 +1,154 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+
+#include "clientcommon.hpp"
+
+using namespace std;
+
+/* The tests in this file generate matrices on the device and check them on
+   the host: the uniform matrices against rocblas_init, and the other ones
+   against the property for which they are generated. */
+
+template <typename T>
+void device_init_uniform_test(int m, int n, int lda, int bc)
+{
+    hipsolver_local_handle         handle;
+    device_strided_batch_vector<T> dA(lda * n, 1, lda * n, bc);
+    host_strided_batch_vector<T>   hA(lda * n, 1, lda * n, bc);
+    vector<T>                      A(lda * n * bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+
+    // the same elements as a fill of the host from the same stream
+    hipsolver_seedrand();
+    device_init_uniform<T>(handle, m, n, dA, lda);
+    hipsolver_seedrand();
+    rocblas_init<T>(A, m, n, lda, lda * n, bc);
+
+    CHECK_HIP_ERROR(hA.transfer_from(dA));
+    for(int b = 0; b < bc; b++)
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < m; i++)
+                ASSERT_EQ(hA[b][i + j * lda], A[i + j * lda + b * lda * n]);
+}
+
+TEST(DEVICE_INIT, __uniform)
+{
+    device_init_uniform_test<float>(37, 21, 40, 3);
+    device_init_uniform_test<hipsolverDoubleComplex>(21, 37, 21, 2);
+}
+
+TEST(DEVICE_INIT, __dominant)
+{
+    const int m = 45, n = 30, lda = 50, bc = 2;
+
+    hipsolver_local_handle              handle;
+    device_strided_batch_vector<double> dA(lda * n, 1, lda * n, bc);
+    host_strided_batch_vector<double>   hA(lda * n, 1, lda * n, bc);
+    host_strided_batch_vector<double>   hF(lda * n, 1, lda * n, bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+
+    hipsolver_seedrand();
+    device_init_dominant<double>(handle, m, n, dA, lda);
+    CHECK_HIP_ERROR(hA.transfer_from(dA));
+    hipsolver_seedrand();
+    device_init_dominant<double>(handle, m, n, dA, lda, true);
+    CHECK_HIP_ERROR(hF.transfer_from(dA));
+
+    for(int b = 0; b < bc; b++)
+    {
+        for(int k = 0; k < n; k++)
+        {
+            // the diagonal exceeds the sum of the other entries of its row and of its column
+            double row = 0, col = 0;
+            for(int j = 0; j < n; j++)
+                row += j == k ? 0 : std::abs(hA[b][k + j * lda]);
+            for(int i = 0; i < m; i++)
+                col += i == k ? 0 : std::abs(hA[b][i + k * lda]);
+            EXPECT_GT(hA[b][k + k * lda], row);
+            EXPECT_GT(hA[b][k + k * lda], col);
+        }
+
+        // the flipped matrix has the same rows in the reverse order
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < m; i++)
+                ASSERT_EQ(hF[b][i + j * lda], hA[b][m - 1 - i + j * lda]);
+    }
+}
+
+TEST(DEVICE_INIT, __hpd)
+{
+    const int n = 60, lda = 64, bc = 3;
+
+    hipsolver_local_handle                      handle;
+    device_batch_vector<hipsolverDoubleComplex> dA(lda * n, 1, bc);
+    host_batch_vector<hipsolverDoubleComplex>   hA(lda * n, 1, bc);
+    host_strided_batch_vector<int>              hInfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+
+    hipsolver_seedrand();
+    device_init_hpd<hipsolverDoubleComplex>(handle, n, dA, lda);
+    CHECK_HIP_ERROR(hA.transfer_from(dA));
+
+    for(int b = 0; b < bc; b++)
+    {
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < n; i++)
+                ASSERT_EQ(hA[b][i + j * lda], std::conj(hA[b][j + i * lda]));
+
+        cblas_potrf<hipsolverDoubleComplex>(HIPSOLVER_FILL_MODE_LOWER, n, hA[b], lda, hInfo[b]);
+        EXPECT_EQ(hInfo[b][0], 0);
+    }
+}
+
+template <typename T>
+void device_init_spectrum_test(int n, int lda, int bc, double cond, double tol)
+{
+    using S = real_t<T>;
+
+    hipsolver_local_handle         handle;
+    device_strided_batch_vector<T> dA(lda * n, 1, lda * n, bc);
+    host_strided_batch_vector<T>   hA(lda * n, 1, lda * n, bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+
+    hipsolver_seedrand();
+    device_init_spectrum<T>(handle, n, dA, lda, cond);
+    CHECK_HIP_ERROR(hA.transfer_from(dA));
+
+    int         lwork = 2 * n + 1, lrwork = 3 * n + 1, liwork = 1, info;
+    vector<T>   work(lwork);
+    vector<S>   D(n), rwork(lrwork);
+    vector<int> iwork(liwork);
+    for(int b = 0; b < bc; b++)
+    {
+        cblas_syevd_heevd<T>(HIPSOLVER_EIG_MODE_NOVECTOR,
+                             HIPSOLVER_FILL_MODE_UPPER,
+                             n,
+                             hA[b],
+                             lda,
+                             D.data(),
+                             work.data(),
+                             lwork,
+                             rwork.data(),
+                             lrwork,
+                             iwork.data(),
+                             liwork,
+                             &info);
+        ASSERT_EQ(info, 0);
+
+        // the eigenvalues are in ascending order
+        for(int k = 0; k < n; k++)
+            EXPECT_NEAR(D[k], std::pow(cond, -double(n - 1 - k) / (n - 1)), tol);
+    }
+}
+
+TEST(DEVICE_INIT, __spectrum)
+{
+    device_init_spectrum_test<double>(50, 50, 2, 1e3, 1e-12);
+    device_init_spectrum_test<float>(33, 40, 1, 1e2, 1e-5);
+    device_init_spectrum_test<hipsolverComplex>(40, 40, 2, 1e2, 1e-5);
+    device_init_spectrum_test<hipsolverDoubleComplex>(64, 70, 1, 1e4, 1e-12);
+}
@@ -0,0 +1,392 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+
+#include "clientcommon.hpp"
+#include <cmath>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* The tests in this file run potrf, getrf and getrs on pinned host memory with
+   the handle in HIPSOLVER_DISPATCH_MODE_DEVICE and in HIPSOLVER_DISPATCH_MODE_AUTO,
+   with thresholds that send the problems to either engine, and check that the
+   results agree. Device memory must give the same results in both modes, as it
+   is never sent to the host. */
+
+typedef std::tuple<vector<int>, vector<char>> dispatch_tuple;
+
+// each size_range vector is a {n, nrhs, lda}
+// each opt_range vector is a {uplo, trans}
+
+const vector<vector<int>> size_range = {
+    // normal (valid) samples
+    {1, 1, 1},
+    {5, 2, 5},
+    {16, 3, 20},
+    {40, 1, 40},
+    {70, 4, 71}};
+
+const vector<vector<char>> opt_range = {{'L', 'N'}, {'U', 'T'}, {'U', 'C'}};
+
+template <typename T, typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0>
+T dispatch_value(double re, double im)
+{
+    return T(re);
+}
+
+template <typename T, typename std::enable_if<!std::is_floating_point<T>::value, int>::type = 0>
+T dispatch_value(double re, double im)
+{
+    return T(re, im);
+}
+
+template <typename T, typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0>
+double dispatch_diff(T a, T b)
+{
+    return std::abs(double(a) - double(b));
+}
+
+template <typename T, typename std::enable_if<!std::is_floating_point<T>::value, int>::type = 0>
+double dispatch_diff(T a, T b)
+{
+    return std::hypot(double(a.real()) - b.real(), double(a.imag()) - b.imag());
+}
+
+template <typename T>
+constexpr hipsolverPrecision_t dispatch_precision()
+{
+    return std::is_same<T, float>::value              ? HIPSOLVER_PRECISION_SINGLE
+           : std::is_same<T, double>::value           ? HIPSOLVER_PRECISION_DOUBLE
+           : std::is_same<T, hipsolverComplex>::value ? HIPSOLVER_PRECISION_SINGLE_COMPLEX
+                                                      : HIPSOLVER_PRECISION_DOUBLE_COMPLEX;
+}
+
+// array of count elements in pinned host memory (host) or device memory (!host)
+template <typename T>
+class dispatch_array
+{
+public:
+    dispatch_array(size_t count, bool host)
+        : count_(count)
+        , host_(host)
+    {
+        if(host)
+            EXPECT_EQ(hipHostMalloc((void**)&data_, sizeof(T) * count, 0), hipSuccess);
+        else
+            EXPECT_EQ(hipMalloc((void**)&data_, sizeof(T) * count), hipSuccess);
+    }
+    ~dispatch_array()
+    {
+        if(host_)
+            hipHostFree(data_);
+        else
+            hipFree(data_);
+    }
+
+    dispatch_array(const dispatch_array&) = delete;
+    dispatch_array& operator=(const dispatch_array&) = delete;
+
+    T* data()
+    {
+        return data_;
+    }
+
+    void write(const vector<T>& v)
+    {
+        EXPECT_EQ(hipMemcpy(data_, v.data(), sizeof(T) * count_, hipMemcpyHostToDevice),
+                  hipSuccess);
+    }
+    vector<T> read()
+    {
+        vector<T> v(count_);
+        EXPECT_EQ(hipMemcpy(v.data(), data_, sizeof(T) * count_, hipMemcpyDeviceToHost),
+                  hipSuccess);
+        return v;
+    }
+
+private:
+    T*     data_ = nullptr;
+    size_t count_;
+    bool   host_;
+};
+
+/* Factorizes A (SPD if potrf) with potrf or getrf and solves for B with getrs
+   on arrays in pinned host memory or device memory, and returns the factor,
+   info and the solution. */
+template <typename T>
+void dispatch_run(hipsolverHandle_t    handle,
+                  bool                 potrf,
+                  bool                 host,
+                  hipsolverFillMode_t  uplo,
+                  hipsolverOperation_t trans,
+                  int                  n,
+                  int                  nrhs,
+                  int                  lda,
+                  const vector<T>&     hA,
+                  const vector<T>&     hB,
+                  vector<T>&           hF,
+                  vector<T>&           hX,
+                  int&                 hInfo)
+{
+    dispatch_array<T>   A(size_t(lda) * n, host);
+    dispatch_array<T>   B(size_t(lda) * nrhs, host);
+    dispatch_array<int> ipiv(n, host);
+    dispatch_array<int> info(1, host);
+    A.write(hA);
+    B.write(hB);
+
+    if(potrf)
+        EXPECT_EQ(
+            hipsolver_potrf(false, handle, uplo, n, A.data(), lda, 0, nullptr, 0, info.data(), 1),
+            HIPSOLVER_STATUS_SUCCESS);
+    else
+    {
+        EXPECT_EQ(hipsolver_getrf(false,
+                                  false,
+                                  handle,
+                                  n,
+                                  n,
+                                  A.data(),
+                                  lda,
+                                  0,
+                                  nullptr,
+                                  0,
+                                  ipiv.data(),
+                                  0,
+                                  info.data(),
+                                  1),
+                  HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_EQ(hipsolver_getrs(false,
+                                  handle,
+                                  trans,
+                                  n,
+                                  nrhs,
+                                  A.data(),
+                                  lda,
+                                  0,
+                                  ipiv.data(),
+                                  0,
+                                  B.data(),
+                                  lda,
+                                  0,
+                                  nullptr,
+                                  0,
+                                  info.data(),
+                                  1),
+                  HIPSOLVER_STATUS_SUCCESS);
+    }
+
+    // the host engine runs in stream order, so the results are read after a synchronization
+    EXPECT_EQ(hipDeviceSynchronize(), hipSuccess);
+    hF    = A.read();
+    hX    = B.read();
+    hInfo = info.read()[0];
+}
+
+template <typename T>
+void dispatch_test(int n, int nrhs, int lda, char uplo, char trans)
+{
+    hipsolverFillMode_t  fill = uplo == 'U' ? HIPSOLVER_FILL_MODE_UPPER : HIPSOLVER_FILL_MODE_LOWER;
+    hipsolverOperation_t op   = trans == 'N'   ? HIPSOLVER_OP_N
+                                : trans == 'T' ? HIPSOLVER_OP_T
+                                               : HIPSOLVER_OP_C;
+    hipsolverPrecision_t precision = dispatch_precision<T>();
+
+    // A is Hermitian and diagonally dominant, so it is SPD; G is general, so that getrf pivots
+    mt19937                           gen(n * 131 + nrhs);
+    uniform_real_distribution<double> dist(-1, 1);
+    vector<T> hA(size_t(lda) * n), hG(size_t(lda) * n), hB(size_t(lda) * nrhs);
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i <= j; i++)
+        {
+            double re = dist(gen), im = i == j ? 0 : dist(gen);
+            if(i == j)
+                re += n;
+            hA[i + size_t(j) * lda] = dispatch_value<T>(re, im);
+            hA[j + size_t(i) * lda] = dispatch_value<T>(re, -im);
+        }
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i < n; i++)
+            hG[i + size_t(j) * lda] = dispatch_value<T>(dist(gen) + (i == j ? 2 : 0), dist(gen));
+    for(auto& b : hB)
+        b = dispatch_value<T>(dist(gen), dist(gen));
+
+    // the matrix with a negative pivot in the middle, which potrf must report
+    vector<T> hN = hA;
+    hN[n / 2 + size_t(n / 2) * lda] = dispatch_value<T>(-1, 0);
+
+    hipsolverHandle_t handle;
+    ASSERT_EQ(hipsolverCreate(&handle), HIPSOLVER_STATUS_SUCCESS);
+
+    // the engines only differ by rounding
+    using S = typename std::conditional<std::is_same<T, float>::value
+                                            || std::is_same<T, hipsolverComplex>::value,
+                                        float,
+                                        double>::type;
+    double tol = 100.0 * n * n * std::numeric_limits<S>::epsilon();
+
+    // potrf on A and N, and getrf and getrs on G
+    for(int c = 0; c < 3; c++)
+    {
+        bool             potrf = c < 2;
+        const vector<T>* M     = c == 0 ? &hA : (c == 1 ? &hN : &hG);
+
+        // reference on the device engine
+        vector<T> rF, rX;
+        int       rInfo;
+        ASSERT_EQ(hipsolverSetDispatchMode(handle, HIPSOLVER_DISPATCH_MODE_DEVICE),
+                  HIPSOLVER_STATUS_SUCCESS);
+        dispatch_run<T>(handle, potrf, true, fill, op, n, nrhs, lda, *M, hB, rF, rX, rInfo);
+
+        // thresholds below and at n, on host and device memory
+        ASSERT_EQ(hipsolverSetDispatchMode(handle, HIPSOLVER_DISPATCH_MODE_AUTO),
+                  HIPSOLVER_STATUS_SUCCESS);
+        for(int threshold : {n - 1, n})
+        {
+            for(hipsolverDispatchRoutine_t routine :
+                {HIPSOLVER_DISPATCH_POTRF, HIPSOLVER_DISPATCH_GETRF, HIPSOLVER_DISPATCH_GETRS})
+                ASSERT_EQ(hipsolverSetDispatchThreshold(handle, routine, precision, threshold),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+            for(int host = 0; host < 2; host++)
+            {
+                vector<T> F, X;
+                int       info;
+                dispatch_run<T>(handle, potrf, host, fill, op, n, nrhs, lda, *M, hB, F, X, info);
+
+                EXPECT_EQ(info, rInfo);
+                if(rInfo != 0)
+                    continue;
+
+                // the factors and the solution; the other triangle of A is not referenced
+                double err = 0;
+                for(int j = 0; j < n; j++)
+                    for(int i = 0; i < n; i++)
+                    {
+                        bool used = !potrf || (uplo == 'U' ? i <= j : i >= j);
+                        if(used)
+                            err = std::max(err,
+                                           dispatch_diff(F[i + size_t(j) * lda],
+                                                         rF[i + size_t(j) * lda]));
+                    }
+                for(int j = 0; j < nrhs && !potrf; j++)
+                    for(int i = 0; i < n; i++)
+                        err = std::max(err,
+                                       dispatch_diff(X[i + size_t(j) * lda],
+                                                     rX[i + size_t(j) * lda]));
+                EXPECT_LE(err, tol) << "threshold " << threshold << ", host " << host;
+            }
+        }
+    }
+
+    EXPECT_EQ(hipsolverDestroy(handle), HIPSOLVER_STATUS_SUCCESS);
+}
+
+class DISPATCH : public ::TestWithParam<dispatch_tuple>
+{
+protected:
+    DISPATCH() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        vector<int>  size = std::get<0>(GetParam());
+        vector<char> opt  = std::get<1>(GetParam());
+
+        dispatch_test<T>(size[0], size[1], size[2], opt[0], opt[1]);
+    }
+};
+
+// the dispatch functions are not provided by the cuSOLVER backend
+#if !defined(__HIP_PLATFORM_NVCC__)
+
+TEST_P(DISPATCH, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(DISPATCH, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(DISPATCH, __float_complex)
+{
+    run_tests<hipsolverComplex>();
+}
+
+TEST_P(DISPATCH, __double_complex)
+{
+    run_tests<hipsolverDoubleComplex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         DISPATCH,
+                         Combine(ValuesIn(size_range), ValuesIn(opt_range)));
+
+TEST(DISPATCH_SETTINGS, __handle)
+{
+    hipsolverHandle_t handle;
+    ASSERT_EQ(hipsolverCreate(&handle), HIPSOLVER_STATUS_SUCCESS);
+
+    hipsolverDispatchMode_t mode;
+    int                     n;
+    EXPECT_EQ(hipsolverGetDispatchMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_DISPATCH_MODE_DEVICE);
+
+    EXPECT_EQ(hipsolverSetDispatchMode(handle, HIPSOLVER_DISPATCH_MODE_AUTO),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolverGetDispatchMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_DISPATCH_MODE_AUTO);
+
+    // the thresholds are independent by routine and precision
+    EXPECT_EQ(hipsolverSetDispatchThreshold(
+                  handle, HIPSOLVER_DISPATCH_GETRF, HIPSOLVER_PRECISION_SINGLE_COMPLEX, 7),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolverGetDispatchThreshold(
+                  handle, HIPSOLVER_DISPATCH_GETRF, HIPSOLVER_PRECISION_SINGLE_COMPLEX, &n),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(n, 7);
+    EXPECT_EQ(hipsolverGetDispatchThreshold(
+                  handle, HIPSOLVER_DISPATCH_GETRF, HIPSOLVER_PRECISION_SINGLE, &n),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_NE(n, 7);
+
+    // bad arguments
+    EXPECT_EQ(hipsolverSetDispatchMode(nullptr, HIPSOLVER_DISPATCH_MODE_AUTO),
+              HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipsolverSetDispatchMode(handle, hipsolverDispatchMode_t(0)),
+              HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipsolverGetDispatchMode(handle, nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverSetDispatchThreshold(
+                  nullptr, HIPSOLVER_DISPATCH_POTRF, HIPSOLVER_PRECISION_SINGLE, 1),
+              HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipsolverSetDispatchThreshold(
+                  handle, hipsolverDispatchRoutine_t(0), HIPSOLVER_PRECISION_SINGLE, 1),
+              HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipsolverSetDispatchThreshold(
+                  handle, HIPSOLVER_DISPATCH_POTRF, hipsolverPrecision_t(0), 1),
+              HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipsolverSetDispatchThreshold(
+                  handle, HIPSOLVER_DISPATCH_POTRF, HIPSOLVER_PRECISION_SINGLE, -1),
+              HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverGetDispatchThreshold(
+                  handle, HIPSOLVER_DISPATCH_POTRF, HIPSOLVER_PRECISION_SINGLE, nullptr),
+              HIPSOLVER_STATUS_INVALID_VALUE);
+
+    EXPECT_EQ(hipsolverDestroy(handle), HIPSOLVER_STATUS_SUCCESS);
+}
+
+#endif
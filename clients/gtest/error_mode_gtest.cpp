@@ -0,0 +1,123 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+
+#include "clientcommon.hpp"
+
+using namespace std;
+
+/* The tests in this file run getrf on a singular matrix and potrf on a matrix
+   that is not positive definite with the handle in
+   HIPSOLVER_ERROR_MODE_DEFERRED, and check that the calls succeed, that the
+   error state is the bitwise OR of the info they wrote, and that
+   hipsolverResetErrorState clears it. */
+
+template <typename T>
+void error_mode_test(int n)
+{
+    hipsolver_local_handle           handle;
+    device_strided_batch_vector<T>   dA(n * n, 1, n * n, 1);
+    device_strided_batch_vector<T>   dG(n * n, 1, n * n, 1);
+    device_strided_batch_vector<int> dIpiv(n, 1, n, 1);
+    device_strided_batch_vector<int> dInfo(2, 1, 2, 1);
+    host_strided_batch_vector<T>     hA(n * n, 1, n * n, 1);
+    host_strided_batch_vector<T>     hG(n * n, 1, n * n, 1);
+    host_strided_batch_vector<int>   hInfo(2, 1, 2, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dG.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // A has a negative diagonal element at n / 2, and G a zero column at n / 4
+    hipsolver_seedrand();
+    device_init_hpd<T>(handle, n, dA, n);
+    device_init_dominant<T>(handle, n, n, dG, n);
+    CHECK_HIP_ERROR(hA.transfer_from(dA));
+    CHECK_HIP_ERROR(hG.transfer_from(dG));
+    hA[0][n / 2 + (n / 2) * n] = T(-1);
+    for(int i = 0; i < n; i++)
+        hG[0][i + (n / 4) * n] = T(0);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dG.transfer_from(hG));
+
+    int state = -1;
+    EXPECT_EQ(hipsolverGetErrorState(handle, &state), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverResetErrorState(handle), HIPSOLVER_STATUS_INVALID_VALUE);
+    ASSERT_EQ(hipsolverSetErrorMode(handle, HIPSOLVER_ERROR_MODE_DEFERRED),
+              HIPSOLVER_STATUS_SUCCESS);
+    ASSERT_EQ(hipsolverGetErrorState(handle, &state), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(state, 0);
+
+    // the failures are only reported through info and the error state
+    EXPECT_EQ(hipsolver_getrf(false,
+                              false,
+                              handle,
+                              n,
+                              n,
+                              dG.data(),
+                              n,
+                              0,
+                              (T*)nullptr,
+                              0,
+                              dIpiv.data(),
+                              0,
+                              dInfo[0],
+                              1),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolver_potrf(false,
+                              handle,
+                              HIPSOLVER_FILL_MODE_UPPER,
+                              n,
+                              dA.data(),
+                              n,
+                              0,
+                              (T*)nullptr,
+                              0,
+                              dInfo[0] + 1,
+                              1),
+              HIPSOLVER_STATUS_SUCCESS);
+
+    ASSERT_EQ(hipsolverGetErrorState(handle, &state), HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+    EXPECT_EQ(hInfo[0][0], n / 4 + 1);
+    EXPECT_EQ(hInfo[0][1], n / 2 + 1);
+    EXPECT_EQ(state, hInfo[0][0] | hInfo[0][1]);
+    EXPECT_NE(state, 0);
+
+    ASSERT_EQ(hipsolverResetErrorState(handle), HIPSOLVER_STATUS_SUCCESS);
+    ASSERT_EQ(hipsolverGetErrorState(handle, &state), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(state, 0);
+
+    // a successful call leaves the state clear
+    device_init_hpd<T>(handle, n, dA, n);
+    EXPECT_EQ(hipsolver_potrf(false,
+                              handle,
+                              HIPSOLVER_FILL_MODE_UPPER,
+                              n,
+                              dA.data(),
+                              n,
+                              0,
+                              (T*)nullptr,
+                              0,
+                              dInfo[0],
+                              1),
+              HIPSOLVER_STATUS_SUCCESS);
+    ASSERT_EQ(hipsolverGetErrorState(handle, &state), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(state, 0);
+}
+
+// the deferred error mode is not provided by the cuSOLVER backend
+#if !defined(__HIP_PLATFORM_NVCC__)
+
+TEST(ERROR_MODE, __deferred)
+{
+    error_mode_test<float>(10);
+    error_mode_test<double>(33);
+    error_mode_test<hipsolverComplex>(17);
+    error_mode_test<hipsolverDoubleComplex>(40);
+}
+
+#endif
@@ -0,0 +1,197 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gels.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> gels_tuple;
+
+// each matrix_size_range vector is a {m, n, lda, ldb, ldx}
+
+// each rhs_range vector is a {nrhs}
+
+// case when m = -1 and nrhs = 1 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // invalid
+    {-1, 1, 1, 1, 1},
+    {10, 10, 1, 10, 10},
+    {10, 10, 10, 1, 10},
+    {10, 10, 10, 10, 1},
+    {10, 20, 10, 10, 20},
+    // normal (valid) samples
+    {20, 20, 20, 20, 20},
+    {30, 20, 40, 30, 20},
+    {50, 30, 50, 60, 40},
+    {70, 50, 80, 80, 50}};
+
+const vector<vector<int>> rhs_range = {{1}, {10}, {25}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_size_range = {
+//     {192, 192, 192, 192, 192},
+//     {640, 480, 640, 640, 480},
+//     {1000, 800, 1024, 1024, 1000},
+// };
+
+// const vector<vector<int>> large_rhs_range = {{64}, {128}};
+
+Arguments gels_setup_arguments(gels_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> rhs_size    = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", matrix_size[0]);
+    arg.set<rocblas_int>("n", matrix_size[1]);
+    arg.set<rocblas_int>("lda", matrix_size[2]);
+    arg.set<rocblas_int>("ldb", matrix_size[3]);
+    arg.set<rocblas_int>("ldx", matrix_size[4]);
+
+    arg.set<rocblas_int>("nrhs", rhs_size[0]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <bool FORTRAN>
+class GELS_BASE : public ::TestWithParam<gels_tuple>
+{
+protected:
+    GELS_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gels_setup_arguments(GetParam());
+
+        if(arg.peek<int>("m") == -1 && arg.peek<int>("nrhs") == 1)
+            testing_gels_bad_arg<FORTRAN, BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_gels<FORTRAN, BATCHED, STRIDED, T>(arg);
+    }
+};
+
+class GELS : public GELS_BASE<false>
+{
+};
+
+class GELS_FORTRAN : public GELS_BASE<true>
+{
+};
+
+// non-batch tests
+TEST_P(GELS, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GELS, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GELS, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GELS, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(GELS_FORTRAN, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GELS_FORTRAN, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GELS_FORTRAN, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GELS_FORTRAN, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+#if !defined(__HIP_PLATFORM_NVCC__)
+// batched tests
+TEST_P(GELS, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GELS, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GELS, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(GELS, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(GELS_FORTRAN, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GELS_FORTRAN, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GELS_FORTRAN, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(GELS_FORTRAN, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+#endif
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GELS,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_rhs_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GELS,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(rhs_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GELS_FORTRAN,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_rhs_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GELS_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(rhs_range)));
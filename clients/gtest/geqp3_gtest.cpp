@@ -0,0 +1,224 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_geqp3.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> geqp3_tuple;
+
+// each matrix_size_range is a {m, lda}
+// each n_size_range is a {n, k}, where k is the rank of the test matrix
+
+// case when m = n = -1 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    {50, 50},
+    {70, 100},
+    {130, 130}};
+
+const vector<vector<int>> n_size_range = {
+    // quick return
+    {0, 0},
+    // invalid
+    {-1, 0},
+    // normal (valid) samples
+    {16, 16},
+    {20, 5},
+    {40, 40},
+    {100, 30}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_size_range = {
+//     {152, 152},
+//     {640, 640},
+//     {1000, 1024},
+// };
+
+// const vector<vector<int>> large_n_size_range
+//     = {{64, 64}, {98, 20}, {130, 130}, {220, 100}, {400, 10}};
+
+Arguments geqp3_setup_arguments(geqp3_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> n_size      = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", matrix_size[0]);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+    arg.set<rocblas_int>("n", n_size[0]);
+    // the rank cannot exceed min(m, n)
+    int k = std::min(n_size[1], std::max(std::min(matrix_size[0], n_size[0]), 0));
+    arg.set<rocblas_int>("k", k);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <bool FORTRAN, bool TRUNCATED>
+class GEQP3_BASE : public ::TestWithParam<geqp3_tuple>
+{
+protected:
+    GEQP3_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = geqp3_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == -1 && arg.peek<rocblas_int>("n") == -1)
+            testing_geqp3_bad_arg<FORTRAN, TRUNCATED, T>();
+
+        testing_geqp3<FORTRAN, TRUNCATED, T>(arg);
+    }
+};
+
+class GEQP3 : public GEQP3_BASE<false, false>
+{
+};
+
+class GEQP3_FORTRAN : public GEQP3_BASE<true, false>
+{
+};
+
+class GEQP3_TRUNCATED : public GEQP3_BASE<false, true>
+{
+};
+
+class GEQP3_TRUNCATED_FORTRAN : public GEQP3_BASE<true, true>
+{
+};
+
+// geqp3 is not provided by the cuSOLVER backend
+#if !defined(__HIP_PLATFORM_NVCC__)
+
+TEST_P(GEQP3, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GEQP3, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GEQP3, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GEQP3, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+TEST_P(GEQP3_FORTRAN, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GEQP3_FORTRAN, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GEQP3_FORTRAN, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GEQP3_FORTRAN, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+TEST_P(GEQP3_TRUNCATED, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GEQP3_TRUNCATED, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GEQP3_TRUNCATED, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GEQP3_TRUNCATED, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+TEST_P(GEQP3_TRUNCATED_FORTRAN, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GEQP3_TRUNCATED_FORTRAN, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GEQP3_TRUNCATED_FORTRAN, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GEQP3_TRUNCATED_FORTRAN, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GEQP3,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQP3,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GEQP3_FORTRAN,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQP3_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GEQP3_TRUNCATED,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQP3_TRUNCATED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GEQP3_TRUNCATED_FORTRAN,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQP3_TRUNCATED_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+#endif
@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_geqrf_tsqr.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> geqrf_tsqr_tuple;
+
+// each matrix_size_range is a {m, lda}
+
+// case when m = n = -1 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    {50, 50},
+    {600, 610},
+    {3000, 3000},
+    {20000, 20010}};
+
+const vector<int> n_size_range = {
+    // invalid
+    -1,
+    // normal (valid) samples
+    1,
+    4,
+    16,
+    32};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_size_range = {
+//     {100000, 100000},
+//     {1000000, 1000000},
+// };
+
+// const vector<int> large_n_size_range = {8, 64, 128};
+
+Arguments geqrf_tsqr_setup_arguments(geqrf_tsqr_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int         n_size      = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", matrix_size[0]);
+    arg.set<rocblas_int>("n", n_size);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <bool FORTRAN>
+class GEQRF_TSQR_BASE : public ::TestWithParam<geqrf_tsqr_tuple>
+{
+protected:
+    GEQRF_TSQR_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = geqrf_tsqr_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == -1 && arg.peek<rocblas_int>("n") == -1)
+            testing_geqrf_tsqr_bad_arg<FORTRAN, BATCHED, STRIDED, T>();
+
+        arg.batch_count = 1;
+        testing_geqrf_tsqr<FORTRAN, BATCHED, STRIDED, T>(arg);
+    }
+};
+
+class GEQRF_TSQR : public GEQRF_TSQR_BASE<false>
+{
+};
+
+class GEQRF_TSQR_FORTRAN : public GEQRF_TSQR_BASE<true>
+{
+};
+
+// non-batch tests
+
+TEST_P(GEQRF_TSQR, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GEQRF_TSQR, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GEQRF_TSQR, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_TSQR, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(GEQRF_TSQR_FORTRAN, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GEQRF_TSQR_FORTRAN, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GEQRF_TSQR_FORTRAN, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_TSQR_FORTRAN, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GEQRF_TSQR,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQRF_TSQR,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GEQRF_TSQR_FORTRAN,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQRF_TSQR_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
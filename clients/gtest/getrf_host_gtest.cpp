@@ -0,0 +1,199 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_getrf_host.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, char> getrf_host_tuple;
+
+// each size_range vector is a {m, n, lda, nrhs}
+// the solve is only tested when m = n
+
+// each trans_range is a {trans}
+
+// case when m = -1 and trans = N will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<char> trans_range = {'N', 'T', 'C'};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // invalid
+    {-1, 1, 1, 1},
+    {10, 10, 2, 1},
+    // normal (valid) samples
+    {10, 10, 10, 1},
+    {20, 15, 20, 0},
+    {15, 20, 20, 0},
+    {70, 70, 80, 10},
+    {300, 300, 300, 300},
+    {600, 400, 610, 0},
+    {400, 600, 400, 0},
+    {1000, 1000, 1010, 17}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_size_range = {
+//     {3000, 3000, 3000, 100},
+//     {10000, 10000, 10000, 10},
+// };
+
+Arguments getrf_host_setup_arguments(getrf_host_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char        trans       = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", matrix_size[0]);
+    arg.set<rocblas_int>("n", matrix_size[1]);
+    arg.set<rocblas_int>("lda", matrix_size[2]);
+    arg.set<rocblas_int>("ldb", std::max(matrix_size[1], 1));
+    arg.set<rocblas_int>("nrhs", matrix_size[3]);
+
+    arg.set<char>("trans", trans);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <bool FORTRAN>
+class GETRF_HOST_BASE : public ::TestWithParam<getrf_host_tuple>
+{
+protected:
+    GETRF_HOST_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, typename T>
+    void run_tests()
+    {
+        Arguments arg = getrf_host_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == -1 && arg.peek<char>("trans") == 'N')
+            testing_getrf_host_bad_arg<FORTRAN, BATCHED, T>();
+
+        arg.batch_count = (BATCHED ? 3 : 1);
+        testing_getrf_host<FORTRAN, BATCHED, T>(arg);
+    }
+};
+
+class GETRF_HOST : public GETRF_HOST_BASE<false>
+{
+};
+
+class GETRF_HOST_FORTRAN : public GETRF_HOST_BASE<true>
+{
+};
+
+// getrfHost and getrsHost are not provided by the cuSOLVER backend
+#if !defined(__HIP_PLATFORM_NVCC__)
+
+// non-batch tests
+
+TEST_P(GETRF_HOST, __float)
+{
+    run_tests<false, float>();
+}
+
+TEST_P(GETRF_HOST, __double)
+{
+    run_tests<false, double>();
+}
+
+TEST_P(GETRF_HOST, __float_complex)
+{
+    run_tests<false, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_HOST, __double_complex)
+{
+    run_tests<false, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_HOST_FORTRAN, __float)
+{
+    run_tests<false, float>();
+}
+
+TEST_P(GETRF_HOST_FORTRAN, __double)
+{
+    run_tests<false, double>();
+}
+
+TEST_P(GETRF_HOST_FORTRAN, __float_complex)
+{
+    run_tests<false, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_HOST_FORTRAN, __double_complex)
+{
+    run_tests<false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GETRF_HOST, batched__float)
+{
+    run_tests<true, float>();
+}
+
+TEST_P(GETRF_HOST, batched__double)
+{
+    run_tests<true, double>();
+}
+
+TEST_P(GETRF_HOST, batched__float_complex)
+{
+    run_tests<true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_HOST, batched__double_complex)
+{
+    run_tests<true, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_HOST_FORTRAN, batched__float)
+{
+    run_tests<true, float>();
+}
+
+TEST_P(GETRF_HOST_FORTRAN, batched__double)
+{
+    run_tests<true, double>();
+}
+
+TEST_P(GETRF_HOST_FORTRAN, batched__float_complex)
+{
+    run_tests<true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_HOST_FORTRAN, batched__double_complex)
+{
+    run_tests<true, rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GETRF_HOST,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(trans_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_HOST,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(trans_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GETRF_HOST_FORTRAN,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(trans_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_HOST_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(trans_range)));
+
+#endif
@@ -2,6 +2,8 @@
  * Copyright 2020 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
+#include "reference_cache.hpp"
+#include <cstdlib>
 #include <gtest/gtest.h>
 #include <stdexcept>
 
@@ -13,5 +15,15 @@ int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
 
+    // cache the results of the host reference under the build directory, unless
+    // HIPSOLVER_REFERENCE_CACHE names another directory or is empty
+    const char* cache = std::getenv("HIPSOLVER_REFERENCE_CACHE");
+#ifdef HIPSOLVER_REFERENCE_CACHE_DIR
+    if(!cache)
+        cache = HIPSOLVER_REFERENCE_CACHE_DIR;
+#endif
+    if(cache)
+        hipsolver_reference_cache_open(cache);
+
     return RUN_ALL_TESTS();
 }
@@ -0,0 +1,333 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+
+#include "host_kernels.hpp"
+#include <random>
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* The tests in this file run the native host kernels of getrf, getrs and
+   potrf directly, with the code of each vector instruction set supported by
+   the CPU, and compare their results with those of the scalar code. The
+   sizes are not multiples of the vector widths and of the tiles of the
+   microkernel, so that the rows and columns left over by the vector loops are
+   covered. The matrices of getrf are column diagonally dominant with their
+   rows shuffled, so that the pivots are chosen by a wide margin and must be
+   the same on all the paths. */
+
+// each size_range is a {m, n, nrhs}; getrs and potrf use n-by-n matrices
+
+const vector<vector<int>> size_range = {
+    // normal (valid) samples
+    {1, 1, 1},
+    {3, 5, 2},
+    {7, 7, 3},
+    {13, 9, 1},
+    {17, 17, 5},
+    {31, 29, 7},
+    {33, 33, 9},
+    {45, 70, 3},
+    {70, 45, 4},
+    {67, 67, 11},
+    {100, 100, 13},
+    {129, 129, 6}};
+
+template <typename T>
+struct host_kernel_functions
+{
+    const char* name;
+    void (*getrf)(int, int, T*, int, int*, int*);
+    void (*getrs)(char, int, int, const T*, int, const int*, T*, int);
+    void (*potrf)(char, int, T*, int, int*);
+};
+
+// the vector code supported by the CPU, and the code the library dispatches to
+template <typename T>
+vector<host_kernel_functions<T>> host_kernel_simd(host_kernel_functions<T>* current)
+{
+    vector<host_kernel_functions<T>> simd;
+    *current = {"scalar",
+                hipsolver_scalar_kernels::hipsolver_kernel_getrf<T>,
+                hipsolver_scalar_kernels::hipsolver_kernel_getrs<T>,
+                hipsolver_scalar_kernels::hipsolver_kernel_potrf<T>};
+#ifdef HIPSOLVER_KERNEL_X86
+    hipsolver_kernel_isa isa = hipsolver_kernel_isa_detect();
+    if(isa >= hipsolver_kernel_isa_avx2)
+        simd.push_back({"AVX2",
+                        hipsolver_avx2_kernels::hipsolver_kernel_getrf<T>,
+                        hipsolver_avx2_kernels::hipsolver_kernel_getrs<T>,
+                        hipsolver_avx2_kernels::hipsolver_kernel_potrf<T>});
+    if(isa >= hipsolver_kernel_isa_avx512)
+        simd.push_back({"AVX-512",
+                        hipsolver_avx512_kernels::hipsolver_kernel_getrf<T>,
+                        hipsolver_avx512_kernels::hipsolver_kernel_getrs<T>,
+                        hipsolver_avx512_kernels::hipsolver_kernel_potrf<T>});
+    if(!simd.empty())
+        *current = simd.back();
+#endif
+    return simd;
+}
+
+template <typename T>
+T host_kernel_random(mt19937& gen)
+{
+    return T(uniform_real_distribution<T>(-1, 1)(gen));
+}
+
+template <>
+complex<float> host_kernel_random(mt19937& gen)
+{
+    return {host_kernel_random<float>(gen), host_kernel_random<float>(gen)};
+}
+
+template <>
+complex<double> host_kernel_random(mt19937& gen)
+{
+    return {host_kernel_random<double>(gen), host_kernel_random<double>(gen)};
+}
+
+// largest |a - b| relative to the largest |b|, over the n columns of m rows
+template <typename T>
+double host_kernel_error(int m, int n, const vector<T>& a, const vector<T>& b, int ld)
+{
+    double diff = 0, norm = 0;
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i < m; i++)
+        {
+            diff = max(diff, double(abs(a[i + size_t(j) * ld] - b[i + size_t(j) * ld])));
+            norm = max(norm, double(abs(b[i + size_t(j) * ld])));
+        }
+    return norm > 0 ? diff / norm : diff;
+}
+
+// column diagonally dominant matrix with its rows shuffled, and a zero column zero_col if >= 0
+template <typename T>
+vector<T> host_kernel_getrf_matrix(mt19937& gen, int m, int n, int lda, int zero_col)
+{
+    vector<T> B(size_t(lda) * n);
+    for(int j = 0; j < n; j++)
+    {
+        double sum = 0;
+        for(int i = 0; i < m; i++)
+        {
+            B[i + size_t(j) * lda] = host_kernel_random<T>(gen);
+            sum += abs(B[i + size_t(j) * lda]);
+        }
+        if(j < m)
+            B[j + size_t(j) * lda] = T(sum + 1);
+    }
+
+    vector<int> perm(m);
+    for(int i = 0; i < m; i++)
+        perm[i] = i;
+    shuffle(perm.begin(), perm.end(), gen);
+
+    vector<T> A(size_t(lda) * n);
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i < m; i++)
+            A[perm[i] + size_t(j) * lda] = j == zero_col ? T(0) : B[i + size_t(j) * lda];
+    return A;
+}
+
+// Hermitian diagonally dominant matrix, with -1 at diagonal element neg_diag if >= 0
+template <typename T>
+vector<T> host_kernel_potrf_matrix(mt19937& gen, int n, int lda, int neg_diag)
+{
+    vector<T> A(size_t(lda) * n);
+    for(int j = 0; j < n; j++)
+        for(int i = j + 1; i < n; i++)
+        {
+            A[i + size_t(j) * lda] = host_kernel_random<T>(gen);
+            A[j + size_t(i) * lda] = hipsolver_kernel_conj(A[i + size_t(j) * lda]);
+        }
+    for(int j = 0; j < n; j++)
+    {
+        double sum = 0;
+        for(int i = 0; i < n; i++)
+            sum += abs(A[i + size_t(j) * lda]);
+        A[j + size_t(j) * lda] = j == neg_diag ? T(-1) : T(sum + 1);
+    }
+    return A;
+}
+
+template <typename T>
+void host_kernel_getrf_test(const vector<host_kernel_functions<T>>& simd,
+                            const host_kernel_functions<T>&         current,
+                            int                                     m,
+                            int                                     n,
+                            double                                  tol)
+{
+    int     lda = m + 3;
+    mt19937 gen(m * 1000 + n);
+
+    // a zero column left for the last pivot keeps the pivots of the other steps unambiguous
+    for(int zero_col : {-1, min(m, n) - 1})
+    {
+        vector<T> A0 = host_kernel_getrf_matrix<T>(gen, m, n, lda, zero_col);
+
+        vector<T>   A = A0;
+        vector<int> ipiv(min(m, n));
+        int         info;
+        hipsolver_scalar_kernels::hipsolver_kernel_getrf(m, n, A.data(), lda, ipiv.data(), &info);
+
+        for(const auto& k : simd)
+        {
+            vector<T>   Ak = A0;
+            vector<int> ipivk(min(m, n));
+            int         infok;
+            k.getrf(m, n, Ak.data(), lda, ipivk.data(), &infok);
+
+            EXPECT_EQ(infok, info) << k.name;
+            EXPECT_EQ(ipivk, ipiv) << k.name;
+            EXPECT_LE(host_kernel_error(m, n, Ak, A, lda), tol) << k.name;
+        }
+
+        // the library calls the widest code supported by the CPU
+        vector<T>   Ad = A0, Ac = A0;
+        vector<int> ipivd(min(m, n)), ipivc(min(m, n));
+        int         infod, infoc;
+        hipsolver_kernel_getrf(m, n, Ad.data(), lda, ipivd.data(), &infod);
+        current.getrf(m, n, Ac.data(), lda, ipivc.data(), &infoc);
+        EXPECT_EQ(infod, infoc);
+        EXPECT_EQ(ipivd, ipivc);
+        EXPECT_EQ(Ad, Ac);
+    }
+}
+
+template <typename T>
+void host_kernel_getrs_test(const vector<host_kernel_functions<T>>& simd,
+                            const host_kernel_functions<T>&         current,
+                            int                                     n,
+                            int                                     nrhs,
+                            double                                  tol)
+{
+    int     lda = n + 3;
+    int     ldb = n + 1;
+    mt19937 gen(n * 1000 + nrhs);
+
+    vector<T>   A = host_kernel_getrf_matrix<T>(gen, n, n, lda, -1);
+    vector<int> ipiv(n);
+    int         info;
+    hipsolver_scalar_kernels::hipsolver_kernel_getrf(n, n, A.data(), lda, ipiv.data(), &info);
+    ASSERT_EQ(info, 0);
+
+    vector<T> B0(size_t(ldb) * nrhs);
+    for(T& b : B0)
+        b = host_kernel_random<T>(gen);
+
+    for(char trans : {'N', 'T', 'C'})
+    {
+        vector<T> B = B0;
+        hipsolver_scalar_kernels::hipsolver_kernel_getrs(
+            trans, n, nrhs, A.data(), lda, ipiv.data(), B.data(), ldb);
+
+        for(const auto& k : simd)
+        {
+            vector<T> Bk = B0;
+            k.getrs(trans, n, nrhs, A.data(), lda, ipiv.data(), Bk.data(), ldb);
+            EXPECT_LE(host_kernel_error(n, nrhs, Bk, B, ldb), tol) << k.name << " " << trans;
+        }
+
+        vector<T> Bd = B0, Bc = B0;
+        hipsolver_kernel_getrs(trans, n, nrhs, A.data(), lda, ipiv.data(), Bd.data(), ldb);
+        current.getrs(trans, n, nrhs, A.data(), lda, ipiv.data(), Bc.data(), ldb);
+        EXPECT_EQ(Bd, Bc) << trans;
+    }
+}
+
+template <typename T>
+void host_kernel_potrf_test(const vector<host_kernel_functions<T>>& simd,
+                            const host_kernel_functions<T>&         current,
+                            int                                     n,
+                            double                                  tol)
+{
+    int     lda = n + 3;
+    mt19937 gen(n);
+
+    for(int neg_diag : {-1, n / 2})
+    {
+        vector<T> A0 = host_kernel_potrf_matrix<T>(gen, n, lda, neg_diag);
+
+        for(char uplo : {'U', 'L'})
+        {
+            vector<T> A = A0;
+            int       info;
+            hipsolver_scalar_kernels::hipsolver_kernel_potrf(uplo, n, A.data(), lda, &info);
+            EXPECT_EQ(info, neg_diag + 1);
+
+            for(const auto& k : simd)
+            {
+                vector<T> Ak = A0;
+                int       infok;
+                k.potrf(uplo, n, Ak.data(), lda, &infok);
+                EXPECT_EQ(infok, info) << k.name << " " << uplo;
+                EXPECT_LE(host_kernel_error(n, n, Ak, A, lda), tol) << k.name << " " << uplo;
+            }
+
+            vector<T> Ad = A0, Ac = A0;
+            int       infod, infoc;
+            hipsolver_kernel_potrf(uplo, n, Ad.data(), lda, &infod);
+            current.potrf(uplo, n, Ac.data(), lda, &infoc);
+            EXPECT_EQ(infod, infoc) << uplo;
+            EXPECT_EQ(Ad, Ac) << uplo;
+        }
+    }
+}
+
+class HOST_KERNEL : public ::TestWithParam<vector<int>>
+{
+protected:
+    HOST_KERNEL() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        using S = decltype(std::real(T{}));
+
+        vector<int> size = GetParam();
+        int         m    = size[0];
+        int         n    = size[1];
+        int         nrhs = size[2];
+
+        host_kernel_functions<T>         current;
+        vector<host_kernel_functions<T>> simd = host_kernel_simd<T>(&current);
+        if(simd.empty())
+            GTEST_SKIP() << "the CPU has no vector instruction set of the kernels";
+
+        // the vector code only rounds differently, by fused multiply-adds and sums in other orders
+        double tol = 10 * max(m, n) * numeric_limits<S>::epsilon();
+        host_kernel_getrf_test<T>(simd, current, m, n, tol);
+        host_kernel_getrs_test<T>(simd, current, n, nrhs, tol);
+        host_kernel_potrf_test<T>(simd, current, n, tol);
+    }
+};
+
+TEST_P(HOST_KERNEL, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(HOST_KERNEL, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(HOST_KERNEL, __float_complex)
+{
+    run_tests<complex<float>>();
+}
+
+TEST_P(HOST_KERNEL, __double_complex)
+{
+    run_tests<complex<double>>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, HOST_KERNEL, ValuesIn(size_range));
@@ -0,0 +1,751 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+
+#include "mg_scheduler.hpp"
+#include <algorithm>
+#include <complex>
+#include <deque>
+#include <functional>
+#include <random>
+#include <set>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* The tests in this file run the multi-device schedules on a stand-in for a
+   group of devices that keeps the memory of every device in host memory.
+   Operations are queued per device and run at the end in a random order that
+   respects the events, so that a missing dependency between devices shows up
+   as a result that differs from running the operations one after the other.
+   Every operation also checks that it only references the memory of its own
+   device and stays within the buffers. */
+
+typedef std::tuple<vector<int>, int> mg_scheduler_tuple;
+
+// each size_range is a {m, n, nb}
+// each device_range is the number of devices
+
+const vector<vector<int>> size_range = {
+    // normal (valid) samples
+    {1, 1, 4},
+    {8, 8, 8},
+    {9, 9, 4},
+    {30, 30, 4},
+    {37, 21, 5},
+    {21, 37, 5},
+    {64, 64, 8}};
+
+const vector<int> device_range = {1, 2, 3, 8};
+
+// seeds of the random order of the devices, at least one per device
+const int mg_seeds = 3;
+
+template <typename T>
+T mg_conj(T x)
+{
+    return x;
+}
+
+template <typename T>
+complex<T> mg_conj(complex<T> x)
+{
+    return std::conj(x);
+}
+
+inline double mg_real(double x)
+{
+    return x;
+}
+
+inline double mg_real(complex<double> x)
+{
+    return x.real();
+}
+
+// imaginary unit, or zero for real types
+inline double mg_unit(double)
+{
+    return 0;
+}
+
+inline complex<double> mg_unit(complex<double>)
+{
+    return complex<double>(0, 1);
+}
+
+enum mg_factorization
+{
+    mg_potrf_lower,
+    mg_potrf_upper,
+    mg_getrf,
+    mg_syevd,
+};
+
+inline hipsolver_mg_factorization mg_kind(mg_factorization fact)
+{
+    if(fact == mg_getrf)
+        return hipsolver_mg_lu;
+    if(fact == mg_syevd)
+        return hipsolver_mg_eigen;
+    return hipsolver_mg_cholesky;
+}
+
+// a dense column-major matrix
+template <typename T>
+struct mg_dense
+{
+    int       rows = 0, cols = 0;
+    vector<T> v;
+
+    mg_dense(int r, int c)
+        : rows(r)
+        , cols(c)
+        , v(size_t(r) * c, T(0))
+    {
+    }
+
+    T& operator()(int i, int j)
+    {
+        return v[i + size_t(j) * rows];
+    }
+};
+
+template <typename T>
+class mg_host_device
+{
+public:
+    mg_host_device(mg_factorization           fact,
+                   const hipsolver_mg_layout& layout,
+                   const vector<T>&           A,
+                   bool                       eager,
+                   int                        seed)
+        : fact_(fact)
+        , layout_(layout)
+        , A0_(A)
+        , eager_(eager)
+        , seed_(seed)
+        , rng_(seed)
+        , queue_(layout.ndev)
+    {
+        int m     = layout.m;
+        int nslot = hipsolver_mg_slots(mg_kind(fact), layout);
+        for(int d = 0; d < layout.ndev; d++)
+        {
+            int ld, cols;
+            hipsolver_mg_panel_shape(mg_kind(fact), fact == mg_potrf_upper, layout, d, &ld, &cols);
+            matrix.emplace_back(m, layout.local_cols(d));
+            panel_.emplace_back(ld, cols);
+            pivots_.emplace_back(std::min(m, layout.n), 0);
+            info_.emplace_back(nslot, -1);
+        }
+
+        // distribute A
+        for(int d = 0; d < layout.ndev; d++)
+            for(int c = 0; c < layout.local_cols(d); c++)
+                for(int i = 0; i < m; i++)
+                    matrix[d](i, c) = A[i + size_t(layout.global(d, c)) * m];
+    }
+
+    vector<mg_dense<T>> matrix;
+    vector<double>      W;
+    bool                gathered = false; // whether syevd found the matrix gathered
+
+    // the distributed matrix, gathered
+    vector<T> global()
+    {
+        int       m = layout_.m;
+        vector<T> A(size_t(m) * layout_.n);
+        for(int d = 0; d < layout_.ndev; d++)
+            for(int c = 0; c < layout_.local_cols(d); c++)
+                for(int i = 0; i < m; i++)
+                    A[i + size_t(layout_.global(d, c)) * m] = matrix[d](i, c);
+        return A;
+    }
+
+    rocblas_status init()
+    {
+        issued_.assign(layout_.ndev, 0);
+        done_.assign(layout_.ndev, {});
+        for(vector<int>& info : info_)
+            std::fill(info.begin(), info.end(), 0);
+        return rocblas_status_success;
+    }
+
+    rocblas_status record(int dev)
+    {
+        // events are recorded again before the earlier recordings are done, so the
+        // completion of every recording is kept
+        int64_t count = ++issued_[dev];
+        return enqueue(dev, -1, 0, [=] { done_[dev].insert(count); });
+    }
+
+    rocblas_status wait(int dev, int src)
+    {
+        EXPECT_NE(dev, src);
+        return enqueue(dev, src, issued_[src], [] {});
+    }
+
+    rocblas_status copy(hipsolver_mg_ref dst, hipsolver_mg_ref src, int rows, int cols)
+    {
+        return enqueue(dst.dev, -1, 0, [=] {
+            mg_dense<T>& a = buffer(src, rows, cols);
+            mg_dense<T>& b = buffer(dst, rows, cols);
+            for(int j = 0; j < cols; j++)
+                for(int i = 0; i < rows; i++)
+                    b(dst.row + i, dst.col + j) = a(src.row + i, src.col + j);
+        });
+    }
+
+    rocblas_status copy_pivots(int dst, int src, int offset, int count)
+    {
+        return enqueue(dst, -1, 0, [=] {
+            EXPECT_LE(offset + count, int(pivots_[dst].size()));
+            for(int i = offset; i < offset + count; i++)
+                pivots_[dst][i] = pivots_[src][i];
+        });
+    }
+
+    rocblas_status potrf(int dev, bool upper, hipsolver_mg_ref a, int n, int slot)
+    {
+        return enqueue(dev, -1, 0, [=] {
+            mg_dense<T>& A = buffer(a, n, n, dev);
+
+            // element (i, j) of the lower triangular factor, stored as L or L^H
+            auto l = [&](int i, int j) {
+                return upper ? mg_conj(A(a.row + j, a.col + i)) : A(a.row + i, a.col + j);
+            };
+            auto set_l = [&](int i, int j, T x) {
+                if(upper)
+                    A(a.row + j, a.col + i) = mg_conj(x);
+                else
+                    A(a.row + i, a.col + j) = x;
+            };
+
+            for(int j = 0; j < n; j++)
+            {
+                double d = mg_real(l(j, j));
+                for(int p = 0; p < j; p++)
+                    d -= std::norm(l(j, p));
+                if(d <= 0)
+                {
+                    info_[dev][slot] = j + 1;
+                    return;
+                }
+                d = std::sqrt(d);
+                set_l(j, j, T(d));
+                for(int i = j + 1; i < n; i++)
+                {
+                    T s = l(i, j);
+                    for(int p = 0; p < j; p++)
+                        s -= l(i, p) * mg_conj(l(j, p));
+                    set_l(i, j, s / d);
+                }
+            }
+        });
+    }
+
+    rocblas_status getrf(int dev, hipsolver_mg_ref a, int m, int n, int slot, int offset)
+    {
+        return enqueue(dev, -1, 0, [=] {
+            mg_dense<T>& A = buffer(a, m, n, dev);
+            auto         e = [&](int i, int j) -> T& { return A(a.row + i, a.col + j); };
+
+            for(int c = 0; c < std::min(m, n); c++)
+            {
+                int p = c;
+                for(int r = c + 1; r < m; r++)
+                    if(std::abs(e(r, c)) > std::abs(e(p, c)))
+                        p = r;
+                pivots_[dev][offset + c] = p + 1;
+                for(int j = 0; j < n; j++)
+                    std::swap(e(c, j), e(p, j));
+
+                if(e(c, c) == T(0))
+                {
+                    if(info_[dev][slot] == 0)
+                        info_[dev][slot] = c + 1;
+                    continue;
+                }
+                for(int r = c + 1; r < m; r++)
+                {
+                    e(r, c) /= e(c, c);
+                    for(int j = c + 1; j < n; j++)
+                        e(r, j) -= e(r, c) * e(c, j);
+                }
+            }
+        });
+    }
+
+    rocblas_status laswp(int dev, hipsolver_mg_ref a, int cols, int offset, int count)
+    {
+        return enqueue(dev, -1, 0, [=] {
+            for(int i = 0; i < count; i++)
+            {
+                int          p = pivots_[dev][offset + i] - 1;
+                mg_dense<T>& A = buffer(a, std::max(i, p) + 1, cols, dev);
+                for(int j = 0; j < cols; j++)
+                    std::swap(A(a.row + i, a.col + j), A(a.row + p, a.col + j));
+            }
+        });
+    }
+
+    rocblas_status trsm(int              dev,
+                        bool             left,
+                        bool             upper,
+                        bool             conj,
+                        bool             unit,
+                        hipsolver_mg_ref a,
+                        hipsolver_mg_ref b,
+                        int              m,
+                        int              n)
+    {
+        return enqueue(dev, -1, 0, [=] {
+            int          s = left ? m : n;
+            mg_dense<T>& A = buffer(a, s, s, dev);
+            mg_dense<T>& B = buffer(b, m, n, dev);
+
+            // op(a), which is lower triangular if upper and conj differ
+            mg_dense<T> M(s, s);
+            for(int j = 0; j < s; j++)
+                for(int i = 0; i < s; i++)
+                {
+                    T x = (upper ? i <= j : i >= j) ? A(a.row + i, a.col + j) : T(0);
+                    if(i == j && unit)
+                        x = 1;
+                    if(conj)
+                        M(j, i) = mg_conj(x);
+                    else
+                        M(i, j) = x;
+                }
+            bool lower = upper == conj;
+
+            // x * M = y is solved as M^T * x^T = y^T
+            if(!left)
+            {
+                mg_dense<T> Mt(s, s);
+                for(int j = 0; j < s; j++)
+                    for(int i = 0; i < s; i++)
+                        Mt(i, j) = M(j, i);
+                M     = Mt;
+                lower = !lower;
+            }
+
+            int nrhs = left ? n : m;
+            for(int r = 0; r < nrhs; r++)
+            {
+                auto x = [&](int i) -> T& {
+                    return left ? B(b.row + i, b.col + r) : B(b.row + r, b.col + i);
+                };
+                for(int t = 0; t < s; t++)
+                {
+                    int i = lower ? t : s - 1 - t;
+                    T   y = x(i);
+                    for(int p = 0; p < s; p++)
+                        if(lower ? p < i : p > i)
+                            y -= M(i, p) * x(p);
+                    x(i) = y / M(i, i);
+                }
+            }
+        });
+    }
+
+    rocblas_status
+        herk(int dev, bool upper, bool conj, hipsolver_mg_ref c, hipsolver_mg_ref a, int n, int k)
+    {
+        return enqueue(dev, -1, 0, [=] {
+            mg_dense<T>& C = buffer(c, n, n, dev);
+            mg_dense<T>& A = conj ? buffer(a, k, n, dev) : buffer(a, n, k, dev);
+            auto         op
+                = [&](int i, int p) {
+                      return conj ? mg_conj(A(a.row + p, a.col + i)) : A(a.row + i, a.col + p);
+                  };
+            for(int j = 0; j < n; j++)
+                for(int i = 0; i < n; i++)
+                {
+                    if(upper ? i > j : i < j)
+                        continue;
+                    T s = 0;
+                    for(int p = 0; p < k; p++)
+                        s += op(i, p) * mg_conj(op(j, p));
+                    C(c.row + i, c.col + j) -= s;
+                }
+        });
+    }
+
+    rocblas_status gemm(int              dev,
+                        bool             conjA,
+                        bool             conjB,
+                        hipsolver_mg_ref c,
+                        hipsolver_mg_ref a,
+                        hipsolver_mg_ref b,
+                        int              m,
+                        int              n,
+                        int              k)
+    {
+        return enqueue(dev, -1, 0, [=] {
+            mg_dense<T>& C = buffer(c, m, n, dev);
+            mg_dense<T>& A = conjA ? buffer(a, k, m, dev) : buffer(a, m, k, dev);
+            mg_dense<T>& B = conjB ? buffer(b, n, k, dev) : buffer(b, k, n, dev);
+            for(int j = 0; j < n; j++)
+                for(int i = 0; i < m; i++)
+                {
+                    T s = 0;
+                    for(int p = 0; p < k; p++)
+                    {
+                        T x = conjA ? mg_conj(A(a.row + p, a.col + i)) : A(a.row + i, a.col + p);
+                        T y = conjB ? mg_conj(B(b.row + j, b.col + p)) : B(b.row + p, b.col + j);
+                        s += x * y;
+                    }
+                    C(c.row + i, c.col + j) -= s;
+                }
+        });
+    }
+
+    /* Stand-in for the eigensolver: checks that the whole matrix was gathered,
+       and returns its diagonal as the eigenvalues and a matrix with distinct
+       elements as the eigenvectors, so that their distribution can be checked. */
+    rocblas_status syevd(int dev, bool evect, bool upper, hipsolver_mg_ref a, int n, int slot)
+    {
+        return enqueue(dev, -1, 0, [=] {
+            mg_dense<T>& A = buffer(a, n, n, dev);
+            gathered       = true;
+            W.assign(n, 0);
+            for(int j = 0; j < n; j++)
+                for(int i = 0; i < n; i++)
+                {
+                    T& x     = A(a.row + i, a.col + j);
+                    gathered = gathered && x == A0_[i + size_t(j) * n];
+                    if(i == j)
+                        W[i] = mg_real(x);
+                    if(evect)
+                        x = T(i + 1000 * j);
+                }
+            info_[dev][slot] = 0;
+        });
+    }
+
+    rocblas_status finish(int nslots, int* tile_info, int npivots, int* ipiv)
+    {
+        // run the queued operations in a random order that respects the events; one of
+        // the devices only runs when no other device can, so that the others get ahead
+        int slow = seed_ % layout_.ndev;
+        while(true)
+        {
+            vector<int> ready;
+            bool        empty = true;
+            for(size_t d = 0; d < queue_.size(); d++)
+            {
+                if(queue_[d].empty())
+                    continue;
+                empty         = false;
+                const task& t = queue_[d].front();
+                if(t.event < 0 || t.count == 0 || done_[t.event].count(t.count))
+                    ready.push_back(d);
+            }
+            if(empty)
+                break;
+            if(ready.empty())
+                return rocblas_status_internal_error;
+            if(ready.size() > 1)
+                ready.erase(std::remove(ready.begin(), ready.end(), slow), ready.end());
+
+            int d = ready[rng_() % ready.size()];
+            queue_[d].front().run();
+            queue_[d].pop_front();
+        }
+
+        for(int k = 0; k < nslots; k++)
+        {
+            tile_info[k] = 0;
+            for(int d = 0; d < layout_.ndev; d++)
+                if(info_[d][k] != 0)
+                    tile_info[k] = info_[d][k];
+        }
+        for(int i = 0; i < npivots; i++)
+            ipiv[i] = pivots_[0][i];
+        return rocblas_status_success;
+    }
+
+private:
+    struct task
+    {
+        int                   event;
+        int64_t               count;
+        std::function<void()> run;
+    };
+
+    mg_factorization           fact_;
+    hipsolver_mg_layout        layout_;
+    vector<T>                  A0_;
+    bool                       eager_;
+    int                        seed_;
+    mt19937                    rng_;
+    vector<mg_dense<T>>        panel_;
+    vector<vector<int>>        pivots_;
+    vector<vector<int>>        info_;
+    vector<int64_t>            issued_;
+    vector<set<int64_t>>       done_;
+    vector<deque<task>>        queue_;
+
+    rocblas_status enqueue(int dev, int event, int64_t count, std::function<void()> run)
+    {
+        EXPECT_LT(dev, layout_.ndev);
+        if(eager_)
+            run();
+        else
+            queue_[dev].push_back({event, count, run});
+        return rocblas_status_success;
+    }
+
+    // the buffer of ref, which must hold a rows-by-cols block at ref and belong to dev
+    mg_dense<T>& buffer(hipsolver_mg_ref ref, int rows, int cols, int dev = -1)
+    {
+        if(dev >= 0)
+            EXPECT_EQ(ref.dev, dev);
+        mg_dense<T>& b = ref.buffer == hipsolver_mg_matrix ? matrix[ref.dev] : panel_[ref.dev];
+        EXPECT_TRUE(ref.row >= 0 && ref.col >= 0 && rows >= 0 && cols >= 0);
+        EXPECT_LE(ref.row + rows, b.rows);
+        EXPECT_LE(ref.col + cols, b.cols);
+        return b;
+    }
+};
+
+template <typename T>
+vector<T> mg_matrix(mg_factorization fact, int m, int n)
+{
+    mt19937                           rng(m * 1000 + n);
+    uniform_real_distribution<double> dist(-1, 1);
+
+    vector<T> A(size_t(m) * n);
+    for(size_t i = 0; i < A.size(); i++)
+        A[i] = T(dist(rng)) + T(dist(rng)) * mg_unit(T(0));
+
+    // Hermitian positive definite matrix for Cholesky
+    if(fact != mg_getrf)
+        for(int j = 0; j < n; j++)
+        {
+            A[j + size_t(j) * m] = T(n + dist(rng));
+            for(int i = j + 1; i < n; i++)
+                A[j + size_t(i) * m] = mg_conj(A[i + size_t(j) * m]);
+        }
+    return A;
+}
+
+template <typename T>
+rocblas_status mg_run(mg_factorization           fact,
+                      const hipsolver_mg_layout& layout,
+                      mg_host_device<T>&         dev,
+                      vector<int>&               tile_info,
+                      vector<int>&               ipiv)
+{
+    tile_info.assign(hipsolver_mg_slots(mg_kind(fact), layout), -1);
+    ipiv.assign(std::min(layout.m, layout.n), 0);
+    switch(fact)
+    {
+    case mg_potrf_lower:
+        return hipsolver_potrf_mg_schedule(dev, false, layout, tile_info.data());
+    case mg_potrf_upper:
+        return hipsolver_potrf_mg_schedule(dev, true, layout, tile_info.data());
+    case mg_getrf:
+        return hipsolver_getrf_mg_schedule(dev, layout, tile_info.data(), ipiv.data());
+    default:
+        return hipsolver_syevd_mg_schedule(dev, true, false, layout, tile_info.data());
+    }
+}
+
+// checks the factors in A against the matrix A0 they were computed from
+template <typename T>
+void mg_check(mg_factorization   fact,
+              int                m,
+              int                n,
+              const vector<T>&   A0,
+              const vector<T>&   A,
+              const vector<int>& ipiv)
+{
+    auto      a = [&](int i, int j) { return A[i + size_t(j) * m]; };
+    vector<T> R(size_t(m) * n, T(0));
+    auto      r = [&](int i, int j) -> T& { return R[i + size_t(j) * m]; };
+
+    if(fact == mg_syevd)
+    {
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < n; i++)
+                EXPECT_EQ(a(i, j), T(i + 1000 * j));
+        return;
+    }
+
+    if(fact == mg_getrf)
+    {
+        // R = L * U, then the interchanges are undone in reverse order
+        int mn = std::min(m, n);
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < m; i++)
+                for(int p = 0; p <= std::min(std::min(i, j), mn - 1); p++)
+                    r(i, j) += (i == p ? T(1) : a(i, p)) * a(p, j);
+        for(int c = mn - 1; c >= 0; c--)
+            for(int j = 0; j < n; j++)
+                std::swap(r(c, j), r(ipiv[c] - 1, j));
+
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < m; i++)
+                EXPECT_LE(std::abs(r(i, j) - A0[i + size_t(j) * m]), 1e-12 * (m + n));
+        return;
+    }
+
+    // R = L * L^H, where the upper case stores U = L^H
+    auto L = [&](int i, int j) {
+        if(i < j)
+            return T(0);
+        return fact == mg_potrf_upper ? mg_conj(a(j, i)) : a(i, j);
+    };
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i < n; i++)
+            for(int p = 0; p <= std::min(i, j); p++)
+                r(i, j) += L(i, p) * mg_conj(L(j, p));
+
+    // only the referenced triangle is compared
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i < n; i++)
+            if(fact == mg_potrf_upper ? i <= j : i >= j)
+                EXPECT_LE(std::abs(r(i, j) - A0[i + size_t(j) * m]), 1e-12 * n * n);
+}
+
+// every column is local to exactly one device, in the order of the blocks
+inline void mg_layout_check(const hipsolver_mg_layout& layout)
+{
+    vector<int> seen(layout.n, 0);
+    for(int d = 0; d < layout.ndev; d++)
+    {
+        int last = -1;
+        for(int c = 0; c < layout.local_cols(d); c++)
+        {
+            int g = layout.global(d, c);
+            ASSERT_LT(g, layout.n);
+            EXPECT_EQ(layout.owner(g / layout.nb), d);
+            EXPECT_EQ(layout.local(g / layout.nb) + g % layout.nb, c);
+            EXPECT_GT(g, last);
+            seen[g]++;
+            last = g;
+        }
+        for(int jb = 0; jb <= layout.blocks(); jb++)
+        {
+            int c = layout.local_from(d, jb);
+            EXPECT_TRUE(c == layout.local_cols(d) || layout.global(d, c) >= jb * layout.nb);
+            EXPECT_TRUE(c == 0 || layout.global(d, c - 1) < jb * layout.nb);
+        }
+    }
+    for(int count : seen)
+        EXPECT_EQ(count, 1);
+}
+
+template <typename T>
+void mg_scheduler_test(mg_factorization fact, int m, int n, int nb, int ndev)
+{
+    if(fact != mg_getrf)
+        m = n;
+
+    hipsolver_mg_layout layout;
+    layout.m    = m;
+    layout.n    = n;
+    layout.nb   = nb;
+    layout.ndev = ndev;
+    mg_layout_check(layout);
+
+    // reference: the operations in the order they were issued
+    vector<T>         A0 = mg_matrix<T>(fact, m, n);
+    mg_host_device<T> seq(fact, layout, A0, true, 0);
+    vector<int>       seq_info, seq_ipiv;
+    ASSERT_EQ(mg_run(fact, layout, seq, seq_info, seq_ipiv), rocblas_status_success);
+
+    vector<T>   S    = seq.global();
+    vector<int> ipiv = seq_ipiv;
+    hipsolver_mg_pivots(layout, int(ipiv.size()), ipiv.data());
+    EXPECT_EQ(hipsolver_mg_info(int(seq_info.size()), seq_info.data(), nb), 0);
+    mg_check(fact, m, n, A0, S, ipiv);
+    if(fact == mg_syevd)
+    {
+        EXPECT_TRUE(seq.gathered);
+        for(int i = 0; i < n; i++)
+            EXPECT_EQ(seq.W[i], mg_real(A0[i + size_t(i) * n]));
+    }
+
+    for(int seed = 0; seed < std::max(mg_seeds, ndev); seed++)
+    {
+        mg_host_device<T> dev(fact, layout, A0, false, seed);
+        vector<int>       info, piv;
+        ASSERT_EQ(mg_run(fact, layout, dev, info, piv), rocblas_status_success);
+
+        // any order consistent with the events gives the same result
+        EXPECT_EQ(dev.global(), S);
+        EXPECT_EQ(info, seq_info);
+        EXPECT_EQ(piv, seq_ipiv);
+        EXPECT_EQ(dev.gathered, seq.gathered);
+    }
+}
+
+// the info of a matrix that is not positive definite
+template <typename T>
+void mg_scheduler_info_test(int n, int nb, int ndev)
+{
+    hipsolver_mg_layout layout;
+    layout.m    = n;
+    layout.n    = n;
+    layout.nb   = nb;
+    layout.ndev = ndev;
+
+    int       p = n / 2;
+    vector<T> A = mg_matrix<T>(mg_potrf_lower, n, n);
+    A[p + size_t(p) * n] = T(-1000);
+
+    for(mg_factorization fact : {mg_potrf_lower, mg_potrf_upper})
+    {
+        mg_host_device<T> dev(fact, layout, A, false, 1);
+        vector<int>       info, ipiv;
+        ASSERT_EQ(mg_run(fact, layout, dev, info, ipiv), rocblas_status_success);
+        EXPECT_EQ(hipsolver_mg_info(int(info.size()), info.data(), nb), p + 1);
+    }
+}
+
+class MG_SCHEDULER : public ::TestWithParam<mg_scheduler_tuple>
+{
+protected:
+    MG_SCHEDULER() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        vector<int> size = std::get<0>(GetParam());
+        int         ndev = std::get<1>(GetParam());
+
+        for(mg_factorization fact : {mg_potrf_lower, mg_potrf_upper, mg_getrf, mg_syevd})
+            mg_scheduler_test<T>(fact, size[0], size[1], size[2], ndev);
+        mg_scheduler_info_test<T>(size[1], size[2], ndev);
+    }
+};
+
+TEST_P(MG_SCHEDULER, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(MG_SCHEDULER, __double_complex)
+{
+    run_tests<complex<double>>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         MG_SCHEDULER,
+                         Combine(ValuesIn(size_range), ValuesIn(device_range)));
+
+#endif
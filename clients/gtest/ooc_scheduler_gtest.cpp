@@ -0,0 +1,428 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+
+#include "ooc_scheduler.hpp"
+#include <complex>
+#include <deque>
+#include <functional>
+#include <random>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* The tests in this file run the out-of-core schedules on a stand-in for the
+   device that keeps the tile slots in host memory. Operations are queued per
+   stream and run at the end in a random order that respects the events, so that
+   a missing dependency shows up as a wrong result for some of the seeds. */
+
+typedef std::tuple<vector<int>, int> ooc_scheduler_tuple;
+
+// each size_range is a {n, nb, nslots}
+// each seed is the seed of the random order of the streams
+
+const vector<vector<int>> size_range = {
+    // normal (valid) samples
+    {1, 4, 8},
+    {7, 8, 8},
+    {16, 8, 8},
+    {37, 8, 8},
+    {37, 8, 9},
+    {64, 8, 12},
+    {100, 16, 10},
+    {100, 12, 30},
+    {130, 16, 100}};
+
+const vector<int> seed_range = {1, 2, 3};
+
+template <typename T>
+T conj_if(bool conj, T x)
+{
+    return x;
+}
+
+template <typename T>
+complex<T> conj_if(bool conj, complex<T> x)
+{
+    return conj ? std::conj(x) : x;
+}
+
+template <typename T>
+class ooc_host_device
+{
+public:
+    ooc_host_device(int nb, int nslots, int seed)
+        : nb_(nb)
+        , nslots_(nslots)
+        , slots_(size_t(nslots) * nb * nb)
+        , rng_(seed)
+    {
+    }
+
+    rocblas_status init(int nevents)
+    {
+        issued_.assign(nevents, 0);
+        done_.assign(nevents, 0);
+        return rocblas_status_success;
+    }
+
+    rocblas_status load(int slot, const T* host, int ld, int rows, int cols)
+    {
+        return push(hipsolver_ooc_tracker::h2d, [=] {
+            for(int j = 0; j < cols; j++)
+                for(int i = 0; i < rows; i++)
+                    at(slot, i, j) = host[i + size_t(j) * ld];
+        });
+    }
+
+    rocblas_status store(int slot, T* host, int ld, int rows, int cols)
+    {
+        return push(hipsolver_ooc_tracker::d2h, [=] {
+            for(int j = 0; j < cols; j++)
+                for(int i = 0; i < rows; i++)
+                    host[i + size_t(j) * ld] = at(slot, i, j);
+        });
+    }
+
+    rocblas_status record(int stream, int event)
+    {
+        int64_t count = ++issued_[event];
+        return push(stream, [=] { done_[event] = count; });
+    }
+
+    rocblas_status wait(int stream, int event)
+    {
+        queue_[stream].push_back({event, issued_[event], [] {}});
+        return rocblas_status_success;
+    }
+
+    rocblas_status potrf(bool upper, int a, int n, int t)
+    {
+        if(t >= int(info_.size()))
+            info_.resize(t + 1);
+        return push(hipsolver_ooc_tracker::compute, [=] {
+            // unblocked Cholesky of the lower triangle L, or of the upper one as U = L^H
+            auto get = [=](int i, int j) {
+                return upper ? conj_if(true, at(a, j, i)) : at(a, i, j);
+            };
+            auto set = [=](int i, int j, T x) {
+                if(upper)
+                    at(a, j, i) = conj_if(true, x);
+                else
+                    at(a, i, j) = x;
+            };
+
+            info_[t] = 0;
+            for(int j = 0; j < n; j++)
+            {
+                auto d = std::real(get(j, j));
+                for(int l = 0; l < j; l++)
+                    d -= std::norm(get(j, l));
+                if(d <= 0)
+                {
+                    info_[t] = j + 1;
+                    return;
+                }
+                d = std::sqrt(d);
+                set(j, j, T(d));
+                for(int i = j + 1; i < n; i++)
+                {
+                    T s = get(i, j);
+                    for(int l = 0; l < j; l++)
+                        s -= get(i, l) * conj_if(true, get(j, l));
+                    set(i, j, s / d);
+                }
+            }
+        });
+    }
+
+    rocblas_status trsm(bool left, bool upper, bool conj, int a, int b, int m, int n)
+    {
+        return push(hipsolver_ooc_tracker::compute, [=] {
+            int k = left ? m : n;
+
+            // op(a) as a dense triangular matrix
+            vector<T> t(size_t(k) * k, T(0));
+            for(int j = 0; j < k; j++)
+                for(int i = 0; i < k; i++)
+                    if(upper ? i <= j : i >= j)
+                    {
+                        if(conj)
+                            t[j + size_t(i) * k] = conj_if(true, at(a, i, j));
+                        else
+                            t[i + size_t(j) * k] = at(a, i, j);
+                    }
+            bool low = (upper == conj);
+
+            if(left)
+            {
+                for(int c = 0; c < n; c++)
+                    for(int r = 0; r < m; r++)
+                    {
+                        int i = low ? r : m - 1 - r;
+                        T   s = at(b, i, c);
+                        for(int l = 0; l < m; l++)
+                            if(low ? l < i : l > i)
+                                s -= t[i + size_t(l) * k] * at(b, l, c);
+                        at(b, i, c) = s / t[i + size_t(i) * k];
+                    }
+            }
+            else
+            {
+                for(int r = 0; r < m; r++)
+                    for(int c = 0; c < n; c++)
+                    {
+                        int j = low ? n - 1 - c : c;
+                        T   s = at(b, r, j);
+                        for(int l = 0; l < n; l++)
+                            if(low ? l > j : l < j)
+                                s -= at(b, r, l) * t[l + size_t(j) * k];
+                        at(b, r, j) = s / t[j + size_t(j) * k];
+                    }
+            }
+        });
+    }
+
+    rocblas_status herk(bool upper, bool conj, int c, int a, int n, int k)
+    {
+        return push(hipsolver_ooc_tracker::compute, [=] {
+            for(int j = 0; j < n; j++)
+                for(int i = (upper ? 0 : j); i < (upper ? j + 1 : n); i++)
+                {
+                    T s = 0;
+                    for(int l = 0; l < k; l++)
+                        s += conj ? conj_if(true, at(a, l, i)) * at(a, l, j)
+                                  : at(a, i, l) * conj_if(true, at(a, j, l));
+                    at(c, i, j) -= s;
+                }
+        });
+    }
+
+    rocblas_status gemm(bool conjA, bool conjB, int c, int a, int b, int m, int n, int k)
+    {
+        return push(hipsolver_ooc_tracker::compute, [=] {
+            for(int j = 0; j < n; j++)
+                for(int i = 0; i < m; i++)
+                {
+                    T s = 0;
+                    for(int l = 0; l < k; l++)
+                        s += (conjA ? conj_if(true, at(a, l, i)) : at(a, i, l))
+                             * (conjB ? conj_if(true, at(b, j, l)) : at(b, l, j));
+                    at(c, i, j) -= s;
+                }
+        });
+    }
+
+    rocblas_status finish(int ntiles, int* tile_info)
+    {
+        // run the queued operations in a random order that respects the events
+        while(true)
+        {
+            vector<int> ready;
+            bool        empty = true;
+            for(int s = 0; s < hipsolver_ooc_tracker::nstreams; s++)
+            {
+                if(queue_[s].empty())
+                    continue;
+                empty         = false;
+                const task& t = queue_[s].front();
+                if(t.event < 0 || done_[t.event] >= t.count)
+                    ready.push_back(s);
+            }
+            if(empty)
+                break;
+            if(ready.empty())
+                return rocblas_status_internal_error;
+
+            int s = ready[rng_() % ready.size()];
+            queue_[s].front().run();
+            queue_[s].pop_front();
+        }
+
+        for(int t = 0; t < ntiles; t++)
+            tile_info[t] = info_[t];
+        return rocblas_status_success;
+    }
+
+private:
+    struct task
+    {
+        int                   event;
+        int64_t               count;
+        std::function<void()> run;
+    };
+
+    int             nb_;
+    int             nslots_;
+    vector<T>       slots_;
+    vector<int>     info_;
+    vector<int64_t> issued_;
+    vector<int64_t> done_;
+    deque<task>     queue_[hipsolver_ooc_tracker::nstreams];
+    mt19937         rng_;
+
+    T& at(int slot, int i, int j)
+    {
+        return slots_[size_t(slot) * nb_ * nb_ + i + size_t(j) * nb_];
+    }
+
+    rocblas_status push(int stream, std::function<void()> run)
+    {
+        queue_[stream].push_back({-1, 0, run});
+        return rocblas_status_success;
+    }
+};
+
+// imaginary unit, or zero for real types
+inline double ooc_unit(double)
+{
+    return 0;
+}
+
+inline complex<double> ooc_unit(complex<double>)
+{
+    return complex<double>(0, 1);
+}
+
+// Hermitian positive definite matrix with an optional negative diagonal element
+template <typename T>
+vector<T> ooc_matrix(int n, int singular)
+{
+    mt19937                           rng(n);
+    uniform_real_distribution<double> dist(-1, 1);
+
+    vector<T> A(size_t(n) * n);
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i <= j; i++)
+        {
+            T x = (i == j) ? T(n + dist(rng)) : T(dist(rng)) + T(dist(rng)) * ooc_unit(T(0));
+            A[i + size_t(j) * n] = x;
+            A[j + size_t(i) * n] = conj_if(true, x);
+        }
+    if(singular > 0)
+        A[(singular - 1) * size_t(n + 1)] = T(-1);
+    return A;
+}
+
+template <typename T>
+void ooc_scheduler_test(bool upper, int n, int nb, int nslots, int seed)
+{
+    const int nrhs = n / 2 + 3;
+
+    vector<T> A0 = ooc_matrix<T>(n, 0);
+    vector<T> A  = A0;
+    vector<T> B0(size_t(n) * nrhs);
+    for(size_t i = 0; i < B0.size(); i++)
+        B0[i] = T(double(i % 7) - 3);
+    vector<T> B = B0;
+
+    int nt = (n - 1) / nb + 1;
+
+    // factorization
+    {
+        ooc_host_device<T> dev(nb, nslots, seed);
+        vector<int>        tile_info(nt);
+        ASSERT_EQ(dev.init(hipsolver_ooc_tracker::event_count(nslots)), rocblas_status_success);
+        ASSERT_EQ(hipsolver_potrf_ooc_schedule(
+                      dev, upper, n, A.data(), n, nb, nslots, tile_info.data()),
+                  rocblas_status_success);
+        for(int t = 0; t < nt; t++)
+            EXPECT_EQ(tile_info[t], 0);
+    }
+
+    // the factor times its conjugate transpose must give back the matrix
+    auto L = [&](int i, int j) {
+        return upper ? conj_if(true, A[j + size_t(i) * n]) : A[i + size_t(j) * n];
+    };
+    double err = 0, nrm = 0;
+    for(int j = 0; j < n; j++)
+        for(int i = j; i < n; i++)
+        {
+            T s = 0;
+            for(int l = 0; l <= j; l++)
+                s += L(i, l) * conj_if(true, L(j, l));
+            err = max(err, std::abs(s - A0[i + size_t(j) * n]));
+            nrm = max(nrm, std::abs(A0[i + size_t(j) * n]));
+        }
+    EXPECT_LE(err, 1e-12 * n * nrm);
+
+    // solution
+    {
+        ooc_host_device<T> dev(nb, nslots, seed);
+        ASSERT_EQ(dev.init(hipsolver_ooc_tracker::event_count(nslots)), rocblas_status_success);
+        ASSERT_EQ(hipsolver_potrs_ooc_schedule(
+                      dev, upper, n, nrhs, (const T*)A.data(), n, B.data(), n, nb, nslots),
+                  rocblas_status_success);
+    }
+
+    err = 0, nrm = 0;
+    for(int c = 0; c < nrhs; c++)
+        for(int i = 0; i < n; i++)
+        {
+            T s = 0;
+            for(int l = 0; l < n; l++)
+                s += A0[i + size_t(l) * n] * B[l + size_t(c) * n];
+            err = max(err, std::abs(s - B0[i + size_t(c) * n]));
+            nrm = max(nrm, std::abs(B0[i + size_t(c) * n]));
+        }
+    EXPECT_LE(err, 1e-12 * n * nrm);
+
+    // a matrix that is not positive definite is reported by the first failing tile
+    if(n > 1)
+    {
+        int         singular = n / 2 + 1;
+        vector<T>   S        = ooc_matrix<T>(n, singular);
+        vector<int> tile_info(nt);
+
+        ooc_host_device<T> dev(nb, nslots, seed);
+        ASSERT_EQ(dev.init(hipsolver_ooc_tracker::event_count(nslots)), rocblas_status_success);
+        ASSERT_EQ(hipsolver_potrf_ooc_schedule(
+                      dev, upper, n, S.data(), n, nb, nslots, tile_info.data()),
+                  rocblas_status_success);
+
+        int t = (singular - 1) / nb;
+        EXPECT_EQ(tile_info[t], singular - t * nb);
+    }
+}
+
+class OOC_SCHEDULER : public ::TestWithParam<ooc_scheduler_tuple>
+{
+protected:
+    OOC_SCHEDULER() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        vector<int> size = std::get<0>(GetParam());
+        int         seed = std::get<1>(GetParam());
+
+        ooc_scheduler_test<T>(false, size[0], size[1], size[2], seed);
+        ooc_scheduler_test<T>(true, size[0], size[1], size[2], seed);
+    }
+};
+
+TEST_P(OOC_SCHEDULER, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(OOC_SCHEDULER, __double_complex)
+{
+    run_tests<complex<double>>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         OOC_SCHEDULER,
+                         Combine(ValuesIn(size_range), ValuesIn(seed_range)));
+
+#endif
@@ -0,0 +1,155 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_potrf_ooc.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, char> potrf_ooc_tuple;
+
+// each size_range vector is a {n, lda, nrhs, budget}
+// the device memory budget is given in KiB; 0 uses the default of about half of the matrix
+
+// each uplo_range is a {uplo}
+
+// case when n = -1 and uplo = L will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<char> uplo_range = {'L', 'U'};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // invalid
+    {-1, 1, 1, 0},
+    {10, 2, 1, 0},
+    // normal (valid) samples
+    {10, 10, 1, 0},
+    {70, 80, 3, 0},
+    {300, 300, 10, 2048},
+    {1000, 1010, 17, 0},
+    {1000, 1000, 300, 4096},
+    {2000, 2000, 5, 0}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_size_range = {
+//     {5000, 5000, 100, 0},
+//     {20000, 20000, 10, 262144},
+// };
+
+Arguments potrf_ooc_setup_arguments(potrf_ooc_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char        uplo        = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+    arg.set<rocblas_int>("ldb", std::max(matrix_size[0], 1));
+    arg.set<rocblas_int>("nrhs", matrix_size[2]);
+    if(matrix_size[3] > 0)
+        arg.set<rocblas_int>("budget", matrix_size[3]);
+
+    arg.set<char>("uplo", uplo);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <bool FORTRAN>
+class POTRF_OOC_BASE : public ::TestWithParam<potrf_ooc_tuple>
+{
+protected:
+    POTRF_OOC_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = potrf_ooc_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == -1 && arg.peek<char>("uplo") == 'L')
+            testing_potrf_ooc_bad_arg<FORTRAN, T>();
+
+        testing_potrf_ooc<FORTRAN, T>(arg);
+    }
+};
+
+class POTRF_OOC : public POTRF_OOC_BASE<false>
+{
+};
+
+class POTRF_OOC_FORTRAN : public POTRF_OOC_BASE<true>
+{
+};
+
+// potrfOutOfCore and potrsOutOfCore are not provided by the cuSOLVER backend
+#if !defined(__HIP_PLATFORM_NVCC__)
+
+// non-batch tests
+
+TEST_P(POTRF_OOC, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(POTRF_OOC, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(POTRF_OOC, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(POTRF_OOC, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+TEST_P(POTRF_OOC_FORTRAN, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(POTRF_OOC_FORTRAN, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(POTRF_OOC_FORTRAN, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(POTRF_OOC_FORTRAN, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          POTRF_OOC,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_OOC,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          POTRF_OOC_FORTRAN,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_OOC_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
+
+#endif
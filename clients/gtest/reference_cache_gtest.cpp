@@ -0,0 +1,101 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+
+#include "clientcommon.hpp"
+
+using namespace std;
+
+/* The tests in this file store host batch vectors in the cache of the host
+   reference and read them back. An entry must only be found for the same
+   key and the same inputs; otherwise the outputs are left as they were. */
+
+class REFERENCE_CACHE : public ::testing::Test
+{
+protected:
+    string previous;
+
+    void SetUp() override
+    {
+        previous = hipsolver_reference_cache_dir();
+        ASSERT_TRUE(hipsolver_reference_cache_open(testing::TempDir()
+                                                   + "hipsolver_reference_cache_test"));
+    }
+
+    void TearDown() override
+    {
+        hipsolver_reference_cache_open(previous);
+    }
+};
+
+TEST_F(REFERENCE_CACHE, __store_load)
+{
+    const int n = 37, bc = 3;
+
+    host_strided_batch_vector<double> hA(n * n, 1, n * n, bc);
+    host_strided_batch_vector<int>    hInfo(1, 1, 1, bc);
+    rocblas_init<double>(hA, true);
+    for(int b = 0; b < bc; b++)
+        hInfo[b][0] = b + 1;
+
+    hipsolver_reference_cache store("test", 'd', n, bc);
+    store.input(hA);
+    store.output(hA, hInfo);
+    store.store();
+
+    // the outputs are read into other vectors with the same inputs
+    host_strided_batch_vector<double> hB(n * n, 1, n * n, bc);
+    host_strided_batch_vector<int>    hInfoB(1, 1, 1, bc);
+    for(int b = 0; b < bc; b++)
+        for(int i = 0; i < n * n; i++)
+            hB[b][i] = hA[b][i];
+
+    hipsolver_reference_cache load("test", 'd', n, bc);
+    load.input(hB);
+    load.output(hB, hInfoB);
+    ASSERT_TRUE(load.load());
+    for(int b = 0; b < bc; b++)
+    {
+        EXPECT_EQ(hInfoB[b][0], b + 1);
+        for(int i = 0; i < n * n; i++)
+            EXPECT_EQ(hB[b][i], hA[b][i]);
+    }
+
+    // other arguments
+    hipsolver_reference_cache args("test", 'd', n, bc, 1);
+    args.input(hB);
+    args.output(hB, hInfoB);
+    EXPECT_FALSE(args.load());
+
+    // other inputs
+    hB[bc - 1][0] += 1;
+    hipsolver_reference_cache inputs("test", 'd', n, bc);
+    inputs.input(hB);
+    inputs.output(hB, hInfoB);
+    EXPECT_FALSE(inputs.load());
+    EXPECT_EQ(hB[bc - 1][0], hA[bc - 1][0] + 1);
+
+    // other outputs
+    host_strided_batch_vector<int> hInfoC(2, 1, 2, bc);
+    hipsolver_reference_cache      outputs("test", 'd', n, bc);
+    outputs.input(hA);
+    outputs.output(hB, hInfoC);
+    EXPECT_FALSE(outputs.load());
+}
+
+TEST_F(REFERENCE_CACHE, __disabled)
+{
+    hipsolver_reference_cache_open("");
+    EXPECT_FALSE(hipsolver_reference_cache_enabled());
+
+    host_strided_batch_vector<float> hA(4, 1, 4, 1);
+    rocblas_init<float>(hA, true);
+    hipsolver_reference_cache cache("test", 's', 4);
+    cache.input(hA);
+    cache.output(hA);
+    cache.store();
+    EXPECT_FALSE(cache.load());
+}
@@ -0,0 +1,96 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+
+#include "clientcommon.hpp"
+#include <cstdlib>
+
+using namespace std;
+
+/* The tests in this file check the counter-based generator of rocblas_init:
+   its words against the known answers of Philox4x32-10, and its fills, which
+   must depend on the seed and on the position of each element only. */
+
+// fills a batch of M-by-N matrices after a reset of the seed, with the given number of threads
+template <typename T>
+vector<T> philox_matrices(size_t M, size_t N, size_t lda, size_t bc, const char* threads)
+{
+    const char* previous = getenv("HIPSOLVER_REFERENCE_THREADS");
+    string      saved    = previous ? previous : "";
+    setenv("HIPSOLVER_REFERENCE_THREADS", threads, 1);
+
+    vector<T> A(lda * N * bc);
+    hipsolver_seedrand();
+    rocblas_init<T>(A, M, N, lda, lda * N, bc);
+
+    if(previous)
+        setenv("HIPSOLVER_REFERENCE_THREADS", saved.c_str(), 1);
+    else
+        unsetenv("HIPSOLVER_REFERENCE_THREADS");
+    return A;
+}
+
+TEST(ROCBLAS_INIT, __philox)
+{
+    // known answers of the Random123 library, with key = seed and counter = (i, j, batch, stream)
+    uint32_t r0[HIPSOLVER_PHILOX_LANES], r1[HIPSOLVER_PHILOX_LANES];
+    hipsolver_philox(0, 0, 0, 0, 0, r0, r1);
+    EXPECT_EQ(r0[0], 0x6627e8d5u);
+    EXPECT_EQ(r1[0], 0xe169c58du);
+
+    hipsolver_philox(~0ull, ~0u, ~0u, ~0u, ~0u, r0, r1);
+    EXPECT_EQ(r0[0], 0x408f276du);
+    EXPECT_EQ(r1[0], 0x41c83b0eu);
+
+    hipsolver_philox(0x299f31d0a4093822ull, 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344, r0, r1);
+    EXPECT_EQ(r0[0], 0xd16cfe09u);
+    EXPECT_EQ(r1[0], 0x94fdccebu);
+}
+
+TEST(ROCBLAS_INIT, __threads)
+{
+    // large enough to be filled on multiple threads
+    const size_t M = 300, N = 250, lda = 307, bc = 3;
+
+    vector<double> serial   = philox_matrices<double>(M, N, lda, bc, "1");
+    vector<double> parallel = philox_matrices<double>(M, N, lda, bc, "4");
+    EXPECT_EQ(serial, parallel);
+
+    // each element is the value of its own counter
+    uint32_t r0[HIPSOLVER_PHILOX_LANES], r1[HIPSOLVER_PHILOX_LANES];
+    for(size_t b = 0; b < bc; b++)
+        for(size_t j = 0; j < N; j += 7)
+            for(size_t i = 0; i < M; i += 5)
+            {
+                hipsolver_philox(hipsolver_counter_seed, i, j, b, 0, r0, r1);
+                double value = serial[i + j * lda + b * lda * N];
+                EXPECT_EQ(value, hipsolver_philox_value<double>(r0[0], r1[0]));
+                EXPECT_TRUE(value >= 1 && value <= 10);
+            }
+}
+
+TEST(ROCBLAS_INIT, __seedrand)
+{
+    const int n = 40, bc = 2;
+
+    host_strided_batch_vector<hipsolverDoubleComplex> hA(n * n, 1, n * n, bc);
+    host_strided_batch_vector<hipsolverDoubleComplex> hB(n * n, 1, n * n, bc);
+    host_strided_batch_vector<hipsolverDoubleComplex> hC(n * n, 1, n * n, bc);
+
+    // a reset of the seed repeats the data, which the next fill does not
+    rocblas_init<hipsolverDoubleComplex>(hA, true);
+    rocblas_init<hipsolverDoubleComplex>(hB, true);
+    rocblas_init<hipsolverDoubleComplex>(hC, false);
+
+    int same = 0;
+    for(int b = 0; b < bc; b++)
+        for(int i = 0; i < n * n; i++)
+        {
+            EXPECT_EQ(hA[b][i], hB[b][i]);
+            same += hA[b][i] == hC[b][i];
+        }
+    EXPECT_LT(same, n * n * bc / 10);
+}
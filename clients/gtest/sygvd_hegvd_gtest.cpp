@@ -83,7 +83,7 @@ protected:
            && arg.peek<char>("uplo") == 'U' && arg.peek<rocblas_int>("n") == -1)
             testing_sygvd_hegvd_bad_arg<FORTRAN, BATCHED, STRIDED, T>();
 
-        arg.batch_count = 1;
+        arg.batch_count = (BATCHED || STRIDED ? 5 : 1);
         testing_sygvd_hegvd<FORTRAN, BATCHED, STRIDED, T>(arg);
     }
 };
@@ -146,6 +146,50 @@ TEST_P(HEGVD_FORTRAN, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+// strided_batched tests
+// (the pipelined functions are not provided by the cuSOLVER backend)
+#if !defined(__HIP_PLATFORM_NVCC__)
+TEST_P(SYGVD, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(SYGVD, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(HEGVD, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(HEGVD, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(SYGVD_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(SYGVD_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(HEGVD_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(HEGVD_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+#endif
+
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
 //                          SYGVD,
 //                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(type_range)));
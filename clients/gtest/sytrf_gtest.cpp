@@ -0,0 +1,144 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_sytrf.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, char> sytrf_tuple;
+
+// each matrix_size_range vector is a {n, lda}
+
+// case when n = -1 and uplo = U will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<char> uplo_range = {'L', 'U'};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    {32, 32},
+    {50, 50},
+    {70, 100}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_size_range = {
+//     {192, 192},
+//     {640, 960},
+//     {1000, 1000},
+// };
+
+Arguments sytrf_setup_arguments(sytrf_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char        uplo        = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+
+    arg.set<char>("uplo", uplo);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <bool FORTRAN>
+class SYTRF_BASE : public ::TestWithParam<sytrf_tuple>
+{
+protected:
+    SYTRF_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = sytrf_setup_arguments(GetParam());
+
+        if(arg.peek<char>("uplo") == 'U' && arg.peek<rocblas_int>("n") == -1)
+            testing_sytrf_bad_arg<FORTRAN, BATCHED, STRIDED, T>();
+
+        arg.batch_count = 1;
+        testing_sytrf<FORTRAN, BATCHED, STRIDED, T>(arg);
+    }
+};
+
+class SYTRF : public SYTRF_BASE<false>
+{
+};
+
+class SYTRF_FORTRAN : public SYTRF_BASE<true>
+{
+};
+
+// non-batch tests
+
+TEST_P(SYTRF, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(SYTRF, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(SYTRF, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(SYTRF, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(SYTRF_FORTRAN, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(SYTRF_FORTRAN, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(SYTRF_FORTRAN, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(SYTRF_FORTRAN, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          SYTRF,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         SYTRF,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          SYTRF_FORTRAN,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         SYTRF_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
@@ -0,0 +1,173 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+
+#include "thread_pool.hpp"
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* The tests in this file run the work-stealing thread pool of the host backend
+   directly. Every problem must run exactly once, the range of a blocked slot
+   must be stolen by the others, and an exception must be rethrown once the
+   other problems are done. */
+
+typedef std::tuple<vector<int>, hipsolverHostAffinity_t> thread_pool_tuple;
+
+// each size_range is a {nthreads, count}
+// (nthreads = 0 is one thread per CPU of the process)
+
+const vector<vector<int>> size_range = {
+    // normal (valid) samples
+    {1, 1},
+    {1, 17},
+    {0, 40},
+    {2, 1},
+    {2, 2},
+    {3, 100},
+    {4, 3},
+    {8, 1000}};
+
+const vector<hipsolverHostAffinity_t> affinity_range
+    = {HIPSOLVER_HOST_AFFINITY_NONE, HIPSOLVER_HOST_AFFINITY_CLOSE, HIPSOLVER_HOST_AFFINITY_SPREAD};
+
+// every problem runs once, over several runs on the same pool
+void thread_pool_count_test(hipsolver_host_pool& pool, int count)
+{
+    for(int run = 0; run < 3; run++)
+    {
+        vector<atomic<int>> calls(count);
+        for(auto& c : calls)
+            c = 0;
+
+        pool.run(count, [&](int b) { calls[b]++; });
+
+        for(int b = 0; b < count; b++)
+            EXPECT_EQ(calls[b].load(), 1) << "problem " << b << " of run " << run;
+    }
+}
+
+/* The first problem waits for all the others, so the rest of the range of its
+   slot only runs if it is stolen. */
+void thread_pool_steal_test(hipsolver_host_pool& pool, int count)
+{
+    if(pool.size() == 1 || count < 2)
+        return;
+
+    atomic<int> done(0);
+    bool        timeout = false;
+    pool.run(count, [&](int b) {
+        if(b > 0)
+        {
+            done++;
+            return;
+        }
+
+        auto start = chrono::steady_clock::now();
+        while(done.load() < count - 1)
+        {
+            if(chrono::steady_clock::now() - start > chrono::seconds(10))
+            {
+                timeout = true;
+                return;
+            }
+            this_thread::yield();
+        }
+    });
+
+    EXPECT_FALSE(timeout);
+    EXPECT_EQ(done.load(), count - 1);
+}
+
+// the first exception is rethrown after the other problems ran
+void thread_pool_error_test(hipsolver_host_pool& pool, int count)
+{
+    atomic<int> calls(0);
+    EXPECT_THROW(pool.run(count,
+                          [&](int b) {
+                              calls++;
+                              if(b % 3 == 0)
+                                  throw std::runtime_error("problem failed");
+                          }),
+                 std::runtime_error);
+    EXPECT_EQ(calls.load(), count);
+
+    // the pool is still usable
+    thread_pool_count_test(pool, count);
+}
+
+class THREAD_POOL : public ::TestWithParam<thread_pool_tuple>
+{
+protected:
+    THREAD_POOL() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    void run_tests()
+    {
+        vector<int>             size     = std::get<0>(GetParam());
+        hipsolverHostAffinity_t affinity = std::get<1>(GetParam());
+
+        hipsolver_host_pool pool(size[0], affinity);
+        EXPECT_EQ(pool.size(), size[0] ? size[0] : hipsolver_host_default_threads());
+
+        thread_pool_count_test(pool, size[1]);
+        thread_pool_steal_test(pool, size[1]);
+        thread_pool_error_test(pool, size[1]);
+    }
+};
+
+TEST_P(THREAD_POOL, __run)
+{
+    run_tests();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         THREAD_POOL,
+                         Combine(ValuesIn(size_range), ValuesIn(affinity_range)));
+
+TEST(THREAD_POOL_SETTINGS, __handle)
+{
+    hipsolverHandle_t handle;
+    ASSERT_EQ(hipsolverCreate(&handle), HIPSOLVER_STATUS_SUCCESS);
+
+    int                     nthreads;
+    hipsolverHostAffinity_t affinity;
+    EXPECT_EQ(hipsolverGetHostThreadPool(handle, &nthreads, &affinity), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(nthreads, 0);
+    EXPECT_EQ(affinity, HIPSOLVER_HOST_AFFINITY_NONE);
+
+    EXPECT_EQ(hipsolverSetHostThreadPool(handle, 3, HIPSOLVER_HOST_AFFINITY_SPREAD),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolverGetHostThreadPool(handle, &nthreads, &affinity), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(nthreads, 3);
+    EXPECT_EQ(affinity, HIPSOLVER_HOST_AFFINITY_SPREAD);
+
+    // bad arguments leave the settings as they were
+    EXPECT_EQ(hipsolverSetHostThreadPool(nullptr, 1, HIPSOLVER_HOST_AFFINITY_NONE),
+              HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipsolverSetHostThreadPool(handle, -1, HIPSOLVER_HOST_AFFINITY_NONE),
+              HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverSetHostThreadPool(handle, 1, hipsolverHostAffinity_t(0)),
+              HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipsolverGetHostThreadPool(nullptr, &nthreads, &affinity),
+              HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipsolverGetHostThreadPool(handle, nullptr, &affinity),
+              HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverGetHostThreadPool(handle, &nthreads, nullptr),
+              HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverGetHostThreadPool(handle, &nthreads, &affinity), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(nthreads, 3);
+    EXPECT_EQ(affinity, HIPSOLVER_HOST_AFFINITY_SPREAD);
+
+    EXPECT_EQ(hipsolverDestroy(handle), HIPSOLVER_STATUS_SUCCESS);
+}
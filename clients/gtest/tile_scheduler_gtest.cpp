@@ -0,0 +1,637 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+
+#include "tile_scheduler.hpp"
+#include <complex>
+#include <deque>
+#include <functional>
+#include <random>
+#include <set>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* The tests in this file run the plans of the tiled task engine on a stand-in
+   for the device that computes the tasks in host memory. Tasks are queued per
+   stream and run at the end in a random order that respects the events, so that
+   a missing dependency shows up as a result that differs from running the tasks
+   one after the other. */
+
+typedef std::tuple<vector<int>, vector<int>> tile_scheduler_tuple;
+
+// each size_range is a {m, n, nb}
+// each stream_range is a {nstreams, lookahead}
+
+const vector<vector<int>> size_range = {
+    // normal (valid) samples
+    {1, 1, 4},
+    {8, 8, 8},
+    {9, 9, 8},
+    {30, 30, 8},
+    {37, 21, 8},
+    {21, 37, 8},
+    {64, 64, 16},
+    {70, 45, 12}};
+
+const vector<vector<int>> stream_range = {{1, 0}, {1, 2}, {2, 0}, {2, 1}, {3, 1}, {5, 2}, {4, 9}};
+
+// seeds of the random order of the streams
+const int tile_seeds = 3;
+
+template <typename T>
+T conj_if(bool conj, T x)
+{
+    return x;
+}
+
+template <typename T>
+complex<T> conj_if(bool conj, complex<T> x)
+{
+    return conj ? std::conj(x) : x;
+}
+
+inline double tile_real(double x)
+{
+    return x;
+}
+
+inline double tile_real(complex<double> x)
+{
+    return x.real();
+}
+
+// imaginary unit, or zero for real types
+inline double tile_unit(double)
+{
+    return 0;
+}
+
+inline complex<double> tile_unit(complex<double>)
+{
+    return complex<double>(0, 1);
+}
+
+enum tile_factorization
+{
+    tile_potrf_lower,
+    tile_potrf_upper,
+    tile_getrf,
+    tile_geqrf,
+};
+
+template <typename T>
+class tile_host_device
+{
+public:
+    tile_host_device(tile_factorization fact,
+                     int                m,
+                     int                n,
+                     vector<T>&         A,
+                     int                nb,
+                     int                nstreams,
+                     int                seed)
+        : fact_(fact)
+        , m_(m)
+        , n_(n)
+        , nb_(nb)
+        , A_(A)
+        , queue_(nstreams)
+        , rng_(seed)
+    {
+        int mn = std::min(m, n);
+        ipiv.assign(mn, 0);
+        tau.assign(mn, T(0));
+        tile_info.assign((mn - 1) / nb + 1, 0);
+        factors_.assign(tile_info.size() * nb * nb, T(0));
+    }
+
+    vector<int> ipiv;
+    vector<T>   tau;
+    vector<int> tile_info;
+
+    rocblas_status init(int nevents)
+    {
+        issued_.assign(nevents, 0);
+        done_.assign(nevents, {});
+        return rocblas_status_success;
+    }
+
+    rocblas_status record(int stream, int event)
+    {
+        // events are recorded again once nothing waits for them any more, possibly on
+        // another stream, so the completion of every recording is kept
+        int64_t count = ++issued_[event];
+        queue_[stream].push_back({-1, 0, [=] { done_[event].insert(count); }});
+        return rocblas_status_success;
+    }
+
+    rocblas_status wait(int stream, int event)
+    {
+        queue_[stream].push_back({event, issued_[event], [] {}});
+        return rocblas_status_success;
+    }
+
+    rocblas_status run(int stream, const hipsolver_tile_task& task)
+    {
+        queue_[stream].push_back({-1, 0, [=] { compute(task); }});
+        return rocblas_status_success;
+    }
+
+    rocblas_status finish()
+    {
+        // run the queued operations in a random order that respects the events
+        while(true)
+        {
+            vector<int> ready;
+            bool        empty = true;
+            for(size_t s = 0; s < queue_.size(); s++)
+            {
+                if(queue_[s].empty())
+                    continue;
+                empty         = false;
+                const task& t = queue_[s].front();
+                if(t.event < 0 || t.count == 0 || done_[t.event].count(t.count))
+                    ready.push_back(s);
+            }
+            if(empty)
+                break;
+            if(ready.empty())
+                return rocblas_status_internal_error;
+
+            int s = ready[rng_() % ready.size()];
+            queue_[s].front().run();
+            queue_[s].pop_front();
+        }
+        return rocblas_status_success;
+    }
+
+    // runs the tasks of dag one after the other
+    void run_sequential(const hipsolver_tile_dag& dag)
+    {
+        for(const hipsolver_tile_task& t : dag.tasks)
+            compute(t);
+    }
+
+private:
+    struct task
+    {
+        int                   event;
+        int64_t               count;
+        std::function<void()> run;
+    };
+
+    tile_factorization   fact_;
+    int                  m_;
+    int                  n_;
+    int                  nb_;
+    vector<T>&           A_;
+    vector<T>            factors_;
+    vector<int64_t>      issued_;
+    vector<set<int64_t>> done_;
+    vector<deque<task>>  queue_;
+    mt19937              rng_;
+
+    T& a(int i, int j)
+    {
+        return A_[i + size_t(j) * m_];
+    }
+
+    // element (i, j) of the lower triangular Cholesky factor, as stored
+    T l(int i, int j)
+    {
+        return fact_ == tile_potrf_upper ? conj_if(true, a(j, i)) : a(i, j);
+    }
+
+    void set_l(int i, int j, T x)
+    {
+        if(fact_ == tile_potrf_upper)
+            a(j, i) = conj_if(true, x);
+        else
+            a(i, j) = x;
+    }
+
+    int rows(int t)
+    {
+        return std::min(nb_, m_ - t * nb_);
+    }
+
+    int cols(int t)
+    {
+        return std::min(nb_, n_ - t * nb_);
+    }
+
+    void compute(const hipsolver_tile_task& task)
+    {
+        int k0 = task.k * nb_;
+        int kb = cols(task.k);
+
+        switch(task.kernel)
+        {
+        case hipsolver_tile_potrf:
+        {
+            tile_info[task.k] = 0;
+            for(int j = k0; j < k0 + kb; j++)
+            {
+                double d = tile_real(l(j, j));
+                for(int p = k0; p < j; p++)
+                    d -= std::norm(l(j, p));
+                if(d <= 0)
+                {
+                    tile_info[task.k] = j - k0 + 1;
+                    return;
+                }
+                d = std::sqrt(d);
+                set_l(j, j, T(d));
+                for(int i = j + 1; i < k0 + kb; i++)
+                {
+                    T s = l(i, j);
+                    for(int p = k0; p < j; p++)
+                        s -= l(i, p) * conj_if(true, l(j, p));
+                    set_l(i, j, s / d);
+                }
+            }
+            break;
+        }
+        case hipsolver_tile_trsm:
+        {
+            // L(i, k) = A(i, k) * L(k, k)^-H
+            int i0 = task.i * nb_;
+            for(int r = i0; r < i0 + rows(task.i); r++)
+                for(int c = k0; c < k0 + kb; c++)
+                {
+                    T s = l(r, c);
+                    for(int p = k0; p < c; p++)
+                        s -= l(r, p) * conj_if(true, l(c, p));
+                    set_l(r, c, s / conj_if(true, l(c, c)));
+                }
+            break;
+        }
+        case hipsolver_tile_herk:
+        {
+            int j0 = task.j * nb_;
+            for(int c = j0; c < j0 + cols(task.j); c++)
+                for(int r = c; r < j0 + cols(task.j); r++)
+                {
+                    T s = 0;
+                    for(int p = k0; p < k0 + kb; p++)
+                        s += l(r, p) * conj_if(true, l(c, p));
+                    set_l(r, c, l(r, c) - s);
+                }
+            break;
+        }
+        case hipsolver_tile_gemm:
+        {
+            int i0 = task.i * nb_;
+            int j0 = task.j * nb_;
+            for(int c = j0; c < j0 + cols(task.j); c++)
+                for(int r = i0; r < i0 + rows(task.i); r++)
+                {
+                    T s = 0;
+                    for(int p = k0; p < k0 + kb; p++)
+                        s += fact_ == tile_getrf ? a(r, p) * a(p, c)
+                                                 : l(r, p) * conj_if(true, l(c, p));
+                    if(fact_ == tile_getrf)
+                        a(r, c) -= s;
+                    else
+                        set_l(r, c, l(r, c) - s);
+                }
+            break;
+        }
+        case hipsolver_tile_getrf:
+        {
+            // unblocked LU of rows k0 to m - 1 with pivots relative to row k0
+            tile_info[task.k] = 0;
+            for(int c = k0; c < k0 + std::min(kb, m_ - k0); c++)
+            {
+                int p = c;
+                for(int r = c + 1; r < m_; r++)
+                    if(std::abs(a(r, c)) > std::abs(a(p, c)))
+                        p = r;
+                ipiv[c] = p - k0 + 1;
+                for(int j = k0; j < k0 + kb; j++)
+                    std::swap(a(c, j), a(p, j));
+
+                if(a(c, c) == T(0))
+                {
+                    if(tile_info[task.k] == 0)
+                        tile_info[task.k] = c - k0 + 1;
+                    continue;
+                }
+                for(int r = c + 1; r < m_; r++)
+                {
+                    a(r, c) /= a(c, c);
+                    for(int j = c + 1; j < k0 + kb; j++)
+                        a(r, j) -= a(r, c) * a(c, j);
+                }
+            }
+            break;
+        }
+        case hipsolver_tile_swptrsm:
+        {
+            int j0 = task.j * nb_;
+            int kr = std::min(kb, m_ - k0);
+            swap_rows(task.k, j0, j0 + cols(task.j));
+            for(int c = j0; c < j0 + cols(task.j); c++)
+                for(int r = k0; r < k0 + kr; r++)
+                    for(int p = k0; p < r; p++)
+                        a(r, c) -= a(r, p) * a(p, c);
+            break;
+        }
+        case hipsolver_tile_laswp:
+        {
+            swap_rows(task.k, 0, k0);
+            break;
+        }
+        case hipsolver_tile_geqrt:
+        {
+            int kr = std::min(kb, m_ - k0);
+            T*  f  = factors_.data() + size_t(task.t) * nb_ * nb_;
+            for(int c = k0; c < k0 + kr; c++)
+            {
+                // reflector H = I - tau * v * v^H with v(c) = 1, such that H^H * x = beta * e1
+                T      alpha = a(c, c);
+                double xnorm = 0;
+                for(int r = c + 1; r < m_; r++)
+                    xnorm += std::norm(a(r, c));
+
+                T t = 0;
+                if(xnorm > 0 || std::imag(complex<double>(alpha)) != 0)
+                {
+                    double beta = std::sqrt(std::norm(alpha) + xnorm);
+                    beta        = tile_real(alpha) >= 0 ? -beta : beta;
+                    t           = (T(beta) - alpha) / T(beta);
+                    for(int r = c + 1; r < m_; r++)
+                        a(r, c) /= alpha - T(beta);
+                    a(c, c) = beta;
+                }
+                tau[c] = t;
+
+                // apply H^H to the rest of the panel
+                for(int j = c + 1; j < k0 + kb; j++)
+                {
+                    T s = a(c, j);
+                    for(int r = c + 1; r < m_; r++)
+                        s += conj_if(true, a(r, c)) * a(r, j);
+                    s *= conj_if(true, t);
+                    a(c, j) -= s;
+                    for(int r = c + 1; r < m_; r++)
+                        a(r, j) -= s * a(r, c);
+                }
+            }
+
+            // triangular factor T of the block reflector H = I - V * T * V^H
+            for(int c = 0; c < kr; c++)
+            {
+                vector<T> w(c, T(0));
+                for(int q = 0; q < c; q++)
+                {
+                    T s = 0;
+                    for(int r = c + k0; r < m_; r++)
+                        s += conj_if(true, v(r, q + k0)) * v(r, c + k0);
+                    w[q] = s;
+                }
+                for(int q = 0; q < c; q++)
+                {
+                    T s = 0;
+                    for(int p = q; p < c; p++)
+                        s += f[q + size_t(p) * nb_] * w[p];
+                    f[q + size_t(c) * nb_] = -tau[c + k0] * s;
+                }
+                f[c + size_t(c) * nb_] = tau[c + k0];
+            }
+            break;
+        }
+        case hipsolver_tile_larfb:
+        {
+            // A = (I - V * T * V^H)^H * A = A - V * T^H * V^H * A
+            int j0 = task.j * nb_;
+            int kr = std::min(kb, m_ - k0);
+            T*  f  = factors_.data() + size_t(task.t) * nb_ * nb_;
+            for(int c = j0; c < j0 + cols(task.j); c++)
+            {
+                vector<T> w(kr, T(0)), y(kr, T(0));
+                for(int q = 0; q < kr; q++)
+                    for(int r = q + k0; r < m_; r++)
+                        w[q] += conj_if(true, v(r, q + k0)) * a(r, c);
+                for(int q = 0; q < kr; q++)
+                    for(int p = 0; p <= q; p++)
+                        y[q] += conj_if(true, f[p + size_t(q) * nb_]) * w[p];
+                for(int r = k0; r < m_; r++)
+                    for(int q = 0; q < kr && q + k0 <= r; q++)
+                        a(r, c) -= v(r, q + k0) * y[q];
+            }
+            break;
+        }
+        }
+    }
+
+    // element (r, c) of the unit lower trapezoidal matrix of Householder vectors
+    T v(int r, int c)
+    {
+        return r == c ? T(1) : a(r, c);
+    }
+
+    // applies the interchanges of panel k to columns c0 to c1 - 1
+    void swap_rows(int k, int c0, int c1)
+    {
+        int k0 = k * nb_;
+        for(int r = k0; r < k0 + std::min(cols(k), m_ - k0); r++)
+        {
+            int p = k0 + ipiv[r] - 1;
+            for(int c = c0; c < c1; c++)
+                std::swap(a(r, c), a(p, c));
+        }
+    }
+};
+
+template <typename T>
+vector<T> tile_matrix(tile_factorization fact, int m, int n)
+{
+    mt19937                           rng(m * 1000 + n);
+    uniform_real_distribution<double> dist(-1, 1);
+
+    vector<T> A(size_t(m) * n);
+    for(size_t i = 0; i < A.size(); i++)
+        A[i] = T(dist(rng)) + T(dist(rng)) * tile_unit(T(0));
+
+    // Hermitian positive definite matrix for Cholesky
+    if(fact == tile_potrf_lower || fact == tile_potrf_upper)
+        for(int j = 0; j < n; j++)
+        {
+            A[j + size_t(j) * m] = T(n + dist(rng));
+            for(int i = j + 1; i < n; i++)
+                A[j + size_t(i) * m] = conj_if(true, A[i + size_t(j) * m]);
+        }
+    return A;
+}
+
+template <typename T>
+hipsolver_tile_dag tile_dag(tile_factorization fact, int m, int n, int nb)
+{
+    int mt = (m - 1) / nb + 1;
+    int nt = (n - 1) / nb + 1;
+    if(fact == tile_getrf)
+        return hipsolver_getrf_tile_dag(mt, nt);
+    else if(fact == tile_geqrf)
+        return hipsolver_geqrf_tile_dag(mt, nt, 2);
+    else
+        return hipsolver_potrf_tile_dag(nt);
+}
+
+// checks the factors in A against the matrix A0 they were computed from
+template <typename T>
+void tile_check(tile_factorization fact,
+                int                m,
+                int                n,
+                int                nb,
+                const vector<T>&   A0,
+                const vector<T>&   A,
+                const vector<int>& ipiv,
+                const vector<T>&   tau)
+{
+    auto a = [&](int i, int j) { return A[i + size_t(j) * m]; };
+
+    vector<T> R(size_t(m) * n, T(0));
+    auto      r = [&](int i, int j) -> T& { return R[i + size_t(j) * m]; };
+
+    if(fact == tile_potrf_lower || fact == tile_potrf_upper)
+    {
+        // R = L * L^H
+        auto L = [&](int i, int j) {
+            if(i < j)
+                return T(0);
+            return fact == tile_potrf_upper ? conj_if(true, a(j, i)) : a(i, j);
+        };
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < n; i++)
+                for(int p = 0; p <= std::min(i, j); p++)
+                    r(i, j) += L(i, p) * conj_if(true, L(j, p));
+
+        // only the referenced triangle is compared
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < n; i++)
+                if(fact == tile_potrf_upper ? i <= j : i >= j)
+                    EXPECT_LE(std::abs(r(i, j) - A0[i + size_t(j) * m]), 1e-12 * n * n);
+        return;
+    }
+
+    int mn = std::min(m, n);
+    if(fact == tile_getrf)
+    {
+        // R = L * U, then the interchanges are undone in reverse order
+        // (the pivots of every panel are relative to its first row)
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < m; i++)
+                for(int p = 0; p <= std::min(std::min(i, j), mn - 1); p++)
+                    r(i, j) += (i == p ? T(1) : a(i, p)) * a(p, j);
+        for(int c = mn - 1; c >= 0; c--)
+            for(int j = 0; j < n; j++)
+                std::swap(r(c, j), r(c / nb * nb + ipiv[c] - 1, j));
+    }
+    else
+    {
+        // R = H(0) * H(1) * ... * H(mn - 1) * upper triangle of A
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i <= std::min(j, m - 1); i++)
+                r(i, j) = a(i, j);
+        for(int c = mn - 1; c >= 0; c--)
+            for(int j = 0; j < n; j++)
+            {
+                T s = r(c, j);
+                for(int i = c + 1; i < m; i++)
+                    s += conj_if(true, a(i, c)) * r(i, j);
+                s *= tau[c];
+                r(c, j) -= s;
+                for(int i = c + 1; i < m; i++)
+                    r(i, j) -= s * a(i, c);
+            }
+    }
+
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i < m; i++)
+            EXPECT_LE(std::abs(r(i, j) - A0[i + size_t(j) * m]), 1e-12 * (m + n));
+}
+
+template <typename T>
+void tile_scheduler_test(tile_factorization fact, int m, int n, int nb, int nstreams, int lookahead)
+{
+    if(fact == tile_potrf_lower || fact == tile_potrf_upper)
+        m = n;
+
+    hipsolver_tile_dag  dag  = tile_dag<T>(fact, m, n, nb);
+    hipsolver_tile_plan plan = hipsolver_tile_schedule(dag, nstreams, lookahead);
+
+    // every task is run once
+    vector<int> runs(dag.tasks.size(), 0);
+    for(const hipsolver_tile_op& op : plan.ops)
+    {
+        if(op.type == hipsolver_tile_op::run)
+            runs[op.arg]++;
+        EXPECT_LT(op.stream, nstreams);
+    }
+    for(int count : runs)
+        EXPECT_EQ(count, 1);
+
+    // reference: the tasks in the order they were added
+    vector<T>           A0 = tile_matrix<T>(fact, m, n);
+    vector<T>           S  = A0;
+    tile_host_device<T> seq(fact, m, n, S, nb, 1, 0);
+    seq.run_sequential(dag);
+    tile_check(fact, m, n, nb, A0, S, seq.ipiv, seq.tau);
+
+    for(int seed = 0; seed < tile_seeds; seed++)
+    {
+        vector<T>           A = A0;
+        tile_host_device<T> dev(fact, m, n, A, nb, nstreams, seed);
+        ASSERT_EQ(hipsolver_tile_execute(dev, dag, plan), rocblas_status_success);
+
+        // any order consistent with the dependencies gives the same result
+        EXPECT_EQ(A, S);
+        EXPECT_EQ(dev.ipiv, seq.ipiv);
+        EXPECT_EQ(dev.tau, seq.tau);
+        EXPECT_EQ(dev.tile_info, seq.tile_info);
+    }
+}
+
+class TILE_SCHEDULER : public ::TestWithParam<tile_scheduler_tuple>
+{
+protected:
+    TILE_SCHEDULER() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        vector<int> size    = std::get<0>(GetParam());
+        vector<int> streams = std::get<1>(GetParam());
+
+        for(tile_factorization fact : {tile_potrf_lower, tile_potrf_upper, tile_getrf, tile_geqrf})
+            tile_scheduler_test<T>(fact, size[0], size[1], size[2], streams[0], streams[1]);
+    }
+};
+
+TEST_P(TILE_SCHEDULER, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(TILE_SCHEDULER, __double_complex)
+{
+    run_tests<complex<double>>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         TILE_SCHEDULER,
+                         Combine(ValuesIn(size_range), ValuesIn(stream_range)));
+
+#endif
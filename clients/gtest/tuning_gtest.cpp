@@ -0,0 +1,149 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+
+#include "clientcommon.hpp"
+#include <cstdlib>
+#include <fstream>
+
+using namespace std;
+
+/* The tests in this file load tuning files, as written by hipsolver-tune, into
+   a handle with hipsolverLoadTuningFile and through the HIPSOLVER_TUNING_FILE
+   environment variable of hipsolverCreate. A file that is not valid as a whole
+   must leave the settings of the handle as they were. */
+
+#if !defined(__HIP_PLATFORM_NVCC__)
+
+// writes contents to a file in the temporary directory of the tests and returns its path
+string tuning_file(const char* name, const string& contents)
+{
+    string   path = testing::TempDir() + name;
+    ofstream file(path);
+    file << contents;
+    return path;
+}
+
+int tuning_threshold(hipsolverHandle_t          handle,
+                     hipsolverDispatchRoutine_t routine,
+                     hipsolverPrecision_t       precision)
+{
+    int n = -1;
+    EXPECT_EQ(hipsolverGetDispatchThreshold(handle, routine, precision, &n),
+              HIPSOLVER_STATUS_SUCCESS);
+    return n;
+}
+
+int tuning_blocksize(hipsolverHandle_t handle)
+{
+    int nb = -1;
+    EXPECT_EQ(hipsolverGetTileBlockSize(handle, &nb), HIPSOLVER_STATUS_SUCCESS);
+    return nb;
+}
+
+TEST(TUNING, __load)
+{
+    hipsolver_local_handle handle;
+
+    int potrf_s = tuning_threshold(handle, HIPSOLVER_DISPATCH_POTRF, HIPSOLVER_PRECISION_SINGLE);
+
+    string path = tuning_file("hipsolver_tuning_load.txt",
+                              "# comment\n"
+                              "\n"
+                              "hipsolver_tuning 1\n"
+                              "dispatch getrf z 17   # trailing comment\n"
+                              "  dispatch getrs d 0\n"
+                              "tile_blocksize 384\n");
+    ASSERT_EQ(hipsolverLoadTuningFile(handle, path.c_str()), HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_EQ(
+        tuning_threshold(handle, HIPSOLVER_DISPATCH_GETRF, HIPSOLVER_PRECISION_DOUBLE_COMPLEX), 17);
+    EXPECT_EQ(tuning_threshold(handle, HIPSOLVER_DISPATCH_GETRS, HIPSOLVER_PRECISION_DOUBLE), 0);
+    EXPECT_EQ(tuning_blocksize(handle), 384);
+
+    // settings missing from the file keep their values
+    EXPECT_EQ(tuning_threshold(handle, HIPSOLVER_DISPATCH_POTRF, HIPSOLVER_PRECISION_SINGLE),
+              potrf_s);
+
+    remove(path.c_str());
+}
+
+TEST(TUNING, __bad_files)
+{
+    hipsolver_local_handle handle;
+
+    ASSERT_EQ(hipsolverSetTileBlockSize(handle, 256), HIPSOLVER_STATUS_SUCCESS);
+    int getrf_s = tuning_threshold(handle, HIPSOLVER_DISPATCH_GETRF, HIPSOLVER_PRECISION_SINGLE);
+
+    // each file changes getrf s before its error, which must not be applied
+    const char* files[] = {
+        "dispatch getrf s 5\n", // no version
+        "hipsolver_tuning 2\ndispatch getrf s 5\n", // other version
+        "hipsolver_tuning 1\ndispatch getrf s 5\nblocksize 64\n", // unknown key
+        "hipsolver_tuning 1\ndispatch getrf s 5\ndispatch geqrf s 5\n", // unknown routine
+        "hipsolver_tuning 1\ndispatch getrf s 5\ndispatch getrf h 5\n", // unknown precision
+        "hipsolver_tuning 1\ndispatch getrf s 5\ndispatch getrf d -1\n", // negative threshold
+        "hipsolver_tuning 1\ndispatch getrf s 5\ndispatch getrf d\n", // missing threshold
+        "hipsolver_tuning 1\ndispatch getrf s 5\ntile_blocksize 0\n", // empty tiles
+        "hipsolver_tuning 1\ndispatch getrf s 5 6\n", // trailing value
+    };
+    for(const char* contents : files)
+    {
+        string path = tuning_file("hipsolver_tuning_bad.txt", contents);
+        EXPECT_EQ(hipsolverLoadTuningFile(handle, path.c_str()), HIPSOLVER_STATUS_INVALID_VALUE)
+            << contents;
+        EXPECT_EQ(tuning_threshold(handle, HIPSOLVER_DISPATCH_GETRF, HIPSOLVER_PRECISION_SINGLE),
+                  getrf_s)
+            << contents;
+        EXPECT_EQ(tuning_blocksize(handle), 256) << contents;
+        remove(path.c_str());
+    }
+
+    // bad arguments
+    string missing = testing::TempDir() + "hipsolver_tuning_missing.txt";
+    EXPECT_EQ(hipsolverLoadTuningFile(handle, missing.c_str()), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverLoadTuningFile(handle, nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverLoadTuningFile(nullptr, missing.c_str()), HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipsolverSetTileBlockSize(nullptr, 256), HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipsolverSetTileBlockSize(handle, 0), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverGetTileBlockSize(nullptr, nullptr), HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipsolverGetTileBlockSize(handle, nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+TEST(TUNING, __create)
+{
+    const char* previous = getenv("HIPSOLVER_TUNING_FILE");
+    string      saved    = previous ? previous : "";
+
+    // a valid file is loaded by hipsolverCreate
+    string path = tuning_file("hipsolver_tuning_create.txt",
+                              "hipsolver_tuning 1\ndispatch potrf c 3\ntile_blocksize 640\n");
+    setenv("HIPSOLVER_TUNING_FILE", path.c_str(), 1);
+    {
+        hipsolver_local_handle handle;
+        EXPECT_EQ(
+            tuning_threshold(handle, HIPSOLVER_DISPATCH_POTRF, HIPSOLVER_PRECISION_SINGLE_COMPLEX),
+            3);
+        EXPECT_EQ(tuning_blocksize(handle), 640);
+    }
+
+    // an invalid file is ignored, so that handles can still be created
+    tuning_file("hipsolver_tuning_create.txt", "hipsolver_tuning 1\ntile_blocksize 640 640\n");
+    {
+        hipsolverHandle_t handle;
+        ASSERT_EQ(hipsolverCreate(&handle), HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_EQ(tuning_blocksize(handle), 512);
+        EXPECT_EQ(hipsolverDestroy(handle), HIPSOLVER_STATUS_SUCCESS);
+    }
+    remove(path.c_str());
+
+    if(previous)
+        setenv("HIPSOLVER_TUNING_FILE", saved.c_str(), 1);
+    else
+        unsetenv("HIPSOLVER_TUNING_FILE");
+}
+
+#endif
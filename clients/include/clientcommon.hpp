@@ -9,7 +9,9 @@
 #include "../rocsolvercommon/rocsolver_arguments.hpp"
 #include "../rocsolvercommon/rocsolver_test.hpp"
 
+#include "device_init.hpp"
 #include "hipsolver.hpp"
 #include "lapack_host_reference.hpp"
+#include "reference_cache.hpp"
 
 using namespace std;
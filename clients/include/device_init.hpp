@@ -0,0 +1,267 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "../rocblascommon/rocblas_vector.hpp"
+#include "hipsolver.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#if !defined(__HIP_PLATFORM_NVCC__)
+#include <hip/hip_runtime.h>
+#endif
+
+/*
+ * ===========================================================================
+ *    Generation of the test matrices on the device, used by hipsolver-bench
+ *    with --device_init, so that large inputs do not have to be built on the
+ *    host and copied. Each element is computed on its own from the
+ *    counter-based generator of rocblas_init, which takes the next stream
+ *    for every generation as a host fill does; a uniform matrix is thus the
+ *    same as the one that rocblas_init would give. The generators are
+ *        uniform:   entries in [1, 10], as rocblas_init;
+ *        dominant:  uniform, with 15 max(m, n) added to the diagonal, so
+ *                   that rows and columns are strictly diagonally dominant,
+ *                   and optionally with the order of the rows reversed;
+ *        hpd:       hermitian, from the uniform upper triangle, with 15 n
+ *                   added to the (real) diagonal, so that it is positive
+ *                   definite;
+ *        spectrum:  H diag(d) H, with H = I - 2 v v^H / n a householder
+ *                   reflector, |v_k| = 1, and the eigenvalues
+ *                   d_k = cond^(-k / (n - 1)).
+ *    The clients of the cuSOLVER backend are not compiled as HIP, so there
+ *    the matrices are generated on the host with the same functions and then
+ *    copied.
+ * ===========================================================================
+ */
+
+// entry i of a vector of signs of the counter-based generator, |v_i| = 1
+template <typename S, bool COMPLEX>
+HIPSOLVER_HOST_DEVICE inline void
+    device_init_sign(uint64_t seed, int i, int b, uint32_t stream, S& re, S& im)
+{
+    uint32_t r0, r1;
+    hipsolver_philox(seed, i, 0, b, stream, r0, r1);
+    S scale = COMPLEX ? S(0.70710678118654752) : S(1);
+    re      = (r0 >> 31) ? -scale : scale;
+    im      = COMPLEX ? ((r1 >> 31) ? -scale : scale) : S(0);
+}
+
+template <typename S>
+struct device_init_uniform_gen
+{
+    uint64_t seed;
+    uint32_t stream;
+
+    HIPSOLVER_HOST_DEVICE void operator()(int i, int j, int b, S& re, S& im) const
+    {
+        uint32_t r0, r1;
+        hipsolver_philox(seed, i, j, b, stream, r0, r1);
+        re = S(hipsolver_philox_value(r0));
+        im = S(hipsolver_philox_value(r1));
+    }
+};
+
+template <typename S>
+struct device_init_dominant_gen
+{
+    device_init_uniform_gen<S> uniform;
+    S                          shift;
+    int                        flip; // if > 0, row i is row flip - 1 - i
+
+    HIPSOLVER_HOST_DEVICE void operator()(int i, int j, int b, S& re, S& im) const
+    {
+        if(flip > 0)
+            i = flip - 1 - i;
+        uniform(i, j, b, re, im);
+        if(i == j)
+            re += shift;
+    }
+};
+
+template <typename S>
+struct device_init_hpd_gen
+{
+    device_init_uniform_gen<S> uniform;
+    S                          shift;
+
+    HIPSOLVER_HOST_DEVICE void operator()(int i, int j, int b, S& re, S& im) const
+    {
+        if(i <= j)
+            uniform(i, j, b, re, im);
+        else
+        {
+            uniform(j, i, b, re, im);
+            im = -im;
+        }
+        if(i == j)
+        {
+            re += shift;
+            im = 0;
+        }
+    }
+};
+
+template <typename S, bool COMPLEX>
+struct device_init_spectrum_gen
+{
+    uint64_t seed;
+    uint32_t stream;
+    int      n;
+    S        rate; // d_k = exp(-rate k)
+    S        coef; // 4 sum(d) / n^2
+
+    HIPSOLVER_HOST_DEVICE void operator()(int i, int j, int b, S& re, S& im) const
+    {
+        // A(i, j) = d_i delta_ij + v_i conj(v_j) (4 sum(d) / n^2 - 2 (d_i + d_j) / n)
+        S ri, ii, rj, ij;
+        device_init_sign<S, COMPLEX>(seed, i, b, stream, ri, ii);
+        device_init_sign<S, COMPLEX>(seed, j, b, stream, rj, ij);
+        S di = exp(-rate * i), dj = exp(-rate * j);
+        S c  = coef - 2 * (di + dj) / n;
+
+        re = (ri * rj + ii * ij) * c + (i == j ? di : S(0));
+        im = (ii * rj - ri * ij) * c;
+    }
+};
+
+// the matrix b of a strided or a pointer-array batch
+template <typename T>
+HIPSOLVER_HOST_DEVICE inline T* device_init_batch(T* A, int b, rocblas_stride stride)
+{
+    return A + b * stride;
+}
+
+template <typename T>
+HIPSOLVER_HOST_DEVICE inline T* device_init_batch(T** A, int b, rocblas_stride stride)
+{
+    return A[b];
+}
+
+#if !defined(__HIP_PLATFORM_NVCC__)
+template <typename T, typename U, typename G>
+__global__ void device_init_kernel(G gen, int m, int n, U A, int lda, rocblas_stride stride, int bc)
+{
+    using S = real_t<T>;
+
+    int i = blockIdx.x * blockDim.x + threadIdx.x;
+    int j = blockIdx.y * blockDim.y + threadIdx.y;
+    if(i < m && j < n)
+    {
+        for(int b = blockIdx.z; b < bc; b += gridDim.z)
+        {
+            S  re, im;
+            S* a = (S*)(device_init_batch(A, b, stride) + i + size_t(j) * lda);
+            gen(i, j, b, re, im);
+            a[0] = re;
+            if(is_complex<T>)
+                a[1] = im;
+        }
+    }
+}
+#endif
+
+// fills the m-by-n matrices of dA with gen, on the stream of handle
+template <typename T, typename V, typename G>
+void device_init_launch(hipsolverHandle_t handle, G gen, int m, int n, V& dA, int lda)
+{
+    using S = real_t<T>;
+
+    int bc = dA.batch_count();
+    if(m <= 0 || n <= 0 || bc <= 0)
+        return;
+
+#if defined(__HIP_PLATFORM_NVCC__)
+    std::vector<T> hA(size_t(lda) * n);
+    for(int b = 0; b < bc; b++)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(hA.data(), dA[b], sizeof(T) * hA.size(), hipMemcpyDeviceToHost));
+        for(int j = 0; j < n; j++)
+        {
+            for(int i = 0; i < m; i++)
+            {
+                S  re, im;
+                S* a = (S*)(hA.data() + i + size_t(j) * lda);
+                gen(i, j, b, re, im);
+                a[0] = re;
+                if(is_complex<T>)
+                    a[1] = im;
+            }
+        }
+        CHECK_HIP_ERROR(hipMemcpy(dA[b], hA.data(), sizeof(T) * hA.size(), hipMemcpyHostToDevice));
+    }
+#else
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+
+    const int bx = 32, by = 8;
+    dim3      grid((m - 1) / bx + 1, (n - 1) / by + 1, std::min(bc, 65535));
+    dim3      threads(bx, by, 1);
+    hipLaunchKernelGGL((device_init_kernel<T>),
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       gen,
+                       m,
+                       n,
+                       dA.data(),
+                       lda,
+                       dA.stride(),
+                       bc);
+    CHECK_HIP_ERROR(hipGetLastError());
+#endif
+}
+
+/*! \brief  fills the m-by-n matrices of dA with entries in [1, 10], as rocblas_init */
+template <typename T, typename V>
+void device_init_uniform(hipsolverHandle_t handle, int m, int n, V& dA, int lda)
+{
+    device_init_uniform_gen<real_t<T>> gen{hipsolver_counter_seed, hipsolver_counter_stream++};
+    device_init_launch<T>(handle, gen, m, n, dA, lda);
+}
+
+/*! \brief  fills the m-by-n matrices of dA with strictly diagonally dominant matrices;
+ * with flip, the order of their rows is reversed, so that a factorization must pivot */
+template <typename T, typename V>
+void device_init_dominant(hipsolverHandle_t handle, int m, int n, V& dA, int lda, bool flip = false)
+{
+    using S = real_t<T>;
+
+    device_init_dominant_gen<S> gen{{hipsolver_counter_seed, hipsolver_counter_stream++},
+                                    S(15) * std::max(m, n),
+                                    flip ? m : 0};
+    device_init_launch<T>(handle, gen, m, n, dA, lda);
+}
+
+/*! \brief  fills the n-by-n matrices of dA with hermitian positive definite matrices */
+template <typename T, typename V>
+void device_init_hpd(hipsolverHandle_t handle, int n, V& dA, int lda)
+{
+    using S = real_t<T>;
+
+    device_init_hpd_gen<S> gen{{hipsolver_counter_seed, hipsolver_counter_stream++}, S(15) * n};
+    device_init_launch<T>(handle, gen, n, n, dA, lda);
+}
+
+/*! \brief  fills the n-by-n matrices of dA with hermitian matrices of eigenvalues
+ * cond^(-k / (n - 1)), k = 0, ..., n - 1 */
+template <typename T, typename V>
+void device_init_spectrum(hipsolverHandle_t handle, int n, V& dA, int lda, double cond)
+{
+    using S = real_t<T>;
+
+    double rate = n > 1 ? std::log(cond) / (n - 1) : 0;
+    double sum  = 0;
+    for(int k = 0; k < n; k++)
+        sum += std::exp(-rate * k);
+
+    device_init_spectrum_gen<S, is_complex<T>> gen{hipsolver_counter_seed,
+                                                   hipsolver_counter_stream++,
+                                                   n,
+                                                   S(rate),
+                                                   S(4 * sum / (double(n) * n))};
+    device_init_launch<T>(handle, gen, n, n, dA, lda);
+}
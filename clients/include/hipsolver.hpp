@@ -1125,6 +1125,265 @@ inline hipsolverStatus_t hipsolver_ormtr_unmtr(bool                    FORTRAN,
 }
 /********************************************************/
 
+/******************** CHOLQR2 & CHOLQR3 ********************/
+// normal
+inline hipsolverStatus_t hipsolver_cholqr_bufferSize(bool              FORTRAN,
+                                                     bool              SHIFTED,
+                                                     hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     float*            A,
+                                                     int               lda,
+                                                     float*            R,
+                                                     int               ldr,
+                                                     int*              lwork)
+{
+    if(!FORTRAN && !SHIFTED)
+        return hipsolverScholqr2_bufferSize(handle, m, n, A, lda, R, ldr, lwork);
+    else if(!FORTRAN)
+        return hipsolverScholqr3_bufferSize(handle, m, n, A, lda, R, ldr, lwork);
+    else if(!SHIFTED)
+        return hipsolverScholqr2_bufferSizeFortran(handle, m, n, A, lda, R, ldr, lwork);
+    else
+        return hipsolverScholqr3_bufferSizeFortran(handle, m, n, A, lda, R, ldr, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_cholqr_bufferSize(bool              FORTRAN,
+                                                     bool              SHIFTED,
+                                                     hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     double*           A,
+                                                     int               lda,
+                                                     double*           R,
+                                                     int               ldr,
+                                                     int*              lwork)
+{
+    if(!FORTRAN && !SHIFTED)
+        return hipsolverDcholqr2_bufferSize(handle, m, n, A, lda, R, ldr, lwork);
+    else if(!FORTRAN)
+        return hipsolverDcholqr3_bufferSize(handle, m, n, A, lda, R, ldr, lwork);
+    else if(!SHIFTED)
+        return hipsolverDcholqr2_bufferSizeFortran(handle, m, n, A, lda, R, ldr, lwork);
+    else
+        return hipsolverDcholqr3_bufferSizeFortran(handle, m, n, A, lda, R, ldr, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_cholqr_bufferSize(bool              FORTRAN,
+                                                     bool              SHIFTED,
+                                                     hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     hipsolverComplex* A,
+                                                     int               lda,
+                                                     hipsolverComplex* R,
+                                                     int               ldr,
+                                                     int*              lwork)
+{
+    if(!FORTRAN && !SHIFTED)
+        return hipsolverCcholqr2_bufferSize(
+            handle, m, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)R, ldr, lwork);
+    else if(!FORTRAN)
+        return hipsolverCcholqr3_bufferSize(
+            handle, m, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)R, ldr, lwork);
+    else if(!SHIFTED)
+        return hipsolverCcholqr2_bufferSizeFortran(
+            handle, m, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)R, ldr, lwork);
+    else
+        return hipsolverCcholqr3_bufferSizeFortran(
+            handle, m, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)R, ldr, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_cholqr_bufferSize(bool                    FORTRAN,
+                                                     bool                    SHIFTED,
+                                                     hipsolverHandle_t       handle,
+                                                     int                     m,
+                                                     int                     n,
+                                                     hipsolverDoubleComplex* A,
+                                                     int                     lda,
+                                                     hipsolverDoubleComplex* R,
+                                                     int                     ldr,
+                                                     int*                    lwork)
+{
+    if(!FORTRAN && !SHIFTED)
+        return hipsolverZcholqr2_bufferSize(
+            handle, m, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)R, ldr, lwork);
+    else if(!FORTRAN)
+        return hipsolverZcholqr3_bufferSize(
+            handle, m, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)R, ldr, lwork);
+    else if(!SHIFTED)
+        return hipsolverZcholqr2_bufferSizeFortran(
+            handle, m, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)R, ldr, lwork);
+    else
+        return hipsolverZcholqr3_bufferSizeFortran(
+            handle, m, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)R, ldr, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_cholqr(bool              FORTRAN,
+                                          bool              SHIFTED,
+                                          hipsolverHandle_t handle,
+                                          int               m,
+                                          int               n,
+                                          float*            A,
+                                          int               lda,
+                                          float*            R,
+                                          int               ldr,
+                                          float*            work,
+                                          int               lwork,
+                                          int*              info)
+{
+    if(!FORTRAN && !SHIFTED)
+        return hipsolverScholqr2(handle, m, n, A, lda, R, ldr, work, lwork, info);
+    else if(!FORTRAN)
+        return hipsolverScholqr3(handle, m, n, A, lda, R, ldr, work, lwork, info);
+    else if(!SHIFTED)
+        return hipsolverScholqr2Fortran(handle, m, n, A, lda, R, ldr, work, lwork, info);
+    else
+        return hipsolverScholqr3Fortran(handle, m, n, A, lda, R, ldr, work, lwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_cholqr(bool              FORTRAN,
+                                          bool              SHIFTED,
+                                          hipsolverHandle_t handle,
+                                          int               m,
+                                          int               n,
+                                          double*           A,
+                                          int               lda,
+                                          double*           R,
+                                          int               ldr,
+                                          double*           work,
+                                          int               lwork,
+                                          int*              info)
+{
+    if(!FORTRAN && !SHIFTED)
+        return hipsolverDcholqr2(handle, m, n, A, lda, R, ldr, work, lwork, info);
+    else if(!FORTRAN)
+        return hipsolverDcholqr3(handle, m, n, A, lda, R, ldr, work, lwork, info);
+    else if(!SHIFTED)
+        return hipsolverDcholqr2Fortran(handle, m, n, A, lda, R, ldr, work, lwork, info);
+    else
+        return hipsolverDcholqr3Fortran(handle, m, n, A, lda, R, ldr, work, lwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_cholqr(bool              FORTRAN,
+                                          bool              SHIFTED,
+                                          hipsolverHandle_t handle,
+                                          int               m,
+                                          int               n,
+                                          hipsolverComplex* A,
+                                          int               lda,
+                                          hipsolverComplex* R,
+                                          int               ldr,
+                                          hipsolverComplex* work,
+                                          int               lwork,
+                                          int*              info)
+{
+    if(!FORTRAN && !SHIFTED)
+        return hipsolverCcholqr2(handle,
+                                 m,
+                                 n,
+                                 (hipFloatComplex*)A,
+                                 lda,
+                                 (hipFloatComplex*)R,
+                                 ldr,
+                                 (hipFloatComplex*)work,
+                                 lwork,
+                                 info);
+    else if(!FORTRAN)
+        return hipsolverCcholqr3(handle,
+                                 m,
+                                 n,
+                                 (hipFloatComplex*)A,
+                                 lda,
+                                 (hipFloatComplex*)R,
+                                 ldr,
+                                 (hipFloatComplex*)work,
+                                 lwork,
+                                 info);
+    else if(!SHIFTED)
+        return hipsolverCcholqr2Fortran(handle,
+                                        m,
+                                        n,
+                                        (hipFloatComplex*)A,
+                                        lda,
+                                        (hipFloatComplex*)R,
+                                        ldr,
+                                        (hipFloatComplex*)work,
+                                        lwork,
+                                        info);
+    else
+        return hipsolverCcholqr3Fortran(handle,
+                                        m,
+                                        n,
+                                        (hipFloatComplex*)A,
+                                        lda,
+                                        (hipFloatComplex*)R,
+                                        ldr,
+                                        (hipFloatComplex*)work,
+                                        lwork,
+                                        info);
+}
+
+inline hipsolverStatus_t hipsolver_cholqr(bool                    FORTRAN,
+                                          bool                    SHIFTED,
+                                          hipsolverHandle_t       handle,
+                                          int                     m,
+                                          int                     n,
+                                          hipsolverDoubleComplex* A,
+                                          int                     lda,
+                                          hipsolverDoubleComplex* R,
+                                          int                     ldr,
+                                          hipsolverDoubleComplex* work,
+                                          int                     lwork,
+                                          int*                    info)
+{
+    if(!FORTRAN && !SHIFTED)
+        return hipsolverZcholqr2(handle,
+                                 m,
+                                 n,
+                                 (hipDoubleComplex*)A,
+                                 lda,
+                                 (hipDoubleComplex*)R,
+                                 ldr,
+                                 (hipDoubleComplex*)work,
+                                 lwork,
+                                 info);
+    else if(!FORTRAN)
+        return hipsolverZcholqr3(handle,
+                                 m,
+                                 n,
+                                 (hipDoubleComplex*)A,
+                                 lda,
+                                 (hipDoubleComplex*)R,
+                                 ldr,
+                                 (hipDoubleComplex*)work,
+                                 lwork,
+                                 info);
+    else if(!SHIFTED)
+        return hipsolverZcholqr2Fortran(handle,
+                                        m,
+                                        n,
+                                        (hipDoubleComplex*)A,
+                                        lda,
+                                        (hipDoubleComplex*)R,
+                                        ldr,
+                                        (hipDoubleComplex*)work,
+                                        lwork,
+                                        info);
+    else
+        return hipsolverZcholqr3Fortran(handle,
+                                        m,
+                                        n,
+                                        (hipDoubleComplex*)A,
+                                        lda,
+                                        (hipDoubleComplex*)R,
+                                        ldr,
+                                        (hipDoubleComplex*)work,
+                                        lwork,
+                                        info);
+}
+/********************************************************/
+
 /******************** GEBRD ********************/
 // normal and strided_batched
 inline hipsolverStatus_t hipsolver_gebrd_bufferSize(
@@ -1317,443 +1576,873 @@ inline hipsolverStatus_t hipsolver_gebrd(bool                    FORTRAN,
 }
 /********************************************************/
 
-/******************** GEQRF ********************/
+/******************** GELS ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_geqrf_bufferSize(
-    bool FORTRAN, hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+inline hipsolverStatus_t hipsolver_gels_bufferSize(bool              FORTRAN,
+                                                   hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   float*            A,
+                                                   int               lda,
+                                                   float*            B,
+                                                   int               ldb,
+                                                   float*            X,
+                                                   int               ldx,
+                                                   size_t*           lwork)
 {
     if(!FORTRAN)
-        return hipsolverSgeqrf_bufferSize(handle, m, n, A, lda, lwork);
+        return hipsolverSSgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork);
     else
-        return hipsolverSgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
+        return hipsolverSSgels_bufferSizeFortran(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork);
 }
 
-inline hipsolverStatus_t hipsolver_geqrf_bufferSize(
-    bool FORTRAN, hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+inline hipsolverStatus_t hipsolver_gels_bufferSize(bool              FORTRAN,
+                                                   hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           A,
+                                                   int               lda,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   double*           X,
+                                                   int               ldx,
+                                                   size_t*           lwork)
 {
     if(!FORTRAN)
-        return hipsolverDgeqrf_bufferSize(handle, m, n, A, lda, lwork);
+        return hipsolverDDgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork);
     else
-        return hipsolverDgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
+        return hipsolverDDgels_bufferSizeFortran(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork);
 }
 
-inline hipsolverStatus_t hipsolver_geqrf_bufferSize(
-    bool FORTRAN, hipsolverHandle_t handle, int m, int n, hipsolverComplex* A, int lda, int* lwork)
+inline hipsolverStatus_t hipsolver_gels_bufferSize(bool              FORTRAN,
+                                                   hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipsolverComplex* A,
+                                                   int               lda,
+                                                   hipsolverComplex* B,
+                                                   int               ldb,
+                                                   hipsolverComplex* X,
+                                                   int               ldx,
+                                                   size_t*           lwork)
 {
     if(!FORTRAN)
-        return hipsolverCgeqrf_bufferSize(handle, m, n, (hipFloatComplex*)A, lda, lwork);
+        return hipsolverCCgels_bufferSize(handle,
+                                          m,
+                                          n,
+                                          nrhs,
+                                          (hipFloatComplex*)A,
+                                          lda,
+                                          (hipFloatComplex*)B,
+                                          ldb,
+                                          (hipFloatComplex*)X,
+                                          ldx,
+                                          lwork);
     else
-        return hipsolverCgeqrf_bufferSizeFortran(handle, m, n, (hipFloatComplex*)A, lda, lwork);
+        return hipsolverCCgels_bufferSizeFortran(handle,
+                                                 m,
+                                                 n,
+                                                 nrhs,
+                                                 (hipFloatComplex*)A,
+                                                 lda,
+                                                 (hipFloatComplex*)B,
+                                                 ldb,
+                                                 (hipFloatComplex*)X,
+                                                 ldx,
+                                                 lwork);
 }
 
-inline hipsolverStatus_t hipsolver_geqrf_bufferSize(bool                    FORTRAN,
-                                                    hipsolverHandle_t       handle,
-                                                    int                     m,
-                                                    int                     n,
-                                                    hipsolverDoubleComplex* A,
-                                                    int                     lda,
-                                                    int*                    lwork)
+inline hipsolverStatus_t hipsolver_gels_bufferSize(bool                    FORTRAN,
+                                                   hipsolverHandle_t       handle,
+                                                   int                     m,
+                                                   int                     n,
+                                                   int                     nrhs,
+                                                   hipsolverDoubleComplex* A,
+                                                   int                     lda,
+                                                   hipsolverDoubleComplex* B,
+                                                   int                     ldb,
+                                                   hipsolverDoubleComplex* X,
+                                                   int                     ldx,
+                                                   size_t*                 lwork)
 {
     if(!FORTRAN)
-        return hipsolverZgeqrf_bufferSize(handle, m, n, (hipDoubleComplex*)A, lda, lwork);
+        return hipsolverZZgels_bufferSize(handle,
+                                          m,
+                                          n,
+                                          nrhs,
+                                          (hipDoubleComplex*)A,
+                                          lda,
+                                          (hipDoubleComplex*)B,
+                                          ldb,
+                                          (hipDoubleComplex*)X,
+                                          ldx,
+                                          lwork);
     else
-        return hipsolverZgeqrf_bufferSizeFortran(handle, m, n, (hipDoubleComplex*)A, lda, lwork);
+        return hipsolverZZgels_bufferSizeFortran(handle,
+                                                 m,
+                                                 n,
+                                                 nrhs,
+                                                 (hipDoubleComplex*)A,
+                                                 lda,
+                                                 (hipDoubleComplex*)B,
+                                                 ldb,
+                                                 (hipDoubleComplex*)X,
+                                                 ldx,
+                                                 lwork);
 }
 
-inline hipsolverStatus_t hipsolver_geqrf(bool              FORTRAN,
-                                         hipsolverHandle_t handle,
-                                         int               m,
-                                         int               n,
-                                         float*            A,
-                                         int               lda,
-                                         int               stA,
-                                         float*            tau,
-                                         int               stT,
-                                         float*            work,
-                                         int               lwork,
-                                         int*              info,
-                                         int               bc)
+inline hipsolverStatus_t hipsolver_gels(bool              FORTRAN,
+                                        hipsolverHandle_t handle,
+                                        int               m,
+                                        int               n,
+                                        int               nrhs,
+                                        float*            A,
+                                        int               lda,
+                                        int               stA,
+                                        float*            B,
+                                        int               ldb,
+                                        int               stB,
+                                        float*            X,
+                                        int               ldx,
+                                        int               stX,
+                                        void*             work,
+                                        size_t            lwork,
+                                        int*              niters,
+                                        int*              info,
+                                        int               bc)
 {
     if(!FORTRAN)
-        return hipsolverSgeqrf(handle, m, n, A, lda, tau, work, lwork, info);
+        return hipsolverSSgels(
+            handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info);
     else
-        return hipsolverSgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info);
+        return hipsolverSSgelsFortran(
+            handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info);
 }
 
-inline hipsolverStatus_t hipsolver_geqrf(bool              FORTRAN,
-                                         hipsolverHandle_t handle,
-                                         int               m,
-                                         int               n,
-                                         double*           A,
-                                         int               lda,
-                                         int               stA,
-                                         double*           tau,
-                                         int               stT,
-                                         double*           work,
-                                         int               lwork,
-                                         int*              info,
-                                         int               bc)
+inline hipsolverStatus_t hipsolver_gels(bool              FORTRAN,
+                                        hipsolverHandle_t handle,
+                                        int               m,
+                                        int               n,
+                                        int               nrhs,
+                                        double*           A,
+                                        int               lda,
+                                        int               stA,
+                                        double*           B,
+                                        int               ldb,
+                                        int               stB,
+                                        double*           X,
+                                        int               ldx,
+                                        int               stX,
+                                        void*             work,
+                                        size_t            lwork,
+                                        int*              niters,
+                                        int*              info,
+                                        int               bc)
 {
     if(!FORTRAN)
-        return hipsolverDgeqrf(handle, m, n, A, lda, tau, work, lwork, info);
+        return hipsolverDDgels(
+            handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info);
     else
-        return hipsolverDgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info);
+        return hipsolverDDgelsFortran(
+            handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info);
 }
 
-inline hipsolverStatus_t hipsolver_geqrf(bool              FORTRAN,
-                                         hipsolverHandle_t handle,
-                                         int               m,
-                                         int               n,
-                                         hipsolverComplex* A,
-                                         int               lda,
-                                         int               stA,
-                                         hipsolverComplex* tau,
-                                         int               stT,
-                                         hipsolverComplex* work,
-                                         int               lwork,
-                                         int*              info,
-                                         int               bc)
+inline hipsolverStatus_t hipsolver_gels(bool              FORTRAN,
+                                        hipsolverHandle_t handle,
+                                        int               m,
+                                        int               n,
+                                        int               nrhs,
+                                        hipsolverComplex* A,
+                                        int               lda,
+                                        int               stA,
+                                        hipsolverComplex* B,
+                                        int               ldb,
+                                        int               stB,
+                                        hipsolverComplex* X,
+                                        int               ldx,
+                                        int               stX,
+                                        void*             work,
+                                        size_t            lwork,
+                                        int*              niters,
+                                        int*              info,
+                                        int               bc)
 {
     if(!FORTRAN)
-        return hipsolverCgeqrf(handle,
+        return hipsolverCCgels(handle,
                                m,
                                n,
+                               nrhs,
                                (hipFloatComplex*)A,
                                lda,
-                               (hipFloatComplex*)tau,
-                               (hipFloatComplex*)work,
+                               (hipFloatComplex*)B,
+                               ldb,
+                               (hipFloatComplex*)X,
+                               ldx,
+                               work,
                                lwork,
+                               niters,
                                info);
     else
-        return hipsolverCgeqrfFortran(handle,
+        return hipsolverCCgelsFortran(handle,
                                       m,
                                       n,
+                                      nrhs,
                                       (hipFloatComplex*)A,
                                       lda,
-                                      (hipFloatComplex*)tau,
-                                      (hipFloatComplex*)work,
+                                      (hipFloatComplex*)B,
+                                      ldb,
+                                      (hipFloatComplex*)X,
+                                      ldx,
+                                      work,
                                       lwork,
+                                      niters,
                                       info);
 }
 
-inline hipsolverStatus_t hipsolver_geqrf(bool                    FORTRAN,
-                                         hipsolverHandle_t       handle,
-                                         int                     m,
-                                         int                     n,
-                                         hipsolverDoubleComplex* A,
-                                         int                     lda,
-                                         int                     stA,
-                                         hipsolverDoubleComplex* tau,
-                                         int                     stT,
-                                         hipsolverDoubleComplex* work,
-                                         int                     lwork,
-                                         int*                    info,
-                                         int                     bc)
+inline hipsolverStatus_t hipsolver_gels(bool                    FORTRAN,
+                                        hipsolverHandle_t       handle,
+                                        int                     m,
+                                        int                     n,
+                                        int                     nrhs,
+                                        hipsolverDoubleComplex* A,
+                                        int                     lda,
+                                        int                     stA,
+                                        hipsolverDoubleComplex* B,
+                                        int                     ldb,
+                                        int                     stB,
+                                        hipsolverDoubleComplex* X,
+                                        int                     ldx,
+                                        int                     stX,
+                                        void*                   work,
+                                        size_t                  lwork,
+                                        int*                    niters,
+                                        int*                    info,
+                                        int                     bc)
 {
     if(!FORTRAN)
-        return hipsolverZgeqrf(handle,
+        return hipsolverZZgels(handle,
                                m,
                                n,
+                               nrhs,
                                (hipDoubleComplex*)A,
                                lda,
-                               (hipDoubleComplex*)tau,
-                               (hipDoubleComplex*)work,
+                               (hipDoubleComplex*)B,
+                               ldb,
+                               (hipDoubleComplex*)X,
+                               ldx,
+                               work,
                                lwork,
+                               niters,
                                info);
     else
-        return hipsolverZgeqrfFortran(handle,
+        return hipsolverZZgelsFortran(handle,
                                       m,
                                       n,
+                                      nrhs,
                                       (hipDoubleComplex*)A,
                                       lda,
-                                      (hipDoubleComplex*)tau,
-                                      (hipDoubleComplex*)work,
+                                      (hipDoubleComplex*)B,
+                                      ldb,
+                                      (hipDoubleComplex*)X,
+                                      ldx,
+                                      work,
                                       lwork,
+                                      niters,
                                       info);
 }
+
+// batched
+inline hipsolverStatus_t hipsolver_gels_bufferSize(bool              FORTRAN,
+                                                   hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   float*            A[],
+                                                   int               lda,
+                                                   float*            B[],
+                                                   int               ldb,
+                                                   float*            X[],
+                                                   int               ldx,
+                                                   size_t*           lwork,
+                                                   int               bc)
+{
+    if(!FORTRAN)
+        return hipsolverSSgelsBatched_bufferSize(
+            handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork, bc);
+    else
+        return hipsolverSSgelsBatched_bufferSizeFortran(
+            handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork, bc);
+}
+
+inline hipsolverStatus_t hipsolver_gels_bufferSize(bool              FORTRAN,
+                                                   hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           A[],
+                                                   int               lda,
+                                                   double*           B[],
+                                                   int               ldb,
+                                                   double*           X[],
+                                                   int               ldx,
+                                                   size_t*           lwork,
+                                                   int               bc)
+{
+    if(!FORTRAN)
+        return hipsolverDDgelsBatched_bufferSize(
+            handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork, bc);
+    else
+        return hipsolverDDgelsBatched_bufferSizeFortran(
+            handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork, bc);
+}
+
+inline hipsolverStatus_t hipsolver_gels_bufferSize(bool              FORTRAN,
+                                                   hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipsolverComplex* A[],
+                                                   int               lda,
+                                                   hipsolverComplex* B[],
+                                                   int               ldb,
+                                                   hipsolverComplex* X[],
+                                                   int               ldx,
+                                                   size_t*           lwork,
+                                                   int               bc)
+{
+    if(!FORTRAN)
+        return hipsolverCCgelsBatched_bufferSize(handle,
+                                                 m,
+                                                 n,
+                                                 nrhs,
+                                                 (hipFloatComplex**)A,
+                                                 lda,
+                                                 (hipFloatComplex**)B,
+                                                 ldb,
+                                                 (hipFloatComplex**)X,
+                                                 ldx,
+                                                 lwork,
+                                                 bc);
+    else
+        return hipsolverCCgelsBatched_bufferSizeFortran(handle,
+                                                        m,
+                                                        n,
+                                                        nrhs,
+                                                        (hipFloatComplex**)A,
+                                                        lda,
+                                                        (hipFloatComplex**)B,
+                                                        ldb,
+                                                        (hipFloatComplex**)X,
+                                                        ldx,
+                                                        lwork,
+                                                        bc);
+}
+
+inline hipsolverStatus_t hipsolver_gels_bufferSize(bool                    FORTRAN,
+                                                   hipsolverHandle_t       handle,
+                                                   int                     m,
+                                                   int                     n,
+                                                   int                     nrhs,
+                                                   hipsolverDoubleComplex* A[],
+                                                   int                     lda,
+                                                   hipsolverDoubleComplex* B[],
+                                                   int                     ldb,
+                                                   hipsolverDoubleComplex* X[],
+                                                   int                     ldx,
+                                                   size_t*                 lwork,
+                                                   int                     bc)
+{
+    if(!FORTRAN)
+        return hipsolverZZgelsBatched_bufferSize(handle,
+                                                 m,
+                                                 n,
+                                                 nrhs,
+                                                 (hipDoubleComplex**)A,
+                                                 lda,
+                                                 (hipDoubleComplex**)B,
+                                                 ldb,
+                                                 (hipDoubleComplex**)X,
+                                                 ldx,
+                                                 lwork,
+                                                 bc);
+    else
+        return hipsolverZZgelsBatched_bufferSizeFortran(handle,
+                                                        m,
+                                                        n,
+                                                        nrhs,
+                                                        (hipDoubleComplex**)A,
+                                                        lda,
+                                                        (hipDoubleComplex**)B,
+                                                        ldb,
+                                                        (hipDoubleComplex**)X,
+                                                        ldx,
+                                                        lwork,
+                                                        bc);
+}
+
+inline hipsolverStatus_t hipsolver_gels(bool              FORTRAN,
+                                        hipsolverHandle_t handle,
+                                        int               m,
+                                        int               n,
+                                        int               nrhs,
+                                        float*            A[],
+                                        int               lda,
+                                        int               stA,
+                                        float*            B[],
+                                        int               ldb,
+                                        int               stB,
+                                        float*            X[],
+                                        int               ldx,
+                                        int               stX,
+                                        void*             work,
+                                        size_t            lwork,
+                                        int*              niters,
+                                        int*              info,
+                                        int               bc)
+{
+    if(!FORTRAN)
+        return hipsolverSSgelsBatched(
+            handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info, bc);
+    else
+        return hipsolverSSgelsBatchedFortran(
+            handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info, bc);
+}
+
+inline hipsolverStatus_t hipsolver_gels(bool              FORTRAN,
+                                        hipsolverHandle_t handle,
+                                        int               m,
+                                        int               n,
+                                        int               nrhs,
+                                        double*           A[],
+                                        int               lda,
+                                        int               stA,
+                                        double*           B[],
+                                        int               ldb,
+                                        int               stB,
+                                        double*           X[],
+                                        int               ldx,
+                                        int               stX,
+                                        void*             work,
+                                        size_t            lwork,
+                                        int*              niters,
+                                        int*              info,
+                                        int               bc)
+{
+    if(!FORTRAN)
+        return hipsolverDDgelsBatched(
+            handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info, bc);
+    else
+        return hipsolverDDgelsBatchedFortran(
+            handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info, bc);
+}
+
+inline hipsolverStatus_t hipsolver_gels(bool              FORTRAN,
+                                        hipsolverHandle_t handle,
+                                        int               m,
+                                        int               n,
+                                        int               nrhs,
+                                        hipsolverComplex* A[],
+                                        int               lda,
+                                        int               stA,
+                                        hipsolverComplex* B[],
+                                        int               ldb,
+                                        int               stB,
+                                        hipsolverComplex* X[],
+                                        int               ldx,
+                                        int               stX,
+                                        void*             work,
+                                        size_t            lwork,
+                                        int*              niters,
+                                        int*              info,
+                                        int               bc)
+{
+    if(!FORTRAN)
+        return hipsolverCCgelsBatched(handle,
+                                      m,
+                                      n,
+                                      nrhs,
+                                      (hipFloatComplex**)A,
+                                      lda,
+                                      (hipFloatComplex**)B,
+                                      ldb,
+                                      (hipFloatComplex**)X,
+                                      ldx,
+                                      work,
+                                      lwork,
+                                      niters,
+                                      info,
+                                      bc);
+    else
+        return hipsolverCCgelsBatchedFortran(handle,
+                                             m,
+                                             n,
+                                             nrhs,
+                                             (hipFloatComplex**)A,
+                                             lda,
+                                             (hipFloatComplex**)B,
+                                             ldb,
+                                             (hipFloatComplex**)X,
+                                             ldx,
+                                             work,
+                                             lwork,
+                                             niters,
+                                             info,
+                                             bc);
+}
+
+inline hipsolverStatus_t hipsolver_gels(bool                    FORTRAN,
+                                        hipsolverHandle_t       handle,
+                                        int                     m,
+                                        int                     n,
+                                        int                     nrhs,
+                                        hipsolverDoubleComplex* A[],
+                                        int                     lda,
+                                        int                     stA,
+                                        hipsolverDoubleComplex* B[],
+                                        int                     ldb,
+                                        int                     stB,
+                                        hipsolverDoubleComplex* X[],
+                                        int                     ldx,
+                                        int                     stX,
+                                        void*                   work,
+                                        size_t                  lwork,
+                                        int*                    niters,
+                                        int*                    info,
+                                        int                     bc)
+{
+    if(!FORTRAN)
+        return hipsolverZZgelsBatched(handle,
+                                      m,
+                                      n,
+                                      nrhs,
+                                      (hipDoubleComplex**)A,
+                                      lda,
+                                      (hipDoubleComplex**)B,
+                                      ldb,
+                                      (hipDoubleComplex**)X,
+                                      ldx,
+                                      work,
+                                      lwork,
+                                      niters,
+                                      info,
+                                      bc);
+    else
+        return hipsolverZZgelsBatchedFortran(handle,
+                                             m,
+                                             n,
+                                             nrhs,
+                                             (hipDoubleComplex**)A,
+                                             lda,
+                                             (hipDoubleComplex**)B,
+                                             ldb,
+                                             (hipDoubleComplex**)X,
+                                             ldx,
+                                             work,
+                                             lwork,
+                                             niters,
+                                             info,
+                                             bc);
+}
 /********************************************************/
 
-/******************** GESVD ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_gesvd_bufferSize(bool              FORTRAN,
+/******************** GEQP3 & GEQP3_TRUNCATED ********************/
+// normal
+inline hipsolverStatus_t hipsolver_geqp3_bufferSize(bool              FORTRAN,
+                                                    bool              TRUNCATED,
                                                     hipsolverHandle_t handle,
-                                                    signed char       jobu,
-                                                    signed char       jobv,
                                                     int               m,
                                                     int               n,
                                                     float*            A,
                                                     int               lda,
                                                     int*              lwork)
 {
-    if(!FORTRAN)
-        return hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+    if(!FORTRAN && !TRUNCATED)
+        return hipsolverSgeqp3_bufferSize(handle, m, n, A, lda, lwork);
+    else if(!FORTRAN)
+        return hipsolverSgeqp3Truncated_bufferSize(handle, m, n, A, lda, lwork);
+    else if(!TRUNCATED)
+        return hipsolverSgeqp3_bufferSizeFortran(handle, m, n, A, lda, lwork);
     else
-        return hipsolverSgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+        return hipsolverSgeqp3Truncated_bufferSizeFortran(handle, m, n, A, lda, lwork);
 }
 
-inline hipsolverStatus_t hipsolver_gesvd_bufferSize(bool              FORTRAN,
+inline hipsolverStatus_t hipsolver_geqp3_bufferSize(bool              FORTRAN,
+                                                    bool              TRUNCATED,
                                                     hipsolverHandle_t handle,
-                                                    signed char       jobu,
-                                                    signed char       jobv,
                                                     int               m,
                                                     int               n,
                                                     double*           A,
                                                     int               lda,
                                                     int*              lwork)
 {
-    if(!FORTRAN)
-        return hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+    if(!FORTRAN && !TRUNCATED)
+        return hipsolverDgeqp3_bufferSize(handle, m, n, A, lda, lwork);
+    else if(!FORTRAN)
+        return hipsolverDgeqp3Truncated_bufferSize(handle, m, n, A, lda, lwork);
+    else if(!TRUNCATED)
+        return hipsolverDgeqp3_bufferSizeFortran(handle, m, n, A, lda, lwork);
     else
-        return hipsolverDgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+        return hipsolverDgeqp3Truncated_bufferSizeFortran(handle, m, n, A, lda, lwork);
 }
 
-inline hipsolverStatus_t hipsolver_gesvd_bufferSize(bool              FORTRAN,
+inline hipsolverStatus_t hipsolver_geqp3_bufferSize(bool              FORTRAN,
+                                                    bool              TRUNCATED,
                                                     hipsolverHandle_t handle,
-                                                    signed char       jobu,
-                                                    signed char       jobv,
                                                     int               m,
                                                     int               n,
                                                     hipsolverComplex* A,
                                                     int               lda,
                                                     int*              lwork)
 {
-    if(!FORTRAN)
-        return hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+    if(!FORTRAN && !TRUNCATED)
+        return hipsolverCgeqp3_bufferSize(handle, m, n, (hipFloatComplex*)A, lda, lwork);
+    else if(!FORTRAN)
+        return hipsolverCgeqp3Truncated_bufferSize(handle, m, n, (hipFloatComplex*)A, lda, lwork);
+    else if(!TRUNCATED)
+        return hipsolverCgeqp3_bufferSizeFortran(handle, m, n, (hipFloatComplex*)A, lda, lwork);
     else
-        return hipsolverCgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+        return hipsolverCgeqp3Truncated_bufferSizeFortran(
+            handle, m, n, (hipFloatComplex*)A, lda, lwork);
 }
 
-inline hipsolverStatus_t hipsolver_gesvd_bufferSize(bool                    FORTRAN,
+inline hipsolverStatus_t hipsolver_geqp3_bufferSize(bool                    FORTRAN,
+                                                    bool                    TRUNCATED,
                                                     hipsolverHandle_t       handle,
-                                                    signed char             jobu,
-                                                    signed char             jobv,
                                                     int                     m,
                                                     int                     n,
                                                     hipsolverDoubleComplex* A,
                                                     int                     lda,
                                                     int*                    lwork)
 {
-    if(!FORTRAN)
-        return hipsolverZgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+    if(!FORTRAN && !TRUNCATED)
+        return hipsolverZgeqp3_bufferSize(handle, m, n, (hipDoubleComplex*)A, lda, lwork);
+    else if(!FORTRAN)
+        return hipsolverZgeqp3Truncated_bufferSize(handle, m, n, (hipDoubleComplex*)A, lda, lwork);
+    else if(!TRUNCATED)
+        return hipsolverZgeqp3_bufferSizeFortran(handle, m, n, (hipDoubleComplex*)A, lda, lwork);
     else
-        return hipsolverZgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+        return hipsolverZgeqp3Truncated_bufferSizeFortran(
+            handle, m, n, (hipDoubleComplex*)A, lda, lwork);
 }
 
-inline hipsolverStatus_t hipsolver_gesvd(bool              FORTRAN,
+inline hipsolverStatus_t hipsolver_geqp3(bool              FORTRAN,
+                                         bool              TRUNCATED,
                                          hipsolverHandle_t handle,
-                                         signed char       jobu,
-                                         signed char       jobv,
                                          int               m,
                                          int               n,
                                          float*            A,
                                          int               lda,
-                                         int               stA,
-                                         float*            S,
-                                         int               stS,
-                                         float*            U,
-                                         int               ldu,
-                                         int               stU,
-                                         float*            V,
-                                         int               ldv,
-                                         int               stV,
+                                         float             tol,
+                                         int*              jpvt,
+                                         float*            tau,
+                                         int*              rank,
                                          float*            work,
                                          int               lwork,
-                                         float*            rwork,
-                                         int               stRW,
-                                         int*              info,
-                                         int               bc)
+                                         int*              info)
 {
-    if(!FORTRAN)
-        return hipsolverSgesvd(
-            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+    if(!FORTRAN && !TRUNCATED)
+        return hipsolverSgeqp3(handle, m, n, A, lda, jpvt, tau, work, lwork, info);
+    else if(!FORTRAN)
+        return hipsolverSgeqp3Truncated(
+            handle, m, n, A, lda, tol, jpvt, tau, rank, work, lwork, info);
+    else if(!TRUNCATED)
+        return hipsolverSgeqp3Fortran(handle, m, n, A, lda, jpvt, tau, work, lwork, info);
     else
-        return hipsolverSgesvdFortran(
-            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+        return hipsolverSgeqp3TruncatedFortran(
+            handle, m, n, A, lda, tol, jpvt, tau, rank, work, lwork, info);
 }
 
-inline hipsolverStatus_t hipsolver_gesvd(bool              FORTRAN,
+inline hipsolverStatus_t hipsolver_geqp3(bool              FORTRAN,
+                                         bool              TRUNCATED,
                                          hipsolverHandle_t handle,
-                                         signed char       jobu,
-                                         signed char       jobv,
                                          int               m,
                                          int               n,
                                          double*           A,
                                          int               lda,
-                                         int               stA,
-                                         double*           S,
-                                         int               stS,
-                                         double*           U,
-                                         int               ldu,
-                                         int               stU,
-                                         double*           V,
-                                         int               ldv,
-                                         int               stV,
+                                         double            tol,
+                                         int*              jpvt,
+                                         double*           tau,
+                                         int*              rank,
                                          double*           work,
                                          int               lwork,
-                                         double*           rwork,
-                                         int               stRW,
-                                         int*              info,
-                                         int               bc)
+                                         int*              info)
 {
-    if(!FORTRAN)
-        return hipsolverDgesvd(
-            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+    if(!FORTRAN && !TRUNCATED)
+        return hipsolverDgeqp3(handle, m, n, A, lda, jpvt, tau, work, lwork, info);
+    else if(!FORTRAN)
+        return hipsolverDgeqp3Truncated(
+            handle, m, n, A, lda, tol, jpvt, tau, rank, work, lwork, info);
+    else if(!TRUNCATED)
+        return hipsolverDgeqp3Fortran(handle, m, n, A, lda, jpvt, tau, work, lwork, info);
     else
-        return hipsolverDgesvdFortran(
-            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+        return hipsolverDgeqp3TruncatedFortran(
+            handle, m, n, A, lda, tol, jpvt, tau, rank, work, lwork, info);
 }
 
-inline hipsolverStatus_t hipsolver_gesvd(bool              FORTRAN,
+inline hipsolverStatus_t hipsolver_geqp3(bool              FORTRAN,
+                                         bool              TRUNCATED,
                                          hipsolverHandle_t handle,
-                                         signed char       jobu,
-                                         signed char       jobv,
                                          int               m,
                                          int               n,
                                          hipsolverComplex* A,
                                          int               lda,
-                                         int               stA,
-                                         float*            S,
-                                         int               stS,
-                                         hipsolverComplex* U,
-                                         int               ldu,
-                                         int               stU,
-                                         hipsolverComplex* V,
-                                         int               ldv,
-                                         int               stV,
+                                         float             tol,
+                                         int*              jpvt,
+                                         hipsolverComplex* tau,
+                                         int*              rank,
                                          hipsolverComplex* work,
                                          int               lwork,
-                                         float*            rwork,
-                                         int               stRW,
-                                         int*              info,
-                                         int               bc)
+                                         int*              info)
 {
-    if(!FORTRAN)
-        return hipsolverCgesvd(handle,
-                               jobu,
-                               jobv,
+    if(!FORTRAN && !TRUNCATED)
+        return hipsolverCgeqp3(handle,
                                m,
                                n,
                                (hipFloatComplex*)A,
                                lda,
-                               S,
-                               (hipFloatComplex*)U,
-                               ldu,
-                               (hipFloatComplex*)V,
-                               ldv,
+                               jpvt,
+                               (hipFloatComplex*)tau,
                                (hipFloatComplex*)work,
                                lwork,
-                               rwork,
                                info);
-    else
-        return hipsolverCgesvdFortran(handle,
-                                      jobu,
-                                      jobv,
+    else if(!FORTRAN)
+        return hipsolverCgeqp3Truncated(handle,
+                                        m,
+                                        n,
+                                        (hipFloatComplex*)A,
+                                        lda,
+                                        tol,
+                                        jpvt,
+                                        (hipFloatComplex*)tau,
+                                        rank,
+                                        (hipFloatComplex*)work,
+                                        lwork,
+                                        info);
+    else if(!TRUNCATED)
+        return hipsolverCgeqp3Fortran(handle,
                                       m,
                                       n,
                                       (hipFloatComplex*)A,
                                       lda,
-                                      S,
-                                      (hipFloatComplex*)U,
-                                      ldu,
-                                      (hipFloatComplex*)V,
-                                      ldv,
+                                      jpvt,
+                                      (hipFloatComplex*)tau,
                                       (hipFloatComplex*)work,
                                       lwork,
-                                      rwork,
                                       info);
+    else
+        return hipsolverCgeqp3TruncatedFortran(handle,
+                                               m,
+                                               n,
+                                               (hipFloatComplex*)A,
+                                               lda,
+                                               tol,
+                                               jpvt,
+                                               (hipFloatComplex*)tau,
+                                               rank,
+                                               (hipFloatComplex*)work,
+                                               lwork,
+                                               info);
 }
 
-inline hipsolverStatus_t hipsolver_gesvd(bool                    FORTRAN,
+inline hipsolverStatus_t hipsolver_geqp3(bool                    FORTRAN,
+                                         bool                    TRUNCATED,
                                          hipsolverHandle_t       handle,
-                                         signed char             jobu,
-                                         signed char             jobv,
                                          int                     m,
                                          int                     n,
                                          hipsolverDoubleComplex* A,
                                          int                     lda,
-                                         int                     stA,
-                                         double*                 S,
-                                         int                     stS,
-                                         hipsolverDoubleComplex* U,
-                                         int                     ldu,
-                                         int                     stU,
-                                         hipsolverDoubleComplex* V,
-                                         int                     ldv,
-                                         int                     stV,
+                                         double                  tol,
+                                         int*                    jpvt,
+                                         hipsolverDoubleComplex* tau,
+                                         int*                    rank,
                                          hipsolverDoubleComplex* work,
                                          int                     lwork,
-                                         double*                 rwork,
-                                         int                     stRW,
-                                         int*                    info,
-                                         int                     bc)
+                                         int*                    info)
 {
-    if(!FORTRAN)
-        return hipsolverZgesvd(handle,
-                               jobu,
-                               jobv,
+    if(!FORTRAN && !TRUNCATED)
+        return hipsolverZgeqp3(handle,
                                m,
                                n,
                                (hipDoubleComplex*)A,
                                lda,
-                               S,
-                               (hipDoubleComplex*)U,
-                               ldu,
-                               (hipDoubleComplex*)V,
-                               ldv,
+                               jpvt,
+                               (hipDoubleComplex*)tau,
                                (hipDoubleComplex*)work,
                                lwork,
-                               rwork,
                                info);
-    else
-        return hipsolverZgesvdFortran(handle,
-                                      jobu,
-                                      jobv,
+    else if(!FORTRAN)
+        return hipsolverZgeqp3Truncated(handle,
+                                        m,
+                                        n,
+                                        (hipDoubleComplex*)A,
+                                        lda,
+                                        tol,
+                                        jpvt,
+                                        (hipDoubleComplex*)tau,
+                                        rank,
+                                        (hipDoubleComplex*)work,
+                                        lwork,
+                                        info);
+    else if(!TRUNCATED)
+        return hipsolverZgeqp3Fortran(handle,
                                       m,
                                       n,
                                       (hipDoubleComplex*)A,
                                       lda,
-                                      S,
-                                      (hipDoubleComplex*)U,
-                                      ldu,
-                                      (hipDoubleComplex*)V,
-                                      ldv,
+                                      jpvt,
+                                      (hipDoubleComplex*)tau,
                                       (hipDoubleComplex*)work,
                                       lwork,
-                                      rwork,
                                       info);
+    else
+        return hipsolverZgeqp3TruncatedFortran(handle,
+                                               m,
+                                               n,
+                                               (hipDoubleComplex*)A,
+                                               lda,
+                                               tol,
+                                               jpvt,
+                                               (hipDoubleComplex*)tau,
+                                               rank,
+                                               (hipDoubleComplex*)work,
+                                               lwork,
+                                               info);
 }
 /********************************************************/
 
-/******************** GETRF ********************/
+/******************** GEQRF ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(
+inline hipsolverStatus_t hipsolver_geqrf_bufferSize(
     bool FORTRAN, hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
 {
     if(!FORTRAN)
-        return hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lwork);
+        return hipsolverSgeqrf_bufferSize(handle, m, n, A, lda, lwork);
     else
-        return hipsolverSgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
+        return hipsolverSgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
 }
 
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(
+inline hipsolverStatus_t hipsolver_geqrf_bufferSize(
     bool FORTRAN, hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
 {
     if(!FORTRAN)
-        return hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lwork);
+        return hipsolverDgeqrf_bufferSize(handle, m, n, A, lda, lwork);
     else
-        return hipsolverDgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
+        return hipsolverDgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
 }
 
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(
+inline hipsolverStatus_t hipsolver_geqrf_bufferSize(
     bool FORTRAN, hipsolverHandle_t handle, int m, int n, hipsolverComplex* A, int lda, int* lwork)
 {
     if(!FORTRAN)
-        return hipsolverCgetrf_bufferSize(handle, m, n, (hipFloatComplex*)A, lda, lwork);
+        return hipsolverCgeqrf_bufferSize(handle, m, n, (hipFloatComplex*)A, lda, lwork);
     else
-        return hipsolverCgetrf_bufferSizeFortran(handle, m, n, (hipFloatComplex*)A, lda, lwork);
+        return hipsolverCgeqrf_bufferSizeFortran(handle, m, n, (hipFloatComplex*)A, lda, lwork);
 }
 
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(bool                    FORTRAN,
+inline hipsolverStatus_t hipsolver_geqrf_bufferSize(bool                    FORTRAN,
                                                     hipsolverHandle_t       handle,
                                                     int                     m,
                                                     int                     n,
@@ -1762,127 +2451,691 @@ inline hipsolverStatus_t hipsolver_getrf_bufferSize(bool                    FORT
                                                     int*                    lwork)
 {
     if(!FORTRAN)
-        return hipsolverZgetrf_bufferSize(handle, m, n, (hipDoubleComplex*)A, lda, lwork);
+        return hipsolverZgeqrf_bufferSize(handle, m, n, (hipDoubleComplex*)A, lda, lwork);
     else
-        return hipsolverZgetrf_bufferSizeFortran(handle, m, n, (hipDoubleComplex*)A, lda, lwork);
+        return hipsolverZgeqrf_bufferSizeFortran(handle, m, n, (hipDoubleComplex*)A, lda, lwork);
 }
 
-inline hipsolverStatus_t hipsolver_getrf(bool              FORTRAN,
-                                         bool              NPVT,
+inline hipsolverStatus_t hipsolver_geqrf(bool              FORTRAN,
                                          hipsolverHandle_t handle,
                                          int               m,
                                          int               n,
                                          float*            A,
                                          int               lda,
                                          int               stA,
+                                         float*            tau,
+                                         int               stT,
                                          float*            work,
                                          int               lwork,
-                                         int*              ipiv,
-                                         int               stP,
                                          int*              info,
                                          int               bc)
 {
-    switch(bool2marshal(FORTRAN, NPVT))
-    {
-    case C_NORMAL:
-        return hipsolverSgetrf(handle, m, n, A, lda, work, lwork, ipiv, info);
-    case C_NORMAL_ALT:
-        return hipsolverSgetrf(handle, m, n, A, lda, work, lwork, nullptr, info);
-    case FORTRAN_NORMAL:
-        return hipsolverSgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverSgetrfFortran(handle, m, n, A, lda, work, lwork, nullptr, info);
-    default:
-        return HIPSOLVER_STATUS_NOT_SUPPORTED;
-    }
+    if(!FORTRAN)
+        return hipsolverSgeqrf(handle, m, n, A, lda, tau, work, lwork, info);
+    else
+        return hipsolverSgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info);
 }
 
-inline hipsolverStatus_t hipsolver_getrf(bool              FORTRAN,
-                                         bool              NPVT,
+inline hipsolverStatus_t hipsolver_geqrf(bool              FORTRAN,
                                          hipsolverHandle_t handle,
                                          int               m,
                                          int               n,
                                          double*           A,
                                          int               lda,
                                          int               stA,
+                                         double*           tau,
+                                         int               stT,
                                          double*           work,
                                          int               lwork,
-                                         int*              ipiv,
-                                         int               stP,
                                          int*              info,
                                          int               bc)
 {
-    switch(bool2marshal(FORTRAN, NPVT))
-    {
-    case C_NORMAL:
-        return hipsolverDgetrf(handle, m, n, A, lda, work, lwork, ipiv, info);
-    case C_NORMAL_ALT:
-        return hipsolverDgetrf(handle, m, n, A, lda, work, lwork, nullptr, info);
-    case FORTRAN_NORMAL:
-        return hipsolverDgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverDgetrfFortran(handle, m, n, A, lda, work, lwork, nullptr, info);
-    default:
-        return HIPSOLVER_STATUS_NOT_SUPPORTED;
-    }
+    if(!FORTRAN)
+        return hipsolverDgeqrf(handle, m, n, A, lda, tau, work, lwork, info);
+    else
+        return hipsolverDgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info);
 }
 
-inline hipsolverStatus_t hipsolver_getrf(bool              FORTRAN,
-                                         bool              NPVT,
+inline hipsolverStatus_t hipsolver_geqrf(bool              FORTRAN,
                                          hipsolverHandle_t handle,
                                          int               m,
                                          int               n,
                                          hipsolverComplex* A,
                                          int               lda,
                                          int               stA,
+                                         hipsolverComplex* tau,
+                                         int               stT,
                                          hipsolverComplex* work,
                                          int               lwork,
-                                         int*              ipiv,
-                                         int               stP,
                                          int*              info,
                                          int               bc)
 {
-    switch(bool2marshal(FORTRAN, NPVT))
-    {
-    case C_NORMAL:
-        return hipsolverCgetrf(
-            handle, m, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, ipiv, info);
-    case C_NORMAL_ALT:
-        return hipsolverCgetrf(
-            handle, m, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, nullptr, info);
-    case FORTRAN_NORMAL:
-        return hipsolverCgetrfFortran(
-            handle, m, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, ipiv, info);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverCgetrfFortran(
-            handle, m, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, nullptr, info);
-    default:
-        return HIPSOLVER_STATUS_NOT_SUPPORTED;
-    }
+    if(!FORTRAN)
+        return hipsolverCgeqrf(handle,
+                               m,
+                               n,
+                               (hipFloatComplex*)A,
+                               lda,
+                               (hipFloatComplex*)tau,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info);
+    else
+        return hipsolverCgeqrfFortran(handle,
+                                      m,
+                                      n,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      (hipFloatComplex*)tau,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info);
 }
 
-inline hipsolverStatus_t hipsolver_getrf(bool                    FORTRAN,
-                                         bool                    NPVT,
+inline hipsolverStatus_t hipsolver_geqrf(bool                    FORTRAN,
                                          hipsolverHandle_t       handle,
                                          int                     m,
                                          int                     n,
                                          hipsolverDoubleComplex* A,
                                          int                     lda,
                                          int                     stA,
+                                         hipsolverDoubleComplex* tau,
+                                         int                     stT,
                                          hipsolverDoubleComplex* work,
                                          int                     lwork,
-                                         int*                    ipiv,
-                                         int                     stP,
                                          int*                    info,
                                          int                     bc)
 {
-    switch(bool2marshal(FORTRAN, NPVT))
-    {
-    case C_NORMAL:
-        return hipsolverZgetrf(
-            handle, m, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, ipiv, info);
-    case C_NORMAL_ALT:
-        return hipsolverZgetrf(
+    if(!FORTRAN)
+        return hipsolverZgeqrf(handle,
+                               m,
+                               n,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               (hipDoubleComplex*)tau,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               info);
+    else
+        return hipsolverZgeqrfFortran(handle,
+                                      m,
+                                      n,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      (hipDoubleComplex*)tau,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info);
+}
+/********************************************************/
+
+/******************** GEQRF_TSQR ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_geqrf_tsqr_bufferSize(
+    bool FORTRAN, hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+{
+    if(!FORTRAN)
+        return hipsolverSgeqrfTsqr_bufferSize(handle, m, n, A, lda, lwork);
+    else
+        return hipsolverSgeqrfTsqr_bufferSizeFortran(handle, m, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_tsqr_bufferSize(
+    bool FORTRAN, hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+{
+    if(!FORTRAN)
+        return hipsolverDgeqrfTsqr_bufferSize(handle, m, n, A, lda, lwork);
+    else
+        return hipsolverDgeqrfTsqr_bufferSizeFortran(handle, m, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_tsqr_bufferSize(
+    bool FORTRAN, hipsolverHandle_t handle, int m, int n, hipsolverComplex* A, int lda, int* lwork)
+{
+    if(!FORTRAN)
+        return hipsolverCgeqrfTsqr_bufferSize(handle, m, n, (hipFloatComplex*)A, lda, lwork);
+    else
+        return hipsolverCgeqrfTsqr_bufferSizeFortran(handle, m, n, (hipFloatComplex*)A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_tsqr_bufferSize(bool                    FORTRAN,
+                                                         hipsolverHandle_t       handle,
+                                                         int                     m,
+                                                         int                     n,
+                                                         hipsolverDoubleComplex* A,
+                                                         int                     lda,
+                                                         int*                    lwork)
+{
+    if(!FORTRAN)
+        return hipsolverZgeqrfTsqr_bufferSize(handle, m, n, (hipDoubleComplex*)A, lda, lwork);
+    else
+        return hipsolverZgeqrfTsqr_bufferSizeFortran(
+            handle, m, n, (hipDoubleComplex*)A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_tsqr(bool              FORTRAN,
+                                              hipsolverHandle_t handle,
+                                              int               m,
+                                              int               n,
+                                              float*            A,
+                                              int               lda,
+                                              int               stA,
+                                              float*            tau,
+                                              int               stT,
+                                              float*            work,
+                                              int               lwork,
+                                              int*              info,
+                                              int               bc)
+{
+    if(!FORTRAN)
+        return hipsolverSgeqrfTsqr(handle, m, n, A, lda, tau, work, lwork, info);
+    else
+        return hipsolverSgeqrfTsqrFortran(handle, m, n, A, lda, tau, work, lwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_tsqr(bool              FORTRAN,
+                                              hipsolverHandle_t handle,
+                                              int               m,
+                                              int               n,
+                                              double*           A,
+                                              int               lda,
+                                              int               stA,
+                                              double*           tau,
+                                              int               stT,
+                                              double*           work,
+                                              int               lwork,
+                                              int*              info,
+                                              int               bc)
+{
+    if(!FORTRAN)
+        return hipsolverDgeqrfTsqr(handle, m, n, A, lda, tau, work, lwork, info);
+    else
+        return hipsolverDgeqrfTsqrFortran(handle, m, n, A, lda, tau, work, lwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_tsqr(bool              FORTRAN,
+                                              hipsolverHandle_t handle,
+                                              int               m,
+                                              int               n,
+                                              hipsolverComplex* A,
+                                              int               lda,
+                                              int               stA,
+                                              hipsolverComplex* tau,
+                                              int               stT,
+                                              hipsolverComplex* work,
+                                              int               lwork,
+                                              int*              info,
+                                              int               bc)
+{
+    if(!FORTRAN)
+        return hipsolverCgeqrfTsqr(handle,
+                                   m,
+                                   n,
+                                   (hipFloatComplex*)A,
+                                   lda,
+                                   (hipFloatComplex*)tau,
+                                   (hipFloatComplex*)work,
+                                   lwork,
+                                   info);
+    else
+        return hipsolverCgeqrfTsqrFortran(handle,
+                                          m,
+                                          n,
+                                          (hipFloatComplex*)A,
+                                          lda,
+                                          (hipFloatComplex*)tau,
+                                          (hipFloatComplex*)work,
+                                          lwork,
+                                          info);
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_tsqr(bool                    FORTRAN,
+                                              hipsolverHandle_t       handle,
+                                              int                     m,
+                                              int                     n,
+                                              hipsolverDoubleComplex* A,
+                                              int                     lda,
+                                              int                     stA,
+                                              hipsolverDoubleComplex* tau,
+                                              int                     stT,
+                                              hipsolverDoubleComplex* work,
+                                              int                     lwork,
+                                              int*                    info,
+                                              int                     bc)
+{
+    if(!FORTRAN)
+        return hipsolverZgeqrfTsqr(handle,
+                                   m,
+                                   n,
+                                   (hipDoubleComplex*)A,
+                                   lda,
+                                   (hipDoubleComplex*)tau,
+                                   (hipDoubleComplex*)work,
+                                   lwork,
+                                   info);
+    else
+        return hipsolverZgeqrfTsqrFortran(handle,
+                                          m,
+                                          n,
+                                          (hipDoubleComplex*)A,
+                                          lda,
+                                          (hipDoubleComplex*)tau,
+                                          (hipDoubleComplex*)work,
+                                          lwork,
+                                          info);
+}
+/********************************************************/
+
+/******************** GESVD ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_gesvd_bufferSize(bool              FORTRAN,
+                                                    hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    float*            A,
+                                                    int               lda,
+                                                    int*              lwork)
+{
+    if(!FORTRAN)
+        return hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+    else
+        return hipsolverSgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_gesvd_bufferSize(bool              FORTRAN,
+                                                    hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    double*           A,
+                                                    int               lda,
+                                                    int*              lwork)
+{
+    if(!FORTRAN)
+        return hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+    else
+        return hipsolverDgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_gesvd_bufferSize(bool              FORTRAN,
+                                                    hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    hipsolverComplex* A,
+                                                    int               lda,
+                                                    int*              lwork)
+{
+    if(!FORTRAN)
+        return hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+    else
+        return hipsolverCgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_gesvd_bufferSize(bool                    FORTRAN,
+                                                    hipsolverHandle_t       handle,
+                                                    signed char             jobu,
+                                                    signed char             jobv,
+                                                    int                     m,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int*                    lwork)
+{
+    if(!FORTRAN)
+        return hipsolverZgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+    else
+        return hipsolverZgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_gesvd(bool              FORTRAN,
+                                         hipsolverHandle_t handle,
+                                         signed char       jobu,
+                                         signed char       jobv,
+                                         int               m,
+                                         int               n,
+                                         float*            A,
+                                         int               lda,
+                                         int               stA,
+                                         float*            S,
+                                         int               stS,
+                                         float*            U,
+                                         int               ldu,
+                                         int               stU,
+                                         float*            V,
+                                         int               ldv,
+                                         int               stV,
+                                         float*            work,
+                                         int               lwork,
+                                         float*            rwork,
+                                         int               stRW,
+                                         int*              info,
+                                         int               bc)
+{
+    if(!FORTRAN)
+        return hipsolverSgesvd(
+            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+    else
+        return hipsolverSgesvdFortran(
+            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_gesvd(bool              FORTRAN,
+                                         hipsolverHandle_t handle,
+                                         signed char       jobu,
+                                         signed char       jobv,
+                                         int               m,
+                                         int               n,
+                                         double*           A,
+                                         int               lda,
+                                         int               stA,
+                                         double*           S,
+                                         int               stS,
+                                         double*           U,
+                                         int               ldu,
+                                         int               stU,
+                                         double*           V,
+                                         int               ldv,
+                                         int               stV,
+                                         double*           work,
+                                         int               lwork,
+                                         double*           rwork,
+                                         int               stRW,
+                                         int*              info,
+                                         int               bc)
+{
+    if(!FORTRAN)
+        return hipsolverDgesvd(
+            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+    else
+        return hipsolverDgesvdFortran(
+            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_gesvd(bool              FORTRAN,
+                                         hipsolverHandle_t handle,
+                                         signed char       jobu,
+                                         signed char       jobv,
+                                         int               m,
+                                         int               n,
+                                         hipsolverComplex* A,
+                                         int               lda,
+                                         int               stA,
+                                         float*            S,
+                                         int               stS,
+                                         hipsolverComplex* U,
+                                         int               ldu,
+                                         int               stU,
+                                         hipsolverComplex* V,
+                                         int               ldv,
+                                         int               stV,
+                                         hipsolverComplex* work,
+                                         int               lwork,
+                                         float*            rwork,
+                                         int               stRW,
+                                         int*              info,
+                                         int               bc)
+{
+    if(!FORTRAN)
+        return hipsolverCgesvd(handle,
+                               jobu,
+                               jobv,
+                               m,
+                               n,
+                               (hipFloatComplex*)A,
+                               lda,
+                               S,
+                               (hipFloatComplex*)U,
+                               ldu,
+                               (hipFloatComplex*)V,
+                               ldv,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               rwork,
+                               info);
+    else
+        return hipsolverCgesvdFortran(handle,
+                                      jobu,
+                                      jobv,
+                                      m,
+                                      n,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      S,
+                                      (hipFloatComplex*)U,
+                                      ldu,
+                                      (hipFloatComplex*)V,
+                                      ldv,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      rwork,
+                                      info);
+}
+
+inline hipsolverStatus_t hipsolver_gesvd(bool                    FORTRAN,
+                                         hipsolverHandle_t       handle,
+                                         signed char             jobu,
+                                         signed char             jobv,
+                                         int                     m,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         double*                 S,
+                                         int                     stS,
+                                         hipsolverDoubleComplex* U,
+                                         int                     ldu,
+                                         int                     stU,
+                                         hipsolverDoubleComplex* V,
+                                         int                     ldv,
+                                         int                     stV,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         double*                 rwork,
+                                         int                     stRW,
+                                         int*                    info,
+                                         int                     bc)
+{
+    if(!FORTRAN)
+        return hipsolverZgesvd(handle,
+                               jobu,
+                               jobv,
+                               m,
+                               n,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               S,
+                               (hipDoubleComplex*)U,
+                               ldu,
+                               (hipDoubleComplex*)V,
+                               ldv,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               rwork,
+                               info);
+    else
+        return hipsolverZgesvdFortran(handle,
+                                      jobu,
+                                      jobv,
+                                      m,
+                                      n,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      S,
+                                      (hipDoubleComplex*)U,
+                                      ldu,
+                                      (hipDoubleComplex*)V,
+                                      ldv,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      rwork,
+                                      info);
+}
+/********************************************************/
+
+/******************** GETRF ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(
+    bool FORTRAN, hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+{
+    if(!FORTRAN)
+        return hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lwork);
+    else
+        return hipsolverSgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(
+    bool FORTRAN, hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+{
+    if(!FORTRAN)
+        return hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lwork);
+    else
+        return hipsolverDgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(
+    bool FORTRAN, hipsolverHandle_t handle, int m, int n, hipsolverComplex* A, int lda, int* lwork)
+{
+    if(!FORTRAN)
+        return hipsolverCgetrf_bufferSize(handle, m, n, (hipFloatComplex*)A, lda, lwork);
+    else
+        return hipsolverCgetrf_bufferSizeFortran(handle, m, n, (hipFloatComplex*)A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(bool                    FORTRAN,
+                                                    hipsolverHandle_t       handle,
+                                                    int                     m,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int*                    lwork)
+{
+    if(!FORTRAN)
+        return hipsolverZgetrf_bufferSize(handle, m, n, (hipDoubleComplex*)A, lda, lwork);
+    else
+        return hipsolverZgetrf_bufferSizeFortran(handle, m, n, (hipDoubleComplex*)A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_getrf(bool              FORTRAN,
+                                         bool              NPVT,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         float*            A,
+                                         int               lda,
+                                         int               stA,
+                                         float*            work,
+                                         int               lwork,
+                                         int*              ipiv,
+                                         int               stP,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverSgetrf(handle, m, n, A, lda, work, lwork, ipiv, info);
+    case C_NORMAL_ALT:
+        return hipsolverSgetrf(handle, m, n, A, lda, work, lwork, nullptr, info);
+    case FORTRAN_NORMAL:
+        return hipsolverSgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverSgetrfFortran(handle, m, n, A, lda, work, lwork, nullptr, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf(bool              FORTRAN,
+                                         bool              NPVT,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         double*           A,
+                                         int               lda,
+                                         int               stA,
+                                         double*           work,
+                                         int               lwork,
+                                         int*              ipiv,
+                                         int               stP,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverDgetrf(handle, m, n, A, lda, work, lwork, ipiv, info);
+    case C_NORMAL_ALT:
+        return hipsolverDgetrf(handle, m, n, A, lda, work, lwork, nullptr, info);
+    case FORTRAN_NORMAL:
+        return hipsolverDgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverDgetrfFortran(handle, m, n, A, lda, work, lwork, nullptr, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf(bool              FORTRAN,
+                                         bool              NPVT,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         hipsolverComplex* A,
+                                         int               lda,
+                                         int               stA,
+                                         hipsolverComplex* work,
+                                         int               lwork,
+                                         int*              ipiv,
+                                         int               stP,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverCgetrf(
+            handle, m, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, ipiv, info);
+    case C_NORMAL_ALT:
+        return hipsolverCgetrf(
+            handle, m, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, nullptr, info);
+    case FORTRAN_NORMAL:
+        return hipsolverCgetrfFortran(
+            handle, m, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, ipiv, info);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverCgetrfFortran(
+            handle, m, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, nullptr, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf(bool                    FORTRAN,
+                                         bool                    NPVT,
+                                         hipsolverHandle_t       handle,
+                                         int                     m,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(bool2marshal(FORTRAN, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverZgetrf(
+            handle, m, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, ipiv, info);
+    case C_NORMAL_ALT:
+        return hipsolverZgetrf(
             handle, m, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, nullptr, info);
     case FORTRAN_NORMAL:
         return hipsolverZgetrfFortran(
@@ -1896,258 +3149,1042 @@ inline hipsolverStatus_t hipsolver_getrf(bool                    FORTRAN,
 }
 /********************************************************/
 
-/******************** GETRS ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                 FORTRAN,
-                                                    hipsolverHandle_t    handle,
-                                                    hipsolverOperation_t trans,
-                                                    int                  n,
-                                                    int                  nrhs,
-                                                    float*               A,
-                                                    int                  lda,
-                                                    int*                 ipiv,
-                                                    float*               B,
-                                                    int                  ldb,
-                                                    int*                 lwork)
+/******************** GETRS ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                 FORTRAN,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    float*               A,
+                                                    int                  lda,
+                                                    int*                 ipiv,
+                                                    float*               B,
+                                                    int                  ldb,
+                                                    int*                 lwork)
+{
+    if(!FORTRAN)
+        return hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    else
+        return hipsolverSgetrs_bufferSizeFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                 FORTRAN,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    double*              A,
+                                                    int                  lda,
+                                                    int*                 ipiv,
+                                                    double*              B,
+                                                    int                  ldb,
+                                                    int*                 lwork)
+{
+    if(!FORTRAN)
+        return hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    else
+        return hipsolverDgetrs_bufferSizeFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                 FORTRAN,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    hipsolverComplex*    A,
+                                                    int                  lda,
+                                                    int*                 ipiv,
+                                                    hipsolverComplex*    B,
+                                                    int                  ldb,
+                                                    int*                 lwork)
+{
+    if(!FORTRAN)
+        return hipsolverCgetrs_bufferSize(handle,
+                                          trans,
+                                          n,
+                                          nrhs,
+                                          (hipFloatComplex*)A,
+                                          lda,
+                                          ipiv,
+                                          (hipFloatComplex*)B,
+                                          ldb,
+                                          lwork);
+    else
+        return hipsolverCgetrs_bufferSizeFortran(handle,
+                                                 trans,
+                                                 n,
+                                                 nrhs,
+                                                 (hipFloatComplex*)A,
+                                                 lda,
+                                                 ipiv,
+                                                 (hipFloatComplex*)B,
+                                                 ldb,
+                                                 lwork);
+}
+
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                    FORTRAN,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverOperation_t    trans,
+                                                    int                     n,
+                                                    int                     nrhs,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int*                    ipiv,
+                                                    hipsolverDoubleComplex* B,
+                                                    int                     ldb,
+                                                    int*                    lwork)
+{
+    if(!FORTRAN)
+        return hipsolverZgetrs_bufferSize(handle,
+                                          trans,
+                                          n,
+                                          nrhs,
+                                          (hipDoubleComplex*)A,
+                                          lda,
+                                          ipiv,
+                                          (hipDoubleComplex*)B,
+                                          ldb,
+                                          lwork);
+    else
+        return hipsolverZgetrs_bufferSizeFortran(handle,
+                                                 trans,
+                                                 n,
+                                                 nrhs,
+                                                 (hipDoubleComplex*)A,
+                                                 lda,
+                                                 ipiv,
+                                                 (hipDoubleComplex*)B,
+                                                 ldb,
+                                                 lwork);
+}
+
+inline hipsolverStatus_t hipsolver_getrs(bool                 FORTRAN,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         float*               A,
+                                         int                  lda,
+                                         int                  stA,
+                                         int*                 ipiv,
+                                         int                  stP,
+                                         float*               B,
+                                         int                  ldb,
+                                         int                  stB,
+                                         float*               work,
+                                         int                  lwork,
+                                         int*                 info,
+                                         int                  bc)
+{
+    if(!FORTRAN)
+        return hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    else
+        return hipsolverSgetrsFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_getrs(bool                 FORTRAN,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         double*              A,
+                                         int                  lda,
+                                         int                  stA,
+                                         int*                 ipiv,
+                                         int                  stP,
+                                         double*              B,
+                                         int                  ldb,
+                                         int                  stB,
+                                         double*              work,
+                                         int                  lwork,
+                                         int*                 info,
+                                         int                  bc)
+{
+    if(!FORTRAN)
+        return hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    else
+        return hipsolverDgetrsFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_getrs(bool                 FORTRAN,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         hipsolverComplex*    A,
+                                         int                  lda,
+                                         int                  stA,
+                                         int*                 ipiv,
+                                         int                  stP,
+                                         hipsolverComplex*    B,
+                                         int                  ldb,
+                                         int                  stB,
+                                         hipsolverComplex*    work,
+                                         int                  lwork,
+                                         int*                 info,
+                                         int                  bc)
+{
+    if(!FORTRAN)
+        return hipsolverCgetrs(handle,
+                               trans,
+                               n,
+                               nrhs,
+                               (hipFloatComplex*)A,
+                               lda,
+                               ipiv,
+                               (hipFloatComplex*)B,
+                               ldb,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info);
+    else
+        return hipsolverCgetrsFortran(handle,
+                                      trans,
+                                      n,
+                                      nrhs,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      ipiv,
+                                      (hipFloatComplex*)B,
+                                      ldb,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info);
+}
+
+inline hipsolverStatus_t hipsolver_getrs(bool                    FORTRAN,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverOperation_t    trans,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb,
+                                         int                     stB,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    if(!FORTRAN)
+        return hipsolverZgetrs(handle,
+                               trans,
+                               n,
+                               nrhs,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               ipiv,
+                               (hipDoubleComplex*)B,
+                               ldb,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               info);
+    else
+        return hipsolverZgetrsFortran(handle,
+                                      trans,
+                                      n,
+                                      nrhs,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      ipiv,
+                                      (hipDoubleComplex*)B,
+                                      ldb,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info);
+}
+/********************************************************/
+
+/******************** GETRF_HOST ********************/
+// normal
+inline hipsolverStatus_t hipsolver_getrf_host(bool              FORTRAN,
+                                              hipsolverHandle_t handle,
+                                              int               m,
+                                              int               n,
+                                              float*            A,
+                                              int               lda,
+                                              int*              ipiv,
+                                              int               stP,
+                                              int*              info,
+                                              int               bc)
+{
+    if(!FORTRAN)
+        return hipsolverSgetrfHost(handle, m, n, A, lda, ipiv, info);
+    else
+        return hipsolverSgetrfHostFortran(handle, m, n, A, lda, ipiv, info);
+}
+
+inline hipsolverStatus_t hipsolver_getrf_host(bool              FORTRAN,
+                                              hipsolverHandle_t handle,
+                                              int               m,
+                                              int               n,
+                                              double*           A,
+                                              int               lda,
+                                              int*              ipiv,
+                                              int               stP,
+                                              int*              info,
+                                              int               bc)
+{
+    if(!FORTRAN)
+        return hipsolverDgetrfHost(handle, m, n, A, lda, ipiv, info);
+    else
+        return hipsolverDgetrfHostFortran(handle, m, n, A, lda, ipiv, info);
+}
+
+inline hipsolverStatus_t hipsolver_getrf_host(bool              FORTRAN,
+                                              hipsolverHandle_t handle,
+                                              int               m,
+                                              int               n,
+                                              hipsolverComplex* A,
+                                              int               lda,
+                                              int*              ipiv,
+                                              int               stP,
+                                              int*              info,
+                                              int               bc)
+{
+    if(!FORTRAN)
+        return hipsolverCgetrfHost(handle, m, n, (hipFloatComplex*)A, lda, ipiv, info);
+    else
+        return hipsolverCgetrfHostFortran(handle, m, n, (hipFloatComplex*)A, lda, ipiv, info);
+}
+
+inline hipsolverStatus_t hipsolver_getrf_host(bool                    FORTRAN,
+                                              hipsolverHandle_t       handle,
+                                              int                     m,
+                                              int                     n,
+                                              hipsolverDoubleComplex* A,
+                                              int                     lda,
+                                              int*                    ipiv,
+                                              int                     stP,
+                                              int*                    info,
+                                              int                     bc)
+{
+    if(!FORTRAN)
+        return hipsolverZgetrfHost(handle, m, n, (hipDoubleComplex*)A, lda, ipiv, info);
+    else
+        return hipsolverZgetrfHostFortran(handle, m, n, (hipDoubleComplex*)A, lda, ipiv, info);
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_getrf_host(bool              FORTRAN,
+                                              hipsolverHandle_t handle,
+                                              int               m,
+                                              int               n,
+                                              float*            A[],
+                                              int               lda,
+                                              int*              ipiv,
+                                              int               strideP,
+                                              int*              info,
+                                              int               bc)
+{
+    if(!FORTRAN)
+        return hipsolverSgetrfBatchedHost(handle, m, n, A, lda, ipiv, strideP, info, bc);
+    else
+        return hipsolverSgetrfBatchedHostFortran(handle, m, n, A, lda, ipiv, strideP, info, bc);
+}
+
+inline hipsolverStatus_t hipsolver_getrf_host(bool              FORTRAN,
+                                              hipsolverHandle_t handle,
+                                              int               m,
+                                              int               n,
+                                              double*           A[],
+                                              int               lda,
+                                              int*              ipiv,
+                                              int               strideP,
+                                              int*              info,
+                                              int               bc)
+{
+    if(!FORTRAN)
+        return hipsolverDgetrfBatchedHost(handle, m, n, A, lda, ipiv, strideP, info, bc);
+    else
+        return hipsolverDgetrfBatchedHostFortran(handle, m, n, A, lda, ipiv, strideP, info, bc);
+}
+
+inline hipsolverStatus_t hipsolver_getrf_host(bool              FORTRAN,
+                                              hipsolverHandle_t handle,
+                                              int               m,
+                                              int               n,
+                                              hipsolverComplex* A[],
+                                              int               lda,
+                                              int*              ipiv,
+                                              int               strideP,
+                                              int*              info,
+                                              int               bc)
+{
+    if(!FORTRAN)
+        return hipsolverCgetrfBatchedHost(
+            handle, m, n, (hipFloatComplex**)A, lda, ipiv, strideP, info, bc);
+    else
+        return hipsolverCgetrfBatchedHostFortran(
+            handle, m, n, (hipFloatComplex**)A, lda, ipiv, strideP, info, bc);
+}
+
+inline hipsolverStatus_t hipsolver_getrf_host(bool                    FORTRAN,
+                                              hipsolverHandle_t       handle,
+                                              int                     m,
+                                              int                     n,
+                                              hipsolverDoubleComplex* A[],
+                                              int                     lda,
+                                              int*                    ipiv,
+                                              int                     strideP,
+                                              int*                    info,
+                                              int                     bc)
+{
+    if(!FORTRAN)
+        return hipsolverZgetrfBatchedHost(
+            handle, m, n, (hipDoubleComplex**)A, lda, ipiv, strideP, info, bc);
+    else
+        return hipsolverZgetrfBatchedHostFortran(
+            handle, m, n, (hipDoubleComplex**)A, lda, ipiv, strideP, info, bc);
+}
+/********************************************************/
+
+/******************** GETRS_HOST ********************/
+// normal
+inline hipsolverStatus_t hipsolver_getrs_host(bool                 FORTRAN,
+                                              hipsolverHandle_t    handle,
+                                              hipsolverOperation_t trans,
+                                              int                  n,
+                                              int                  nrhs,
+                                              float*               A,
+                                              int                  lda,
+                                              int*                 ipiv,
+                                              int                  stP,
+                                              float*               B,
+                                              int                  ldb,
+                                              int*                 info,
+                                              int                  bc)
+{
+    if(!FORTRAN)
+        return hipsolverSgetrsHost(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+    else
+        return hipsolverSgetrsHostFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline hipsolverStatus_t hipsolver_getrs_host(bool                 FORTRAN,
+                                              hipsolverHandle_t    handle,
+                                              hipsolverOperation_t trans,
+                                              int                  n,
+                                              int                  nrhs,
+                                              double*              A,
+                                              int                  lda,
+                                              int*                 ipiv,
+                                              int                  stP,
+                                              double*              B,
+                                              int                  ldb,
+                                              int*                 info,
+                                              int                  bc)
+{
+    if(!FORTRAN)
+        return hipsolverDgetrsHost(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+    else
+        return hipsolverDgetrsHostFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline hipsolverStatus_t hipsolver_getrs_host(bool                 FORTRAN,
+                                              hipsolverHandle_t    handle,
+                                              hipsolverOperation_t trans,
+                                              int                  n,
+                                              int                  nrhs,
+                                              hipsolverComplex*    A,
+                                              int                  lda,
+                                              int*                 ipiv,
+                                              int                  stP,
+                                              hipsolverComplex*    B,
+                                              int                  ldb,
+                                              int*                 info,
+                                              int                  bc)
+{
+    if(!FORTRAN)
+        return hipsolverCgetrsHost(
+            handle, trans, n, nrhs, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)B, ldb, info);
+    else
+        return hipsolverCgetrsHostFortran(
+            handle, trans, n, nrhs, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)B, ldb, info);
+}
+
+inline hipsolverStatus_t hipsolver_getrs_host(bool                    FORTRAN,
+                                              hipsolverHandle_t       handle,
+                                              hipsolverOperation_t    trans,
+                                              int                     n,
+                                              int                     nrhs,
+                                              hipsolverDoubleComplex* A,
+                                              int                     lda,
+                                              int*                    ipiv,
+                                              int                     stP,
+                                              hipsolverDoubleComplex* B,
+                                              int                     ldb,
+                                              int*                    info,
+                                              int                     bc)
+{
+    if(!FORTRAN)
+        return hipsolverZgetrsHost(handle,
+                                   trans,
+                                   n,
+                                   nrhs,
+                                   (hipDoubleComplex*)A,
+                                   lda,
+                                   ipiv,
+                                   (hipDoubleComplex*)B,
+                                   ldb,
+                                   info);
+    else
+        return hipsolverZgetrsHostFortran(handle,
+                                          trans,
+                                          n,
+                                          nrhs,
+                                          (hipDoubleComplex*)A,
+                                          lda,
+                                          ipiv,
+                                          (hipDoubleComplex*)B,
+                                          ldb,
+                                          info);
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_getrs_host(bool                 FORTRAN,
+                                              hipsolverHandle_t    handle,
+                                              hipsolverOperation_t trans,
+                                              int                  n,
+                                              int                  nrhs,
+                                              float*               A[],
+                                              int                  lda,
+                                              int*                 ipiv,
+                                              int                  strideP,
+                                              float*               B[],
+                                              int                  ldb,
+                                              int*                 info,
+                                              int                  bc)
+{
+    if(!FORTRAN)
+        return hipsolverSgetrsBatchedHost(
+            handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, bc);
+    else
+        return hipsolverSgetrsBatchedHostFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, bc);
+}
+
+inline hipsolverStatus_t hipsolver_getrs_host(bool                 FORTRAN,
+                                              hipsolverHandle_t    handle,
+                                              hipsolverOperation_t trans,
+                                              int                  n,
+                                              int                  nrhs,
+                                              double*              A[],
+                                              int                  lda,
+                                              int*                 ipiv,
+                                              int                  strideP,
+                                              double*              B[],
+                                              int                  ldb,
+                                              int*                 info,
+                                              int                  bc)
+{
+    if(!FORTRAN)
+        return hipsolverDgetrsBatchedHost(
+            handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, bc);
+    else
+        return hipsolverDgetrsBatchedHostFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, bc);
+}
+
+inline hipsolverStatus_t hipsolver_getrs_host(bool                 FORTRAN,
+                                              hipsolverHandle_t    handle,
+                                              hipsolverOperation_t trans,
+                                              int                  n,
+                                              int                  nrhs,
+                                              hipsolverComplex*    A[],
+                                              int                  lda,
+                                              int*                 ipiv,
+                                              int                  strideP,
+                                              hipsolverComplex*    B[],
+                                              int                  ldb,
+                                              int*                 info,
+                                              int                  bc)
+{
+    if(!FORTRAN)
+        return hipsolverCgetrsBatchedHost(handle,
+                                          trans,
+                                          n,
+                                          nrhs,
+                                          (hipFloatComplex**)A,
+                                          lda,
+                                          ipiv,
+                                          strideP,
+                                          (hipFloatComplex**)B,
+                                          ldb,
+                                          info,
+                                          bc);
+    else
+        return hipsolverCgetrsBatchedHostFortran(handle,
+                                                 trans,
+                                                 n,
+                                                 nrhs,
+                                                 (hipFloatComplex**)A,
+                                                 lda,
+                                                 ipiv,
+                                                 strideP,
+                                                 (hipFloatComplex**)B,
+                                                 ldb,
+                                                 info,
+                                                 bc);
+}
+
+inline hipsolverStatus_t hipsolver_getrs_host(bool                    FORTRAN,
+                                              hipsolverHandle_t       handle,
+                                              hipsolverOperation_t    trans,
+                                              int                     n,
+                                              int                     nrhs,
+                                              hipsolverDoubleComplex* A[],
+                                              int                     lda,
+                                              int*                    ipiv,
+                                              int                     strideP,
+                                              hipsolverDoubleComplex* B[],
+                                              int                     ldb,
+                                              int*                    info,
+                                              int                     bc)
+{
+    if(!FORTRAN)
+        return hipsolverZgetrsBatchedHost(handle,
+                                          trans,
+                                          n,
+                                          nrhs,
+                                          (hipDoubleComplex**)A,
+                                          lda,
+                                          ipiv,
+                                          strideP,
+                                          (hipDoubleComplex**)B,
+                                          ldb,
+                                          info,
+                                          bc);
+    else
+        return hipsolverZgetrsBatchedHostFortran(handle,
+                                                 trans,
+                                                 n,
+                                                 nrhs,
+                                                 (hipDoubleComplex**)A,
+                                                 lda,
+                                                 ipiv,
+                                                 strideP,
+                                                 (hipDoubleComplex**)B,
+                                                 ldb,
+                                                 info,
+                                                 bc);
+}
+/********************************************************/
+
+/******************** COMPACT ********************/
+inline hipsolverStatus_t hipsolver_pack_compact(bool              FORTRAN,
+                                                hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                const float*      A,
+                                                int               lda,
+                                                int               strideA,
+                                                float*            Ac,
+                                                int               batch_count)
+{
+    if(!FORTRAN)
+        return hipsolverSpackCompact(handle, m, n, A, lda, strideA, Ac, batch_count);
+    else
+        return hipsolverSpackCompactFortran(handle, m, n, A, lda, strideA, Ac, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_pack_compact(bool              FORTRAN,
+                                                hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                const double*     A,
+                                                int               lda,
+                                                int               strideA,
+                                                double*           Ac,
+                                                int               batch_count)
+{
+    if(!FORTRAN)
+        return hipsolverDpackCompact(handle, m, n, A, lda, strideA, Ac, batch_count);
+    else
+        return hipsolverDpackCompactFortran(handle, m, n, A, lda, strideA, Ac, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_pack_compact(bool                    FORTRAN,
+                                                hipsolverHandle_t       handle,
+                                                int                     m,
+                                                int                     n,
+                                                const hipsolverComplex* A,
+                                                int                     lda,
+                                                int                     strideA,
+                                                hipsolverComplex*       Ac,
+                                                int                     batch_count)
+{
+    if(!FORTRAN)
+        return hipsolverCpackCompact(handle,
+                                     m,
+                                     n,
+                                     (const hipFloatComplex*)A,
+                                     lda,
+                                     strideA,
+                                     (hipFloatComplex*)Ac,
+                                     batch_count);
+    else
+        return hipsolverCpackCompactFortran(handle,
+                                            m,
+                                            n,
+                                            (const hipFloatComplex*)A,
+                                            lda,
+                                            strideA,
+                                            (hipFloatComplex*)Ac,
+                                            batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_pack_compact(bool                          FORTRAN,
+                                                hipsolverHandle_t             handle,
+                                                int                           m,
+                                                int                           n,
+                                                const hipsolverDoubleComplex* A,
+                                                int                           lda,
+                                                int                           strideA,
+                                                hipsolverDoubleComplex*       Ac,
+                                                int                           batch_count)
+{
+    if(!FORTRAN)
+        return hipsolverZpackCompact(handle,
+                                     m,
+                                     n,
+                                     (const hipDoubleComplex*)A,
+                                     lda,
+                                     strideA,
+                                     (hipDoubleComplex*)Ac,
+                                     batch_count);
+    else
+        return hipsolverZpackCompactFortran(handle,
+                                            m,
+                                            n,
+                                            (const hipDoubleComplex*)A,
+                                            lda,
+                                            strideA,
+                                            (hipDoubleComplex*)Ac,
+                                            batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_unpack_compact(bool              FORTRAN,
+                                                  hipsolverHandle_t handle,
+                                                  int               m,
+                                                  int               n,
+                                                  const float*      Ac,
+                                                  float*            A,
+                                                  int               lda,
+                                                  int               strideA,
+                                                  int               batch_count)
+{
+    if(!FORTRAN)
+        return hipsolverSunpackCompact(handle, m, n, Ac, A, lda, strideA, batch_count);
+    else
+        return hipsolverSunpackCompactFortran(handle, m, n, Ac, A, lda, strideA, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_unpack_compact(bool              FORTRAN,
+                                                  hipsolverHandle_t handle,
+                                                  int               m,
+                                                  int               n,
+                                                  const double*     Ac,
+                                                  double*           A,
+                                                  int               lda,
+                                                  int               strideA,
+                                                  int               batch_count)
+{
+    if(!FORTRAN)
+        return hipsolverDunpackCompact(handle, m, n, Ac, A, lda, strideA, batch_count);
+    else
+        return hipsolverDunpackCompactFortran(handle, m, n, Ac, A, lda, strideA, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_unpack_compact(bool                    FORTRAN,
+                                                  hipsolverHandle_t       handle,
+                                                  int                     m,
+                                                  int                     n,
+                                                  const hipsolverComplex* Ac,
+                                                  hipsolverComplex*       A,
+                                                  int                     lda,
+                                                  int                     strideA,
+                                                  int                     batch_count)
+{
+    if(!FORTRAN)
+        return hipsolverCunpackCompact(handle,
+                                       m,
+                                       n,
+                                       (const hipFloatComplex*)Ac,
+                                       (hipFloatComplex*)A,
+                                       lda,
+                                       strideA,
+                                       batch_count);
+    else
+        return hipsolverCunpackCompactFortran(handle,
+                                              m,
+                                              n,
+                                              (const hipFloatComplex*)Ac,
+                                              (hipFloatComplex*)A,
+                                              lda,
+                                              strideA,
+                                              batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_unpack_compact(bool                          FORTRAN,
+                                                  hipsolverHandle_t             handle,
+                                                  int                           m,
+                                                  int                           n,
+                                                  const hipsolverDoubleComplex* Ac,
+                                                  hipsolverDoubleComplex*       A,
+                                                  int                           lda,
+                                                  int                           strideA,
+                                                  int                           batch_count)
+{
+    if(!FORTRAN)
+        return hipsolverZunpackCompact(handle,
+                                       m,
+                                       n,
+                                       (const hipDoubleComplex*)Ac,
+                                       (hipDoubleComplex*)A,
+                                       lda,
+                                       strideA,
+                                       batch_count);
+    else
+        return hipsolverZunpackCompactFortran(handle,
+                                              m,
+                                              n,
+                                              (const hipDoubleComplex*)Ac,
+                                              (hipDoubleComplex*)A,
+                                              lda,
+                                              strideA,
+                                              batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_potrf_compact(bool                FORTRAN,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 float*              Ac,
+                                                 int*                devInfo,
+                                                 int                 batch_count)
+{
+    if(!FORTRAN)
+        return hipsolverSpotrfCompact(handle, uplo, n, Ac, devInfo, batch_count);
+    else
+        return hipsolverSpotrfCompactFortran(handle, uplo, n, Ac, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_potrf_compact(bool                FORTRAN,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 double*             Ac,
+                                                 int*                devInfo,
+                                                 int                 batch_count)
+{
+    if(!FORTRAN)
+        return hipsolverDpotrfCompact(handle, uplo, n, Ac, devInfo, batch_count);
+    else
+        return hipsolverDpotrfCompactFortran(handle, uplo, n, Ac, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_potrf_compact(bool                FORTRAN,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 hipsolverComplex*   Ac,
+                                                 int*                devInfo,
+                                                 int                 batch_count)
+{
+    if(!FORTRAN)
+        return hipsolverCpotrfCompact(handle, uplo, n, (hipFloatComplex*)Ac, devInfo, batch_count);
+    else
+        return hipsolverCpotrfCompactFortran(
+            handle, uplo, n, (hipFloatComplex*)Ac, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_potrf_compact(bool                    FORTRAN,
+                                                 hipsolverHandle_t       handle,
+                                                 hipsolverFillMode_t     uplo,
+                                                 int                     n,
+                                                 hipsolverDoubleComplex* Ac,
+                                                 int*                    devInfo,
+                                                 int                     batch_count)
 {
     if(!FORTRAN)
-        return hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+        return hipsolverZpotrfCompact(handle, uplo, n, (hipDoubleComplex*)Ac, devInfo, batch_count);
     else
-        return hipsolverSgetrs_bufferSizeFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+        return hipsolverZpotrfCompactFortran(
+            handle, uplo, n, (hipDoubleComplex*)Ac, devInfo, batch_count);
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                 FORTRAN,
-                                                    hipsolverHandle_t    handle,
-                                                    hipsolverOperation_t trans,
-                                                    int                  n,
-                                                    int                  nrhs,
-                                                    double*              A,
-                                                    int                  lda,
-                                                    int*                 ipiv,
-                                                    double*              B,
-                                                    int                  ldb,
-                                                    int*                 lwork)
+inline hipsolverStatus_t hipsolver_getrf_compact(bool              FORTRAN,
+                                                 hipsolverHandle_t handle,
+                                                 int               n,
+                                                 float*            Ac,
+                                                 int*              devIpiv,
+                                                 int*              devInfo,
+                                                 int               batch_count)
 {
     if(!FORTRAN)
-        return hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+        return hipsolverSgetrfCompact(handle, n, Ac, devIpiv, devInfo, batch_count);
     else
-        return hipsolverDgetrs_bufferSizeFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+        return hipsolverSgetrfCompactFortran(handle, n, Ac, devIpiv, devInfo, batch_count);
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                 FORTRAN,
-                                                    hipsolverHandle_t    handle,
-                                                    hipsolverOperation_t trans,
-                                                    int                  n,
-                                                    int                  nrhs,
-                                                    hipsolverComplex*    A,
-                                                    int                  lda,
-                                                    int*                 ipiv,
-                                                    hipsolverComplex*    B,
-                                                    int                  ldb,
-                                                    int*                 lwork)
+inline hipsolverStatus_t hipsolver_getrf_compact(bool              FORTRAN,
+                                                 hipsolverHandle_t handle,
+                                                 int               n,
+                                                 double*           Ac,
+                                                 int*              devIpiv,
+                                                 int*              devInfo,
+                                                 int               batch_count)
 {
     if(!FORTRAN)
-        return hipsolverCgetrs_bufferSize(handle,
-                                          trans,
-                                          n,
-                                          nrhs,
-                                          (hipFloatComplex*)A,
-                                          lda,
-                                          ipiv,
-                                          (hipFloatComplex*)B,
-                                          ldb,
-                                          lwork);
+        return hipsolverDgetrfCompact(handle, n, Ac, devIpiv, devInfo, batch_count);
     else
-        return hipsolverCgetrs_bufferSizeFortran(handle,
-                                                 trans,
-                                                 n,
-                                                 nrhs,
-                                                 (hipFloatComplex*)A,
-                                                 lda,
-                                                 ipiv,
-                                                 (hipFloatComplex*)B,
-                                                 ldb,
-                                                 lwork);
+        return hipsolverDgetrfCompactFortran(handle, n, Ac, devIpiv, devInfo, batch_count);
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                    FORTRAN,
-                                                    hipsolverHandle_t       handle,
-                                                    hipsolverOperation_t    trans,
-                                                    int                     n,
-                                                    int                     nrhs,
-                                                    hipsolverDoubleComplex* A,
-                                                    int                     lda,
-                                                    int*                    ipiv,
-                                                    hipsolverDoubleComplex* B,
-                                                    int                     ldb,
-                                                    int*                    lwork)
+inline hipsolverStatus_t hipsolver_getrf_compact(bool              FORTRAN,
+                                                 hipsolverHandle_t handle,
+                                                 int               n,
+                                                 hipsolverComplex* Ac,
+                                                 int*              devIpiv,
+                                                 int*              devInfo,
+                                                 int               batch_count)
 {
     if(!FORTRAN)
-        return hipsolverZgetrs_bufferSize(handle,
-                                          trans,
-                                          n,
-                                          nrhs,
-                                          (hipDoubleComplex*)A,
-                                          lda,
-                                          ipiv,
-                                          (hipDoubleComplex*)B,
-                                          ldb,
-                                          lwork);
+        return hipsolverCgetrfCompact(
+            handle, n, (hipFloatComplex*)Ac, devIpiv, devInfo, batch_count);
     else
-        return hipsolverZgetrs_bufferSizeFortran(handle,
-                                                 trans,
-                                                 n,
-                                                 nrhs,
-                                                 (hipDoubleComplex*)A,
-                                                 lda,
-                                                 ipiv,
-                                                 (hipDoubleComplex*)B,
-                                                 ldb,
-                                                 lwork);
+        return hipsolverCgetrfCompactFortran(
+            handle, n, (hipFloatComplex*)Ac, devIpiv, devInfo, batch_count);
 }
 
-inline hipsolverStatus_t hipsolver_getrs(bool                 FORTRAN,
-                                         hipsolverHandle_t    handle,
-                                         hipsolverOperation_t trans,
-                                         int                  n,
-                                         int                  nrhs,
-                                         float*               A,
-                                         int                  lda,
-                                         int                  stA,
-                                         int*                 ipiv,
-                                         int                  stP,
-                                         float*               B,
-                                         int                  ldb,
-                                         int                  stB,
-                                         float*               work,
-                                         int                  lwork,
-                                         int*                 info,
-                                         int                  bc)
+inline hipsolverStatus_t hipsolver_getrf_compact(bool                    FORTRAN,
+                                                 hipsolverHandle_t       handle,
+                                                 int                     n,
+                                                 hipsolverDoubleComplex* Ac,
+                                                 int*                    devIpiv,
+                                                 int*                    devInfo,
+                                                 int                     batch_count)
 {
     if(!FORTRAN)
-        return hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+        return hipsolverZgetrfCompact(
+            handle, n, (hipDoubleComplex*)Ac, devIpiv, devInfo, batch_count);
     else
-        return hipsolverSgetrsFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+        return hipsolverZgetrfCompactFortran(
+            handle, n, (hipDoubleComplex*)Ac, devIpiv, devInfo, batch_count);
 }
 
-inline hipsolverStatus_t hipsolver_getrs(bool                 FORTRAN,
-                                         hipsolverHandle_t    handle,
-                                         hipsolverOperation_t trans,
-                                         int                  n,
-                                         int                  nrhs,
-                                         double*              A,
-                                         int                  lda,
-                                         int                  stA,
-                                         int*                 ipiv,
-                                         int                  stP,
-                                         double*              B,
-                                         int                  ldb,
-                                         int                  stB,
-                                         double*              work,
-                                         int                  lwork,
-                                         int*                 info,
-                                         int                  bc)
+inline hipsolverStatus_t hipsolver_getrs_compact(bool                 FORTRAN,
+                                                 hipsolverHandle_t    handle,
+                                                 hipsolverOperation_t trans,
+                                                 int                  n,
+                                                 int                  nrhs,
+                                                 const float*         Ac,
+                                                 const int*           devIpiv,
+                                                 float*               Bc,
+                                                 int*                 devInfo,
+                                                 int                  batch_count)
 {
     if(!FORTRAN)
-        return hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+        return hipsolverSgetrsCompact(
+            handle, trans, n, nrhs, Ac, devIpiv, Bc, devInfo, batch_count);
     else
-        return hipsolverDgetrsFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+        return hipsolverSgetrsCompactFortran(
+            handle, trans, n, nrhs, Ac, devIpiv, Bc, devInfo, batch_count);
 }
 
-inline hipsolverStatus_t hipsolver_getrs(bool                 FORTRAN,
-                                         hipsolverHandle_t    handle,
-                                         hipsolverOperation_t trans,
-                                         int                  n,
-                                         int                  nrhs,
-                                         hipsolverComplex*    A,
-                                         int                  lda,
-                                         int                  stA,
-                                         int*                 ipiv,
-                                         int                  stP,
-                                         hipsolverComplex*    B,
-                                         int                  ldb,
-                                         int                  stB,
-                                         hipsolverComplex*    work,
-                                         int                  lwork,
-                                         int*                 info,
-                                         int                  bc)
+inline hipsolverStatus_t hipsolver_getrs_compact(bool                 FORTRAN,
+                                                 hipsolverHandle_t    handle,
+                                                 hipsolverOperation_t trans,
+                                                 int                  n,
+                                                 int                  nrhs,
+                                                 const double*        Ac,
+                                                 const int*           devIpiv,
+                                                 double*              Bc,
+                                                 int*                 devInfo,
+                                                 int                  batch_count)
 {
     if(!FORTRAN)
-        return hipsolverCgetrs(handle,
-                               trans,
-                               n,
-                               nrhs,
-                               (hipFloatComplex*)A,
-                               lda,
-                               ipiv,
-                               (hipFloatComplex*)B,
-                               ldb,
-                               (hipFloatComplex*)work,
-                               lwork,
-                               info);
+        return hipsolverDgetrsCompact(
+            handle, trans, n, nrhs, Ac, devIpiv, Bc, devInfo, batch_count);
     else
-        return hipsolverCgetrsFortran(handle,
+        return hipsolverDgetrsCompactFortran(
+            handle, trans, n, nrhs, Ac, devIpiv, Bc, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_getrs_compact(bool                    FORTRAN,
+                                                 hipsolverHandle_t       handle,
+                                                 hipsolverOperation_t    trans,
+                                                 int                     n,
+                                                 int                     nrhs,
+                                                 const hipsolverComplex* Ac,
+                                                 const int*              devIpiv,
+                                                 hipsolverComplex*       Bc,
+                                                 int*                    devInfo,
+                                                 int                     batch_count)
+{
+    if(!FORTRAN)
+        return hipsolverCgetrsCompact(handle,
                                       trans,
                                       n,
                                       nrhs,
-                                      (hipFloatComplex*)A,
-                                      lda,
-                                      ipiv,
-                                      (hipFloatComplex*)B,
-                                      ldb,
-                                      (hipFloatComplex*)work,
-                                      lwork,
-                                      info);
+                                      (const hipFloatComplex*)Ac,
+                                      devIpiv,
+                                      (hipFloatComplex*)Bc,
+                                      devInfo,
+                                      batch_count);
+    else
+        return hipsolverCgetrsCompactFortran(handle,
+                                             trans,
+                                             n,
+                                             nrhs,
+                                             (const hipFloatComplex*)Ac,
+                                             devIpiv,
+                                             (hipFloatComplex*)Bc,
+                                             devInfo,
+                                             batch_count);
 }
 
-inline hipsolverStatus_t hipsolver_getrs(bool                    FORTRAN,
-                                         hipsolverHandle_t       handle,
-                                         hipsolverOperation_t    trans,
-                                         int                     n,
-                                         int                     nrhs,
-                                         hipsolverDoubleComplex* A,
-                                         int                     lda,
-                                         int                     stA,
-                                         int*                    ipiv,
-                                         int                     stP,
-                                         hipsolverDoubleComplex* B,
-                                         int                     ldb,
-                                         int                     stB,
-                                         hipsolverDoubleComplex* work,
-                                         int                     lwork,
-                                         int*                    info,
-                                         int                     bc)
+inline hipsolverStatus_t hipsolver_getrs_compact(bool                          FORTRAN,
+                                                 hipsolverHandle_t             handle,
+                                                 hipsolverOperation_t          trans,
+                                                 int                           n,
+                                                 int                           nrhs,
+                                                 const hipsolverDoubleComplex* Ac,
+                                                 const int*                    devIpiv,
+                                                 hipsolverDoubleComplex*       Bc,
+                                                 int*                          devInfo,
+                                                 int                           batch_count)
 {
     if(!FORTRAN)
-        return hipsolverZgetrs(handle,
-                               trans,
-                               n,
-                               nrhs,
-                               (hipDoubleComplex*)A,
-                               lda,
-                               ipiv,
-                               (hipDoubleComplex*)B,
-                               ldb,
-                               (hipDoubleComplex*)work,
-                               lwork,
-                               info);
-    else
-        return hipsolverZgetrsFortran(handle,
+        return hipsolverZgetrsCompact(handle,
                                       trans,
                                       n,
                                       nrhs,
-                                      (hipDoubleComplex*)A,
-                                      lda,
-                                      ipiv,
-                                      (hipDoubleComplex*)B,
-                                      ldb,
-                                      (hipDoubleComplex*)work,
-                                      lwork,
-                                      info);
+                                      (const hipDoubleComplex*)Ac,
+                                      devIpiv,
+                                      (hipDoubleComplex*)Bc,
+                                      devInfo,
+                                      batch_count);
+    else
+        return hipsolverZgetrsCompactFortran(handle,
+                                             trans,
+                                             n,
+                                             nrhs,
+                                             (const hipDoubleComplex*)Ac,
+                                             devIpiv,
+                                             (hipDoubleComplex*)Bc,
+                                             devInfo,
+                                             batch_count);
 }
 /********************************************************/
 
@@ -2431,6 +4468,186 @@ inline hipsolverStatus_t hipsolver_potrf(bool                    FORTRAN,
 }
 /********************************************************/
 
+/******************** POTRF_OUT_OF_CORE ********************/
+// normal
+inline hipsolverStatus_t hipsolver_potrf_ooc(bool                FORTRAN,
+                                             hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             size_t              deviceBudget,
+                                             int*                info)
+{
+    if(!FORTRAN)
+        return hipsolverSpotrfOutOfCore(handle, uplo, n, A, lda, deviceBudget, info);
+    else
+        return hipsolverSpotrfOutOfCoreFortran(handle, uplo, n, A, lda, deviceBudget, info);
+}
+
+inline hipsolverStatus_t hipsolver_potrf_ooc(bool                FORTRAN,
+                                             hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             size_t              deviceBudget,
+                                             int*                info)
+{
+    if(!FORTRAN)
+        return hipsolverDpotrfOutOfCore(handle, uplo, n, A, lda, deviceBudget, info);
+    else
+        return hipsolverDpotrfOutOfCoreFortran(handle, uplo, n, A, lda, deviceBudget, info);
+}
+
+inline hipsolverStatus_t hipsolver_potrf_ooc(bool                FORTRAN,
+                                             hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipsolverComplex*   A,
+                                             int                 lda,
+                                             size_t              deviceBudget,
+                                             int*                info)
+{
+    if(!FORTRAN)
+        return hipsolverCpotrfOutOfCore(
+            handle, uplo, n, (hipFloatComplex*)A, lda, deviceBudget, info);
+    else
+        return hipsolverCpotrfOutOfCoreFortran(
+            handle, uplo, n, (hipFloatComplex*)A, lda, deviceBudget, info);
+}
+
+inline hipsolverStatus_t hipsolver_potrf_ooc(bool                    FORTRAN,
+                                             hipsolverHandle_t       handle,
+                                             hipsolverFillMode_t     uplo,
+                                             int                     n,
+                                             hipsolverDoubleComplex* A,
+                                             int                     lda,
+                                             size_t                  deviceBudget,
+                                             int*                    info)
+{
+    if(!FORTRAN)
+        return hipsolverZpotrfOutOfCore(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, deviceBudget, info);
+    else
+        return hipsolverZpotrfOutOfCoreFortran(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, deviceBudget, info);
+}
+/********************************************************/
+
+/******************** POTRS_OUT_OF_CORE ********************/
+// normal
+inline hipsolverStatus_t hipsolver_potrs_ooc(bool                FORTRAN,
+                                             hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              B,
+                                             int                 ldb,
+                                             size_t              deviceBudget,
+                                             int*                info)
+{
+    if(!FORTRAN)
+        return hipsolverSpotrsOutOfCore(handle, uplo, n, nrhs, A, lda, B, ldb, deviceBudget, info);
+    else
+        return hipsolverSpotrsOutOfCoreFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, deviceBudget, info);
+}
+
+inline hipsolverStatus_t hipsolver_potrs_ooc(bool                FORTRAN,
+                                             hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             B,
+                                             int                 ldb,
+                                             size_t              deviceBudget,
+                                             int*                info)
+{
+    if(!FORTRAN)
+        return hipsolverDpotrsOutOfCore(handle, uplo, n, nrhs, A, lda, B, ldb, deviceBudget, info);
+    else
+        return hipsolverDpotrsOutOfCoreFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, deviceBudget, info);
+}
+
+inline hipsolverStatus_t hipsolver_potrs_ooc(bool                FORTRAN,
+                                             hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipsolverComplex*   A,
+                                             int                 lda,
+                                             hipsolverComplex*   B,
+                                             int                 ldb,
+                                             size_t              deviceBudget,
+                                             int*                info)
+{
+    if(!FORTRAN)
+        return hipsolverCpotrsOutOfCore(handle,
+                                        uplo,
+                                        n,
+                                        nrhs,
+                                        (hipFloatComplex*)A,
+                                        lda,
+                                        (hipFloatComplex*)B,
+                                        ldb,
+                                        deviceBudget,
+                                        info);
+    else
+        return hipsolverCpotrsOutOfCoreFortran(handle,
+                                               uplo,
+                                               n,
+                                               nrhs,
+                                               (hipFloatComplex*)A,
+                                               lda,
+                                               (hipFloatComplex*)B,
+                                               ldb,
+                                               deviceBudget,
+                                               info);
+}
+
+inline hipsolverStatus_t hipsolver_potrs_ooc(bool                    FORTRAN,
+                                             hipsolverHandle_t       handle,
+                                             hipsolverFillMode_t     uplo,
+                                             int                     n,
+                                             int                     nrhs,
+                                             hipsolverDoubleComplex* A,
+                                             int                     lda,
+                                             hipsolverDoubleComplex* B,
+                                             int                     ldb,
+                                             size_t                  deviceBudget,
+                                             int*                    info)
+{
+    if(!FORTRAN)
+        return hipsolverZpotrsOutOfCore(handle,
+                                        uplo,
+                                        n,
+                                        nrhs,
+                                        (hipDoubleComplex*)A,
+                                        lda,
+                                        (hipDoubleComplex*)B,
+                                        ldb,
+                                        deviceBudget,
+                                        info);
+    else
+        return hipsolverZpotrsOutOfCoreFortran(handle,
+                                               uplo,
+                                               n,
+                                               nrhs,
+                                               (hipDoubleComplex*)A,
+                                               lda,
+                                               (hipDoubleComplex*)B,
+                                               ldb,
+                                               deviceBudget,
+                                               info);
+}
+/********************************************************/
+
 /******************** SYEVD/HEEVD ********************/
 // normal and strided_batched
 inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(bool                FORTRAN,
@@ -2624,7 +4841,9 @@ inline hipsolverStatus_t hipsolver_syevd_heevd(bool                    FORTRAN,
 
 /******************** SYGVD/HEGVD ********************/
 // normal and strided_batched
+// (strided_batched calls the pipelined functions, with the problems stored contiguously)
 inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
                                                           hipsolverHandle_t   handle,
                                                           hipsolverEigType_t  itype,
                                                           hipsolverEigMode_t  jobz,
@@ -2635,469 +4854,978 @@ inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(bool                FO
                                                           float*              B,
                                                           int                 ldb,
                                                           float*              D,
+                                                          int*                lwork,
+                                                          int                 bc)
+{
+    if(!FORTRAN && !STRIDED)
+        return hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+    else if(!FORTRAN)
+        return hipsolverSsygvdPipelined_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork, bc);
+    else if(!STRIDED)
+        return hipsolverSsygvd_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+    else
+        return hipsolverSsygvdPipelined_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork, bc);
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigType_t  itype,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             A,
+                                                          int                 lda,
+                                                          double*             B,
+                                                          int                 ldb,
+                                                          double*             D,
+                                                          int*                lwork,
+                                                          int                 bc)
+{
+    if(!FORTRAN && !STRIDED)
+        return hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+    else if(!FORTRAN)
+        return hipsolverDsygvdPipelined_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork, bc);
+    else if(!STRIDED)
+        return hipsolverDsygvd_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+    else
+        return hipsolverDsygvdPipelined_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork, bc);
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigType_t  itype,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipsolverComplex*   A,
+                                                          int                 lda,
+                                                          hipsolverComplex*   B,
+                                                          int                 ldb,
+                                                          float*              D,
+                                                          int*                lwork,
+                                                          int                 bc)
+{
+    if(!FORTRAN && !STRIDED)
+        return hipsolverChegvd_bufferSize(handle,
+                                          itype,
+                                          jobz,
+                                          uplo,
+                                          n,
+                                          (hipFloatComplex*)A,
+                                          lda,
+                                          (hipFloatComplex*)B,
+                                          ldb,
+                                          D,
+                                          lwork);
+    else if(!FORTRAN)
+        return hipsolverChegvdPipelined_bufferSize(handle,
+                                                   itype,
+                                                   jobz,
+                                                   uplo,
+                                                   n,
+                                                   (hipFloatComplex*)A,
+                                                   lda,
+                                                   (hipFloatComplex*)B,
+                                                   ldb,
+                                                   D,
+                                                   lwork,
+                                                   bc);
+    else if(!STRIDED)
+        return hipsolverChegvd_bufferSizeFortran(handle,
+                                                 itype,
+                                                 jobz,
+                                                 uplo,
+                                                 n,
+                                                 (hipFloatComplex*)A,
+                                                 lda,
+                                                 (hipFloatComplex*)B,
+                                                 ldb,
+                                                 D,
+                                                 lwork);
+    else
+        return hipsolverChegvdPipelined_bufferSizeFortran(handle,
+                                                          itype,
+                                                          jobz,
+                                                          uplo,
+                                                          n,
+                                                          (hipFloatComplex*)A,
+                                                          lda,
+                                                          (hipFloatComplex*)B,
+                                                          ldb,
+                                                          D,
+                                                          lwork,
+                                                          bc);
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(bool                    FORTRAN,
+                                                          bool                    STRIDED,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverEigType_t      itype,
+                                                          hipsolverEigMode_t      jobz,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A,
+                                                          int                     lda,
+                                                          hipsolverDoubleComplex* B,
+                                                          int                     ldb,
+                                                          double*                 D,
+                                                          int*                    lwork,
+                                                          int                     bc)
+{
+    if(!FORTRAN && !STRIDED)
+        return hipsolverZhegvd_bufferSize(handle,
+                                          itype,
+                                          jobz,
+                                          uplo,
+                                          n,
+                                          (hipDoubleComplex*)A,
+                                          lda,
+                                          (hipDoubleComplex*)B,
+                                          ldb,
+                                          D,
+                                          lwork);
+    else if(!FORTRAN)
+        return hipsolverZhegvdPipelined_bufferSize(handle,
+                                                   itype,
+                                                   jobz,
+                                                   uplo,
+                                                   n,
+                                                   (hipDoubleComplex*)A,
+                                                   lda,
+                                                   (hipDoubleComplex*)B,
+                                                   ldb,
+                                                   D,
+                                                   lwork,
+                                                   bc);
+    else if(!STRIDED)
+        return hipsolverZhegvd_bufferSizeFortran(handle,
+                                                 itype,
+                                                 jobz,
+                                                 uplo,
+                                                 n,
+                                                 (hipDoubleComplex*)A,
+                                                 lda,
+                                                 (hipDoubleComplex*)B,
+                                                 ldb,
+                                                 D,
+                                                 lwork);
+    else
+        return hipsolverZhegvdPipelined_bufferSizeFortran(handle,
+                                                          itype,
+                                                          jobz,
+                                                          uplo,
+                                                          n,
+                                                          (hipDoubleComplex*)A,
+                                                          lda,
+                                                          (hipDoubleComplex*)B,
+                                                          ldb,
+                                                          D,
+                                                          lwork,
+                                                          bc);
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigType_t  itype,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               float*              A,
+                                               int                 lda,
+                                               int                 stA,
+                                               float*              B,
+                                               int                 ldb,
+                                               int                 stB,
+                                               float*              D,
+                                               int                 stW,
+                                               float*              work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
+{
+    if(!FORTRAN && !STRIDED)
+        return hipsolverSsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+    else if(!FORTRAN)
+        return hipsolverSsygvdPipelined(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info, bc);
+    else if(!STRIDED)
+        return hipsolverSsygvdFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+    else
+        return hipsolverSsygvdPipelinedFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info, bc);
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigType_t  itype,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               double*             A,
+                                               int                 lda,
+                                               int                 stA,
+                                               double*             B,
+                                               int                 ldb,
+                                               int                 stB,
+                                               double*             D,
+                                               int                 stW,
+                                               double*             work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
+{
+    if(!FORTRAN && !STRIDED)
+        return hipsolverDsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+    else if(!FORTRAN)
+        return hipsolverDsygvdPipelined(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info, bc);
+    else if(!STRIDED)
+        return hipsolverDsygvdFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+    else
+        return hipsolverDsygvdPipelinedFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info, bc);
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigType_t  itype,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               hipsolverComplex*   A,
+                                               int                 lda,
+                                               int                 stA,
+                                               hipsolverComplex*   B,
+                                               int                 ldb,
+                                               int                 stB,
+                                               float*              D,
+                                               int                 stW,
+                                               hipsolverComplex*   work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
+{
+    if(!FORTRAN && !STRIDED)
+        return hipsolverChegvd(handle,
+                               itype,
+                               jobz,
+                               uplo,
+                               n,
+                               (hipFloatComplex*)A,
+                               lda,
+                               (hipFloatComplex*)B,
+                               ldb,
+                               D,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info);
+    else if(!FORTRAN)
+        return hipsolverChegvdPipelined(handle,
+                                        itype,
+                                        jobz,
+                                        uplo,
+                                        n,
+                                        (hipFloatComplex*)A,
+                                        lda,
+                                        (hipFloatComplex*)B,
+                                        ldb,
+                                        D,
+                                        (hipFloatComplex*)work,
+                                        lwork,
+                                        info,
+                                        bc);
+    else if(!STRIDED)
+        return hipsolverChegvdFortran(handle,
+                                      itype,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      (hipFloatComplex*)B,
+                                      ldb,
+                                      D,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info);
+    else
+        return hipsolverChegvdPipelinedFortran(handle,
+                                               itype,
+                                               jobz,
+                                               uplo,
+                                               n,
+                                               (hipFloatComplex*)A,
+                                               lda,
+                                               (hipFloatComplex*)B,
+                                               ldb,
+                                               D,
+                                               (hipFloatComplex*)work,
+                                               lwork,
+                                               info,
+                                               bc);
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd(bool                    FORTRAN,
+                                               bool                    STRIDED,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverEigType_t      itype,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipsolverDoubleComplex* A,
+                                               int                     lda,
+                                               int                     stA,
+                                               hipsolverDoubleComplex* B,
+                                               int                     ldb,
+                                               int                     stB,
+                                               double*                 D,
+                                               int                     stW,
+                                               hipsolverDoubleComplex* work,
+                                               int                     lwork,
+                                               int*                    info,
+                                               int                     bc)
+{
+    if(!FORTRAN && !STRIDED)
+        return hipsolverZhegvd(handle,
+                               itype,
+                               jobz,
+                               uplo,
+                               n,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               (hipDoubleComplex*)B,
+                               ldb,
+                               D,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               info);
+    else if(!FORTRAN)
+        return hipsolverZhegvdPipelined(handle,
+                                        itype,
+                                        jobz,
+                                        uplo,
+                                        n,
+                                        (hipDoubleComplex*)A,
+                                        lda,
+                                        (hipDoubleComplex*)B,
+                                        ldb,
+                                        D,
+                                        (hipDoubleComplex*)work,
+                                        lwork,
+                                        info,
+                                        bc);
+    else if(!STRIDED)
+        return hipsolverZhegvdFortran(handle,
+                                      itype,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      (hipDoubleComplex*)B,
+                                      ldb,
+                                      D,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info);
+    else
+        return hipsolverZhegvdPipelinedFortran(handle,
+                                               itype,
+                                               jobz,
+                                               uplo,
+                                               n,
+                                               (hipDoubleComplex*)A,
+                                               lda,
+                                               (hipDoubleComplex*)B,
+                                               ldb,
+                                               D,
+                                               (hipDoubleComplex*)work,
+                                               lwork,
+                                               info,
+                                               bc);
+}
+/********************************************************/
+
+/******************** SYTRD/HETRD ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(bool                FORTRAN,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              A,
+                                                          int                 lda,
+                                                          float*              D,
+                                                          float*              E,
+                                                          float*              tau,
                                                           int*                lwork)
 {
     if(!FORTRAN)
-        return hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+        return hipsolverSsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
     else
-        return hipsolverSsygvd_bufferSizeFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+        return hipsolverSsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(bool                FORTRAN,
                                                           hipsolverHandle_t   handle,
-                                                          hipsolverEigType_t  itype,
-                                                          hipsolverEigMode_t  jobz,
                                                           hipsolverFillMode_t uplo,
                                                           int                 n,
                                                           double*             A,
                                                           int                 lda,
-                                                          double*             B,
-                                                          int                 ldb,
                                                           double*             D,
+                                                          double*             E,
+                                                          double*             tau,
                                                           int*                lwork)
 {
     if(!FORTRAN)
-        return hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+        return hipsolverDsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
     else
-        return hipsolverDsygvd_bufferSizeFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+        return hipsolverDsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(bool                FORTRAN,
                                                           hipsolverHandle_t   handle,
-                                                          hipsolverEigType_t  itype,
-                                                          hipsolverEigMode_t  jobz,
                                                           hipsolverFillMode_t uplo,
                                                           int                 n,
                                                           hipsolverComplex*   A,
                                                           int                 lda,
-                                                          hipsolverComplex*   B,
-                                                          int                 ldb,
                                                           float*              D,
+                                                          float*              E,
+                                                          hipsolverComplex*   tau,
                                                           int*                lwork)
 {
     if(!FORTRAN)
-        return hipsolverChegvd_bufferSize(handle,
-                                          itype,
-                                          jobz,
-                                          uplo,
-                                          n,
-                                          (hipFloatComplex*)A,
-                                          lda,
-                                          (hipFloatComplex*)B,
-                                          ldb,
-                                          D,
-                                          lwork);
+        return hipsolverChetrd_bufferSize(
+            handle, uplo, n, (hipFloatComplex*)A, lda, D, E, (hipFloatComplex*)tau, lwork);
     else
-        return hipsolverChegvd_bufferSizeFortran(handle,
-                                                 itype,
-                                                 jobz,
-                                                 uplo,
-                                                 n,
-                                                 (hipFloatComplex*)A,
-                                                 lda,
-                                                 (hipFloatComplex*)B,
-                                                 ldb,
-                                                 D,
-                                                 lwork);
+        return hipsolverChetrd_bufferSizeFortran(
+            handle, uplo, n, (hipFloatComplex*)A, lda, D, E, (hipFloatComplex*)tau, lwork);
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(bool                    FORTRAN,
+inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(bool                    FORTRAN,
                                                           hipsolverHandle_t       handle,
-                                                          hipsolverEigType_t      itype,
-                                                          hipsolverEigMode_t      jobz,
                                                           hipsolverFillMode_t     uplo,
                                                           int                     n,
                                                           hipsolverDoubleComplex* A,
                                                           int                     lda,
-                                                          hipsolverDoubleComplex* B,
-                                                          int                     ldb,
                                                           double*                 D,
+                                                          double*                 E,
+                                                          hipsolverDoubleComplex* tau,
                                                           int*                    lwork)
 {
     if(!FORTRAN)
-        return hipsolverZhegvd_bufferSize(handle,
-                                          itype,
-                                          jobz,
-                                          uplo,
-                                          n,
-                                          (hipDoubleComplex*)A,
-                                          lda,
-                                          (hipDoubleComplex*)B,
-                                          ldb,
-                                          D,
-                                          lwork);
+        return hipsolverZhetrd_bufferSize(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, D, E, (hipDoubleComplex*)tau, lwork);
     else
-        return hipsolverZhegvd_bufferSizeFortran(handle,
-                                                 itype,
-                                                 jobz,
-                                                 uplo,
-                                                 n,
-                                                 (hipDoubleComplex*)A,
-                                                 lda,
-                                                 (hipDoubleComplex*)B,
-                                                 ldb,
-                                                 D,
-                                                 lwork);
+        return hipsolverZhetrd_bufferSizeFortran(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, D, E, (hipDoubleComplex*)tau, lwork);
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                FORTRAN,
                                                hipsolverHandle_t   handle,
-                                               hipsolverEigType_t  itype,
-                                               hipsolverEigMode_t  jobz,
                                                hipsolverFillMode_t uplo,
                                                int                 n,
                                                float*              A,
                                                int                 lda,
                                                int                 stA,
-                                               float*              B,
-                                               int                 ldb,
-                                               int                 stB,
                                                float*              D,
-                                               int                 stW,
+                                               int                 stD,
+                                               float*              E,
+                                               int                 stE,
+                                               float*              tau,
+                                               int                 stP,
                                                float*              work,
                                                int                 lwork,
                                                int*                info,
                                                int                 bc)
 {
     if(!FORTRAN)
-        return hipsolverSsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+        return hipsolverSsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
     else
-        return hipsolverSsygvdFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+        return hipsolverSsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                FORTRAN,
                                                hipsolverHandle_t   handle,
-                                               hipsolverEigType_t  itype,
-                                               hipsolverEigMode_t  jobz,
                                                hipsolverFillMode_t uplo,
                                                int                 n,
                                                double*             A,
                                                int                 lda,
                                                int                 stA,
-                                               double*             B,
-                                               int                 ldb,
-                                               int                 stB,
                                                double*             D,
-                                               int                 stW,
+                                               int                 stD,
+                                               double*             E,
+                                               int                 stE,
+                                               double*             tau,
+                                               int                 stP,
                                                double*             work,
                                                int                 lwork,
                                                int*                info,
                                                int                 bc)
 {
     if(!FORTRAN)
-        return hipsolverDsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+        return hipsolverDsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
     else
-        return hipsolverDsygvdFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+        return hipsolverDsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                FORTRAN,
                                                hipsolverHandle_t   handle,
-                                               hipsolverEigType_t  itype,
-                                               hipsolverEigMode_t  jobz,
                                                hipsolverFillMode_t uplo,
                                                int                 n,
                                                hipsolverComplex*   A,
                                                int                 lda,
                                                int                 stA,
-                                               hipsolverComplex*   B,
-                                               int                 ldb,
-                                               int                 stB,
                                                float*              D,
-                                               int                 stW,
+                                               int                 stD,
+                                               float*              E,
+                                               int                 stE,
+                                               hipsolverComplex*   tau,
+                                               int                 stP,
                                                hipsolverComplex*   work,
                                                int                 lwork,
                                                int*                info,
                                                int                 bc)
 {
     if(!FORTRAN)
-        return hipsolverChegvd(handle,
-                               itype,
-                               jobz,
+        return hipsolverChetrd(handle,
                                uplo,
                                n,
                                (hipFloatComplex*)A,
                                lda,
-                               (hipFloatComplex*)B,
-                               ldb,
                                D,
+                               E,
+                               (hipFloatComplex*)tau,
                                (hipFloatComplex*)work,
                                lwork,
                                info);
     else
-        return hipsolverChegvdFortran(handle,
-                                      itype,
-                                      jobz,
+        return hipsolverChetrdFortran(handle,
                                       uplo,
                                       n,
                                       (hipFloatComplex*)A,
                                       lda,
-                                      (hipFloatComplex*)B,
-                                      ldb,
                                       D,
+                                      E,
+                                      (hipFloatComplex*)tau,
                                       (hipFloatComplex*)work,
                                       lwork,
                                       info);
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd(bool                    FORTRAN,
+inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                    FORTRAN,
                                                hipsolverHandle_t       handle,
-                                               hipsolverEigType_t      itype,
-                                               hipsolverEigMode_t      jobz,
                                                hipsolverFillMode_t     uplo,
                                                int                     n,
                                                hipsolverDoubleComplex* A,
                                                int                     lda,
                                                int                     stA,
-                                               hipsolverDoubleComplex* B,
-                                               int                     ldb,
-                                               int                     stB,
                                                double*                 D,
-                                               int                     stW,
+                                               int                     stD,
+                                               double*                 E,
+                                               int                     stE,
+                                               hipsolverDoubleComplex* tau,
+                                               int                     stP,
                                                hipsolverDoubleComplex* work,
                                                int                     lwork,
                                                int*                    info,
                                                int                     bc)
 {
     if(!FORTRAN)
-        return hipsolverZhegvd(handle,
-                               itype,
-                               jobz,
+        return hipsolverZhetrd(handle,
                                uplo,
                                n,
                                (hipDoubleComplex*)A,
                                lda,
-                               (hipDoubleComplex*)B,
-                               ldb,
                                D,
+                               E,
+                               (hipDoubleComplex*)tau,
                                (hipDoubleComplex*)work,
                                lwork,
                                info);
     else
-        return hipsolverZhegvdFortran(handle,
-                                      itype,
-                                      jobz,
+        return hipsolverZhetrdFortran(handle,
                                       uplo,
                                       n,
                                       (hipDoubleComplex*)A,
                                       lda,
-                                      (hipDoubleComplex*)B,
-                                      ldb,
                                       D,
+                                      E,
+                                      (hipDoubleComplex*)tau,
                                       (hipDoubleComplex*)work,
                                       lwork,
                                       info);
 }
 /********************************************************/
 
-/******************** SYTRD/HETRD ********************/
+/******************** SYTRF ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
+    bool FORTRAN, hipsolverHandle_t handle, int n, float* A, int lda, int* lwork)
+{
+    if(!FORTRAN)
+        return hipsolverSsytrf_bufferSize(handle, n, A, lda, lwork);
+    else
+        return hipsolverSsytrf_bufferSizeFortran(handle, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
+    bool FORTRAN, hipsolverHandle_t handle, int n, double* A, int lda, int* lwork)
+{
+    if(!FORTRAN)
+        return hipsolverDsytrf_bufferSize(handle, n, A, lda, lwork);
+    else
+        return hipsolverDsytrf_bufferSizeFortran(handle, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
+    bool FORTRAN, hipsolverHandle_t handle, int n, hipsolverComplex* A, int lda, int* lwork)
+{
+    if(!FORTRAN)
+        return hipsolverCsytrf_bufferSize(handle, n, (hipFloatComplex*)A, lda, lwork);
+    else
+        return hipsolverCsytrf_bufferSizeFortran(handle, n, (hipFloatComplex*)A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
+    bool FORTRAN, hipsolverHandle_t handle, int n, hipsolverDoubleComplex* A, int lda, int* lwork)
+{
+    if(!FORTRAN)
+        return hipsolverZsytrf_bufferSize(handle, n, (hipDoubleComplex*)A, lda, lwork);
+    else
+        return hipsolverZsytrf_bufferSizeFortran(handle, n, (hipDoubleComplex*)A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_sytrf(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    if(!FORTRAN)
+        return hipsolverSsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    else
+        return hipsolverSsytrfFortran(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_sytrf(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    if(!FORTRAN)
+        return hipsolverDsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    else
+        return hipsolverDsytrfFortran(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_sytrf(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    if(!FORTRAN)
+        return hipsolverCsytrf(
+            handle, uplo, n, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)work, lwork, info);
+    else
+        return hipsolverCsytrfFortran(
+            handle, uplo, n, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)work, lwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_sytrf(bool                    FORTRAN,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    if(!FORTRAN)
+        return hipsolverZsytrf(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, ipiv, (hipDoubleComplex*)work, lwork, info);
+    else
+        return hipsolverZsytrfFortran(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, ipiv, (hipDoubleComplex*)work, lwork, info);
+}
+/********************************************************/
+
+/******************** SYTRS ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(bool                FORTRAN,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          float*              A,
-                                                          int                 lda,
-                                                          float*              D,
-                                                          float*              E,
-                                                          float*              tau,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    int*                ipiv,
+                                                    float*              B,
+                                                    int                 ldb,
+                                                    int*                lwork)
 {
     if(!FORTRAN)
-        return hipsolverSsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
+        return hipsolverSsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork);
     else
-        return hipsolverSsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
+        return hipsolverSsytrs_bufferSizeFortran(
+            handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork);
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(bool                FORTRAN,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          double*             A,
-                                                          int                 lda,
-                                                          double*             D,
-                                                          double*             E,
-                                                          double*             tau,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    int*                ipiv,
+                                                    double*             B,
+                                                    int                 ldb,
+                                                    int*                lwork)
 {
     if(!FORTRAN)
-        return hipsolverDsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
+        return hipsolverDsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork);
     else
-        return hipsolverDsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
+        return hipsolverDsytrs_bufferSizeFortran(
+            handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork);
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(bool                FORTRAN,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          hipsolverComplex*   A,
-                                                          int                 lda,
-                                                          float*              D,
-                                                          float*              E,
-                                                          hipsolverComplex*   tau,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    int*                ipiv,
+                                                    hipsolverComplex*   B,
+                                                    int                 ldb,
+                                                    int*                lwork)
 {
     if(!FORTRAN)
-        return hipsolverChetrd_bufferSize(
-            handle, uplo, n, (hipFloatComplex*)A, lda, D, E, (hipFloatComplex*)tau, lwork);
+        return hipsolverCsytrs_bufferSize(
+            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)B, ldb, lwork);
     else
-        return hipsolverChetrd_bufferSizeFortran(
-            handle, uplo, n, (hipFloatComplex*)A, lda, D, E, (hipFloatComplex*)tau, lwork);
+        return hipsolverCsytrs_bufferSizeFortran(
+            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)B, ldb, lwork);
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(bool                    FORTRAN,
-                                                          hipsolverHandle_t       handle,
-                                                          hipsolverFillMode_t     uplo,
-                                                          int                     n,
-                                                          hipsolverDoubleComplex* A,
-                                                          int                     lda,
-                                                          double*                 D,
-                                                          double*                 E,
-                                                          hipsolverDoubleComplex* tau,
-                                                          int*                    lwork)
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(bool                    FORTRAN,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    int                     nrhs,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int*                    ipiv,
+                                                    hipsolverDoubleComplex* B,
+                                                    int                     ldb,
+                                                    int*                    lwork)
 {
     if(!FORTRAN)
-        return hipsolverZhetrd_bufferSize(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, D, E, (hipDoubleComplex*)tau, lwork);
+        return hipsolverZsytrs_bufferSize(handle,
+                                          uplo,
+                                          n,
+                                          nrhs,
+                                          (hipDoubleComplex*)A,
+                                          lda,
+                                          ipiv,
+                                          (hipDoubleComplex*)B,
+                                          ldb,
+                                          lwork);
     else
-        return hipsolverZhetrd_bufferSizeFortran(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, D, E, (hipDoubleComplex*)tau, lwork);
+        return hipsolverZsytrs_bufferSizeFortran(handle,
+                                                 uplo,
+                                                 n,
+                                                 nrhs,
+                                                 (hipDoubleComplex*)A,
+                                                 lda,
+                                                 ipiv,
+                                                 (hipDoubleComplex*)B,
+                                                 ldb,
+                                                 lwork);
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                FORTRAN,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               float*              A,
-                                               int                 lda,
-                                               int                 stA,
-                                               float*              D,
-                                               int                 stD,
-                                               float*              E,
-                                               int                 stE,
-                                               float*              tau,
-                                               int                 stP,
-                                               float*              work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_sytrs(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         float*              B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     if(!FORTRAN)
-        return hipsolverSsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+        return hipsolverSsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
     else
-        return hipsolverSsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+        return hipsolverSsytrsFortran(
+            handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                FORTRAN,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               double*             A,
-                                               int                 lda,
-                                               int                 stA,
-                                               double*             D,
-                                               int                 stD,
-                                               double*             E,
-                                               int                 stE,
-                                               double*             tau,
-                                               int                 stP,
-                                               double*             work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_sytrs(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         double*             B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     if(!FORTRAN)
-        return hipsolverDsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+        return hipsolverDsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
     else
-        return hipsolverDsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+        return hipsolverDsytrsFortran(
+            handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                FORTRAN,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               hipsolverComplex*   A,
-                                               int                 lda,
-                                               int                 stA,
-                                               float*              D,
-                                               int                 stD,
-                                               float*              E,
-                                               int                 stE,
-                                               hipsolverComplex*   tau,
-                                               int                 stP,
-                                               hipsolverComplex*   work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_sytrs(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         hipsolverComplex*   B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     if(!FORTRAN)
-        return hipsolverChetrd(handle,
+        return hipsolverCsytrs(handle,
                                uplo,
                                n,
+                               nrhs,
                                (hipFloatComplex*)A,
                                lda,
-                               D,
-                               E,
-                               (hipFloatComplex*)tau,
+                               ipiv,
+                               (hipFloatComplex*)B,
+                               ldb,
                                (hipFloatComplex*)work,
                                lwork,
                                info);
     else
-        return hipsolverChetrdFortran(handle,
+        return hipsolverCsytrsFortran(handle,
                                       uplo,
                                       n,
+                                      nrhs,
                                       (hipFloatComplex*)A,
                                       lda,
-                                      D,
-                                      E,
-                                      (hipFloatComplex*)tau,
+                                      ipiv,
+                                      (hipFloatComplex*)B,
+                                      ldb,
                                       (hipFloatComplex*)work,
                                       lwork,
                                       info);
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                    FORTRAN,
-                                               hipsolverHandle_t       handle,
-                                               hipsolverFillMode_t     uplo,
-                                               int                     n,
-                                               hipsolverDoubleComplex* A,
-                                               int                     lda,
-                                               int                     stA,
-                                               double*                 D,
-                                               int                     stD,
-                                               double*                 E,
-                                               int                     stE,
-                                               hipsolverDoubleComplex* tau,
-                                               int                     stP,
-                                               hipsolverDoubleComplex* work,
-                                               int                     lwork,
-                                               int*                    info,
-                                               int                     bc)
+inline hipsolverStatus_t hipsolver_sytrs(bool                    FORTRAN,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb,
+                                         int                     stB,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
 {
     if(!FORTRAN)
-        return hipsolverZhetrd(handle,
+        return hipsolverZsytrs(handle,
                                uplo,
                                n,
+                               nrhs,
                                (hipDoubleComplex*)A,
                                lda,
-                               D,
-                               E,
-                               (hipDoubleComplex*)tau,
+                               ipiv,
+                               (hipDoubleComplex*)B,
+                               ldb,
                                (hipDoubleComplex*)work,
                                lwork,
                                info);
     else
-        return hipsolverZhetrdFortran(handle,
+        return hipsolverZsytrsFortran(handle,
                                       uplo,
                                       n,
+                                      nrhs,
                                       (hipDoubleComplex*)A,
                                       lda,
-                                      D,
-                                      E,
-                                      (hipDoubleComplex*)tau,
+                                      ipiv,
+                                      (hipDoubleComplex*)B,
+                                      ldb,
                                       (hipDoubleComplex*)work,
                                       lwork,
                                       info);
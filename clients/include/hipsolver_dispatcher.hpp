@@ -8,10 +8,16 @@
 #include <map>
 #include <string>
 
+#include "testing_cholqr.hpp"
+#include "testing_compact.hpp"
 #include "testing_gebrd.hpp"
+#include "testing_gels.hpp"
+#include "testing_geqp3.hpp"
 #include "testing_geqrf.hpp"
+#include "testing_geqrf_tsqr.hpp"
 #include "testing_gesvd.hpp"
 #include "testing_getrf.hpp"
+#include "testing_getrf_host.hpp"
 #include "testing_getrf_npvt.hpp"
 #include "testing_getrs.hpp"
 #include "testing_orgbr_ungbr.hpp"
@@ -20,9 +26,12 @@
 #include "testing_ormqr_unmqr.hpp"
 #include "testing_ormtr_unmtr.hpp"
 #include "testing_potrf.hpp"
+#include "testing_potrf_ooc.hpp"
 #include "testing_syevd_heevd.hpp"
 #include "testing_sygvd_hegvd.hpp"
 #include "testing_sytrd_hetrd.hpp"
+#include "testing_sytrf.hpp"
+#include "testing_sytrs.hpp"
 
 struct str_less
 {
@@ -43,13 +52,26 @@ class hipsolver_dispatcher
     {
         // Map for functions that support all precisions
         static const func_map map = {
+            {"cholqr2", testing_cholqr<false, false, T>},
+            {"cholqr3", testing_cholqr<false, true, T>},
+            {"compact", testing_compact<false, T>},
             {"gebrd", testing_gebrd<false, false, false, T>},
+            {"gels", testing_gels<false, false, false, T>},
+            {"gels_batched", testing_gels<false, true, false, T>},
+            {"geqp3", testing_geqp3<false, false, T>},
+            {"geqp3_truncated", testing_geqp3<false, true, T>},
             {"geqrf", testing_geqrf<false, false, false, T>},
+            {"geqrf_tsqr", testing_geqrf_tsqr<false, false, false, T>},
             {"gesvd", testing_gesvd<false, false, false, T>},
             {"getrf", testing_getrf<false, false, false, T>},
+            {"getrf_host", testing_getrf_host<false, false, T>},
+            {"getrf_host_batched", testing_getrf_host<false, true, T>},
             {"getrs", testing_getrs<false, false, false, T>},
             {"potrf", testing_potrf<false, false, false, T>},
             {"potrf_batched", testing_potrf<false, true, false, T>},
+            {"potrf_ooc", testing_potrf_ooc<false, T>},
+            {"sytrf", testing_sytrf<false, false, false, T>},
+            {"sytrs", testing_sytrs<false, false, false, T>},
         };
 
         // Grab function from the map and execute
@@ -75,6 +97,7 @@ class hipsolver_dispatcher
             {"ormtr", testing_ormtr_unmtr<false, T>},
             {"syevd", testing_syevd_heevd<false, false, false, T>},
             {"sygvd", testing_sygvd_hegvd<false, false, false, T>},
+            {"sygvd_pipelined", testing_sygvd_hegvd<false, false, true, T>},
             {"sytrd", testing_sytrd_hetrd<false, false, false, T>},
         };
 
@@ -101,6 +124,7 @@ class hipsolver_dispatcher
             {"unmtr", testing_ormtr_unmtr<false, T>},
             {"heevd", testing_syevd_heevd<false, false, false, T>},
             {"hegvd", testing_sygvd_hegvd<false, false, false, T>},
+            {"hegvd_pipelined", testing_sygvd_hegvd<false, false, true, T>},
             {"hetrd", testing_sytrd_hetrd<false, false, false, T>},
         };
 
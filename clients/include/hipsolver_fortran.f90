@@ -841,66 +841,82 @@ module hipsolver_interface
         res = hipsolverZunmtr(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info)
     end function hipsolverZunmtrFortran
 
-    ! ******************** GEBRD ********************
-    function hipsolverSgebrd_bufferSizeFortran(handle, m, n, lwork) &
+    ! ******************** CHOLQR2 ********************
+    function hipsolverScholqr2_bufferSizeFortran(handle, m, n, A, lda, R, ldr, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverSgebrd_bufferSizeFortran')
+            bind(c, name = 'hipsolverScholqr2_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: R
+        integer(c_int), value :: ldr
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverSgebrd_bufferSize(handle, m, n, lwork)
-    end function hipsolverSgebrd_bufferSizeFortran
-    
-    function hipsolverDgebrd_bufferSizeFortran(handle, m, n, lwork) &
+        res = hipsolverScholqr2_bufferSize(handle, m, n, A, lda, R, ldr, lwork)
+    end function hipsolverScholqr2_bufferSizeFortran
+
+    function hipsolverDcholqr2_bufferSizeFortran(handle, m, n, A, lda, R, ldr, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverDgebrd_bufferSizeFortran')
+            bind(c, name = 'hipsolverDcholqr2_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: R
+        integer(c_int), value :: ldr
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverDgebrd_bufferSize(handle, m, n, lwork)
-    end function hipsolverDgebrd_bufferSizeFortran
-    
-    function hipsolverCgebrd_bufferSizeFortran(handle, m, n, lwork) &
+        res = hipsolverDcholqr2_bufferSize(handle, m, n, A, lda, R, ldr, lwork)
+    end function hipsolverDcholqr2_bufferSizeFortran
+
+    function hipsolverCcholqr2_bufferSizeFortran(handle, m, n, A, lda, R, ldr, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverCgebrd_bufferSizeFortran')
+            bind(c, name = 'hipsolverCcholqr2_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: R
+        integer(c_int), value :: ldr
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverCgebrd_bufferSize(handle, m, n, lwork)
-    end function hipsolverCgebrd_bufferSizeFortran
-    
-    function hipsolverZgebrd_bufferSizeFortran(handle, m, n, lwork) &
+        res = hipsolverCcholqr2_bufferSize(handle, m, n, A, lda, R, ldr, lwork)
+    end function hipsolverCcholqr2_bufferSizeFortran
+
+    function hipsolverZcholqr2_bufferSizeFortran(handle, m, n, A, lda, R, ldr, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverZgebrd_bufferSizeFortran')
+            bind(c, name = 'hipsolverZcholqr2_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: R
+        integer(c_int), value :: ldr
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverZgebrd_bufferSize(handle, m, n, lwork)
-    end function hipsolverZgebrd_bufferSizeFortran
+        res = hipsolverZcholqr2_bufferSize(handle, m, n, A, lda, R, ldr, lwork)
+    end function hipsolverZcholqr2_bufferSizeFortran
 
-    function hipsolverSgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+    function hipsolverScholqr2Fortran(handle, m, n, A, lda, R, ldr, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverSgebrdFortran')
+            bind(c, name = 'hipsolverScholqr2Fortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -909,20 +925,18 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: D
-        type(c_ptr), value :: E
-        type(c_ptr), value :: tauq
-        type(c_ptr), value :: taup
+        type(c_ptr), value :: R
+        integer(c_int), value :: ldr
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverSgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info)
-    end function hipsolverSgebrdFortran
+        res = hipsolverScholqr2(handle, m, n, A, lda, R, ldr, work, lwork, info)
+    end function hipsolverScholqr2Fortran
 
-    function hipsolverDgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+    function hipsolverDcholqr2Fortran(handle, m, n, A, lda, R, ldr, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverDgebrdFortran')
+            bind(c, name = 'hipsolverDcholqr2Fortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -931,20 +945,18 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: D
-        type(c_ptr), value :: E
-        type(c_ptr), value :: tauq
-        type(c_ptr), value :: taup
+        type(c_ptr), value :: R
+        integer(c_int), value :: ldr
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverDgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info)
-    end function hipsolverDgebrdFortran
+        res = hipsolverDcholqr2(handle, m, n, A, lda, R, ldr, work, lwork, info)
+    end function hipsolverDcholqr2Fortran
 
-    function hipsolverCgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+    function hipsolverCcholqr2Fortran(handle, m, n, A, lda, R, ldr, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverCgebrdFortran')
+            bind(c, name = 'hipsolverCcholqr2Fortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -953,20 +965,18 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: D
-        type(c_ptr), value :: E
-        type(c_ptr), value :: tauq
-        type(c_ptr), value :: taup
+        type(c_ptr), value :: R
+        integer(c_int), value :: ldr
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverCgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info)
-    end function hipsolverCgebrdFortran
+        res = hipsolverCcholqr2(handle, m, n, A, lda, R, ldr, work, lwork, info)
+    end function hipsolverCcholqr2Fortran
 
-    function hipsolverZgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+    function hipsolverZcholqr2Fortran(handle, m, n, A, lda, R, ldr, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverZgebrdFortran')
+            bind(c, name = 'hipsolverZcholqr2Fortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -975,21 +985,19 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: D
-        type(c_ptr), value :: E
-        type(c_ptr), value :: tauq
-        type(c_ptr), value :: taup
+        type(c_ptr), value :: R
+        integer(c_int), value :: ldr
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverZgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info)
-    end function hipsolverZgebrdFortran
+        res = hipsolverZcholqr2(handle, m, n, A, lda, R, ldr, work, lwork, info)
+    end function hipsolverZcholqr2Fortran
 
-    ! ******************** GEQRF ********************
-    function hipsolverSgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+    ! ******************** CHOLQR3 ********************
+    function hipsolverScholqr3_bufferSizeFortran(handle, m, n, A, lda, R, ldr, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverSgeqrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverScholqr3_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -998,14 +1006,16 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: R
+        integer(c_int), value :: ldr
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverSgeqrf_bufferSize(handle, m, n, A, lda, lwork)
-    end function hipsolverSgeqrf_bufferSizeFortran
-    
-    function hipsolverDgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+        res = hipsolverScholqr3_bufferSize(handle, m, n, A, lda, R, ldr, lwork)
+    end function hipsolverScholqr3_bufferSizeFortran
+
+    function hipsolverDcholqr3_bufferSizeFortran(handle, m, n, A, lda, R, ldr, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverDgeqrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverDcholqr3_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -1014,14 +1024,16 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: R
+        integer(c_int), value :: ldr
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverDgeqrf_bufferSize(handle, m, n, A, lda, lwork)
-    end function hipsolverDgeqrf_bufferSizeFortran
-    
-    function hipsolverCgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+        res = hipsolverDcholqr3_bufferSize(handle, m, n, A, lda, R, ldr, lwork)
+    end function hipsolverDcholqr3_bufferSizeFortran
+
+    function hipsolverCcholqr3_bufferSizeFortran(handle, m, n, A, lda, R, ldr, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverCgeqrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverCcholqr3_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -1030,14 +1042,16 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: R
+        integer(c_int), value :: ldr
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverCgeqrf_bufferSize(handle, m, n, A, lda, lwork)
-    end function hipsolverCgeqrf_bufferSizeFortran
-    
-    function hipsolverZgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+        res = hipsolverCcholqr3_bufferSize(handle, m, n, A, lda, R, ldr, lwork)
+    end function hipsolverCcholqr3_bufferSizeFortran
+
+    function hipsolverZcholqr3_bufferSizeFortran(handle, m, n, A, lda, R, ldr, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverZgeqrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverZcholqr3_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -1046,14 +1060,16 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: R
+        integer(c_int), value :: ldr
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverZgeqrf_bufferSize(handle, m, n, A, lda, lwork)
-    end function hipsolverZgeqrf_bufferSizeFortran
+        res = hipsolverZcholqr3_bufferSize(handle, m, n, A, lda, R, ldr, lwork)
+    end function hipsolverZcholqr3_bufferSizeFortran
 
-    function hipsolverSgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+    function hipsolverScholqr3Fortran(handle, m, n, A, lda, R, ldr, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverSgeqrfFortran')
+            bind(c, name = 'hipsolverScholqr3Fortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -1062,17 +1078,18 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: tau
+        type(c_ptr), value :: R
+        integer(c_int), value :: ldr
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverSgeqrf(handle, m, n, A, lda, tau, work, lwork, info)
-    end function hipsolverSgeqrfFortran
+        res = hipsolverScholqr3(handle, m, n, A, lda, R, ldr, work, lwork, info)
+    end function hipsolverScholqr3Fortran
 
-    function hipsolverDgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+    function hipsolverDcholqr3Fortran(handle, m, n, A, lda, R, ldr, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverDgeqrfFortran')
+            bind(c, name = 'hipsolverDcholqr3Fortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -1081,17 +1098,18 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: tau
+        type(c_ptr), value :: R
+        integer(c_int), value :: ldr
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverDgeqrf(handle, m, n, A, lda, tau, work, lwork, info)
-    end function hipsolverDgeqrfFortran
+        res = hipsolverDcholqr3(handle, m, n, A, lda, R, ldr, work, lwork, info)
+    end function hipsolverDcholqr3Fortran
 
-    function hipsolverCgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+    function hipsolverCcholqr3Fortran(handle, m, n, A, lda, R, ldr, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverCgeqrfFortran')
+            bind(c, name = 'hipsolverCcholqr3Fortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -1100,17 +1118,18 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: tau
+        type(c_ptr), value :: R
+        integer(c_int), value :: ldr
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverCgeqrf(handle, m, n, A, lda, tau, work, lwork, info)
-    end function hipsolverCgeqrfFortran
+        res = hipsolverCcholqr3(handle, m, n, A, lda, R, ldr, work, lwork, info)
+    end function hipsolverCcholqr3Fortran
 
-    function hipsolverZgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+    function hipsolverZcholqr3Fortran(handle, m, n, A, lda, R, ldr, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverZgeqrfFortran')
+            bind(c, name = 'hipsolverZcholqr3Fortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -1119,1264 +1138,3669 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: tau
+        type(c_ptr), value :: R
+        integer(c_int), value :: ldr
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverZgeqrf(handle, m, n, A, lda, tau, work, lwork, info)
-    end function hipsolverZgeqrfFortran
+        res = hipsolverZcholqr3(handle, m, n, A, lda, R, ldr, work, lwork, info)
+    end function hipsolverZcholqr3Fortran
 
-    ! ******************** GESVD ********************
-    function hipsolverSgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork) &
+    ! ******************** GEBRD ********************
+    function hipsolverSgebrd_bufferSizeFortran(handle, m, n, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverSgesvd_bufferSizeFortran')
+            bind(c, name = 'hipsolverSgebrd_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_signed_char), value :: jobu
-        integer(c_signed_char), value :: jobv
         integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork)
-    end function hipsolverSgesvd_bufferSizeFortran
+        res = hipsolverSgebrd_bufferSize(handle, m, n, lwork)
+    end function hipsolverSgebrd_bufferSizeFortran
     
-    function hipsolverDgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork) &
+    function hipsolverDgebrd_bufferSizeFortran(handle, m, n, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverDgesvd_bufferSizeFortran')
+            bind(c, name = 'hipsolverDgebrd_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_signed_char), value :: jobu
-        integer(c_signed_char), value :: jobv
         integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork)
-    end function hipsolverDgesvd_bufferSizeFortran
+        res = hipsolverDgebrd_bufferSize(handle, m, n, lwork)
+    end function hipsolverDgebrd_bufferSizeFortran
     
-    function hipsolverCgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork) &
+    function hipsolverCgebrd_bufferSizeFortran(handle, m, n, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverCgesvd_bufferSizeFortran')
+            bind(c, name = 'hipsolverCgebrd_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_signed_char), value :: jobu
-        integer(c_signed_char), value :: jobv
         integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork)
-    end function hipsolverCgesvd_bufferSizeFortran
+        res = hipsolverCgebrd_bufferSize(handle, m, n, lwork)
+    end function hipsolverCgebrd_bufferSizeFortran
     
-    function hipsolverZgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork) &
+    function hipsolverZgebrd_bufferSizeFortran(handle, m, n, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverZgesvd_bufferSizeFortran')
+            bind(c, name = 'hipsolverZgebrd_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_signed_char), value :: jobu
-        integer(c_signed_char), value :: jobv
         integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverZgesvd_bufferSize(handle, jobu, jobv, m, n, lwork)
-    end function hipsolverZgesvd_bufferSizeFortran
+        res = hipsolverZgebrd_bufferSize(handle, m, n, lwork)
+    end function hipsolverZgebrd_bufferSizeFortran
 
-    function hipsolverSgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+    function hipsolverSgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverSgesvdFortran')
+            bind(c, name = 'hipsolverSgebrdFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_signed_char), value :: jobu
-        integer(c_signed_char), value :: jobv
         integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: S
-        type(c_ptr), value :: U
-        integer(c_int), value :: ldu
-        type(c_ptr), value :: V
-        integer(c_int), value :: ldv
+        type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tauq
+        type(c_ptr), value :: taup
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
-        type(c_ptr), value :: rwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverSgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info)
-    end function hipsolverSgesvdFortran
+        res = hipsolverSgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info)
+    end function hipsolverSgebrdFortran
 
-    function hipsolverDgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+    function hipsolverDgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverDgesvdFortran')
+            bind(c, name = 'hipsolverDgebrdFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_signed_char), value :: jobu
-        integer(c_signed_char), value :: jobv
         integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: S
-        type(c_ptr), value :: U
-        integer(c_int), value :: ldu
-        type(c_ptr), value :: V
-        integer(c_int), value :: ldv
+        type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tauq
+        type(c_ptr), value :: taup
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
-        type(c_ptr), value :: rwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverDgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info)
-    end function hipsolverDgesvdFortran
+        res = hipsolverDgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info)
+    end function hipsolverDgebrdFortran
 
-    function hipsolverCgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+    function hipsolverCgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverCgesvdFortran')
+            bind(c, name = 'hipsolverCgebrdFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_signed_char), value :: jobu
-        integer(c_signed_char), value :: jobv
         integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: S
-        type(c_ptr), value :: U
-        integer(c_int), value :: ldu
-        type(c_ptr), value :: V
-        integer(c_int), value :: ldv
+        type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tauq
+        type(c_ptr), value :: taup
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
-        type(c_ptr), value :: rwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverCgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info)
-    end function hipsolverCgesvdFortran
+        res = hipsolverCgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info)
+    end function hipsolverCgebrdFortran
 
-    function hipsolverZgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+    function hipsolverZgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverZgesvdFortran')
+            bind(c, name = 'hipsolverZgebrdFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_signed_char), value :: jobu
-        integer(c_signed_char), value :: jobv
         integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: S
-        type(c_ptr), value :: U
-        integer(c_int), value :: ldu
-        type(c_ptr), value :: V
-        integer(c_int), value :: ldv
+        type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tauq
+        type(c_ptr), value :: taup
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
-        type(c_ptr), value :: rwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverZgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info)
-    end function hipsolverZgesvdFortran
+        res = hipsolverZgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info)
+    end function hipsolverZgebrdFortran
 
-    ! ******************** GETRF ********************
-    function hipsolverSgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+    ! ******************** GELS ********************
+    function hipsolverSSgels_bufferSizeFortran(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverSgetrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverSSgels_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: X
+        integer(c_int), value :: ldx
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lwork)
-    end function hipsolverSgetrf_bufferSizeFortran
-    
-    function hipsolverDgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+        res = hipsolverSSgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork)
+    end function hipsolverSSgels_bufferSizeFortran
+
+    function hipsolverDDgels_bufferSizeFortran(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverDgetrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverDDgels_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: X
+        integer(c_int), value :: ldx
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lwork)
-    end function hipsolverDgetrf_bufferSizeFortran
-    
-    function hipsolverCgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+        res = hipsolverDDgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork)
+    end function hipsolverDDgels_bufferSizeFortran
+
+    function hipsolverCCgels_bufferSizeFortran(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverCgetrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverCCgels_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: X
+        integer(c_int), value :: ldx
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverCgetrf_bufferSize(handle, m, n, A, lda, lwork)
-    end function hipsolverCgetrf_bufferSizeFortran
-    
-    function hipsolverZgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+        res = hipsolverCCgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork)
+    end function hipsolverCCgels_bufferSizeFortran
+
+    function hipsolverZZgels_bufferSizeFortran(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverZgetrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverZZgels_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: X
+        integer(c_int), value :: ldx
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverZgetrf_bufferSize(handle, m, n, A, lda, lwork)
-    end function hipsolverZgetrf_bufferSizeFortran
+        res = hipsolverZZgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork)
+    end function hipsolverZZgels_bufferSizeFortran
 
-    function hipsolverSgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info) &
+    function hipsolverSSgelsFortran(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info) &
             result(res) &
-            bind(c, name = 'hipsolverSgetrfFortran')
+            bind(c, name = 'hipsolverSSgelsFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: X
+        integer(c_int), value :: ldx
         type(c_ptr), value :: work
-        integer(c_int), value :: lwork
-        type(c_ptr), value :: ipiv
+        integer(c_size_t), value :: lwork
+        type(c_ptr), value :: niters
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverSgetrf(handle, m, n, A, lda, work, lwork, ipiv, info)
-    end function hipsolverSgetrfFortran
-    
-    function hipsolverDgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info) &
+        res = hipsolverSSgels(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info)
+    end function hipsolverSSgelsFortran
+
+    function hipsolverDDgelsFortran(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info) &
             result(res) &
-            bind(c, name = 'hipsolverDgetrfFortran')
+            bind(c, name = 'hipsolverDDgelsFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: X
+        integer(c_int), value :: ldx
         type(c_ptr), value :: work
-        integer(c_int), value :: lwork
-        type(c_ptr), value :: ipiv
+        integer(c_size_t), value :: lwork
+        type(c_ptr), value :: niters
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverDgetrf(handle, m, n, A, lda, work, lwork, ipiv, info)
-    end function hipsolverDgetrfFortran
-    
-    function hipsolverCgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info) &
+        res = hipsolverDDgels(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info)
+    end function hipsolverDDgelsFortran
+
+    function hipsolverCCgelsFortran(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info) &
             result(res) &
-            bind(c, name = 'hipsolverCgetrfFortran')
+            bind(c, name = 'hipsolverCCgelsFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: X
+        integer(c_int), value :: ldx
         type(c_ptr), value :: work
-        integer(c_int), value :: lwork
-        type(c_ptr), value :: ipiv
+        integer(c_size_t), value :: lwork
+        type(c_ptr), value :: niters
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverCgetrf(handle, m, n, A, lda, work, lwork, ipiv, info)
-    end function hipsolverCgetrfFortran
+        res = hipsolverCCgels(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info)
+    end function hipsolverCCgelsFortran
 
-    function hipsolverZgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info) &
+    function hipsolverZZgelsFortran(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info) &
             result(res) &
-            bind(c, name = 'hipsolverZgetrfFortran')
+            bind(c, name = 'hipsolverZZgelsFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: X
+        integer(c_int), value :: ldx
         type(c_ptr), value :: work
-        integer(c_int), value :: lwork
-        type(c_ptr), value :: ipiv
+        integer(c_size_t), value :: lwork
+        type(c_ptr), value :: niters
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverZgetrf(handle, m, n, A, lda, work, lwork, ipiv, info)
-    end function hipsolverZgetrfFortran
-    
-    ! ******************** GETRS ********************
-    function hipsolverSgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+        res = hipsolverZZgels(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info)
+    end function hipsolverZZgelsFortran
+
+    ! ******************** GELS_BATCHED ********************
+    function hipsolverSSgelsBatched_bufferSizeFortran(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSgetrs_bufferSizeFortran')
+            bind(c, name = 'hipsolverSSgelsBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        type(c_ptr), value :: X
+        integer(c_int), value :: ldx
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork)
-    end function hipsolverSgetrs_bufferSizeFortran
-    
-    function hipsolverDgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+        res = hipsolverSSgelsBatched_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork, batch_count)
+    end function hipsolverSSgelsBatched_bufferSizeFortran
+
+    function hipsolverDDgelsBatched_bufferSizeFortran(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDgetrs_bufferSizeFortran')
+            bind(c, name = 'hipsolverDDgelsBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        type(c_ptr), value :: X
+        integer(c_int), value :: ldx
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork)
-    end function hipsolverDgetrs_bufferSizeFortran
-    
-    function hipsolverCgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+        res = hipsolverDDgelsBatched_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork, batch_count)
+    end function hipsolverDDgelsBatched_bufferSizeFortran
+
+    function hipsolverCCgelsBatched_bufferSizeFortran(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCgetrs_bufferSizeFortran')
+            bind(c, name = 'hipsolverCCgelsBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        type(c_ptr), value :: X
+        integer(c_int), value :: ldx
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork)
-    end function hipsolverCgetrs_bufferSizeFortran
-    
-    function hipsolverZgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+        res = hipsolverCCgelsBatched_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork, batch_count)
+    end function hipsolverCCgelsBatched_bufferSizeFortran
+
+    function hipsolverZZgelsBatched_bufferSizeFortran(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZgetrs_bufferSizeFortran')
+            bind(c, name = 'hipsolverZZgelsBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        type(c_ptr), value :: X
+        integer(c_int), value :: ldx
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork)
-    end function hipsolverZgetrs_bufferSizeFortran
+        res = hipsolverZZgelsBatched_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork, batch_count)
+    end function hipsolverZZgelsBatched_bufferSizeFortran
 
-    function hipsolverSgetrsFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+    function hipsolverSSgelsBatchedFortran(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSgetrsFortran')
+            bind(c, name = 'hipsolverSSgelsBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        type(c_ptr), value :: X
+        integer(c_int), value :: ldx
         type(c_ptr), value :: work
-        integer(c_int), value :: lwork
+        integer(c_size_t), value :: lwork
+        type(c_ptr), value :: niters
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info)
-    end function hipsolverSgetrsFortran
-    
-    function hipsolverDgetrsFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+        res = hipsolverSSgelsBatched(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info, batch_count)
+    end function hipsolverSSgelsBatchedFortran
+
+    function hipsolverDDgelsBatchedFortran(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDgetrsFortran')
+            bind(c, name = 'hipsolverDDgelsBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        type(c_ptr), value :: X
+        integer(c_int), value :: ldx
         type(c_ptr), value :: work
-        integer(c_int), value :: lwork
+        integer(c_size_t), value :: lwork
+        type(c_ptr), value :: niters
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info)
-    end function hipsolverDgetrsFortran
-    
-    function hipsolverCgetrsFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+        res = hipsolverDDgelsBatched(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info, batch_count)
+    end function hipsolverDDgelsBatchedFortran
+
+    function hipsolverCCgelsBatchedFortran(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCgetrsFortran')
+            bind(c, name = 'hipsolverCCgelsBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        type(c_ptr), value :: X
+        integer(c_int), value :: ldx
         type(c_ptr), value :: work
-        integer(c_int), value :: lwork
+        integer(c_size_t), value :: lwork
+        type(c_ptr), value :: niters
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info)
-    end function hipsolverCgetrsFortran
-    
-    function hipsolverZgetrsFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+        res = hipsolverCCgelsBatched(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info, batch_count)
+    end function hipsolverCCgelsBatchedFortran
+
+    function hipsolverZZgelsBatchedFortran(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZgetrsFortran')
+            bind(c, name = 'hipsolverZZgelsBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        type(c_ptr), value :: X
+        integer(c_int), value :: ldx
         type(c_ptr), value :: work
-        integer(c_int), value :: lwork
+        integer(c_size_t), value :: lwork
+        type(c_ptr), value :: niters
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info)
-    end function hipsolverZgetrsFortran
+        res = hipsolverZZgelsBatched(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info, batch_count)
+    end function hipsolverZZgelsBatchedFortran
 
-    ! ******************** POTRF ********************
-    function hipsolverSpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+    ! ******************** GEQP3 ********************
+    function hipsolverSgeqp3_bufferSizeFortran(handle, m, n, A, lda, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverSpotrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverSgeqp3_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
-    end function hipsolverSpotrf_bufferSizeFortran
-    
-    function hipsolverDpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+        res = hipsolverSgeqp3_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverSgeqp3_bufferSizeFortran
+
+    function hipsolverDgeqp3_bufferSizeFortran(handle, m, n, A, lda, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverDpotrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverDgeqp3_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
-    end function hipsolverDpotrf_bufferSizeFortran
-    
-    function hipsolverCpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+        res = hipsolverDgeqp3_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverDgeqp3_bufferSizeFortran
+
+    function hipsolverCgeqp3_bufferSizeFortran(handle, m, n, A, lda, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverCpotrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverCgeqp3_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverCpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
-    end function hipsolverCpotrf_bufferSizeFortran
-    
-    function hipsolverZpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+        res = hipsolverCgeqp3_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverCgeqp3_bufferSizeFortran
+
+    function hipsolverZgeqp3_bufferSizeFortran(handle, m, n, A, lda, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverZpotrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverZgeqp3_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverZpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
-    end function hipsolverZpotrf_bufferSizeFortran
+        res = hipsolverZgeqp3_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverZgeqp3_bufferSizeFortran
 
-    function hipsolverSpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+    function hipsolverSgeqp3Fortran(handle, m, n, A, lda, jpvt, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverSpotrfFortran')
+            bind(c, name = 'hipsolverSgeqp3Fortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: jpvt
+        type(c_ptr), value :: tau
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info)
-    end function hipsolverSpotrfFortran
+        res = hipsolverSgeqp3(handle, m, n, A, lda, jpvt, tau, work, lwork, info)
+    end function hipsolverSgeqp3Fortran
 
-    function hipsolverDpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+    function hipsolverDgeqp3Fortran(handle, m, n, A, lda, jpvt, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverDpotrfFortran')
+            bind(c, name = 'hipsolverDgeqp3Fortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: jpvt
+        type(c_ptr), value :: tau
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info)
-    end function hipsolverDpotrfFortran
+        res = hipsolverDgeqp3(handle, m, n, A, lda, jpvt, tau, work, lwork, info)
+    end function hipsolverDgeqp3Fortran
 
-    function hipsolverCpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+    function hipsolverCgeqp3Fortran(handle, m, n, A, lda, jpvt, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverCpotrfFortran')
+            bind(c, name = 'hipsolverCgeqp3Fortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: jpvt
+        type(c_ptr), value :: tau
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverCpotrf(handle, uplo, n, A, lda, work, lwork, info)
-    end function hipsolverCpotrfFortran
+        res = hipsolverCgeqp3(handle, m, n, A, lda, jpvt, tau, work, lwork, info)
+    end function hipsolverCgeqp3Fortran
 
-    function hipsolverZpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+    function hipsolverZgeqp3Fortran(handle, m, n, A, lda, jpvt, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverZpotrfFortran')
+            bind(c, name = 'hipsolverZgeqp3Fortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: jpvt
+        type(c_ptr), value :: tau
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverZpotrf(handle, uplo, n, A, lda, work, lwork, info)
-    end function hipsolverZpotrfFortran
-    
-    ! ******************** POTRF_BATCHED ********************
-    function hipsolverSpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+        res = hipsolverZgeqp3(handle, m, n, A, lda, jpvt, tau, work, lwork, info)
+    end function hipsolverZgeqp3Fortran
+
+    ! ******************** GEQP3_TRUNCATED ********************
+    function hipsolverSgeqp3Truncated_bufferSizeFortran(handle, m, n, A, lda, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverSpotrfBatched_bufferSizeFortran')
+            bind(c, name = 'hipsolverSgeqp3Truncated_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: lwork
-        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
-    end function hipsolverSpotrfBatched_bufferSizeFortran
-    
-    function hipsolverDpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+        res = hipsolverSgeqp3Truncated_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverSgeqp3Truncated_bufferSizeFortran
+
+    function hipsolverDgeqp3Truncated_bufferSizeFortran(handle, m, n, A, lda, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverDpotrfBatched_bufferSizeFortran')
+            bind(c, name = 'hipsolverDgeqp3Truncated_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: lwork
-        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
-    end function hipsolverDpotrfBatched_bufferSizeFortran
-    
-    function hipsolverCpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+        res = hipsolverDgeqp3Truncated_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverDgeqp3Truncated_bufferSizeFortran
+
+    function hipsolverCgeqp3Truncated_bufferSizeFortran(handle, m, n, A, lda, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverCpotrfBatched_bufferSizeFortran')
+            bind(c, name = 'hipsolverCgeqp3Truncated_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: lwork
-        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
-    end function hipsolverCpotrfBatched_bufferSizeFortran
-    
-    function hipsolverZpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+        res = hipsolverCgeqp3Truncated_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverCgeqp3Truncated_bufferSizeFortran
+
+    function hipsolverZgeqp3Truncated_bufferSizeFortran(handle, m, n, A, lda, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverZpotrfBatched_bufferSizeFortran')
+            bind(c, name = 'hipsolverZgeqp3Truncated_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: lwork
-        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
-    end function hipsolverZpotrfBatched_bufferSizeFortran
+        res = hipsolverZgeqp3Truncated_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverZgeqp3Truncated_bufferSizeFortran
 
-    function hipsolverSpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+    function hipsolverSgeqp3TruncatedFortran(handle, m, n, A, lda, tol, jpvt, tau, rank, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverSpotrfBatchedFortran')
+            bind(c, name = 'hipsolverSgeqp3TruncatedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        real(c_float), value :: tol
+        type(c_ptr), value :: jpvt
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: rank
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
-        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
-    end function hipsolverSpotrfBatchedFortran
-    
-    function hipsolverDpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+        res = hipsolverSgeqp3Truncated(handle, m, n, A, lda, tol, jpvt, tau, rank, work, lwork, info)
+    end function hipsolverSgeqp3TruncatedFortran
+
+    function hipsolverDgeqp3TruncatedFortran(handle, m, n, A, lda, tol, jpvt, tau, rank, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverDpotrfBatchedFortran')
+            bind(c, name = 'hipsolverDgeqp3TruncatedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        real(c_double), value :: tol
+        type(c_ptr), value :: jpvt
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: rank
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
-        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
-    end function hipsolverDpotrfBatchedFortran
-    
-    function hipsolverCpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+        res = hipsolverDgeqp3Truncated(handle, m, n, A, lda, tol, jpvt, tau, rank, work, lwork, info)
+    end function hipsolverDgeqp3TruncatedFortran
+
+    function hipsolverCgeqp3TruncatedFortran(handle, m, n, A, lda, tol, jpvt, tau, rank, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverCpotrfBatchedFortran')
+            bind(c, name = 'hipsolverCgeqp3TruncatedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: m
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        real(c_float), value :: tol
+        type(c_ptr), value :: jpvt
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: rank
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
-        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
-    end function hipsolverCpotrfBatchedFortran
-    
-    function hipsolverZpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+        res = hipsolverCgeqp3Truncated(handle, m, n, A, lda, tol, jpvt, tau, rank, work, lwork, info)
+    end function hipsolverCgeqp3TruncatedFortran
+
+    function hipsolverZgeqp3TruncatedFortran(handle, m, n, A, lda, tol, jpvt, tau, rank, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZgeqp3TruncatedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        real(c_double), value :: tol
+        type(c_ptr), value :: jpvt
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: rank
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZgeqp3Truncated(handle, m, n, A, lda, tol, jpvt, tau, rank, work, lwork, info)
+    end function hipsolverZgeqp3TruncatedFortran
+
+    ! ******************** GEQRF ********************
+    function hipsolverSgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSgeqrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSgeqrf_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverSgeqrf_bufferSizeFortran
+    
+    function hipsolverDgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDgeqrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDgeqrf_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverDgeqrf_bufferSizeFortran
+    
+    function hipsolverCgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCgeqrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCgeqrf_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverCgeqrf_bufferSizeFortran
+    
+    function hipsolverZgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZgeqrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZgeqrf_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverZgeqrf_bufferSizeFortran
+
+    function hipsolverSgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSgeqrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSgeqrf(handle, m, n, A, lda, tau, work, lwork, info)
+    end function hipsolverSgeqrfFortran
+
+    function hipsolverDgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDgeqrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDgeqrf(handle, m, n, A, lda, tau, work, lwork, info)
+    end function hipsolverDgeqrfFortran
+
+    function hipsolverCgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCgeqrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCgeqrf(handle, m, n, A, lda, tau, work, lwork, info)
+    end function hipsolverCgeqrfFortran
+
+    function hipsolverZgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZgeqrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZgeqrf(handle, m, n, A, lda, tau, work, lwork, info)
+    end function hipsolverZgeqrfFortran
+
+    ! ******************** GEQRF_TSQR ********************
+    function hipsolverSgeqrfTsqr_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSgeqrfTsqr_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSgeqrfTsqr_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverSgeqrfTsqr_bufferSizeFortran
+
+    function hipsolverDgeqrfTsqr_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDgeqrfTsqr_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDgeqrfTsqr_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverDgeqrfTsqr_bufferSizeFortran
+
+    function hipsolverCgeqrfTsqr_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCgeqrfTsqr_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCgeqrfTsqr_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverCgeqrfTsqr_bufferSizeFortran
+
+    function hipsolverZgeqrfTsqr_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZgeqrfTsqr_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZgeqrfTsqr_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverZgeqrfTsqr_bufferSizeFortran
+
+    function hipsolverSgeqrfTsqrFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSgeqrfTsqrFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSgeqrfTsqr(handle, m, n, A, lda, tau, work, lwork, info)
+    end function hipsolverSgeqrfTsqrFortran
+
+    function hipsolverDgeqrfTsqrFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDgeqrfTsqrFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDgeqrfTsqr(handle, m, n, A, lda, tau, work, lwork, info)
+    end function hipsolverDgeqrfTsqrFortran
+
+    function hipsolverCgeqrfTsqrFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCgeqrfTsqrFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCgeqrfTsqr(handle, m, n, A, lda, tau, work, lwork, info)
+    end function hipsolverCgeqrfTsqrFortran
+
+    function hipsolverZgeqrfTsqrFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZgeqrfTsqrFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZgeqrfTsqr(handle, m, n, A, lda, tau, work, lwork, info)
+    end function hipsolverZgeqrfTsqrFortran
+
+    ! ******************** GESVD ********************
+    function hipsolverSgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSgesvd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork)
+    end function hipsolverSgesvd_bufferSizeFortran
+    
+    function hipsolverDgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDgesvd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork)
+    end function hipsolverDgesvd_bufferSizeFortran
+    
+    function hipsolverCgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCgesvd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork)
+    end function hipsolverCgesvd_bufferSizeFortran
+    
+    function hipsolverZgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZgesvd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZgesvd_bufferSize(handle, jobu, jobv, m, n, lwork)
+    end function hipsolverZgesvd_bufferSizeFortran
+
+    function hipsolverSgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSgesvdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: S
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: rwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info)
+    end function hipsolverSgesvdFortran
+
+    function hipsolverDgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDgesvdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: S
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: rwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info)
+    end function hipsolverDgesvdFortran
+
+    function hipsolverCgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCgesvdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: S
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: rwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info)
+    end function hipsolverCgesvdFortran
+
+    function hipsolverZgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZgesvdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: S
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: rwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info)
+    end function hipsolverZgesvdFortran
+
+    ! ******************** GETRF ********************
+    function hipsolverSgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverSgetrf_bufferSizeFortran
+    
+    function hipsolverDgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverDgetrf_bufferSizeFortran
+    
+    function hipsolverCgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCgetrf_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverCgetrf_bufferSizeFortran
+    
+    function hipsolverZgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZgetrf_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverZgetrf_bufferSizeFortran
+
+    function hipsolverSgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSgetrf(handle, m, n, A, lda, work, lwork, ipiv, info)
+    end function hipsolverSgetrfFortran
+    
+    function hipsolverDgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDgetrf(handle, m, n, A, lda, work, lwork, ipiv, info)
+    end function hipsolverDgetrfFortran
+    
+    function hipsolverCgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCgetrf(handle, m, n, A, lda, work, lwork, ipiv, info)
+    end function hipsolverCgetrfFortran
+
+    function hipsolverZgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZgetrf(handle, m, n, A, lda, work, lwork, ipiv, info)
+    end function hipsolverZgetrfFortran
+    
+    ! ******************** GETRS ********************
+    function hipsolverSgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork)
+    end function hipsolverSgetrs_bufferSizeFortran
+    
+    function hipsolverDgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork)
+    end function hipsolverDgetrs_bufferSizeFortran
+    
+    function hipsolverCgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork)
+    end function hipsolverCgetrs_bufferSizeFortran
+    
+    function hipsolverZgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork)
+    end function hipsolverZgetrs_bufferSizeFortran
+
+    function hipsolverSgetrsFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info)
+    end function hipsolverSgetrsFortran
+    
+    function hipsolverDgetrsFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info)
+    end function hipsolverDgetrsFortran
+    
+    function hipsolverCgetrsFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info)
+    end function hipsolverCgetrsFortran
+    
+    function hipsolverZgetrsFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info)
+    end function hipsolverZgetrsFortran
+
+    ! ******************** GETRF_HOST ********************
+    function hipsolverSgetrfHostFortran(handle, m, n, A, lda, ipiv, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrfHostFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSgetrfHost(handle, m, n, A, lda, ipiv, info)
+    end function hipsolverSgetrfHostFortran
+
+    function hipsolverDgetrfHostFortran(handle, m, n, A, lda, ipiv, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrfHostFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDgetrfHost(handle, m, n, A, lda, ipiv, info)
+    end function hipsolverDgetrfHostFortran
+
+    function hipsolverCgetrfHostFortran(handle, m, n, A, lda, ipiv, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrfHostFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCgetrfHost(handle, m, n, A, lda, ipiv, info)
+    end function hipsolverCgetrfHostFortran
+
+    function hipsolverZgetrfHostFortran(handle, m, n, A, lda, ipiv, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrfHostFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZgetrfHost(handle, m, n, A, lda, ipiv, info)
+    end function hipsolverZgetrfHostFortran
+
+    ! ******************** GETRF_BATCHED_HOST ********************
+    function hipsolverSgetrfBatchedHostFortran(handle, m, n, A, lda, ipiv, strideP, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrfBatchedHostFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgetrfBatchedHost(handle, m, n, A, lda, ipiv, strideP, info, batch_count)
+    end function hipsolverSgetrfBatchedHostFortran
+
+    function hipsolverDgetrfBatchedHostFortran(handle, m, n, A, lda, ipiv, strideP, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrfBatchedHostFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgetrfBatchedHost(handle, m, n, A, lda, ipiv, strideP, info, batch_count)
+    end function hipsolverDgetrfBatchedHostFortran
+
+    function hipsolverCgetrfBatchedHostFortran(handle, m, n, A, lda, ipiv, strideP, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrfBatchedHostFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgetrfBatchedHost(handle, m, n, A, lda, ipiv, strideP, info, batch_count)
+    end function hipsolverCgetrfBatchedHostFortran
+
+    function hipsolverZgetrfBatchedHostFortran(handle, m, n, A, lda, ipiv, strideP, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrfBatchedHostFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgetrfBatchedHost(handle, m, n, A, lda, ipiv, strideP, info, batch_count)
+    end function hipsolverZgetrfBatchedHostFortran
+
+    ! ******************** GETRS_HOST ********************
+    function hipsolverSgetrsHostFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrsHostFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSgetrsHost(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info)
+    end function hipsolverSgetrsHostFortran
+
+    function hipsolverDgetrsHostFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrsHostFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDgetrsHost(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info)
+    end function hipsolverDgetrsHostFortran
+
+    function hipsolverCgetrsHostFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrsHostFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCgetrsHost(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info)
+    end function hipsolverCgetrsHostFortran
+
+    function hipsolverZgetrsHostFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrsHostFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZgetrsHost(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info)
+    end function hipsolverZgetrsHostFortran
+
+    ! ******************** GETRS_BATCHED_HOST ********************
+    function hipsolverSgetrsBatchedHostFortran(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrsBatchedHostFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgetrsBatchedHost(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batch_count)
+    end function hipsolverSgetrsBatchedHostFortran
+
+    function hipsolverDgetrsBatchedHostFortran(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrsBatchedHostFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgetrsBatchedHost(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batch_count)
+    end function hipsolverDgetrsBatchedHostFortran
+
+    function hipsolverCgetrsBatchedHostFortran(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrsBatchedHostFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgetrsBatchedHost(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batch_count)
+    end function hipsolverCgetrsBatchedHostFortran
+
+    function hipsolverZgetrsBatchedHostFortran(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrsBatchedHostFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgetrsBatchedHost(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batch_count)
+    end function hipsolverZgetrsBatchedHostFortran
+
+    ! ******************** GETRF_COMPACT ********************
+    function hipsolverSgetrfCompactFortran(handle, n, Ac, devIpiv, devInfo, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrfCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: Ac
+        type(c_ptr), value :: devIpiv
+        type(c_ptr), value :: devInfo
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgetrfCompact(handle, n, Ac, devIpiv, devInfo, batch_count)
+    end function hipsolverSgetrfCompactFortran
+
+    function hipsolverDgetrfCompactFortran(handle, n, Ac, devIpiv, devInfo, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrfCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: Ac
+        type(c_ptr), value :: devIpiv
+        type(c_ptr), value :: devInfo
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgetrfCompact(handle, n, Ac, devIpiv, devInfo, batch_count)
+    end function hipsolverDgetrfCompactFortran
+
+    function hipsolverCgetrfCompactFortran(handle, n, Ac, devIpiv, devInfo, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrfCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: Ac
+        type(c_ptr), value :: devIpiv
+        type(c_ptr), value :: devInfo
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgetrfCompact(handle, n, Ac, devIpiv, devInfo, batch_count)
+    end function hipsolverCgetrfCompactFortran
+
+    function hipsolverZgetrfCompactFortran(handle, n, Ac, devIpiv, devInfo, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrfCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: Ac
+        type(c_ptr), value :: devIpiv
+        type(c_ptr), value :: devInfo
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgetrfCompact(handle, n, Ac, devIpiv, devInfo, batch_count)
+    end function hipsolverZgetrfCompactFortran
+
+    ! ******************** GETRS_COMPACT ********************
+    function hipsolverSgetrsCompactFortran(handle, trans, n, nrhs, Ac, devIpiv, Bc, devInfo, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrsCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: Ac
+        type(c_ptr), value :: devIpiv
+        type(c_ptr), value :: Bc
+        type(c_ptr), value :: devInfo
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgetrsCompact(handle, trans, n, nrhs, Ac, devIpiv, Bc, devInfo, batch_count)
+    end function hipsolverSgetrsCompactFortran
+
+    function hipsolverDgetrsCompactFortran(handle, trans, n, nrhs, Ac, devIpiv, Bc, devInfo, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrsCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: Ac
+        type(c_ptr), value :: devIpiv
+        type(c_ptr), value :: Bc
+        type(c_ptr), value :: devInfo
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgetrsCompact(handle, trans, n, nrhs, Ac, devIpiv, Bc, devInfo, batch_count)
+    end function hipsolverDgetrsCompactFortran
+
+    function hipsolverCgetrsCompactFortran(handle, trans, n, nrhs, Ac, devIpiv, Bc, devInfo, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrsCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: Ac
+        type(c_ptr), value :: devIpiv
+        type(c_ptr), value :: Bc
+        type(c_ptr), value :: devInfo
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgetrsCompact(handle, trans, n, nrhs, Ac, devIpiv, Bc, devInfo, batch_count)
+    end function hipsolverCgetrsCompactFortran
+
+    function hipsolverZgetrsCompactFortran(handle, trans, n, nrhs, Ac, devIpiv, Bc, devInfo, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrsCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: Ac
+        type(c_ptr), value :: devIpiv
+        type(c_ptr), value :: Bc
+        type(c_ptr), value :: devInfo
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgetrsCompact(handle, trans, n, nrhs, Ac, devIpiv, Bc, devInfo, batch_count)
+    end function hipsolverZgetrsCompactFortran
+
+    ! ******************** PACK_COMPACT/UNPACK_COMPACT ********************
+    function hipsolverSpackCompactFortran(handle, m, n, A, lda, strideA, Ac, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpackCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: Ac
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpackCompact(handle, m, n, A, lda, strideA, Ac, batch_count)
+    end function hipsolverSpackCompactFortran
+
+    function hipsolverDpackCompactFortran(handle, m, n, A, lda, strideA, Ac, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpackCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: Ac
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpackCompact(handle, m, n, A, lda, strideA, Ac, batch_count)
+    end function hipsolverDpackCompactFortran
+
+    function hipsolverCpackCompactFortran(handle, m, n, A, lda, strideA, Ac, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpackCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: Ac
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpackCompact(handle, m, n, A, lda, strideA, Ac, batch_count)
+    end function hipsolverCpackCompactFortran
+
+    function hipsolverZpackCompactFortran(handle, m, n, A, lda, strideA, Ac, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpackCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: Ac
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpackCompact(handle, m, n, A, lda, strideA, Ac, batch_count)
+    end function hipsolverZpackCompactFortran
+
+    function hipsolverSunpackCompactFortran(handle, m, n, Ac, A, lda, strideA, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSunpackCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: Ac
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSunpackCompact(handle, m, n, Ac, A, lda, strideA, batch_count)
+    end function hipsolverSunpackCompactFortran
+
+    function hipsolverDunpackCompactFortran(handle, m, n, Ac, A, lda, strideA, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDunpackCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: Ac
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDunpackCompact(handle, m, n, Ac, A, lda, strideA, batch_count)
+    end function hipsolverDunpackCompactFortran
+
+    function hipsolverCunpackCompactFortran(handle, m, n, Ac, A, lda, strideA, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCunpackCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: Ac
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCunpackCompact(handle, m, n, Ac, A, lda, strideA, batch_count)
+    end function hipsolverCunpackCompactFortran
+
+    function hipsolverZunpackCompactFortran(handle, m, n, Ac, A, lda, strideA, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZunpackCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: Ac
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZunpackCompact(handle, m, n, Ac, A, lda, strideA, batch_count)
+    end function hipsolverZunpackCompactFortran
+
+    ! ******************** POTRF ********************
+    function hipsolverSpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
+    end function hipsolverSpotrf_bufferSizeFortran
+    
+    function hipsolverDpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
+    end function hipsolverDpotrf_bufferSizeFortran
+    
+    function hipsolverCpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
+    end function hipsolverCpotrf_bufferSizeFortran
+    
+    function hipsolverZpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
+    end function hipsolverZpotrf_bufferSizeFortran
+
+    function hipsolverSpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info)
+    end function hipsolverSpotrfFortran
+
+    function hipsolverDpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info)
+    end function hipsolverDpotrfFortran
+
+    function hipsolverCpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCpotrf(handle, uplo, n, A, lda, work, lwork, info)
+    end function hipsolverCpotrfFortran
+
+    function hipsolverZpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZpotrf(handle, uplo, n, A, lda, work, lwork, info)
+    end function hipsolverZpotrfFortran
+    
+    ! ******************** POTRF_BATCHED ********************
+    function hipsolverSpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
+    end function hipsolverSpotrfBatched_bufferSizeFortran
+    
+    function hipsolverDpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
+    end function hipsolverDpotrfBatched_bufferSizeFortran
+    
+    function hipsolverCpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
+    end function hipsolverCpotrfBatched_bufferSizeFortran
+    
+    function hipsolverZpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
+    end function hipsolverZpotrfBatched_bufferSizeFortran
+
+    function hipsolverSpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
+    end function hipsolverSpotrfBatchedFortran
+    
+    function hipsolverDpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
+    end function hipsolverDpotrfBatchedFortran
+    
+    function hipsolverCpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
+    end function hipsolverCpotrfBatchedFortran
+    
+    function hipsolverZpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
+    end function hipsolverZpotrfBatchedFortran
+
+    ! ******************** POTRF_COMPACT ********************
+    function hipsolverSpotrfCompactFortran(handle, uplo, n, Ac, devInfo, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: Ac
+        type(c_ptr), value :: devInfo
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrfCompact(handle, uplo, n, Ac, devInfo, batch_count)
+    end function hipsolverSpotrfCompactFortran
+
+    function hipsolverDpotrfCompactFortran(handle, uplo, n, Ac, devInfo, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: Ac
+        type(c_ptr), value :: devInfo
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrfCompact(handle, uplo, n, Ac, devInfo, batch_count)
+    end function hipsolverDpotrfCompactFortran
+
+    function hipsolverCpotrfCompactFortran(handle, uplo, n, Ac, devInfo, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: Ac
+        type(c_ptr), value :: devInfo
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrfCompact(handle, uplo, n, Ac, devInfo, batch_count)
+    end function hipsolverCpotrfCompactFortran
+
+    function hipsolverZpotrfCompactFortran(handle, uplo, n, Ac, devInfo, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfCompactFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: Ac
+        type(c_ptr), value :: devInfo
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrfCompact(handle, uplo, n, Ac, devInfo, batch_count)
+    end function hipsolverZpotrfCompactFortran
+
+    ! ******************** POTRF_OUT_OF_CORE ********************
+    function hipsolverSpotrfOutOfCoreFortran(handle, uplo, n, A, lda, deviceBudget, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfOutOfCoreFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_size_t), value :: deviceBudget
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSpotrfOutOfCore(handle, uplo, n, A, lda, deviceBudget, info)
+    end function hipsolverSpotrfOutOfCoreFortran
+
+    function hipsolverDpotrfOutOfCoreFortran(handle, uplo, n, A, lda, deviceBudget, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfOutOfCoreFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_size_t), value :: deviceBudget
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDpotrfOutOfCore(handle, uplo, n, A, lda, deviceBudget, info)
+    end function hipsolverDpotrfOutOfCoreFortran
+
+    function hipsolverCpotrfOutOfCoreFortran(handle, uplo, n, A, lda, deviceBudget, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfOutOfCoreFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_size_t), value :: deviceBudget
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCpotrfOutOfCore(handle, uplo, n, A, lda, deviceBudget, info)
+    end function hipsolverCpotrfOutOfCoreFortran
+
+    function hipsolverZpotrfOutOfCoreFortran(handle, uplo, n, A, lda, deviceBudget, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfOutOfCoreFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_size_t), value :: deviceBudget
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZpotrfOutOfCore(handle, uplo, n, A, lda, deviceBudget, info)
+    end function hipsolverZpotrfOutOfCoreFortran
+
+    ! ******************** POTRS_OUT_OF_CORE ********************
+    function hipsolverSpotrsOutOfCoreFortran(handle, uplo, n, nrhs, A, lda, B, ldb, deviceBudget, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrsOutOfCoreFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_size_t), value :: deviceBudget
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSpotrsOutOfCore(handle, uplo, n, nrhs, A, lda, B, ldb, deviceBudget, info)
+    end function hipsolverSpotrsOutOfCoreFortran
+
+    function hipsolverDpotrsOutOfCoreFortran(handle, uplo, n, nrhs, A, lda, B, ldb, deviceBudget, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrsOutOfCoreFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_size_t), value :: deviceBudget
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDpotrsOutOfCore(handle, uplo, n, nrhs, A, lda, B, ldb, deviceBudget, info)
+    end function hipsolverDpotrsOutOfCoreFortran
+
+    function hipsolverCpotrsOutOfCoreFortran(handle, uplo, n, nrhs, A, lda, B, ldb, deviceBudget, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrsOutOfCoreFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_size_t), value :: deviceBudget
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCpotrsOutOfCore(handle, uplo, n, nrhs, A, lda, B, ldb, deviceBudget, info)
+    end function hipsolverCpotrsOutOfCoreFortran
+
+    function hipsolverZpotrsOutOfCoreFortran(handle, uplo, n, nrhs, A, lda, B, ldb, deviceBudget, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrsOutOfCoreFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_size_t), value :: deviceBudget
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZpotrsOutOfCore(handle, uplo, n, nrhs, A, lda, B, ldb, deviceBudget, info)
+    end function hipsolverZpotrsOutOfCoreFortran
+
+    ! ******************** SYEVD/HEEVD ********************
+    function hipsolverSsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSsyevd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork)
+    end function hipsolverSsyevd_bufferSizeFortran
+    
+    function hipsolverDsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDsyevd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork)
+    end function hipsolverDsyevd_bufferSizeFortran
+    
+    function hipsolverCheevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCheevd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork)
+    end function hipsolverCheevd_bufferSizeFortran
+    
+    function hipsolverZheevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZheevd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork)
+    end function hipsolverZheevd_bufferSizeFortran
+
+    function hipsolverSsyevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSsyevdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info)
+    end function hipsolverSsyevdFortran
+
+    function hipsolverDsyevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDsyevdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info)
+    end function hipsolverDsyevdFortran
+
+    function hipsolverCheevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCheevdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info)
+    end function hipsolverCheevdFortran
+
+    function hipsolverZheevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZheevdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info)
+    end function hipsolverZheevdFortran
+
+    ! ******************** SYGVD/HEGVD ********************
+    function hipsolverSsygvd_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSsygvd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: D
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork)
+    end function hipsolverSsygvd_bufferSizeFortran
+    
+    function hipsolverDsygvd_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDsygvd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: D
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork)
+    end function hipsolverDsygvd_bufferSizeFortran
+    
+    function hipsolverChegvd_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverChegvd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: D
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverChegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork)
+    end function hipsolverChegvd_bufferSizeFortran
+    
+    function hipsolverZhegvd_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverZpotrfBatchedFortran')
+            bind(c, name = 'hipsolverZhegvd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: D
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZhegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork)
+    end function hipsolverZhegvd_bufferSizeFortran
+
+    function hipsolverSsygvdFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSsygvdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: D
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info)
+    end function hipsolverSsygvdFortran
+
+    function hipsolverDsygvdFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDsygvdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: D
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info)
+    end function hipsolverDsygvdFortran
+
+    function hipsolverChegvdFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverChegvdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: D
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverChegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info)
+    end function hipsolverChegvdFortran
+
+    function hipsolverZhegvdFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZhegvdFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: D
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZhegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info)
+    end function hipsolverZhegvdFortran
+
+    ! ******************** SYGVD_PIPELINED/HEGVD_PIPELINED ********************
+    function hipsolverSsygvdPipelined_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSsygvdPipelined_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: D
+        type(c_ptr), value :: lwork
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
-    end function hipsolverZpotrfBatchedFortran
+        res = hipsolverSsygvdPipelined_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork, batch_count)
+    end function hipsolverSsygvdPipelined_bufferSizeFortran
 
-    ! ******************** SYEVD/HEEVD ********************
-    function hipsolverSsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork) &
+    function hipsolverDsygvdPipelined_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDsygvdPipelined_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: D
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDsygvdPipelined_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork, batch_count)
+    end function hipsolverDsygvdPipelined_bufferSizeFortran
+
+    function hipsolverChegvdPipelined_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverChegvdPipelined_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: D
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverChegvdPipelined_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork, batch_count)
+    end function hipsolverChegvdPipelined_bufferSizeFortran
+
+    function hipsolverZhegvdPipelined_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZhegvdPipelined_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: D
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZhegvdPipelined_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork, batch_count)
+    end function hipsolverZhegvdPipelined_bufferSizeFortran
+
+    function hipsolverSsygvdPipelinedFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSsygvdPipelinedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: D
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSsygvdPipelined(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info, batch_count)
+    end function hipsolverSsygvdPipelinedFortran
+
+    function hipsolverDsygvdPipelinedFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDsygvdPipelinedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: D
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDsygvdPipelined(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info, batch_count)
+    end function hipsolverDsygvdPipelinedFortran
+
+    function hipsolverChegvdPipelinedFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverChegvdPipelinedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: D
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverChegvdPipelined(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info, batch_count)
+    end function hipsolverChegvdPipelinedFortran
+
+    function hipsolverZhegvdPipelinedFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZhegvdPipelinedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: D
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZhegvdPipelined(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info, batch_count)
+    end function hipsolverZhegvdPipelinedFortran
+
+    ! ******************** SYTRD/HETRD ********************
+    function hipsolverSsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverSsyevd_bufferSizeFortran')
+            bind(c, name = 'hipsolverSsytrd_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tau
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverSsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork)
-    end function hipsolverSsyevd_bufferSizeFortran
+        res = hipsolverSsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork)
+    end function hipsolverSsytrd_bufferSizeFortran
     
-    function hipsolverDsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork) &
+    function hipsolverDsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverDsyevd_bufferSizeFortran')
+            bind(c, name = 'hipsolverDsytrd_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tau
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork)
-    end function hipsolverDsyevd_bufferSizeFortran
+        res = hipsolverDsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork)
+    end function hipsolverDsytrd_bufferSizeFortran
     
-    function hipsolverCheevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork) &
+    function hipsolverChetrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverCheevd_bufferSizeFortran')
+            bind(c, name = 'hipsolverChetrd_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tau
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverCheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork)
-    end function hipsolverCheevd_bufferSizeFortran
+        res = hipsolverChetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork)
+    end function hipsolverChetrd_bufferSizeFortran
     
-    function hipsolverZheevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork) &
+    function hipsolverZhetrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverZheevd_bufferSizeFortran')
+            bind(c, name = 'hipsolverZhetrd_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tau
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverZheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork)
-    end function hipsolverZheevd_bufferSizeFortran
+        res = hipsolverZhetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork)
+    end function hipsolverZhetrd_bufferSizeFortran
 
-    function hipsolverSsyevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+    function hipsolverSsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverSsyevdFortran')
+            bind(c, name = 'hipsolverSsytrdFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tau
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverSsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info)
-    end function hipsolverSsyevdFortran
+        res = hipsolverSsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info)
+    end function hipsolverSsytrdFortran
 
-    function hipsolverDsyevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+    function hipsolverDsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverDsyevdFortran')
+            bind(c, name = 'hipsolverDsytrdFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tau
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverDsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info)
-    end function hipsolverDsyevdFortran
+        res = hipsolverDsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info)
+    end function hipsolverDsytrdFortran
 
-    function hipsolverCheevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+    function hipsolverChetrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverCheevdFortran')
+            bind(c, name = 'hipsolverChetrdFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tau
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverCheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info)
-    end function hipsolverCheevdFortran
+        res = hipsolverChetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info)
+    end function hipsolverChetrdFortran
 
-    function hipsolverZheevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+    function hipsolverZhetrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverZheevdFortran')
+            bind(c, name = 'hipsolverZhetrdFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tau
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverZheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info)
-    end function hipsolverZheevdFortran
+        res = hipsolverZhetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info)
+    end function hipsolverZhetrdFortran
 
-    ! ******************** SYGVD/HEGVD ********************
-    function hipsolverSsygvd_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+    ! ******************** SYTRF ********************
+    function hipsolverSsytrf_bufferSizeFortran(handle, n, A, lda, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverSsygvd_bufferSizeFortran')
+            bind(c, name = 'hipsolverSsytrf_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
-        type(c_ptr), value :: D
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork)
-    end function hipsolverSsygvd_bufferSizeFortran
-    
-    function hipsolverDsygvd_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+        res = hipsolverSsytrf_bufferSize(handle, n, A, lda, lwork)
+    end function hipsolverSsytrf_bufferSizeFortran
+
+    function hipsolverDsytrf_bufferSizeFortran(handle, n, A, lda, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverDsygvd_bufferSizeFortran')
+            bind(c, name = 'hipsolverDsytrf_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
-        type(c_ptr), value :: D
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork)
-    end function hipsolverDsygvd_bufferSizeFortran
-    
-    function hipsolverChegvd_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+        res = hipsolverDsytrf_bufferSize(handle, n, A, lda, lwork)
+    end function hipsolverDsytrf_bufferSizeFortran
+
+    function hipsolverCsytrf_bufferSizeFortran(handle, n, A, lda, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverChegvd_bufferSizeFortran')
+            bind(c, name = 'hipsolverCsytrf_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
-        type(c_ptr), value :: D
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverChegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork)
-    end function hipsolverChegvd_bufferSizeFortran
-    
-    function hipsolverZhegvd_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+        res = hipsolverCsytrf_bufferSize(handle, n, A, lda, lwork)
+    end function hipsolverCsytrf_bufferSizeFortran
+
+    function hipsolverZsytrf_bufferSizeFortran(handle, n, A, lda, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverZhegvd_bufferSizeFortran')
+            bind(c, name = 'hipsolverZsytrf_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
-        type(c_ptr), value :: D
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverZhegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork)
-    end function hipsolverZhegvd_bufferSizeFortran
+        res = hipsolverZsytrf_bufferSize(handle, n, A, lda, lwork)
+    end function hipsolverZsytrf_bufferSizeFortran
 
-    function hipsolverSsygvdFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+    function hipsolverSsytrfFortran(handle, uplo, n, A, lda, devIpiv, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverSsygvdFortran')
+            bind(c, name = 'hipsolverSsytrfFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
-        type(c_ptr), value :: D
+        type(c_ptr), value :: devIpiv
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverSsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info)
-    end function hipsolverSsygvdFortran
+        res = hipsolverSsytrf(handle, uplo, n, A, lda, devIpiv, work, lwork, info)
+    end function hipsolverSsytrfFortran
 
-    function hipsolverDsygvdFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+    function hipsolverDsytrfFortran(handle, uplo, n, A, lda, devIpiv, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverDsygvdFortran')
+            bind(c, name = 'hipsolverDsytrfFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
-        type(c_ptr), value :: D
+        type(c_ptr), value :: devIpiv
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverDsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info)
-    end function hipsolverDsygvdFortran
+        res = hipsolverDsytrf(handle, uplo, n, A, lda, devIpiv, work, lwork, info)
+    end function hipsolverDsytrfFortran
 
-    function hipsolverChegvdFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+    function hipsolverCsytrfFortran(handle, uplo, n, A, lda, devIpiv, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverChegvdFortran')
+            bind(c, name = 'hipsolverCsytrfFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
-        type(c_ptr), value :: D
+        type(c_ptr), value :: devIpiv
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverChegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info)
-    end function hipsolverChegvdFortran
+        res = hipsolverCsytrf(handle, uplo, n, A, lda, devIpiv, work, lwork, info)
+    end function hipsolverCsytrfFortran
 
-    function hipsolverZhegvdFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+    function hipsolverZsytrfFortran(handle, uplo, n, A, lda, devIpiv, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverZhegvdFortran')
+            bind(c, name = 'hipsolverZsytrfFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
-        type(c_ptr), value :: D
+        type(c_ptr), value :: devIpiv
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverZhegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info)
-    end function hipsolverZhegvdFortran
+        res = hipsolverZsytrf(handle, uplo, n, A, lda, devIpiv, work, lwork, info)
+    end function hipsolverZsytrfFortran
 
-    ! ******************** SYTRD/HETRD ********************
-    function hipsolverSsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork) &
+    ! ******************** SYTRS ********************
+    function hipsolverSsytrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverSsytrd_bufferSizeFortran')
+            bind(c, name = 'hipsolverSsytrs_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
+        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: D
-        type(c_ptr), value :: E
-        type(c_ptr), value :: tau
+        type(c_ptr), value :: devIpiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverSsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork)
-    end function hipsolverSsytrd_bufferSizeFortran
-    
-    function hipsolverDsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork) &
+        res = hipsolverSsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, lwork)
+    end function hipsolverSsytrs_bufferSizeFortran
+
+    function hipsolverDsytrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverDsytrd_bufferSizeFortran')
+            bind(c, name = 'hipsolverDsytrs_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
+        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: D
-        type(c_ptr), value :: E
-        type(c_ptr), value :: tau
+        type(c_ptr), value :: devIpiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverDsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork)
-    end function hipsolverDsytrd_bufferSizeFortran
-    
-    function hipsolverChetrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork) &
+        res = hipsolverDsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, lwork)
+    end function hipsolverDsytrs_bufferSizeFortran
+
+    function hipsolverCsytrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverChetrd_bufferSizeFortran')
+            bind(c, name = 'hipsolverCsytrs_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
+        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: D
-        type(c_ptr), value :: E
-        type(c_ptr), value :: tau
+        type(c_ptr), value :: devIpiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverChetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork)
-    end function hipsolverChetrd_bufferSizeFortran
-    
-    function hipsolverZhetrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork) &
+        res = hipsolverCsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, lwork)
+    end function hipsolverCsytrs_bufferSizeFortran
+
+    function hipsolverZsytrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverZhetrd_bufferSizeFortran')
+            bind(c, name = 'hipsolverZsytrs_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
+        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: D
-        type(c_ptr), value :: E
-        type(c_ptr), value :: tau
+        type(c_ptr), value :: devIpiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverZhetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork)
-    end function hipsolverZhetrd_bufferSizeFortran
+        res = hipsolverZsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, lwork)
+    end function hipsolverZsytrs_bufferSizeFortran
 
-    function hipsolverSsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+    function hipsolverSsytrsFortran(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverSsytrdFortran')
+            bind(c, name = 'hipsolverSsytrsFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
+        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: D
-        type(c_ptr), value :: E
-        type(c_ptr), value :: tau
+        type(c_ptr), value :: devIpiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverSsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info)
-    end function hipsolverSsytrdFortran
+        res = hipsolverSsytrs(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, work, lwork, info)
+    end function hipsolverSsytrsFortran
 
-    function hipsolverDsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+    function hipsolverDsytrsFortran(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverDsytrdFortran')
+            bind(c, name = 'hipsolverDsytrsFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
+        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: D
-        type(c_ptr), value :: E
-        type(c_ptr), value :: tau
+        type(c_ptr), value :: devIpiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverDsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info)
-    end function hipsolverDsytrdFortran
+        res = hipsolverDsytrs(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, work, lwork, info)
+    end function hipsolverDsytrsFortran
 
-    function hipsolverChetrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+    function hipsolverCsytrsFortran(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverChetrdFortran')
+            bind(c, name = 'hipsolverCsytrsFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
+        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: D
-        type(c_ptr), value :: E
-        type(c_ptr), value :: tau
+        type(c_ptr), value :: devIpiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverChetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info)
-    end function hipsolverChetrdFortran
+        res = hipsolverCsytrs(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, work, lwork, info)
+    end function hipsolverCsytrsFortran
 
-    function hipsolverZhetrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+    function hipsolverZsytrsFortran(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverZhetrdFortran')
+            bind(c, name = 'hipsolverZsytrsFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
+        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: D
-        type(c_ptr), value :: E
-        type(c_ptr), value :: tau
+        type(c_ptr), value :: devIpiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverZhetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info)
-    end function hipsolverZhetrdFortran
+        res = hipsolverZsytrs(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, work, lwork, info)
+    end function hipsolverZsytrsFortran
     
 end module hipsolver_interface
@@ -479,6 +479,144 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZunmtrFortran(hipsolverHandle_t    h
                                                           int                  lwork,
                                                           int*                 devInfo);
 
+// cholqr2
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverScholqr2_bufferSizeFortran(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, float* R, int ldr, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDcholqr2_bufferSizeFortran(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, double* R, int ldr, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCcholqr2_bufferSizeFortran(hipsolverHandle_t handle,
+                                                                       int               m,
+                                                                       int               n,
+                                                                       hipFloatComplex*  A,
+                                                                       int               lda,
+                                                                       hipFloatComplex*  R,
+                                                                       int               ldr,
+                                                                       int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZcholqr2_bufferSizeFortran(hipsolverHandle_t handle,
+                                                                       int               m,
+                                                                       int               n,
+                                                                       hipDoubleComplex* A,
+                                                                       int               lda,
+                                                                       hipDoubleComplex* R,
+                                                                       int               ldr,
+                                                                       int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverScholqr2Fortran(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            float*            A,
+                                                            int               lda,
+                                                            float*            R,
+                                                            int               ldr,
+                                                            float*            work,
+                                                            int               lwork,
+                                                            int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDcholqr2Fortran(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            double*           A,
+                                                            int               lda,
+                                                            double*           R,
+                                                            int               ldr,
+                                                            double*           work,
+                                                            int               lwork,
+                                                            int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCcholqr2Fortran(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            hipFloatComplex*  A,
+                                                            int               lda,
+                                                            hipFloatComplex*  R,
+                                                            int               ldr,
+                                                            hipFloatComplex*  work,
+                                                            int               lwork,
+                                                            int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZcholqr2Fortran(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            hipDoubleComplex* A,
+                                                            int               lda,
+                                                            hipDoubleComplex* R,
+                                                            int               ldr,
+                                                            hipDoubleComplex* work,
+                                                            int               lwork,
+                                                            int*              devInfo);
+
+// cholqr3
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverScholqr3_bufferSizeFortran(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, float* R, int ldr, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDcholqr3_bufferSizeFortran(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, double* R, int ldr, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCcholqr3_bufferSizeFortran(hipsolverHandle_t handle,
+                                                                       int               m,
+                                                                       int               n,
+                                                                       hipFloatComplex*  A,
+                                                                       int               lda,
+                                                                       hipFloatComplex*  R,
+                                                                       int               ldr,
+                                                                       int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZcholqr3_bufferSizeFortran(hipsolverHandle_t handle,
+                                                                       int               m,
+                                                                       int               n,
+                                                                       hipDoubleComplex* A,
+                                                                       int               lda,
+                                                                       hipDoubleComplex* R,
+                                                                       int               ldr,
+                                                                       int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverScholqr3Fortran(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            float*            A,
+                                                            int               lda,
+                                                            float*            R,
+                                                            int               ldr,
+                                                            float*            work,
+                                                            int               lwork,
+                                                            int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDcholqr3Fortran(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            double*           A,
+                                                            int               lda,
+                                                            double*           R,
+                                                            int               ldr,
+                                                            double*           work,
+                                                            int               lwork,
+                                                            int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCcholqr3Fortran(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            hipFloatComplex*  A,
+                                                            int               lda,
+                                                            hipFloatComplex*  R,
+                                                            int               ldr,
+                                                            hipFloatComplex*  work,
+                                                            int               lwork,
+                                                            int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZcholqr3Fortran(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            hipDoubleComplex* A,
+                                                            int               lda,
+                                                            hipDoubleComplex* R,
+                                                            int               ldr,
+                                                            hipDoubleComplex* work,
+                                                            int               lwork,
+                                                            int*              devInfo);
+
 // gebrd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgebrd_bufferSizeFortran(hipsolverHandle_t handle,
                                                                      int               m,
@@ -552,6 +690,358 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgebrdFortran(hipsolverHandle_t hand
                                                           int               lwork,
                                                           int*              devInfo);
 
+// gels
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgels_bufferSizeFortran(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     int               nrhs,
+                                                                     float*            A,
+                                                                     int               lda,
+                                                                     float*            B,
+                                                                     int               ldb,
+                                                                     float*            X,
+                                                                     int               ldx,
+                                                                     size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDDgels_bufferSizeFortran(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     int               nrhs,
+                                                                     double*           A,
+                                                                     int               lda,
+                                                                     double*           B,
+                                                                     int               ldb,
+                                                                     double*           X,
+                                                                     int               ldx,
+                                                                     size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCCgels_bufferSizeFortran(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     int               nrhs,
+                                                                     hipFloatComplex*  A,
+                                                                     int               lda,
+                                                                     hipFloatComplex*  B,
+                                                                     int               ldb,
+                                                                     hipFloatComplex*  X,
+                                                                     int               ldx,
+                                                                     size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgels_bufferSizeFortran(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     int               nrhs,
+                                                                     hipDoubleComplex* A,
+                                                                     int               lda,
+                                                                     hipDoubleComplex* B,
+                                                                     int               ldb,
+                                                                     hipDoubleComplex* X,
+                                                                     int               ldx,
+                                                                     size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgelsFortran(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          float*            A,
+                                                          int               lda,
+                                                          float*            B,
+                                                          int               ldb,
+                                                          float*            X,
+                                                          int               ldx,
+                                                          void*             work,
+                                                          size_t            lwork,
+                                                          int*              niters,
+                                                          int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDDgelsFortran(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          double*           A,
+                                                          int               lda,
+                                                          double*           B,
+                                                          int               ldb,
+                                                          double*           X,
+                                                          int               ldx,
+                                                          void*             work,
+                                                          size_t            lwork,
+                                                          int*              niters,
+                                                          int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCCgelsFortran(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          hipFloatComplex*  A,
+                                                          int               lda,
+                                                          hipFloatComplex*  B,
+                                                          int               ldb,
+                                                          hipFloatComplex*  X,
+                                                          int               ldx,
+                                                          void*             work,
+                                                          size_t            lwork,
+                                                          int*              niters,
+                                                          int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgelsFortran(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          hipDoubleComplex* A,
+                                                          int               lda,
+                                                          hipDoubleComplex* B,
+                                                          int               ldb,
+                                                          hipDoubleComplex* X,
+                                                          int               ldx,
+                                                          void*             work,
+                                                          size_t            lwork,
+                                                          int*              niters,
+                                                          int*              devInfo);
+
+// gels_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSSgelsBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             float*            A[],
+                                             int               lda,
+                                             float*            B[],
+                                             int               ldb,
+                                             float*            X[],
+                                             int               ldx,
+                                             size_t*           lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDDgelsBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             double*           A[],
+                                             int               lda,
+                                             double*           B[],
+                                             int               ldb,
+                                             double*           X[],
+                                             int               ldx,
+                                             size_t*           lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCCgelsBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             hipFloatComplex*  A[],
+                                             int               lda,
+                                             hipFloatComplex*  B[],
+                                             int               ldb,
+                                             hipFloatComplex*  X[],
+                                             int               ldx,
+                                             size_t*           lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZZgelsBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             hipDoubleComplex* A[],
+                                             int               lda,
+                                             hipDoubleComplex* B[],
+                                             int               ldb,
+                                             hipDoubleComplex* X[],
+                                             int               ldx,
+                                             size_t*           lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgelsBatchedFortran(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 int               nrhs,
+                                                                 float*            A[],
+                                                                 int               lda,
+                                                                 float*            B[],
+                                                                 int               ldb,
+                                                                 float*            X[],
+                                                                 int               ldx,
+                                                                 void*             work,
+                                                                 size_t            lwork,
+                                                                 int*              niters,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDDgelsBatchedFortran(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 int               nrhs,
+                                                                 double*           A[],
+                                                                 int               lda,
+                                                                 double*           B[],
+                                                                 int               ldb,
+                                                                 double*           X[],
+                                                                 int               ldx,
+                                                                 void*             work,
+                                                                 size_t            lwork,
+                                                                 int*              niters,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCCgelsBatchedFortran(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 int               nrhs,
+                                                                 hipFloatComplex*  A[],
+                                                                 int               lda,
+                                                                 hipFloatComplex*  B[],
+                                                                 int               ldb,
+                                                                 hipFloatComplex*  X[],
+                                                                 int               ldx,
+                                                                 void*             work,
+                                                                 size_t            lwork,
+                                                                 int*              niters,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgelsBatchedFortran(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 int               nrhs,
+                                                                 hipDoubleComplex* A[],
+                                                                 int               lda,
+                                                                 hipDoubleComplex* B[],
+                                                                 int               ldb,
+                                                                 hipDoubleComplex* X[],
+                                                                 int               ldx,
+                                                                 void*             work,
+                                                                 size_t            lwork,
+                                                                 int*              niters,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+// geqp3
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqp3_bufferSizeFortran(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqp3_bufferSizeFortran(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqp3_bufferSizeFortran(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqp3_bufferSizeFortran(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqp3Fortran(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          float*            A,
+                                                          int               lda,
+                                                          int*              jpvt,
+                                                          float*            tau,
+                                                          float*            work,
+                                                          int               lwork,
+                                                          int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqp3Fortran(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          double*           A,
+                                                          int               lda,
+                                                          int*              jpvt,
+                                                          double*           tau,
+                                                          double*           work,
+                                                          int               lwork,
+                                                          int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqp3Fortran(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          hipFloatComplex*  A,
+                                                          int               lda,
+                                                          int*              jpvt,
+                                                          hipFloatComplex*  tau,
+                                                          hipFloatComplex*  work,
+                                                          int               lwork,
+                                                          int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqp3Fortran(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          hipDoubleComplex* A,
+                                                          int               lda,
+                                                          int*              jpvt,
+                                                          hipDoubleComplex* tau,
+                                                          hipDoubleComplex* work,
+                                                          int               lwork,
+                                                          int*              devInfo);
+
+// geqp3Truncated
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqp3Truncated_bufferSizeFortran(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqp3Truncated_bufferSizeFortran(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqp3Truncated_bufferSizeFortran(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqp3Truncated_bufferSizeFortran(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqp3TruncatedFortran(hipsolverHandle_t handle,
+                                                                   int               m,
+                                                                   int               n,
+                                                                   float*            A,
+                                                                   int               lda,
+                                                                   float             tol,
+                                                                   int*              jpvt,
+                                                                   float*            tau,
+                                                                   int*              rank,
+                                                                   float*            work,
+                                                                   int               lwork,
+                                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqp3TruncatedFortran(hipsolverHandle_t handle,
+                                                                   int               m,
+                                                                   int               n,
+                                                                   double*           A,
+                                                                   int               lda,
+                                                                   double            tol,
+                                                                   int*              jpvt,
+                                                                   double*           tau,
+                                                                   int*              rank,
+                                                                   double*           work,
+                                                                   int               lwork,
+                                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqp3TruncatedFortran(hipsolverHandle_t handle,
+                                                                   int               m,
+                                                                   int               n,
+                                                                   hipFloatComplex*  A,
+                                                                   int               lda,
+                                                                   float             tol,
+                                                                   int*              jpvt,
+                                                                   hipFloatComplex*  tau,
+                                                                   int*              rank,
+                                                                   hipFloatComplex*  work,
+                                                                   int               lwork,
+                                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqp3TruncatedFortran(hipsolverHandle_t handle,
+                                                                   int               m,
+                                                                   int               n,
+                                                                   hipDoubleComplex* A,
+                                                                   int               lda,
+                                                                   double            tol,
+                                                                   int*              jpvt,
+                                                                   hipDoubleComplex* tau,
+                                                                   int*              rank,
+                                                                   hipDoubleComplex* work,
+                                                                   int               lwork,
+                                                                   int*              devInfo);
+
 // geqrf
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrf_bufferSizeFortran(
     hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
@@ -605,6 +1095,59 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrfFortran(hipsolverHandle_t hand
                                                           int               lwork,
                                                           int*              devInfo);
 
+// geqrfTsqr
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrfTsqr_bufferSizeFortran(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqrfTsqr_bufferSizeFortran(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqrfTsqr_bufferSizeFortran(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrfTsqr_bufferSizeFortran(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrfTsqrFortran(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              float*            A,
+                                                              int               lda,
+                                                              float*            tau,
+                                                              float*            work,
+                                                              int               lwork,
+                                                              int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqrfTsqrFortran(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              double*           A,
+                                                              int               lda,
+                                                              double*           tau,
+                                                              double*           work,
+                                                              int               lwork,
+                                                              int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqrfTsqrFortran(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              hipFloatComplex*  A,
+                                                              int               lda,
+                                                              hipFloatComplex*  tau,
+                                                              hipFloatComplex*  work,
+                                                              int               lwork,
+                                                              int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrfTsqrFortran(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              hipDoubleComplex* A,
+                                                              int               lda,
+                                                              hipDoubleComplex* tau,
+                                                              hipDoubleComplex* work,
+                                                              int               lwork,
+                                                              int*              devInfo);
+
 // gesvd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvd_bufferSizeFortran(
     hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork);
@@ -836,6 +1379,306 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrsFortran(hipsolverHandle_t    h
                                                           int                  lwork,
                                                           int*                 devInfo);
 
+// getrfHost
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfHostFortran(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* ipiv, int* info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfHostFortran(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* ipiv, int* info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfHostFortran(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* ipiv, int* info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfHostFortran(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* ipiv, int* info);
+
+// getrfBatchedHost
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfBatchedHostFortran(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     float*            A[],
+                                                                     int               lda,
+                                                                     int*              ipiv,
+                                                                     int               strideP,
+                                                                     int*              info,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfBatchedHostFortran(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     double*           A[],
+                                                                     int               lda,
+                                                                     int*              ipiv,
+                                                                     int               strideP,
+                                                                     int*              info,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfBatchedHostFortran(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     hipFloatComplex*  A[],
+                                                                     int               lda,
+                                                                     int*              ipiv,
+                                                                     int               strideP,
+                                                                     int*              info,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfBatchedHostFortran(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     hipDoubleComplex* A[],
+                                                                     int               lda,
+                                                                     int*              ipiv,
+                                                                     int               strideP,
+                                                                     int*              info,
+                                                                     int               batch_count);
+
+// getrsHost
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrsHostFortran(hipsolverHandle_t    handle,
+                                                              hipsolverOperation_t trans,
+                                                              int                  n,
+                                                              int                  nrhs,
+                                                              const float*         A,
+                                                              int                  lda,
+                                                              const int*           ipiv,
+                                                              float*               B,
+                                                              int                  ldb,
+                                                              int*                 info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrsHostFortran(hipsolverHandle_t    handle,
+                                                              hipsolverOperation_t trans,
+                                                              int                  n,
+                                                              int                  nrhs,
+                                                              const double*        A,
+                                                              int                  lda,
+                                                              const int*           ipiv,
+                                                              double*              B,
+                                                              int                  ldb,
+                                                              int*                 info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrsHostFortran(hipsolverHandle_t      handle,
+                                                              hipsolverOperation_t   trans,
+                                                              int                    n,
+                                                              int                    nrhs,
+                                                              const hipFloatComplex* A,
+                                                              int                    lda,
+                                                              const int*             ipiv,
+                                                              hipFloatComplex*       B,
+                                                              int                    ldb,
+                                                              int*                   info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrsHostFortran(hipsolverHandle_t       handle,
+                                                              hipsolverOperation_t    trans,
+                                                              int                     n,
+                                                              int                     nrhs,
+                                                              const hipDoubleComplex* A,
+                                                              int                     lda,
+                                                              const int*              ipiv,
+                                                              hipDoubleComplex*       B,
+                                                              int                     ldb,
+                                                              int*                    info);
+
+// getrsBatchedHost
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrsBatchedHostFortran(hipsolverHandle_t    handle,
+                                                                     hipsolverOperation_t trans,
+                                                                     int                  n,
+                                                                     int                  nrhs,
+                                                                     float*               A[],
+                                                                     int                  lda,
+                                                                     const int*           ipiv,
+                                                                     int                  strideP,
+                                                                     float*               B[],
+                                                                     int                  ldb,
+                                                                     int*                 info,
+                                                                     int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrsBatchedHostFortran(hipsolverHandle_t    handle,
+                                                                     hipsolverOperation_t trans,
+                                                                     int                  n,
+                                                                     int                  nrhs,
+                                                                     double*              A[],
+                                                                     int                  lda,
+                                                                     const int*           ipiv,
+                                                                     int                  strideP,
+                                                                     double*              B[],
+                                                                     int                  ldb,
+                                                                     int*                 info,
+                                                                     int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrsBatchedHostFortran(hipsolverHandle_t    handle,
+                                                                     hipsolverOperation_t trans,
+                                                                     int                  n,
+                                                                     int                  nrhs,
+                                                                     hipFloatComplex*     A[],
+                                                                     int                  lda,
+                                                                     const int*           ipiv,
+                                                                     int                  strideP,
+                                                                     hipFloatComplex*     B[],
+                                                                     int                  ldb,
+                                                                     int*                 info,
+                                                                     int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrsBatchedHostFortran(hipsolverHandle_t    handle,
+                                                                     hipsolverOperation_t trans,
+                                                                     int                  n,
+                                                                     int                  nrhs,
+                                                                     hipDoubleComplex*    A[],
+                                                                     int                  lda,
+                                                                     const int*           ipiv,
+                                                                     int                  strideP,
+                                                                     hipDoubleComplex*    B[],
+                                                                     int                  ldb,
+                                                                     int*                 info,
+                                                                     int batch_count);
+
+// getrfCompact
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfCompactFortran(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 float*            Ac,
+                                                                 int*              devIpiv,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfCompactFortran(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 double*           Ac,
+                                                                 int*              devIpiv,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfCompactFortran(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 hipFloatComplex*  Ac,
+                                                                 int*              devIpiv,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfCompactFortran(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 hipDoubleComplex* Ac,
+                                                                 int*              devIpiv,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+// getrsCompact
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrsCompactFortran(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 const float*         Ac,
+                                                                 const int*           devIpiv,
+                                                                 float*               Bc,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrsCompactFortran(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 const double*        Ac,
+                                                                 const int*           devIpiv,
+                                                                 double*              Bc,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrsCompactFortran(hipsolverHandle_t      handle,
+                                  hipsolverOperation_t   trans,
+                                  int                    n,
+                                  int                    nrhs,
+                                  const hipFloatComplex* Ac,
+                                  const int*             devIpiv,
+                                  hipFloatComplex*       Bc,
+                                  int*                   devInfo,
+                                  int                    batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrsCompactFortran(hipsolverHandle_t       handle,
+                                  hipsolverOperation_t    trans,
+                                  int                     n,
+                                  int                     nrhs,
+                                  const hipDoubleComplex* Ac,
+                                  const int*              devIpiv,
+                                  hipDoubleComplex*       Bc,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// packCompact/unpackCompact
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpackCompactFortran(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                const float*      A,
+                                                                int               lda,
+                                                                int               strideA,
+                                                                float*            Ac,
+                                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpackCompactFortran(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                const double*     A,
+                                                                int               lda,
+                                                                int               strideA,
+                                                                double*           Ac,
+                                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpackCompactFortran(hipsolverHandle_t      handle,
+                                                                int                    m,
+                                                                int                    n,
+                                                                const hipFloatComplex* A,
+                                                                int                    lda,
+                                                                int                    strideA,
+                                                                hipFloatComplex*       Ac,
+                                                                int                    batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpackCompactFortran(hipsolverHandle_t       handle,
+                                 int                     m,
+                                 int                     n,
+                                 const hipDoubleComplex* A,
+                                 int                     lda,
+                                 int                     strideA,
+                                 hipDoubleComplex*       Ac,
+                                 int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSunpackCompactFortran(hipsolverHandle_t handle,
+                                                                  int               m,
+                                                                  int               n,
+                                                                  const float*      Ac,
+                                                                  float*            A,
+                                                                  int               lda,
+                                                                  int               strideA,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDunpackCompactFortran(hipsolverHandle_t handle,
+                                                                  int               m,
+                                                                  int               n,
+                                                                  const double*     Ac,
+                                                                  double*           A,
+                                                                  int               lda,
+                                                                  int               strideA,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCunpackCompactFortran(hipsolverHandle_t      handle,
+                                   int                    m,
+                                   int                    n,
+                                   const hipFloatComplex* Ac,
+                                   hipFloatComplex*       A,
+                                   int                    lda,
+                                   int                    strideA,
+                                   int                    batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZunpackCompactFortran(hipsolverHandle_t       handle,
+                                   int                     m,
+                                   int                     n,
+                                   const hipDoubleComplex* Ac,
+                                   hipDoubleComplex*       A,
+                                   int                     lda,
+                                   int                     strideA,
+                                   int                     batch_count);
+
 // potrf
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrf_bufferSizeFortran(
     hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork);
@@ -970,6 +1813,113 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfBatchedFortran(hipsolverHandle
                                                                  int*                devInfo,
                                                                  int                 batch_count);
 
+// potrfCompact
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfCompactFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 float*              Ac,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfCompactFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 double*             Ac,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfCompactFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipFloatComplex*    Ac,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfCompactFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipDoubleComplex*   Ac,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+// potrfOutOfCore
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfOutOfCoreFortran(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   float*              A,
+                                                                   int                 lda,
+                                                                   size_t              deviceBudget,
+                                                                   int*                info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfOutOfCoreFortran(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   double*             A,
+                                                                   int                 lda,
+                                                                   size_t              deviceBudget,
+                                                                   int*                info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfOutOfCoreFortran(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   hipFloatComplex*    A,
+                                                                   int                 lda,
+                                                                   size_t              deviceBudget,
+                                                                   int*                info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfOutOfCoreFortran(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   hipDoubleComplex*   A,
+                                                                   int                 lda,
+                                                                   size_t              deviceBudget,
+                                                                   int*                info);
+
+// potrsOutOfCore
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrsOutOfCoreFortran(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   int                 nrhs,
+                                                                   const float*        A,
+                                                                   int                 lda,
+                                                                   float*              B,
+                                                                   int                 ldb,
+                                                                   size_t              deviceBudget,
+                                                                   int*                info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrsOutOfCoreFortran(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   int                 nrhs,
+                                                                   const double*       A,
+                                                                   int                 lda,
+                                                                   double*             B,
+                                                                   int                 ldb,
+                                                                   size_t              deviceBudget,
+                                                                   int*                info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrsOutOfCoreFortran(hipsolverHandle_t      handle,
+                                                                   hipsolverFillMode_t    uplo,
+                                                                   int                    n,
+                                                                   int                    nrhs,
+                                                                   const hipFloatComplex* A,
+                                                                   int                    lda,
+                                                                   hipFloatComplex*       B,
+                                                                   int                    ldb,
+                                                                   size_t deviceBudget,
+                                                                   int*                   info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrsOutOfCoreFortran(hipsolverHandle_t       handle,
+                                                                   hipsolverFillMode_t     uplo,
+                                                                   int                     n,
+                                                                   int                     nrhs,
+                                                                   const hipDoubleComplex* A,
+                                                                   int                     lda,
+                                                                   hipDoubleComplex*       B,
+                                                                   int                     ldb,
+                                                                   size_t deviceBudget,
+                                                                   int*                    info);
+
 // syevd/heevd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevd_bufferSizeFortran(hipsolverHandle_t   handle,
                                                                      hipsolverEigMode_t  jobz,
@@ -1156,6 +2106,123 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvdFortran(hipsolverHandle_t   ha
                                                           int                 lwork,
                                                           int*                devInfo);
 
+// sygvdPipelined/hegvdPipelined
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsygvdPipelined_bufferSizeFortran(hipsolverHandle_t   handle,
+                                               hipsolverEigType_t  itype,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               float*              A,
+                                               int                 lda,
+                                               float*              B,
+                                               int                 ldb,
+                                               float*              D,
+                                               int*                lwork,
+                                               int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsygvdPipelined_bufferSizeFortran(hipsolverHandle_t   handle,
+                                               hipsolverEigType_t  itype,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               double*             A,
+                                               int                 lda,
+                                               double*             B,
+                                               int                 ldb,
+                                               double*             D,
+                                               int*                lwork,
+                                               int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverChegvdPipelined_bufferSizeFortran(hipsolverHandle_t   handle,
+                                               hipsolverEigType_t  itype,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               hipFloatComplex*    A,
+                                               int                 lda,
+                                               hipFloatComplex*    B,
+                                               int                 ldb,
+                                               float*              D,
+                                               int*                lwork,
+                                               int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhegvdPipelined_bufferSizeFortran(hipsolverHandle_t   handle,
+                                               hipsolverEigType_t  itype,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               hipDoubleComplex*   A,
+                                               int                 lda,
+                                               hipDoubleComplex*   B,
+                                               int                 ldb,
+                                               double*             D,
+                                               int*                lwork,
+                                               int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvdPipelinedFortran(hipsolverHandle_t   handle,
+                                                                   hipsolverEigType_t  itype,
+                                                                   hipsolverEigMode_t  jobz,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   float*              A,
+                                                                   int                 lda,
+                                                                   float*              B,
+                                                                   int                 ldb,
+                                                                   float*              D,
+                                                                   float*              work,
+                                                                   int                 lwork,
+                                                                   int*                devInfo,
+                                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvdPipelinedFortran(hipsolverHandle_t   handle,
+                                                                   hipsolverEigType_t  itype,
+                                                                   hipsolverEigMode_t  jobz,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   double*             A,
+                                                                   int                 lda,
+                                                                   double*             B,
+                                                                   int                 ldb,
+                                                                   double*             D,
+                                                                   double*             work,
+                                                                   int                 lwork,
+                                                                   int*                devInfo,
+                                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvdPipelinedFortran(hipsolverHandle_t   handle,
+                                                                   hipsolverEigType_t  itype,
+                                                                   hipsolverEigMode_t  jobz,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   hipFloatComplex*    A,
+                                                                   int                 lda,
+                                                                   hipFloatComplex*    B,
+                                                                   int                 ldb,
+                                                                   float*              D,
+                                                                   hipFloatComplex*    work,
+                                                                   int                 lwork,
+                                                                   int*                devInfo,
+                                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvdPipelinedFortran(hipsolverHandle_t   handle,
+                                                                   hipsolverEigType_t  itype,
+                                                                   hipsolverEigMode_t  jobz,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   hipDoubleComplex*   A,
+                                                                   int                 lda,
+                                                                   hipDoubleComplex*   B,
+                                                                   int                 ldb,
+                                                                   double*             D,
+                                                                   hipDoubleComplex*   work,
+                                                                   int                 lwork,
+                                                                   int*                devInfo,
+                                                                   int                 batch_count);
+
 // sytrd/hetrd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrd_bufferSizeFortran(hipsolverHandle_t   handle,
                                                                      hipsolverFillMode_t uplo,
@@ -1244,4 +2311,154 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhetrdFortran(hipsolverHandle_t   ha
                                                           hipDoubleComplex*   work,
                                                           int                 lwork,
                                                           int*                devInfo);
+
+// sytrf
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrf_bufferSizeFortran(
+    hipsolverHandle_t handle, int n, float* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrf_bufferSizeFortran(
+    hipsolverHandle_t handle, int n, double* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrf_bufferSizeFortran(
+    hipsolverHandle_t handle, int n, hipFloatComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrf_bufferSizeFortran(
+    hipsolverHandle_t handle, int n, hipDoubleComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrfFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              A,
+                                                          int                 lda,
+                                                          int*                devIpiv,
+                                                          float*              work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrfFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             A,
+                                                          int                 lda,
+                                                          int*                devIpiv,
+                                                          double*             work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrfFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipFloatComplex*    A,
+                                                          int                 lda,
+                                                          int*                devIpiv,
+                                                          hipFloatComplex*    work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrfFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipDoubleComplex*   A,
+                                                          int                 lda,
+                                                          int*                devIpiv,
+                                                          hipDoubleComplex*   work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+// sytrs
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrs_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 nrhs,
+                                                                     float*              A,
+                                                                     int                 lda,
+                                                                     int*                devIpiv,
+                                                                     float*              B,
+                                                                     int                 ldb,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrs_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 nrhs,
+                                                                     double*             A,
+                                                                     int                 lda,
+                                                                     int*                devIpiv,
+                                                                     double*             B,
+                                                                     int                 ldb,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrs_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 nrhs,
+                                                                     hipFloatComplex*    A,
+                                                                     int                 lda,
+                                                                     int*                devIpiv,
+                                                                     hipFloatComplex*    B,
+                                                                     int                 ldb,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrs_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 nrhs,
+                                                                     hipDoubleComplex*   A,
+                                                                     int                 lda,
+                                                                     int*                devIpiv,
+                                                                     hipDoubleComplex*   B,
+                                                                     int                 ldb,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrsFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          float*              A,
+                                                          int                 lda,
+                                                          int*                devIpiv,
+                                                          float*              B,
+                                                          int                 ldb,
+                                                          float*              work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrsFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          double*             A,
+                                                          int                 lda,
+                                                          int*                devIpiv,
+                                                          double*             B,
+                                                          int                 ldb,
+                                                          double*             work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrsFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          hipFloatComplex*    A,
+                                                          int                 lda,
+                                                          int*                devIpiv,
+                                                          hipFloatComplex*    B,
+                                                          int                 ldb,
+                                                          hipFloatComplex*    work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrsFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          hipDoubleComplex*   A,
+                                                          int                 lda,
+                                                          int*                devIpiv,
+                                                          hipDoubleComplex*   B,
+                                                          int                 ldb,
+                                                          hipDoubleComplex*   work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
 }
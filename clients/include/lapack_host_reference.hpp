@@ -6,6 +6,19 @@
 
 #include "hipsolver.h"
 #include "hipsolver_datatype2string.hpp"
+#include <functional>
+
+// Batch execution
+
+/* Number of threads used by cblas_batch: the value of the environment variable
+   HIPSOLVER_REFERENCE_THREADS if it is set, or the number of hardware threads. */
+int cblas_batch_threads();
+
+/* Calls func(b) for each problem b of a batch of bc problems, spread over
+   cblas_batch_threads() threads. The calls for different problems must not
+   write to shared data. The first exception thrown by a call is rethrown once
+   all threads are done. */
+void cblas_batch(int bc, const std::function<void(int)>& func);
 
 // BLAS
 
@@ -101,6 +114,22 @@ void cblas_ormtr_unmtr(hipsolverSideMode_t  side,
 template <typename T, typename S>
 void cblas_gebrd(int m, int n, T* A, int lda, S* D, S* E, T* tauq, T* taup, T* work, int size_w);
 
+template <typename T>
+void cblas_gels(hipsolverOperation_t trans,
+                int                  m,
+                int                  n,
+                int                  nrhs,
+                T*                   A,
+                int                  lda,
+                T*                   B,
+                int                  ldb,
+                T*                   work,
+                int                  lwork,
+                int*                 info);
+
+template <typename T, typename S>
+void cblas_geqp3(int m, int n, T* A, int lda, int* jpvt, T* tau, T* work, int lwork, S* rwork);
+
 template <typename T>
 void cblas_geqrf(int m, int n, T* A, int lda, T* ipiv, T* work, int sizeW);
 
@@ -131,6 +160,9 @@ void cblas_getrs(
 template <typename T>
 void cblas_potrf(hipsolverFillMode_t uplo, int n, T* A, int lda, int* info);
 
+template <typename T>
+void cblas_potrs(hipsolverFillMode_t uplo, int n, int nrhs, T* A, int lda, T* B, int ldb);
+
 template <typename T, typename S>
 void cblas_syevd_heevd(hipsolverEigMode_t  evect,
                        hipsolverFillMode_t uplo,
@@ -167,3 +199,11 @@ void cblas_sygvd_hegvd(hipsolverEigType_t  itype,
 template <typename T, typename S>
 void cblas_sytrd_hetrd(
     hipsolverFillMode_t uplo, int n, T* A, int lda, S* D, S* E, T* tau, T* work, int size_w);
+
+template <typename T>
+void cblas_sytrf(
+    hipsolverFillMode_t uplo, int n, T* A, int lda, int* ipiv, T* work, int lwork, int* info);
+
+template <typename T>
+void cblas_sytrs(
+    hipsolverFillMode_t uplo, int n, int nrhs, T* A, int lda, int* ipiv, T* B, int ldb);
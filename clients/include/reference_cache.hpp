@@ -0,0 +1,125 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    On-disk cache of the results of the host LAPACK reference. The
+ *    reference of the eigensolvers and of the SVD takes much longer than the
+ *    computation on the device, and it gives the same results in every run
+ *    of the tests. An entry of the cache is keyed by the routine, the
+ *    precision, the arguments of the test, the seed of the random generator
+ *    and a hash of the input matrices, so that a change of the generator or
+ *    of the initialization of a test invalidates its entries. Each entry is
+ *    a binary file, named after the hash of its key, that holds the key and
+ *    the output arrays of the reference; entries are mapped into memory to
+ *    be read, and written to a temporary file that is then renamed, so that
+ *    concurrent test processes never read a partial entry.
+ *
+ *    The cache is disabled until hipsolver_reference_cache_open is called;
+ *    hipsolver-test enables it in the directory reference_cache of its build
+ *    directory, or in the directory named by the environment variable
+ *    HIPSOLVER_REFERENCE_CACHE. An empty HIPSOLVER_REFERENCE_CACHE disables
+ *    the cache.
+ * ===========================================================================
+ */
+
+#define HIPSOLVER_REFERENCE_CACHE_VERSION 1
+
+/* Enables the cache, with its entries in the directory dir, which is
+   created if needed. Returns false, and leaves the cache disabled, if dir is
+   empty or cannot be created. */
+bool hipsolver_reference_cache_open(const std::string& dir);
+
+bool hipsolver_reference_cache_enabled();
+
+// the directory of the cache, or an empty string if the cache is disabled
+const std::string& hipsolver_reference_cache_dir();
+
+// the seed of the random generator of the clients
+uint64_t hipsolver_reference_seed();
+
+// 64-bit FNV-1a hash of size bytes at data, continuing from hash
+uint64_t hipsolver_reference_hash(const void* data, size_t size, uint64_t hash);
+
+/* One entry of the cache. Usage:
+       hipsolver_reference_cache cache("potrf", type2char<T>(), uplo, n, lda, bc);
+       cache.input(hA);
+       cache.output(hA, hInfo);
+       if(!cache.load())
+       {
+           // compute the reference into hA and hInfo
+           cache.store();
+       }
+   The inputs must be given before the reference overwrites them, and the
+   outputs must be all the arrays written by the reference. */
+class hipsolver_reference_cache
+{
+    std::string                             key;
+    uint64_t                                hash;
+    std::vector<std::pair<char*, uint64_t>> outputs;
+    bool                                    enabled;
+
+public:
+    template <typename... Args>
+    explicit hipsolver_reference_cache(const char* routine, char precision, const Args&... args)
+        : enabled(hipsolver_reference_cache_enabled())
+    {
+        if(!enabled)
+            return;
+
+        std::ostringstream words;
+        words << routine << ' ' << precision;
+        (void)std::initializer_list<int>{((words << ' ' << args), 0)...};
+        words << " seed " << hipsolver_reference_seed();
+        key  = words.str();
+        hash = hipsolver_reference_hash(key.data(), key.size(), 14695981039346656037ull);
+    }
+
+    // adds the batch vectors to the inputs of the entry
+    template <typename V, typename... Vs>
+    void input(V& v, Vs&... vs)
+    {
+        if(enabled)
+            for(int b = 0; b < v.batch_count(); b++)
+                hash = hipsolver_reference_hash(v[b], bytes(v), hash);
+        input(vs...);
+    }
+    void input() {}
+
+    // adds the batch vectors to the outputs of the entry
+    template <typename V, typename... Vs>
+    void output(V& v, Vs&... vs)
+    {
+        if(enabled)
+            for(int b = 0; b < v.batch_count(); b++)
+                outputs.emplace_back((char*)v[b], bytes(v));
+        output(vs...);
+    }
+    void output() {}
+
+    // reads the outputs from the cache; returns false if the entry is missing
+    bool load();
+
+    // writes the outputs to the cache
+    void store() const;
+
+private:
+    template <typename V>
+    static uint64_t bytes(V& v)
+    {
+        return uint64_t(v.n()) * std::abs(v.inc()) * sizeof(*v[0]);
+    }
+
+    std::string path() const;
+};
@@ -0,0 +1,56 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+
+/*! \brief  holds the work enqueued on a stream after hold() until release() is called, or
+ * until the timeout, with a host callback, so that the tests can keep work pending */
+class stream_gate
+{
+public:
+    explicit stream_gate(std::chrono::milliseconds timeout = std::chrono::seconds(10))
+        : timeout_(timeout)
+    {
+    }
+    stream_gate(const stream_gate&) = delete;
+    stream_gate& operator=(const stream_gate&) = delete;
+
+    hipError_t hold(hipStream_t stream)
+    {
+        return hipStreamAddCallback(stream, wait, this, 0);
+    }
+
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        released_ = true;
+        cv_.notify_all();
+    }
+
+    // whether the stream was let go by the timeout; valid once the stream is synchronized
+    bool timed_out() const
+    {
+        return timed_out_;
+    }
+
+private:
+    static void wait(hipStream_t, hipError_t, void* data)
+    {
+        stream_gate*                 gate = (stream_gate*)data;
+        std::unique_lock<std::mutex> lock(gate->mutex_);
+        gate->timed_out_
+            = !gate->cv_.wait_for(lock, gate->timeout_, [gate] { return gate->released_; });
+    }
+
+    std::chrono::milliseconds timeout_;
+    std::mutex                mutex_;
+    std::condition_variable   cv_;
+    bool                      released_  = false;
+    bool                      timed_out_ = false;
+};
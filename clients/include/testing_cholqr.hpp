@@ -0,0 +1,422 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <bool FORTRAN, bool SHIFTED, typename T, typename U>
+void cholqr_checkBadArgs(const hipsolverHandle_t handle,
+                         const int               m,
+                         const int               n,
+                         T                       dA,
+                         const int               lda,
+                         T                       dR,
+                         const int               ldr,
+                         T                       dWork,
+                         const int               lwork,
+                         U                       dInfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_cholqr(FORTRAN, SHIFTED, nullptr, m, n, dA, lda, dR, ldr, dWork, lwork, dInfo),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    // N/A
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_cholqr(
+            FORTRAN, SHIFTED, handle, m, n, (T) nullptr, lda, dR, ldr, dWork, lwork, dInfo),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_cholqr(
+            FORTRAN, SHIFTED, handle, m, n, dA, lda, (T) nullptr, ldr, dWork, lwork, dInfo),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_cholqr(
+            FORTRAN, SHIFTED, handle, m, n, dA, lda, dR, ldr, dWork, lwork, (U) nullptr),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+template <bool FORTRAN, bool SHIFTED, typename T>
+void testing_cholqr_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    int                    m   = 1;
+    int                    n   = 1;
+    int                    lda = 1;
+    int                    ldr = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dR(1, 1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dR.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_cholqr_bufferSize(
+        FORTRAN, SHIFTED, handle, m, n, dA.data(), lda, dR.data(), ldr, &size_W);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    cholqr_checkBadArgs<FORTRAN, SHIFTED>(
+        handle, m, n, dA.data(), lda, dR.data(), ldr, dWork.data(), size_W, dInfo.data());
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void cholqr_initData(
+    const hipsolverHandle_t handle, const int m, const int n, Td& dA, const int lda, Th& hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale A to keep it well conditioned
+        for(int i = 0; i < m; i++)
+        {
+            for(int j = 0; j < n; j++)
+            {
+                if(i == j)
+                    hA[0][i + j * lda] += 400;
+                else
+                    hA[0][i + j * lda] -= 4;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool FORTRAN, bool SHIFTED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void cholqr_getError(const hipsolverHandle_t handle,
+                     const int               m,
+                     const int               n,
+                     Td&                     dA,
+                     const int               lda,
+                     Td&                     dR,
+                     const int               ldr,
+                     Td&                     dWork,
+                     const int               lwork,
+                     Ud&                     dInfo,
+                     Th&                     hA,
+                     Th&                     hARes,
+                     Th&                     hR,
+                     Uh&                     hInfo,
+                     double*                 max_err)
+{
+    std::vector<T> hQR(size_t(lda) * n);
+    std::vector<T> hI(size_t(n) * n);
+
+    // input data initialization
+    cholqr_initData<true, true, T>(handle, m, n, dA, lda, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_cholqr(FORTRAN,
+                                         SHIFTED,
+                                         handle,
+                                         m,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         dR.data(),
+                                         ldr,
+                                         dWork.data(),
+                                         lwork,
+                                         dInfo.data()));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hR.transfer_from(dR));
+    CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+
+    // CPU lapack
+    // there is no LAPACK equivalent: the result is checked through the residual
+    // ||A - Qres Rres|| / ||A|| and the loss of orthogonality ||I - Qres' Qres||
+    // using frobenius norm
+    cblas_gemm<T>(HIPSOLVER_OP_N,
+                  HIPSOLVER_OP_N,
+                  m,
+                  n,
+                  n,
+                  T(1),
+                  hARes[0],
+                  lda,
+                  hR[0],
+                  ldr,
+                  T(0),
+                  hQR.data(),
+                  lda);
+    *max_err = norm_error('F', m, n, lda, hA[0], hQR.data());
+
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i < n; i++)
+            hI[i + j * n] = (i == j) ? T(1) : T(0);
+    cblas_gemm<T>(HIPSOLVER_OP_C,
+                  HIPSOLVER_OP_N,
+                  n,
+                  n,
+                  m,
+                  T(-1),
+                  hARes[0],
+                  lda,
+                  hARes[0],
+                  lda,
+                  T(1),
+                  hI.data(),
+                  n);
+    double err = 0;
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i < n; i++)
+            err += std::abs(hI[i + j * n]) * std::abs(hI[i + j * n]);
+    err      = std::sqrt(err);
+    *max_err = err > *max_err ? err : *max_err;
+
+    // the strictly lower triangular part of R must be zero
+    for(int j = 0; j < n; j++)
+        for(int i = j + 1; i < n; i++)
+            if(hR[0][i + j * ldr] != T(0))
+                *max_err = std::numeric_limits<double>::max();
+
+    // A is well conditioned, so the factorization must succeed
+    if(hInfo[0][0] != 0)
+        *max_err = std::numeric_limits<double>::max();
+}
+
+template <bool FORTRAN, bool SHIFTED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void cholqr_getPerfData(const hipsolverHandle_t handle,
+                        const int               m,
+                        const int               n,
+                        Td&                     dA,
+                        const int               lda,
+                        Td&                     dR,
+                        const int               ldr,
+                        Td&                     dWork,
+                        const int               lwork,
+                        Ud&                     dInfo,
+                        Th&                     hA,
+                        Uh&                     hInfo,
+                        double*                 gpu_time_used,
+                        double*                 cpu_time_used,
+                        const int               hot_calls,
+                        const bool              perf)
+{
+    std::vector<T> hW(64 * n);
+    std::vector<T> htau(n);
+
+    if(!perf)
+    {
+        cholqr_initData<true, false, T>(handle, m, n, dA, lda, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (compared against an explicit Householder QR)
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_geqrf<T>(m, n, hA[0], lda, htau.data(), hW.data(), 64 * n);
+        cblas_orgqr_ungqr<T>(m, n, n, hA[0], lda, htau.data(), hW.data(), 64 * n);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    cholqr_initData<true, false, T>(handle, m, n, dA, lda, hA);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        cholqr_initData<false, true, T>(handle, m, n, dA, lda, hA);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_cholqr(FORTRAN,
+                                             SHIFTED,
+                                             handle,
+                                             m,
+                                             n,
+                                             dA.data(),
+                                             lda,
+                                             dR.data(),
+                                             ldr,
+                                             dWork.data(),
+                                             lwork,
+                                             dInfo.data()));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    double start;
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        cholqr_initData<false, true, T>(handle, m, n, dA, lda, hA);
+
+        start = get_time_us_sync(stream);
+        hipsolver_cholqr(FORTRAN,
+                         SHIFTED,
+                         handle,
+                         m,
+                         n,
+                         dA.data(),
+                         lda,
+                         dR.data(),
+                         ldr,
+                         dWork.data(),
+                         lwork,
+                         dInfo.data());
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool FORTRAN, bool SHIFTED, typename T>
+void testing_cholqr(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    int                    m   = argus.get<int>("m");
+    int                    n   = argus.get<int>("n", m);
+    int                    lda = argus.get<int>("lda", m);
+    int                    ldr = argus.get<int>("ldr", n);
+
+    int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    size_t size_R    = size_t(ldr) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || m < n || lda < m || ldr < n);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_cholqr(FORTRAN,
+                                               SHIFTED,
+                                               handle,
+                                               m,
+                                               n,
+                                               (T*)nullptr,
+                                               lda,
+                                               (T*)nullptr,
+                                               ldr,
+                                               (T*)nullptr,
+                                               0,
+                                               (int*)nullptr),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T>     hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T>     hARes(size_ARes, 1, size_ARes, 1);
+    host_strided_batch_vector<T>     hR(size_R, 1, size_R, 1);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<T>   dR(size_R, 1, size_R, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_R)
+        CHECK_HIP_ERROR(dR.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_cholqr_bufferSize(
+        FORTRAN, SHIFTED, handle, m, n, dA.data(), lda, dR.data(), ldr, &size_W);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        cholqr_getError<FORTRAN, SHIFTED, T>(handle,
+                                             m,
+                                             n,
+                                             dA,
+                                             lda,
+                                             dR,
+                                             ldr,
+                                             dWork,
+                                             size_W,
+                                             dInfo,
+                                             hA,
+                                             hARes,
+                                             hR,
+                                             hInfo,
+                                             &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        cholqr_getPerfData<FORTRAN, SHIFTED, T>(handle,
+                                                m,
+                                                n,
+                                                dA,
+                                                lda,
+                                                dR,
+                                                ldr,
+                                                dWork,
+                                                size_W,
+                                                dInfo,
+                                                hA,
+                                                hInfo,
+                                                &gpu_time_used,
+                                                &cpu_time_used,
+                                                hot_calls,
+                                                argus.perf);
+
+    // validate results for rocsolver-test
+    // using m * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, m);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("m", "n", "lda", "ldr");
+            rocsolver_bench_output(m, n, lda, ldr);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
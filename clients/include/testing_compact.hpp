@@ -0,0 +1,535 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+// number of entries of the compact layout for bc n-by-nrhs matrices
+template <typename T>
+size_t compact_size(const int n, const int nrhs, const int bc)
+{
+    size_t w = HIPSOLVER_COMPACT_GROUP_BYTES / sizeof(T);
+    return (bc + w - 1) / w * w * n * nrhs;
+}
+
+template <bool FORTRAN, typename T, typename U>
+void compact_checkBadArgs(const hipsolverHandle_t    handle,
+                          const hipsolverFillMode_t  uplo,
+                          const hipsolverOperation_t trans,
+                          const int                  n,
+                          const int                  nrhs,
+                          T                          dA,
+                          const int                  lda,
+                          const int                  stA,
+                          T                          dAc,
+                          U                          dIpiv,
+                          T                          dBc,
+                          U                          dInfo,
+                          const int                  bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_pack_compact(FORTRAN, nullptr, n, n, dA, lda, stA, dAc, bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_unpack_compact(FORTRAN, nullptr, n, n, dAc, dA, lda, stA, bc),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolver_potrf_compact(FORTRAN, nullptr, uplo, n, dAc, dInfo, bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolver_getrf_compact(FORTRAN, nullptr, n, dAc, dIpiv, dInfo, bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_getrs_compact(FORTRAN, nullptr, trans, n, nrhs, dAc, dIpiv, dBc, dInfo, bc),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrf_compact(FORTRAN, handle, hipsolverFillMode_t(-1), n, dAc, dInfo, bc),
+        HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolver_getrs_compact(FORTRAN,
+                                                  handle,
+                                                  hipsolverOperation_t(-1),
+                                                  n,
+                                                  nrhs,
+                                                  dAc,
+                                                  dIpiv,
+                                                  dBc,
+                                                  dInfo,
+                                                  bc),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_pack_compact(FORTRAN, handle, n, n, (T) nullptr, lda, stA, dAc, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_unpack_compact(FORTRAN, handle, n, n, (T) nullptr, dA, lda, stA, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrf_compact(FORTRAN, handle, uplo, n, (T) nullptr, dInfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrf_compact(FORTRAN, handle, uplo, n, dAc, (U) nullptr, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_getrf_compact(FORTRAN, handle, n, dAc, (U) nullptr, dInfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_getrs_compact(
+            FORTRAN, handle, trans, n, nrhs, dAc, dIpiv, (T) nullptr, dInfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+template <bool FORTRAN, typename T>
+void testing_compact_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    hipsolverFillMode_t    uplo  = HIPSOLVER_FILL_MODE_UPPER;
+    hipsolverOperation_t   trans = HIPSOLVER_OP_N;
+    int                    n     = 1;
+    int                    nrhs  = 1;
+    int                    lda   = 1;
+    int                    stA   = 1;
+    int                    bc    = 1;
+    size_t                 sizeC = compact_size<T>(n, n, bc);
+
+    // memory allocations
+    device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dAc(sizeC, 1, sizeC, 1);
+    device_strided_batch_vector<T>   dBc(sizeC, 1, sizeC, 1);
+    device_strided_batch_vector<int> dIpiv(1, 1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dAc.memcheck());
+    CHECK_HIP_ERROR(dBc.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check bad arguments
+    compact_checkBadArgs<FORTRAN>(handle,
+                                  uplo,
+                                  trans,
+                                  n,
+                                  nrhs,
+                                  dA.data(),
+                                  lda,
+                                  stA,
+                                  dAc.data(),
+                                  dIpiv.data(),
+                                  dBc.data(),
+                                  dInfo.data(),
+                                  bc);
+}
+
+template <typename T, typename Th>
+void compact_initData(const int n, const int bc, Th& hA, Th& hG, Th& hB, Th& hATmp)
+{
+    T tmp;
+    rocblas_init<T>(hATmp, true);
+    rocblas_init<T>(hG, true);
+    rocblas_init<T>(hB, true);
+
+    for(int b = 0; b < bc; ++b)
+    {
+        // make A hermitian and scale to ensure positive definiteness
+        cblas_gemm(HIPSOLVER_OP_N,
+                   HIPSOLVER_OP_C,
+                   n,
+                   n,
+                   n,
+                   (T)1.0,
+                   hATmp[b],
+                   n,
+                   hATmp[b],
+                   n,
+                   (T)0.0,
+                   hA[b],
+                   n);
+
+        for(int i = 0; i < n; i++)
+            hA[b][i + i * n] += 400;
+
+        // scale G to avoid singularities
+        for(int i = 0; i < n; i++)
+        {
+            for(int j = 0; j < n; j++)
+            {
+                if(i == j)
+                    hG[b][i + j * n] += 400;
+                else
+                    hG[b][i + j * n] -= 4;
+            }
+        }
+
+        // shuffle the rows of G, differently in each matrix of a group, to test pivoting
+        for(int i = 0; i < n / 2; i++)
+        {
+            int k = (i + b) % n;
+            int l = n - 1 - i;
+            for(int j = 0; j < n; j++)
+            {
+                tmp              = hG[b][k + j * n];
+                hG[b][k + j * n] = hG[b][l + j * n];
+                hG[b][l + j * n] = tmp;
+            }
+        }
+    }
+}
+
+template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void compact_getError(const hipsolverHandle_t    handle,
+                      const hipsolverFillMode_t  uplo,
+                      const hipsolverOperation_t trans,
+                      const int                  n,
+                      const int                  nrhs,
+                      const int                  bc,
+                      Td&                        dA,
+                      Td&                        dB,
+                      Td&                        dAc,
+                      Td&                        dBc,
+                      Ud&                        dIpiv,
+                      Ud&                        dInfo,
+                      Th&                        hA,
+                      Th&                        hARes,
+                      Th&                        hG,
+                      Th&                        hGRes,
+                      Th&                        hB,
+                      Th&                        hBRes,
+                      Uh&                        hIpiv,
+                      Uh&                        hIpivRes,
+                      Uh&                        hInfo,
+                      Uh&                        hInfoRes,
+                      double*                    max_err)
+{
+    int            stA = n * n;
+    int            stB = n * nrhs;
+    int            ld  = std::max(n, 1); // leading dimension for the reference
+    std::vector<T> hAX(stB);
+
+    // input data initialization
+    compact_initData<T>(n, bc, hA, hG, hB, hARes);
+
+    // execute computations
+    // GPU lapack: potrf
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(
+        hipsolver_pack_compact(FORTRAN, handle, n, n, dA.data(), n, stA, dAc.data(), bc));
+    CHECK_ROCBLAS_ERROR(
+        hipsolver_potrf_compact(FORTRAN, handle, uplo, n, dAc.data(), dInfo.data(), bc));
+    CHECK_ROCBLAS_ERROR(
+        hipsolver_unpack_compact(FORTRAN, handle, n, n, dAc.data(), dA.data(), n, stA, bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack: potrf
+    cblas_batch(bc, [&](int b) { cblas_potrf<T>(uplo, n, hA[b], ld, hInfo[b]); });
+
+    // error is ||hA - hARes|| / ||hA||
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        err      = (uplo == HIPSOLVER_FILL_MODE_UPPER)
+                       ? norm_error_upperTr('F', n, n, ld, hA[b], hARes[b])
+                       : norm_error_lowerTr('F', n, n, ld, hA[b], hARes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        // also check info
+        if(hInfo[b][0] != hInfoRes[b][0])
+            *max_err += 1;
+    }
+
+    // GPU lapack: getrf and getrs
+    CHECK_HIP_ERROR(dA.transfer_from(hG));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_ROCBLAS_ERROR(
+        hipsolver_pack_compact(FORTRAN, handle, n, n, dA.data(), n, stA, dAc.data(), bc));
+    CHECK_ROCBLAS_ERROR(hipsolver_pack_compact(
+        FORTRAN, handle, n, nrhs, dB.data(), n, stB, dBc.data(), bc));
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_compact(
+        FORTRAN, handle, n, dAc.data(), dIpiv.data(), dInfo.data(), bc));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_compact(FORTRAN,
+                                                handle,
+                                                trans,
+                                                n,
+                                                nrhs,
+                                                dAc.data(),
+                                                dIpiv.data(),
+                                                dBc.data(),
+                                                dInfo.data(),
+                                                bc));
+    CHECK_ROCBLAS_ERROR(
+        hipsolver_unpack_compact(FORTRAN, handle, n, n, dAc.data(), dA.data(), n, stA, bc));
+    CHECK_ROCBLAS_ERROR(hipsolver_unpack_compact(
+        FORTRAN, handle, n, nrhs, dBc.data(), dB.data(), n, stB, bc));
+    CHECK_HIP_ERROR(hGRes.transfer_from(dA));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+    CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+
+    // getrs has no failure modes
+    // (hInfo is reused for the info of getrs, before the CPU factorization)
+    CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+    if(hInfo[0][0] != 0)
+        *max_err = std::numeric_limits<double>::max();
+
+    // the solution is checked through the residual ||B - op(G) Xres|| / ||B||
+    // using frobenius norm
+    for(int b = 0; b < bc && nrhs > 0; ++b)
+    {
+        cblas_gemm<T>(
+            trans, HIPSOLVER_OP_N, n, nrhs, n, T(1), hG[b], ld, hBRes[b], ld, T(0), hAX.data(), ld);
+        err      = norm_error('F', n, nrhs, ld, hB[b], hAX.data());
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // CPU lapack: getrf
+    cblas_batch(bc, [&](int b) { cblas_getrf<T>(n, n, hG[b], ld, hIpiv[0] + b * n, hInfo[b]); });
+
+    // error is ||hG - hGRes|| / ||hG||
+    // using frobenius norm
+    for(int b = 0; b < bc; ++b)
+    {
+        err      = norm_error('F', n, n, ld, hG[b], hGRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        // also check pivoting (count the number of incorrect pivots)
+        err = 0;
+        for(int i = 0; i < n; ++i)
+            if(hIpiv[0][b * n + i] != hIpivRes[0][b * n + i])
+                err++;
+        *max_err = err > *max_err ? err : *max_err;
+
+        // also check info for singularities
+        if(hInfo[b][0] != hInfoRes[b][0])
+            *max_err += 1;
+    }
+}
+
+template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void compact_getPerfData(const hipsolverHandle_t handle,
+                         const int               n,
+                         const int               bc,
+                         Td&                     dA,
+                         Td&                     dAc,
+                         Ud&                     dIpiv,
+                         Ud&                     dInfo,
+                         Th&                     hA,
+                         Th&                     hG,
+                         Th&                     hGRes,
+                         Th&                     hB,
+                         Uh&                     hIpiv,
+                         Uh&                     hInfo,
+                         double*                 gpu_time_used,
+                         double*                 cpu_time_used,
+                         const int               hot_calls,
+                         const bool              perf)
+{
+    int    stA    = n * n;
+    int    ld     = std::max(n, 1);
+    size_t size_A = size_t(n) * n;
+
+    compact_initData<T>(n, bc, hA, hG, hB, hGRes);
+
+    if(!perf)
+    {
+        for(int b = 0; b < bc; ++b)
+            std::copy(hG[b], hG[b] + size_A, hGRes[b]);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(int b = 0; b < bc; ++b)
+            cblas_getrf<T>(n, n, hGRes[b], ld, hIpiv[0] + b * n, hInfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    CHECK_HIP_ERROR(dA.transfer_from(hG));
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        CHECK_ROCBLAS_ERROR(
+            hipsolver_pack_compact(FORTRAN, handle, n, n, dA.data(), n, stA, dAc.data(), bc));
+        CHECK_ROCBLAS_ERROR(hipsolver_getrf_compact(
+            FORTRAN, handle, n, dAc.data(), dIpiv.data(), dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    // (only the factorization is timed; the matrices are packed beforehand)
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    double start;
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        hipsolver_pack_compact(FORTRAN, handle, n, n, dA.data(), n, stA, dAc.data(), bc);
+
+        start = get_time_us_sync(stream);
+        hipsolver_getrf_compact(FORTRAN, handle, n, dAc.data(), dIpiv.data(), dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool FORTRAN, typename T>
+void testing_compact(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    char                   uploC  = argus.get<char>("uplo", 'L');
+    char                   transC = argus.get<char>("trans", 'N');
+    int                    n      = argus.get<int>("n");
+    int                    nrhs   = argus.get<int>("nrhs", 1);
+
+    hipsolverFillMode_t  uplo      = char2hipsolver_fill(uploC);
+    hipsolverOperation_t trans     = char2hipsolver_operation(transC);
+    int                  bc        = argus.batch_count;
+    int                  hot_calls = argus.iters;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || n > HIPSOLVER_COMPACT_MAX_SIZE || nrhs < 0 || bc < 0);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            hipsolver_potrf_compact(FORTRAN, handle, uplo, n, (T*)nullptr, (int*)nullptr, bc),
+            HIPSOLVER_STATUS_INVALID_VALUE);
+        EXPECT_ROCBLAS_STATUS(hipsolver_getrf_compact(FORTRAN,
+                                                      handle,
+                                                      n,
+                                                      (T*)nullptr,
+                                                      (int*)nullptr,
+                                                      (int*)nullptr,
+                                                      bc),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A    = size_t(n) * n;
+    size_t size_B    = size_t(n) * nrhs;
+    size_t size_Ac   = compact_size<T>(n, n, bc);
+    size_t size_Bc   = compact_size<T>(n, nrhs, bc);
+    size_t size_P    = size_t(n) * bc;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // memory allocations
+    host_strided_batch_vector<T>     hA(size_A, 1, size_A, bc);
+    host_strided_batch_vector<T>     hARes(size_A, 1, size_A, bc);
+    host_strided_batch_vector<T>     hG(size_A, 1, size_A, bc);
+    host_strided_batch_vector<T>     hGRes(size_A, 1, size_A, bc);
+    host_strided_batch_vector<T>     hB(size_B, 1, size_B, bc);
+    host_strided_batch_vector<T>     hBRes(size_B, 1, size_B, bc);
+    host_strided_batch_vector<int>   hIpiv(std::max<size_t>(size_P, 1), 1, size_P, 1);
+    host_strided_batch_vector<int>   hIpivRes(std::max<size_t>(size_P, 1), 1, size_P, 1);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, std::max(bc, 1));
+    host_strided_batch_vector<int>   hInfoRes(1, 1, 1, std::max(bc, 1));
+    device_strided_batch_vector<T>   dA(size_A, 1, size_A, bc);
+    device_strided_batch_vector<T>   dB(size_B, 1, size_B, bc);
+    device_strided_batch_vector<T>   dAc(size_Ac, 1, size_Ac, 1);
+    device_strided_batch_vector<T>   dBc(size_Bc, 1, size_Bc, 1);
+    device_strided_batch_vector<int> dIpiv(std::max<size_t>(size_P, 1), 1, size_P, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, std::max(bc, 1));
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+    if(size_Ac)
+        CHECK_HIP_ERROR(dAc.memcheck());
+    if(size_Bc)
+        CHECK_HIP_ERROR(dBc.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        compact_getError<FORTRAN, T>(handle,
+                                     uplo,
+                                     trans,
+                                     n,
+                                     nrhs,
+                                     bc,
+                                     dA,
+                                     dB,
+                                     dAc,
+                                     dBc,
+                                     dIpiv,
+                                     dInfo,
+                                     hA,
+                                     hARes,
+                                     hG,
+                                     hGRes,
+                                     hB,
+                                     hBRes,
+                                     hIpiv,
+                                     hIpivRes,
+                                     hInfo,
+                                     hInfoRes,
+                                     &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        compact_getPerfData<FORTRAN, T>(handle,
+                                        n,
+                                        bc,
+                                        dA,
+                                        dAc,
+                                        dIpiv,
+                                        dInfo,
+                                        hA,
+                                        hG,
+                                        hGRes,
+                                        hB,
+                                        hIpiv,
+                                        hInfo,
+                                        &gpu_time_used,
+                                        &cpu_time_used,
+                                        hot_calls,
+                                        argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("uplo", "trans", "n", "nrhs", "batch_c");
+            rocsolver_bench_output(uploC, transC, n, nrhs, bc);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
@@ -51,7 +51,7 @@ void gebrd_checkBadArgs(const hipsolverHandle_t handle,
     // values
     // N/A
 
-#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+#if !defined(__HIP_PLATFORM_NVCC__)
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_gebrd(FORTRAN,
                                           handle,
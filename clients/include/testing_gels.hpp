@@ -0,0 +1,816 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <bool FORTRAN, typename T, typename U>
+void gels_checkBadArgs(const hipsolverHandle_t handle,
+                       const int               m,
+                       const int               n,
+                       const int               nrhs,
+                       T                       dA,
+                       const int               lda,
+                       const int               stA,
+                       T                       dB,
+                       const int               ldb,
+                       const int               stB,
+                       T                       dX,
+                       const int               ldx,
+                       const int               stX,
+                       void*                   dWork,
+                       const size_t            lwork,
+                       U                       dInfo,
+                       const int               bc)
+{
+    int niters;
+
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_gels(FORTRAN,
+                                         nullptr,
+                                         m,
+                                         n,
+                                         nrhs,
+                                         dA,
+                                         lda,
+                                         stA,
+                                         dB,
+                                         ldb,
+                                         stB,
+                                         dX,
+                                         ldx,
+                                         stX,
+                                         dWork,
+                                         lwork,
+                                         &niters,
+                                         dInfo,
+                                         bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    // N/A
+
+#if !defined(__HIP_PLATFORM_NVCC__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_gels(FORTRAN,
+                                         handle,
+                                         m,
+                                         n,
+                                         nrhs,
+                                         (T) nullptr,
+                                         lda,
+                                         stA,
+                                         dB,
+                                         ldb,
+                                         stB,
+                                         dX,
+                                         ldx,
+                                         stX,
+                                         dWork,
+                                         lwork,
+                                         &niters,
+                                         dInfo,
+                                         bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gels(FORTRAN,
+                                         handle,
+                                         m,
+                                         n,
+                                         nrhs,
+                                         dA,
+                                         lda,
+                                         stA,
+                                         (T) nullptr,
+                                         ldb,
+                                         stB,
+                                         dX,
+                                         ldx,
+                                         stX,
+                                         dWork,
+                                         lwork,
+                                         &niters,
+                                         dInfo,
+                                         bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gels(FORTRAN,
+                                         handle,
+                                         m,
+                                         n,
+                                         nrhs,
+                                         dA,
+                                         lda,
+                                         stA,
+                                         dB,
+                                         ldb,
+                                         stB,
+                                         (T) nullptr,
+                                         ldx,
+                                         stX,
+                                         dWork,
+                                         lwork,
+                                         &niters,
+                                         dInfo,
+                                         bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gels(FORTRAN,
+                                         handle,
+                                         m,
+                                         n,
+                                         nrhs,
+                                         dA,
+                                         lda,
+                                         stA,
+                                         dB,
+                                         ldb,
+                                         stB,
+                                         dX,
+                                         ldx,
+                                         stX,
+                                         dWork,
+                                         lwork,
+                                         &niters,
+                                         (U) nullptr,
+                                         bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <bool FORTRAN, bool BATCHED, bool STRIDED, typename T>
+void testing_gels_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    int                    m    = 1;
+    int                    n    = 1;
+    int                    nrhs = 1;
+    int                    lda  = 1;
+    int                    ldb  = 1;
+    int                    ldx  = 1;
+    int                    stA  = 1;
+    int                    stB  = 1;
+    int                    stX  = 1;
+    int                    bc   = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T>           dA(1, 1, 1);
+        device_batch_vector<T>           dB(1, 1, 1);
+        device_batch_vector<T>           dX(1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        size_t size_W;
+        hipsolver_gels_bufferSize(FORTRAN,
+                                  handle,
+                                  m,
+                                  n,
+                                  nrhs,
+                                  dA.data(),
+                                  lda,
+                                  dB.data(),
+                                  ldb,
+                                  dX.data(),
+                                  ldx,
+                                  &size_W,
+                                  bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        gels_checkBadArgs<FORTRAN>(handle,
+                                   m,
+                                   n,
+                                   nrhs,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   dB.data(),
+                                   ldb,
+                                   stB,
+                                   dX.data(),
+                                   ldx,
+                                   stX,
+                                   dWork.data(),
+                                   size_W,
+                                   dInfo.data(),
+                                   bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+        device_strided_batch_vector<T>   dB(1, 1, 1, 1);
+        device_strided_batch_vector<T>   dX(1, 1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        size_t size_W;
+        hipsolver_gels_bufferSize(
+            FORTRAN, handle, m, n, nrhs, dA.data(), lda, dB.data(), ldb, dX.data(), ldx, &size_W);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        gels_checkBadArgs<FORTRAN>(handle,
+                                   m,
+                                   n,
+                                   nrhs,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   dB.data(),
+                                   ldb,
+                                   stB,
+                                   dX.data(),
+                                   ldx,
+                                   stX,
+                                   dWork.data(),
+                                   size_W,
+                                   dInfo.data(),
+                                   bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gels_initData(const hipsolverHandle_t handle,
+                   const int               m,
+                   const int               n,
+                   const int               nrhs,
+                   Td&                     dA,
+                   const int               lda,
+                   const int               stA,
+                   Td&                     dB,
+                   const int               ldb,
+                   const int               stB,
+                   const int               bc,
+                   Th&                     hA,
+                   Th&                     hB)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+
+        // scale A to avoid rank deficiency
+        for(int b = 0; b < bc; ++b)
+        {
+            for(int i = 0; i < m; i++)
+            {
+                for(int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gels_getError(const hipsolverHandle_t handle,
+                   const int               m,
+                   const int               n,
+                   const int               nrhs,
+                   Td&                     dA,
+                   const int               lda,
+                   const int               stA,
+                   Td&                     dB,
+                   const int               ldb,
+                   const int               stB,
+                   Td&                     dX,
+                   const int               ldx,
+                   const int               stX,
+                   void*                   dWork,
+                   const size_t            lwork,
+                   Ud&                     dInfo,
+                   const int               bc,
+                   Th&                     hA,
+                   Th&                     hB,
+                   Th&                     hX,
+                   Th&                     hXRes,
+                   Uh&                     hInfo,
+                   Uh&                     hInfoRes,
+                   double*                 max_err)
+{
+    int niters;
+    int sizeW = std::max(1, std::min(m, n) + std::max(std::min(m, n), nrhs)) * 32;
+
+    // input data initialization
+    gels_initData<true, true, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, bc, hA, hB);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_gels(FORTRAN,
+                                       handle,
+                                       m,
+                                       n,
+                                       nrhs,
+                                       dA.data(),
+                                       lda,
+                                       stA,
+                                       dB.data(),
+                                       ldb,
+                                       stB,
+                                       dX.data(),
+                                       ldx,
+                                       stX,
+                                       dWork,
+                                       lwork,
+                                       &niters,
+                                       dInfo.data(),
+                                       bc));
+    CHECK_HIP_ERROR(hXRes.transfer_from(dX));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    // the solution is returned in the leading n-by-nrhs block of hB; copy it to hX
+    cblas_batch(bc, [&](int b) {
+        std::vector<T> hW(sizeW);
+        cblas_gels<T>(
+            HIPSOLVER_OP_N, m, n, nrhs, hA[b], lda, hB[b], ldb, hW.data(), sizeW, hInfo[b]);
+        for(int i = 0; i < n; i++)
+            for(int j = 0; j < nrhs; j++)
+                hX[b][i + j * ldx] = hB[b][i + j * ldb];
+    });
+
+    // error is ||hX - hXRes|| / ||hX||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        if(hInfo[b][0] == 0)
+        {
+            err      = norm_error('F', n, nrhs, ldx, hX[b], hXRes[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+
+    // also check info for rank-deficient cases
+    err = 0;
+    for(int b = 0; b < bc; ++b)
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    *max_err += err;
+}
+
+template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gels_getPerfData(const hipsolverHandle_t handle,
+                      const int               m,
+                      const int               n,
+                      const int               nrhs,
+                      Td&                     dA,
+                      const int               lda,
+                      const int               stA,
+                      Td&                     dB,
+                      const int               ldb,
+                      const int               stB,
+                      Td&                     dX,
+                      const int               ldx,
+                      const int               stX,
+                      void*                   dWork,
+                      const size_t            lwork,
+                      Ud&                     dInfo,
+                      const int               bc,
+                      Th&                     hA,
+                      Th&                     hB,
+                      Uh&                     hInfo,
+                      double*                 gpu_time_used,
+                      double*                 cpu_time_used,
+                      const int               hot_calls,
+                      const bool              perf)
+{
+    int            niters;
+    int            sizeW = std::max(1, std::min(m, n) + std::max(std::min(m, n), nrhs)) * 32;
+    std::vector<T> hW(sizeW);
+
+    if(!perf)
+    {
+        gels_initData<true, false, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, bc, hA, hB);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(int b = 0; b < bc; ++b)
+        {
+            cblas_gels<T>(
+                HIPSOLVER_OP_N, m, n, nrhs, hA[b], lda, hB[b], ldb, hW.data(), sizeW, hInfo[b]);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gels_initData<true, false, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, bc, hA, hB);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gels_initData<false, true, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, bc, hA, hB);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_gels(FORTRAN,
+                                           handle,
+                                           m,
+                                           n,
+                                           nrhs,
+                                           dA.data(),
+                                           lda,
+                                           stA,
+                                           dB.data(),
+                                           ldb,
+                                           stB,
+                                           dX.data(),
+                                           ldx,
+                                           stX,
+                                           dWork,
+                                           lwork,
+                                           &niters,
+                                           dInfo.data(),
+                                           bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    double start;
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        gels_initData<false, true, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, bc, hA, hB);
+
+        start = get_time_us_sync(stream);
+        hipsolver_gels(FORTRAN,
+                       handle,
+                       m,
+                       n,
+                       nrhs,
+                       dA.data(),
+                       lda,
+                       stA,
+                       dB.data(),
+                       ldb,
+                       stB,
+                       dX.data(),
+                       ldx,
+                       stX,
+                       dWork,
+                       lwork,
+                       &niters,
+                       dInfo.data(),
+                       bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool FORTRAN, bool BATCHED, bool STRIDED, typename T>
+void testing_gels(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    int                    m    = argus.get<int>("m");
+    int                    n    = argus.get<int>("n", m);
+    int                    nrhs = argus.get<int>("nrhs", n);
+    int                    lda  = argus.get<int>("lda", m);
+    int                    ldb  = argus.get<int>("ldb", std::max(m, n));
+    int                    ldx  = argus.get<int>("ldx", n);
+    int                    stA  = argus.get<int>("strideA", lda * n);
+    int                    stB  = argus.get<int>("strideB", ldb * nrhs);
+    int                    stX  = argus.get<int>("strideX", ldx * nrhs);
+
+    int bc        = argus.batch_count;
+    int hot_calls = argus.iters;
+
+    int stXRes = (argus.unit_check || argus.norm_check) ? stX : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    size_t size_B    = size_t(ldb) * nrhs;
+    size_t size_X    = size_t(ldx) * nrhs;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_XRes = (argus.unit_check || argus.norm_check) ? size_X : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < m || ldb < n || ldx < n
+                         || bc < 0);
+    if(invalid_size)
+    {
+        int niters;
+
+        if(BATCHED)
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_gels(FORTRAN,
+                                                 handle,
+                                                 m,
+                                                 n,
+                                                 nrhs,
+                                                 (T**)nullptr,
+                                                 lda,
+                                                 stA,
+                                                 (T**)nullptr,
+                                                 ldb,
+                                                 stB,
+                                                 (T**)nullptr,
+                                                 ldx,
+                                                 stX,
+                                                 (void*)nullptr,
+                                                 0,
+                                                 &niters,
+                                                 (int*)nullptr,
+                                                 bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+        else
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_gels(FORTRAN,
+                                                 handle,
+                                                 m,
+                                                 n,
+                                                 nrhs,
+                                                 (T*)nullptr,
+                                                 lda,
+                                                 stA,
+                                                 (T*)nullptr,
+                                                 ldb,
+                                                 stB,
+                                                 (T*)nullptr,
+                                                 ldx,
+                                                 stX,
+                                                 (void*)nullptr,
+                                                 0,
+                                                 &niters,
+                                                 (int*)nullptr,
+                                                 bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T>             hA(size_A, 1, bc);
+        host_batch_vector<T>             hB(size_B, 1, bc);
+        host_batch_vector<T>             hX(size_XRes, 1, bc);
+        host_batch_vector<T>             hXRes(size_XRes, 1, bc);
+        host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
+        device_batch_vector<T>           dA(size_A, 1, bc);
+        device_batch_vector<T>           dB(size_B, 1, bc);
+        device_batch_vector<T>           dX(size_X, 1, bc);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+        if(size_X)
+            CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        size_t size_W;
+        hipsolver_gels_bufferSize(FORTRAN,
+                                  handle,
+                                  m,
+                                  n,
+                                  nrhs,
+                                  dA.data(),
+                                  lda,
+                                  dB.data(),
+                                  ldb,
+                                  dX.data(),
+                                  ldx,
+                                  &size_W,
+                                  bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gels_getError<FORTRAN, T>(handle,
+                                      m,
+                                      n,
+                                      nrhs,
+                                      dA,
+                                      lda,
+                                      stA,
+                                      dB,
+                                      ldb,
+                                      stB,
+                                      dX,
+                                      ldx,
+                                      stX,
+                                      dWork.data(),
+                                      size_W,
+                                      dInfo,
+                                      bc,
+                                      hA,
+                                      hB,
+                                      hX,
+                                      hXRes,
+                                      hInfo,
+                                      hInfoRes,
+                                      &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            gels_getPerfData<FORTRAN, T>(handle,
+                                         m,
+                                         n,
+                                         nrhs,
+                                         dA,
+                                         lda,
+                                         stA,
+                                         dB,
+                                         ldb,
+                                         stB,
+                                         dX,
+                                         ldx,
+                                         stX,
+                                         dWork.data(),
+                                         size_W,
+                                         dInfo,
+                                         bc,
+                                         hA,
+                                         hB,
+                                         hInfo,
+                                         &gpu_time_used,
+                                         &cpu_time_used,
+                                         hot_calls,
+                                         argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T>     hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T>     hB(size_B, 1, stB, bc);
+        host_strided_batch_vector<T>     hX(size_XRes, 1, stXRes, bc);
+        host_strided_batch_vector<T>     hXRes(size_XRes, 1, stXRes, bc);
+        host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
+        device_strided_batch_vector<T>   dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T>   dB(size_B, 1, stB, bc);
+        device_strided_batch_vector<T>   dX(size_X, 1, stX, bc);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+        if(size_X)
+            CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        size_t size_W;
+        hipsolver_gels_bufferSize(
+            FORTRAN, handle, m, n, nrhs, dA.data(), lda, dB.data(), ldb, dX.data(), ldx, &size_W);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gels_getError<FORTRAN, T>(handle,
+                                      m,
+                                      n,
+                                      nrhs,
+                                      dA,
+                                      lda,
+                                      stA,
+                                      dB,
+                                      ldb,
+                                      stB,
+                                      dX,
+                                      ldx,
+                                      stX,
+                                      dWork.data(),
+                                      size_W,
+                                      dInfo,
+                                      bc,
+                                      hA,
+                                      hB,
+                                      hX,
+                                      hXRes,
+                                      hInfo,
+                                      hInfoRes,
+                                      &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            gels_getPerfData<FORTRAN, T>(handle,
+                                         m,
+                                         n,
+                                         nrhs,
+                                         dA,
+                                         lda,
+                                         stA,
+                                         dB,
+                                         ldb,
+                                         stB,
+                                         dX,
+                                         ldx,
+                                         stX,
+                                         dWork.data(),
+                                         size_W,
+                                         dInfo,
+                                         bc,
+                                         hA,
+                                         hB,
+                                         hInfo,
+                                         &gpu_time_used,
+                                         &cpu_time_used,
+                                         hot_calls,
+                                         argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using max(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, std::max(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", "nrhs", "lda", "ldb", "ldx", "batch_c");
+                rocsolver_bench_output(m, n, nrhs, lda, ldb, ldx, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("m",
+                                       "n",
+                                       "nrhs",
+                                       "lda",
+                                       "ldb",
+                                       "ldx",
+                                       "strideA",
+                                       "strideB",
+                                       "strideX",
+                                       "batch_c");
+                rocsolver_bench_output(m, n, nrhs, lda, ldb, ldx, stA, stB, stX, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "nrhs", "lda", "ldb", "ldx");
+                rocsolver_bench_output(m, n, nrhs, lda, ldb, ldx);
+            }
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
@@ -0,0 +1,641 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <bool FORTRAN, bool TRUNCATED, typename T, typename S, typename U>
+void geqp3_checkBadArgs(const hipsolverHandle_t handle,
+                        const int               m,
+                        const int               n,
+                        T                       dA,
+                        const int               lda,
+                        const S                 tol,
+                        U                       dJpvt,
+                        T                       dTau,
+                        U                       dRank,
+                        T                       dWork,
+                        const int               lwork,
+                        U                       dInfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_geqp3(FORTRAN,
+                                          TRUNCATED,
+                                          nullptr,
+                                          m,
+                                          n,
+                                          dA,
+                                          lda,
+                                          tol,
+                                          dJpvt,
+                                          dTau,
+                                          dRank,
+                                          dWork,
+                                          lwork,
+                                          dInfo),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    if(TRUNCATED)
+        EXPECT_ROCBLAS_STATUS(hipsolver_geqp3(FORTRAN,
+                                              TRUNCATED,
+                                              handle,
+                                              m,
+                                              n,
+                                              dA,
+                                              lda,
+                                              S(-1),
+                                              dJpvt,
+                                              dTau,
+                                              dRank,
+                                              dWork,
+                                              lwork,
+                                              dInfo),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_geqp3(FORTRAN,
+                                          TRUNCATED,
+                                          handle,
+                                          m,
+                                          n,
+                                          (T) nullptr,
+                                          lda,
+                                          tol,
+                                          dJpvt,
+                                          dTau,
+                                          dRank,
+                                          dWork,
+                                          lwork,
+                                          dInfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_geqp3(FORTRAN,
+                                          TRUNCATED,
+                                          handle,
+                                          m,
+                                          n,
+                                          dA,
+                                          lda,
+                                          tol,
+                                          (U) nullptr,
+                                          dTau,
+                                          dRank,
+                                          dWork,
+                                          lwork,
+                                          dInfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_geqp3(FORTRAN,
+                                          TRUNCATED,
+                                          handle,
+                                          m,
+                                          n,
+                                          dA,
+                                          lda,
+                                          tol,
+                                          dJpvt,
+                                          (T) nullptr,
+                                          dRank,
+                                          dWork,
+                                          lwork,
+                                          dInfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    if(TRUNCATED)
+        EXPECT_ROCBLAS_STATUS(hipsolver_geqp3(FORTRAN,
+                                              TRUNCATED,
+                                              handle,
+                                              m,
+                                              n,
+                                              dA,
+                                              lda,
+                                              tol,
+                                              dJpvt,
+                                              dTau,
+                                              (U) nullptr,
+                                              dWork,
+                                              lwork,
+                                              dInfo),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_geqp3(FORTRAN,
+                                          TRUNCATED,
+                                          handle,
+                                          m,
+                                          n,
+                                          dA,
+                                          lda,
+                                          tol,
+                                          dJpvt,
+                                          dTau,
+                                          dRank,
+                                          dWork,
+                                          lwork,
+                                          (U) nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+template <bool FORTRAN, bool TRUNCATED, typename T>
+void testing_geqp3_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    hipsolver_local_handle handle;
+    int                    m   = 1;
+    int                    n   = 1;
+    int                    lda = 1;
+    S                      tol = 0;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dTau(1, 1, 1, 1);
+    device_strided_batch_vector<int> dJpvt(1, 1, 1, 1);
+    device_strided_batch_vector<int> dRank(1, 1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dTau.memcheck());
+    CHECK_HIP_ERROR(dJpvt.memcheck());
+    CHECK_HIP_ERROR(dRank.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_geqp3_bufferSize(FORTRAN, TRUNCATED, handle, m, n, dA.data(), lda, &size_W);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    geqp3_checkBadArgs<FORTRAN, TRUNCATED>(handle,
+                                           m,
+                                           n,
+                                           dA.data(),
+                                           lda,
+                                           tol,
+                                           dJpvt.data(),
+                                           dTau.data(),
+                                           dRank.data(),
+                                           dWork.data(),
+                                           size_W,
+                                           dInfo.data());
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void geqp3_initData(const hipsolverHandle_t handle,
+                    const int               m,
+                    const int               n,
+                    const int               k,
+                    Td&                     dA,
+                    const int               lda,
+                    Th&                     hA)
+{
+    if(CPU)
+    {
+        // A = X * Y has rank k, with X and Y well conditioned
+        host_strided_batch_vector<T> hX(size_t(m) * k, 1, size_t(m) * k, 1);
+        host_strided_batch_vector<T> hY(size_t(k) * n, 1, size_t(k) * n, 1);
+        rocblas_init<T>(hX, true);
+        rocblas_init<T>(hY, true);
+        for(int i = 0; i < k; i++)
+        {
+            hX[0][i + i * m] += 400;
+            hY[0][i + i * k] += 400;
+        }
+
+        cblas_gemm<T>(HIPSOLVER_OP_N,
+                      HIPSOLVER_OP_N,
+                      m,
+                      n,
+                      k,
+                      T(1),
+                      hX[0],
+                      m,
+                      hY[0],
+                      k,
+                      T(0),
+                      hA[0],
+                      lda);
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool FORTRAN,
+          bool TRUNCATED,
+          typename T,
+          typename S,
+          typename Td,
+          typename Ud,
+          typename Th,
+          typename Uh>
+void geqp3_getError(const hipsolverHandle_t handle,
+                    const int               m,
+                    const int               n,
+                    const int               k,
+                    Td&                     dA,
+                    const int               lda,
+                    const S                 tol,
+                    Ud&                     dJpvt,
+                    Td&                     dTau,
+                    Ud&                     dRank,
+                    Td&                     dWork,
+                    const int               lwork,
+                    Ud&                     dInfo,
+                    Th&                     hA,
+                    Th&                     hARes,
+                    Uh&                     hJpvt,
+                    Th&                     hTau,
+                    Uh&                     hRank,
+                    Uh&                     hInfo,
+                    double*                 max_err)
+{
+    int            minmn  = std::min(m, n);
+    int            size_W = 64 * m;
+    std::vector<T> hW(size_W);
+    std::vector<T> hQ(size_t(m) * m);
+    std::vector<T> hR(size_t(m) * n);
+    std::vector<T> hAP(size_t(m) * n);
+    std::vector<T> hQR(size_t(m) * n);
+
+    // input data initialization
+    geqp3_initData<true, true, T>(handle, m, n, k, dA, lda, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_geqp3(FORTRAN,
+                                        TRUNCATED,
+                                        handle,
+                                        m,
+                                        n,
+                                        dA.data(),
+                                        lda,
+                                        tol,
+                                        dJpvt.data(),
+                                        dTau.data(),
+                                        dRank.data(),
+                                        dWork.data(),
+                                        lwork,
+                                        dInfo.data()));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hJpvt.transfer_from(dJpvt));
+    CHECK_HIP_ERROR(hTau.transfer_from(dTau));
+    CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+    if(TRUNCATED)
+        CHECK_HIP_ERROR(hRank.transfer_from(dRank));
+
+    // jpvt must be a permutation and info must be zero
+    std::vector<int> seen(n, 0);
+    for(int j = 0; j < n; j++)
+    {
+        int p = hJpvt[0][j];
+        if(p < 1 || p > n || seen[p - 1]++)
+        {
+            *max_err = std::numeric_limits<double>::max();
+            return;
+        }
+    }
+    if(hInfo[0][0] != 0)
+    {
+        *max_err = std::numeric_limits<double>::max();
+        return;
+    }
+
+    // A has exact rank k, which the truncated factorization must reveal
+    int rank = TRUNCATED ? hRank[0][0] : minmn;
+    if(TRUNCATED && rank != k)
+    {
+        *max_err = std::numeric_limits<double>::max();
+        return;
+    }
+
+    // CPU lapack
+    // there is no unique solution: the result is checked through the residual
+    // ||A * P - Qres * Rres|| / ||A|| using frobenius norm, where Rres includes
+    // the residual block left by the truncated factorization
+    for(int j = 0; j < n; j++)
+    {
+        for(int i = 0; i < m; i++)
+        {
+            bool in_r = (i <= j && i < rank) || (i >= rank && j >= rank);
+            hR[i + j * m]  = in_r ? hARes[0][i + j * lda] : T(0);
+            hAP[i + j * m] = hA[0][i + (hJpvt[0][j] - 1) * lda];
+        }
+    }
+    for(int j = 0; j < m; j++)
+        for(int i = 0; i < m; i++)
+            hQ[i + j * m] = (j < minmn) ? hARes[0][i + j * lda] : T(0);
+    cblas_orgqr_ungqr<T>(m, m, minmn, hQ.data(), m, hTau[0], hW.data(), size_W);
+    cblas_gemm<T>(HIPSOLVER_OP_N,
+                  HIPSOLVER_OP_N,
+                  m,
+                  n,
+                  m,
+                  T(1),
+                  hQ.data(),
+                  m,
+                  hR.data(),
+                  m,
+                  T(0),
+                  hQR.data(),
+                  m);
+    *max_err = norm_error('F', m, n, m, hAP.data(), hQR.data());
+
+    // the diagonal of R must be non-increasing in magnitude
+    for(int i = 1; i < rank; i++)
+    {
+        if(std::abs(hARes[0][i + i * lda]) > std::abs(hARes[0][(i - 1) + (i - 1) * lda]) * 1.0001)
+            *max_err = std::numeric_limits<double>::max();
+    }
+}
+
+template <bool FORTRAN,
+          bool TRUNCATED,
+          typename T,
+          typename S,
+          typename Td,
+          typename Ud,
+          typename Th,
+          typename Uh>
+void geqp3_getPerfData(const hipsolverHandle_t handle,
+                       const int               m,
+                       const int               n,
+                       const int               k,
+                       Td&                     dA,
+                       const int               lda,
+                       const S                 tol,
+                       Ud&                     dJpvt,
+                       Td&                     dTau,
+                       Ud&                     dRank,
+                       Td&                     dWork,
+                       const int               lwork,
+                       Ud&                     dInfo,
+                       Th&                     hA,
+                       Uh&                     hJpvt,
+                       Th&                     hTau,
+                       double*                 gpu_time_used,
+                       double*                 cpu_time_used,
+                       const int               hot_calls,
+                       const bool              perf)
+{
+    int              size_W = 3 * n + 64 * (n + 1);
+    std::vector<T>   hW(size_W);
+    std::vector<S>   hRW(2 * n);
+    std::vector<int> hJ(n);
+
+    if(!perf)
+    {
+        geqp3_initData<true, false, T>(handle, m, n, k, dA, lda, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (the full factorization is always computed)
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_geqp3<T>(m, n, hA[0], lda, hJ.data(), hTau[0], hW.data(), size_W, hRW.data());
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    geqp3_initData<true, false, T>(handle, m, n, k, dA, lda, hA);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        geqp3_initData<false, true, T>(handle, m, n, k, dA, lda, hA);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_geqp3(FORTRAN,
+                                            TRUNCATED,
+                                            handle,
+                                            m,
+                                            n,
+                                            dA.data(),
+                                            lda,
+                                            tol,
+                                            dJpvt.data(),
+                                            dTau.data(),
+                                            dRank.data(),
+                                            dWork.data(),
+                                            lwork,
+                                            dInfo.data()));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    double start;
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        geqp3_initData<false, true, T>(handle, m, n, k, dA, lda, hA);
+
+        start = get_time_us_sync(stream);
+        hipsolver_geqp3(FORTRAN,
+                        TRUNCATED,
+                        handle,
+                        m,
+                        n,
+                        dA.data(),
+                        lda,
+                        tol,
+                        dJpvt.data(),
+                        dTau.data(),
+                        dRank.data(),
+                        dWork.data(),
+                        lwork,
+                        dInfo.data());
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool FORTRAN, bool TRUNCATED, typename T>
+void testing_geqp3(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    hipsolver_local_handle handle;
+    int                    m   = argus.get<int>("m");
+    int                    n   = argus.get<int>("n", m);
+    int                    lda = argus.get<int>("lda", m);
+    int                    k   = argus.get<int>("k", TRUNCATED ? min(m, n) / 2 : min(m, n));
+
+    // the truncated factorization stops below sqrt(eps) relative to the largest column norm
+    S tol = std::sqrt(std::numeric_limits<S>::epsilon());
+
+    int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    size_t size_tau  = max(min(m, n), 1);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || lda < m || k < 0 || k > min(m, n));
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_geqp3(FORTRAN,
+                                              TRUNCATED,
+                                              handle,
+                                              m,
+                                              n,
+                                              (T*)nullptr,
+                                              lda,
+                                              tol,
+                                              (int*)nullptr,
+                                              (T*)nullptr,
+                                              (int*)nullptr,
+                                              (T*)nullptr,
+                                              0,
+                                              (int*)nullptr),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T>     hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T>     hARes(size_ARes, 1, size_ARes, 1);
+    host_strided_batch_vector<T>     hTau(size_tau, 1, size_tau, 1);
+    host_strided_batch_vector<int>   hJpvt(max(n, 1), 1, max(n, 1), 1);
+    host_strided_batch_vector<int>   hRank(1, 1, 1, 1);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<T>   dTau(size_tau, 1, size_tau, 1);
+    device_strided_batch_vector<int> dJpvt(max(n, 1), 1, max(n, 1), 1);
+    device_strided_batch_vector<int> dRank(1, 1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dTau.memcheck());
+    CHECK_HIP_ERROR(dJpvt.memcheck());
+    CHECK_HIP_ERROR(dRank.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_geqp3_bufferSize(FORTRAN, TRUNCATED, handle, m, n, dA.data(), lda, &size_W);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check quick return
+    if(m == 0 || n == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_geqp3(FORTRAN,
+                                              TRUNCATED,
+                                              handle,
+                                              m,
+                                              n,
+                                              dA.data(),
+                                              lda,
+                                              tol,
+                                              dJpvt.data(),
+                                              dTau.data(),
+                                              dRank.data(),
+                                              dWork.data(),
+                                              size_W,
+                                              dInfo.data()),
+                              HIPSOLVER_STATUS_SUCCESS);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(0);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        geqp3_getError<FORTRAN, TRUNCATED, T>(handle,
+                                              m,
+                                              n,
+                                              k,
+                                              dA,
+                                              lda,
+                                              tol,
+                                              dJpvt,
+                                              dTau,
+                                              dRank,
+                                              dWork,
+                                              size_W,
+                                              dInfo,
+                                              hA,
+                                              hARes,
+                                              hJpvt,
+                                              hTau,
+                                              hRank,
+                                              hInfo,
+                                              &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        geqp3_getPerfData<FORTRAN, TRUNCATED, T>(handle,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 dA,
+                                                 lda,
+                                                 tol,
+                                                 dJpvt,
+                                                 dTau,
+                                                 dRank,
+                                                 dWork,
+                                                 size_W,
+                                                 dInfo,
+                                                 hA,
+                                                 hJpvt,
+                                                 hTau,
+                                                 &gpu_time_used,
+                                                 &cpu_time_used,
+                                                 hot_calls,
+                                                 argus.perf);
+
+    // validate results for rocsolver-test
+    // using m * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, m);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("m", "n", "lda", "k");
+            rocsolver_bench_output(m, n, lda, k);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
@@ -28,7 +28,7 @@ void geqrf_checkBadArgs(const hipsolverHandle_t handle,
     // values
     // N/A
 
-#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+#if !defined(__HIP_PLATFORM_NVCC__)
     // pointers
     EXPECT_ROCBLAS_STATUS(
         hipsolver_geqrf(
@@ -181,8 +181,6 @@ void geqrf_getError(const hipsolverHandle_t handle,
                     Vh&                     hInfo,
                     double*                 max_err)
 {
-    std::vector<T> hW(n);
-
     // input data initialization
     geqrf_initData<true, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
 
@@ -204,8 +202,10 @@ void geqrf_getError(const hipsolverHandle_t handle,
     CHECK_HIP_ERROR(hARes.transfer_from(dA));
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
+    cblas_batch(bc, [&](int b) {
+        std::vector<T> hW(n);
         cblas_geqrf<T>(m, n, hA[b], lda, hIpiv[b], hW.data(), n);
+    });
 
     // error is ||hA - hARes|| / ||hA|| (ideally ||QR - Qres Rres|| / ||QR||)
     // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
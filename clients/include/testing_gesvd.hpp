@@ -130,7 +130,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
 
-#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+#if !defined(__HIP_PLATFORM_NVCC__)
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(FORTRAN,
                                           handle,
@@ -485,7 +485,6 @@ void gesvd_getError(const hipsolverHandle_t handle,
                     double*                 max_errv)
 {
     int            size_W = 5 * max(m, n);
-    std::vector<T> hWork(size_W);
     std::vector<T> A(lda * n * bc);
 
     // input data initialization
@@ -526,22 +525,32 @@ void gesvd_getError(const hipsolverHandle_t handle,
     gesvd_initData<false, true, T>(handle, left_svect, right_svect, m, n, dA, lda, bc, hA, A);
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
-        cblas_gesvd<T>(left_svect,
-                       right_svect,
-                       m,
-                       n,
-                       hA[b],
-                       lda,
-                       hS[b],
-                       hU[b],
-                       ldu,
-                       hV[b],
-                       ldv,
-                       hWork.data(),
-                       size_W,
-                       hE[b],
-                       hinfo[b]);
+    hipsolver_reference_cache cache(
+        "gesvd", type2char<T>(), left_svect, right_svect, m, n, lda, ldu, ldv, bc);
+    cache.input(hA);
+    cache.output(hA, hS, hU, hV, hE, hinfo);
+    if(!cache.load())
+    {
+        cblas_batch(bc, [&](int b) {
+            std::vector<T> hWork(size_W);
+            cblas_gesvd<T>(left_svect,
+                           right_svect,
+                           m,
+                           n,
+                           hA[b],
+                           lda,
+                           hS[b],
+                           hU[b],
+                           ldu,
+                           hV[b],
+                           ldv,
+                           hWork.data(),
+                           size_W,
+                           hE[b],
+                           hinfo[b]);
+        });
+        cache.store();
+    }
 
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_gesvd(FORTRAN,
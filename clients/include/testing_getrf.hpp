@@ -18,7 +18,7 @@ void getrf_checkBadArgs(const hipsolverHandle_t handle,
                         V                       dinfo,
                         const int               bc)
 {
-#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+#if !defined(__HIP_PLATFORM_NVCC__)
     // handle
     EXPECT_ROCBLAS_STATUS(
         hipsolver_getrf(
@@ -128,8 +128,20 @@ void getrf_initData(const hipsolverHandle_t handle,
                     const int               bc,
                     Th&                     hA,
                     Uh&                     hIpiv,
-                    Uh&                     hInfo)
+                    Uh&                     hInfo,
+                    const bool              device_init)
 {
+    if(device_init)
+    {
+        // generate the matrices on the GPU, with the rows shuffled to test pivoting;
+        // the CPU gets a copy
+        hipsolver_seedrand();
+        device_init_dominant<T>(handle, m, n, dA, lda, true);
+        if(CPU)
+            CHECK_HIP_ERROR(hA.transfer_from(dA));
+        return;
+    }
+
     if(CPU)
     {
         T tmp;
@@ -189,11 +201,12 @@ void getrf_getError(const hipsolverHandle_t handle,
                     Uh&                     hIpivRes,
                     Uh&                     hInfo,
                     Uh&                     hInfoRes,
-                    double*                 max_err)
+                    double*                 max_err,
+                    const bool              device_init)
 {
     // input data initialization
     getrf_initData<true, true, T>(
-        handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo);
+        handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo, device_init);
 
     // execute computations
     // GPU lapack
@@ -216,8 +229,7 @@ void getrf_getError(const hipsolverHandle_t handle,
     CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
-        cblas_getrf<T>(m, n, hA[b], lda, hIpiv[b], hInfo[b]);
+    cblas_batch(bc, [&](int b) { cblas_getrf<T>(m, n, hA[b], lda, hIpiv[b], hInfo[b]); });
 
     // expecting original matrix to be non-singular
     // error is ||hA - hARes|| / ||hA|| (ideally ||LU - Lres Ures|| / ||LU||)
@@ -266,12 +278,13 @@ void getrf_getPerfData(const hipsolverHandle_t handle,
                        double*                 gpu_time_used,
                        double*                 cpu_time_used,
                        const int               hot_calls,
-                       const bool              perf)
+                       const bool              perf,
+                       const bool              device_init)
 {
     if(!perf)
     {
         getrf_initData<true, false, T>(
-            handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo);
+            handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo, device_init);
 
         // cpu-lapack performance (only if not in perf mode)
         *cpu_time_used = get_time_us_no_sync();
@@ -280,14 +293,16 @@ void getrf_getPerfData(const hipsolverHandle_t handle,
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
 
-    getrf_initData<true, false, T>(
-        handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo);
+    // with device_init, the GPU regenerates the matrices itself before each call
+    if(!device_init)
+        getrf_initData<true, false, T>(
+            handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo, device_init);
 
     // cold calls
     for(int iter = 0; iter < 2; iter++)
     {
         getrf_initData<false, true, T>(
-            handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo);
+            handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo, device_init);
 
         CHECK_ROCBLAS_ERROR(hipsolver_getrf(FORTRAN,
                                             false,
@@ -313,7 +328,7 @@ void getrf_getPerfData(const hipsolverHandle_t handle,
     for(int iter = 0; iter < hot_calls; iter++)
     {
         getrf_initData<false, true, T>(
-            handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo);
+            handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo, device_init);
 
         start = get_time_us_sync(stream);
         hipsolver_getrf(FORTRAN,
@@ -454,7 +469,8 @@ void testing_getrf(Arguments& argus)
         //                                hIpivRes,
         //                                hInfo,
         //                                hInfoRes,
-        //                                &max_error);
+        //                                &max_error,
+        //                                argus.device_init);
 
         // // collect performance data
         // if(argus.timing)
@@ -476,7 +492,8 @@ void testing_getrf(Arguments& argus)
         //                                   &gpu_time_used,
         //                                   &cpu_time_used,
         //                                   hot_calls,
-        //                                   argus.perf);
+        //                                   argus.perf,
+        //                                   argus.device_init);
     }
 
     else
@@ -523,7 +540,8 @@ void testing_getrf(Arguments& argus)
                                        hIpivRes,
                                        hInfo,
                                        hInfoRes,
-                                       &max_error);
+                                       &max_error,
+                                       argus.device_init);
 
         // collect performance data
         if(argus.timing)
@@ -545,7 +563,8 @@ void testing_getrf(Arguments& argus)
                                           &gpu_time_used,
                                           &cpu_time_used,
                                           hot_calls,
-                                          argus.perf);
+                                          argus.perf,
+                                          argus.device_init);
     }
 
     // validate results for rocsolver-test
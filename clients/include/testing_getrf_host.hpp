@@ -0,0 +1,533 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <bool FORTRAN, typename T, typename U>
+void getrf_host_checkBadArgs(const hipsolverHandle_t    handle,
+                             const hipsolverOperation_t trans,
+                             const int                  m,
+                             const int                  n,
+                             const int                  nrhs,
+                             T                          hA,
+                             const int                  lda,
+                             U                          hIpiv,
+                             const int                  stP,
+                             T                          hB,
+                             const int                  ldb,
+                             U                          hInfo,
+                             const int                  bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_getrf_host(FORTRAN, nullptr, m, n, hA, lda, hIpiv, stP, hInfo, bc),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_getrs_host(
+            FORTRAN, nullptr, trans, n, nrhs, hA, lda, hIpiv, stP, hB, ldb, hInfo, bc),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_getrs_host(FORTRAN,
+                                               handle,
+                                               hipsolverOperation_t(-1),
+                                               n,
+                                               nrhs,
+                                               hA,
+                                               lda,
+                                               hIpiv,
+                                               stP,
+                                               hB,
+                                               ldb,
+                                               hInfo,
+                                               bc),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_getrf_host(FORTRAN, handle, m, n, (T) nullptr, lda, hIpiv, stP, hInfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_getrf_host(FORTRAN, handle, m, n, hA, lda, hIpiv, stP, (U) nullptr, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_getrs_host(
+            FORTRAN, handle, trans, n, nrhs, hA, lda, (U) nullptr, stP, hB, ldb, hInfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_getrs_host(
+            FORTRAN, handle, trans, n, nrhs, hA, lda, hIpiv, stP, (T) nullptr, ldb, hInfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+template <bool FORTRAN, bool BATCHED, typename T>
+void testing_getrf_host_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    hipsolverOperation_t   trans = HIPSOLVER_OP_N;
+    int                    m     = 1;
+    int                    n     = 1;
+    int                    nrhs  = 1;
+    int                    lda   = 1;
+    int                    ldb   = 1;
+    int                    stP   = 1;
+    int                    bc    = 1;
+
+    // memory allocations
+    host_strided_batch_vector<int> hIpiv(1, 1, 1, 1);
+    host_strided_batch_vector<int> hInfo(1, 1, 1, 1);
+
+    if(BATCHED)
+    {
+        host_batch_vector<T> hA(1, 1, 1);
+        host_batch_vector<T> hB(1, 1, 1);
+
+        // check bad arguments
+        getrf_host_checkBadArgs<FORTRAN>(handle,
+                                         trans,
+                                         m,
+                                         n,
+                                         nrhs,
+                                         (T**)hA,
+                                         lda,
+                                         hIpiv.data(),
+                                         stP,
+                                         (T**)hB,
+                                         ldb,
+                                         hInfo.data(),
+                                         bc);
+    }
+    else
+    {
+        host_strided_batch_vector<T> hA(1, 1, 1, 1);
+        host_strided_batch_vector<T> hB(1, 1, 1, 1);
+
+        // check bad arguments
+        getrf_host_checkBadArgs<FORTRAN>(handle,
+                                         trans,
+                                         m,
+                                         n,
+                                         nrhs,
+                                         hA.data(),
+                                         lda,
+                                         hIpiv.data(),
+                                         stP,
+                                         hB.data(),
+                                         ldb,
+                                         hInfo.data(),
+                                         bc);
+    }
+}
+
+template <typename T, typename Th>
+void getrf_host_initData(const int m, const int n, Th& hA, const int lda, Th& hB, const int bc)
+{
+    T tmp;
+    rocblas_init<T>(hA, true);
+    rocblas_init<T>(hB, true);
+
+    for(int b = 0; b < bc; ++b)
+    {
+        // scale A to avoid singularities
+        for(int i = 0; i < m; i++)
+        {
+            for(int j = 0; j < n; j++)
+            {
+                if(i == j)
+                    hA[b][i + j * lda] += 400;
+                else
+                    hA[b][i + j * lda] -= 4;
+            }
+        }
+
+        // shuffle rows to test pivoting
+        for(int i = 0; i < m / 2; i++)
+        {
+            for(int j = 0; j < n; j++)
+            {
+                tmp                        = hA[b][i + j * lda];
+                hA[b][i + j * lda]         = hA[b][m - 1 - i + j * lda];
+                hA[b][m - 1 - i + j * lda] = tmp;
+            }
+        }
+    }
+}
+
+template <bool FORTRAN, typename T, typename Th, typename Uh>
+void getrf_host_getError(const hipsolverHandle_t    handle,
+                         const hipsolverOperation_t trans,
+                         const int                  m,
+                         const int                  n,
+                         const int                  nrhs,
+                         const int                  lda,
+                         const int                  stP,
+                         const int                  ldb,
+                         const int                  bc,
+                         Th&                        hA,
+                         Th&                        hARes,
+                         Th&                        hB,
+                         Th&                        hBRes,
+                         Uh&                        hIpiv,
+                         Uh&                        hIpivRes,
+                         Uh&                        hInfo,
+                         Uh&                        hInfoRes,
+                         double*                    max_err)
+{
+    size_t         size_A = size_t(lda) * n;
+    size_t         size_B = size_t(ldb) * nrhs;
+    std::vector<T> hAX(size_B);
+
+    // input data initialization
+    getrf_host_initData<T>(m, n, hA, lda, hB, bc);
+    for(int b = 0; b < bc; ++b)
+    {
+        std::copy(hA[b], hA[b] + size_A, hARes[b]);
+        std::copy(hB[b], hB[b] + size_B, hBRes[b]);
+    }
+
+    // execute computations
+    // GPU lapack (the matrices stay in host memory)
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_host(
+        FORTRAN, handle, m, n, hARes, lda, hIpivRes.data(), stP, hInfoRes.data(), bc));
+
+    // the solve is only checked for square systems
+    *max_err = 0;
+    if(m == n && nrhs > 0)
+    {
+        CHECK_ROCBLAS_ERROR(hipsolver_getrs_host(FORTRAN,
+                                                 handle,
+                                                 trans,
+                                                 n,
+                                                 nrhs,
+                                                 hARes,
+                                                 lda,
+                                                 hIpivRes.data(),
+                                                 stP,
+                                                 hBRes,
+                                                 ldb,
+                                                 hInfo.data(),
+                                                 bc));
+
+        // the solution is checked through the residual ||B - op(A) Xres|| / ||B||
+        // using frobenius norm
+        for(int b = 0; b < bc; ++b)
+        {
+            cblas_gemm<T>(trans,
+                          HIPSOLVER_OP_N,
+                          n,
+                          nrhs,
+                          n,
+                          T(1),
+                          hA[b],
+                          lda,
+                          hBRes[b],
+                          ldb,
+                          T(0),
+                          hAX.data(),
+                          ldb);
+            double err = norm_error('F', n, nrhs, ldb, hB[b], hAX.data());
+            *max_err   = err > *max_err ? err : *max_err;
+        }
+
+        // getrs has no failure modes
+        if(hInfo[0][0] != 0)
+            *max_err = std::numeric_limits<double>::max();
+    }
+
+    // CPU lapack
+    cblas_batch(bc,
+                [&](int b) { cblas_getrf<T>(m, n, hA[b], lda, hIpiv[0] + b * stP, hInfo[b]); });
+
+    // error is ||hA - hARes|| / ||hA||
+    // using frobenius norm
+    double err;
+    for(int b = 0; b < bc; ++b)
+    {
+        err      = norm_error('F', m, n, lda, hA[b], hARes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        // also check pivoting (count the number of incorrect pivots)
+        err = 0;
+        for(int i = 0; i < std::min(m, n); ++i)
+            if(hIpiv[0][b * stP + i] != hIpivRes[0][b * stP + i])
+                err++;
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check info for singularities
+    err = 0;
+    for(int b = 0; b < bc; ++b)
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    *max_err += err;
+}
+
+template <bool FORTRAN, typename T, typename Th, typename Uh>
+void getrf_host_getPerfData(const hipsolverHandle_t handle,
+                            const int               m,
+                            const int               n,
+                            const int               lda,
+                            const int               stP,
+                            const int               bc,
+                            Th&                     hA,
+                            Th&                     hARes,
+                            Th&                     hB,
+                            Uh&                     hIpiv,
+                            Uh&                     hInfo,
+                            double*                 gpu_time_used,
+                            double*                 cpu_time_used,
+                            const int               hot_calls,
+                            const bool              perf)
+{
+    size_t size_A = size_t(lda) * n;
+
+    getrf_host_initData<T>(m, n, hA, lda, hB, bc);
+
+    if(!perf)
+    {
+        for(int b = 0; b < bc; ++b)
+            std::copy(hA[b], hA[b] + size_A, hARes[b]);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(int b = 0; b < bc; ++b)
+            cblas_getrf<T>(m, n, hARes[b], lda, hIpiv[0] + b * stP, hInfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        for(int b = 0; b < bc; ++b)
+            std::copy(hA[b], hA[b] + size_A, hARes[b]);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_getrf_host(
+            FORTRAN, handle, m, n, hARes, lda, hIpiv.data(), stP, hInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    // (the functions synchronize with the host, so the time includes all the copies)
+    double start;
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        for(int b = 0; b < bc; ++b)
+            std::copy(hA[b], hA[b] + size_A, hARes[b]);
+
+        start = get_time_us_no_sync();
+        hipsolver_getrf_host(
+            FORTRAN, handle, m, n, hARes, lda, hIpiv.data(), stP, hInfo.data(), bc);
+        *gpu_time_used += get_time_us_no_sync() - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool FORTRAN, bool BATCHED, typename T>
+void testing_getrf_host(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    char                   transC = argus.get<char>("trans", 'N');
+    int                    m      = argus.get<int>("m");
+    int                    n      = argus.get<int>("n", m);
+    int                    nrhs   = argus.get<int>("nrhs", 1);
+    int                    lda    = argus.get<int>("lda", m);
+    int                    ldb    = argus.get<int>("ldb", n);
+    int                    stP    = argus.get<int>("strideP", std::min(m, n));
+
+    hipsolverOperation_t trans     = char2hipsolver_operation(transC);
+    int                  bc        = BATCHED ? argus.batch_count : 1;
+    int                  hot_calls = argus.iters;
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    size_t size_B    = size_t(ldb) * nrhs;
+    size_t size_P    = size_t(stP) * bc;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(hipsolver_getrf_host(FORTRAN,
+                                                       handle,
+                                                       m,
+                                                       n,
+                                                       (T**)nullptr,
+                                                       lda,
+                                                       (int*)nullptr,
+                                                       stP,
+                                                       (int*)nullptr,
+                                                       bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        else
+            EXPECT_ROCBLAS_STATUS(hipsolver_getrf_host(FORTRAN,
+                                                       handle,
+                                                       m,
+                                                       n,
+                                                       (T*)nullptr,
+                                                       lda,
+                                                       (int*)nullptr,
+                                                       stP,
+                                                       (int*)nullptr,
+                                                       bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    // (all the arguments are host pointers)
+    host_strided_batch_vector<int> hIpiv(std::max<size_t>(size_P, 1), 1, size_P, 1);
+    host_strided_batch_vector<int> hIpivRes(std::max<size_t>(size_P, 1), 1, size_P, 1);
+    host_strided_batch_vector<int> hInfo(1, 1, 1, std::max(bc, 1));
+    host_strided_batch_vector<int> hInfoRes(1, 1, 1, std::max(bc, 1));
+
+    if(BATCHED)
+    {
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hARes(size_A, 1, bc);
+        host_batch_vector<T> hB(size_B, 1, bc);
+        host_batch_vector<T> hBRes(size_B, 1, bc);
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            getrf_host_getError<FORTRAN, T>(handle,
+                                            trans,
+                                            m,
+                                            n,
+                                            nrhs,
+                                            lda,
+                                            stP,
+                                            ldb,
+                                            bc,
+                                            hA,
+                                            hARes,
+                                            hB,
+                                            hBRes,
+                                            hIpiv,
+                                            hIpivRes,
+                                            hInfo,
+                                            hInfoRes,
+                                            &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            getrf_host_getPerfData<FORTRAN, T>(handle,
+                                               m,
+                                               n,
+                                               lda,
+                                               stP,
+                                               bc,
+                                               hA,
+                                               hARes,
+                                               hB,
+                                               hIpiv,
+                                               hInfo,
+                                               &gpu_time_used,
+                                               &cpu_time_used,
+                                               hot_calls,
+                                               argus.perf);
+    }
+    else
+    {
+        host_strided_batch_vector<T> hA(size_A, 1, size_A, 1);
+        host_strided_batch_vector<T> hARes(size_A, 1, size_A, 1);
+        host_strided_batch_vector<T> hB(size_B, 1, size_B, 1);
+        host_strided_batch_vector<T> hBRes(size_B, 1, size_B, 1);
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            getrf_host_getError<FORTRAN, T>(handle,
+                                            trans,
+                                            m,
+                                            n,
+                                            nrhs,
+                                            lda,
+                                            stP,
+                                            ldb,
+                                            bc,
+                                            hA,
+                                            hARes,
+                                            hB,
+                                            hBRes,
+                                            hIpiv,
+                                            hIpivRes,
+                                            hInfo,
+                                            hInfoRes,
+                                            &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            getrf_host_getPerfData<FORTRAN, T>(handle,
+                                               m,
+                                               n,
+                                               lda,
+                                               stP,
+                                               bc,
+                                               hA,
+                                               hARes,
+                                               hB,
+                                               hIpiv,
+                                               hInfo,
+                                               &gpu_time_used,
+                                               &cpu_time_used,
+                                               hot_calls,
+                                               argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using min(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, std::min(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", "lda", "strideP", "batch_c");
+                rocsolver_bench_output(m, n, lda, stP, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "lda");
+                rocsolver_bench_output(m, n, lda);
+            }
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
@@ -18,7 +18,7 @@ void getrf_npvt_checkBadArgs(const hipsolverHandle_t handle,
                              V                       dinfo,
                              const int               bc)
 {
-#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+#if !defined(__HIP_PLATFORM_NVCC__)
     // handle
     EXPECT_ROCBLAS_STATUS(
         hipsolver_getrf(
@@ -196,8 +196,7 @@ void getrf_npvt_getError(const hipsolverHandle_t handle,
     CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
-        cblas_getrf<T>(m, n, hA[b], lda, hIpiv[b], hInfo[b]);
+    cblas_batch(bc, [&](int b) { cblas_getrf<T>(m, n, hA[b], lda, hIpiv[b], hInfo[b]); });
 
     // expecting original matrix to be non-singular
     // error is ||hA - hARes|| / ||hA|| (ideally ||LU - Lres Ures|| / ||LU||)
@@ -64,7 +64,7 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_ENUM);
 
-#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+#if !defined(__HIP_PLATFORM_NVCC__)
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_getrs(FORTRAN,
                                           handle,
@@ -224,11 +224,53 @@ void getrs_initData(const hipsolverHandle_t    handle,
                     Td&                        dB,
                     const int                  ldb,
                     const int                  stB,
+                    Td&                        dWork,
+                    const int                  lwork,
+                    Ud&                        dInfo,
                     const int                  bc,
                     Th&                        hA,
                     Uh&                        hIpiv,
-                    Th&                        hB)
+                    Th&                        hB,
+                    Uh&                        hInfo,
+                    const bool                 device_init)
 {
+    if(device_init)
+    {
+        // generate the matrices on the GPU and do the LU decomposition of matrix A there, with
+        // the workspace of getrs, which is allocated for getrf as well; the CPU gets a copy
+        hipsolver_seedrand();
+        device_init_dominant<T>(handle, m, m, dA, lda);
+        device_init_uniform<T>(handle, m, nrhs, dB, ldb);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_getrf(false,
+                                            false,
+                                            handle,
+                                            m,
+                                            m,
+                                            dA.data(),
+                                            lda,
+                                            stA,
+                                            dWork.data(),
+                                            lwork,
+                                            dIpiv.data(),
+                                            stP,
+                                            dInfo.data(),
+                                            bc));
+
+        // the generated matrices are diagonally dominant, so none of them can be singular
+        CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+        for(int b = 0; b < bc; ++b)
+            CHECK_INFO_ZERO(hInfo[b][0]);
+
+        if(CPU)
+        {
+            CHECK_HIP_ERROR(hA.transfer_from(dA));
+            CHECK_HIP_ERROR(hB.transfer_from(dB));
+            CHECK_HIP_ERROR(hIpiv.transfer_from(dIpiv));
+        }
+        return;
+    }
+
     if(CPU)
     {
         rocblas_init<T>(hA, true);
@@ -288,11 +330,31 @@ void getrs_getError(const hipsolverHandle_t    handle,
                     Th&                        hB,
                     Th&                        hBRes,
                     Uh&                        hInfo,
-                    double*                    max_err)
+                    double*                    max_err,
+                    const bool                 device_init)
 {
     // input data initialization
-    getrs_initData<true, true, T>(
-        handle, trans, m, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, bc, hA, hIpiv, hB);
+    getrs_initData<true, true, T>(handle,
+                                  trans,
+                                  m,
+                                  nrhs,
+                                  dA,
+                                  lda,
+                                  stA,
+                                  dIpiv,
+                                  stP,
+                                  dB,
+                                  ldb,
+                                  stB,
+                                  dWork,
+                                  lwork,
+                                  dInfo,
+                                  bc,
+                                  hA,
+                                  hIpiv,
+                                  hB,
+                                  hInfo,
+                                  device_init);
 
     // execute computations
     // GPU lapack
@@ -316,10 +378,8 @@ void getrs_getError(const hipsolverHandle_t    handle,
     CHECK_HIP_ERROR(hBRes.transfer_from(dB));
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
-    {
-        cblas_getrs<T>(trans, m, nrhs, hA[b], lda, hIpiv[b], hB[b], ldb);
-    }
+    cblas_batch(bc,
+                [&](int b) { cblas_getrs<T>(trans, m, nrhs, hA[b], lda, hIpiv[b], hB[b], ldb); });
 
     // error is ||hB - hBRes|| / ||hB||
     // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
@@ -358,12 +418,32 @@ void getrs_getPerfData(const hipsolverHandle_t    handle,
                        double*                    gpu_time_used,
                        double*                    cpu_time_used,
                        const int                  hot_calls,
-                       const bool                 perf)
+                       const bool                 perf,
+                       const bool                 device_init)
 {
     if(!perf)
     {
-        getrs_initData<true, false, T>(
-            handle, trans, m, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, bc, hA, hIpiv, hB);
+        getrs_initData<true, false, T>(handle,
+                                       trans,
+                                       m,
+                                       nrhs,
+                                       dA,
+                                       lda,
+                                       stA,
+                                       dIpiv,
+                                       stP,
+                                       dB,
+                                       ldb,
+                                       stB,
+                                       dWork,
+                                       lwork,
+                                       dInfo,
+                                       bc,
+                                       hA,
+                                       hIpiv,
+                                       hB,
+                                       hInfo,
+                                       device_init);
 
         // cpu-lapack performance (only if not in perf mode)
         *cpu_time_used = get_time_us_no_sync();
@@ -374,14 +454,54 @@ void getrs_getPerfData(const hipsolverHandle_t    handle,
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
 
-    getrs_initData<true, false, T>(
-        handle, trans, m, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, bc, hA, hIpiv, hB);
+    // with device_init, the GPU regenerates the matrices itself before each call
+    if(!device_init)
+        getrs_initData<true, false, T>(handle,
+                                       trans,
+                                       m,
+                                       nrhs,
+                                       dA,
+                                       lda,
+                                       stA,
+                                       dIpiv,
+                                       stP,
+                                       dB,
+                                       ldb,
+                                       stB,
+                                       dWork,
+                                       lwork,
+                                       dInfo,
+                                       bc,
+                                       hA,
+                                       hIpiv,
+                                       hB,
+                                       hInfo,
+                                       device_init);
 
     // cold calls
     for(int iter = 0; iter < 2; iter++)
     {
-        getrs_initData<false, true, T>(
-            handle, trans, m, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, bc, hA, hIpiv, hB);
+        getrs_initData<false, true, T>(handle,
+                                       trans,
+                                       m,
+                                       nrhs,
+                                       dA,
+                                       lda,
+                                       stA,
+                                       dIpiv,
+                                       stP,
+                                       dB,
+                                       ldb,
+                                       stB,
+                                       dWork,
+                                       lwork,
+                                       dInfo,
+                                       bc,
+                                       hA,
+                                       hIpiv,
+                                       hB,
+                                       hInfo,
+                                       device_init);
 
         CHECK_ROCBLAS_ERROR(hipsolver_getrs(FORTRAN,
                                             handle,
@@ -409,8 +529,27 @@ void getrs_getPerfData(const hipsolverHandle_t    handle,
 
     for(int iter = 0; iter < hot_calls; iter++)
     {
-        getrs_initData<false, true, T>(
-            handle, trans, m, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, bc, hA, hIpiv, hB);
+        getrs_initData<false, true, T>(handle,
+                                       trans,
+                                       m,
+                                       nrhs,
+                                       dA,
+                                       lda,
+                                       stA,
+                                       dIpiv,
+                                       stP,
+                                       dB,
+                                       ldb,
+                                       stB,
+                                       dWork,
+                                       lwork,
+                                       dInfo,
+                                       bc,
+                                       hA,
+                                       hIpiv,
+                                       hB,
+                                       hInfo,
+                                       device_init);
 
         start = get_time_us_sync(stream);
         hipsolver_getrs(FORTRAN,
@@ -569,7 +708,8 @@ void testing_getrs(Arguments& argus)
         //                                hB,
         //                                hBRes,
         //                                hInfo,
-        //                                &max_error);
+        //                                &max_error,
+        //                                argus.device_init);
 
         // // collect performance data
         // if(argus.timing)
@@ -596,7 +736,8 @@ void testing_getrs(Arguments& argus)
         //                                   &gpu_time_used,
         //                                   &cpu_time_used,
         //                                   hot_calls,
-        //                                   argus.perf);
+        //                                   argus.perf,
+        //                                   argus.device_init);
     }
 
     else
@@ -619,9 +760,13 @@ void testing_getrs(Arguments& argus)
             CHECK_HIP_ERROR(dIpiv.memcheck());
         CHECK_HIP_ERROR(dInfo.memcheck());
 
-        int size_W;
+        // with device_init, the same workspace is used by the getrf of the input matrices
+        int size_W, size_WF = 0;
         hipsolver_getrs_bufferSize(
             FORTRAN, handle, trans, m, nrhs, dA.data(), lda, dIpiv.data(), dB.data(), ldb, &size_W);
+        if(argus.device_init)
+            hipsolver_getrf_bufferSize(false, handle, m, m, dA.data(), lda, &size_WF);
+        size_W = std::max(size_W, size_WF);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
@@ -649,7 +794,8 @@ void testing_getrs(Arguments& argus)
                                        hB,
                                        hBRes,
                                        hInfo,
-                                       &max_error);
+                                       &max_error,
+                                       argus.device_init);
 
         // collect performance data
         if(argus.timing)
@@ -676,7 +822,8 @@ void testing_getrs(Arguments& argus)
                                           &gpu_time_used,
                                           &cpu_time_used,
                                           hot_calls,
-                                          argus.perf);
+                                          argus.perf,
+                                          argus.device_init);
     }
 
     // validate results for rocsolver-test
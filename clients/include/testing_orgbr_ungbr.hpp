@@ -30,7 +30,7 @@ void orgbr_ungbr_checkBadArgs(const hipsolverHandle_t   handle,
             FORTRAN, handle, hipsolverSideMode_t(-1), m, n, k, dA, lda, dIpiv, dWork, lwork, dInfo),
         HIPSOLVER_STATUS_INVALID_ENUM);
 
-#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+#if !defined(__HIP_PLATFORM_NVCC__)
     // pointers
     EXPECT_ROCBLAS_STATUS(
         hipsolver_orgbr_ungbr(
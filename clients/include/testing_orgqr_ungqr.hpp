@@ -26,7 +26,7 @@ void orgqr_ungqr_checkBadArgs(const hipsolverHandle_t handle,
     // values
     // N/A
 
-#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+#if !defined(__HIP_PLATFORM_NVCC__)
     // pointers
     EXPECT_ROCBLAS_STATUS(
         hipsolver_orgqr_ungqr(
@@ -29,7 +29,7 @@ void potrf_checkBadArgs(const hipsolverHandle_t   handle,
             FORTRAN, handle, hipsolverFillMode_t(-1), n, dA, lda, stA, dWork, lwork, dinfo, bc),
         HIPSOLVER_STATUS_INVALID_ENUM);
 
-#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+#if !defined(__HIP_PLATFORM_NVCC__)
     // pointers
     EXPECT_ROCBLAS_STATUS(
         hipsolver_potrf(FORTRAN, handle, uplo, n, (T) nullptr, lda, stA, dWork, lwork, dinfo, bc),
@@ -100,8 +100,19 @@ void potrf_initData(const hipsolverHandle_t   handle,
                     const int                 bc,
                     Th&                       hA,
                     Th&                       hATmp,
-                    Uh&                       hInfo)
+                    Uh&                       hInfo,
+                    const bool                device_init)
 {
+    if(device_init)
+    {
+        // generate the matrices on the GPU; the CPU gets a copy
+        hipsolver_seedrand();
+        device_init_hpd<T>(handle, n, dA, lda);
+        if(CPU)
+            CHECK_HIP_ERROR(hA.transfer_from(dA));
+        return;
+    }
+
     if(CPU)
     {
         rocblas_init<T>(hATmp, true);
@@ -150,10 +161,12 @@ void potrf_getError(const hipsolverHandle_t   handle,
                     Th&                       hARes,
                     Uh&                       hInfo,
                     Uh&                       hInfoRes,
-                    double*                   max_err)
+                    double*                   max_err,
+                    const bool                device_init)
 {
     // input data initialization
-    potrf_initData<true, true, T>(handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hARes, hInfo);
+    potrf_initData<true, true, T>(
+        handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hARes, hInfo, device_init);
 
     // execute computations
     // GPU lapack
@@ -163,8 +176,7 @@ void potrf_getError(const hipsolverHandle_t   handle,
     CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
-        cblas_potrf<T>(uplo, n, hA[b], lda, hInfo[b]);
+    cblas_batch(bc, [&](int b) { cblas_potrf<T>(uplo, n, hA[b], lda, hInfo[b]); });
 
     // error is ||hA - hARes|| / ||hA|| (ideally ||LL' - Lres Lres'|| / ||LL'||)
     // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
@@ -211,11 +223,13 @@ void potrf_getPerfData(const hipsolverHandle_t   handle,
                        double*                   gpu_time_used,
                        double*                   cpu_time_used,
                        const int                 hot_calls,
-                       const bool                perf)
+                       const bool                perf,
+                       const bool                device_init)
 {
     if(!perf)
     {
-        potrf_initData<true, false, T>(handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hATmp, hInfo);
+        potrf_initData<true, false, T>(
+            handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hATmp, hInfo, device_init);
 
         // cpu-lapack performance (only if not in perf mode)
         *cpu_time_used = get_time_us_no_sync();
@@ -224,12 +238,16 @@ void potrf_getPerfData(const hipsolverHandle_t   handle,
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
 
-    potrf_initData<true, false, T>(handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hATmp, hInfo);
+    // with device_init, the GPU regenerates the matrices itself before each call
+    if(!device_init)
+        potrf_initData<true, false, T>(
+            handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hATmp, hInfo, device_init);
 
     // cold calls
     for(int iter = 0; iter < 2; iter++)
     {
-        potrf_initData<false, true, T>(handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hATmp, hInfo);
+        potrf_initData<false, true, T>(
+            handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hATmp, hInfo, device_init);
 
         CHECK_ROCBLAS_ERROR(hipsolver_potrf(
             FORTRAN, handle, uplo, n, dA.data(), lda, stA, dWork.data(), lwork, dInfo.data(), bc));
@@ -242,7 +260,8 @@ void potrf_getPerfData(const hipsolverHandle_t   handle,
 
     for(int iter = 0; iter < hot_calls; iter++)
     {
-        potrf_initData<false, true, T>(handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hATmp, hInfo);
+        potrf_initData<false, true, T>(
+            handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hATmp, hInfo, device_init);
 
         start = get_time_us_sync(stream);
         hipsolver_potrf(
@@ -392,7 +411,8 @@ void testing_potrf(Arguments& argus)
                                        hARes,
                                        hInfo,
                                        hInfoRes,
-                                       &max_error);
+                                       &max_error,
+                                       argus.device_init);
 
         // collect performance data
         if(argus.timing)
@@ -412,7 +432,8 @@ void testing_potrf(Arguments& argus)
                                           &gpu_time_used,
                                           &cpu_time_used,
                                           hot_calls,
-                                          argus.perf);
+                                          argus.perf,
+                                          argus.device_init);
     }
 
     else
@@ -450,7 +471,8 @@ void testing_potrf(Arguments& argus)
                                        hARes,
                                        hInfo,
                                        hInfoRes,
-                                       &max_error);
+                                       &max_error,
+                                       argus.device_init);
 
         // collect performance data
         if(argus.timing)
@@ -470,7 +492,8 @@ void testing_potrf(Arguments& argus)
                                           &gpu_time_used,
                                           &cpu_time_used,
                                           hot_calls,
-                                          argus.perf);
+                                          argus.perf,
+                                          argus.device_init);
     }
 
     // validate results for rocsolver-test
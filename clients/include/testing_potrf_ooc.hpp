@@ -0,0 +1,372 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <bool FORTRAN, typename T>
+void potrf_ooc_checkBadArgs(const hipsolverHandle_t   handle,
+                            const hipsolverFillMode_t uplo,
+                            const int                 n,
+                            const int                 nrhs,
+                            T                         hA,
+                            const int                 lda,
+                            T                         hB,
+                            const int                 ldb,
+                            const size_t              budget,
+                            int*                      hInfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_potrf_ooc(FORTRAN, nullptr, uplo, n, hA, lda, budget, hInfo),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrs_ooc(FORTRAN, nullptr, uplo, n, nrhs, hA, lda, hB, ldb, budget, hInfo),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrf_ooc(FORTRAN, handle, hipsolverFillMode_t(-1), n, hA, lda, budget, hInfo),
+        HIPSOLVER_STATUS_INVALID_ENUM);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrf_ooc(FORTRAN, handle, uplo, n, (T) nullptr, lda, budget, hInfo),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrf_ooc(FORTRAN, handle, uplo, n, hA, lda, budget, (int*)nullptr),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrs_ooc(
+            FORTRAN, handle, uplo, n, nrhs, hA, lda, (T) nullptr, ldb, budget, hInfo),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+template <bool FORTRAN, typename T>
+void testing_potrf_ooc_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    hipsolverFillMode_t    uplo   = HIPSOLVER_FILL_MODE_UPPER;
+    int                    n      = 1;
+    int                    nrhs   = 1;
+    int                    lda    = 1;
+    int                    ldb    = 1;
+    size_t                 budget = size_t(1) << 20;
+
+    // memory allocations
+    host_strided_batch_vector<T>   hA(1, 1, 1, 1);
+    host_strided_batch_vector<T>   hB(1, 1, 1, 1);
+    host_strided_batch_vector<int> hInfo(1, 1, 1, 1);
+
+    // check bad arguments
+    potrf_ooc_checkBadArgs<FORTRAN>(
+        handle, uplo, n, nrhs, hA.data(), lda, hB.data(), ldb, budget, hInfo.data());
+}
+
+template <typename T, typename Th>
+void potrf_ooc_initData(const hipsolverHandle_t handle,
+                        const int               n,
+                        const int               nrhs,
+                        Th&                     hA,
+                        const int               lda,
+                        Th&                     hB,
+                        const int               ldb,
+                        Th&                     hATmp)
+{
+    rocblas_init<T>(hATmp, true);
+    rocblas_init<T>(hB, true);
+
+    // make A hermitian and scale to ensure positive definiteness
+    cblas_gemm(HIPSOLVER_OP_N,
+               HIPSOLVER_OP_C,
+               n,
+               n,
+               n,
+               (T)1.0,
+               hATmp[0],
+               lda,
+               hATmp[0],
+               lda,
+               (T)0.0,
+               hA[0],
+               lda);
+
+    for(int i = 0; i < n; i++)
+        hA[0][i + i * lda] += 400;
+}
+
+template <bool FORTRAN, typename T, typename Th, typename Uh>
+void potrf_ooc_getError(const hipsolverHandle_t   handle,
+                        const hipsolverFillMode_t uplo,
+                        const int                 n,
+                        const int                 nrhs,
+                        const int                 lda,
+                        const int                 ldb,
+                        const size_t              budget,
+                        Th&                       hA,
+                        Th&                       hARes,
+                        Th&                       hB,
+                        Th&                       hBRes,
+                        Uh&                       hInfo,
+                        Uh&                       hInfoRes,
+                        double*                   max_err)
+{
+    size_t size_A = size_t(lda) * n;
+    size_t size_B = size_t(ldb) * nrhs;
+
+    // input data initialization
+    potrf_ooc_initData<T>(handle, n, nrhs, hA, lda, hB, ldb, hARes);
+    std::copy(hA[0], hA[0] + size_A, hARes[0]);
+    std::copy(hB[0], hB[0] + size_B, hBRes[0]);
+
+    // execute computations
+    // GPU lapack (the matrices stay in host memory)
+    CHECK_ROCBLAS_ERROR(
+        hipsolver_potrf_ooc(FORTRAN, handle, uplo, n, hARes.data(), lda, budget, hInfoRes.data()));
+    CHECK_ROCBLAS_ERROR(hipsolver_potrs_ooc(FORTRAN,
+                                            handle,
+                                            uplo,
+                                            n,
+                                            nrhs,
+                                            hARes.data(),
+                                            lda,
+                                            hBRes.data(),
+                                            ldb,
+                                            budget,
+                                            hInfo.data()));
+
+    // potrs has no failure modes
+    *max_err = 0;
+    if(hInfo[0][0] != 0)
+        *max_err = std::numeric_limits<double>::max();
+
+    // CPU lapack
+    cblas_potrf<T>(uplo, n, hA[0], lda, hInfo[0]);
+    cblas_potrs<T>(uplo, n, nrhs, hA[0], lda, hB[0], ldb);
+
+    // error is ||hA - hARes|| / ||hA||
+    // using frobenius norm
+    double err;
+    if(uplo == HIPSOLVER_FILL_MODE_UPPER)
+        err = norm_error_upperTr('F', n, n, lda, hA[0], hARes[0]);
+    else
+        err = norm_error_lowerTr('F', n, n, lda, hA[0], hARes[0]);
+    *max_err = err > *max_err ? err : *max_err;
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (the residual ||B - A Xres|| / ||B|| grows with the condition number of A)
+    // using vector-induced infinity norm
+    if(nrhs > 0)
+    {
+        err      = norm_error('I', n, nrhs, ldb, hB[0], hBRes[0]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check info
+    if(hInfo[0][0] != hInfoRes[0][0])
+        *max_err += 1;
+}
+
+template <bool FORTRAN, typename T, typename Th, typename Uh>
+void potrf_ooc_getPerfData(const hipsolverHandle_t   handle,
+                           const hipsolverFillMode_t uplo,
+                           const int                 n,
+                           const int                 nrhs,
+                           const int                 lda,
+                           const int                 ldb,
+                           const size_t              budget,
+                           Th&                       hA,
+                           Th&                       hARes,
+                           Th&                       hB,
+                           Uh&                       hInfo,
+                           double*                   gpu_time_used,
+                           double*                   cpu_time_used,
+                           const int                 hot_calls,
+                           const bool                perf)
+{
+    size_t size_A = size_t(lda) * n;
+
+    potrf_ooc_initData<T>(handle, n, nrhs, hA, lda, hB, ldb, hARes);
+
+    if(!perf)
+    {
+        std::copy(hA[0], hA[0] + size_A, hARes[0]);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_potrf<T>(uplo, n, hARes[0], lda, hInfo[0]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        std::copy(hA[0], hA[0] + size_A, hARes[0]);
+
+        CHECK_ROCBLAS_ERROR(
+            hipsolver_potrf_ooc(FORTRAN, handle, uplo, n, hARes.data(), lda, budget, hInfo.data()));
+    }
+
+    // gpu-lapack performance
+    // (the functions synchronize with the host, so the time includes all the copies)
+    double start;
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        std::copy(hA[0], hA[0] + size_A, hARes[0]);
+
+        start = get_time_us_no_sync();
+        hipsolver_potrf_ooc(FORTRAN, handle, uplo, n, hARes.data(), lda, budget, hInfo.data());
+        *gpu_time_used += get_time_us_no_sync() - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool FORTRAN, typename T>
+void testing_potrf_ooc(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    char                   uploC = argus.get<char>("uplo");
+    int                    n     = argus.get<int>("n");
+    int                    nrhs  = argus.get<int>("nrhs", 1);
+    int                    lda   = argus.get<int>("lda", n);
+    int                    ldb   = argus.get<int>("ldb", n);
+
+    // by default, only about half of the matrix fits in the device memory budget (in KiB)
+    size_t size_A = size_t(lda) * n;
+    int    half   = int(std::max<size_t>(sizeof(T) * size_A / 2048, 4096));
+    int    budget = argus.get<int>("budget", half);
+
+    hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
+    size_t              budgetB   = size_t(budget) * 1024;
+    int                 hot_calls = argus.iters;
+
+    // check non-supported values
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            hipsolver_potrf_ooc(FORTRAN, handle, uplo, n, (T*)nullptr, lda, budgetB, (int*)nullptr),
+            HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_B    = size_t(ldb) * nrhs;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || lda < n || ldb < n);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            hipsolver_potrf_ooc(FORTRAN, handle, uplo, n, (T*)nullptr, lda, budgetB, (int*)nullptr),
+            HIPSOLVER_STATUS_INVALID_VALUE);
+        EXPECT_ROCBLAS_STATUS(hipsolver_potrs_ooc(FORTRAN,
+                                                  handle,
+                                                  uplo,
+                                                  n,
+                                                  nrhs,
+                                                  (T*)nullptr,
+                                                  lda,
+                                                  (T*)nullptr,
+                                                  ldb,
+                                                  budgetB,
+                                                  (int*)nullptr),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    // (all the arguments are host pointers)
+    host_strided_batch_vector<T>   hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T>   hARes(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T>   hB(size_B, 1, size_B, 1);
+    host_strided_batch_vector<T>   hBRes(size_B, 1, size_B, 1);
+    host_strided_batch_vector<int> hInfo(1, 1, 1, 1);
+    host_strided_batch_vector<int> hInfoRes(1, 1, 1, 1);
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        potrf_ooc_getError<FORTRAN, T>(handle,
+                                       uplo,
+                                       n,
+                                       nrhs,
+                                       lda,
+                                       ldb,
+                                       budgetB,
+                                       hA,
+                                       hARes,
+                                       hB,
+                                       hBRes,
+                                       hInfo,
+                                       hInfoRes,
+                                       &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        potrf_ooc_getPerfData<FORTRAN, T>(handle,
+                                          uplo,
+                                          n,
+                                          nrhs,
+                                          lda,
+                                          ldb,
+                                          budgetB,
+                                          hA,
+                                          hARes,
+                                          hB,
+                                          hInfo,
+                                          &gpu_time_used,
+                                          &cpu_time_used,
+                                          hot_calls,
+                                          argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("uplo", "n", "nrhs", "lda", "ldb", "budget");
+            rocsolver_bench_output(uploC, n, nrhs, lda, ldb, budget);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
@@ -59,7 +59,7 @@ void syevd_heevd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_ENUM);
 
-#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+#if !defined(__HIP_PLATFORM_NVCC__)
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(FORTRAN,
                                                 handle,
@@ -188,8 +188,31 @@ void syevd_heevd_initData(const hipsolverHandle_t  handle,
                           const int                bc,
                           Th&                      hA,
                           std::vector<T>&          A,
-                          bool                     test = true)
+                          bool                     test        = true,
+                          bool                     device_init = false)
 {
+    if(device_init)
+    {
+        // generate the matrices on the GPU, with eigenvalues from 1 down to 0.1;
+        // the CPU gets a copy
+        hipsolver_seedrand();
+        device_init_spectrum<T>(handle, n, dA, lda, 10);
+        if(CPU)
+        {
+            CHECK_HIP_ERROR(hA.transfer_from(dA));
+
+            // make copy of original data to test vectors if required
+            if(test && evect == HIPSOLVER_EIG_MODE_VECTOR)
+            {
+                for(int b = 0; b < bc; ++b)
+                    for(int i = 0; i < n; i++)
+                        for(int j = 0; j < n; j++)
+                            A[b * lda * n + i + j * lda] = hA[b][i + j * lda];
+            }
+        }
+        return;
+    }
+
     if(CPU)
     {
         rocblas_init<T>(hA, true);
@@ -254,7 +277,8 @@ void syevd_heevd_getError(const hipsolverHandle_t   handle,
                           Sh&                       hDres,
                           Ih&                       hinfo,
                           Ih&                       hinfoRes,
-                          double*                   max_err)
+                          double*                   max_err,
+                          const bool                device_init)
 {
     constexpr bool COMPLEX = is_complex<T>;
     using S                = decltype(std::real(T{}));
@@ -272,13 +296,10 @@ void syevd_heevd_getError(const hipsolverHandle_t   handle,
     }
     int liwork = (evect == HIPSOLVER_EIG_MODE_NOVECTOR ? 1 : 3 + 5 * n);
 
-    std::vector<T>   work(ltwork);
-    std::vector<S>   hE(sizeE);
-    std::vector<int> iwork(liwork);
-    std::vector<T>   A(lda * n * bc);
+    std::vector<T> A(lda * n * bc);
 
     // input data initialization
-    syevd_heevd_initData<true, true, T>(handle, evect, n, dA, lda, bc, hA, A);
+    syevd_heevd_initData<true, true, T>(handle, evect, n, dA, lda, bc, hA, A, true, device_init);
 
     // execute computations
     // GPU lapack
@@ -303,20 +324,31 @@ void syevd_heevd_getError(const hipsolverHandle_t   handle,
         CHECK_HIP_ERROR(hAres.transfer_from(dA));
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
-        cblas_syevd_heevd<T>(evect,
-                             uplo,
-                             n,
-                             hA[b],
-                             lda,
-                             hD[b],
-                             work.data(),
-                             ltwork,
-                             hE.data(),
-                             sizeE,
-                             iwork.data(),
-                             liwork,
-                             hinfo[b]);
+    hipsolver_reference_cache cache("syevd_heevd", type2char<T>(), evect, uplo, n, lda, bc);
+    cache.input(hA);
+    cache.output(hA, hD, hinfo);
+    if(!cache.load())
+    {
+        cblas_batch(bc, [&](int b) {
+            std::vector<T>   work(ltwork);
+            std::vector<S>   hE(sizeE);
+            std::vector<int> iwork(liwork);
+            cblas_syevd_heevd<T>(evect,
+                                 uplo,
+                                 n,
+                                 hA[b],
+                                 lda,
+                                 hD[b],
+                                 work.data(),
+                                 ltwork,
+                                 hE.data(),
+                                 sizeE,
+                                 iwork.data(),
+                                 liwork,
+                                 hinfo[b]);
+        });
+        cache.store();
+    }
 
     // Check info for non-convergence
     *max_err = 0;
@@ -403,7 +435,8 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
                              double*                   gpu_time_used,
                              double*                   cpu_time_used,
                              const int                 hot_calls,
-                             const bool                perf)
+                             const bool                perf,
+                             const bool                device_init)
 {
     constexpr bool COMPLEX = is_complex<T>;
     using S                = decltype(std::real(T{}));
@@ -428,7 +461,7 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
 
     if(!perf)
     {
-        syevd_heevd_initData<true, false, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
+        syevd_heevd_initData<true, false, T>(handle, evect, n, dA, lda, bc, hA, A, 0, device_init);
 
         // cpu-lapack performance (only if not in perf mode)
         *cpu_time_used = get_time_us_no_sync();
@@ -449,12 +482,14 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
 
-    syevd_heevd_initData<true, false, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
+    // with device_init, the GPU regenerates the matrices itself before each call
+    if(!device_init)
+        syevd_heevd_initData<true, false, T>(handle, evect, n, dA, lda, bc, hA, A, 0, device_init);
 
     // cold calls
     for(int iter = 0; iter < 2; iter++)
     {
-        syevd_heevd_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
+        syevd_heevd_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0, device_init);
 
         CHECK_ROCBLAS_ERROR(hipsolver_syevd_heevd(FORTRAN,
                                                   handle,
@@ -479,7 +514,7 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
 
     for(int iter = 0; iter < hot_calls; iter++)
     {
-        syevd_heevd_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
+        syevd_heevd_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0, device_init);
 
         start = get_time_us_sync(stream);
         hipsolver_syevd_heevd(FORTRAN,
@@ -626,7 +661,8 @@ void testing_syevd_heevd(Arguments& argus)
         //                                      hDres,
         //                                      hinfo,
         //                                      hinfoRes,
-        //                                      &max_error);
+        //                                      &max_error,
+        //                                      argus.device_init);
         // }
 
         // // collect performance data
@@ -651,7 +687,8 @@ void testing_syevd_heevd(Arguments& argus)
         //                                         &gpu_time_used,
         //                                         &cpu_time_used,
         //                                         hot_calls,
-        //                                         argus.perf);
+        //                                         argus.perf,
+        //                                         argus.device_init);
         // }
     }
 
@@ -693,7 +730,8 @@ void testing_syevd_heevd(Arguments& argus)
                                              hDres,
                                              hinfo,
                                              hinfoRes,
-                                             &max_error);
+                                             &max_error,
+                                             argus.device_init);
         }
 
         // collect performance data
@@ -718,7 +756,8 @@ void testing_syevd_heevd(Arguments& argus)
                                                 &gpu_time_used,
                                                 &cpu_time_used,
                                                 hot_calls,
-                                                argus.perf);
+                                                argus.perf,
+                                                argus.device_init);
         }
     }
 
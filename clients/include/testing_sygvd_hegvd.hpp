@@ -6,7 +6,7 @@
 
 #include "clientcommon.hpp"
 
-template <bool FORTRAN, typename T, typename U>
+template <bool FORTRAN, bool STRIDED, typename T, typename U>
 void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                               const hipsolverEigType_t  itype,
                               const hipsolverEigMode_t  evect,
@@ -27,6 +27,7 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
 {
     // handle
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(FORTRAN,
+                                                STRIDED,
                                                 nullptr,
                                                 itype,
                                                 evect,
@@ -48,6 +49,7 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
 
     // values
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 hipsolverEigType_t(-1),
                                                 evect,
@@ -67,6 +69,7 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_ENUM);
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 itype,
                                                 hipsolverEigMode_t(-1),
@@ -86,6 +89,7 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_ENUM);
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 itype,
                                                 evect,
@@ -105,9 +109,10 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_ENUM);
 
-#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+#if !defined(__HIP_PLATFORM_NVCC__)
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 itype,
                                                 evect,
@@ -127,6 +132,7 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 itype,
                                                 evect,
@@ -146,6 +152,7 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 itype,
                                                 evect,
@@ -165,6 +172,7 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 itype,
                                                 evect,
@@ -267,6 +275,7 @@ void testing_sygvd_hegvd_bad_arg()
 
         int size_W;
         hipsolver_sygvd_hegvd_bufferSize(FORTRAN,
+                                         STRIDED,
                                          handle,
                                          itype,
                                          evect,
@@ -277,29 +286,30 @@ void testing_sygvd_hegvd_bad_arg()
                                          dB.data(),
                                          ldb,
                                          dD.data(),
-                                         &size_W);
+                                         &size_W,
+                                         bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        sygvd_hegvd_checkBadArgs<FORTRAN>(handle,
-                                          itype,
-                                          evect,
-                                          uplo,
-                                          n,
-                                          dA.data(),
-                                          lda,
-                                          stA,
-                                          dB.data(),
-                                          ldb,
-                                          stB,
-                                          dD.data(),
-                                          stD,
-                                          dWork.data(),
-                                          size_W,
-                                          dInfo.data(),
-                                          bc);
+        sygvd_hegvd_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                                   itype,
+                                                   evect,
+                                                   uplo,
+                                                   n,
+                                                   dA.data(),
+                                                   lda,
+                                                   stA,
+                                                   dB.data(),
+                                                   ldb,
+                                                   stB,
+                                                   dD.data(),
+                                                   stD,
+                                                   dWork.data(),
+                                                   size_W,
+                                                   dInfo.data(),
+                                                   bc);
     }
 }
 
@@ -378,6 +388,7 @@ void sygvd_hegvd_initData(const hipsolverHandle_t       handle,
 }
 
 template <bool FORTRAN,
+          bool STRIDED,
           typename T,
           typename Td,
           typename Ud,
@@ -428,9 +439,6 @@ void sygvd_hegvd_getError(const hipsolverHandle_t   handle,
     }
     int liwork = (evect == HIPSOLVER_EIG_MODE_NOVECTOR ? 1 : 3 + 5 * n);
 
-    std::vector<T>               work(ltwork);
-    std::vector<S>               rwork(lrwork);
-    std::vector<int>             iwork(liwork);
     host_strided_batch_vector<T> A(lda * n, 1, lda * n, bc);
     host_strided_batch_vector<T> B(ldb * n, 1, ldb * n, bc);
 
@@ -441,6 +449,7 @@ void sygvd_hegvd_getError(const hipsolverHandle_t   handle,
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_sygvd_hegvd(FORTRAN,
+                                              STRIDED,
                                               handle,
                                               itype,
                                               evect,
@@ -465,24 +474,34 @@ void sygvd_hegvd_getError(const hipsolverHandle_t   handle,
         CHECK_HIP_ERROR(hARes.transfer_from(dA));
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
+    hipsolver_reference_cache cache(
+        "sygvd_hegvd", type2char<T>(), itype, evect, uplo, n, lda, ldb, bc);
+    cache.input(hA, hB);
+    cache.output(hA, hB, hD, hInfo);
+    if(!cache.load())
     {
-        cblas_sygvd_hegvd(itype,
-                          evect,
-                          uplo,
-                          n,
-                          hA[b],
-                          lda,
-                          hB[b],
-                          ldb,
-                          hD[b],
-                          work.data(),
-                          ltwork,
-                          rwork.data(),
-                          lrwork,
-                          iwork.data(),
-                          liwork,
-                          hInfo[b]);
+        cblas_batch(bc, [&](int b) {
+            std::vector<T>   work(ltwork);
+            std::vector<S>   rwork(lrwork);
+            std::vector<int> iwork(liwork);
+            cblas_sygvd_hegvd(itype,
+                              evect,
+                              uplo,
+                              n,
+                              hA[b],
+                              lda,
+                              hB[b],
+                              ldb,
+                              hD[b],
+                              work.data(),
+                              ltwork,
+                              rwork.data(),
+                              lrwork,
+                              iwork.data(),
+                              liwork,
+                              hInfo[b]);
+        });
+        cache.store();
     }
 
     // (We expect the used input matrices to always converge. Testing
@@ -596,6 +615,7 @@ void sygvd_hegvd_getError(const hipsolverHandle_t   handle,
 }
 
 template <bool FORTRAN,
+          bool STRIDED,
           typename T,
           typename Td,
           typename Ud,
@@ -691,6 +711,7 @@ void sygvd_hegvd_getPerfData(const hipsolverHandle_t   handle,
             handle, itype, evect, n, dA, lda, stA, dB, ldb, stB, bc, hA, hB, A, B, false, singular);
 
         CHECK_ROCBLAS_ERROR(hipsolver_sygvd_hegvd(FORTRAN,
+                                                  STRIDED,
                                                   handle,
                                                   itype,
                                                   evect,
@@ -722,6 +743,7 @@ void sygvd_hegvd_getPerfData(const hipsolverHandle_t   handle,
 
         start = get_time_us_sync(stream);
         hipsolver_sygvd_hegvd(FORTRAN,
+                              STRIDED,
                               handle,
                               itype,
                               evect,
@@ -808,6 +830,7 @@ void testing_sygvd_hegvd(Arguments& argus)
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(FORTRAN,
+                                                        STRIDED,
                                                         handle,
                                                         itype,
                                                         evect,
@@ -956,6 +979,7 @@ void testing_sygvd_hegvd(Arguments& argus)
 
         int size_W;
         hipsolver_sygvd_hegvd_bufferSize(FORTRAN,
+                                         STRIDED,
                                          handle,
                                          itype,
                                          evect,
@@ -966,68 +990,69 @@ void testing_sygvd_hegvd(Arguments& argus)
                                          dB.data(),
                                          ldb,
                                          dD.data(),
-                                         &size_W);
+                                         &size_W,
+                                         bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check computations
         if(argus.unit_check || argus.norm_check)
-            sygvd_hegvd_getError<FORTRAN, T>(handle,
-                                             itype,
-                                             evect,
-                                             uplo,
-                                             n,
-                                             dA,
-                                             lda,
-                                             stA,
-                                             dB,
-                                             ldb,
-                                             stB,
-                                             dD,
-                                             stD,
-                                             dWork,
-                                             size_W,
-                                             dInfo,
-                                             bc,
-                                             hA,
-                                             hARes,
-                                             hB,
-                                             hD,
-                                             hDRes,
-                                             hInfo,
-                                             hInfoRes,
-                                             &max_error,
-                                             argus.singular);
+            sygvd_hegvd_getError<FORTRAN, STRIDED, T>(handle,
+                                                      itype,
+                                                      evect,
+                                                      uplo,
+                                                      n,
+                                                      dA,
+                                                      lda,
+                                                      stA,
+                                                      dB,
+                                                      ldb,
+                                                      stB,
+                                                      dD,
+                                                      stD,
+                                                      dWork,
+                                                      size_W,
+                                                      dInfo,
+                                                      bc,
+                                                      hA,
+                                                      hARes,
+                                                      hB,
+                                                      hD,
+                                                      hDRes,
+                                                      hInfo,
+                                                      hInfoRes,
+                                                      &max_error,
+                                                      argus.singular);
 
         // collect performance data
         if(argus.timing)
-            sygvd_hegvd_getPerfData<FORTRAN, T>(handle,
-                                                itype,
-                                                evect,
-                                                uplo,
-                                                n,
-                                                dA,
-                                                lda,
-                                                stA,
-                                                dB,
-                                                ldb,
-                                                stB,
-                                                dD,
-                                                stD,
-                                                dWork,
-                                                size_W,
-                                                dInfo,
-                                                bc,
-                                                hA,
-                                                hB,
-                                                hD,
-                                                hInfo,
-                                                &gpu_time_used,
-                                                &cpu_time_used,
-                                                hot_calls,
-                                                argus.perf,
-                                                argus.singular);
+            sygvd_hegvd_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                         itype,
+                                                         evect,
+                                                         uplo,
+                                                         n,
+                                                         dA,
+                                                         lda,
+                                                         stA,
+                                                         dB,
+                                                         ldb,
+                                                         stB,
+                                                         dD,
+                                                         stD,
+                                                         dWork,
+                                                         size_W,
+                                                         dInfo,
+                                                         bc,
+                                                         hA,
+                                                         hB,
+                                                         hD,
+                                                         hInfo,
+                                                         &gpu_time_used,
+                                                         &cpu_time_used,
+                                                         hot_calls,
+                                                         argus.perf,
+                                                         argus.singular);
     }
 
     // validate results for rocsolver-test
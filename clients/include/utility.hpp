@@ -30,6 +30,9 @@
 
 #define CHECK_HIP_ERROR(error) ASSERT_EQ(error, hipSuccess)
 
+// info of a factorization of generated input data, which must succeed
+#define CHECK_INFO_ZERO(info) ASSERT_EQ(info, 0)
+
 inline void hipsolver_expect_status(hipsolverStatus_t status, hipsolverStatus_t expected)
 {
     if(status != HIPSOLVER_STATUS_NOT_SUPPORTED)
@@ -56,6 +59,21 @@ inline void hipsolver_expect_status(hipsolverStatus_t status, hipsolverStatus_t
         }                                         \
     } while(0)
 
+// info of a factorization of generated input data, which must succeed
+#define CHECK_INFO_ZERO(info)                                         \
+    do                                                                \
+    {                                                                 \
+        if(info != 0)                                                 \
+        {                                                             \
+            fprintf(stderr,                                           \
+                    "error: info of the input data is %d at %s:%d\n", \
+                    info,                                             \
+                    __FILE__,                                         \
+                    __LINE__);                                        \
+            exit(EXIT_FAILURE);                                       \
+        }                                                             \
+    } while(0)
+
 inline void hipsolver_expect_status(hipsolverStatus_t status, hipsolverStatus_t expected)
 {
     if(status != expected && status != HIPSOLVER_STATUS_NOT_SUPPORTED)
@@ -177,10 +195,15 @@ using real_t = typename real_t_impl<T>::type;
 using hipsolver_rng_t = std::mt19937;
 extern hipsolver_rng_t hipsolver_rng, hipsolver_seed;
 
+// Seed of the counter-based generator of rocblas_init, and the stream of its next fill
+extern uint64_t hipsolver_counter_seed;
+extern uint32_t hipsolver_counter_stream;
+
 // Reset the seed (mainly to ensure repeatability of failures in a given suite)
 inline void hipsolver_seedrand()
 {
-    hipsolver_rng = hipsolver_seed;
+    hipsolver_rng            = hipsolver_seed;
+    hipsolver_counter_stream = 0;
 }
 
 class hipsolver_nan_rng
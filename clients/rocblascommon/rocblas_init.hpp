@@ -8,11 +8,178 @@
 //#include "rocblas_ostream.hpp"
 // #include "rocblas_math.hpp"
 // #include "rocblas_random.hpp"
+#include "../include/lapack_host_reference.hpp"
 #include "../include/utility.hpp"
+#include <algorithm>
 #include <cinttypes>
 #include <iostream>
 #include <vector>
 
+/* ============================================================================================
+ */
+/*! \brief  counter-based random generation: */
+// The values of a fill are a function of (seed, batch, i, j) only, computed with the
+// Philox4x32-10 generator of Salmon et al., "Parallel random numbers: as easy as 1, 2, 3"
+// (SC11), with the counter (i, j, batch, stream) and the key hipsolver_counter_seed. Each
+// fill takes the next stream, and hipsolver_seedrand resets the streams, so the data of a
+// test does not depend on the tests that ran before it, nor on the order in which the
+// elements are filled; the fill of large arrays is spread over threads.
+
+// the generator is shared with the kernels of device_init.hpp
+#if defined(__HIPCC__)
+#define HIPSOLVER_HOST_DEVICE __host__ __device__
+#else
+#define HIPSOLVER_HOST_DEVICE
+#endif
+
+// number of counters computed together, so that the rounds vectorize
+#define HIPSOLVER_PHILOX_LANES 16
+
+// arrays of at least this many elements are filled on multiple threads
+#define HIPSOLVER_PHILOX_PARALLEL 65536
+
+/*! \brief  one round of Philox4x32 on the counter (c0, c1, c2, c3) with the key (k0, k1) */
+HIPSOLVER_HOST_DEVICE inline void hipsolver_philox_round(
+    uint32_t& c0, uint32_t& c1, uint32_t& c2, uint32_t& c3, uint32_t k0, uint32_t k1)
+{
+    uint64_t p0 = uint64_t(0xD2511F53) * c0;
+    uint64_t p1 = uint64_t(0xCD9E8D57) * c2;
+    c0          = uint32_t(p1 >> 32) ^ c1 ^ k0;
+    c2          = uint32_t(p0 >> 32) ^ c3 ^ k1;
+    c1          = uint32_t(p1);
+    c3          = uint32_t(p0);
+}
+
+/*! \brief  computes the first two words of Philox4x32-10 for the counter (i, j, batch, stream)
+ * into r0 and r1 */
+HIPSOLVER_HOST_DEVICE inline void hipsolver_philox(uint64_t  seed,
+                                                   uint32_t  i,
+                                                   uint32_t  j,
+                                                   uint32_t  batch,
+                                                   uint32_t  stream,
+                                                   uint32_t& r0,
+                                                   uint32_t& r1)
+{
+    uint32_t c0 = i, c1 = j, c2 = batch, c3 = stream;
+    uint32_t k0 = uint32_t(seed), k1 = uint32_t(seed >> 32);
+    for(int round = 0; round < 10; round++)
+    {
+        hipsolver_philox_round(c0, c1, c2, c3, k0, k1);
+        k0 += 0x9E3779B9;
+        k1 += 0xBB67AE85;
+    }
+    r0 = c0;
+    r1 = c1;
+}
+
+/*! \brief  as above, for the counters (i + l, j, batch, stream), l < HIPSOLVER_PHILOX_LANES,
+ * into r0[l] and r1[l] */
+inline void hipsolver_philox(uint64_t seed,
+                             uint32_t i,
+                             uint32_t j,
+                             uint32_t batch,
+                             uint32_t stream,
+                             uint32_t* r0,
+                             uint32_t* r1)
+{
+    constexpr int L = HIPSOLVER_PHILOX_LANES;
+    uint32_t      c0[L], c1[L], c2[L], c3[L];
+    for(int l = 0; l < L; l++)
+    {
+        c0[l] = i + l;
+        c1[l] = j;
+        c2[l] = batch;
+        c3[l] = stream;
+    }
+
+    uint32_t k0 = uint32_t(seed), k1 = uint32_t(seed >> 32);
+    for(int round = 0; round < 10; round++)
+    {
+        for(int l = 0; l < L; l++)
+            hipsolver_philox_round(c0[l], c1[l], c2[l], c3[l], k0, k1);
+        k0 += 0x9E3779B9;
+        k1 += 0xBB67AE85;
+    }
+
+    for(int l = 0; l < L; l++)
+    {
+        r0[l] = c0[l];
+        r1[l] = c1[l];
+    }
+}
+
+/*! \brief  maps random words to a value in range [1,2,3,4,5,6,7,8,9,10], as random_generator */
+HIPSOLVER_HOST_DEVICE inline int hipsolver_philox_value(uint32_t r)
+{
+    return int((uint64_t(r) * 10) >> 32) + 1;
+}
+
+template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+T hipsolver_philox_value(uint32_t r0, uint32_t r1)
+{
+    return T(hipsolver_philox_value(r0));
+}
+
+template <typename T, std::enable_if_t<is_complex<T>, int> = 0>
+T hipsolver_philox_value(uint32_t r0, uint32_t r1)
+{
+    using S = real_t<T>;
+    return T(S(hipsolver_philox_value(r0)), S(hipsolver_philox_value(r1)));
+}
+
+/*! \brief  fills the columns j0 to j1 - 1 of the M-by-N matrix of the given batch, with the
+ * element (i, j) at A[i * inc + j * lda] */
+template <typename T>
+void hipsolver_philox_fill(T*       A,
+                           size_t   M,
+                           size_t   j0,
+                           size_t   j1,
+                           size_t   inc,
+                           size_t   lda,
+                           uint32_t batch,
+                           uint32_t stream)
+{
+    constexpr int L = HIPSOLVER_PHILOX_LANES;
+    uint32_t      r0[L], r1[L];
+    for(size_t j = j0; j < j1; j++)
+    {
+        for(size_t i = 0; i < M; i += L)
+        {
+            hipsolver_philox(hipsolver_counter_seed, i, j, batch, stream, r0, r1);
+            size_t rows = std::min(M - i, size_t(L));
+            for(size_t l = 0; l < rows; l++)
+                A[(i + l) * inc + j * lda] = hipsolver_philox_value<T>(r0[l], r1[l]);
+        }
+    }
+}
+
+/*! \brief  fills the M-by-N matrices of a batch with the next stream of the counter-based
+ * generator; batch(b) returns the matrix b */
+template <typename T, typename F>
+void hipsolver_philox_init(F batch, size_t M, size_t N, size_t inc, size_t lda, size_t batch_count)
+{
+    uint32_t stream = hipsolver_counter_stream++;
+    if(M == 0 || N == 0 || batch_count == 0)
+        return;
+
+    // the tasks are groups of columns of about HIPSOLVER_PHILOX_PARALLEL elements
+    size_t cols  = std::max(size_t(1), std::min(N, HIPSOLVER_PHILOX_PARALLEL / M));
+    size_t tasks = (N - 1) / cols + 1;
+    auto   fill  = [&](int t) {
+        size_t b  = t / tasks;
+        size_t j0 = (t % tasks) * cols;
+        hipsolver_philox_fill(batch(b), M, j0, std::min(N, j0 + cols), inc, lda, b, stream);
+    };
+
+    if(M * N * batch_count < HIPSOLVER_PHILOX_PARALLEL)
+    {
+        for(size_t t = 0; t < tasks * batch_count; t++)
+            fill(t);
+    }
+    else
+        cblas_batch(tasks * batch_count, fill);
+}
+
 /* ============================================================================================
  */
 /*! \brief  matrix/vector initialization: */
@@ -22,24 +189,18 @@
 
 // Initialize vector with random values
 template <typename T>
-void rocblas_init(
-    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
+inline void
+    rocblas_init(T* A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
-    for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
-        for(size_t i = 0; i < M; ++i)
-            for(size_t j = 0; j < N; ++j)
-                A[i + j * lda + i_batch * stride] = random_generator<T>();
+    hipsolver_philox_init<T>([=](size_t b) { return A + b * stride; }, M, N, 1, lda, batch_count);
 }
 
 // Initialize vector with random values
 template <typename T>
-inline void
-    rocblas_init(T* A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
+void rocblas_init(
+    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
-    for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
-        for(size_t i = 0; i < M; ++i)
-            for(size_t j = 0; j < N; ++j)
-                A[i + j * lda + i_batch * stride] = random_generator<T>();
+    rocblas_init(A.data(), M, N, lda, stride, batch_count);
 }
 
 template <typename T>
@@ -41,26 +41,18 @@ void random_nan_generator(T& n)
 template <typename U>
 void rocblas_init_template(U& that, bool seedReset = false)
 {
+    using T = std::remove_reference_t<decltype(*that[0])>;
+
     if(seedReset)
     {
         hipsolver_seedrand();
     }
 
-    for(rocblas_int batch_index = 0; batch_index < that.batch_count(); ++batch_index)
-    {
-        auto batched_data = that[batch_index];
-        auto inc          = std::abs(that.inc());
-        auto n            = that.n();
-        if(inc < 0)
-        {
-            batched_data -= (n - 1) * inc;
-        }
-
-        for(rocblas_int i = 0; i < n; ++i)
-        {
-            random_generator(batched_data[i * inc]);
-        }
-    }
+    // each vector is filled as a column of the counter-based generator
+    auto inc = std::abs(that.inc());
+    auto n   = that.n();
+    hipsolver_philox_init<T>(
+        [&](size_t b) { return that[b]; }, n, 1, inc, n * inc, that.batch_count());
 }
 
 //!
@@ -128,7 +120,7 @@ void rocblas_init(host_vector<T>& that, bool seedReset = false)
     {
         hipsolver_seedrand();
     }
-    rocblas_init(that, 1, that.size(), 1);
+    rocblas_init(that, that.size(), 1, that.size());
 }
 
 //!
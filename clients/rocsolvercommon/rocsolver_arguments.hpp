@@ -27,6 +27,7 @@ public:
     rocblas_int timing      = 0;
     rocblas_int perf        = 0;
     rocblas_int singular    = 0;
+    rocblas_int device_init = 0;
     rocblas_int iters       = 5;
     rocblas_int batch_count = 1;
 
@@ -86,6 +87,7 @@ public:
         to_consume.erase("perf");
         to_consume.erase("singular");
         to_consume.erase("device");
+        to_consume.erase("device_init");
     }
 
     void clear()
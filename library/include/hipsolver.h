@@ -19,8 +19,28 @@
 #include <hip/hip_runtime_api.h>
 #include <stdint.h>
 
+/* The compact batch layout interleaves the matrices of a batch in groups of
+   HIPSOLVER_COMPACT_GROUP_BYTES / sizeof(element) matrices, with element (i,j) of
+   the matrices of a group stored contiguously. */
+#define HIPSOLVER_COMPACT_GROUP_BYTES 64
+
+// largest n of the functions on matrices in the compact batch layout
+#define HIPSOLVER_COMPACT_MAX_SIZE 16
+
 typedef void* hipsolverHandle_t;
 
+typedef void* hipsolverBatchQueue_t;
+
+typedef void* hipsolverBatchRequest_t;
+
+typedef void* hipsolverCompletion_t;
+
+typedef void* hipsolverMgHandle_t;
+
+typedef void* hipsolverMgGrid_t;
+
+typedef void* hipsolverMgMatrixDesc_t;
+
 typedef enum
 {
     HIPSOLVER_STATUS_SUCCESS           = 0, // Function succeeds
@@ -70,6 +90,64 @@ typedef enum
     HIPSOLVER_EIG_TYPE_3 = 213,
 } hipsolverEigType_t;
 
+typedef enum
+{
+    HIPSOLVER_CAPTURE_MODE_DEFAULT = 221, // workspace may be allocated inside calls
+    HIPSOLVER_CAPTURE_MODE_SAFE    = 222, // calls only use reserved workspace and never synchronize
+} hipsolverCaptureMode_t;
+
+typedef enum
+{
+    HIPSOLVER_ALLOC_MODE_DEFAULT        = 231, // workspace is device memory managed by rocBLAS
+    HIPSOLVER_ALLOC_MODE_STREAM_ORDERED = 232, // workspace is allocated on the handle's stream
+} hipsolverAllocMode_t;
+
+typedef enum
+{
+    HIPSOLVER_ERROR_MODE_DEFAULT  = 241, // devInfo is only written to the argument
+    HIPSOLVER_ERROR_MODE_DEFERRED = 242, // devInfo is also recorded in the handle's error state
+} hipsolverErrorMode_t;
+
+typedef enum
+{
+    HIPSOLVER_MG_GRID_MAPPING_ROW_MAJOR = 251,
+    HIPSOLVER_MG_GRID_MAPPING_COL_MAJOR = 252,
+} hipsolverMgGridMapping_t;
+
+typedef enum
+{
+    HIPSOLVER_HOST_AFFINITY_NONE   = 261, // threads are not pinned
+    HIPSOLVER_HOST_AFFINITY_CLOSE  = 262, // threads are pinned to consecutive CPUs
+    HIPSOLVER_HOST_AFFINITY_SPREAD = 263, // threads are spread evenly over the CPUs
+} hipsolverHostAffinity_t;
+
+typedef enum
+{
+    HIPSOLVER_DISPATCH_MODE_DEVICE = 271, // every call runs on the device
+    HIPSOLVER_DISPATCH_MODE_AUTO   = 272, // small problems in host memory run on the host
+} hipsolverDispatchMode_t;
+
+typedef enum
+{
+    HIPSOLVER_DISPATCH_POTRF = 281,
+    HIPSOLVER_DISPATCH_GETRF = 282,
+    HIPSOLVER_DISPATCH_GETRS = 283,
+} hipsolverDispatchRoutine_t;
+
+typedef enum
+{
+    HIPSOLVER_PRECISION_SINGLE         = 291,
+    HIPSOLVER_PRECISION_DOUBLE         = 292,
+    HIPSOLVER_PRECISION_SINGLE_COMPLEX = 293,
+    HIPSOLVER_PRECISION_DOUBLE_COMPLEX = 294,
+} hipsolverPrecision_t;
+
+// called on a host thread of the runtime with the info recorded in a completion
+typedef void (*hipsolverCompletionCallback_t)(hipsolverStatus_t status,
+                                              const int*        info,
+                                              int               count,
+                                              void*             userData);
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -84,6 +162,149 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetStream(hipsolverHandle_t handle,
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetStream(hipsolverHandle_t handle,
                                                       hipStream_t*      streamId);
 
+// stream capture
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetCaptureMode(hipsolverHandle_t      handle,
+                                                           hipsolverCaptureMode_t mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetCaptureMode(hipsolverHandle_t       handle,
+                                                           hipsolverCaptureMode_t* mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverReserveWorkspace(hipsolverHandle_t handle,
+                                                             size_t            size);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverStartCaptureQuery(hipsolverHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverStopCaptureQuery(hipsolverHandle_t handle,
+                                                             int*              capturable);
+
+// workspace allocation
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetAllocMode(hipsolverHandle_t    handle,
+                                                         hipsolverAllocMode_t mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetAllocMode(hipsolverHandle_t     handle,
+                                                         hipsolverAllocMode_t* mode);
+
+// tiled factorizations
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetTileExecution(hipsolverHandle_t handle,
+                                                             int               nstreams,
+                                                             int               lookahead);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetTileExecution(hipsolverHandle_t handle,
+                                                             int*              nstreams,
+                                                             int*              lookahead);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetTileBlockSize(hipsolverHandle_t handle, int nb);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetTileBlockSize(hipsolverHandle_t handle, int* nb);
+
+// host thread pool
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetHostThreadPool(hipsolverHandle_t       handle,
+                                                              int                     nthreads,
+                                                              hipsolverHostAffinity_t affinity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetHostThreadPool(hipsolverHandle_t        handle,
+                                                              int*                     nthreads,
+                                                              hipsolverHostAffinity_t* affinity);
+
+// host/device dispatch
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetDispatchMode(hipsolverHandle_t       handle,
+                                                            hipsolverDispatchMode_t mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetDispatchMode(hipsolverHandle_t        handle,
+                                                            hipsolverDispatchMode_t* mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSetDispatchThreshold(hipsolverHandle_t          handle,
+                                  hipsolverDispatchRoutine_t routine,
+                                  hipsolverPrecision_t       precision,
+                                  int                        n);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverGetDispatchThreshold(hipsolverHandle_t          handle,
+                                  hipsolverDispatchRoutine_t routine,
+                                  hipsolverPrecision_t       precision,
+                                  int*                       n);
+
+// tuning files
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverLoadTuningFile(hipsolverHandle_t handle,
+                                                           const char*       path);
+
+// batch queue
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCreateBatchQueue(hipsolverBatchQueue_t* queue,
+                                                             int                    maxBatch,
+                                                             int                    windowUs);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDestroyBatchQueue(hipsolverBatchQueue_t queue);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverBatchQueueFlush(hipsolverBatchQueue_t queue);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverBatchRequestQuery(hipsolverBatchRequest_t request,
+                                                              int*                    done);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverBatchRequestWait(hipsolverBatchRequest_t request,
+                                                             int*                    info);
+
+// completion
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCreateCompletion(hipsolverCompletion_t* completion);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDestroyCompletion(hipsolverCompletion_t completion);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSetCompletionCallback(hipsolverCompletion_t         completion,
+                                   hipsolverCompletionCallback_t callback,
+                                   void*                         userData);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverRecordCompletion(hipsolverHandle_t     handle,
+                                                             const int*            devInfo,
+                                                             int                   count,
+                                                             hipsolverCompletion_t completion);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverQueryCompletion(hipsolverCompletion_t completion,
+                                                            int*                  done,
+                                                            int*                  info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverWaitCompletion(hipsolverCompletion_t completion,
+                                                           int*                  info);
+
+// deferred errors
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetErrorMode(hipsolverHandle_t    handle,
+                                                         hipsolverErrorMode_t mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetErrorMode(hipsolverHandle_t     handle,
+                                                         hipsolverErrorMode_t* mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetErrorState(hipsolverHandle_t handle, int* state);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverResetErrorState(hipsolverHandle_t handle);
+
+// multi-device
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgCreate(hipsolverMgHandle_t* handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDestroy(hipsolverMgHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDeviceSelect(hipsolverMgHandle_t handle,
+                                                           int                 nbDevices,
+                                                           const int           deviceId[]);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverMgCreateDeviceGrid(hipsolverMgGrid_t*       grid,
+                                int                      numRowDevices,
+                                int                      numColDevices,
+                                const int                deviceId[],
+                                hipsolverMgGridMapping_t mapping);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDestroyGrid(hipsolverMgGrid_t grid);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverMgCreateMatrixDesc(hipsolverMgMatrixDesc_t* desc,
+                                int                      numRows,
+                                int                      numCols,
+                                int                      rowBlockSize,
+                                int                      colBlockSize,
+                                hipsolverMgGrid_t        grid);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDestroyMatrixDesc(hipsolverMgMatrixDesc_t desc);
+
 // orgbr/ungbr
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgbr_bufferSize(hipsolverHandle_t   handle,
                                                               hipsolverSideMode_t side,
@@ -541,6 +762,144 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZunmtr(hipsolverHandle_t    handle,
                                                    int                  lwork,
                                                    int*                 devInfo);
 
+// cholqr2
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverScholqr2_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, float* R, int ldr, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDcholqr2_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, double* R, int ldr, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCcholqr2_bufferSize(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                hipFloatComplex*  A,
+                                                                int               lda,
+                                                                hipFloatComplex*  R,
+                                                                int               ldr,
+                                                                int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZcholqr2_bufferSize(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                hipDoubleComplex* A,
+                                                                int               lda,
+                                                                hipDoubleComplex* R,
+                                                                int               ldr,
+                                                                int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverScholqr2(hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     float*            A,
+                                                     int               lda,
+                                                     float*            R,
+                                                     int               ldr,
+                                                     float*            work,
+                                                     int               lwork,
+                                                     int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDcholqr2(hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     double*           A,
+                                                     int               lda,
+                                                     double*           R,
+                                                     int               ldr,
+                                                     double*           work,
+                                                     int               lwork,
+                                                     int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCcholqr2(hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     hipFloatComplex*  A,
+                                                     int               lda,
+                                                     hipFloatComplex*  R,
+                                                     int               ldr,
+                                                     hipFloatComplex*  work,
+                                                     int               lwork,
+                                                     int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZcholqr2(hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     hipDoubleComplex* A,
+                                                     int               lda,
+                                                     hipDoubleComplex* R,
+                                                     int               ldr,
+                                                     hipDoubleComplex* work,
+                                                     int               lwork,
+                                                     int*              devInfo);
+
+// cholqr3
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverScholqr3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, float* R, int ldr, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDcholqr3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, double* R, int ldr, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCcholqr3_bufferSize(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                hipFloatComplex*  A,
+                                                                int               lda,
+                                                                hipFloatComplex*  R,
+                                                                int               ldr,
+                                                                int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZcholqr3_bufferSize(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                hipDoubleComplex* A,
+                                                                int               lda,
+                                                                hipDoubleComplex* R,
+                                                                int               ldr,
+                                                                int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverScholqr3(hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     float*            A,
+                                                     int               lda,
+                                                     float*            R,
+                                                     int               ldr,
+                                                     float*            work,
+                                                     int               lwork,
+                                                     int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDcholqr3(hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     double*           A,
+                                                     int               lda,
+                                                     double*           R,
+                                                     int               ldr,
+                                                     double*           work,
+                                                     int               lwork,
+                                                     int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCcholqr3(hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     hipFloatComplex*  A,
+                                                     int               lda,
+                                                     hipFloatComplex*  R,
+                                                     int               ldr,
+                                                     hipFloatComplex*  work,
+                                                     int               lwork,
+                                                     int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZcholqr3(hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     hipDoubleComplex* A,
+                                                     int               lda,
+                                                     hipDoubleComplex* R,
+                                                     int               ldr,
+                                                     hipDoubleComplex* work,
+                                                     int               lwork,
+                                                     int*              devInfo);
+
 // gebrd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgebrd_bufferSize(hipsolverHandle_t handle,
                                                               int               m,
@@ -614,6 +973,354 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgebrd(hipsolverHandle_t handle,
                                                    int               lwork,
                                                    int*              devInfo);
 
+// gels
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgels_bufferSize(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              float*            A,
+                                                              int               lda,
+                                                              float*            B,
+                                                              int               ldb,
+                                                              float*            X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDDgels_bufferSize(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              double*           A,
+                                                              int               lda,
+                                                              double*           B,
+                                                              int               ldb,
+                                                              double*           X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCCgels_bufferSize(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              hipFloatComplex*  A,
+                                                              int               lda,
+                                                              hipFloatComplex*  B,
+                                                              int               ldb,
+                                                              hipFloatComplex*  X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgels_bufferSize(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              hipDoubleComplex* A,
+                                                              int               lda,
+                                                              hipDoubleComplex* B,
+                                                              int               ldb,
+                                                              hipDoubleComplex* X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgels(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   float*            A,
+                                                   int               lda,
+                                                   float*            B,
+                                                   int               ldb,
+                                                   float*            X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDDgels(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           A,
+                                                   int               lda,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   double*           X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCCgels(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipFloatComplex*  A,
+                                                   int               lda,
+                                                   hipFloatComplex*  B,
+                                                   int               ldb,
+                                                   hipFloatComplex*  X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgels(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipDoubleComplex* A,
+                                                   int               lda,
+                                                   hipDoubleComplex* B,
+                                                   int               ldb,
+                                                   hipDoubleComplex* X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
+// gels_batched
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgelsBatched_bufferSize(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     int               nrhs,
+                                                                     float*            A[],
+                                                                     int               lda,
+                                                                     float*            B[],
+                                                                     int               ldb,
+                                                                     float*            X[],
+                                                                     int               ldx,
+                                                                     size_t*           lwork,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDDgelsBatched_bufferSize(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     int               nrhs,
+                                                                     double*           A[],
+                                                                     int               lda,
+                                                                     double*           B[],
+                                                                     int               ldb,
+                                                                     double*           X[],
+                                                                     int               ldx,
+                                                                     size_t*           lwork,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCCgelsBatched_bufferSize(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     int               nrhs,
+                                                                     hipFloatComplex*  A[],
+                                                                     int               lda,
+                                                                     hipFloatComplex*  B[],
+                                                                     int               ldb,
+                                                                     hipFloatComplex*  X[],
+                                                                     int               ldx,
+                                                                     size_t*           lwork,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgelsBatched_bufferSize(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     int               nrhs,
+                                                                     hipDoubleComplex* A[],
+                                                                     int               lda,
+                                                                     hipDoubleComplex* B[],
+                                                                     int               ldb,
+                                                                     hipDoubleComplex* X[],
+                                                                     int               ldx,
+                                                                     size_t*           lwork,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgelsBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          float*            A[],
+                                                          int               lda,
+                                                          float*            B[],
+                                                          int               ldb,
+                                                          float*            X[],
+                                                          int               ldx,
+                                                          void*             work,
+                                                          size_t            lwork,
+                                                          int*              niters,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDDgelsBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          double*           A[],
+                                                          int               lda,
+                                                          double*           B[],
+                                                          int               ldb,
+                                                          double*           X[],
+                                                          int               ldx,
+                                                          void*             work,
+                                                          size_t            lwork,
+                                                          int*              niters,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCCgelsBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          hipFloatComplex*  A[],
+                                                          int               lda,
+                                                          hipFloatComplex*  B[],
+                                                          int               ldb,
+                                                          hipFloatComplex*  X[],
+                                                          int               ldx,
+                                                          void*             work,
+                                                          size_t            lwork,
+                                                          int*              niters,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgelsBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          hipDoubleComplex* A[],
+                                                          int               lda,
+                                                          hipDoubleComplex* B[],
+                                                          int               ldb,
+                                                          hipDoubleComplex* X[],
+                                                          int               ldx,
+                                                          void*             work,
+                                                          size_t            lwork,
+                                                          int*              niters,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+// geqp3
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqp3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqp3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqp3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqp3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqp3(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   float*            A,
+                                                   int               lda,
+                                                   int*              jpvt,
+                                                   float*            tau,
+                                                   float*            work,
+                                                   int               lwork,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqp3(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   double*           A,
+                                                   int               lda,
+                                                   int*              jpvt,
+                                                   double*           tau,
+                                                   double*           work,
+                                                   int               lwork,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqp3(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   hipFloatComplex*  A,
+                                                   int               lda,
+                                                   int*              jpvt,
+                                                   hipFloatComplex*  tau,
+                                                   hipFloatComplex*  work,
+                                                   int               lwork,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqp3(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   hipDoubleComplex* A,
+                                                   int               lda,
+                                                   int*              jpvt,
+                                                   hipDoubleComplex* tau,
+                                                   hipDoubleComplex* work,
+                                                   int               lwork,
+                                                   int*              devInfo);
+
+// geqp3Truncated
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqp3Truncated_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqp3Truncated_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqp3Truncated_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqp3Truncated_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqp3Truncated(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            float*            A,
+                                                            int               lda,
+                                                            float             tol,
+                                                            int*              jpvt,
+                                                            float*            tau,
+                                                            int*              rank,
+                                                            float*            work,
+                                                            int               lwork,
+                                                            int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqp3Truncated(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            double*           A,
+                                                            int               lda,
+                                                            double            tol,
+                                                            int*              jpvt,
+                                                            double*           tau,
+                                                            int*              rank,
+                                                            double*           work,
+                                                            int               lwork,
+                                                            int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqp3Truncated(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            hipFloatComplex*  A,
+                                                            int               lda,
+                                                            float             tol,
+                                                            int*              jpvt,
+                                                            hipFloatComplex*  tau,
+                                                            int*              rank,
+                                                            hipFloatComplex*  work,
+                                                            int               lwork,
+                                                            int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqp3Truncated(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            hipDoubleComplex* A,
+                                                            int               lda,
+                                                            double            tol,
+                                                            int*              jpvt,
+                                                            hipDoubleComplex* tau,
+                                                            int*              rank,
+                                                            hipDoubleComplex* work,
+                                                            int               lwork,
+                                                            int*              devInfo);
+
 // geqrf
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrf_bufferSize(
     hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
@@ -667,6 +1374,59 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrf(hipsolverHandle_t handle,
                                                    int               lwork,
                                                    int*              devInfo);
 
+// geqrfTsqr
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrfTsqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqrfTsqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqrfTsqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrfTsqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrfTsqr(hipsolverHandle_t handle,
+                                                       int               m,
+                                                       int               n,
+                                                       float*            A,
+                                                       int               lda,
+                                                       float*            tau,
+                                                       float*            work,
+                                                       int               lwork,
+                                                       int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqrfTsqr(hipsolverHandle_t handle,
+                                                       int               m,
+                                                       int               n,
+                                                       double*           A,
+                                                       int               lda,
+                                                       double*           tau,
+                                                       double*           work,
+                                                       int               lwork,
+                                                       int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqrfTsqr(hipsolverHandle_t handle,
+                                                       int               m,
+                                                       int               n,
+                                                       hipFloatComplex*  A,
+                                                       int               lda,
+                                                       hipFloatComplex*  tau,
+                                                       hipFloatComplex*  work,
+                                                       int               lwork,
+                                                       int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrfTsqr(hipsolverHandle_t handle,
+                                                       int               m,
+                                                       int               n,
+                                                       hipDoubleComplex* A,
+                                                       int               lda,
+                                                       hipDoubleComplex* tau,
+                                                       hipDoubleComplex* work,
+                                                       int               lwork,
+                                                       int*              devInfo);
+
 // gesvd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvd_bufferSize(
     hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork);
@@ -898,6 +1658,613 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrs(hipsolverHandle_t    handle,
                                                    int                  lwork,
                                                    int*                 devInfo);
 
+// getrfHost
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfHost(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* ipiv, int* info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfHost(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* ipiv, int* info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfHost(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* ipiv, int* info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfHost(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* ipiv, int* info);
+
+// getrfBatchedHost
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfBatchedHost(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              float*            A[],
+                                                              int               lda,
+                                                              int*              ipiv,
+                                                              int               strideP,
+                                                              int*              info,
+                                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfBatchedHost(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              double*           A[],
+                                                              int               lda,
+                                                              int*              ipiv,
+                                                              int               strideP,
+                                                              int*              info,
+                                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfBatchedHost(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              hipFloatComplex*  A[],
+                                                              int               lda,
+                                                              int*              ipiv,
+                                                              int               strideP,
+                                                              int*              info,
+                                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfBatchedHost(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              hipDoubleComplex* A[],
+                                                              int               lda,
+                                                              int*              ipiv,
+                                                              int               strideP,
+                                                              int*              info,
+                                                              int               batch_count);
+
+// getrsHost
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrsHost(hipsolverHandle_t    handle,
+                                                       hipsolverOperation_t trans,
+                                                       int                  n,
+                                                       int                  nrhs,
+                                                       const float*         A,
+                                                       int                  lda,
+                                                       const int*           ipiv,
+                                                       float*               B,
+                                                       int                  ldb,
+                                                       int*                 info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrsHost(hipsolverHandle_t    handle,
+                                                       hipsolverOperation_t trans,
+                                                       int                  n,
+                                                       int                  nrhs,
+                                                       const double*        A,
+                                                       int                  lda,
+                                                       const int*           ipiv,
+                                                       double*              B,
+                                                       int                  ldb,
+                                                       int*                 info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrsHost(hipsolverHandle_t      handle,
+                                                       hipsolverOperation_t   trans,
+                                                       int                    n,
+                                                       int                    nrhs,
+                                                       const hipFloatComplex* A,
+                                                       int                    lda,
+                                                       const int*             ipiv,
+                                                       hipFloatComplex*       B,
+                                                       int                    ldb,
+                                                       int*                   info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrsHost(hipsolverHandle_t       handle,
+                                                       hipsolverOperation_t    trans,
+                                                       int                     n,
+                                                       int                     nrhs,
+                                                       const hipDoubleComplex* A,
+                                                       int                     lda,
+                                                       const int*              ipiv,
+                                                       hipDoubleComplex*       B,
+                                                       int                     ldb,
+                                                       int*                    info);
+
+// getrsBatchedHost
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrsBatchedHost(hipsolverHandle_t    handle,
+                                                              hipsolverOperation_t trans,
+                                                              int                  n,
+                                                              int                  nrhs,
+                                                              float*               A[],
+                                                              int                  lda,
+                                                              const int*           ipiv,
+                                                              int                  strideP,
+                                                              float*               B[],
+                                                              int                  ldb,
+                                                              int*                 info,
+                                                              int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrsBatchedHost(hipsolverHandle_t    handle,
+                                                              hipsolverOperation_t trans,
+                                                              int                  n,
+                                                              int                  nrhs,
+                                                              double*              A[],
+                                                              int                  lda,
+                                                              const int*           ipiv,
+                                                              int                  strideP,
+                                                              double*              B[],
+                                                              int                  ldb,
+                                                              int*                 info,
+                                                              int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrsBatchedHost(hipsolverHandle_t    handle,
+                                                              hipsolverOperation_t trans,
+                                                              int                  n,
+                                                              int                  nrhs,
+                                                              hipFloatComplex*     A[],
+                                                              int                  lda,
+                                                              const int*           ipiv,
+                                                              int                  strideP,
+                                                              hipFloatComplex*     B[],
+                                                              int                  ldb,
+                                                              int*                 info,
+                                                              int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrsBatchedHost(hipsolverHandle_t    handle,
+                                                              hipsolverOperation_t trans,
+                                                              int                  n,
+                                                              int                  nrhs,
+                                                              hipDoubleComplex*    A[],
+                                                              int                  lda,
+                                                              const int*           ipiv,
+                                                              int                  strideP,
+                                                              hipDoubleComplex*    B[],
+                                                              int                  ldb,
+                                                              int*                 info,
+                                                              int                  batch_count);
+
+// getrfCompact
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfCompact(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          float*            Ac,
+                                                          int*              devIpiv,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfCompact(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          double*           Ac,
+                                                          int*              devIpiv,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfCompact(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          hipFloatComplex*  Ac,
+                                                          int*              devIpiv,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfCompact(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          hipDoubleComplex* Ac,
+                                                          int*              devIpiv,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+// getrsCompact
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrsCompact(hipsolverHandle_t    handle,
+                                                          hipsolverOperation_t trans,
+                                                          int                  n,
+                                                          int                  nrhs,
+                                                          const float*         Ac,
+                                                          const int*           devIpiv,
+                                                          float*               Bc,
+                                                          int*                 devInfo,
+                                                          int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrsCompact(hipsolverHandle_t    handle,
+                                                          hipsolverOperation_t trans,
+                                                          int                  n,
+                                                          int                  nrhs,
+                                                          const double*        Ac,
+                                                          const int*           devIpiv,
+                                                          double*              Bc,
+                                                          int*                 devInfo,
+                                                          int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrsCompact(hipsolverHandle_t      handle,
+                                                          hipsolverOperation_t   trans,
+                                                          int                    n,
+                                                          int                    nrhs,
+                                                          const hipFloatComplex* Ac,
+                                                          const int*             devIpiv,
+                                                          hipFloatComplex*       Bc,
+                                                          int*                   devInfo,
+                                                          int                    batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrsCompact(hipsolverHandle_t       handle,
+                                                          hipsolverOperation_t    trans,
+                                                          int                     n,
+                                                          int                     nrhs,
+                                                          const hipDoubleComplex* Ac,
+                                                          const int*              devIpiv,
+                                                          hipDoubleComplex*       Bc,
+                                                          int*                    devInfo,
+                                                          int                     batch_count);
+
+// mgGetrf
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgSgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                                                int                     m,
+                                                                int                     n,
+                                                                float*                  A[],
+                                                                int                     ia,
+                                                                int                     ja,
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int*                    ipiv[],
+                                                                int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                                                int                     m,
+                                                                int                     n,
+                                                                double*                 A[],
+                                                                int                     ia,
+                                                                int                     ja,
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int*                    ipiv[],
+                                                                int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgCgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                                                int                     m,
+                                                                int                     n,
+                                                                hipFloatComplex*        A[],
+                                                                int                     ia,
+                                                                int                     ja,
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int*                    ipiv[],
+                                                                int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgZgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                                                int                     m,
+                                                                int                     n,
+                                                                hipDoubleComplex*       A[],
+                                                                int                     ia,
+                                                                int                     ja,
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int*                    ipiv[],
+                                                                int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgSgetrf(hipsolverMgHandle_t     handle,
+                                                     int                     m,
+                                                     int                     n,
+                                                     float*                  A[],
+                                                     int                     ia,
+                                                     int                     ja,
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     int*                    ipiv[],
+                                                     float*                  work[],
+                                                     int                     lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDgetrf(hipsolverMgHandle_t     handle,
+                                                     int                     m,
+                                                     int                     n,
+                                                     double*                 A[],
+                                                     int                     ia,
+                                                     int                     ja,
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     int*                    ipiv[],
+                                                     double*                 work[],
+                                                     int                     lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgCgetrf(hipsolverMgHandle_t     handle,
+                                                     int                     m,
+                                                     int                     n,
+                                                     hipFloatComplex*        A[],
+                                                     int                     ia,
+                                                     int                     ja,
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     int*                    ipiv[],
+                                                     hipFloatComplex*        work[],
+                                                     int                     lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgZgetrf(hipsolverMgHandle_t     handle,
+                                                     int                     m,
+                                                     int                     n,
+                                                     hipDoubleComplex*       A[],
+                                                     int                     ia,
+                                                     int                     ja,
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     int*                    ipiv[],
+                                                     hipDoubleComplex*       work[],
+                                                     int                     lwork,
+                                                     int*                    info);
+
+// mgPotrf
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgSpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverFillMode_t     uplo,
+                                                                int                     n,
+                                                                float*                  A[],
+                                                                int                     ia,
+                                                                int                     ja,
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverFillMode_t     uplo,
+                                                                int                     n,
+                                                                double*                 A[],
+                                                                int                     ia,
+                                                                int                     ja,
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgCpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverFillMode_t     uplo,
+                                                                int                     n,
+                                                                hipFloatComplex*        A[],
+                                                                int                     ia,
+                                                                int                     ja,
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgZpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverFillMode_t     uplo,
+                                                                int                     n,
+                                                                hipDoubleComplex*       A[],
+                                                                int                     ia,
+                                                                int                     ja,
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgSpotrf(hipsolverMgHandle_t     handle,
+                                                     hipsolverFillMode_t     uplo,
+                                                     int                     n,
+                                                     float*                  A[],
+                                                     int                     ia,
+                                                     int                     ja,
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     float*                  work[],
+                                                     int                     lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDpotrf(hipsolverMgHandle_t     handle,
+                                                     hipsolverFillMode_t     uplo,
+                                                     int                     n,
+                                                     double*                 A[],
+                                                     int                     ia,
+                                                     int                     ja,
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     double*                 work[],
+                                                     int                     lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgCpotrf(hipsolverMgHandle_t     handle,
+                                                     hipsolverFillMode_t     uplo,
+                                                     int                     n,
+                                                     hipFloatComplex*        A[],
+                                                     int                     ia,
+                                                     int                     ja,
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     hipFloatComplex*        work[],
+                                                     int                     lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgZpotrf(hipsolverMgHandle_t     handle,
+                                                     hipsolverFillMode_t     uplo,
+                                                     int                     n,
+                                                     hipDoubleComplex*       A[],
+                                                     int                     ia,
+                                                     int                     ja,
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     hipDoubleComplex*       work[],
+                                                     int                     lwork,
+                                                     int*                    info);
+
+// mgSyevd/mgHeevd
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgSsyevd_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverEigMode_t      jobz,
+                                                                hipsolverFillMode_t     uplo,
+                                                                int                     n,
+                                                                float*                  A[],
+                                                                int                     ia,
+                                                                int                     ja,
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                float*                  W,
+                                                                int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDsyevd_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverEigMode_t      jobz,
+                                                                hipsolverFillMode_t     uplo,
+                                                                int                     n,
+                                                                double*                 A[],
+                                                                int                     ia,
+                                                                int                     ja,
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                double*                 W,
+                                                                int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgCheevd_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverEigMode_t      jobz,
+                                                                hipsolverFillMode_t     uplo,
+                                                                int                     n,
+                                                                hipFloatComplex*        A[],
+                                                                int                     ia,
+                                                                int                     ja,
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                float*                  W,
+                                                                int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgZheevd_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverEigMode_t      jobz,
+                                                                hipsolverFillMode_t     uplo,
+                                                                int                     n,
+                                                                hipDoubleComplex*       A[],
+                                                                int                     ia,
+                                                                int                     ja,
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                double*                 W,
+                                                                int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgSsyevd(hipsolverMgHandle_t     handle,
+                                                     hipsolverEigMode_t      jobz,
+                                                     hipsolverFillMode_t     uplo,
+                                                     int                     n,
+                                                     float*                  A[],
+                                                     int                     ia,
+                                                     int                     ja,
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     float*                  W,
+                                                     float*                  work[],
+                                                     int                     lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDsyevd(hipsolverMgHandle_t     handle,
+                                                     hipsolverEigMode_t      jobz,
+                                                     hipsolverFillMode_t     uplo,
+                                                     int                     n,
+                                                     double*                 A[],
+                                                     int                     ia,
+                                                     int                     ja,
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     double*                 W,
+                                                     double*                 work[],
+                                                     int                     lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgCheevd(hipsolverMgHandle_t     handle,
+                                                     hipsolverEigMode_t      jobz,
+                                                     hipsolverFillMode_t     uplo,
+                                                     int                     n,
+                                                     hipFloatComplex*        A[],
+                                                     int                     ia,
+                                                     int                     ja,
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     float*                  W,
+                                                     hipFloatComplex*        work[],
+                                                     int                     lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgZheevd(hipsolverMgHandle_t     handle,
+                                                     hipsolverEigMode_t      jobz,
+                                                     hipsolverFillMode_t     uplo,
+                                                     int                     n,
+                                                     hipDoubleComplex*       A[],
+                                                     int                     ia,
+                                                     int                     ja,
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     double*                 W,
+                                                     hipDoubleComplex*       work[],
+                                                     int                     lwork,
+                                                     int*                    info);
+
+// packCompact/unpackCompact
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpackCompact(hipsolverHandle_t handle,
+                                                         int               m,
+                                                         int               n,
+                                                         const float*      A,
+                                                         int               lda,
+                                                         int               strideA,
+                                                         float*            Ac,
+                                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpackCompact(hipsolverHandle_t handle,
+                                                         int               m,
+                                                         int               n,
+                                                         const double*     A,
+                                                         int               lda,
+                                                         int               strideA,
+                                                         double*           Ac,
+                                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpackCompact(hipsolverHandle_t      handle,
+                                                         int                    m,
+                                                         int                    n,
+                                                         const hipFloatComplex* A,
+                                                         int                    lda,
+                                                         int                    strideA,
+                                                         hipFloatComplex*       Ac,
+                                                         int                    batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpackCompact(hipsolverHandle_t       handle,
+                                                         int                     m,
+                                                         int                     n,
+                                                         const hipDoubleComplex* A,
+                                                         int                     lda,
+                                                         int                     strideA,
+                                                         hipDoubleComplex*       Ac,
+                                                         int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSunpackCompact(hipsolverHandle_t handle,
+                                                           int               m,
+                                                           int               n,
+                                                           const float*      Ac,
+                                                           float*            A,
+                                                           int               lda,
+                                                           int               strideA,
+                                                           int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDunpackCompact(hipsolverHandle_t handle,
+                                                           int               m,
+                                                           int               n,
+                                                           const double*     Ac,
+                                                           double*           A,
+                                                           int               lda,
+                                                           int               strideA,
+                                                           int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCunpackCompact(hipsolverHandle_t      handle,
+                                                           int                    m,
+                                                           int                    n,
+                                                           const hipFloatComplex* Ac,
+                                                           hipFloatComplex*       A,
+                                                           int                    lda,
+                                                           int                    strideA,
+                                                           int                    batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZunpackCompact(hipsolverHandle_t       handle,
+                                                           int                     m,
+                                                           int                     n,
+                                                           const hipDoubleComplex* Ac,
+                                                           hipDoubleComplex*       A,
+                                                           int                     lda,
+                                                           int                     strideA,
+                                                           int                     batch_count);
+
+// posvSubmit
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposvSubmit(hipsolverBatchQueue_t    queue,
+                                                        hipsolverFillMode_t      uplo,
+                                                        int                      n,
+                                                        int                      nrhs,
+                                                        float*                   A,
+                                                        int                      lda,
+                                                        float*                   B,
+                                                        int                      ldb,
+                                                        hipStream_t              stream,
+                                                        hipsolverBatchRequest_t* request);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposvSubmit(hipsolverBatchQueue_t    queue,
+                                                        hipsolverFillMode_t      uplo,
+                                                        int                      n,
+                                                        int                      nrhs,
+                                                        double*                  A,
+                                                        int                      lda,
+                                                        double*                  B,
+                                                        int                      ldb,
+                                                        hipStream_t              stream,
+                                                        hipsolverBatchRequest_t* request);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposvSubmit(hipsolverBatchQueue_t    queue,
+                                                        hipsolverFillMode_t      uplo,
+                                                        int                      n,
+                                                        int                      nrhs,
+                                                        hipFloatComplex*         A,
+                                                        int                      lda,
+                                                        hipFloatComplex*         B,
+                                                        int                      ldb,
+                                                        hipStream_t              stream,
+                                                        hipsolverBatchRequest_t* request);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposvSubmit(hipsolverBatchQueue_t    queue,
+                                                        hipsolverFillMode_t      uplo,
+                                                        int                      n,
+                                                        int                      nrhs,
+                                                        hipDoubleComplex*        A,
+                                                        int                      lda,
+                                                        hipDoubleComplex*        B,
+                                                        int                      ldb,
+                                                        hipStream_t              stream,
+                                                        hipsolverBatchRequest_t* request);
+
 // potrf
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrf_bufferSize(
     hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork);
@@ -1028,6 +2395,113 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfBatched(hipsolverHandle_t   ha
                                                           int*                devInfo,
                                                           int                 batch_count);
 
+// potrfCompact
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfCompact(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              Ac,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfCompact(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             Ac,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfCompact(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipFloatComplex*    Ac,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfCompact(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipDoubleComplex*   Ac,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+// potrfOutOfCore
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfOutOfCore(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            float*              A,
+                                                            int                 lda,
+                                                            size_t              deviceBudget,
+                                                            int*                info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfOutOfCore(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            double*             A,
+                                                            int                 lda,
+                                                            size_t              deviceBudget,
+                                                            int*                info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfOutOfCore(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            hipFloatComplex*    A,
+                                                            int                 lda,
+                                                            size_t              deviceBudget,
+                                                            int*                info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfOutOfCore(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            hipDoubleComplex*   A,
+                                                            int                 lda,
+                                                            size_t              deviceBudget,
+                                                            int*                info);
+
+// potrsOutOfCore
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrsOutOfCore(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 nrhs,
+                                                            const float*        A,
+                                                            int                 lda,
+                                                            float*              B,
+                                                            int                 ldb,
+                                                            size_t              deviceBudget,
+                                                            int*                info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrsOutOfCore(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 nrhs,
+                                                            const double*       A,
+                                                            int                 lda,
+                                                            double*             B,
+                                                            int                 ldb,
+                                                            size_t              deviceBudget,
+                                                            int*                info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrsOutOfCore(hipsolverHandle_t      handle,
+                                                            hipsolverFillMode_t    uplo,
+                                                            int                    n,
+                                                            int                    nrhs,
+                                                            const hipFloatComplex* A,
+                                                            int                    lda,
+                                                            hipFloatComplex*       B,
+                                                            int                    ldb,
+                                                            size_t                 deviceBudget,
+                                                            int*                   info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrsOutOfCore(hipsolverHandle_t       handle,
+                                                            hipsolverFillMode_t     uplo,
+                                                            int                     n,
+                                                            int                     nrhs,
+                                                            const hipDoubleComplex* A,
+                                                            int                     lda,
+                                                            hipDoubleComplex*       B,
+                                                            int                     ldb,
+                                                            size_t                  deviceBudget,
+                                                            int*                    info);
+
 // syevd/heevd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevd_bufferSize(hipsolverHandle_t   handle,
                                                               hipsolverEigMode_t  jobz,
@@ -1214,6 +2688,124 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvd(hipsolverHandle_t   handle,
                                                    int                 lwork,
                                                    int*                devInfo);
 
+// sygvdPipelined/hegvdPipelined
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsygvdPipelined_bufferSize(hipsolverHandle_t   handle,
+                                        hipsolverEigType_t  itype,
+                                        hipsolverEigMode_t  jobz,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        float*              A,
+                                        int                 lda,
+                                        float*              B,
+                                        int                 ldb,
+                                        float*              D,
+                                        int*                lwork,
+                                        int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsygvdPipelined_bufferSize(hipsolverHandle_t   handle,
+                                        hipsolverEigType_t  itype,
+                                        hipsolverEigMode_t  jobz,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        double*             A,
+                                        int                 lda,
+                                        double*             B,
+                                        int                 ldb,
+                                        double*             D,
+                                        int*                lwork,
+                                        int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverChegvdPipelined_bufferSize(hipsolverHandle_t   handle,
+                                        hipsolverEigType_t  itype,
+                                        hipsolverEigMode_t  jobz,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        hipFloatComplex*    A,
+                                        int                 lda,
+                                        hipFloatComplex*    B,
+                                        int                 ldb,
+                                        float*              D,
+                                        int*                lwork,
+                                        int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhegvdPipelined_bufferSize(hipsolverHandle_t   handle,
+                                        hipsolverEigType_t  itype,
+                                        hipsolverEigMode_t  jobz,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        hipDoubleComplex*   A,
+                                        int                 lda,
+                                        hipDoubleComplex*   B,
+                                        int                 ldb,
+                                        double*             D,
+                                        int*                lwork,
+                                        int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvdPipelined(hipsolverHandle_t   handle,
+                                                            hipsolverEigType_t  itype,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            float*              A,
+                                                            int                 lda,
+                                                            float*              B,
+                                                            int                 ldb,
+                                                            float*              D,
+                                                            float*              work,
+                                                            int                 lwork,
+                                                            int*                devInfo,
+                                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvdPipelined(hipsolverHandle_t   handle,
+                                                            hipsolverEigType_t  itype,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            double*             A,
+                                                            int                 lda,
+                                                            double*             B,
+                                                            int                 ldb,
+                                                            double*             D,
+                                                            double*             work,
+                                                            int                 lwork,
+                                                            int*                devInfo,
+                                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvdPipelined(hipsolverHandle_t   handle,
+                                                            hipsolverEigType_t  itype,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            hipFloatComplex*    A,
+                                                            int                 lda,
+                                                            hipFloatComplex*    B,
+                                                            int                 ldb,
+                                                            float*              D,
+                                                            hipFloatComplex*    work,
+                                                            int                 lwork,
+                                                            int*                devInfo,
+                                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvdPipelined(hipsolverHandle_t   handle,
+                                                            hipsolverEigType_t  itype,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            hipDoubleComplex*   A,
+                                                            int                 lda,
+                                                            hipDoubleComplex*   B,
+                                                            int                 ldb,
+                                                            double*             D,
+                                                            hipDoubleComplex*   work,
+                                                            int                 lwork,
+                                                            int*                devInfo,
+                                                            int                 batch_count);
+
+
 // sytrd/hetrd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrd_bufferSize(hipsolverHandle_t   handle,
                                                               hipsolverFillMode_t uplo,
@@ -1303,6 +2895,156 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhetrd(hipsolverHandle_t   handle,
                                                    int                 lwork,
                                                    int*                devInfo);
 
+// sytrf
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrf_bufferSize(
+    hipsolverHandle_t handle, int n, float* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrf_bufferSize(
+    hipsolverHandle_t handle, int n, double* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrf_bufferSize(
+    hipsolverHandle_t handle, int n, hipFloatComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrf_bufferSize(
+    hipsolverHandle_t handle, int n, hipDoubleComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   int*                devIpiv,
+                                                   float*              work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   int*                devIpiv,
+                                                   double*             work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipFloatComplex*    A,
+                                                   int                 lda,
+                                                   int*                devIpiv,
+                                                   hipFloatComplex*    work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipDoubleComplex*   A,
+                                                   int                 lda,
+                                                   int*                devIpiv,
+                                                   hipDoubleComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+// sytrs
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              float*              A,
+                                                              int                 lda,
+                                                              int*                devIpiv,
+                                                              float*              B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              double*             A,
+                                                              int                 lda,
+                                                              int*                devIpiv,
+                                                              double*             B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              hipFloatComplex*    A,
+                                                              int                 lda,
+                                                              int*                devIpiv,
+                                                              hipFloatComplex*    B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              hipDoubleComplex*   A,
+                                                              int                 lda,
+                                                              int*                devIpiv,
+                                                              hipDoubleComplex*   B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   int*                devIpiv,
+                                                   float*              B,
+                                                   int                 ldb,
+                                                   float*              work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   int*                devIpiv,
+                                                   double*             B,
+                                                   int                 ldb,
+                                                   double*             work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipFloatComplex*    A,
+                                                   int                 lda,
+                                                   int*                devIpiv,
+                                                   hipFloatComplex*    B,
+                                                   int                 ldb,
+                                                   hipFloatComplex*    work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipDoubleComplex*   A,
+                                                   int                 lda,
+                                                   int*                devIpiv,
+                                                   hipDoubleComplex*   B,
+                                                   int                 ldb,
+                                                   hipDoubleComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
 #ifdef __cplusplus
 }
 #endif
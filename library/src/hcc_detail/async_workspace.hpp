@@ -0,0 +1,126 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas_templates.hpp"
+#include <hip/hip_runtime_api.h>
+
+/*
+ * ===========================================================================
+ *    With HIPSOLVER_ALLOC_MODE_STREAM_ORDERED, the workspace of the calls
+ *    made with work == nullptr is a buffer owned by the handle, allocated and
+ *    freed with hipMallocAsync and hipFreeAsync on the handle's stream, and
+ *    given to rocBLAS with rocblas_set_workspace. Growing it is therefore
+ *    ordered with the work on the stream, unlike the device memory managed by
+ *    rocBLAS, which is allocated with hipMalloc and synchronizes the device.
+ *    Stream-ordered allocation requires HIP 5.2 or later.
+ * ===========================================================================
+ */
+
+#if HIP_VERSION >= 50200000
+#define HIPSOLVER_HAVE_STREAM_ORDERED_ALLOC 1
+#endif
+
+class hipsolver_async_workspace
+{
+public:
+    hipsolver_async_workspace()                                 = default;
+    hipsolver_async_workspace(const hipsolver_async_workspace&) = delete;
+    hipsolver_async_workspace& operator=(const hipsolver_async_workspace&) = delete;
+
+    ~hipsolver_async_workspace()
+    {
+#ifdef HIPSOLVER_HAVE_STREAM_ORDERED_ALLOC
+        if(ptr_)
+            hipFreeAsync(ptr_, stream_);
+#endif
+        if(event_)
+            hipEventDestroy(event_);
+    }
+
+    void* data() const
+    {
+        return ptr_;
+    }
+    size_t size() const
+    {
+        return size_;
+    }
+
+    /* Moves the buffer to stream, on which it will be used from now on. Its
+       next uses are ordered after those already enqueued on the previous one. */
+    rocblas_status rebind(hipStream_t stream)
+    {
+        if(ptr_ && stream != stream_)
+        {
+            if(!event_)
+                HIP_RETURN_IF_ERROR(hipEventCreateWithFlags(&event_, hipEventDisableTiming));
+            HIP_RETURN_IF_ERROR(hipEventRecord(event_, stream_));
+            HIP_RETURN_IF_ERROR(hipStreamWaitEvent(stream, event_, 0));
+        }
+        stream_ = stream;
+        return rocblas_status_success;
+    }
+
+    // makes the buffer at least size bytes long, without synchronizing stream
+    rocblas_status reserve(hipStream_t stream, size_t size)
+    {
+        ROCBLAS_RETURN_IF_ERROR(rebind(stream));
+        if(size <= size_)
+            return rocblas_status_success;
+
+#ifdef HIPSOLVER_HAVE_STREAM_ORDERED_ALLOC
+        if(ptr_)
+        {
+            HIP_RETURN_IF_ERROR(hipFreeAsync(ptr_, stream_));
+            ptr_  = nullptr;
+            size_ = 0;
+        }
+        HIP_RETURN_IF_ERROR(hipMallocAsync(&ptr_, size, stream_));
+        size_ = size;
+        return rocblas_status_success;
+#else
+        return rocblas_status_not_implemented;
+#endif
+    }
+
+private:
+    void*       ptr_    = nullptr;
+    size_t      size_   = 0;
+    hipStream_t stream_ = nullptr; // stream on which the buffer is used
+    hipEvent_t  event_  = nullptr;
+};
+
+/* Returns the buffer of handle, creating it on first use, or nullptr if handle
+   does not use stream-ordered allocation. */
+inline std::shared_ptr<hipsolver_async_workspace>
+    hipsolver_get_async_workspace(rocblas_handle handle)
+{
+    std::shared_ptr<hipsolver_async_workspace> workspace;
+    hipsolver_update_settings(handle, [&](hipsolver_handle_settings& settings) {
+        if(settings.alloc_mode != HIPSOLVER_ALLOC_MODE_STREAM_ORDERED)
+            return;
+        if(!settings.async_workspace)
+            settings.async_workspace = std::make_shared<hipsolver_async_workspace>();
+        workspace = settings.async_workspace;
+    });
+    return workspace;
+}
+
+// whether the device of the calling thread supports stream-ordered allocation
+inline bool hipsolver_stream_ordered_alloc_supported()
+{
+#ifdef HIPSOLVER_HAVE_STREAM_ORDERED_ALLOC
+    int device, supported = 0;
+    if(hipGetDevice(&device) != hipSuccess
+       || hipDeviceGetAttribute(&supported, hipDeviceAttributeMemoryPoolsSupported, device)
+              != hipSuccess)
+        return false;
+    return supported != 0;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,303 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "batch_queue.hpp"
+#include "rocblas_templates.hpp"
+#include "rocsolver_templates.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    Device side of the batch queues created by hipsolverCreateBatchQueue.
+ *    Each queue computes its batches with a rocBLAS handle and a stream of its
+ *    own, on the device that was current when it was created: one
+ *    potrf_batched for all the requests of a batch, followed by one
+ *    potrs_batched for each group, with the same nrhs and ldb, of those whose
+ *    factorization succeeded; as with LAPACK posv, B is left untouched when
+ *    A is not positive definite, so the info of the factorizations is read
+ *    back before the solves. The batch waits for the events recorded on the
+ *    streams of the submissions, and is synchronized before its requests
+ *    complete.
+ * ===========================================================================
+ */
+
+class hipsolver_batch_device
+{
+public:
+    hipsolver_batch_device()                              = default;
+    hipsolver_batch_device(const hipsolver_batch_device&) = delete;
+    hipsolver_batch_device& operator=(const hipsolver_batch_device&) = delete;
+
+    ~hipsolver_batch_device()
+    {
+        if(stream_)
+            hipStreamSynchronize(stream_);
+        if(handle_)
+            rocblas_destroy_handle(handle_);
+        if(stream_)
+            hipStreamDestroy(stream_);
+        if(dev_ptrs_)
+            hipFree(dev_ptrs_);
+        if(dev_info_)
+            hipFree(dev_info_);
+        if(host_ptrs_)
+            hipHostFree(host_ptrs_);
+        if(host_info_)
+            hipHostFree(host_info_);
+        for(hipEvent_t event : events_)
+            hipEventDestroy(event);
+    }
+
+    // creates the stream, handle and buffers for batches of up to max_batch requests
+    rocblas_status init(int max_batch)
+    {
+        // the pointers to A of the factorizations, then those to A and B of the solves
+        size_t nptrs = 3 * size_t(max_batch);
+
+        HIP_RETURN_IF_ERROR(hipGetDevice(&device_));
+        HIP_RETURN_IF_ERROR(hipStreamCreateWithFlags(&stream_, hipStreamNonBlocking));
+        ROCBLAS_RETURN_IF_ERROR(rocblas_create_handle(&handle_));
+        ROCBLAS_RETURN_IF_ERROR(rocblas_set_stream(handle_, stream_));
+        HIP_RETURN_IF_ERROR(hipMalloc((void**)&dev_ptrs_, sizeof(void*) * nptrs));
+        HIP_RETURN_IF_ERROR(hipMalloc((void**)&dev_info_, sizeof(int) * max_batch));
+        HIP_RETURN_IF_ERROR(
+            hipHostMalloc((void**)&host_ptrs_, sizeof(void*) * nptrs, hipHostMallocDefault));
+        HIP_RETURN_IF_ERROR(
+            hipHostMalloc((void**)&host_info_, sizeof(int) * max_batch, hipHostMallocDefault));
+        max_batch_ = max_batch;
+        return rocblas_status_success;
+    }
+
+    // orders request after the work already enqueued on stream
+    rocblas_status record(hipsolver_batch_request* request, hipStream_t stream)
+    {
+        hipEvent_t event = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(events_mutex_);
+            if(!events_.empty())
+            {
+                event = events_.back();
+                events_.pop_back();
+            }
+        }
+        if(!event)
+            HIP_RETURN_IF_ERROR(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+
+        hipError_t status = hipEventRecord(event, stream);
+        if(status != hipSuccess)
+        {
+            release(event);
+            HIP_RETURN_IF_ERROR(status);
+        }
+        request->ready = event;
+        return rocblas_status_success;
+    }
+
+    // the dispatch function of the queue
+    rocblas_status operator()(const std::vector<hipsolver_batch_request*>& batch, int* info)
+    {
+        rocblas_status status = rocblas_status_success;
+        if(hipSetDevice(device_) != hipSuccess)
+            status = rocblas_status_internal_error;
+        else if(batch.size() > size_t(max_batch_))
+            status = rocblas_status_internal_error;
+        else
+        {
+            switch(batch[0]->precision)
+            {
+            case hipsolver_batch_float:
+                status = run<float>(batch);
+                break;
+            case hipsolver_batch_double:
+                status = run<double>(batch);
+                break;
+            case hipsolver_batch_float_complex:
+                status = run<rocblas_float_complex>(batch);
+                break;
+            case hipsolver_batch_double_complex:
+                status = run<rocblas_double_complex>(batch);
+                break;
+            }
+        }
+
+        // the buffers and events can be reused once the batch is done
+        if(hipStreamSynchronize(stream_) != hipSuccess && status == rocblas_status_success)
+            status = rocblas_status_internal_error;
+        for(hipsolver_batch_request* request : batch)
+        {
+            if(request->ready)
+                release(request->ready);
+            request->ready = nullptr;
+        }
+
+        if(status == rocblas_status_success)
+            std::copy(host_info_, host_info_ + batch.size(), info);
+        return status;
+    }
+
+private:
+    template <typename T>
+    rocblas_status run(const std::vector<hipsolver_batch_request*>& batch)
+    {
+        const hipsolver_batch_request& first = *batch[0];
+
+        int bc = batch.size();
+        for(int i = 0; i < bc; i++)
+        {
+            HIP_RETURN_IF_ERROR(hipStreamWaitEvent(stream_, batch[i]->ready, 0));
+            host_ptrs_[i] = batch[i]->A;
+        }
+
+        HIP_RETURN_IF_ERROR(hipMemcpyAsync(
+            dev_ptrs_, host_ptrs_, sizeof(void*) * bc, hipMemcpyHostToDevice, stream_));
+        ROCBLAS_RETURN_IF_ERROR(rocsolverCall_potrf_batched(
+            handle_, first.uplo, first.n, (T* const*)dev_ptrs_, first.lda, dev_info_, bc));
+        HIP_RETURN_IF_ERROR(hipMemcpyAsync(
+            host_info_, dev_info_, sizeof(int) * bc, hipMemcpyDeviceToHost, stream_));
+        HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream_));
+
+        // the solves are grouped by nrhs and ldb, as potrs_batched takes them once
+        std::vector<hipsolver_batch_request*> solves;
+        for(int i = 0; i < bc; i++)
+            if(batch[i]->nrhs > 0 && host_info_[i] == 0)
+                solves.push_back(batch[i]);
+        if(solves.empty())
+            return rocblas_status_success;
+
+        std::stable_sort(solves.begin(),
+                         solves.end(),
+                         [](const hipsolver_batch_request* a, const hipsolver_batch_request* b) {
+                             return a->nrhs < b->nrhs || (a->nrhs == b->nrhs && a->ldb < b->ldb);
+                         });
+        for(size_t k = 0; k < solves.size(); k++)
+        {
+            host_ptrs_[bc + k]     = solves[k]->A;
+            host_ptrs_[2 * bc + k] = solves[k]->B;
+        }
+
+        HIP_RETURN_IF_ERROR(hipMemcpyAsync(dev_ptrs_ + bc,
+                                           host_ptrs_ + bc,
+                                           sizeof(void*) * 2 * bc,
+                                           hipMemcpyHostToDevice,
+                                           stream_));
+
+        for(size_t k = 0, e; k < solves.size(); k = e)
+        {
+            for(e = k + 1; e < solves.size(); e++)
+                if(solves[e]->nrhs != solves[k]->nrhs || solves[e]->ldb != solves[k]->ldb)
+                    break;
+
+            ROCBLAS_RETURN_IF_ERROR(rocsolverCall_potrs_batched(handle_,
+                                                                first.uplo,
+                                                                first.n,
+                                                                solves[k]->nrhs,
+                                                                (T* const*)(dev_ptrs_ + bc + k),
+                                                                first.lda,
+                                                                (T* const*)(dev_ptrs_ + 2 * bc + k),
+                                                                solves[k]->ldb,
+                                                                int(e - k)));
+        }
+        return rocblas_status_success;
+    }
+
+    void release(hipEvent_t event)
+    {
+        std::lock_guard<std::mutex> lock(events_mutex_);
+        events_.push_back(event);
+    }
+
+    int            device_    = 0;
+    int            max_batch_ = 0;
+    hipStream_t    stream_    = nullptr;
+    rocblas_handle handle_    = nullptr;
+    void**         dev_ptrs_  = nullptr;
+    void**         host_ptrs_ = nullptr;
+    int*           dev_info_  = nullptr;
+    int*           host_info_ = nullptr;
+
+    // events of the submissions, reused across batches
+    std::mutex              events_mutex_;
+    std::vector<hipEvent_t> events_;
+};
+
+// the object behind a hipsolverBatchQueue_t; the queue is stopped before the device is released
+struct hipsolver_batch_context
+{
+    hipsolver_batch_device                 device;
+    std::unique_ptr<hipsolver_batch_queue> queue;
+};
+
+inline rocblas_status hipsolver_batch_queue_create(hipsolver_batch_context** context,
+                                                   int                       max_batch,
+                                                   int                       window_us)
+{
+    // argument checking
+    if(!context)
+        return rocblas_status_invalid_pointer;
+    if(max_batch < 1 || window_us < 0)
+        return rocblas_status_invalid_size;
+
+    std::unique_ptr<hipsolver_batch_context> ctx(new hipsolver_batch_context);
+    ROCBLAS_RETURN_IF_ERROR(ctx->device.init(max_batch));
+
+    hipsolver_batch_device* device = &ctx->device;
+    ctx->queue.reset(new hipsolver_batch_queue(
+        max_batch,
+        window_us,
+        [device](const std::vector<hipsolver_batch_request*>& batch, int* info) {
+            return (*device)(batch, info);
+        }));
+
+    *context = ctx.release();
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_posv_submit(hipsolver_batch_context*  context,
+                                     rocblas_fill              uplo,
+                                     int                       n,
+                                     int                       nrhs,
+                                     T*                        A,
+                                     int                       lda,
+                                     T*                        B,
+                                     int                       ldb,
+                                     hipStream_t               stream,
+                                     hipsolver_batch_request** request)
+{
+    // argument checking
+    if(!context)
+        return rocblas_status_invalid_handle;
+    if(n < 0 || nrhs < 0 || lda < std::max(1, n) || (nrhs > 0 && ldb < std::max(1, n)))
+        return rocblas_status_invalid_size;
+    if(!request || (n > 0 && !A) || (n > 0 && nrhs > 0 && !B))
+        return rocblas_status_invalid_pointer;
+
+    std::unique_ptr<hipsolver_batch_request> req(new hipsolver_batch_request);
+    req->precision = hipsolver_batch_precision_of<T>();
+    req->uplo      = uplo;
+    req->n         = n;
+    req->nrhs      = nrhs;
+    req->A         = A;
+    req->lda       = lda;
+    req->B         = B;
+    req->ldb       = ldb;
+
+    // quick return
+    if(n == 0)
+        req->complete(rocblas_status_success, 0);
+    else
+    {
+        ROCBLAS_RETURN_IF_ERROR(context->device.record(req.get(), stream));
+        context->queue->submit(req.get());
+    }
+
+    *request = req.release();
+    return rocblas_status_success;
+}
@@ -0,0 +1,244 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <hip/hip_runtime_api.h>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    Request-coalescing queue of the batch queue functions. Requests are
+ *    submitted from any thread and gathered by a dispatcher thread into
+ *    batches of compatible requests (same precision, uplo, n and lda), which
+ *    are handed to the dispatch function as soon as max_batch of them are
+ *    pending, or once the oldest one has waited for the window. Each request
+ *    then completes with its own info, like a future. The dispatch function
+ *    is given at construction so that the queue can be tested on the host;
+ *    the device one is in batch_device.hpp.
+ * ===========================================================================
+ */
+
+enum hipsolver_batch_precision
+{
+    hipsolver_batch_float,
+    hipsolver_batch_double,
+    hipsolver_batch_float_complex,
+    hipsolver_batch_double_complex,
+};
+
+template <typename T>
+constexpr hipsolver_batch_precision hipsolver_batch_precision_of();
+
+template <>
+constexpr hipsolver_batch_precision hipsolver_batch_precision_of<float>()
+{
+    return hipsolver_batch_float;
+}
+
+template <>
+constexpr hipsolver_batch_precision hipsolver_batch_precision_of<double>()
+{
+    return hipsolver_batch_double;
+}
+
+template <>
+constexpr hipsolver_batch_precision hipsolver_batch_precision_of<rocblas_float_complex>()
+{
+    return hipsolver_batch_float_complex;
+}
+
+template <>
+constexpr hipsolver_batch_precision hipsolver_batch_precision_of<rocblas_double_complex>()
+{
+    return hipsolver_batch_double_complex;
+}
+
+// a Cholesky factorization of A followed by the solution of nrhs systems in B
+struct hipsolver_batch_request
+{
+    hipsolver_batch_precision precision;
+    rocblas_fill              uplo;
+    int                       n;
+    int                       nrhs;
+    void*                     A;
+    int                       lda;
+    void*                     B;
+    int                       ldb;
+
+    // recorded on the stream of the submission, if any
+    hipEvent_t ready = nullptr;
+
+    std::chrono::steady_clock::time_point submitted;
+
+    // marks the request as done and wakes up its waiter
+    void complete(rocblas_status status, int info)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        status_ = status;
+        info_   = info;
+        done_   = true;
+        done_cv_.notify_all();
+    }
+
+    bool query()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return done_;
+    }
+
+    rocblas_status wait(int* info)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this] { return done_; });
+        *info = info_;
+        return status_;
+    }
+
+private:
+    std::mutex              mutex_;
+    std::condition_variable done_cv_;
+    bool                    done_   = false;
+    rocblas_status          status_ = rocblas_status_success;
+    int                     info_   = 0;
+};
+
+class hipsolver_batch_queue
+{
+public:
+    /* Computes the requests of a batch, all compatible, and writes the info of
+       each of them; the requests complete with the returned status. */
+    using dispatcher
+        = std::function<rocblas_status(const std::vector<hipsolver_batch_request*>&, int*)>;
+
+    hipsolver_batch_queue(int max_batch, int window_us, dispatcher dispatch)
+        : max_batch_(max_batch)
+        , window_(window_us)
+        , dispatch_(std::move(dispatch))
+    {
+        thread_ = std::thread([this] { run(); });
+    }
+
+    hipsolver_batch_queue(const hipsolver_batch_queue&) = delete;
+    hipsolver_batch_queue& operator=(const hipsolver_batch_queue&) = delete;
+
+    // dispatches the pending requests before returning
+    ~hipsolver_batch_queue()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        work_cv_.notify_one();
+        thread_.join();
+    }
+
+    void submit(hipsolver_batch_request* request)
+    {
+        request->submitted = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_[key(*request)].push_back(request);
+        }
+        work_cv_.notify_one();
+    }
+
+    // dispatches the requests pending now without waiting for their window
+    void flush()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            flushed_ = std::chrono::steady_clock::now();
+        }
+        work_cv_.notify_one();
+    }
+
+private:
+    using group_key = std::tuple<int, int, int, int>;
+    using group     = std::vector<hipsolver_batch_request*>;
+
+    static group_key key(const hipsolver_batch_request& request)
+    {
+        return group_key(request.precision, request.uplo, request.n, request.lda);
+    }
+
+    /* Takes the next batch out of the pending requests, or returns the time
+       at which one will be due if there is none yet. */
+    group next(std::chrono::steady_clock::time_point* due)
+    {
+        auto now = std::chrono::steady_clock::now();
+        *due     = std::chrono::steady_clock::time_point::max();
+
+        for(auto it = pending_.begin(); it != pending_.end(); ++it)
+        {
+            group& requests = it->second;
+
+            // requests are kept in the order of submission
+            auto oldest    = requests.front()->submitted;
+            auto group_due = oldest + window_;
+            if(requests.size() < size_t(max_batch_) && group_due > now && oldest > flushed_
+               && !stop_)
+            {
+                *due = std::min(*due, group_due);
+                continue;
+            }
+
+            size_t count = std::min(requests.size(), size_t(max_batch_));
+            group  batch(requests.begin(), requests.begin() + count);
+            requests.erase(requests.begin(), requests.begin() + count);
+            if(requests.empty())
+                pending_.erase(it);
+            return batch;
+        }
+        return {};
+    }
+
+    void run()
+    {
+        std::vector<int>             info;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while(true)
+        {
+            std::chrono::steady_clock::time_point due;
+            group                                 batch = next(&due);
+
+            if(!batch.empty())
+            {
+                // new requests keep arriving while the batch is computed
+                lock.unlock();
+                info.assign(batch.size(), 0);
+                rocblas_status status = dispatch_(batch, info.data());
+                for(size_t i = 0; i < batch.size(); i++)
+                    batch[i]->complete(status, info[i]);
+                lock.lock();
+            }
+            else if(stop_)
+                return;
+            else if(due == std::chrono::steady_clock::time_point::max())
+                work_cv_.wait(lock);
+            else
+                work_cv_.wait_until(lock, due);
+        }
+    }
+
+    int                       max_batch_;
+    std::chrono::microseconds window_;
+    dispatcher                dispatch_;
+
+    std::mutex                            mutex_;
+    std::condition_variable               work_cv_;
+    std::map<group_key, group>            pending_;
+    std::chrono::steady_clock::time_point flushed_; // time of the last flush
+    bool                                  stop_ = false;
+    std::thread                           thread_;
+};
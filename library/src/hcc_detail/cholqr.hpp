@@ -0,0 +1,230 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_templates.hpp"
+#include "rocsolver_templates.hpp"
+#include <cmath>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    cholqr2 and cholqr3 compute an explicit QR factorization A = Q * R of a
+ *    tall m-by-n matrix (m >= n) with the Cholesky QR algorithm: each pass
+ *    forms the Gram matrix G = A' * A, factorizes it as G = U' * U with potrf,
+ *    and orthogonalizes A <- A * U^-1 with trsm. cholqr2 performs two passes
+ *    (CholeskyQR2); cholqr3 adds the shifted pass of Fukaya et al. (shifted
+ *    CholeskyQR3) in front of them, which extends the range of condition
+ *    numbers that can be handled from about u^-1/2 to about u^-1.
+ * ===========================================================================
+ */
+
+// size in bytes of the workspace that cholqr needs on top of the rocBLAS device memory
+template <typename T>
+size_t hipsolver_cholqr_worksize(int n)
+{
+    if(n <= 0)
+        return 0;
+
+    return sizeof(T) * n * n + sizeof(int);
+}
+
+inline rocblas_status hipsolver_cholqr_argCheck(
+    rocblas_handle handle, int m, int n, int lda, int ldr, const void* A, const void* R, int* info)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(m < 0 || n < 0 || m < n || lda < m || ldr < n)
+        return rocblas_status_invalid_size;
+    if((m && n && !A) || (n && !R) || !info)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status hipsolver_cholqr_bufferSize_template(
+    rocblas_handle handle, int m, int n, int lda, int ldr, size_t* size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(m < 0 || n < 0 || m < n || lda < m || ldr < n)
+        return rocblas_status_invalid_size;
+
+    size_t internal_size;
+    T      one = 1;
+
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_status status
+        = rocsolverCall_potrf(handle, rocblas_fill_upper, n, (T*)nullptr, n, (int*)nullptr);
+    if(status == rocblas_status_success || status == rocblas_status_size_unchanged
+       || status == rocblas_status_size_increased)
+        status = rocblasCall_trsm(handle,
+                                  rocblas_side_right,
+                                  rocblas_fill_upper,
+                                  rocblas_operation_none,
+                                  rocblas_diagonal_non_unit,
+                                  m,
+                                  n,
+                                  &one,
+                                  (T*)nullptr,
+                                  n,
+                                  (T*)nullptr,
+                                  lda);
+    rocblas_stop_device_memory_size_query(handle, &internal_size);
+
+    if(status != rocblas_status_success && status != rocblas_status_size_unchanged
+       && status != rocblas_status_size_increased)
+        return status;
+
+    *size = hipsolver_cholqr_worksize<T>(n) + internal_size;
+    return rocblas_status_success;
+}
+
+/* Overwrites A with Q and writes R into the upper triangular part of R; the
+   strictly lower triangular part of R is set to zero. info reports the
+   Cholesky factorization of the first unshifted pass. work must point to at
+   least hipsolver_cholqr_worksize<T>(n) bytes of device memory. */
+template <typename T>
+rocblas_status hipsolver_cholqr_template(rocblas_handle handle,
+                                         const bool     shifted,
+                                         int            m,
+                                         int            n,
+                                         T*             A,
+                                         int            lda,
+                                         T*             R,
+                                         int            ldr,
+                                         int*           info,
+                                         void*          work)
+{
+    rocblas_status st = hipsolver_cholqr_argCheck(handle, m, n, lda, ldr, A, R, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    hipStream_t stream;
+    ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle, &stream));
+
+    // quick return
+    if(n == 0)
+    {
+        HIP_RETURN_IF_ERROR(hipMemsetAsync(info, 0, sizeof(int), stream));
+        return rocblas_status_success;
+    }
+
+    using S = decltype(std::abs(T(0)));
+
+    T    one   = 1;
+    T    zero  = 0;
+    T*   G     = (T*)work;
+    int* iinfo = (int*)(G + size_t(n) * n);
+
+    std::vector<T> hdiag(shifted ? n : 0);
+    int            passes = shifted ? 3 : 2;
+    for(int k = 0; k < passes; k++)
+    {
+        bool shift_pass = shifted && k == 0;
+
+        // G = A' * A
+        ROCBLAS_RETURN_IF_ERROR(rocblasCall_gemm(handle,
+                                                 rocblas_operation_conjugate_transpose,
+                                                 rocblas_operation_none,
+                                                 n,
+                                                 n,
+                                                 m,
+                                                 &one,
+                                                 A,
+                                                 lda,
+                                                 A,
+                                                 lda,
+                                                 &zero,
+                                                 G,
+                                                 n));
+
+        if(shift_pass)
+        {
+            // G = G + s * I with s = 11 * (m * n + n * (n + 1)) * u * ||A||_F^2, which
+            // bounds the shift proposed for ||A||_2^2 from above
+            HIP_RETURN_IF_ERROR(hipMemcpy2DAsync(hdiag.data(),
+                                                 sizeof(T),
+                                                 G,
+                                                 sizeof(T) * (n + 1),
+                                                 sizeof(T),
+                                                 n,
+                                                 hipMemcpyDeviceToHost,
+                                                 stream));
+            HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream));
+
+            S trace = 0;
+            for(int i = 0; i < n; i++)
+                trace += std::abs(hdiag[i]);
+
+            S shift = 11 * (S(m) * n + S(n) * (n + 1)) * std::numeric_limits<S>::epsilon() * trace;
+            for(int i = 0; i < n; i++)
+                hdiag[i] += T(shift);
+
+            HIP_RETURN_IF_ERROR(hipMemcpy2DAsync(G,
+                                                 sizeof(T) * (n + 1),
+                                                 hdiag.data(),
+                                                 sizeof(T),
+                                                 sizeof(T),
+                                                 n,
+                                                 hipMemcpyHostToDevice,
+                                                 stream));
+        }
+
+        // G = U' * U; only the first unshifted pass reports its result in info
+        int* pass_info = (k == (shifted ? 1 : 0)) ? info : iinfo;
+        ROCBLAS_RETURN_IF_ERROR(
+            rocsolverCall_potrf(handle, rocblas_fill_upper, n, G, n, pass_info));
+
+        // A = A * U^-1
+        ROCBLAS_RETURN_IF_ERROR(rocblasCall_trsm(handle,
+                                                 rocblas_side_right,
+                                                 rocblas_fill_upper,
+                                                 rocblas_operation_none,
+                                                 rocblas_diagonal_non_unit,
+                                                 m,
+                                                 n,
+                                                 &one,
+                                                 G,
+                                                 n,
+                                                 A,
+                                                 lda));
+
+        // R = U_k * ... * U_1
+        if(k == 0)
+        {
+            HIP_RETURN_IF_ERROR(
+                hipMemset2DAsync(R, sizeof(T) * ldr, 0, sizeof(T) * n, n, stream));
+            for(int j = 0; j < n; j++)
+                HIP_RETURN_IF_ERROR(hipMemcpyAsync(R + size_t(j) * ldr,
+                                                   G + size_t(j) * n,
+                                                   sizeof(T) * (j + 1),
+                                                   hipMemcpyDeviceToDevice,
+                                                   stream));
+        }
+        else
+            ROCBLAS_RETURN_IF_ERROR(rocblasCall_trmm(handle,
+                                                     rocblas_side_left,
+                                                     rocblas_fill_upper,
+                                                     rocblas_operation_none,
+                                                     rocblas_diagonal_non_unit,
+                                                     n,
+                                                     n,
+                                                     &one,
+                                                     G,
+                                                     n,
+                                                     R,
+                                                     ldr));
+    }
+
+    // hdiag must outlive the copy made from it
+    if(shifted)
+        HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream));
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,314 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_templates.hpp"
+#include "rocsolver_templates.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+/*
+ * ===========================================================================
+ *    Compact batch layout. The matrices of a batch are interleaved in groups
+ *    of W = HIPSOLVER_COMPACT_GROUP_BYTES / sizeof(T) matrices: matrix b is
+ *    lane b % W of group b / W, and element (i,j) of an m-by-n matrix is at
+ *    Ac[((b / W) * m * n + i + j * m) * W + b % W]. The last group is padded
+ *    with zeros. hipSOLVER has no device kernels of its own, so the layout is
+ *    converted with one strided-batched rocBLAS copy per element (i,j), each
+ *    moving that element of every matrix of the batch, and potrf, getrf and
+ *    getrs unpack the groups into device memory of the handle, call the
+ *    strided-batched functions of rocSOLVER, and pack the results back.
+ * ===========================================================================
+ */
+
+// number of matrices in a group of the compact layout
+template <typename T>
+constexpr int hipsolver_compact_width()
+{
+    return HIPSOLVER_COMPACT_GROUP_BYTES / sizeof(T);
+}
+
+/******************** PACK/UNPACK ********************/
+inline rocblas_status hipsolver_pack_compact_argCheck(rocblas_handle handle,
+                                                      int            m,
+                                                      int            n,
+                                                      int            lda,
+                                                      const void*    A,
+                                                      const void*    Ac,
+                                                      int            batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(m < 0 || n < 0 || lda < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(m && n && batch_count && (!A || !Ac))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_success;
+}
+
+/* Packs the batch_count m-by-n matrices A, with leading dimension lda and
+   stride strideA, into Ac (PACK), or unpacks them from Ac (!PACK). */
+template <bool PACK, typename T>
+rocblas_status hipsolver_compact_copy(rocblas_handle handle,
+                                      int            m,
+                                      int            n,
+                                      T*             A,
+                                      int            lda,
+                                      rocblas_stride strideA,
+                                      T*             Ac,
+                                      int            batch_count)
+{
+    constexpr int  W       = hipsolver_compact_width<T>();
+    int            full    = batch_count / W;
+    int            rem     = batch_count % W;
+    rocblas_stride strideG = rocblas_stride(m) * n * W;
+
+    // quick return
+    if(m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    if(PACK && rem)
+    {
+        hipStream_t stream;
+        ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle, &stream));
+        HIP_RETURN_IF_ERROR(hipMemsetAsync(Ac + full * strideG, 0, sizeof(T) * strideG, stream));
+    }
+
+    for(int j = 0; j < n; j++)
+    {
+        for(int i = 0; i < m; i++)
+        {
+            T* a = A + i + rocblas_stride(j) * lda;
+            T* c = Ac + (i + rocblas_stride(j) * m) * W;
+
+            // the full groups, then the last one
+            int count[2] = {W, rem};
+            int batch[2] = {full, 1};
+            int first[2] = {0, full};
+            for(int k = 0; k < 2; k++)
+            {
+                if(count[k] == 0 || batch[k] == 0)
+                    continue;
+
+                T* ak = a + first[k] * W * strideA;
+                T* ck = c + first[k] * strideG;
+                if(PACK)
+                    ROCBLAS_RETURN_IF_ERROR(rocblasCall_copy_strided_batched(
+                        handle, count[k], ak, strideA, W * strideA, ck, 1, strideG, batch[k]));
+                else
+                    ROCBLAS_RETURN_IF_ERROR(rocblasCall_copy_strided_batched(
+                        handle, count[k], ck, 1, strideG, ak, strideA, W * strideA, batch[k]));
+            }
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_pack_compact_template(rocblas_handle handle,
+                                               int            m,
+                                               int            n,
+                                               const T*       A,
+                                               int            lda,
+                                               int            strideA,
+                                               T*             Ac,
+                                               int            batch_count)
+{
+    ROCBLAS_RETURN_IF_ERROR(
+        hipsolver_pack_compact_argCheck(handle, m, n, lda, A, Ac, batch_count));
+
+    return hipsolver_compact_copy<true>(handle, m, n, (T*)A, lda, strideA, Ac, batch_count);
+}
+
+template <typename T>
+rocblas_status hipsolver_unpack_compact_template(rocblas_handle handle,
+                                                 int            m,
+                                                 int            n,
+                                                 const T*       Ac,
+                                                 T*             A,
+                                                 int            lda,
+                                                 int            strideA,
+                                                 int            batch_count)
+{
+    ROCBLAS_RETURN_IF_ERROR(
+        hipsolver_pack_compact_argCheck(handle, m, n, lda, A, Ac, batch_count));
+
+    return hipsolver_compact_copy<false>(handle, m, n, A, lda, strideA, (T*)Ac, batch_count);
+}
+
+/******************** POTRF/GETRF/GETRS_COMPACT ********************/
+inline rocblas_status
+    hipsolver_compact_argCheck(rocblas_handle handle, int n, int nrhs, int batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(n < 0 || n > HIPSOLVER_COMPACT_MAX_SIZE || nrhs < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    return rocblas_status_success;
+}
+
+/* Returns in size_work the device memory needed for the matrices in standard
+   layout, i.e. for A and, for getrs, B, and in size the total including the
+   memory required by rocSOLVER. routine is 'P' for potrf, 'F' for getrf and
+   'S' for getrs. */
+template <typename T>
+rocblas_status hipsolver_compact_size(rocblas_handle handle,
+                                      char           routine,
+                                      int            n,
+                                      int            nrhs,
+                                      int            batch_count,
+                                      size_t*        size_work,
+                                      size_t*        size)
+{
+    *size_work = 0;
+    *size      = 0;
+
+    // quick return
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    rocblas_stride nn = rocblas_stride(n) * n;
+    rocblas_stride nb = rocblas_stride(n) * nrhs;
+
+    size_t internal;
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_status status;
+    if(routine == 'P')
+        status = rocsolverCall_potrf_strided_batched(
+            handle, rocblas_fill_upper, n, (T*)nullptr, n, nn, (int*)nullptr, batch_count);
+    else if(routine == 'F')
+        status = rocsolverCall_getrf_strided_batched(
+            handle, n, n, (T*)nullptr, n, nn, (int*)nullptr, n, (int*)nullptr, batch_count);
+    else
+        status = rocsolverCall_getrs_strided_batched(handle,
+                                                     rocblas_operation_none,
+                                                     n,
+                                                     nrhs,
+                                                     (T*)nullptr,
+                                                     n,
+                                                     nn,
+                                                     (int*)nullptr,
+                                                     n,
+                                                     (T*)nullptr,
+                                                     n,
+                                                     nb,
+                                                     batch_count);
+    rocblas_stop_device_memory_size_query(handle, &internal);
+    ROCBLAS_QUERY_RETURN_IF_ERROR(status);
+
+    *size_work = sizeof(T) * (nn + nb) * batch_count;
+    *size      = *size_work + internal;
+    return rocblas_status_success;
+}
+
+/* The device memory work must hold at least size_work bytes, as returned by
+   hipsolver_compact_size. */
+template <typename T>
+rocblas_status hipsolver_potrf_compact_template(rocblas_handle handle,
+                                                rocblas_fill   uplo,
+                                                int            n,
+                                                T*             Ac,
+                                                int*           info,
+                                                int            batch_count,
+                                                void*          work)
+{
+    ROCBLAS_RETURN_IF_ERROR(hipsolver_compact_argCheck(handle, n, 0, batch_count));
+    if((n && batch_count && !Ac) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+    if(n == 0)
+    {
+        hipStream_t stream;
+        ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle, &stream));
+        HIP_RETURN_IF_ERROR(hipMemsetAsync(info, 0, sizeof(int) * batch_count, stream));
+        return rocblas_status_success;
+    }
+
+    T*             A  = (T*)work;
+    rocblas_stride nn = rocblas_stride(n) * n;
+
+    ROCBLAS_RETURN_IF_ERROR(hipsolver_compact_copy<false>(handle, n, n, A, n, nn, Ac, batch_count));
+    ROCBLAS_RETURN_IF_ERROR(
+        rocsolverCall_potrf_strided_batched(handle, uplo, n, A, n, nn, info, batch_count));
+    return hipsolver_compact_copy<true>(handle, n, n, A, n, nn, Ac, batch_count);
+}
+
+template <typename T>
+rocblas_status hipsolver_getrf_compact_template(rocblas_handle handle,
+                                                int            n,
+                                                T*             Ac,
+                                                int*           ipiv,
+                                                int*           info,
+                                                int            batch_count,
+                                                void*          work)
+{
+    ROCBLAS_RETURN_IF_ERROR(hipsolver_compact_argCheck(handle, n, 0, batch_count));
+    if((n && batch_count && (!Ac || !ipiv)) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+    if(n == 0)
+    {
+        hipStream_t stream;
+        ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle, &stream));
+        HIP_RETURN_IF_ERROR(hipMemsetAsync(info, 0, sizeof(int) * batch_count, stream));
+        return rocblas_status_success;
+    }
+
+    T*             A  = (T*)work;
+    rocblas_stride nn = rocblas_stride(n) * n;
+
+    ROCBLAS_RETURN_IF_ERROR(hipsolver_compact_copy<false>(handle, n, n, A, n, nn, Ac, batch_count));
+    ROCBLAS_RETURN_IF_ERROR(rocsolverCall_getrf_strided_batched(
+        handle, n, n, A, n, nn, ipiv, n, info, batch_count));
+    return hipsolver_compact_copy<true>(handle, n, n, A, n, nn, Ac, batch_count);
+}
+
+// as for getrs, info only reports argument errors and is set to zero
+template <typename T>
+rocblas_status hipsolver_getrs_compact_template(rocblas_handle    handle,
+                                                rocblas_operation trans,
+                                                int               n,
+                                                int               nrhs,
+                                                const T*          Ac,
+                                                const int*        ipiv,
+                                                T*                Bc,
+                                                int*              info,
+                                                int               batch_count,
+                                                void*             work)
+{
+    ROCBLAS_RETURN_IF_ERROR(hipsolver_compact_argCheck(handle, n, nrhs, batch_count));
+    if((n && batch_count && (!Ac || !ipiv)) || (n && nrhs && batch_count && !Bc) || !info)
+        return rocblas_status_invalid_pointer;
+
+    hipStream_t stream;
+    ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle, &stream));
+    HIP_RETURN_IF_ERROR(hipMemsetAsync(info, 0, sizeof(int), stream));
+
+    // quick return
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    rocblas_stride nn = rocblas_stride(n) * n;
+    rocblas_stride nb = rocblas_stride(n) * nrhs;
+    T*             A  = (T*)work;
+    T*             B  = A + nn * batch_count;
+
+    ROCBLAS_RETURN_IF_ERROR(
+        hipsolver_compact_copy<false>(handle, n, n, A, n, nn, (T*)Ac, batch_count));
+    ROCBLAS_RETURN_IF_ERROR(
+        hipsolver_compact_copy<false>(handle, n, nrhs, B, n, nb, Bc, batch_count));
+    ROCBLAS_RETURN_IF_ERROR(rocsolverCall_getrs_strided_batched(
+        handle, trans, n, nrhs, A, n, nn, ipiv, n, B, n, nb, batch_count));
+    return hipsolver_compact_copy<true>(handle, n, nrhs, B, n, nb, Bc, batch_count);
+}
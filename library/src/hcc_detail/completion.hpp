@@ -0,0 +1,146 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "rocblas_templates.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <memory>
+
+/*
+ * ===========================================================================
+ *    Completion objects of hipsolverRecordCompletion. Recording a completion
+ *    enqueues, on the handle's stream, a copy of devInfo to a pinned buffer
+ *    of the completion, the host callback if one is registered, and an event.
+ *    The event completes after the callback has returned, so a completion is
+ *    only reported as done once its callback has seen the info.
+ * ===========================================================================
+ */
+
+class hipsolver_completion
+{
+public:
+    hipsolver_completion()                            = default;
+    hipsolver_completion(const hipsolver_completion&) = delete;
+    hipsolver_completion& operator=(const hipsolver_completion&) = delete;
+
+    ~hipsolver_completion()
+    {
+        if(event_)
+        {
+            hipEventSynchronize(event_);
+            hipEventDestroy(event_);
+        }
+        if(info_)
+            hipHostFree(info_);
+    }
+
+    // used by the recordings made from now on
+    void set_callback(hipsolverCompletionCallback_t callback, void* user_data)
+    {
+        callback_  = callback;
+        user_data_ = user_data;
+    }
+    bool has_callback() const
+    {
+        return callback_ != nullptr;
+    }
+
+    // enqueues the copy of the count values of dinfo and the completion on stream
+    rocblas_status record(hipStream_t stream, const int* dinfo, int count)
+    {
+        if(!event_)
+            HIP_RETURN_IF_ERROR(hipEventCreateWithFlags(&event_, hipEventDisableTiming));
+
+        // the buffer is only reallocated once the previous recording is done
+        if(count > capacity_)
+        {
+            HIP_RETURN_IF_ERROR(hipEventSynchronize(event_));
+            if(info_)
+                HIP_RETURN_IF_ERROR(hipHostFree(info_));
+            info_     = nullptr;
+            capacity_ = 0;
+            HIP_RETURN_IF_ERROR(
+                hipHostMalloc((void**)&info_, sizeof(int) * count, hipHostMallocDefault));
+            capacity_ = count;
+        }
+
+        // the previous recording, maybe on another stream, is done with the buffer first
+        if(recorded_)
+            HIP_RETURN_IF_ERROR(hipStreamWaitEvent(stream, event_, 0));
+
+        count_ = count;
+        if(count > 0)
+            HIP_RETURN_IF_ERROR(hipMemcpyAsync(
+                info_, dinfo, sizeof(int) * count, hipMemcpyDeviceToHost, stream));
+        if(callback_)
+        {
+            std::unique_ptr<call> c(new call{callback_, user_data_, info_, count});
+            HIP_RETURN_IF_ERROR(hipStreamAddCallback(stream, run_callback, c.get(), 0));
+            c.release();
+        }
+        HIP_RETURN_IF_ERROR(hipEventRecord(event_, stream));
+        recorded_ = true;
+        return rocblas_status_success;
+    }
+
+    // sets done, and copies the info to info (if not null) once done
+    rocblas_status query(bool* done, int* info)
+    {
+        *done = true;
+        if(recorded_)
+        {
+            hipError_t status = hipEventQuery(event_);
+            if(status == hipErrorNotReady)
+            {
+                *done = false;
+                return rocblas_status_success;
+            }
+            HIP_RETURN_IF_ERROR(status);
+        }
+        if(info)
+            std::copy(info_, info_ + count_, info);
+        return rocblas_status_success;
+    }
+
+    rocblas_status wait(int* info)
+    {
+        if(recorded_)
+            HIP_RETURN_IF_ERROR(hipEventSynchronize(event_));
+        if(info)
+            std::copy(info_, info_ + count_, info);
+        return rocblas_status_success;
+    }
+
+private:
+    // the callback of one recording
+    struct call
+    {
+        hipsolverCompletionCallback_t callback;
+        void*                         user_data;
+        const int*                    info;
+        int                           count;
+    };
+
+    static void run_callback(hipStream_t stream, hipError_t status, void* data)
+    {
+        std::unique_ptr<call> c((call*)data);
+        c->callback(status == hipSuccess ? HIPSOLVER_STATUS_SUCCESS
+                                         : HIPSOLVER_STATUS_EXECUTION_FAILED,
+                    c->info,
+                    c->count,
+                    c->user_data);
+    }
+
+    hipsolverCompletionCallback_t callback_  = nullptr;
+    void*                         user_data_ = nullptr;
+
+    hipEvent_t event_    = nullptr;
+    int*       info_     = nullptr;
+    int        capacity_ = 0;
+    int        count_    = 0;
+    bool       recorded_ = false;
+};
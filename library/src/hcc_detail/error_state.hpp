@@ -0,0 +1,140 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas_templates.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+/*
+ * ===========================================================================
+ *    With HIPSOLVER_ERROR_MODE_DEFERRED, the functions that write devInfo
+ *    append it, on the handle's stream, to a log in device memory owned by
+ *    the handle. hipsolverGetErrorState copies the log back once and combines
+ *    its values with a bitwise OR into the sticky error word, so a sequence of
+ *    calls is checked with a single synchronization. hipSOLVER has no device
+ *    code of its own, so the OR is done on the host; when the log is full it
+ *    is folded into the word, which synchronizes the stream.
+ * ===========================================================================
+ */
+
+class hipsolver_error_state
+{
+public:
+    // number of info values kept in the log between two readbacks
+    static constexpr int capacity = 16384;
+
+    hipsolver_error_state()                             = default;
+    hipsolver_error_state(const hipsolver_error_state&) = delete;
+    hipsolver_error_state& operator=(const hipsolver_error_state&) = delete;
+
+    ~hipsolver_error_state()
+    {
+        // hipFree waits for the copies still pending
+        if(log_)
+            hipFree(log_);
+        if(host_log_)
+            hipHostFree(host_log_);
+        if(event_)
+            hipEventDestroy(event_);
+    }
+
+    rocblas_status init()
+    {
+        HIP_RETURN_IF_ERROR(hipMalloc((void**)&log_, sizeof(int) * capacity));
+        HIP_RETURN_IF_ERROR(
+            hipHostMalloc((void**)&host_log_, sizeof(int) * capacity, hipHostMallocDefault));
+        HIP_RETURN_IF_ERROR(hipEventCreateWithFlags(&event_, hipEventDisableTiming));
+        return rocblas_status_success;
+    }
+
+    // whether count values can be appended without folding the log
+    bool fits(int count) const
+    {
+        return count <= capacity - size_;
+    }
+
+    // appends the count values of dinfo once the work enqueued on stream is done
+    rocblas_status append(hipStream_t stream, const int* dinfo, int count)
+    {
+        ROCBLAS_RETURN_IF_ERROR(rebind(stream));
+        while(count > 0)
+        {
+            if(size_ == capacity)
+                ROCBLAS_RETURN_IF_ERROR(fold());
+
+            int n = std::min(count, capacity - size_);
+            HIP_RETURN_IF_ERROR(hipMemcpyAsync(
+                log_ + size_, dinfo, sizeof(int) * n, hipMemcpyDeviceToDevice, stream_));
+            size_ += n;
+            dinfo += n;
+            count -= n;
+        }
+        return rocblas_status_success;
+    }
+
+    // the OR of all the values appended since the last reset
+    rocblas_status get(int* word)
+    {
+        ROCBLAS_RETURN_IF_ERROR(fold());
+        *word = word_;
+        return rocblas_status_success;
+    }
+
+    // the values already enqueued are overwritten by the next ones, in stream order
+    void reset()
+    {
+        word_ = 0;
+        size_ = 0;
+    }
+
+private:
+    // orders the next copies after those enqueued on the previous stream
+    rocblas_status rebind(hipStream_t stream)
+    {
+        if(stream_set_ && stream != stream_)
+        {
+            HIP_RETURN_IF_ERROR(hipEventRecord(event_, stream_));
+            HIP_RETURN_IF_ERROR(hipStreamWaitEvent(stream, event_, 0));
+        }
+        stream_     = stream;
+        stream_set_ = true;
+        return rocblas_status_success;
+    }
+
+    // combines the log into the word with a single copy, and empties it
+    rocblas_status fold()
+    {
+        if(size_ == 0)
+            return rocblas_status_success;
+
+        HIP_RETURN_IF_ERROR(hipMemcpyAsync(
+            host_log_, log_, sizeof(int) * size_, hipMemcpyDeviceToHost, stream_));
+        HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream_));
+        for(int i = 0; i < size_; i++)
+            word_ |= host_log_[i];
+        size_ = 0;
+        return rocblas_status_success;
+    }
+
+    int*        log_        = nullptr;
+    int*        host_log_   = nullptr;
+    int         size_       = 0;
+    int         word_       = 0;
+    hipStream_t stream_     = nullptr; // stream of the last append
+    bool        stream_set_ = false;
+    hipEvent_t  event_      = nullptr;
+};
+
+/* Returns the error state of handle, or nullptr if handle does not use the
+   deferred error mode. */
+inline std::shared_ptr<hipsolver_error_state> hipsolver_get_error_state(rocblas_handle handle)
+{
+    return hipsolver_read_settings(handle, [](const hipsolver_handle_settings& settings) {
+        return settings.error_mode == HIPSOLVER_ERROR_MODE_DEFERRED ? settings.error_state
+                                                                    : nullptr;
+    });
+}
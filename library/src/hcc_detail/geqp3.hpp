@@ -0,0 +1,440 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_templates.hpp"
+#include "rocsolver_templates.hpp"
+#include <algorithm>
+#include <cmath>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    geqp3 computes the QR factorization with column pivoting A * P = Q * R
+ *    following the blocked algorithm of LAPACK (Quintana-Orti, Sun and
+ *    Bischof): within a panel of nb columns the trailing matrix is updated
+ *    lazily through the auxiliary matrix F, so that only one row of it has to
+ *    be brought up to date before the partial column norms can be downdated;
+ *    the rest of the trailing matrix is updated with a single gemm once the
+ *    panel is complete. The partial column norms and the pivot selection live
+ *    on the host. The truncated variant stops as soon as the largest partial
+ *    column norm falls below a tolerance relative to the largest column norm
+ *    of A, which leaves the numerical rank in rank and skips the remaining
+ *    work.
+ * ===========================================================================
+ */
+
+// number of columns of a panel
+constexpr int HIPSOLVER_GEQP3_BLOCKSIZE = 32;
+
+// size in bytes of the workspace that geqp3 needs on top of the rocBLAS device memory
+template <typename T>
+size_t hipsolver_geqp3_worksize(int n)
+{
+    if(n <= 0)
+        return 0;
+
+    // F and auxv
+    return sizeof(T) * (size_t(n) + 1) * HIPSOLVER_GEQP3_BLOCKSIZE;
+}
+
+template <typename S>
+rocblas_status hipsolver_geqp3_argCheck(rocblas_handle handle,
+                                        int            m,
+                                        int            n,
+                                        int            lda,
+                                        const bool     truncated,
+                                        S              tol,
+                                        const void*    A,
+                                        int*           jpvt,
+                                        const void*    tau,
+                                        int*           rank,
+                                        int*           info)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(m < 0 || n < 0 || lda < m)
+        return rocblas_status_invalid_size;
+    if(truncated && !(tol >= 0))
+        return rocblas_status_invalid_value;
+    if((m && n && !A) || (n && !jpvt) || (m && n && !tau) || (truncated && !rank) || !info)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status hipsolver_geqp3_bufferSize_template(
+    rocblas_handle handle, int m, int n, int lda, size_t* size)
+{
+    using S = decltype(std::abs(T(0)));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(m < 0 || n < 0 || lda < m)
+        return rocblas_status_invalid_size;
+
+    size_t internal_size;
+    int    nb  = HIPSOLVER_GEQP3_BLOCKSIZE;
+    T      one = 1;
+
+    // larfg, nrm2 and gemm may require device memory from rocBLAS
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_status status
+        = rocsolverCall_larfg(handle, m, (T*)nullptr, (T*)nullptr, 1, (T*)nullptr);
+    if(status == rocblas_status_success || status == rocblas_status_size_unchanged
+       || status == rocblas_status_size_increased)
+        status = rocblasCall_nrm2_strided_batched(
+            handle, m, (T*)nullptr, 1, lda, std::max(n, 1), (S*)nullptr);
+    if(status == rocblas_status_success || status == rocblas_status_size_unchanged
+       || status == rocblas_status_size_increased)
+        status = rocblasCall_gemm(handle,
+                                  rocblas_operation_none,
+                                  rocblas_operation_conjugate_transpose,
+                                  m,
+                                  n,
+                                  nb,
+                                  &one,
+                                  (T*)nullptr,
+                                  std::max(lda, 1),
+                                  (T*)nullptr,
+                                  std::max(n, 1),
+                                  &one,
+                                  (T*)nullptr,
+                                  std::max(lda, 1));
+    rocblas_stop_device_memory_size_query(handle, &internal_size);
+
+    if(status != rocblas_status_success && status != rocblas_status_size_unchanged
+       && status != rocblas_status_size_increased)
+        return status;
+
+    *size = hipsolver_geqp3_worksize<T>(n) + internal_size;
+    return rocblas_status_success;
+}
+
+/* Factorizes the panel of at most nb columns starting at column offset of A
+   (LAPACK's laqps). A0 points to column offset, and jp, vn1 and vn2 to the
+   corresponding entries of the host arrays. Returns the number of columns
+   factorized in kb; stop is set if the panel ended because the largest
+   partial column norm fell below thresh. */
+template <typename T, typename S>
+rocblas_status hipsolver_laqps(rocblas_handle  handle,
+                               hipStream_t     stream,
+                               int             m,
+                               int             nc,
+                               int             offset,
+                               int             nb,
+                               T*              A0,
+                               int             lda,
+                               T*              tau0,
+                               int*            jp,
+                               S*              vn1,
+                               S*              vn2,
+                               const bool      truncated,
+                               S               thresh,
+                               T*              F,
+                               T*              auxv,
+                               std::vector<T>& hrow,
+                               int*            kb,
+                               bool*           stop)
+{
+    T       one    = 1;
+    T       zero   = 0;
+    T       mone   = -1;
+    const S tol3z  = std::sqrt(std::numeric_limits<S>::epsilon());
+    int     ldf    = nc;
+    int     lastrk = std::min(m, nc + offset);
+
+    T                htau, akk;
+    std::vector<int> recompute;
+
+    int k = 0;
+    *stop = false;
+    while(k < nb && recompute.empty())
+    {
+        int rk  = offset + k;
+        int pvt = k + int(std::max_element(vn1 + k, vn1 + nc) - (vn1 + k));
+
+        if(truncated && vn1[pvt] <= thresh)
+        {
+            *stop = true;
+            break;
+        }
+
+        if(pvt != k)
+        {
+            ROCBLAS_RETURN_IF_ERROR(
+                rocblasCall_swap(handle, m, A0 + size_t(pvt) * lda, 1, A0 + size_t(k) * lda, 1));
+            if(k > 0)
+                ROCBLAS_RETURN_IF_ERROR(rocblasCall_swap(handle, k, F + pvt, ldf, F + k, ldf));
+            std::swap(jp[pvt], jp[k]);
+            vn1[pvt] = vn1[k];
+            vn2[pvt] = vn2[k];
+        }
+
+        T* akk_ptr = A0 + rk + size_t(k) * lda;
+
+        // A(rk:m, k) = A(rk:m, k) - A(rk:m, 0:k) * F(k, 0:k)'
+        if(k > 0)
+            ROCBLAS_RETURN_IF_ERROR(rocblasCall_gemm(handle,
+                                                     rocblas_operation_none,
+                                                     rocblas_operation_conjugate_transpose,
+                                                     m - rk,
+                                                     1,
+                                                     k,
+                                                     &mone,
+                                                     A0 + rk,
+                                                     lda,
+                                                     F + k,
+                                                     ldf,
+                                                     &one,
+                                                     akk_ptr,
+                                                     lda));
+
+        // generate the Householder reflector of column k
+        ROCBLAS_RETURN_IF_ERROR(rocsolverCall_larfg(
+            handle, m - rk, akk_ptr, akk_ptr + (rk < m - 1 ? 1 : 0), 1, tau0 + k));
+        HIP_RETURN_IF_ERROR(
+            hipMemcpyAsync(&htau, tau0 + k, sizeof(T), hipMemcpyDeviceToHost, stream));
+        HIP_RETURN_IF_ERROR(
+            hipMemcpyAsync(&akk, akk_ptr, sizeof(T), hipMemcpyDeviceToHost, stream));
+        HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream));
+        HIP_RETURN_IF_ERROR(
+            hipMemcpyAsync(akk_ptr, &one, sizeof(T), hipMemcpyHostToDevice, stream));
+
+        // F(k+1:nc, k) = tau * A(rk:m, k+1:nc)' * v
+        if(k < nc - 1)
+            ROCBLAS_RETURN_IF_ERROR(rocblasCall_gemv(handle,
+                                                     rocblas_operation_conjugate_transpose,
+                                                     m - rk,
+                                                     nc - k - 1,
+                                                     &htau,
+                                                     akk_ptr + lda,
+                                                     lda,
+                                                     akk_ptr,
+                                                     1,
+                                                     &zero,
+                                                     F + (k + 1) + size_t(k) * ldf,
+                                                     1));
+        HIP_RETURN_IF_ERROR(
+            hipMemsetAsync(F + size_t(k) * ldf, 0, sizeof(T) * (k + 1), stream));
+
+        // F(:, k) = F(:, k) - tau * F(:, 0:k) * A(rk:m, 0:k)' * v
+        if(k > 0)
+        {
+            T ntau = -htau;
+            ROCBLAS_RETURN_IF_ERROR(rocblasCall_gemv(handle,
+                                                     rocblas_operation_conjugate_transpose,
+                                                     m - rk,
+                                                     k,
+                                                     &ntau,
+                                                     A0 + rk,
+                                                     lda,
+                                                     akk_ptr,
+                                                     1,
+                                                     &zero,
+                                                     auxv,
+                                                     1));
+            ROCBLAS_RETURN_IF_ERROR(rocblasCall_gemv(handle,
+                                                     rocblas_operation_none,
+                                                     nc,
+                                                     k,
+                                                     &one,
+                                                     F,
+                                                     ldf,
+                                                     auxv,
+                                                     1,
+                                                     &one,
+                                                     F + size_t(k) * ldf,
+                                                     1));
+        }
+
+        // A(rk, k+1:nc) = A(rk, k+1:nc) - A(rk, 0:k+1) * F(k+1:nc, 0:k+1)'
+        if(k < nc - 1)
+            ROCBLAS_RETURN_IF_ERROR(rocblasCall_gemm(handle,
+                                                     rocblas_operation_none,
+                                                     rocblas_operation_conjugate_transpose,
+                                                     1,
+                                                     nc - k - 1,
+                                                     k + 1,
+                                                     &mone,
+                                                     A0 + rk,
+                                                     lda,
+                                                     F + (k + 1),
+                                                     ldf,
+                                                     &one,
+                                                     akk_ptr + lda,
+                                                     lda));
+
+        HIP_RETURN_IF_ERROR(
+            hipMemcpyAsync(akk_ptr, &akk, sizeof(T), hipMemcpyHostToDevice, stream));
+
+        // downdate the partial column norms with the updated row rk
+        if(rk < lastrk - 1)
+        {
+            HIP_RETURN_IF_ERROR(hipMemcpy2DAsync(hrow.data(),
+                                                 sizeof(T),
+                                                 akk_ptr + lda,
+                                                 sizeof(T) * lda,
+                                                 sizeof(T),
+                                                 nc - k - 1,
+                                                 hipMemcpyDeviceToHost,
+                                                 stream));
+            HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream));
+
+            for(int j = k + 1; j < nc; j++)
+            {
+                if(vn1[j] != 0)
+                {
+                    S temp  = std::abs(hrow[j - k - 1]) / vn1[j];
+                    temp    = std::max(S(0), (1 + temp) * (1 - temp));
+                    S temp2 = temp * (vn1[j] / vn2[j]) * (vn1[j] / vn2[j]);
+                    if(temp2 <= tol3z)
+                        recompute.push_back(j);
+                    else
+                        vn1[j] *= std::sqrt(temp);
+                }
+            }
+        }
+
+        k++;
+    }
+
+    // A(rk:m, kb:nc) = A(rk:m, kb:nc) - A(rk:m, 0:kb) * F(kb:nc, 0:kb)'
+    int rk = offset + k;
+    if(k > 0 && k < std::min(nc, m - offset))
+        ROCBLAS_RETURN_IF_ERROR(rocblasCall_gemm(handle,
+                                                 rocblas_operation_none,
+                                                 rocblas_operation_conjugate_transpose,
+                                                 m - rk,
+                                                 nc - k,
+                                                 k,
+                                                 &mone,
+                                                 A0 + rk,
+                                                 lda,
+                                                 F + k,
+                                                 ldf,
+                                                 &one,
+                                                 A0 + rk + size_t(k) * lda,
+                                                 lda));
+
+    // recompute the norms that could not be downdated reliably
+    for(int j : recompute)
+    {
+        ROCBLAS_RETURN_IF_ERROR(
+            rocblasCall_nrm2(handle, m - rk, A0 + rk + size_t(j) * lda, 1, vn1 + j));
+        vn2[j] = vn1[j];
+    }
+
+    // the host values copied from must outlive the copies
+    HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream));
+
+    *kb = k;
+    return rocblas_status_success;
+}
+
+/* On exit, the upper triangle of A holds R and the Householder vectors are
+   stored below it as in geqrf; jpvt[j] = k means that column j of A * P was
+   column k of A (1-based). If truncated, the factorization stops after rank
+   columns, the trailing block A(rank:m, rank:n) holds the residual matrix and
+   the remaining entries of tau are set to zero. work must point to at least
+   hipsolver_geqp3_worksize<T>(n) bytes of device memory. */
+template <typename T, typename S>
+rocblas_status hipsolver_geqp3_template(rocblas_handle handle,
+                                        int            m,
+                                        int            n,
+                                        T*             A,
+                                        int            lda,
+                                        int*           jpvt,
+                                        T*             tau,
+                                        const bool     truncated,
+                                        S              tol,
+                                        int*           rank,
+                                        int*           info,
+                                        void*          work)
+{
+    rocblas_status st
+        = hipsolver_geqp3_argCheck(handle, m, n, lda, truncated, tol, A, jpvt, tau, rank, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    hipStream_t stream;
+    ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle, &stream));
+
+    HIP_RETURN_IF_ERROR(hipMemsetAsync(info, 0, sizeof(int), stream));
+
+    int              minmn = std::min(m, n);
+    std::vector<int> hjpvt(n);
+    for(int j = 0; j < n; j++)
+        hjpvt[j] = j + 1;
+
+    // quick return
+    if(minmn == 0)
+    {
+        if(n > 0)
+            HIP_RETURN_IF_ERROR(hipMemcpyAsync(
+                jpvt, hjpvt.data(), sizeof(int) * n, hipMemcpyHostToDevice, stream));
+        if(truncated)
+            HIP_RETURN_IF_ERROR(hipMemsetAsync(rank, 0, sizeof(int), stream));
+        HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream));
+        return rocblas_status_success;
+    }
+
+    T* F    = (T*)work;
+    T* auxv = F + size_t(n) * HIPSOLVER_GEQP3_BLOCKSIZE;
+
+    // initial column norms
+    std::vector<S> vn1(n), vn2(n);
+    ROCBLAS_RETURN_IF_ERROR(
+        rocblasCall_nrm2_strided_batched(handle, m, A, 1, lda, n, vn1.data()));
+    vn2 = vn1;
+
+    S thresh = truncated ? tol * *std::max_element(vn1.begin(), vn1.end()) : S(0);
+
+    std::vector<T> hrow(n);
+    int            j    = 0;
+    bool           stop = false;
+    while(j < minmn && !stop)
+    {
+        int nb = std::min(HIPSOLVER_GEQP3_BLOCKSIZE, minmn - j);
+        int kb;
+        ROCBLAS_RETURN_IF_ERROR(hipsolver_laqps(handle,
+                                                stream,
+                                                m,
+                                                n - j,
+                                                j,
+                                                nb,
+                                                A + size_t(j) * lda,
+                                                lda,
+                                                tau + j,
+                                                hjpvt.data() + j,
+                                                vn1.data() + j,
+                                                vn2.data() + j,
+                                                truncated,
+                                                thresh,
+                                                F,
+                                                auxv,
+                                                hrow,
+                                                &kb,
+                                                &stop));
+        j += kb;
+    }
+
+    // the reflectors that were not computed are the identity
+    if(j < minmn)
+        HIP_RETURN_IF_ERROR(hipMemsetAsync(tau + j, 0, sizeof(T) * (minmn - j), stream));
+    if(truncated)
+        HIP_RETURN_IF_ERROR(
+            hipMemcpyAsync(rank, &j, sizeof(int), hipMemcpyHostToDevice, stream));
+    HIP_RETURN_IF_ERROR(hipMemcpyAsync(
+        jpvt, hjpvt.data(), sizeof(int) * n, hipMemcpyHostToDevice, stream));
+
+    // hjpvt and j must outlive the copies made from them
+    HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream));
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,544 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_templates.hpp"
+#include "rocsolver_templates.hpp"
+#include <algorithm>
+#include <cmath>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    geqrfTsqr computes the QR factorization of a tall and skinny matrix with
+ *    a communication-avoiding reduction tree (TSQR). The rows of A are split
+ *    into blocks that are factorized independently by a single strided
+ *    batched geqrf; their R factors are then stacked and reduced recursively.
+ *    Finally, the explicit Q obtained from the tree is converted back into
+ *    Householder vectors (Ballard et al., "Reconstructing Householder vectors
+ *    from tall-skinny QR") so that the result has the same format as geqrf
+ *    and can be consumed by ormqr and orgqr.
+ * ===========================================================================
+ */
+
+// minimum number of rows of a leaf block, as a multiple of n
+constexpr int HIPSOLVER_TSQR_ROWS_PER_COL = 8;
+// maximum number of leaf blocks reduced at each level of the tree
+constexpr int HIPSOLVER_TSQR_MAX_BLOCKS = 1024;
+
+inline size_t hipsolver_tsqr_align(size_t bytes)
+{
+    return (bytes + 255) / 256 * 256;
+}
+
+inline int hipsolver_tsqr_block_rows(int m, int n)
+{
+    return std::max(HIPSOLVER_TSQR_ROWS_PER_COL * n, (m - 1) / HIPSOLVER_TSQR_MAX_BLOCKS + 1);
+}
+
+// returns true if A is tall enough to be split into at least two leaf blocks
+inline bool hipsolver_tsqr_split(int m, int n)
+{
+    return n > 0 && m >= 2 * hipsolver_tsqr_block_rows(m, n);
+}
+
+inline float hipsolver_tsqr_conj(float x)
+{
+    return x;
+}
+
+inline double hipsolver_tsqr_conj(double x)
+{
+    return x;
+}
+
+template <typename T>
+inline rocblas_complex_num<T> hipsolver_tsqr_conj(const rocblas_complex_num<T>& x)
+{
+    return rocblas_complex_num<T>(x.real(), -x.imag());
+}
+
+/******************** WORKSPACE SIZES ********************/
+
+// size in bytes of the workspace of hipsolver_tsqr_explicit
+template <typename T>
+size_t hipsolver_tsqr_explicit_worksize(int m, int n)
+{
+    if(!hipsolver_tsqr_split(m, n))
+        return hipsolver_tsqr_align(sizeof(T) * n);
+
+    int mb = hipsolver_tsqr_block_rows(m, n);
+    int p  = m / mb;
+
+    size_t size_tau   = hipsolver_tsqr_align(sizeof(T) * p * n);
+    size_t size_Rs    = hipsolver_tsqr_align(sizeof(T) * p * n * n);
+    size_t size_block = hipsolver_tsqr_align(sizeof(T) * p * n * (n + 1));
+    size_t size_W     = hipsolver_tsqr_align(sizeof(T) * m * n);
+
+    return size_tau + size_Rs
+           + std::max(hipsolver_tsqr_explicit_worksize<T>(p * n, n), 3 * size_block + size_W);
+}
+
+// size in bytes of the workspace that geqrfTsqr needs on top of the rocBLAS device memory
+template <typename T>
+size_t hipsolver_geqrf_tsqr_worksize(int m, int n)
+{
+    if(!hipsolver_tsqr_split(m, n))
+        return 0;
+
+    return hipsolver_tsqr_align(sizeof(T) * n * n) + hipsolver_tsqr_explicit_worksize<T>(m, n);
+}
+
+/******************** DEVICE MEMORY QUERIES ********************/
+
+// must be called while the handle is in device memory size query mode
+template <typename T>
+rocblas_status hipsolver_tsqr_explicit_query(rocblas_handle handle, int m, int n)
+{
+    if(!hipsolver_tsqr_split(m, n))
+    {
+        ROCBLAS_QUERY_RETURN_IF_ERROR(
+            rocsolverCall_geqrf(handle, m, n, (T*)nullptr, m, (T*)nullptr));
+        ROCBLAS_QUERY_RETURN_IF_ERROR(
+            rocsolverCall_orgqr(handle, m, n, n, (T*)nullptr, m, (T*)nullptr));
+        return rocblas_status_success;
+    }
+
+    int            mb      = hipsolver_tsqr_block_rows(m, n);
+    int            p       = m / mb;
+    rocblas_stride strideV = rocblas_stride(n) * (n + 1);
+    T              one     = 1;
+
+    if(p > 1)
+        ROCBLAS_QUERY_RETURN_IF_ERROR(rocsolverCall_geqrf_strided_batched(
+            handle, mb, n, (T*)nullptr, m, mb, (T*)nullptr, n, p - 1));
+    ROCBLAS_QUERY_RETURN_IF_ERROR(
+        rocsolverCall_geqrf(handle, m - (p - 1) * mb, n, (T*)nullptr, m, (T*)nullptr));
+    ROCBLAS_QUERY_RETURN_IF_ERROR(hipsolver_tsqr_explicit_query<T>(handle, p * n, n));
+    ROCBLAS_QUERY_RETURN_IF_ERROR(rocblasCall_trsm_strided_batched(handle,
+                                                                   rocblas_side_left,
+                                                                   rocblas_fill_upper,
+                                                                   rocblas_operation_none,
+                                                                   rocblas_diagonal_unit,
+                                                                   n,
+                                                                   n,
+                                                                   &one,
+                                                                   (T*)nullptr,
+                                                                   n,
+                                                                   strideV,
+                                                                   (T*)nullptr,
+                                                                   n,
+                                                                   strideV,
+                                                                   p));
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_geqrf_tsqr_bufferSize_template(
+    rocblas_handle handle, int m, int n, int lda, size_t* size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    size_t internal_size;
+    T      one = 1;
+
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_status status;
+    if(hipsolver_tsqr_split(m, n) && lda >= m)
+    {
+        status = hipsolver_tsqr_explicit_query<T>(handle, m, n);
+        if(status == rocblas_status_success || status == rocblas_status_size_unchanged
+           || status == rocblas_status_size_increased)
+            status = rocblasCall_trsm(handle,
+                                      rocblas_side_right,
+                                      rocblas_fill_upper,
+                                      rocblas_operation_none,
+                                      rocblas_diagonal_non_unit,
+                                      m - n,
+                                      n,
+                                      &one,
+                                      (T*)nullptr,
+                                      n,
+                                      (T*)nullptr,
+                                      lda);
+    }
+    else
+        status = rocsolverCall_geqrf(handle, m, n, (T*)nullptr, lda, (T*)nullptr);
+    rocblas_stop_device_memory_size_query(handle, &internal_size);
+
+    if(status != rocblas_status_success && status != rocblas_status_size_unchanged
+       && status != rocblas_status_size_increased)
+        return status;
+
+    *size = hipsolver_geqrf_tsqr_worksize<T>(m, n) + internal_size;
+    return rocblas_status_success;
+}
+
+/******************** TSQR ********************/
+
+/* Overwrites the m-by-n matrix A with the explicit Q factor of its QR
+   factorization, and writes the factor R into the upper triangular part of the
+   n-by-n matrix R (with leading dimension n). The lower triangular part of R is
+   used as scratch space. */
+template <typename T>
+rocblas_status hipsolver_tsqr_explicit(
+    rocblas_handle handle, hipStream_t stream, int m, int n, T* A, int lda, T* R, char* work)
+{
+    if(!hipsolver_tsqr_split(m, n))
+    {
+        T* tau = (T*)work;
+
+        ROCBLAS_RETURN_IF_ERROR(rocsolverCall_geqrf(handle, m, n, A, lda, tau));
+        HIP_RETURN_IF_ERROR(hipMemcpy2DAsync(R,
+                                             sizeof(T) * n,
+                                             A,
+                                             sizeof(T) * lda,
+                                             sizeof(T) * n,
+                                             n,
+                                             hipMemcpyDeviceToDevice,
+                                             stream));
+        return rocsolverCall_orgqr(handle, m, n, n, A, lda, tau);
+    }
+
+    // the rows of A are split into p leaf blocks of mb rows; the last block
+    // also takes the remaining mlast - mb rows
+    int            mb      = hipsolver_tsqr_block_rows(m, n);
+    int            p       = m / mb;
+    int            mlast   = m - (p - 1) * mb;
+    int            ldr     = p * n;
+    rocblas_stride strideV = rocblas_stride(n) * (n + 1);
+    T*             Alast   = A + (p - 1) * mb;
+
+    T     one      = 1;
+    T     zero     = 0;
+    T     minusone = -1;
+    T*    tau      = (T*)work;
+    T*    Rs       = (T*)(work + hipsolver_tsqr_align(sizeof(T) * p * n));
+    char* scratch  = work + hipsolver_tsqr_align(sizeof(T) * p * n)
+                    + hipsolver_tsqr_align(sizeof(T) * p * n * n);
+    size_t size_block = hipsolver_tsqr_align(sizeof(T) * p * n * (n + 1));
+    T*     V1         = (T*)scratch;
+    T*     G          = (T*)(scratch + size_block);
+    T*     X          = (T*)(scratch + 2 * size_block);
+    T*     W          = (T*)(scratch + 3 * size_block);
+
+    // 1. factorize the leaf blocks
+    if(p > 1)
+        ROCBLAS_RETURN_IF_ERROR(
+            rocsolverCall_geqrf_strided_batched(handle, mb, n, A, lda, mb, tau, n, p - 1));
+    ROCBLAS_RETURN_IF_ERROR(rocsolverCall_geqrf(handle, mlast, n, Alast, lda, tau + (p - 1) * n));
+
+    // 2. stack their R factors into the (p*n)-by-n matrix Rs
+    HIP_RETURN_IF_ERROR(hipMemsetAsync(Rs, 0, sizeof(T) * ldr * n, stream));
+    for(int j = 0; j < n; j++)
+        HIP_RETURN_IF_ERROR(hipMemcpy2DAsync(Rs + j * ldr,
+                                             sizeof(T) * n,
+                                             A + j * lda,
+                                             sizeof(T) * mb,
+                                             sizeof(T) * (j + 1),
+                                             p,
+                                             hipMemcpyDeviceToDevice,
+                                             stream));
+
+    // 3. reduce the stacked factors; Rs is overwritten with its explicit Q
+    ROCBLAS_RETURN_IF_ERROR(hipsolver_tsqr_explicit(handle, stream, ldr, n, Rs, ldr, R, scratch));
+
+    // 4. the leaf Q factors are applied to Rs as
+    //    Q_i * [Qs_i; 0] = [Qs_i; 0] - V_i * T_i * V1_i' * Qs_i,
+    //    where V1_i is the unit lower triangular top of the Householder vectors V_i
+    std::vector<T> hones(size_t(p) * n, one);
+    HIP_RETURN_IF_ERROR(hipMemsetAsync(V1, 0, sizeof(T) * strideV * p, stream));
+    HIP_RETURN_IF_ERROR(hipMemcpy2DAsync(V1,
+                                         sizeof(T) * (n + 1),
+                                         hones.data(),
+                                         sizeof(T),
+                                         sizeof(T),
+                                         size_t(p) * n,
+                                         hipMemcpyHostToDevice,
+                                         stream));
+    ROCBLAS_RETURN_IF_ERROR(rocblasCall_trmm_strided_batched(handle,
+                                                             rocblas_side_left,
+                                                             rocblas_fill_lower,
+                                                             rocblas_operation_none,
+                                                             rocblas_diagonal_unit,
+                                                             n,
+                                                             n,
+                                                             &one,
+                                                             A,
+                                                             lda,
+                                                             mb,
+                                                             V1,
+                                                             n,
+                                                             strideV,
+                                                             p));
+
+    // 5. G_i = V_i' * V_i; with D_i = diag(tau_i), the triangular factor of the
+    //    block reflector is T_i = (I + D_i * striu(G_i))^-1 * D_i
+    ROCBLAS_RETURN_IF_ERROR(rocblasCall_gemm_strided_batched(handle,
+                                                             rocblas_operation_conjugate_transpose,
+                                                             rocblas_operation_none,
+                                                             n,
+                                                             n,
+                                                             n,
+                                                             &one,
+                                                             V1,
+                                                             n,
+                                                             strideV,
+                                                             V1,
+                                                             n,
+                                                             strideV,
+                                                             &zero,
+                                                             G,
+                                                             n,
+                                                             strideV,
+                                                             p));
+    if(p > 1 && mb > n)
+        ROCBLAS_RETURN_IF_ERROR(
+            rocblasCall_gemm_strided_batched(handle,
+                                             rocblas_operation_conjugate_transpose,
+                                             rocblas_operation_none,
+                                             n,
+                                             n,
+                                             mb - n,
+                                             &one,
+                                             A + n,
+                                             lda,
+                                             mb,
+                                             A + n,
+                                             lda,
+                                             mb,
+                                             &one,
+                                             G,
+                                             n,
+                                             strideV,
+                                             p - 1));
+    ROCBLAS_RETURN_IF_ERROR(rocblasCall_gemm(handle,
+                                             rocblas_operation_conjugate_transpose,
+                                             rocblas_operation_none,
+                                             n,
+                                             n,
+                                             mlast - n,
+                                             &one,
+                                             Alast + n,
+                                             lda,
+                                             Alast + n,
+                                             lda,
+                                             &one,
+                                             G + (p - 1) * strideV,
+                                             n));
+    ROCBLAS_RETURN_IF_ERROR(rocblasCall_dgmm_strided_batched(
+        handle, rocblas_side_left, n, n, G, n, strideV, tau, 1, n, G, n, strideV, p));
+
+    // 6. X_i = T_i * V1_i' * Qs_i
+    ROCBLAS_RETURN_IF_ERROR(rocblasCall_gemm_strided_batched(handle,
+                                                             rocblas_operation_conjugate_transpose,
+                                                             rocblas_operation_none,
+                                                             n,
+                                                             n,
+                                                             n,
+                                                             &one,
+                                                             V1,
+                                                             n,
+                                                             strideV,
+                                                             Rs,
+                                                             ldr,
+                                                             n,
+                                                             &zero,
+                                                             X,
+                                                             n,
+                                                             strideV,
+                                                             p));
+    ROCBLAS_RETURN_IF_ERROR(rocblasCall_dgmm_strided_batched(
+        handle, rocblas_side_left, n, n, X, n, strideV, tau, 1, n, X, n, strideV, p));
+    ROCBLAS_RETURN_IF_ERROR(rocblasCall_trsm_strided_batched(handle,
+                                                             rocblas_side_left,
+                                                             rocblas_fill_upper,
+                                                             rocblas_operation_none,
+                                                             rocblas_diagonal_unit,
+                                                             n,
+                                                             n,
+                                                             &one,
+                                                             G,
+                                                             n,
+                                                             strideV,
+                                                             X,
+                                                             n,
+                                                             strideV,
+                                                             p));
+
+    // 7. W = [Qs_i; 0] - V_i * X_i, block by block, and copy it back into A
+    for(int j = 0; j < n; j++)
+        HIP_RETURN_IF_ERROR(hipMemcpy2DAsync(W + j * m,
+                                             sizeof(T) * mb,
+                                             Rs + j * ldr,
+                                             sizeof(T) * n,
+                                             sizeof(T) * n,
+                                             p,
+                                             hipMemcpyDeviceToDevice,
+                                             stream));
+    ROCBLAS_RETURN_IF_ERROR(rocblasCall_gemm_strided_batched(handle,
+                                                             rocblas_operation_none,
+                                                             rocblas_operation_none,
+                                                             n,
+                                                             n,
+                                                             n,
+                                                             &minusone,
+                                                             V1,
+                                                             n,
+                                                             strideV,
+                                                             X,
+                                                             n,
+                                                             strideV,
+                                                             &one,
+                                                             W,
+                                                             m,
+                                                             mb,
+                                                             p));
+    if(p > 1 && mb > n)
+        ROCBLAS_RETURN_IF_ERROR(rocblasCall_gemm_strided_batched(handle,
+                                                                 rocblas_operation_none,
+                                                                 rocblas_operation_none,
+                                                                 mb - n,
+                                                                 n,
+                                                                 n,
+                                                                 &minusone,
+                                                                 A + n,
+                                                                 lda,
+                                                                 mb,
+                                                                 X,
+                                                                 n,
+                                                                 strideV,
+                                                                 &zero,
+                                                                 W + n,
+                                                                 m,
+                                                                 mb,
+                                                                 p - 1));
+    ROCBLAS_RETURN_IF_ERROR(rocblasCall_gemm(handle,
+                                             rocblas_operation_none,
+                                             rocblas_operation_none,
+                                             mlast - n,
+                                             n,
+                                             n,
+                                             &minusone,
+                                             Alast + n,
+                                             lda,
+                                             X + (p - 1) * strideV,
+                                             n,
+                                             &zero,
+                                             W + (p - 1) * mb + n,
+                                             m));
+    HIP_RETURN_IF_ERROR(hipMemcpy2DAsync(A,
+                                         sizeof(T) * lda,
+                                         W,
+                                         sizeof(T) * m,
+                                         sizeof(T) * m,
+                                         n,
+                                         hipMemcpyDeviceToDevice,
+                                         stream));
+
+    // hones must outlive the copy made from it
+    HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream));
+    return rocblas_status_success;
+}
+
+/******************** GEQRF_TSQR ********************/
+
+/* Computes the QR factorization of A in the same format as geqrf. work must
+   point to at least hipsolver_geqrf_tsqr_worksize<T>(m, n) bytes of device
+   memory; the routines it calls use the device memory of the handle. */
+template <typename T>
+rocblas_status hipsolver_geqrf_tsqr_template(
+    rocblas_handle handle, int m, int n, T* A, int lda, T* tau, void* work)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(m < 0 || n < 0 || lda < m)
+        return rocblas_status_invalid_size;
+    if((m && n && !A) || (m && n && !tau))
+        return rocblas_status_invalid_pointer;
+
+    if(!hipsolver_tsqr_split(m, n))
+        return rocsolverCall_geqrf(handle, m, n, A, lda, tau);
+
+    hipStream_t stream;
+    ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle, &stream));
+
+    T     one     = 1;
+    T*    R       = (T*)work;
+    char* scratch = (char*)work + hipsolver_tsqr_align(sizeof(T) * n * n);
+
+    // 1. A = Q * R with the explicit m-by-n Q
+    ROCBLAS_RETURN_IF_ERROR(hipsolver_tsqr_explicit(handle, stream, m, n, A, lda, R, scratch));
+
+    // 2. reconstruct the Householder vectors: the LU factorization of Q1 - S, with the
+    //    top n-by-n block Q1 of Q and the diagonal sign matrix S chosen on the fly for
+    //    stability, gives Q1 - S = L1 * U, V = [L1; Q2 * U^-1] and tau = -diag(U) * S'
+    std::vector<T> hQ(size_t(n) * n), hR(size_t(n) * n), hS(n), htau(n);
+    HIP_RETURN_IF_ERROR(hipMemcpy2DAsync(hQ.data(),
+                                         sizeof(T) * n,
+                                         A,
+                                         sizeof(T) * lda,
+                                         sizeof(T) * n,
+                                         n,
+                                         hipMemcpyDeviceToHost,
+                                         stream));
+    HIP_RETURN_IF_ERROR(
+        hipMemcpyAsync(hR.data(), R, sizeof(T) * n * n, hipMemcpyDeviceToHost, stream));
+    HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream));
+
+    for(int k = 0; k < n; k++)
+    {
+        T    d    = hQ[k + k * n];
+        auto absd = std::abs(d);
+        hS[k]     = (absd == 0) ? -one : -(d / T(absd));
+
+        // |d - s_k| = |d| + 1, so no pivoting is needed
+        T u           = d - hS[k];
+        hQ[k + k * n] = u;
+        htau[k]       = -u * hipsolver_tsqr_conj(hS[k]);
+        for(int i = k + 1; i < n; i++)
+            hQ[i + k * n] /= u;
+        for(int j = k + 1; j < n; j++)
+            for(int i = k + 1; i < n; i++)
+                hQ[i + j * n] -= hQ[i + k * n] * hQ[k + j * n];
+    }
+
+    // the first n columns of H_1 * ... * H_n are Q * S', so the factor R in the output is S * R
+    std::vector<T> htop(size_t(n) * n);
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i < n; i++)
+            htop[i + j * n] = (i <= j) ? hS[i] * hR[i + j * n] : hQ[i + j * n];
+
+    HIP_RETURN_IF_ERROR(
+        hipMemcpyAsync(R, hQ.data(), sizeof(T) * n * n, hipMemcpyHostToDevice, stream));
+    ROCBLAS_RETURN_IF_ERROR(rocblasCall_trsm(handle,
+                                             rocblas_side_right,
+                                             rocblas_fill_upper,
+                                             rocblas_operation_none,
+                                             rocblas_diagonal_non_unit,
+                                             m - n,
+                                             n,
+                                             &one,
+                                             R,
+                                             n,
+                                             A + n,
+                                             lda));
+    HIP_RETURN_IF_ERROR(hipMemcpy2DAsync(A,
+                                         sizeof(T) * lda,
+                                         htop.data(),
+                                         sizeof(T) * n,
+                                         sizeof(T) * n,
+                                         n,
+                                         hipMemcpyHostToDevice,
+                                         stream));
+    HIP_RETURN_IF_ERROR(
+        hipMemcpyAsync(tau, htau.data(), sizeof(T) * n, hipMemcpyHostToDevice, stream));
+
+    // the host vectors used as source of the copies above must outlive them
+    HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream));
+    return rocblas_status_success;
+}
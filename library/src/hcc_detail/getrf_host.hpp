@@ -0,0 +1,507 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "host_staging.hpp"
+#include "rocblas_templates.hpp"
+#include "rocsolver_templates.hpp"
+#include <algorithm>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    getrfHost and getrsHost take matrices in host memory. getrfHost uploads
+ *    A by column panels and factorizes it with a left-looking algorithm, so
+ *    that each panel is factorized as soon as it arrives while the next one
+ *    is uploaded. A block row of the factors is final once the panel on its
+ *    diagonal is factorized, and is downloaded while the next panels are
+ *    processed. getrsHost solves for blocks of right-hand sides in the same
+ *    manner. The batched versions keep two problems on the device, so that
+ *    one is solved while the other is uploaded or downloaded.
+ * ===========================================================================
+ */
+
+// width of the column panels of getrfHost and of the blocks of right-hand sides of getrsHost
+#define HIPSOLVER_HOST_BLOCKSIZE 256
+
+inline rocblas_status hipsolver_getrf_host_argCheck(rocblas_handle handle,
+                                                    int            m,
+                                                    int            n,
+                                                    int            lda,
+                                                    const void*    A,
+                                                    int*           info,
+                                                    int            batch_count = 1)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(m < 0 || n < 0 || lda < m || lda < 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if((m && n && batch_count && !A) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_success;
+}
+
+inline rocblas_status hipsolver_getrs_host_argCheck(rocblas_handle handle,
+                                                    int            n,
+                                                    int            nrhs,
+                                                    int            lda,
+                                                    int            ldb,
+                                                    const void*    A,
+                                                    const int*     ipiv,
+                                                    const void*    B,
+                                                    int*           info,
+                                                    int            batch_count = 1)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n || lda < 1 || ldb < 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if((n && batch_count && (!A || !ipiv)) || (n && nrhs && batch_count && !B) || !info)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_success;
+}
+
+/* Device memory required by getrfHost (batched = false) or getrfBatchedHost.
+   size_host is the memory for the matrices, pivots and info on the device, and
+   size the total including the memory required by rocBLAS and rocSOLVER. */
+template <typename T>
+rocblas_status hipsolver_getrf_host_size(rocblas_handle handle,
+                                         int            m,
+                                         int            n,
+                                         bool           pivot,
+                                         bool           batched,
+                                         size_t*        size_host,
+                                         size_t*        size)
+{
+    *size_host = 0;
+    *size      = 0;
+
+    // quick return
+    if(m == 0 || n == 0)
+        return rocblas_status_success;
+
+    int mn  = std::min(m, n);
+    int nb  = batched ? n : std::min(n, HIPSOLVER_HOST_BLOCKSIZE);
+    T   one = 1;
+
+    size_t internal;
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_status status = [&] {
+        if(pivot)
+            ROCBLAS_QUERY_RETURN_IF_ERROR(
+                rocsolverCall_getrf(handle, m, nb, (T*)nullptr, m, (int*)nullptr, (int*)nullptr));
+        else
+            ROCBLAS_QUERY_RETURN_IF_ERROR(
+                rocsolverCall_getrf_npvt(handle, m, nb, (T*)nullptr, m, (int*)nullptr));
+        if(!batched)
+        {
+            ROCBLAS_QUERY_RETURN_IF_ERROR(rocblasCall_trsm(handle,
+                                                           rocblas_side_left,
+                                                           rocblas_fill_lower,
+                                                           rocblas_operation_none,
+                                                           rocblas_diagonal_unit,
+                                                           mn,
+                                                           nb,
+                                                           &one,
+                                                           (T*)nullptr,
+                                                           m,
+                                                           (T*)nullptr,
+                                                           m));
+            ROCBLAS_QUERY_RETURN_IF_ERROR(rocblasCall_gemm(handle,
+                                                           rocblas_operation_none,
+                                                           rocblas_operation_none,
+                                                           m,
+                                                           nb,
+                                                           n,
+                                                           &one,
+                                                           (T*)nullptr,
+                                                           m,
+                                                           (T*)nullptr,
+                                                           m,
+                                                           &one,
+                                                           (T*)nullptr,
+                                                           m));
+        }
+        return rocblas_status_success;
+    }();
+    rocblas_stop_device_memory_size_query(handle, &internal);
+    ROCBLAS_RETURN_IF_ERROR(status);
+
+    // one problem with the info of each panel, or two problems
+    int nt     = (mn - 1) / nb + 1;
+    *size_host = batched ? 2 * (sizeof(T) * m * n + sizeof(int) * (mn + 1))
+                         : sizeof(T) * m * n + sizeof(int) * (mn + nt);
+    *size      = *size_host + internal;
+    return rocblas_status_success;
+}
+
+// device memory required by getrsHost (batched = false) or getrsBatchedHost, as above
+template <typename T>
+rocblas_status hipsolver_getrs_host_size(rocblas_handle    handle,
+                                         rocblas_operation trans,
+                                         int               n,
+                                         int               nrhs,
+                                         bool              batched,
+                                         size_t*           size_host,
+                                         size_t*           size)
+{
+    *size_host = 0;
+    *size      = 0;
+
+    // quick return
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    int nb = batched ? nrhs : std::min(nrhs, HIPSOLVER_HOST_BLOCKSIZE);
+
+    size_t internal;
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_status status = rocsolverCall_getrs(
+        handle, trans, n, nb, (T*)nullptr, n, (int*)nullptr, (T*)nullptr, n);
+    rocblas_stop_device_memory_size_query(handle, &internal);
+    ROCBLAS_QUERY_RETURN_IF_ERROR(status);
+
+    size_t problem = sizeof(T) * n * (n + nrhs) + sizeof(int) * n;
+    *size_host     = batched ? 2 * problem : problem;
+    *size          = *size_host + internal;
+    return rocblas_status_success;
+}
+
+/* Overwrites the host matrix A with its LU factorization and sets the host
+   pivots ipiv (unless ipiv is null, in which case no pivoting is done) and
+   info. work must point to at least size_host bytes of device memory, as
+   returned by hipsolver_getrf_host_size. */
+template <typename T>
+rocblas_status hipsolver_getrf_host_template(
+    rocblas_handle handle, int m, int n, T* A, int lda, int* ipiv, int* info, void* work)
+{
+    // quick return
+    *info = 0;
+    if(m == 0 || n == 0)
+        return rocblas_status_success;
+
+    int  mn    = std::min(m, n);
+    int  nb    = std::min(n, HIPSOLVER_HOST_BLOCKSIZE);
+    int  nt    = (n - 1) / nb + 1;
+    T*   dA    = (T*)work;
+    int* dipiv = (int*)(dA + size_t(m) * n);
+    int* dinfo = dipiv + mn;
+    T    one   = 1, minone = -1;
+
+    hipStream_t stream;
+    ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle, &stream));
+
+    // event 2k marks the upload of panel k, and event 2k + 1 its factorization
+    std::shared_ptr<hipsolver_staging> staging = hipsolver_get_staging(handle);
+    hipsolver_staging_guard            guard(*staging);
+    ROCBLAS_RETURN_IF_ERROR(staging->init(stream, sizeof(T) * m, 2 * nt));
+
+    auto upload = [&](int k) {
+        int k0 = k * nb;
+        ROCBLAS_RETURN_IF_ERROR(staging->upload(
+            dA + size_t(m) * k0, m, A + size_t(lda) * k0, lda, m, std::min(nb, n - k0)));
+        return staging->record(staging->h2d, 2 * k);
+    };
+
+    std::vector<int> panel_info(nt, 0);
+    ROCBLAS_RETURN_IF_ERROR(upload(0));
+    for(int k = 0; k < nt; k++)
+    {
+        int k0    = k * nb;
+        int kb    = std::min(nb, n - k0);
+        int kr    = std::max(std::min(kb, m - k0), 0);
+        T*  panel = dA + size_t(m) * k0;
+
+        // apply the interchanges and updates of the panels on the left
+        ROCBLAS_RETURN_IF_ERROR(staging->wait(stream, 2 * k));
+        for(int j0 = 0; ipiv && j0 < std::min(k0, m); j0 += nb)
+            ROCBLAS_RETURN_IF_ERROR(rocsolverCall_laswp(
+                handle, kb, panel + j0, m, 1, std::min(nb, m - j0), dipiv + j0, 1));
+        if(k0 > 0)
+            ROCBLAS_RETURN_IF_ERROR(rocblasCall_trsm(handle,
+                                                     rocblas_side_left,
+                                                     rocblas_fill_lower,
+                                                     rocblas_operation_none,
+                                                     rocblas_diagonal_unit,
+                                                     std::min(k0, m),
+                                                     kb,
+                                                     &one,
+                                                     dA,
+                                                     m,
+                                                     panel,
+                                                     m));
+
+        // factorize the panel and apply its interchanges to the panels on the left
+        if(kr > 0)
+        {
+            if(k0 > 0)
+                ROCBLAS_RETURN_IF_ERROR(rocblasCall_gemm(handle,
+                                                         rocblas_operation_none,
+                                                         rocblas_operation_none,
+                                                         m - k0,
+                                                         kb,
+                                                         k0,
+                                                         &minone,
+                                                         dA + k0,
+                                                         m,
+                                                         panel,
+                                                         m,
+                                                         &one,
+                                                         panel + k0,
+                                                         m));
+            if(ipiv)
+                ROCBLAS_RETURN_IF_ERROR(rocsolverCall_getrf(
+                    handle, m - k0, kb, panel + k0, m, dipiv + k0, dinfo + k));
+            else
+                ROCBLAS_RETURN_IF_ERROR(
+                    rocsolverCall_getrf_npvt(handle, m - k0, kb, panel + k0, m, dinfo + k));
+            if(ipiv && k0 > 0)
+                ROCBLAS_RETURN_IF_ERROR(
+                    rocsolverCall_laswp(handle, k0, dA + k0, m, 1, kr, dipiv + k0, 1));
+        }
+        ROCBLAS_RETURN_IF_ERROR(staging->record(stream, 2 * k + 1));
+
+        if(k + 1 < nt)
+            ROCBLAS_RETURN_IF_ERROR(upload(k + 1));
+
+        // the rows of the panel up to its diagonal block, and the block row on the
+        // left of the diagonal block, are not modified by the next panels
+        ROCBLAS_RETURN_IF_ERROR(staging->wait(staging->d2h, 2 * k + 1));
+        ROCBLAS_RETURN_IF_ERROR(staging->download(
+            A + size_t(lda) * k0, lda, panel, m, std::min(k0 + kb, m), kb));
+        if(kr > 0)
+        {
+            ROCBLAS_RETURN_IF_ERROR(staging->download(A + k0, lda, dA + k0, m, kr, k0));
+            if(ipiv)
+                ROCBLAS_RETURN_IF_ERROR(staging->download(ipiv + k0, kr, dipiv + k0, kr, kr, 1));
+            ROCBLAS_RETURN_IF_ERROR(staging->download(&panel_info[k], 1, dinfo + k, 1, 1, 1));
+        }
+    }
+    if(m > n)
+        ROCBLAS_RETURN_IF_ERROR(staging->download(A + n, lda, dA + n, m, m - n, n));
+    ROCBLAS_RETURN_IF_ERROR(staging->finish());
+
+    // the pivots and info of each panel are relative to its first row
+    for(int k0 = 0; k0 < mn; k0 += nb)
+    {
+        for(int i = k0; ipiv && i < std::min(k0 + nb, mn); i++)
+            ipiv[i] += k0;
+        if(*info == 0 && panel_info[k0 / nb] > 0)
+            *info = k0 + panel_info[k0 / nb];
+    }
+
+    return rocblas_status_success;
+}
+
+/* Batched version of hipsolver_getrf_host_template, with the pivots of problem
+   b at ipiv + b * strideP and its info at info[b]. */
+template <typename T>
+rocblas_status hipsolver_getrf_batched_host_template(rocblas_handle handle,
+                                                     int            m,
+                                                     int            n,
+                                                     T* const       A[],
+                                                     int            lda,
+                                                     int*           ipiv,
+                                                     int            strideP,
+                                                     int*           info,
+                                                     int            batch_count,
+                                                     void*          work)
+{
+    // quick return
+    std::fill(info, info + batch_count, 0);
+    if(m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    int    mn    = std::min(m, n);
+    size_t sizeA = size_t(m) * n;
+    T*     dA    = (T*)work;
+    int*   dipiv = (int*)(dA + 2 * sizeA);
+    int*   dinfo = dipiv + 2 * mn;
+
+    hipStream_t stream;
+    ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle, &stream));
+
+    // events s, 2 + s and 4 + s mark the upload, factorization and download of the
+    // last problem in device buffer s
+    std::shared_ptr<hipsolver_staging> staging = hipsolver_get_staging(handle);
+    hipsolver_staging_guard            guard(*staging);
+    ROCBLAS_RETURN_IF_ERROR(staging->init(stream, sizeof(T) * m, 6));
+
+    auto upload = [&](int b) {
+        int s = b % 2;
+        if(b >= 2)
+            ROCBLAS_RETURN_IF_ERROR(staging->wait(staging->h2d, 4 + s));
+        ROCBLAS_RETURN_IF_ERROR(staging->upload(dA + s * sizeA, m, A[b], lda, m, n));
+        return staging->record(staging->h2d, s);
+    };
+
+    ROCBLAS_RETURN_IF_ERROR(upload(0));
+    for(int b = 0; b < batch_count; b++)
+    {
+        int s = b % 2;
+
+        ROCBLAS_RETURN_IF_ERROR(staging->wait(stream, s));
+        if(ipiv)
+            ROCBLAS_RETURN_IF_ERROR(rocsolverCall_getrf(
+                handle, m, n, dA + s * sizeA, m, dipiv + s * mn, dinfo + s));
+        else
+            ROCBLAS_RETURN_IF_ERROR(
+                rocsolverCall_getrf_npvt(handle, m, n, dA + s * sizeA, m, dinfo + s));
+        ROCBLAS_RETURN_IF_ERROR(staging->record(stream, 2 + s));
+
+        if(b + 1 < batch_count)
+            ROCBLAS_RETURN_IF_ERROR(upload(b + 1));
+
+        ROCBLAS_RETURN_IF_ERROR(staging->wait(staging->d2h, 2 + s));
+        ROCBLAS_RETURN_IF_ERROR(staging->download(A[b], lda, dA + s * sizeA, m, m, n));
+        if(ipiv)
+            ROCBLAS_RETURN_IF_ERROR(
+                staging->download(ipiv + size_t(strideP) * b, mn, dipiv + s * mn, mn, mn, 1));
+        ROCBLAS_RETURN_IF_ERROR(staging->download(info + b, 1, dinfo + s, 1, 1, 1));
+        ROCBLAS_RETURN_IF_ERROR(staging->record(staging->d2h, 4 + s));
+    }
+
+    return staging->finish();
+}
+
+/* Overwrites the host matrix B with the solution of op(A) * X = B, where the host
+   matrix A and pivots ipiv hold the factorization computed by getrfHost. */
+template <typename T>
+rocblas_status hipsolver_getrs_host_template(rocblas_handle    handle,
+                                             rocblas_operation trans,
+                                             int               n,
+                                             int               nrhs,
+                                             const T*          A,
+                                             int               lda,
+                                             const int*        ipiv,
+                                             T*                B,
+                                             int               ldb,
+                                             int*              info,
+                                             void*             work)
+{
+    // quick return
+    *info = 0;
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    int  nb    = std::min(nrhs, HIPSOLVER_HOST_BLOCKSIZE);
+    int  nt    = (nrhs - 1) / nb + 1;
+    T*   dA    = (T*)work;
+    T*   dB    = dA + size_t(n) * n;
+    int* dipiv = (int*)(dB + size_t(n) * nrhs);
+
+    hipStream_t stream;
+    ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle, &stream));
+
+    // event 0 marks the upload of the factors, and events 2c + 1 and 2c + 2 the
+    // upload and solution of block c
+    std::shared_ptr<hipsolver_staging> staging = hipsolver_get_staging(handle);
+    hipsolver_staging_guard            guard(*staging);
+    ROCBLAS_RETURN_IF_ERROR(staging->init(stream, sizeof(T) * n, 2 * nt + 1));
+
+    auto upload = [&](int c) {
+        int c0 = c * nb;
+        ROCBLAS_RETURN_IF_ERROR(staging->upload(
+            dB + size_t(n) * c0, n, B + size_t(ldb) * c0, ldb, n, std::min(nb, nrhs - c0)));
+        return staging->record(staging->h2d, 2 * c + 1);
+    };
+
+    ROCBLAS_RETURN_IF_ERROR(staging->upload(dA, n, A, lda, n, n));
+    ROCBLAS_RETURN_IF_ERROR(staging->upload(dipiv, n, ipiv, n, n, 1));
+    ROCBLAS_RETURN_IF_ERROR(staging->record(staging->h2d, 0));
+    ROCBLAS_RETURN_IF_ERROR(upload(0));
+
+    ROCBLAS_RETURN_IF_ERROR(staging->wait(stream, 0));
+    for(int c = 0; c < nt; c++)
+    {
+        int c0 = c * nb;
+        int cb = std::min(nb, nrhs - c0);
+
+        ROCBLAS_RETURN_IF_ERROR(staging->wait(stream, 2 * c + 1));
+        ROCBLAS_RETURN_IF_ERROR(
+            rocsolverCall_getrs(handle, trans, n, cb, dA, n, dipiv, dB + size_t(n) * c0, n));
+        ROCBLAS_RETURN_IF_ERROR(staging->record(stream, 2 * c + 2));
+
+        if(c + 1 < nt)
+            ROCBLAS_RETURN_IF_ERROR(upload(c + 1));
+
+        ROCBLAS_RETURN_IF_ERROR(staging->wait(staging->d2h, 2 * c + 2));
+        ROCBLAS_RETURN_IF_ERROR(
+            staging->download(B + size_t(ldb) * c0, ldb, dB + size_t(n) * c0, n, n, cb));
+    }
+
+    return staging->finish();
+}
+
+/* Batched version of hipsolver_getrs_host_template, with the pivots of problem
+   b at ipiv + b * strideP. */
+template <typename T>
+rocblas_status hipsolver_getrs_batched_host_template(rocblas_handle    handle,
+                                                     rocblas_operation trans,
+                                                     int               n,
+                                                     int               nrhs,
+                                                     T* const          A[],
+                                                     int               lda,
+                                                     const int*        ipiv,
+                                                     int               strideP,
+                                                     T* const          B[],
+                                                     int               ldb,
+                                                     int*              info,
+                                                     int               batch_count,
+                                                     void*             work)
+{
+    // quick return
+    *info = 0;
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    size_t sizeA = size_t(n) * n;
+    size_t sizeB = size_t(n) * nrhs;
+    T*     dA    = (T*)work;
+    T*     dB    = dA + 2 * sizeA;
+    int*   dipiv = (int*)(dB + 2 * sizeB);
+
+    hipStream_t stream;
+    ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle, &stream));
+
+    // events s, 2 + s and 4 + s mark the upload, solution and download of the
+    // last problem in device buffer s
+    std::shared_ptr<hipsolver_staging> staging = hipsolver_get_staging(handle);
+    hipsolver_staging_guard            guard(*staging);
+    ROCBLAS_RETURN_IF_ERROR(staging->init(stream, sizeof(T) * n, 6));
+
+    auto upload = [&](int b) {
+        int s = b % 2;
+        if(b >= 2)
+            ROCBLAS_RETURN_IF_ERROR(staging->wait(staging->h2d, 4 + s));
+        ROCBLAS_RETURN_IF_ERROR(staging->upload(dA + s * sizeA, n, A[b], lda, n, n));
+        ROCBLAS_RETURN_IF_ERROR(
+            staging->upload(dipiv + s * n, n, ipiv + size_t(strideP) * b, n, n, 1));
+        ROCBLAS_RETURN_IF_ERROR(staging->upload(dB + s * sizeB, n, B[b], ldb, n, nrhs));
+        return staging->record(staging->h2d, s);
+    };
+
+    ROCBLAS_RETURN_IF_ERROR(upload(0));
+    for(int b = 0; b < batch_count; b++)
+    {
+        int s = b % 2;
+
+        ROCBLAS_RETURN_IF_ERROR(staging->wait(stream, s));
+        ROCBLAS_RETURN_IF_ERROR(rocsolverCall_getrs(
+            handle, trans, n, nrhs, dA + s * sizeA, n, dipiv + s * n, dB + s * sizeB, n));
+        ROCBLAS_RETURN_IF_ERROR(staging->record(stream, 2 + s));
+
+        if(b + 1 < batch_count)
+            ROCBLAS_RETURN_IF_ERROR(upload(b + 1));
+
+        ROCBLAS_RETURN_IF_ERROR(staging->wait(staging->d2h, 2 + s));
+        ROCBLAS_RETURN_IF_ERROR(staging->download(B[b], ldb, dB + s * sizeB, n, n, nrhs));
+        ROCBLAS_RETURN_IF_ERROR(staging->record(staging->d2h, 4 + s));
+    }
+
+    return staging->finish();
+}
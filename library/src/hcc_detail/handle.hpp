@@ -0,0 +1,157 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "rocblas.h"
+#include "tuning.hpp"
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+
+/*
+ * ===========================================================================
+ *    hipsolverHandle_t is the rocblas_handle itself, so the settings that
+ *    hipSOLVER keeps on top of rocBLAS are stored in a table indexed by the
+ *    handle. Entries are created the first time a setting is changed and are
+ *    removed by hipsolverDestroy; handles without an entry use the defaults.
+ *    The table only maps a handle to its entry, under a reader-writer lock
+ *    that is held exclusively only to add or remove entries; each entry has
+ *    a lock of its own for its settings, so calls on different handles do
+ *    not wait for each other. Resources owned by the handle are kept here as
+ *    shared pointers, so that they are released with the entry.
+ * ===========================================================================
+ */
+
+// workspace of the stream-ordered allocation mode (see async_workspace.hpp)
+class hipsolver_async_workspace;
+
+// pinned buffers and streams of the host-pointer functions (see host_staging.hpp)
+class hipsolver_staging;
+
+// streams and rocBLAS handles of the tiled factorizations (see tile_device.hpp)
+class hipsolver_tile_workers;
+
+// log of devInfo values of the deferred error mode (see error_state.hpp)
+class hipsolver_error_state;
+
+struct hipsolver_handle_settings
+{
+    hipsolverCaptureMode_t capture_mode = HIPSOLVER_CAPTURE_MODE_DEFAULT;
+
+    // set between hipsolverStartCaptureQuery and hipsolverStopCaptureQuery
+    bool capture_query = false;
+    bool capturable    = true;
+
+    hipsolverAllocMode_t alloc_mode = HIPSOLVER_ALLOC_MODE_DEFAULT;
+
+    // set by hipsolverSetTileExecution; tiled factorizations are disabled if 0
+    int tile_streams   = 0;
+    int tile_lookahead = 0;
+
+    // set by hipsolverSetTileBlockSize or a tuning file
+    int tile_blocksize = HIPSOLVER_TILE_BLOCKSIZE;
+
+    hipsolverErrorMode_t error_mode = HIPSOLVER_ERROR_MODE_DEFAULT;
+
+    // set by hipsolverSetHostThreadPool; only stored
+    int                     pool_threads  = 0;
+    hipsolverHostAffinity_t pool_affinity = HIPSOLVER_HOST_AFFINITY_NONE;
+
+    // set by hipsolverSetDispatchMode, hipsolverSetDispatchThreshold or a tuning file
+    hipsolverDispatchMode_t  dispatch_mode = HIPSOLVER_DISPATCH_MODE_DEVICE;
+    hipsolver_dispatch_table dispatch;
+
+    std::shared_ptr<hipsolver_async_workspace> async_workspace;
+    std::shared_ptr<hipsolver_staging>         staging;
+    std::shared_ptr<hipsolver_tile_workers>    tile_workers;
+    std::shared_ptr<hipsolver_error_state>     error_state;
+};
+
+// the settings of one handle, with their lock
+struct hipsolver_handle_entry
+{
+    std::mutex                mutex;
+    hipsolver_handle_settings settings;
+};
+
+inline std::shared_timed_mutex& hipsolver_settings_mutex()
+{
+    static std::shared_timed_mutex mutex;
+    return mutex;
+}
+
+inline std::unordered_map<rocblas_handle, std::shared_ptr<hipsolver_handle_entry>>&
+    hipsolver_settings_table()
+{
+    static std::unordered_map<rocblas_handle, std::shared_ptr<hipsolver_handle_entry>> table;
+    return table;
+}
+
+// returns the entry of handle, or nullptr if none of its settings was changed
+inline std::shared_ptr<hipsolver_handle_entry> hipsolver_find_settings(rocblas_handle handle)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(hipsolver_settings_mutex());
+
+    auto& table = hipsolver_settings_table();
+    auto  it    = table.find(handle);
+    return it != table.end() ? it->second : nullptr;
+}
+
+/* Returns func applied to the settings of handle, under the lock of the handle.
+   func should copy out only the fields that the caller needs. */
+template <typename F>
+auto hipsolver_read_settings(rocblas_handle handle, F func)
+    -> decltype(func(std::declval<const hipsolver_handle_settings&>()))
+{
+    std::shared_ptr<hipsolver_handle_entry> entry = hipsolver_find_settings(handle);
+    if(!entry)
+    {
+        static const hipsolver_handle_settings defaults;
+        return func(defaults);
+    }
+
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    return func(entry->settings);
+}
+
+// applies func to the settings of handle, creating them if needed
+template <typename F>
+void hipsolver_update_settings(rocblas_handle handle, F func)
+{
+    std::shared_ptr<hipsolver_handle_entry> entry = hipsolver_find_settings(handle);
+    if(!entry)
+    {
+        std::lock_guard<std::shared_timed_mutex> lock(hipsolver_settings_mutex());
+
+        std::shared_ptr<hipsolver_handle_entry>& slot = hipsolver_settings_table()[handle];
+        if(!slot)
+            slot = std::make_shared<hipsolver_handle_entry>();
+        entry = slot;
+    }
+
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    func(entry->settings);
+}
+
+inline void hipsolver_erase_settings(rocblas_handle handle)
+{
+    std::shared_ptr<hipsolver_handle_entry> entry;
+    {
+        std::lock_guard<std::shared_timed_mutex> lock(hipsolver_settings_mutex());
+
+        auto& table = hipsolver_settings_table();
+        auto  it    = table.find(handle);
+        if(it == table.end())
+            return;
+        entry = std::move(it->second);
+        table.erase(it);
+    }
+
+    // the resources of the handle are released here, outside of the lock, as
+    // releasing them may wait for the device
+}
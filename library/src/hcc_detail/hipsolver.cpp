@@ -7,6 +7,22 @@
 #include "internal/rocblas_device_malloc.hpp"
 #include "rocblas.h"
 #include "rocsolver.h"
+#include "async_workspace.hpp"
+#include "batch_device.hpp"
+#include "cholqr.hpp"
+#include "compact.hpp"
+#include "completion.hpp"
+#include "error_state.hpp"
+#include "geqp3.hpp"
+#include "geqrf_tsqr.hpp"
+#include "getrf_host.hpp"
+#include "handle.hpp"
+#include "host_engine.hpp"
+#include "mg_device.hpp"
+#include "potrf_ooc.hpp"
+#include "sygvd_pipelined.hpp"
+#include "sytrs.hpp"
+#include "tile_device.hpp"
 #include <algorithm>
 #include <climits>
 #include <functional>
@@ -192,6 +208,7 @@ hipsolverStatus_t rocblas2hip_status(rocblas_status_ error)
     {
     case rocblas_status_size_unchanged:
     case rocblas_status_size_increased:
+    case rocblas_status_continue:
     case rocblas_status_success:
         return HIPSOLVER_STATUS_SUCCESS;
     case rocblas_status_invalid_handle:
@@ -227,22 +244,132 @@ hipsolverStatus_t rocblas2hip_status(rocblas_status_ error)
             return rocblas2hip_status(_status); \
     } while(0)
 
-inline rocblas_status hipsolverManageWorkspace(rocblas_handle handle, int lwork)
+// whether handle is between hipsolverStartCaptureQuery and hipsolverStopCaptureQuery
+inline bool hipsolverCaptureQuery(rocblas_handle handle)
 {
-    if(lwork < 0)
-        return rocblas_status_memory_error;
+    return hipsolver_read_settings(
+        handle, [](const hipsolver_handle_settings& settings) { return settings.capture_query; });
+}
+
+inline void hipsolverMarkNotCapturable(rocblas_handle handle)
+{
+    hipsolver_update_settings(
+        handle, [](hipsolver_handle_settings& settings) { settings.capturable = false; });
+}
+
+/* During a capture query, calls return rocblas_status_continue from here instead
+   of executing, after recording whether they could have been captured. */
+inline rocblas_status hipsolverManageWorkspace(rocblas_handle handle, size_t new_size)
+{
+    bool                   capture_query;
+    hipsolverCaptureMode_t capture_mode;
+    hipsolver_read_settings(handle, [&](const hipsolver_handle_settings& settings) {
+        capture_query = settings.capture_query;
+        capture_mode  = settings.capture_mode;
+    });
+    std::shared_ptr<hipsolver_async_workspace> async = hipsolver_get_async_workspace(handle);
 
-    size_t new_size     = lwork;
     size_t current_size = 0;
-    if(rocblas_is_user_managing_device_memory(handle))
+    if(async)
+        current_size = async->size();
+    else if(rocblas_is_user_managing_device_memory(handle))
         rocblas_get_device_memory_size(handle, &current_size);
 
+    if(capture_query)
+    {
+        if(new_size > current_size)
+            hipsolverMarkNotCapturable(handle);
+        return rocblas_status_continue;
+    }
+
+    // device memory cannot be allocated while the stream is being captured
+    if(new_size > current_size && capture_mode == HIPSOLVER_CAPTURE_MODE_SAFE)
+        return rocblas_status_memory_error;
+
+    if(async)
+    {
+        // the workspace of rocBLAS may have been replaced by a work argument since the last call
+        hipStream_t stream;
+        ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle, &stream));
+        ROCBLAS_RETURN_IF_ERROR(async->reserve(stream, new_size));
+        if(async->size() > 0)
+            return rocblas_set_workspace(handle, async->data(), async->size());
+        return rocblas_status_success;
+    }
+
     if(new_size > current_size)
         return rocblas_set_device_memory_size(handle, new_size);
     else
         return rocblas_status_success;
 }
 
+inline rocblas_status hipsolverManageWorkspace(rocblas_handle handle, int lwork)
+{
+    if(lwork < 0)
+        return rocblas_status_memory_error;
+
+    return hipsolverManageWorkspace(handle, (size_t)lwork);
+}
+
+inline rocblas_status hipsolverSetWorkspace(rocblas_handle handle, void* work, size_t size)
+{
+    // a call given its own workspace does not allocate, so it can always be captured
+    if(hipsolverCaptureQuery(handle))
+        return rocblas_status_continue;
+
+    return rocblas_set_workspace(handle, work, size);
+}
+
+/* Must be called before any work is enqueued by the functions that synchronize
+   the stream to read results back to the host, which cannot be captured. */
+inline rocblas_status hipsolverCheckHostSync(rocblas_handle handle)
+{
+    bool                   capture_query;
+    hipsolverCaptureMode_t capture_mode;
+    hipsolver_read_settings(handle, [&](const hipsolver_handle_settings& settings) {
+        capture_query = settings.capture_query;
+        capture_mode  = settings.capture_mode;
+    });
+    if(capture_query)
+    {
+        hipsolverMarkNotCapturable(handle);
+        return rocblas_status_continue;
+    }
+
+    if(capture_mode == HIPSOLVER_CAPTURE_MODE_SAFE)
+        return rocblas_status_not_implemented;
+
+    return rocblas_status_success;
+}
+
+/* With HIPSOLVER_ERROR_MODE_DEFERRED, appends the count values of devInfo to the
+   error state of handle. Must be called after the call that writes them has been
+   enqueued. */
+inline hipsolverStatus_t hipsolverDeferInfo(rocblas_handle handle, const int* devInfo, int count)
+{
+    if(!devInfo || count <= 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    // the mode, log and capture mode are read together, under a single lock
+    std::shared_ptr<hipsolver_error_state> state;
+    hipsolverCaptureMode_t                 capture_mode;
+    hipsolver_read_settings(handle, [&](const hipsolver_handle_settings& settings) {
+        if(settings.error_mode == HIPSOLVER_ERROR_MODE_DEFERRED)
+            state = settings.error_state;
+        capture_mode = settings.capture_mode;
+    });
+    if(!state)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    // folding a full log synchronizes the stream
+    if(!state->fits(count) && capture_mode == HIPSOLVER_CAPTURE_MODE_SAFE)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    return rocblas2hip_status(state->append(stream, devInfo, count));
+}
+
 /******************** AUXLIARY ********************/
 hipsolverStatus_t hipsolverCreate(hipsolverHandle_t* handle)
 try
@@ -251,7 +378,13 @@ try
         return HIPSOLVER_STATUS_HANDLE_IS_NULLPTR;
 
     // Create the rocBLAS handle
-    return rocblas2hip_status(rocblas_create_handle((rocblas_handle*)handle));
+    CHECK_ROCBLAS_ERROR(rocblas_create_handle((rocblas_handle*)handle));
+
+    // a tuning file that cannot be loaded leaves the defaults, so that the handle is still usable
+    const char* path = hipsolver_tuning_file();
+    if(path)
+        hipsolverLoadTuningFile(*handle, path);
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
@@ -261,6 +394,8 @@ catch(...)
 hipsolverStatus_t hipsolverDestroy(hipsolverHandle_t handle)
 try
 {
+    hipsolver_erase_settings((rocblas_handle)handle);
+
     return rocblas2hip_status(rocblas_destroy_handle((rocblas_handle)handle));
 }
 catch(...)
@@ -274,7 +409,16 @@ try
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    return rocblas2hip_status(rocblas_set_stream((rocblas_handle)handle, streamId));
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream((rocblas_handle)handle, streamId));
+
+    // later uses of the stream-ordered workspace must follow those on the previous stream
+    std::shared_ptr<hipsolver_async_workspace> async = hipsolver_read_settings(
+        (rocblas_handle)handle,
+        [](const hipsolver_handle_settings& settings) { return settings.async_workspace; });
+    if(async)
+        CHECK_ROCBLAS_ERROR(async->rebind(streamId));
+
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
@@ -294,794 +438,7510 @@ catch(...)
     return exception2hip_status();
 }
 
-/******************** ORGBR/UNGBR ********************/
-hipsolverStatus_t hipsolverSorgbr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverSideMode_t side,
-                                             int                 m,
-                                             int                 n,
-                                             int                 k,
-                                             float*              A,
-                                             int                 lda,
-                                             float*              tau,
-                                             int*                lwork)
+/******************** STREAM CAPTURE ********************/
+hipsolverStatus_t hipsolverSetCaptureMode(hipsolverHandle_t handle, hipsolverCaptureMode_t mode)
 try
 {
-    if(lwork == nullptr)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-
-    *lwork = 0;
-    size_t sz;
-
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_sorgbr(
-        (rocblas_handle)handle, hip2rocblas_side2storev(side), m, n, k, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(mode != HIPSOLVER_CAPTURE_MODE_DEFAULT && mode != HIPSOLVER_CAPTURE_MODE_SAFE)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
 
-    *lwork = (int)sz;
-    return status;
+    hipsolver_update_settings((rocblas_handle)handle,
+                              [mode](hipsolver_handle_settings& settings) {
+                                  settings.capture_mode = mode;
+                              });
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDorgbr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverSideMode_t side,
-                                             int                 m,
-                                             int                 n,
-                                             int                 k,
-                                             double*             A,
-                                             int                 lda,
-                                             double*             tau,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverGetCaptureMode(hipsolverHandle_t handle, hipsolverCaptureMode_t* mode)
 try
 {
-    if(lwork == nullptr)
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!mode)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    size_t sz;
-
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dorgbr(
-        (rocblas_handle)handle, hip2rocblas_side2storev(side), m, n, k, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
-
-    *lwork = (int)sz;
-    return status;
+    *mode = hipsolver_read_settings(
+        (rocblas_handle)handle,
+        [](const hipsolver_handle_settings& settings) { return settings.capture_mode; });
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCungbr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverSideMode_t side,
-                                             int                 m,
-                                             int                 n,
-                                             int                 k,
-                                             hipFloatComplex*    A,
-                                             int                 lda,
-                                             hipFloatComplex*    tau,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverReserveWorkspace(hipsolverHandle_t handle, size_t size)
 try
 {
-    if(lwork == nullptr)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    *lwork = 0;
-    size_t sz;
+    // grow the device memory of the handle regardless of the capture mode
+    std::shared_ptr<hipsolver_async_workspace> async
+        = hipsolver_get_async_workspace((rocblas_handle)handle);
+    if(async)
+    {
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream((rocblas_handle)handle, &stream));
+        CHECK_ROCBLAS_ERROR(async->reserve(stream, size));
+        if(async->size() > 0)
+            CHECK_ROCBLAS_ERROR(
+                rocblas_set_workspace((rocblas_handle)handle, async->data(), async->size()));
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cungbr(
-        (rocblas_handle)handle, hip2rocblas_side2storev(side), m, n, k, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    size_t current_size = 0;
+    if(rocblas_is_user_managing_device_memory((rocblas_handle)handle))
+        rocblas_get_device_memory_size((rocblas_handle)handle, &current_size);
+    if(size > current_size)
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size((rocblas_handle)handle, size));
 
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    // make sure the memory is allocated now rather than on first use
+    if(size > 0)
+    {
+        rocblas_device_malloc mem((rocblas_handle)handle, size);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+    }
 
-    *lwork = (int)sz;
-    return status;
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZungbr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverSideMode_t side,
-                                             int                 m,
-                                             int                 n,
-                                             int                 k,
-                                             hipDoubleComplex*   A,
-                                             int                 lda,
-                                             hipDoubleComplex*   tau,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverStartCaptureQuery(hipsolverHandle_t handle)
 try
 {
-    if(lwork == nullptr)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-
-    *lwork = 0;
-    size_t sz;
-
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zungbr(
-        (rocblas_handle)handle, hip2rocblas_side2storev(side), m, n, k, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
 
-    *lwork = (int)sz;
-    return status;
+    bool started = false;
+    hipsolver_update_settings((rocblas_handle)handle,
+                              [&started](hipsolver_handle_settings& settings) {
+                                  if(!settings.capture_query)
+                                  {
+                                      settings.capture_query = true;
+                                      settings.capturable    = true;
+                                      started                = true;
+                                  }
+                              });
+    return started ? HIPSOLVER_STATUS_SUCCESS : HIPSOLVER_STATUS_INVALID_VALUE;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSorgbr(hipsolverHandle_t   handle,
-                                  hipsolverSideMode_t side,
-                                  int                 m,
-                                  int                 n,
-                                  int                 k,
-                                  float*              A,
-                                  int                 lda,
-                                  float*              tau,
-                                  float*              work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverStopCaptureQuery(hipsolverHandle_t handle, int* capturable)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverSorgbr_bufferSize((rocblas_handle)handle, side, m, n, k, A, lda, tau, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!capturable)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return rocblas2hip_status(rocsolver_sorgbr(
-        (rocblas_handle)handle, hip2rocblas_side2storev(side), m, n, k, A, lda, tau));
+    bool stopped = false;
+    hipsolver_update_settings((rocblas_handle)handle,
+                              [&stopped, capturable](hipsolver_handle_settings& settings) {
+                                  if(settings.capture_query)
+                                  {
+                                      *capturable            = settings.capturable ? 1 : 0;
+                                      settings.capture_query = false;
+                                      stopped                = true;
+                                  }
+                              });
+    return stopped ? HIPSOLVER_STATUS_SUCCESS : HIPSOLVER_STATUS_INVALID_VALUE;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDorgbr(hipsolverHandle_t   handle,
-                                  hipsolverSideMode_t side,
-                                  int                 m,
-                                  int                 n,
-                                  int                 k,
-                                  double*             A,
-                                  int                 lda,
-                                  double*             tau,
-                                  double*             work,
-                                  int                 lwork,
-                                  int*                devInfo)
+/******************** WORKSPACE ALLOCATION ********************/
+hipsolverStatus_t hipsolverSetAllocMode(hipsolverHandle_t handle, hipsolverAllocMode_t mode)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverDorgbr_bufferSize((rocblas_handle)handle, side, m, n, k, A, lda, tau, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(mode != HIPSOLVER_ALLOC_MODE_DEFAULT && mode != HIPSOLVER_ALLOC_MODE_STREAM_ORDERED)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(mode == HIPSOLVER_ALLOC_MODE_STREAM_ORDERED && !hipsolver_stream_ordered_alloc_supported())
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
 
-    return rocblas2hip_status(rocsolver_dorgbr(
-        (rocblas_handle)handle, hip2rocblas_side2storev(side), m, n, k, A, lda, tau));
+    std::shared_ptr<hipsolver_async_workspace> released;
+    hipsolver_update_settings((rocblas_handle)handle,
+                              [mode, &released](hipsolver_handle_settings& settings) {
+                                  settings.alloc_mode = mode;
+                                  if(mode == HIPSOLVER_ALLOC_MODE_DEFAULT)
+                                      released = std::move(settings.async_workspace);
+                              });
+
+    // give the workspace back to rocBLAS before the buffer is freed on the stream
+    if(released)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, nullptr, 0));
+
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCungbr(hipsolverHandle_t   handle,
-                                  hipsolverSideMode_t side,
-                                  int                 m,
-                                  int                 n,
-                                  int                 k,
-                                  hipFloatComplex*    A,
-                                  int                 lda,
-                                  hipFloatComplex*    tau,
-                                  hipFloatComplex*    work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverGetAllocMode(hipsolverHandle_t handle, hipsolverAllocMode_t* mode)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverCungbr_bufferSize((rocblas_handle)handle, side, m, n, k, A, lda, tau, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return rocblas2hip_status(rocsolver_cungbr((rocblas_handle)handle,
-                                               hip2rocblas_side2storev(side),
-                                               m,
-                                               n,
-                                               k,
-                                               (rocblas_float_complex*)A,
-                                               lda,
-                                               (rocblas_float_complex*)tau));
+    *mode = hipsolver_read_settings(
+        (rocblas_handle)handle,
+        [](const hipsolver_handle_settings& settings) { return settings.alloc_mode; });
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZungbr(hipsolverHandle_t   handle,
-                                  hipsolverSideMode_t side,
-                                  int                 m,
-                                  int                 n,
-                                  int                 k,
-                                  hipDoubleComplex*   A,
-                                  int                 lda,
-                                  hipDoubleComplex*   tau,
-                                  hipDoubleComplex*   work,
-                                  int                 lwork,
-                                  int*                devInfo)
+/******************** TILED FACTORIZATIONS ********************/
+hipsolverStatus_t hipsolverSetTileExecution(hipsolverHandle_t handle, int nstreams, int lookahead)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverZungbr_bufferSize((rocblas_handle)handle, side, m, n, k, A, lda, tau, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(nstreams < 0 || lookahead < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return rocblas2hip_status(rocsolver_zungbr((rocblas_handle)handle,
-                                               hip2rocblas_side2storev(side),
-                                               m,
-                                               n,
-                                               k,
-                                               (rocblas_double_complex*)A,
-                                               lda,
-                                               (rocblas_double_complex*)tau));
+    hipsolver_update_settings((rocblas_handle)handle,
+                              [nstreams, lookahead](hipsolver_handle_settings& settings) {
+                                  settings.tile_streams   = nstreams;
+                                  settings.tile_lookahead = lookahead;
+                              });
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** ORGQR/UNGQR ********************/
-hipsolverStatus_t hipsolverSorgqr_bufferSize(
-    hipsolverHandle_t handle, int m, int n, int k, float* A, int lda, float* tau, int* lwork)
+hipsolverStatus_t hipsolverGetTileExecution(hipsolverHandle_t handle, int* nstreams, int* lookahead)
 try
 {
-    if(lwork == nullptr)
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!nstreams || !lookahead)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    size_t sz;
-
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_sorgqr((rocblas_handle)handle, m, n, k, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
-
-    *lwork = (int)sz;
-    return status;
+    hipsolver_read_settings((rocblas_handle)handle, [&](const hipsolver_handle_settings& settings) {
+        *nstreams  = settings.tile_streams;
+        *lookahead = settings.tile_lookahead;
+    });
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDorgqr_bufferSize(
-    hipsolverHandle_t handle, int m, int n, int k, double* A, int lda, double* tau, int* lwork)
+hipsolverStatus_t hipsolverSetTileBlockSize(hipsolverHandle_t handle, int nb)
 try
 {
-    if(lwork == nullptr)
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(nb < 1)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    size_t sz;
-
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_dorgqr((rocblas_handle)handle, m, n, k, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
-
-    *lwork = (int)sz;
-    return status;
+    hipsolver_update_settings((rocblas_handle)handle, [nb](hipsolver_handle_settings& settings) {
+        settings.tile_blocksize = nb;
+    });
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCungqr_bufferSize(hipsolverHandle_t handle,
-                                             int               m,
-                                             int               n,
-                                             int               k,
-                                             hipFloatComplex*  A,
-                                             int               lda,
-                                             hipFloatComplex*  tau,
-                                             int*              lwork)
+hipsolverStatus_t hipsolverGetTileBlockSize(hipsolverHandle_t handle, int* nb)
 try
 {
-    if(lwork == nullptr)
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!nb)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    size_t sz;
-
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_cungqr((rocblas_handle)handle, m, n, k, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
-
-    *lwork = (int)sz;
-    return status;
+    *nb = hipsolver_read_settings(
+        (rocblas_handle)handle,
+        [](const hipsolver_handle_settings& settings) { return settings.tile_blocksize; });
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZungqr_bufferSize(hipsolverHandle_t handle,
-                                             int               m,
-                                             int               n,
-                                             int               k,
-                                             hipDoubleComplex* A,
-                                             int               lda,
-                                             hipDoubleComplex* tau,
-                                             int*              lwork)
+/******************** HOST THREAD POOL ********************/
+hipsolverStatus_t hipsolverSetHostThreadPool(hipsolverHandle_t       handle,
+                                             int                     nthreads,
+                                             hipsolverHostAffinity_t affinity)
 try
 {
-    if(lwork == nullptr)
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(nthreads < 0)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-
-    *lwork = 0;
-    size_t sz;
-
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_zungqr((rocblas_handle)handle, m, n, k, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
-
-    *lwork = (int)sz;
-    return status;
+    if(affinity != HIPSOLVER_HOST_AFFINITY_NONE && affinity != HIPSOLVER_HOST_AFFINITY_CLOSE
+       && affinity != HIPSOLVER_HOST_AFFINITY_SPREAD)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    // only stored, as the batched functions compute on the device on this backend
+    hipsolver_update_settings((rocblas_handle)handle,
+                              [nthreads, affinity](hipsolver_handle_settings& settings) {
+                                  settings.pool_threads  = nthreads;
+                                  settings.pool_affinity = affinity;
+                              });
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSorgqr(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  int               k,
-                                  float*            A,
-                                  int               lda,
-                                  float*            tau,
-                                  float*            work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverGetHostThreadPool(hipsolverHandle_t        handle,
+                                             int*                     nthreads,
+                                             hipsolverHostAffinity_t* affinity)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverSorgqr_bufferSize((rocblas_handle)handle, m, n, k, A, lda, tau, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!nthreads || !affinity)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return rocblas2hip_status(rocsolver_sorgqr((rocblas_handle)handle, m, n, k, A, lda, tau));
+    hipsolver_read_settings((rocblas_handle)handle, [&](const hipsolver_handle_settings& settings) {
+        *nthreads = settings.pool_threads;
+        *affinity = settings.pool_affinity;
+    });
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDorgqr(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  int               k,
-                                  double*           A,
-                                  int               lda,
-                                  double*           tau,
-                                  double*           work,
-                                  int               lwork,
-                                  int*              devInfo)
+/******************** DISPATCH ********************/
+hipsolverStatus_t hipsolverSetDispatchMode(hipsolverHandle_t handle, hipsolverDispatchMode_t mode)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverDorgqr_bufferSize((rocblas_handle)handle, m, n, k, A, lda, tau, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(mode != HIPSOLVER_DISPATCH_MODE_DEVICE && mode != HIPSOLVER_DISPATCH_MODE_AUTO)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
 
-    return rocblas2hip_status(rocsolver_dorgqr((rocblas_handle)handle, m, n, k, A, lda, tau));
+    hipsolver_update_settings((rocblas_handle)handle,
+                              [mode](hipsolver_handle_settings& settings) {
+                                  settings.dispatch_mode = mode;
+                              });
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCungqr(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  int               k,
-                                  hipFloatComplex*  A,
-                                  int               lda,
-                                  hipFloatComplex*  tau,
-                                  hipFloatComplex*  work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverGetDispatchMode(hipsolverHandle_t handle, hipsolverDispatchMode_t* mode)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverCungqr_bufferSize((rocblas_handle)handle, m, n, k, A, lda, tau, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return rocblas2hip_status(rocsolver_cungqr((rocblas_handle)handle,
-                                               m,
-                                               n,
-                                               k,
-                                               (rocblas_float_complex*)A,
-                                               lda,
-                                               (rocblas_float_complex*)tau));
+    *mode = hipsolver_read_settings(
+        (rocblas_handle)handle,
+        [](const hipsolver_handle_settings& settings) { return settings.dispatch_mode; });
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZungqr(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  int               k,
-                                  hipDoubleComplex* A,
-                                  int               lda,
-                                  hipDoubleComplex* tau,
-                                  hipDoubleComplex* work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverSetDispatchThreshold(hipsolverHandle_t          handle,
+                                                hipsolverDispatchRoutine_t routine,
+                                                hipsolverPrecision_t       precision,
+                                                int                        n)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverZungqr_bufferSize((rocblas_handle)handle, m, n, k, A, lda, tau, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!hipsolver_dispatch_table::valid(routine, precision))
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(n < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return rocblas2hip_status(rocsolver_zungqr((rocblas_handle)handle,
-                                               m,
-                                               n,
-                                               k,
-                                               (rocblas_double_complex*)A,
-                                               lda,
-                                               (rocblas_double_complex*)tau));
+    hipsolver_update_settings((rocblas_handle)handle,
+                              [routine, precision, n](hipsolver_handle_settings& settings) {
+                                  settings.dispatch.at(routine, precision) = n;
+                              });
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** ORGTR/UNGTR ********************/
-hipsolverStatus_t hipsolverSorgtr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             float*              A,
-                                             int                 lda,
-                                             float*              tau,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverGetDispatchThreshold(hipsolverHandle_t          handle,
+                                                hipsolverDispatchRoutine_t routine,
+                                                hipsolverPrecision_t       precision,
+                                                int*                       n)
 try
 {
-    if(lwork == nullptr)
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!hipsolver_dispatch_table::valid(routine, precision))
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(!n)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    size_t sz;
-
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_sorgtr((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
-
-    *lwork = (int)sz;
-    return status;
+    *n = hipsolver_read_settings((rocblas_handle)handle,
+                                 [=](const hipsolver_handle_settings& settings) {
+                                     return settings.dispatch.at(routine, precision);
+                                 });
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDorgtr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             double*             A,
-                                             int                 lda,
-                                             double*             tau,
-                                             int*                lwork)
+/******************** TUNING ********************/
+hipsolverStatus_t hipsolverLoadTuningFile(hipsolverHandle_t handle, const char* path)
 try
 {
-    if(lwork == nullptr)
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!path)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    size_t sz;
-
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_dorgtr((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
+    hipsolver_tuning tuning;
+    hipsolver_read_settings((rocblas_handle)handle, [&](const hipsolver_handle_settings& settings) {
+        tuning.dispatch       = settings.dispatch;
+        tuning.tile_blocksize = settings.tile_blocksize;
+    });
+    hipsolverStatus_t status = hipsolver_read_tuning(path, &tuning);
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
 
-    *lwork = (int)sz;
-    return status;
+    hipsolver_update_settings((rocblas_handle)handle,
+                              [&tuning](hipsolver_handle_settings& settings) {
+                                  settings.dispatch       = tuning.dispatch;
+                                  settings.tile_blocksize = tuning.tile_blocksize;
+                              });
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCungtr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             hipFloatComplex*    A,
-                                             int                 lda,
-                                             hipFloatComplex*    tau,
-                                             int*                lwork)
+/******************** BATCH QUEUE ********************/
+hipsolverStatus_t
+    hipsolverCreateBatchQueue(hipsolverBatchQueue_t* queue, int maxBatch, int windowUs)
 try
 {
-    if(lwork == nullptr)
+    return rocblas2hip_status(
+        hipsolver_batch_queue_create((hipsolver_batch_context**)queue, maxBatch, windowUs));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDestroyBatchQueue(hipsolverBatchQueue_t queue)
+try
+{
+    if(!queue)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    // the pending requests are dispatched before the queue is released
+    hipsolver_batch_context* context = (hipsolver_batch_context*)queue;
+    delete context;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverBatchQueueFlush(hipsolverBatchQueue_t queue)
+try
+{
+    if(!queue)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    ((hipsolver_batch_context*)queue)->queue->flush();
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverBatchRequestQuery(hipsolverBatchRequest_t request, int* done)
+try
+{
+    if(!request || !done)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    size_t sz;
+    *done = ((hipsolver_batch_request*)request)->query() ? 1 : 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_cungtr((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+hipsolverStatus_t hipsolverBatchRequestWait(hipsolverBatchRequest_t request, int* info)
+try
+{
+    if(!request || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    // the request is released once it is done
+    std::unique_ptr<hipsolver_batch_request> req((hipsolver_batch_request*)request);
+    return rocblas2hip_status(req->wait(info));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
 
-    *lwork = (int)sz;
-    return status;
+/******************** COMPLETION ********************/
+hipsolverStatus_t hipsolverCreateCompletion(hipsolverCompletion_t* completion)
+try
+{
+    if(!completion)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *completion = new hipsolver_completion;
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZungtr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             hipDoubleComplex*   A,
-                                             int                 lda,
-                                             hipDoubleComplex*   tau,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverDestroyCompletion(hipsolverCompletion_t completion)
 try
 {
-    if(lwork == nullptr)
+    if(!completion)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    // waits for the last recording, so it cannot be called from the callback
+    hipsolver_completion* c = (hipsolver_completion*)completion;
+    delete c;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSetCompletionCallback(hipsolverCompletion_t         completion,
+                                                 hipsolverCompletionCallback_t callback,
+                                                 void*                         userData)
+try
+{
+    if(!completion)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    ((hipsolver_completion*)completion)->set_callback(callback, userData);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverRecordCompletion(hipsolverHandle_t     handle,
+                                            const int*            devInfo,
+                                            int                   count,
+                                            hipsolverCompletion_t completion)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!completion || count < 0 || (count > 0 && !devInfo))
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    *lwork = 0;
-    size_t sz;
+    hipsolver_completion* c = (hipsolver_completion*)completion;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_zungtr((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    // host callbacks cannot be captured
+    if(c->has_callback())
+        CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    else if(hipsolverCaptureQuery((rocblas_handle)handle))
+        return HIPSOLVER_STATUS_SUCCESS;
 
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream((rocblas_handle)handle, &stream));
+    return rocblas2hip_status(c->record(stream, devInfo, count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
 
-    *lwork = (int)sz;
-    return status;
+hipsolverStatus_t hipsolverQueryCompletion(hipsolverCompletion_t completion, int* done, int* info)
+try
+{
+    if(!completion || !done)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    bool finished;
+    CHECK_ROCBLAS_ERROR(((hipsolver_completion*)completion)->query(&finished, info));
+    *done = finished ? 1 : 0;
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSorgtr(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  float*              A,
-                                  int                 lda,
-                                  float*              tau,
-                                  float*              work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverWaitCompletion(hipsolverCompletion_t completion, int* info)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverSorgtr_bufferSize((rocblas_handle)handle, uplo, n, A, lda, tau, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    if(!completion)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return rocblas2hip_status(
-        rocsolver_sorgtr((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, tau));
+    return rocblas2hip_status(((hipsolver_completion*)completion)->wait(info));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDorgtr(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  double*             A,
-                                  int                 lda,
-                                  double*             tau,
-                                  double*             work,
-                                  int                 lwork,
-                                  int*                devInfo)
+/******************** DEFERRED ERRORS ********************/
+hipsolverStatus_t hipsolverSetErrorMode(hipsolverHandle_t handle, hipsolverErrorMode_t mode)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(mode != HIPSOLVER_ERROR_MODE_DEFAULT && mode != HIPSOLVER_ERROR_MODE_DEFERRED)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    // the log is allocated here, so that the calls never allocate it
+    std::shared_ptr<hipsolver_error_state> state;
+    if(mode == HIPSOLVER_ERROR_MODE_DEFERRED
+       && !hipsolver_read_settings(
+           (rocblas_handle)handle,
+           [](const hipsolver_handle_settings& settings) { return bool(settings.error_state); }))
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverDorgtr_bufferSize((rocblas_handle)handle, uplo, n, A, lda, tau, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+        state = std::make_shared<hipsolver_error_state>();
+        CHECK_ROCBLAS_ERROR(state->init());
     }
 
-    return rocblas2hip_status(
-        rocsolver_dorgtr((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, tau));
+    hipsolver_update_settings((rocblas_handle)handle,
+                              [mode, &state](hipsolver_handle_settings& settings) {
+                                  settings.error_mode = mode;
+                                  if(mode == HIPSOLVER_ERROR_MODE_DEFAULT)
+                                      state = std::move(settings.error_state);
+                                  else if(!settings.error_state)
+                                      settings.error_state = std::move(state);
+                              });
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetErrorMode(hipsolverHandle_t handle, hipsolverErrorMode_t* mode)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *mode = hipsolver_read_settings(
+        (rocblas_handle)handle,
+        [](const hipsolver_handle_settings& settings) { return settings.error_mode; });
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetErrorState(hipsolverHandle_t handle, int* state)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!state)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    std::shared_ptr<hipsolver_error_state> error_state
+        = hipsolver_get_error_state((rocblas_handle)handle);
+    if(!error_state)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    return rocblas2hip_status(error_state->get(state));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverResetErrorState(hipsolverHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    std::shared_ptr<hipsolver_error_state> error_state
+        = hipsolver_get_error_state((rocblas_handle)handle);
+    if(!error_state)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    error_state->reset();
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** MULTI-DEVICE ********************/
+hipsolverStatus_t hipsolverMgCreate(hipsolverMgHandle_t* handle)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *handle = new hipsolver_mg_handle;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgDestroy(hipsolverMgHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    hipsolver_mg_handle* h = (hipsolver_mg_handle*)handle;
+    delete h;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t
+    hipsolverMgDeviceSelect(hipsolverMgHandle_t handle, int nbDevices, const int deviceId[])
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return rocblas2hip_status(((hipsolver_mg_handle*)handle)->select(nbDevices, deviceId));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgCreateDeviceGrid(hipsolverMgGrid_t*       grid,
+                                              int                      numRowDevices,
+                                              int                      numColDevices,
+                                              const int                deviceId[],
+                                              hipsolverMgGridMapping_t mapping)
+try
+{
+    if(!grid || !deviceId)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(mapping != HIPSOLVER_MG_GRID_MAPPING_ROW_MAJOR
+       && mapping != HIPSOLVER_MG_GRID_MAPPING_COL_MAJOR)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    // the columns are distributed over a single row of devices
+    if(numRowDevices != 1)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    if(numColDevices < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_mg_grid* g = new hipsolver_mg_grid;
+    g->devices.assign(deviceId, deviceId + numColDevices);
+    *grid = g;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgDestroyGrid(hipsolverMgGrid_t grid)
+try
+{
+    if(!grid)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    hipsolver_mg_grid* g = (hipsolver_mg_grid*)grid;
+    delete g;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgCreateMatrixDesc(hipsolverMgMatrixDesc_t* desc,
+                                              int                      numRows,
+                                              int                      numCols,
+                                              int                      rowBlockSize,
+                                              int                      colBlockSize,
+                                              hipsolverMgGrid_t        grid)
+try
+{
+    if(!desc)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!grid)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(numRows < 0 || numCols < 0 || rowBlockSize < 1 || colBlockSize < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the rows are not distributed, so rowBlockSize does not change the layout
+    hipsolver_mg_desc* d = new hipsolver_mg_desc;
+    d->rows              = numRows;
+    d->cols              = numCols;
+    d->col_block         = colBlockSize;
+    d->devices           = ((hipsolver_mg_grid*)grid)->devices;
+    *desc                = d;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgDestroyMatrixDesc(hipsolverMgMatrixDesc_t desc)
+try
+{
+    if(!desc)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    hipsolver_mg_desc* d = (hipsolver_mg_desc*)desc;
+    delete d;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** ORGBR/UNGBR ********************/
+hipsolverStatus_t hipsolverSorgbr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              tau,
+                                             int*                lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_sorgbr(
+        (rocblas_handle)handle, hip2rocblas_side2storev(side), m, n, k, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDorgbr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             tau,
+                                             int*                lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dorgbr(
+        (rocblas_handle)handle, hip2rocblas_side2storev(side), m, n, k, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungbr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             hipFloatComplex*    tau,
+                                             int*                lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cungbr(
+        (rocblas_handle)handle, hip2rocblas_side2storev(side), m, n, k, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungbr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             hipDoubleComplex*   tau,
+                                             int*                lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zungbr(
+        (rocblas_handle)handle, hip2rocblas_side2storev(side), m, n, k, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSorgbr(hipsolverHandle_t   handle,
+                                  hipsolverSideMode_t side,
+                                  int                 m,
+                                  int                 n,
+                                  int                 k,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              tau,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverSorgbr_bufferSize((rocblas_handle)handle, side, m, n, k, A, lda, tau, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_sorgbr(
+        (rocblas_handle)handle, hip2rocblas_side2storev(side), m, n, k, A, lda, tau));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDorgbr(hipsolverHandle_t   handle,
+                                  hipsolverSideMode_t side,
+                                  int                 m,
+                                  int                 n,
+                                  int                 k,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             tau,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverDorgbr_bufferSize((rocblas_handle)handle, side, m, n, k, A, lda, tau, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_dorgbr(
+        (rocblas_handle)handle, hip2rocblas_side2storev(side), m, n, k, A, lda, tau));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungbr(hipsolverHandle_t   handle,
+                                  hipsolverSideMode_t side,
+                                  int                 m,
+                                  int                 n,
+                                  int                 k,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    tau,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverCungbr_bufferSize((rocblas_handle)handle, side, m, n, k, A, lda, tau, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_cungbr((rocblas_handle)handle,
+                                               hip2rocblas_side2storev(side),
+                                               m,
+                                               n,
+                                               k,
+                                               (rocblas_float_complex*)A,
+                                               lda,
+                                               (rocblas_float_complex*)tau));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungbr(hipsolverHandle_t   handle,
+                                  hipsolverSideMode_t side,
+                                  int                 m,
+                                  int                 n,
+                                  int                 k,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   tau,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverZungbr_bufferSize((rocblas_handle)handle, side, m, n, k, A, lda, tau, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_zungbr((rocblas_handle)handle,
+                                               hip2rocblas_side2storev(side),
+                                               m,
+                                               n,
+                                               k,
+                                               (rocblas_double_complex*)A,
+                                               lda,
+                                               (rocblas_double_complex*)tau));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** ORGQR/UNGQR ********************/
+hipsolverStatus_t hipsolverSorgqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, int k, float* A, int lda, float* tau, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_sorgqr((rocblas_handle)handle, m, n, k, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDorgqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, int k, double* A, int lda, double* tau, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_dorgqr((rocblas_handle)handle, m, n, k, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungqr_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               k,
+                                             hipFloatComplex*  A,
+                                             int               lda,
+                                             hipFloatComplex*  tau,
+                                             int*              lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_cungqr((rocblas_handle)handle, m, n, k, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungqr_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               k,
+                                             hipDoubleComplex* A,
+                                             int               lda,
+                                             hipDoubleComplex* tau,
+                                             int*              lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_zungqr((rocblas_handle)handle, m, n, k, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSorgqr(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  float*            A,
+                                  int               lda,
+                                  float*            tau,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverSorgqr_bufferSize((rocblas_handle)handle, m, n, k, A, lda, tau, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_sorgqr((rocblas_handle)handle, m, n, k, A, lda, tau));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDorgqr(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  double*           A,
+                                  int               lda,
+                                  double*           tau,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverDorgqr_bufferSize((rocblas_handle)handle, m, n, k, A, lda, tau, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_dorgqr((rocblas_handle)handle, m, n, k, A, lda, tau));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungqr(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  hipFloatComplex*  tau,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverCungqr_bufferSize((rocblas_handle)handle, m, n, k, A, lda, tau, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_cungqr((rocblas_handle)handle,
+                                               m,
+                                               n,
+                                               k,
+                                               (rocblas_float_complex*)A,
+                                               lda,
+                                               (rocblas_float_complex*)tau));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungqr(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  hipDoubleComplex* tau,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverZungqr_bufferSize((rocblas_handle)handle, m, n, k, A, lda, tau, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_zungqr((rocblas_handle)handle,
+                                               m,
+                                               n,
+                                               k,
+                                               (rocblas_double_complex*)A,
+                                               lda,
+                                               (rocblas_double_complex*)tau));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** ORGTR/UNGTR ********************/
+hipsolverStatus_t hipsolverSorgtr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              tau,
+                                             int*                lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_sorgtr((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDorgtr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             tau,
+                                             int*                lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_dorgtr((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungtr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             hipFloatComplex*    tau,
+                                             int*                lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_cungtr((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungtr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             hipDoubleComplex*   tau,
+                                             int*                lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_zungtr((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSorgtr(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              tau,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverSorgtr_bufferSize((rocblas_handle)handle, uplo, n, A, lda, tau, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(
+        rocsolver_sorgtr((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, tau));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDorgtr(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             tau,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverDorgtr_bufferSize((rocblas_handle)handle, uplo, n, A, lda, tau, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(
+        rocsolver_dorgtr((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, tau));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungtr(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    tau,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverCungtr_bufferSize((rocblas_handle)handle, uplo, n, A, lda, tau, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_cungtr((rocblas_handle)handle,
+                                               hip2rocblas_fill(uplo),
+                                               n,
+                                               (rocblas_float_complex*)A,
+                                               lda,
+                                               (rocblas_float_complex*)tau));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungtr(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   tau,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverZungtr_bufferSize((rocblas_handle)handle, uplo, n, A, lda, tau, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_zungtr((rocblas_handle)handle,
+                                               hip2rocblas_fill(uplo),
+                                               n,
+                                               (rocblas_double_complex*)A,
+                                               lda,
+                                               (rocblas_double_complex*)tau));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** ORMQR/UNMQR ********************/
+hipsolverStatus_t hipsolverSormqr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             float*               A,
+                                             int                  lda,
+                                             float*               tau,
+                                             float*               C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_sormqr((rocblas_handle)handle,
+                                                                   hip2rocblas_side(side),
+                                                                   hip2rocblas_operation(trans),
+                                                                   m,
+                                                                   n,
+                                                                   k,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   ldc));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDormqr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             double*              A,
+                                             int                  lda,
+                                             double*              tau,
+                                             double*              C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dormqr((rocblas_handle)handle,
+                                                                   hip2rocblas_side(side),
+                                                                   hip2rocblas_operation(trans),
+                                                                   m,
+                                                                   n,
+                                                                   k,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   ldc));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCunmqr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             hipFloatComplex*     tau,
+                                             hipFloatComplex*     C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cunmqr((rocblas_handle)handle,
+                                                                   hip2rocblas_side(side),
+                                                                   hip2rocblas_operation(trans),
+                                                                   m,
+                                                                   n,
+                                                                   k,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   ldc));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZunmqr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             hipDoubleComplex*    tau,
+                                             hipDoubleComplex*    C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zunmqr((rocblas_handle)handle,
+                                                                   hip2rocblas_side(side),
+                                                                   hip2rocblas_operation(trans),
+                                                                   m,
+                                                                   n,
+                                                                   k,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   ldc));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSormqr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  int                  k,
+                                  float*               A,
+                                  int                  lda,
+                                  float*               tau,
+                                  float*               C,
+                                  int                  ldc,
+                                  float*               work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSormqr_bufferSize(
+            (rocblas_handle)handle, side, trans, m, n, k, A, lda, tau, C, ldc, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_sormqr((rocblas_handle)handle,
+                                               hip2rocblas_side(side),
+                                               hip2rocblas_operation(trans),
+                                               m,
+                                               n,
+                                               k,
+                                               A,
+                                               lda,
+                                               tau,
+                                               C,
+                                               ldc));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDormqr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  int                  k,
+                                  double*              A,
+                                  int                  lda,
+                                  double*              tau,
+                                  double*              C,
+                                  int                  ldc,
+                                  double*              work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDormqr_bufferSize(
+            (rocblas_handle)handle, side, trans, m, n, k, A, lda, tau, C, ldc, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_dormqr((rocblas_handle)handle,
+                                               hip2rocblas_side(side),
+                                               hip2rocblas_operation(trans),
+                                               m,
+                                               n,
+                                               k,
+                                               A,
+                                               lda,
+                                               tau,
+                                               C,
+                                               ldc));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCunmqr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  int                  k,
+                                  hipFloatComplex*     A,
+                                  int                  lda,
+                                  hipFloatComplex*     tau,
+                                  hipFloatComplex*     C,
+                                  int                  ldc,
+                                  hipFloatComplex*     work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCunmqr_bufferSize(
+            (rocblas_handle)handle, side, trans, m, n, k, A, lda, tau, C, ldc, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_cunmqr((rocblas_handle)handle,
+                                               hip2rocblas_side(side),
+                                               hip2rocblas_operation(trans),
+                                               m,
+                                               n,
+                                               k,
+                                               (rocblas_float_complex*)A,
+                                               lda,
+                                               (rocblas_float_complex*)tau,
+                                               (rocblas_float_complex*)C,
+                                               ldc));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZunmqr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  int                  k,
+                                  hipDoubleComplex*    A,
+                                  int                  lda,
+                                  hipDoubleComplex*    tau,
+                                  hipDoubleComplex*    C,
+                                  int                  ldc,
+                                  hipDoubleComplex*    work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZunmqr_bufferSize(
+            (rocblas_handle)handle, side, trans, m, n, k, A, lda, tau, C, ldc, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_zunmqr((rocblas_handle)handle,
+                                               hip2rocblas_side(side),
+                                               hip2rocblas_operation(trans),
+                                               m,
+                                               n,
+                                               k,
+                                               (rocblas_double_complex*)A,
+                                               lda,
+                                               (rocblas_double_complex*)tau,
+                                               (rocblas_double_complex*)C,
+                                               ldc));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** ORMTR/UNMTR ********************/
+hipsolverStatus_t hipsolverSormtr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverFillMode_t  uplo,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             float*               A,
+                                             int                  lda,
+                                             float*               tau,
+                                             float*               C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_sormtr((rocblas_handle)handle,
+                                                                   hip2rocblas_side(side),
+                                                                   hip2rocblas_fill(uplo),
+                                                                   hip2rocblas_operation(trans),
+                                                                   m,
+                                                                   n,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   ldc));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDormtr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverFillMode_t  uplo,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             double*              A,
+                                             int                  lda,
+                                             double*              tau,
+                                             double*              C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dormtr((rocblas_handle)handle,
+                                                                   hip2rocblas_side(side),
+                                                                   hip2rocblas_fill(uplo),
+                                                                   hip2rocblas_operation(trans),
+                                                                   m,
+                                                                   n,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   ldc));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCunmtr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverFillMode_t  uplo,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             hipFloatComplex*     tau,
+                                             hipFloatComplex*     C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cunmtr((rocblas_handle)handle,
+                                                                   hip2rocblas_side(side),
+                                                                   hip2rocblas_fill(uplo),
+                                                                   hip2rocblas_operation(trans),
+                                                                   m,
+                                                                   n,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   ldc));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZunmtr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverFillMode_t  uplo,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             hipDoubleComplex*    tau,
+                                             hipDoubleComplex*    C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zunmtr((rocblas_handle)handle,
+                                                                   hip2rocblas_side(side),
+                                                                   hip2rocblas_fill(uplo),
+                                                                   hip2rocblas_operation(trans),
+                                                                   m,
+                                                                   n,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   ldc));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSormtr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverFillMode_t  uplo,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  float*               A,
+                                  int                  lda,
+                                  float*               tau,
+                                  float*               C,
+                                  int                  ldc,
+                                  float*               work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSormtr_bufferSize(
+            (rocblas_handle)handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_sormtr((rocblas_handle)handle,
+                                               hip2rocblas_side(side),
+                                               hip2rocblas_fill(uplo),
+                                               hip2rocblas_operation(trans),
+                                               m,
+                                               n,
+                                               A,
+                                               lda,
+                                               tau,
+                                               C,
+                                               ldc));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDormtr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverFillMode_t  uplo,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  double*              A,
+                                  int                  lda,
+                                  double*              tau,
+                                  double*              C,
+                                  int                  ldc,
+                                  double*              work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDormtr_bufferSize(
+            (rocblas_handle)handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_dormtr((rocblas_handle)handle,
+                                               hip2rocblas_side(side),
+                                               hip2rocblas_fill(uplo),
+                                               hip2rocblas_operation(trans),
+                                               m,
+                                               n,
+                                               A,
+                                               lda,
+                                               tau,
+                                               C,
+                                               ldc));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCunmtr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverFillMode_t  uplo,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  hipFloatComplex*     A,
+                                  int                  lda,
+                                  hipFloatComplex*     tau,
+                                  hipFloatComplex*     C,
+                                  int                  ldc,
+                                  hipFloatComplex*     work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCunmtr_bufferSize(
+            (rocblas_handle)handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_cunmtr((rocblas_handle)handle,
+                                               hip2rocblas_side(side),
+                                               hip2rocblas_fill(uplo),
+                                               hip2rocblas_operation(trans),
+                                               m,
+                                               n,
+                                               (rocblas_float_complex*)A,
+                                               lda,
+                                               (rocblas_float_complex*)tau,
+                                               (rocblas_float_complex*)C,
+                                               ldc));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZunmtr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverFillMode_t  uplo,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  hipDoubleComplex*    A,
+                                  int                  lda,
+                                  hipDoubleComplex*    tau,
+                                  hipDoubleComplex*    C,
+                                  int                  ldc,
+                                  hipDoubleComplex*    work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZunmtr_bufferSize(
+            (rocblas_handle)handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_zunmtr((rocblas_handle)handle,
+                                               hip2rocblas_side(side),
+                                               hip2rocblas_fill(uplo),
+                                               hip2rocblas_operation(trans),
+                                               m,
+                                               n,
+                                               (rocblas_double_complex*)A,
+                                               lda,
+                                               (rocblas_double_complex*)tau,
+                                               (rocblas_double_complex*)C,
+                                               ldc));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** CHOLQR2 ********************/
+hipsolverStatus_t hipsolverScholqr2_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, float* R, int ldr, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_cholqr_bufferSize_template<float>(
+        (rocblas_handle)handle, m, n, lda, ldr, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDcholqr2_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, double* R, int ldr, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_cholqr_bufferSize_template<double>(
+        (rocblas_handle)handle, m, n, lda, ldr, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCcholqr2_bufferSize(hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               hipFloatComplex*  A,
+                                               int               lda,
+                                               hipFloatComplex*  R,
+                                               int               ldr,
+                                               int*              lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_cholqr_bufferSize_template<rocblas_float_complex>(
+            (rocblas_handle)handle, m, n, lda, ldr, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZcholqr2_bufferSize(hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               hipDoubleComplex* A,
+                                               int               lda,
+                                               hipDoubleComplex* R,
+                                               int               ldr,
+                                               int*              lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_cholqr_bufferSize_template<rocblas_double_complex>(
+            (rocblas_handle)handle, m, n, lda, ldr, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverScholqr2(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    float*            A,
+                                    int               lda,
+                                    float*            R,
+                                    int               ldr,
+                                    float*            work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    size_t size_cholqr = hipsolver_cholqr_worksize<float>(n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_cholqr)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_cholqr, lwork - size_cholqr));
+        CHECK_ROCBLAS_ERROR(hipsolver_cholqr_template(
+            (rocblas_handle)handle, false, m, n, A, lda, R, ldr, devInfo, (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverScholqr2_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, R, ldr, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_cholqr);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_cholqr_template(
+            (rocblas_handle)handle, false, m, n, A, lda, R, ldr, devInfo, mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDcholqr2(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    double*           A,
+                                    int               lda,
+                                    double*           R,
+                                    int               ldr,
+                                    double*           work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    size_t size_cholqr = hipsolver_cholqr_worksize<double>(n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_cholqr)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_cholqr, lwork - size_cholqr));
+        CHECK_ROCBLAS_ERROR(hipsolver_cholqr_template(
+            (rocblas_handle)handle, false, m, n, A, lda, R, ldr, devInfo, (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDcholqr2_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, R, ldr, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_cholqr);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_cholqr_template(
+            (rocblas_handle)handle, false, m, n, A, lda, R, ldr, devInfo, mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCcholqr2(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    hipFloatComplex*  A,
+                                    int               lda,
+                                    hipFloatComplex*  R,
+                                    int               ldr,
+                                    hipFloatComplex*  work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    size_t size_cholqr = hipsolver_cholqr_worksize<rocblas_float_complex>(n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_cholqr)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_cholqr, lwork - size_cholqr));
+        CHECK_ROCBLAS_ERROR(hipsolver_cholqr_template((rocblas_handle)handle,
+                                                      false,
+                                                      m,
+                                                      n,
+                                                      (rocblas_float_complex*)A,
+                                                      lda,
+                                                      (rocblas_float_complex*)R,
+                                                      ldr,
+                                                      devInfo,
+                                                      (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCcholqr2_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, R, ldr, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_cholqr);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_cholqr_template((rocblas_handle)handle,
+                                                      false,
+                                                      m,
+                                                      n,
+                                                      (rocblas_float_complex*)A,
+                                                      lda,
+                                                      (rocblas_float_complex*)R,
+                                                      ldr,
+                                                      devInfo,
+                                                      mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZcholqr2(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    hipDoubleComplex* A,
+                                    int               lda,
+                                    hipDoubleComplex* R,
+                                    int               ldr,
+                                    hipDoubleComplex* work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    size_t size_cholqr = hipsolver_cholqr_worksize<rocblas_double_complex>(n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_cholqr)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_cholqr, lwork - size_cholqr));
+        CHECK_ROCBLAS_ERROR(hipsolver_cholqr_template((rocblas_handle)handle,
+                                                      false,
+                                                      m,
+                                                      n,
+                                                      (rocblas_double_complex*)A,
+                                                      lda,
+                                                      (rocblas_double_complex*)R,
+                                                      ldr,
+                                                      devInfo,
+                                                      (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZcholqr2_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, R, ldr, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_cholqr);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_cholqr_template((rocblas_handle)handle,
+                                                      false,
+                                                      m,
+                                                      n,
+                                                      (rocblas_double_complex*)A,
+                                                      lda,
+                                                      (rocblas_double_complex*)R,
+                                                      ldr,
+                                                      devInfo,
+                                                      mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** CHOLQR3 ********************/
+hipsolverStatus_t hipsolverScholqr3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, float* R, int ldr, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_cholqr_bufferSize_template<float>(
+        (rocblas_handle)handle, m, n, lda, ldr, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDcholqr3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, double* R, int ldr, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_cholqr_bufferSize_template<double>(
+        (rocblas_handle)handle, m, n, lda, ldr, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCcholqr3_bufferSize(hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               hipFloatComplex*  A,
+                                               int               lda,
+                                               hipFloatComplex*  R,
+                                               int               ldr,
+                                               int*              lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_cholqr_bufferSize_template<rocblas_float_complex>(
+            (rocblas_handle)handle, m, n, lda, ldr, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZcholqr3_bufferSize(hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               hipDoubleComplex* A,
+                                               int               lda,
+                                               hipDoubleComplex* R,
+                                               int               ldr,
+                                               int*              lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_cholqr_bufferSize_template<rocblas_double_complex>(
+            (rocblas_handle)handle, m, n, lda, ldr, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverScholqr3(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    float*            A,
+                                    int               lda,
+                                    float*            R,
+                                    int               ldr,
+                                    float*            work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
+    size_t size_cholqr = hipsolver_cholqr_worksize<float>(n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_cholqr)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_cholqr, lwork - size_cholqr));
+        CHECK_ROCBLAS_ERROR(hipsolver_cholqr_template(
+            (rocblas_handle)handle, true, m, n, A, lda, R, ldr, devInfo, (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverScholqr3_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, R, ldr, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_cholqr);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_cholqr_template(
+            (rocblas_handle)handle, true, m, n, A, lda, R, ldr, devInfo, mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDcholqr3(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    double*           A,
+                                    int               lda,
+                                    double*           R,
+                                    int               ldr,
+                                    double*           work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
+    size_t size_cholqr = hipsolver_cholqr_worksize<double>(n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_cholqr)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_cholqr, lwork - size_cholqr));
+        CHECK_ROCBLAS_ERROR(hipsolver_cholqr_template(
+            (rocblas_handle)handle, true, m, n, A, lda, R, ldr, devInfo, (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDcholqr3_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, R, ldr, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_cholqr);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_cholqr_template(
+            (rocblas_handle)handle, true, m, n, A, lda, R, ldr, devInfo, mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCcholqr3(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    hipFloatComplex*  A,
+                                    int               lda,
+                                    hipFloatComplex*  R,
+                                    int               ldr,
+                                    hipFloatComplex*  work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
+    size_t size_cholqr = hipsolver_cholqr_worksize<rocblas_float_complex>(n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_cholqr)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_cholqr, lwork - size_cholqr));
+        CHECK_ROCBLAS_ERROR(hipsolver_cholqr_template((rocblas_handle)handle,
+                                                      true,
+                                                      m,
+                                                      n,
+                                                      (rocblas_float_complex*)A,
+                                                      lda,
+                                                      (rocblas_float_complex*)R,
+                                                      ldr,
+                                                      devInfo,
+                                                      (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCcholqr3_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, R, ldr, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_cholqr);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_cholqr_template((rocblas_handle)handle,
+                                                      true,
+                                                      m,
+                                                      n,
+                                                      (rocblas_float_complex*)A,
+                                                      lda,
+                                                      (rocblas_float_complex*)R,
+                                                      ldr,
+                                                      devInfo,
+                                                      mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZcholqr3(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    hipDoubleComplex* A,
+                                    int               lda,
+                                    hipDoubleComplex* R,
+                                    int               ldr,
+                                    hipDoubleComplex* work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
+    size_t size_cholqr = hipsolver_cholqr_worksize<rocblas_double_complex>(n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_cholqr)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_cholqr, lwork - size_cholqr));
+        CHECK_ROCBLAS_ERROR(hipsolver_cholqr_template((rocblas_handle)handle,
+                                                      true,
+                                                      m,
+                                                      n,
+                                                      (rocblas_double_complex*)A,
+                                                      lda,
+                                                      (rocblas_double_complex*)R,
+                                                      ldr,
+                                                      devInfo,
+                                                      (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZcholqr3_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, R, ldr, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_cholqr);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_cholqr_template((rocblas_handle)handle,
+                                                      true,
+                                                      m,
+                                                      n,
+                                                      (rocblas_double_complex*)A,
+                                                      lda,
+                                                      (rocblas_double_complex*)R,
+                                                      ldr,
+                                                      devInfo,
+                                                      mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GEBRD ********************/
+hipsolverStatus_t hipsolverSgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_sgebrd(
+        (rocblas_handle)handle, m, n, nullptr, m, nullptr, nullptr, nullptr, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dgebrd(
+        (rocblas_handle)handle, m, n, nullptr, m, nullptr, nullptr, nullptr, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cgebrd(
+        (rocblas_handle)handle, m, n, nullptr, m, nullptr, nullptr, nullptr, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zgebrd(
+        (rocblas_handle)handle, m, n, nullptr, m, nullptr, nullptr, nullptr, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgebrd(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  float*            D,
+                                  float*            E,
+                                  float*            tauq,
+                                  float*            taup,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSgebrd_bufferSize((rocblas_handle)handle, m, n, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(
+        rocsolver_sgebrd((rocblas_handle)handle, m, n, A, lda, D, E, tauq, taup));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgebrd(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  double*           D,
+                                  double*           E,
+                                  double*           tauq,
+                                  double*           taup,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDgebrd_bufferSize((rocblas_handle)handle, m, n, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(
+        rocsolver_dgebrd((rocblas_handle)handle, m, n, A, lda, D, E, tauq, taup));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgebrd(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  float*            D,
+                                  float*            E,
+                                  hipFloatComplex*  tauq,
+                                  hipFloatComplex*  taup,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCgebrd_bufferSize((rocblas_handle)handle, m, n, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_cgebrd((rocblas_handle)handle,
+                                               m,
+                                               n,
+                                               (rocblas_float_complex*)A,
+                                               lda,
+                                               D,
+                                               E,
+                                               (rocblas_float_complex*)tauq,
+                                               (rocblas_float_complex*)taup));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgebrd(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  double*           D,
+                                  double*           E,
+                                  hipDoubleComplex* tauq,
+                                  hipDoubleComplex* taup,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZgebrd_bufferSize((rocblas_handle)handle, m, n, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_zgebrd((rocblas_handle)handle,
+                                               m,
+                                               n,
+                                               (rocblas_double_complex*)A,
+                                               lda,
+                                               D,
+                                               E,
+                                               (rocblas_double_complex*)tauq,
+                                               (rocblas_double_complex*)taup));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GELS ********************/
+hipsolverStatus_t hipsolverSSgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             float*            A,
+                                             int               lda,
+                                             float*            B,
+                                             int               ldb,
+                                             float*            X,
+                                             int               ldx,
+                                             size_t*           lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_sgels((rocblas_handle)handle,
+                                                                  rocblas_operation_none,
+                                                                  m,
+                                                                  n,
+                                                                  nrhs,
+                                                                  nullptr,
+                                                                  lda,
+                                                                  nullptr,
+                                                                  ldb,
+                                                                  nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    *lwork = sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDDgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             double*           A,
+                                             int               lda,
+                                             double*           B,
+                                             int               ldb,
+                                             double*           X,
+                                             int               ldx,
+                                             size_t*           lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dgels((rocblas_handle)handle,
+                                                                  rocblas_operation_none,
+                                                                  m,
+                                                                  n,
+                                                                  nrhs,
+                                                                  nullptr,
+                                                                  lda,
+                                                                  nullptr,
+                                                                  ldb,
+                                                                  nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    *lwork = sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCCgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             hipFloatComplex*  A,
+                                             int               lda,
+                                             hipFloatComplex*  B,
+                                             int               ldb,
+                                             hipFloatComplex*  X,
+                                             int               ldx,
+                                             size_t*           lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cgels((rocblas_handle)handle,
+                                                                  rocblas_operation_none,
+                                                                  m,
+                                                                  n,
+                                                                  nrhs,
+                                                                  nullptr,
+                                                                  lda,
+                                                                  nullptr,
+                                                                  ldb,
+                                                                  nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    *lwork = sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZZgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             hipDoubleComplex* A,
+                                             int               lda,
+                                             hipDoubleComplex* B,
+                                             int               ldb,
+                                             hipDoubleComplex* X,
+                                             int               ldx,
+                                             size_t*           lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zgels((rocblas_handle)handle,
+                                                                  rocblas_operation_none,
+                                                                  m,
+                                                                  n,
+                                                                  nrhs,
+                                                                  nullptr,
+                                                                  lda,
+                                                                  nullptr,
+                                                                  ldb,
+                                                                  nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    *lwork = sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSSgels(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               nrhs,
+                                  float*            A,
+                                  int               lda,
+                                  float*            B,
+                                  int               ldb,
+                                  float*            X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
+                                  int*              devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSSgels_bufferSize(
+            (rocblas_handle)handle, m, n, nrhs, A, lda, B, ldb, X, ldx, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_sgels(
+        (rocblas_handle)handle, rocblas_operation_none, m, n, nrhs, A, lda, B, ldb, devInfo));
+
+    if(niters != nullptr)
+        *niters = 0;
+
+    // copy the n-by-nrhs solution from B into X
+    float one = 1, zero = 0;
+    CHECK_ROCBLAS_ERROR(rocblas_sgeam((rocblas_handle)handle,
+                                      rocblas_operation_none,
+                                      rocblas_operation_none,
+                                      n,
+                                      nrhs,
+                                      &one,
+                                      B,
+                                      ldb,
+                                      &zero,
+                                      B,
+                                      ldb,
+                                      X,
+                                      ldx));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDDgels(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               nrhs,
+                                  double*           A,
+                                  int               lda,
+                                  double*           B,
+                                  int               ldb,
+                                  double*           X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
+                                  int*              devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDDgels_bufferSize(
+            (rocblas_handle)handle, m, n, nrhs, A, lda, B, ldb, X, ldx, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_dgels(
+        (rocblas_handle)handle, rocblas_operation_none, m, n, nrhs, A, lda, B, ldb, devInfo));
+
+    if(niters != nullptr)
+        *niters = 0;
+
+    // copy the n-by-nrhs solution from B into X
+    double one = 1, zero = 0;
+    CHECK_ROCBLAS_ERROR(rocblas_dgeam((rocblas_handle)handle,
+                                      rocblas_operation_none,
+                                      rocblas_operation_none,
+                                      n,
+                                      nrhs,
+                                      &one,
+                                      B,
+                                      ldb,
+                                      &zero,
+                                      B,
+                                      ldb,
+                                      X,
+                                      ldx));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCCgels(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               nrhs,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  hipFloatComplex*  B,
+                                  int               ldb,
+                                  hipFloatComplex*  X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
+                                  int*              devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCCgels_bufferSize(
+            (rocblas_handle)handle, m, n, nrhs, A, lda, B, ldb, X, ldx, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_cgels((rocblas_handle)handle,
+                                        rocblas_operation_none,
+                                        m,
+                                        n,
+                                        nrhs,
+                                        (rocblas_float_complex*)A,
+                                        lda,
+                                        (rocblas_float_complex*)B,
+                                        ldb,
+                                        devInfo));
+
+    if(niters != nullptr)
+        *niters = 0;
+
+    // copy the n-by-nrhs solution from B into X
+    rocblas_float_complex one = {1, 0}, zero = {0, 0};
+    CHECK_ROCBLAS_ERROR(rocblas_cgeam((rocblas_handle)handle,
+                                      rocblas_operation_none,
+                                      rocblas_operation_none,
+                                      n,
+                                      nrhs,
+                                      &one,
+                                      (rocblas_float_complex*)B,
+                                      ldb,
+                                      &zero,
+                                      (rocblas_float_complex*)B,
+                                      ldb,
+                                      (rocblas_float_complex*)X,
+                                      ldx));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZZgels(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               nrhs,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  hipDoubleComplex* B,
+                                  int               ldb,
+                                  hipDoubleComplex* X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
+                                  int*              devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZZgels_bufferSize(
+            (rocblas_handle)handle, m, n, nrhs, A, lda, B, ldb, X, ldx, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_zgels((rocblas_handle)handle,
+                                        rocblas_operation_none,
+                                        m,
+                                        n,
+                                        nrhs,
+                                        (rocblas_double_complex*)A,
+                                        lda,
+                                        (rocblas_double_complex*)B,
+                                        ldb,
+                                        devInfo));
+
+    if(niters != nullptr)
+        *niters = 0;
+
+    // copy the n-by-nrhs solution from B into X
+    rocblas_double_complex one = {1, 0}, zero = {0, 0};
+    CHECK_ROCBLAS_ERROR(rocblas_zgeam((rocblas_handle)handle,
+                                      rocblas_operation_none,
+                                      rocblas_operation_none,
+                                      n,
+                                      nrhs,
+                                      &one,
+                                      (rocblas_double_complex*)B,
+                                      ldb,
+                                      &zero,
+                                      (rocblas_double_complex*)B,
+                                      ldb,
+                                      (rocblas_double_complex*)X,
+                                      ldx));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSSgelsBatched_bufferSize(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    int               nrhs,
+                                                    float*            A[],
+                                                    int               lda,
+                                                    float*            B[],
+                                                    int               ldb,
+                                                    float*            X[],
+                                                    int               ldx,
+                                                    size_t*           lwork,
+                                                    int               batch_count)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_sgels_batched((rocblas_handle)handle,
+                                                                          rocblas_operation_none,
+                                                                          m,
+                                                                          n,
+                                                                          nrhs,
+                                                                          nullptr,
+                                                                          lda,
+                                                                          nullptr,
+                                                                          ldb,
+                                                                          nullptr,
+                                                                          batch_count));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    *lwork = sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDDgelsBatched_bufferSize(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    int               nrhs,
+                                                    double*           A[],
+                                                    int               lda,
+                                                    double*           B[],
+                                                    int               ldb,
+                                                    double*           X[],
+                                                    int               ldx,
+                                                    size_t*           lwork,
+                                                    int               batch_count)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dgels_batched((rocblas_handle)handle,
+                                                                          rocblas_operation_none,
+                                                                          m,
+                                                                          n,
+                                                                          nrhs,
+                                                                          nullptr,
+                                                                          lda,
+                                                                          nullptr,
+                                                                          ldb,
+                                                                          nullptr,
+                                                                          batch_count));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    *lwork = sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCCgelsBatched_bufferSize(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    int               nrhs,
+                                                    hipFloatComplex*  A[],
+                                                    int               lda,
+                                                    hipFloatComplex*  B[],
+                                                    int               ldb,
+                                                    hipFloatComplex*  X[],
+                                                    int               ldx,
+                                                    size_t*           lwork,
+                                                    int               batch_count)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cgels_batched((rocblas_handle)handle,
+                                                                          rocblas_operation_none,
+                                                                          m,
+                                                                          n,
+                                                                          nrhs,
+                                                                          nullptr,
+                                                                          lda,
+                                                                          nullptr,
+                                                                          ldb,
+                                                                          nullptr,
+                                                                          batch_count));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    *lwork = sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZZgelsBatched_bufferSize(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    int               nrhs,
+                                                    hipDoubleComplex* A[],
+                                                    int               lda,
+                                                    hipDoubleComplex* B[],
+                                                    int               ldb,
+                                                    hipDoubleComplex* X[],
+                                                    int               ldx,
+                                                    size_t*           lwork,
+                                                    int               batch_count)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zgels_batched((rocblas_handle)handle,
+                                                                          rocblas_operation_none,
+                                                                          m,
+                                                                          n,
+                                                                          nrhs,
+                                                                          nullptr,
+                                                                          lda,
+                                                                          nullptr,
+                                                                          ldb,
+                                                                          nullptr,
+                                                                          batch_count));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    *lwork = sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSSgelsBatched(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         int               nrhs,
+                                         float*            A[],
+                                         int               lda,
+                                         float*            B[],
+                                         int               ldb,
+                                         float*            X[],
+                                         int               ldx,
+                                         void*             work,
+                                         size_t            lwork,
+                                         int*              niters,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSSgelsBatched_bufferSize(
+            (rocblas_handle)handle, m, n, nrhs, A, lda, B, ldb, X, ldx, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_sgels_batched((rocblas_handle)handle,
+                                                rocblas_operation_none,
+                                                m,
+                                                n,
+                                                nrhs,
+                                                A,
+                                                lda,
+                                                B,
+                                                ldb,
+                                                devInfo,
+                                                batch_count));
+
+    if(niters != nullptr)
+        *niters = 0;
+
+    // copy the n-by-nrhs solution from B into X
+    float one = 1, zero = 0;
+    CHECK_ROCBLAS_ERROR(rocblas_sgeam_batched((rocblas_handle)handle,
+                                              rocblas_operation_none,
+                                              rocblas_operation_none,
+                                              n,
+                                              nrhs,
+                                              &one,
+                                              B,
+                                              ldb,
+                                              &zero,
+                                              B,
+                                              ldb,
+                                              X,
+                                              ldx,
+                                              batch_count));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDDgelsBatched(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         int               nrhs,
+                                         double*           A[],
+                                         int               lda,
+                                         double*           B[],
+                                         int               ldb,
+                                         double*           X[],
+                                         int               ldx,
+                                         void*             work,
+                                         size_t            lwork,
+                                         int*              niters,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDDgelsBatched_bufferSize(
+            (rocblas_handle)handle, m, n, nrhs, A, lda, B, ldb, X, ldx, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_dgels_batched((rocblas_handle)handle,
+                                                rocblas_operation_none,
+                                                m,
+                                                n,
+                                                nrhs,
+                                                A,
+                                                lda,
+                                                B,
+                                                ldb,
+                                                devInfo,
+                                                batch_count));
+
+    if(niters != nullptr)
+        *niters = 0;
+
+    // copy the n-by-nrhs solution from B into X
+    double one = 1, zero = 0;
+    CHECK_ROCBLAS_ERROR(rocblas_dgeam_batched((rocblas_handle)handle,
+                                              rocblas_operation_none,
+                                              rocblas_operation_none,
+                                              n,
+                                              nrhs,
+                                              &one,
+                                              B,
+                                              ldb,
+                                              &zero,
+                                              B,
+                                              ldb,
+                                              X,
+                                              ldx,
+                                              batch_count));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCCgelsBatched(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         int               nrhs,
+                                         hipFloatComplex*  A[],
+                                         int               lda,
+                                         hipFloatComplex*  B[],
+                                         int               ldb,
+                                         hipFloatComplex*  X[],
+                                         int               ldx,
+                                         void*             work,
+                                         size_t            lwork,
+                                         int*              niters,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCCgelsBatched_bufferSize(
+            (rocblas_handle)handle, m, n, nrhs, A, lda, B, ldb, X, ldx, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_cgels_batched((rocblas_handle)handle,
+                                                rocblas_operation_none,
+                                                m,
+                                                n,
+                                                nrhs,
+                                                (rocblas_float_complex* const*)A,
+                                                lda,
+                                                (rocblas_float_complex* const*)B,
+                                                ldb,
+                                                devInfo,
+                                                batch_count));
+
+    if(niters != nullptr)
+        *niters = 0;
+
+    // copy the n-by-nrhs solution from B into X
+    rocblas_float_complex one = {1, 0}, zero = {0, 0};
+    CHECK_ROCBLAS_ERROR(rocblas_cgeam_batched((rocblas_handle)handle,
+                                              rocblas_operation_none,
+                                              rocblas_operation_none,
+                                              n,
+                                              nrhs,
+                                              &one,
+                                              (rocblas_float_complex* const*)B,
+                                              ldb,
+                                              &zero,
+                                              (rocblas_float_complex* const*)B,
+                                              ldb,
+                                              (rocblas_float_complex* const*)X,
+                                              ldx,
+                                              batch_count));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZZgelsBatched(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         int               nrhs,
+                                         hipDoubleComplex* A[],
+                                         int               lda,
+                                         hipDoubleComplex* B[],
+                                         int               ldb,
+                                         hipDoubleComplex* X[],
+                                         int               ldx,
+                                         void*             work,
+                                         size_t            lwork,
+                                         int*              niters,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZZgelsBatched_bufferSize(
+            (rocblas_handle)handle, m, n, nrhs, A, lda, B, ldb, X, ldx, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_zgels_batched((rocblas_handle)handle,
+                                                rocblas_operation_none,
+                                                m,
+                                                n,
+                                                nrhs,
+                                                (rocblas_double_complex* const*)A,
+                                                lda,
+                                                (rocblas_double_complex* const*)B,
+                                                ldb,
+                                                devInfo,
+                                                batch_count));
+
+    if(niters != nullptr)
+        *niters = 0;
+
+    // copy the n-by-nrhs solution from B into X
+    rocblas_double_complex one = {1, 0}, zero = {0, 0};
+    CHECK_ROCBLAS_ERROR(rocblas_zgeam_batched((rocblas_handle)handle,
+                                              rocblas_operation_none,
+                                              rocblas_operation_none,
+                                              n,
+                                              nrhs,
+                                              &one,
+                                              (rocblas_double_complex* const*)B,
+                                              ldb,
+                                              &zero,
+                                              (rocblas_double_complex* const*)B,
+                                              ldb,
+                                              (rocblas_double_complex* const*)X,
+                                              ldx,
+                                              batch_count));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GEQP3 ********************/
+hipsolverStatus_t hipsolverSgeqp3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_geqp3_bufferSize_template<float>(
+        (rocblas_handle)handle, m, n, lda, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqp3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_geqp3_bufferSize_template<double>(
+        (rocblas_handle)handle, m, n, lda, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqp3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_geqp3_bufferSize_template<rocblas_float_complex>(
+            (rocblas_handle)handle, m, n, lda, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqp3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_geqp3_bufferSize_template<rocblas_double_complex>(
+            (rocblas_handle)handle, m, n, lda, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgeqp3(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  int*              jpvt,
+                                  float*            tau,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
+    size_t size_geqp3 = hipsolver_geqp3_worksize<float>(n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_geqp3)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_geqp3, lwork - size_geqp3));
+        CHECK_ROCBLAS_ERROR(hipsolver_geqp3_template((rocblas_handle)handle,
+                                                     m,
+                                                     n,
+                                                     A,
+                                                     lda,
+                                                     jpvt,
+                                                     tau,
+                                                     false,
+                                                     float(0),
+                                                     (int*)nullptr,
+                                                     devInfo,
+                                                     (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSgeqp3_bufferSize(handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_geqp3);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_geqp3_template((rocblas_handle)handle,
+                                                     m,
+                                                     n,
+                                                     A,
+                                                     lda,
+                                                     jpvt,
+                                                     tau,
+                                                     false,
+                                                     float(0),
+                                                     (int*)nullptr,
+                                                     devInfo,
+                                                     mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqp3(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  int*              jpvt,
+                                  double*           tau,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
+    size_t size_geqp3 = hipsolver_geqp3_worksize<double>(n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_geqp3)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_geqp3, lwork - size_geqp3));
+        CHECK_ROCBLAS_ERROR(hipsolver_geqp3_template((rocblas_handle)handle,
+                                                     m,
+                                                     n,
+                                                     A,
+                                                     lda,
+                                                     jpvt,
+                                                     tau,
+                                                     false,
+                                                     double(0),
+                                                     (int*)nullptr,
+                                                     devInfo,
+                                                     (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDgeqp3_bufferSize(handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_geqp3);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_geqp3_template((rocblas_handle)handle,
+                                                     m,
+                                                     n,
+                                                     A,
+                                                     lda,
+                                                     jpvt,
+                                                     tau,
+                                                     false,
+                                                     double(0),
+                                                     (int*)nullptr,
+                                                     devInfo,
+                                                     mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqp3(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  int*              jpvt,
+                                  hipFloatComplex*  tau,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
+    size_t size_geqp3 = hipsolver_geqp3_worksize<rocblas_float_complex>(n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_geqp3)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_geqp3, lwork - size_geqp3));
+        CHECK_ROCBLAS_ERROR(hipsolver_geqp3_template((rocblas_handle)handle,
+                                                     m,
+                                                     n,
+                                                     (rocblas_float_complex*)A,
+                                                     lda,
+                                                     jpvt,
+                                                     (rocblas_float_complex*)tau,
+                                                     false,
+                                                     float(0),
+                                                     (int*)nullptr,
+                                                     devInfo,
+                                                     (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCgeqp3_bufferSize(handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_geqp3);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_geqp3_template((rocblas_handle)handle,
+                                                     m,
+                                                     n,
+                                                     (rocblas_float_complex*)A,
+                                                     lda,
+                                                     jpvt,
+                                                     (rocblas_float_complex*)tau,
+                                                     false,
+                                                     float(0),
+                                                     (int*)nullptr,
+                                                     devInfo,
+                                                     mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqp3(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  int*              jpvt,
+                                  hipDoubleComplex* tau,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
+    size_t size_geqp3 = hipsolver_geqp3_worksize<rocblas_double_complex>(n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_geqp3)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_geqp3, lwork - size_geqp3));
+        CHECK_ROCBLAS_ERROR(hipsolver_geqp3_template((rocblas_handle)handle,
+                                                     m,
+                                                     n,
+                                                     (rocblas_double_complex*)A,
+                                                     lda,
+                                                     jpvt,
+                                                     (rocblas_double_complex*)tau,
+                                                     false,
+                                                     double(0),
+                                                     (int*)nullptr,
+                                                     devInfo,
+                                                     (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZgeqp3_bufferSize(handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_geqp3);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_geqp3_template((rocblas_handle)handle,
+                                                     m,
+                                                     n,
+                                                     (rocblas_double_complex*)A,
+                                                     lda,
+                                                     jpvt,
+                                                     (rocblas_double_complex*)tau,
+                                                     false,
+                                                     double(0),
+                                                     (int*)nullptr,
+                                                     devInfo,
+                                                     mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GEQP3_TRUNCATED ********************/
+hipsolverStatus_t hipsolverSgeqp3Truncated_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_geqp3_bufferSize_template<float>(
+        (rocblas_handle)handle, m, n, lda, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqp3Truncated_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_geqp3_bufferSize_template<double>(
+        (rocblas_handle)handle, m, n, lda, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqp3Truncated_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_geqp3_bufferSize_template<rocblas_float_complex>(
+            (rocblas_handle)handle, m, n, lda, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqp3Truncated_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_geqp3_bufferSize_template<rocblas_double_complex>(
+            (rocblas_handle)handle, m, n, lda, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgeqp3Truncated(hipsolverHandle_t handle,
+                                           int               m,
+                                           int               n,
+                                           float*            A,
+                                           int               lda,
+                                           float             tol,
+                                           int*              jpvt,
+                                           float*            tau,
+                                           int*              rank,
+                                           float*            work,
+                                           int               lwork,
+                                           int*              devInfo)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
+    size_t size_geqp3 = hipsolver_geqp3_worksize<float>(n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_geqp3)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_geqp3, lwork - size_geqp3));
+        CHECK_ROCBLAS_ERROR(hipsolver_geqp3_template((rocblas_handle)handle,
+                                                     m,
+                                                     n,
+                                                     A,
+                                                     lda,
+                                                     jpvt,
+                                                     tau,
+                                                     true,
+                                                     tol,
+                                                     rank,
+                                                     devInfo,
+                                                     (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSgeqp3Truncated_bufferSize(handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_geqp3);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_geqp3_template(
+            (rocblas_handle)handle, m, n, A, lda, jpvt, tau, true, tol, rank, devInfo, mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqp3Truncated(hipsolverHandle_t handle,
+                                           int               m,
+                                           int               n,
+                                           double*           A,
+                                           int               lda,
+                                           double            tol,
+                                           int*              jpvt,
+                                           double*           tau,
+                                           int*              rank,
+                                           double*           work,
+                                           int               lwork,
+                                           int*              devInfo)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
+    size_t size_geqp3 = hipsolver_geqp3_worksize<double>(n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_geqp3)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_geqp3, lwork - size_geqp3));
+        CHECK_ROCBLAS_ERROR(hipsolver_geqp3_template((rocblas_handle)handle,
+                                                     m,
+                                                     n,
+                                                     A,
+                                                     lda,
+                                                     jpvt,
+                                                     tau,
+                                                     true,
+                                                     tol,
+                                                     rank,
+                                                     devInfo,
+                                                     (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDgeqp3Truncated_bufferSize(handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_geqp3);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_geqp3_template(
+            (rocblas_handle)handle, m, n, A, lda, jpvt, tau, true, tol, rank, devInfo, mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqp3Truncated(hipsolverHandle_t handle,
+                                           int               m,
+                                           int               n,
+                                           hipFloatComplex*  A,
+                                           int               lda,
+                                           float             tol,
+                                           int*              jpvt,
+                                           hipFloatComplex*  tau,
+                                           int*              rank,
+                                           hipFloatComplex*  work,
+                                           int               lwork,
+                                           int*              devInfo)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
+    size_t size_geqp3 = hipsolver_geqp3_worksize<rocblas_float_complex>(n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_geqp3)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_geqp3, lwork - size_geqp3));
+        CHECK_ROCBLAS_ERROR(hipsolver_geqp3_template((rocblas_handle)handle,
+                                                     m,
+                                                     n,
+                                                     (rocblas_float_complex*)A,
+                                                     lda,
+                                                     jpvt,
+                                                     (rocblas_float_complex*)tau,
+                                                     true,
+                                                     tol,
+                                                     rank,
+                                                     devInfo,
+                                                     (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCgeqp3Truncated_bufferSize(handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_geqp3);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_geqp3_template((rocblas_handle)handle,
+                                                     m,
+                                                     n,
+                                                     (rocblas_float_complex*)A,
+                                                     lda,
+                                                     jpvt,
+                                                     (rocblas_float_complex*)tau,
+                                                     true,
+                                                     tol,
+                                                     rank,
+                                                     devInfo,
+                                                     mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqp3Truncated(hipsolverHandle_t handle,
+                                           int               m,
+                                           int               n,
+                                           hipDoubleComplex* A,
+                                           int               lda,
+                                           double            tol,
+                                           int*              jpvt,
+                                           hipDoubleComplex* tau,
+                                           int*              rank,
+                                           hipDoubleComplex* work,
+                                           int               lwork,
+                                           int*              devInfo)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
+    size_t size_geqp3 = hipsolver_geqp3_worksize<rocblas_double_complex>(n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_geqp3)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_geqp3, lwork - size_geqp3));
+        CHECK_ROCBLAS_ERROR(hipsolver_geqp3_template((rocblas_handle)handle,
+                                                     m,
+                                                     n,
+                                                     (rocblas_double_complex*)A,
+                                                     lda,
+                                                     jpvt,
+                                                     (rocblas_double_complex*)tau,
+                                                     true,
+                                                     tol,
+                                                     rank,
+                                                     devInfo,
+                                                     (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZgeqp3Truncated_bufferSize(handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_geqp3);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_geqp3_template((rocblas_handle)handle,
+                                                     m,
+                                                     n,
+                                                     (rocblas_double_complex*)A,
+                                                     lda,
+                                                     jpvt,
+                                                     (rocblas_double_complex*)tau,
+                                                     true,
+                                                     tol,
+                                                     rank,
+                                                     devInfo,
+                                                     mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GEQRF ********************/
+hipsolverStatus_t hipsolverSgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, m, n);
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status
+        = rocblas2hip_status(rocsolver_sgeqrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr));
+    if(status == HIPSOLVER_STATUS_SUCCESS && tile.nb > 0)
+        status = rocblas2hip_status(hipsolver_tile_query<float>(
+            (rocblas_handle)handle, hipsolver_tile_qr, m, n, lda, tile));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    sz += hipsolver_tile_worksize<float>(hipsolver_tile_qr, tile, m, n);
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, m, n);
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status
+        = rocblas2hip_status(rocsolver_dgeqrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr));
+    if(status == HIPSOLVER_STATUS_SUCCESS && tile.nb > 0)
+        status = rocblas2hip_status(hipsolver_tile_query<double>(
+            (rocblas_handle)handle, hipsolver_tile_qr, m, n, lda, tile));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    sz += hipsolver_tile_worksize<double>(hipsolver_tile_qr, tile, m, n);
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, m, n);
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status
+        = rocblas2hip_status(rocsolver_cgeqrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr));
+    if(status == HIPSOLVER_STATUS_SUCCESS && tile.nb > 0)
+        status = rocblas2hip_status(hipsolver_tile_query<rocblas_float_complex>(
+            (rocblas_handle)handle, hipsolver_tile_qr, m, n, lda, tile));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    sz += hipsolver_tile_worksize<rocblas_float_complex>(hipsolver_tile_qr, tile, m, n);
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, m, n);
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status
+        = rocblas2hip_status(rocsolver_zgeqrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr));
+    if(status == HIPSOLVER_STATUS_SUCCESS && tile.nb > 0)
+        status = rocblas2hip_status(hipsolver_tile_query<rocblas_double_complex>(
+            (rocblas_handle)handle, hipsolver_tile_qr, m, n, lda, tile));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    sz += hipsolver_tile_worksize<rocblas_double_complex>(hipsolver_tile_qr, tile, m, n);
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgeqrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  float*            tau,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, m, n);
+
+    size_t size_tile = hipsolver_tile_worksize<float>(hipsolver_tile_qr, tile, m, n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_tile)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_tile, lwork - size_tile));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverSgeqrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(tile.nb > 0 && work != nullptr)
+        return rocblas2hip_status(hipsolver_geqrf_tile_template(
+            (rocblas_handle)handle, m, n, A, lda, tau, tile, (void*)work));
+    else if(tile.nb > 0)
+    {
+        rocblas_device_malloc mem((rocblas_handle)handle, size_tile);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        return rocblas2hip_status(hipsolver_geqrf_tile_template(
+            (rocblas_handle)handle, m, n, A, lda, tau, tile, mem[0]));
+    }
+
+    return rocblas2hip_status(rocsolver_sgeqrf((rocblas_handle)handle, m, n, A, lda, tau));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  double*           tau,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, m, n);
+
+    size_t size_tile = hipsolver_tile_worksize<double>(hipsolver_tile_qr, tile, m, n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_tile)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_tile, lwork - size_tile));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverDgeqrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(tile.nb > 0 && work != nullptr)
+        return rocblas2hip_status(hipsolver_geqrf_tile_template(
+            (rocblas_handle)handle, m, n, A, lda, tau, tile, (void*)work));
+    else if(tile.nb > 0)
+    {
+        rocblas_device_malloc mem((rocblas_handle)handle, size_tile);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        return rocblas2hip_status(hipsolver_geqrf_tile_template(
+            (rocblas_handle)handle, m, n, A, lda, tau, tile, mem[0]));
+    }
+
+    return rocblas2hip_status(rocsolver_dgeqrf((rocblas_handle)handle, m, n, A, lda, tau));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  hipFloatComplex*  tau,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, m, n);
+
+    size_t size_tile
+        = hipsolver_tile_worksize<rocblas_float_complex>(hipsolver_tile_qr, tile, m, n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_tile)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_tile, lwork - size_tile));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverCgeqrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(tile.nb > 0 && work != nullptr)
+        return rocblas2hip_status(hipsolver_geqrf_tile_template((rocblas_handle)handle,
+                                                                m,
+                                                                n,
+                                                                (rocblas_float_complex*)A,
+                                                                lda,
+                                                                (rocblas_float_complex*)tau,
+                                                                tile,
+                                                                (void*)work));
+    else if(tile.nb > 0)
+    {
+        rocblas_device_malloc mem((rocblas_handle)handle, size_tile);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        return rocblas2hip_status(hipsolver_geqrf_tile_template((rocblas_handle)handle,
+                                                                m,
+                                                                n,
+                                                                (rocblas_float_complex*)A,
+                                                                lda,
+                                                                (rocblas_float_complex*)tau,
+                                                                tile,
+                                                                mem[0]));
+    }
+
+    return rocblas2hip_status(rocsolver_cgeqrf(
+        (rocblas_handle)handle, m, n, (rocblas_float_complex*)A, lda, (rocblas_float_complex*)tau));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  hipDoubleComplex* tau,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, m, n);
+
+    size_t size_tile
+        = hipsolver_tile_worksize<rocblas_double_complex>(hipsolver_tile_qr, tile, m, n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_tile)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_tile, lwork - size_tile));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverZgeqrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(tile.nb > 0 && work != nullptr)
+        return rocblas2hip_status(hipsolver_geqrf_tile_template((rocblas_handle)handle,
+                                                                m,
+                                                                n,
+                                                                (rocblas_double_complex*)A,
+                                                                lda,
+                                                                (rocblas_double_complex*)tau,
+                                                                tile,
+                                                                (void*)work));
+    else if(tile.nb > 0)
+    {
+        rocblas_device_malloc mem((rocblas_handle)handle, size_tile);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        return rocblas2hip_status(hipsolver_geqrf_tile_template((rocblas_handle)handle,
+                                                                m,
+                                                                n,
+                                                                (rocblas_double_complex*)A,
+                                                                lda,
+                                                                (rocblas_double_complex*)tau,
+                                                                tile,
+                                                                mem[0]));
+    }
+
+    return rocblas2hip_status(rocsolver_zgeqrf((rocblas_handle)handle,
+                                               m,
+                                               n,
+                                               (rocblas_double_complex*)A,
+                                               lda,
+                                               (rocblas_double_complex*)tau));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GEQRF_TSQR ********************/
+hipsolverStatus_t hipsolverSgeqrfTsqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_geqrf_tsqr_bufferSize_template<float>(
+        (rocblas_handle)handle, m, n, lda, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqrfTsqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_geqrf_tsqr_bufferSize_template<double>(
+        (rocblas_handle)handle, m, n, lda, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqrfTsqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_geqrf_tsqr_bufferSize_template<rocblas_float_complex>(
+            (rocblas_handle)handle, m, n, lda, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqrfTsqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_geqrf_tsqr_bufferSize_template<rocblas_double_complex>(
+            (rocblas_handle)handle, m, n, lda, &sz));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgeqrfTsqr(hipsolverHandle_t handle,
+                                      int               m,
+                                      int               n,
+                                      float*            A,
+                                      int               lda,
+                                      float*            tau,
+                                      float*            work,
+                                      int               lwork,
+                                      int*              devInfo)
+try
+{
+    if(hipsolver_tsqr_split(m, n))
+        CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
+    size_t size_tsqr = hipsolver_geqrf_tsqr_worksize<float>(m, n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_tsqr)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_tsqr, lwork - size_tsqr));
+        return rocblas2hip_status(hipsolver_geqrf_tsqr_template(
+            (rocblas_handle)handle, m, n, A, lda, tau, (void*)work));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSgeqrfTsqr_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_tsqr);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        return rocblas2hip_status(hipsolver_geqrf_tsqr_template(
+            (rocblas_handle)handle, m, n, A, lda, tau, mem[0]));
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqrfTsqr(hipsolverHandle_t handle,
+                                      int               m,
+                                      int               n,
+                                      double*           A,
+                                      int               lda,
+                                      double*           tau,
+                                      double*           work,
+                                      int               lwork,
+                                      int*              devInfo)
+try
+{
+    if(hipsolver_tsqr_split(m, n))
+        CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
+    size_t size_tsqr = hipsolver_geqrf_tsqr_worksize<double>(m, n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_tsqr)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_tsqr, lwork - size_tsqr));
+        return rocblas2hip_status(hipsolver_geqrf_tsqr_template(
+            (rocblas_handle)handle, m, n, A, lda, tau, (void*)work));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDgeqrfTsqr_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_tsqr);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        return rocblas2hip_status(hipsolver_geqrf_tsqr_template(
+            (rocblas_handle)handle, m, n, A, lda, tau, mem[0]));
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqrfTsqr(hipsolverHandle_t handle,
+                                      int               m,
+                                      int               n,
+                                      hipFloatComplex*  A,
+                                      int               lda,
+                                      hipFloatComplex*  tau,
+                                      hipFloatComplex*  work,
+                                      int               lwork,
+                                      int*              devInfo)
+try
+{
+    if(hipsolver_tsqr_split(m, n))
+        CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
+    size_t size_tsqr = hipsolver_geqrf_tsqr_worksize<rocblas_float_complex>(m, n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_tsqr)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_tsqr, lwork - size_tsqr));
+        return rocblas2hip_status(hipsolver_geqrf_tsqr_template((rocblas_handle)handle,
+                                                                m,
+                                                                n,
+                                                                (rocblas_float_complex*)A,
+                                                                lda,
+                                                                (rocblas_float_complex*)tau,
+                                                                (void*)work));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCgeqrfTsqr_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_tsqr);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        return rocblas2hip_status(hipsolver_geqrf_tsqr_template((rocblas_handle)handle,
+                                                                m,
+                                                                n,
+                                                                (rocblas_float_complex*)A,
+                                                                lda,
+                                                                (rocblas_float_complex*)tau,
+                                                                mem[0]));
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqrfTsqr(hipsolverHandle_t handle,
+                                      int               m,
+                                      int               n,
+                                      hipDoubleComplex* A,
+                                      int               lda,
+                                      hipDoubleComplex* tau,
+                                      hipDoubleComplex* work,
+                                      int               lwork,
+                                      int*              devInfo)
+try
+{
+    if(hipsolver_tsqr_split(m, n))
+        CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
+    size_t size_tsqr = hipsolver_geqrf_tsqr_worksize<rocblas_double_complex>(m, n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_tsqr)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_tsqr, lwork - size_tsqr));
+        return rocblas2hip_status(hipsolver_geqrf_tsqr_template((rocblas_handle)handle,
+                                                                m,
+                                                                n,
+                                                                (rocblas_double_complex*)A,
+                                                                lda,
+                                                                (rocblas_double_complex*)tau,
+                                                                (void*)work));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZgeqrfTsqr_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_tsqr);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        return rocblas2hip_status(hipsolver_geqrf_tsqr_template((rocblas_handle)handle,
+                                                                m,
+                                                                n,
+                                                                (rocblas_double_complex*)A,
+                                                                lda,
+                                                                (rocblas_double_complex*)tau,
+                                                                mem[0]));
+    }
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GESVD ********************/
+hipsolverStatus_t hipsolverSgesvd_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_sgesvd((rocblas_handle)handle,
+                                                                   char2rocblas_svect(jobu),
+                                                                   char2rocblas_svect(jobv),
+                                                                   m,
+                                                                   n,
+                                                                   nullptr,
+                                                                   m,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   m,
+                                                                   nullptr,
+                                                                   n,
+                                                                   nullptr,
+                                                                   rocblas_outofplace,
+                                                                   nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgesvd_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dgesvd((rocblas_handle)handle,
+                                                                   char2rocblas_svect(jobu),
+                                                                   char2rocblas_svect(jobv),
+                                                                   m,
+                                                                   n,
+                                                                   nullptr,
+                                                                   m,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   m,
+                                                                   nullptr,
+                                                                   n,
+                                                                   nullptr,
+                                                                   rocblas_outofplace,
+                                                                   nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgesvd_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cgesvd((rocblas_handle)handle,
+                                                                   char2rocblas_svect(jobu),
+                                                                   char2rocblas_svect(jobv),
+                                                                   m,
+                                                                   n,
+                                                                   nullptr,
+                                                                   m,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   m,
+                                                                   nullptr,
+                                                                   n,
+                                                                   nullptr,
+                                                                   rocblas_outofplace,
+                                                                   nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgesvd_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zgesvd((rocblas_handle)handle,
+                                                                   char2rocblas_svect(jobu),
+                                                                   char2rocblas_svect(jobv),
+                                                                   m,
+                                                                   n,
+                                                                   nullptr,
+                                                                   m,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   m,
+                                                                   nullptr,
+                                                                   n,
+                                                                   nullptr,
+                                                                   rocblas_outofplace,
+                                                                   nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgesvd(hipsolverHandle_t handle,
+                                  signed char       jobu,
+                                  signed char       jobv,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  float*            S,
+                                  float*            U,
+                                  int               ldu,
+                                  float*            V,
+                                  int               ldv,
+                                  float*            work,
+                                  int               lwork,
+                                  float*            rwork,
+                                  int*              devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverSgesvd_bufferSize((rocblas_handle)handle, jobu, jobv, m, n, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_sgesvd((rocblas_handle)handle,
+                                         char2rocblas_svect(jobu),
+                                         char2rocblas_svect(jobv),
+                                         m,
+                                         n,
+                                         A,
+                                         lda,
+                                         S,
+                                         U,
+                                         ldu,
+                                         V,
+                                         ldv,
+                                         rwork,
+                                         rocblas_outofplace,
+                                         devInfo));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgesvd(hipsolverHandle_t handle,
+                                  signed char       jobu,
+                                  signed char       jobv,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  double*           S,
+                                  double*           U,
+                                  int               ldu,
+                                  double*           V,
+                                  int               ldv,
+                                  double*           work,
+                                  int               lwork,
+                                  double*           rwork,
+                                  int*              devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverDgesvd_bufferSize((rocblas_handle)handle, jobu, jobv, m, n, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_dgesvd((rocblas_handle)handle,
+                                         char2rocblas_svect(jobu),
+                                         char2rocblas_svect(jobv),
+                                         m,
+                                         n,
+                                         A,
+                                         lda,
+                                         S,
+                                         U,
+                                         ldu,
+                                         V,
+                                         ldv,
+                                         rwork,
+                                         rocblas_outofplace,
+                                         devInfo));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgesvd(hipsolverHandle_t handle,
+                                  signed char       jobu,
+                                  signed char       jobv,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  float*            S,
+                                  hipFloatComplex*  U,
+                                  int               ldu,
+                                  hipFloatComplex*  V,
+                                  int               ldv,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  float*            rwork,
+                                  int*              devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverCgesvd_bufferSize((rocblas_handle)handle, jobu, jobv, m, n, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_cgesvd((rocblas_handle)handle,
+                                         char2rocblas_svect(jobu),
+                                         char2rocblas_svect(jobv),
+                                         m,
+                                         n,
+                                         (rocblas_float_complex*)A,
+                                         lda,
+                                         S,
+                                         (rocblas_float_complex*)U,
+                                         ldu,
+                                         (rocblas_float_complex*)V,
+                                         ldv,
+                                         rwork,
+                                         rocblas_outofplace,
+                                         devInfo));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgesvd(hipsolverHandle_t handle,
+                                  signed char       jobu,
+                                  signed char       jobv,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  double*           S,
+                                  hipDoubleComplex* U,
+                                  int               ldu,
+                                  hipDoubleComplex* V,
+                                  int               ldv,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  double*           rwork,
+                                  int*              devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverZgesvd_bufferSize((rocblas_handle)handle, jobu, jobv, m, n, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_zgesvd((rocblas_handle)handle,
+                                         char2rocblas_svect(jobu),
+                                         char2rocblas_svect(jobv),
+                                         m,
+                                         n,
+                                         (rocblas_double_complex*)A,
+                                         lda,
+                                         S,
+                                         (rocblas_double_complex*)U,
+                                         ldu,
+                                         (rocblas_double_complex*)V,
+                                         ldv,
+                                         rwork,
+                                         rocblas_outofplace,
+                                         devInfo));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRF ********************/
+hipsolverStatus_t hipsolverSgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, m, n);
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_sgetrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
+    rocsolver_sgetrf_npvt((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+    if(status == HIPSOLVER_STATUS_SUCCESS && tile.nb > 0)
+        status = rocblas2hip_status(hipsolver_tile_query<float>(
+            (rocblas_handle)handle, hipsolver_tile_lu, m, n, lda, tile));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    sz += hipsolver_tile_worksize<float>(hipsolver_tile_lu, tile, m, n);
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, m, n);
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_dgetrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
+    rocsolver_dgetrf_npvt((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+    if(status == HIPSOLVER_STATUS_SUCCESS && tile.nb > 0)
+        status = rocblas2hip_status(hipsolver_tile_query<double>(
+            (rocblas_handle)handle, hipsolver_tile_lu, m, n, lda, tile));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    sz += hipsolver_tile_worksize<double>(hipsolver_tile_lu, tile, m, n);
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, m, n);
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_cgetrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
+    rocsolver_cgetrf_npvt((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+    if(status == HIPSOLVER_STATUS_SUCCESS && tile.nb > 0)
+        status = rocblas2hip_status(hipsolver_tile_query<rocblas_float_complex>(
+            (rocblas_handle)handle, hipsolver_tile_lu, m, n, lda, tile));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    sz += hipsolver_tile_worksize<rocblas_float_complex>(hipsolver_tile_lu, tile, m, n);
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, m, n);
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_zgetrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
+    rocsolver_zgetrf_npvt((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+    if(status == HIPSOLVER_STATUS_SUCCESS && tile.nb > 0)
+        status = rocblas2hip_status(hipsolver_tile_query<rocblas_double_complex>(
+            (rocblas_handle)handle, hipsolver_tile_lu, m, n, lda, tile));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    sz += hipsolver_tile_worksize<rocblas_double_complex>(hipsolver_tile_lu, tile, m, n);
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
+try
+{
+    bool host;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_dispatch(
+        (rocblas_handle)handle, m, n, A, lda, devIpiv, devInfo, &host));
+    if(host)
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+
+    // unpivoted factorizations are not tiled
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, m, n);
+    if(devIpiv == nullptr)
+        tile = hipsolver_tile_config();
+
+    size_t size_tile = hipsolver_tile_worksize<float>(hipsolver_tile_lu, tile, m, n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_tile)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_tile, lwork - size_tile));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverSgetrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(tile.nb > 0 && work != nullptr)
+    {
+        CHECK_ROCBLAS_ERROR(hipsolver_getrf_tile_template(
+            (rocblas_handle)handle, m, n, A, lda, devIpiv, devInfo, tile, (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else if(tile.nb > 0)
+    {
+        rocblas_device_malloc mem((rocblas_handle)handle, size_tile);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_getrf_tile_template(
+            (rocblas_handle)handle, m, n, A, lda, devIpiv, devInfo, tile, mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+
+    if(devIpiv != nullptr)
+        CHECK_ROCBLAS_ERROR(
+            rocsolver_sgetrf((rocblas_handle)handle, m, n, A, lda, devIpiv, devInfo));
+    else
+        CHECK_ROCBLAS_ERROR(rocsolver_sgetrf_npvt((rocblas_handle)handle, m, n, A, lda, devInfo));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
+try
+{
+    bool host;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_dispatch(
+        (rocblas_handle)handle, m, n, A, lda, devIpiv, devInfo, &host));
+    if(host)
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+
+    // unpivoted factorizations are not tiled
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, m, n);
+    if(devIpiv == nullptr)
+        tile = hipsolver_tile_config();
+
+    size_t size_tile = hipsolver_tile_worksize<double>(hipsolver_tile_lu, tile, m, n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_tile)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_tile, lwork - size_tile));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverDgetrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(tile.nb > 0 && work != nullptr)
+    {
+        CHECK_ROCBLAS_ERROR(hipsolver_getrf_tile_template(
+            (rocblas_handle)handle, m, n, A, lda, devIpiv, devInfo, tile, (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else if(tile.nb > 0)
+    {
+        rocblas_device_malloc mem((rocblas_handle)handle, size_tile);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_getrf_tile_template(
+            (rocblas_handle)handle, m, n, A, lda, devIpiv, devInfo, tile, mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+
+    if(devIpiv != nullptr)
+        CHECK_ROCBLAS_ERROR(
+            rocsolver_dgetrf((rocblas_handle)handle, m, n, A, lda, devIpiv, devInfo));
+    else
+        CHECK_ROCBLAS_ERROR(rocsolver_dgetrf_npvt((rocblas_handle)handle, m, n, A, lda, devInfo));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
+try
+{
+    bool host;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_dispatch(
+        (rocblas_handle)handle, m, n, (rocblas_float_complex*)A, lda, devIpiv, devInfo, &host));
+    if(host)
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+
+    // unpivoted factorizations are not tiled
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, m, n);
+    if(devIpiv == nullptr)
+        tile = hipsolver_tile_config();
+
+    size_t size_tile
+        = hipsolver_tile_worksize<rocblas_float_complex>(hipsolver_tile_lu, tile, m, n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_tile)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_tile, lwork - size_tile));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverCgetrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(tile.nb > 0 && work != nullptr)
+    {
+        CHECK_ROCBLAS_ERROR(hipsolver_getrf_tile_template((rocblas_handle)handle,
+                                                          m,
+                                                          n,
+                                                          (rocblas_float_complex*)A,
+                                                          lda,
+                                                          devIpiv,
+                                                          devInfo,
+                                                          tile,
+                                                          (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else if(tile.nb > 0)
+    {
+        rocblas_device_malloc mem((rocblas_handle)handle, size_tile);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_getrf_tile_template((rocblas_handle)handle,
+                                                          m,
+                                                          n,
+                                                          (rocblas_float_complex*)A,
+                                                          lda,
+                                                          devIpiv,
+                                                          devInfo,
+                                                          tile,
+                                                          mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+
+    if(devIpiv != nullptr)
+        CHECK_ROCBLAS_ERROR(rocsolver_cgetrf(
+            (rocblas_handle)handle, m, n, (rocblas_float_complex*)A, lda, devIpiv, devInfo));
+    else
+        CHECK_ROCBLAS_ERROR(rocsolver_cgetrf_npvt(
+            (rocblas_handle)handle, m, n, (rocblas_float_complex*)A, lda, devInfo));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
+try
+{
+    bool host;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_dispatch(
+        (rocblas_handle)handle, m, n, (rocblas_double_complex*)A, lda, devIpiv, devInfo, &host));
+    if(host)
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+
+    // unpivoted factorizations are not tiled
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, m, n);
+    if(devIpiv == nullptr)
+        tile = hipsolver_tile_config();
+
+    size_t size_tile
+        = hipsolver_tile_worksize<rocblas_double_complex>(hipsolver_tile_lu, tile, m, n);
+
+    if(work != nullptr)
+    {
+        if(lwork < 0 || size_t(lwork) < size_tile)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_tile, lwork - size_tile));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverZgetrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(tile.nb > 0 && work != nullptr)
+    {
+        CHECK_ROCBLAS_ERROR(hipsolver_getrf_tile_template((rocblas_handle)handle,
+                                                          m,
+                                                          n,
+                                                          (rocblas_double_complex*)A,
+                                                          lda,
+                                                          devIpiv,
+                                                          devInfo,
+                                                          tile,
+                                                          (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else if(tile.nb > 0)
+    {
+        rocblas_device_malloc mem((rocblas_handle)handle, size_tile);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_getrf_tile_template((rocblas_handle)handle,
+                                                          m,
+                                                          n,
+                                                          (rocblas_double_complex*)A,
+                                                          lda,
+                                                          devIpiv,
+                                                          devInfo,
+                                                          tile,
+                                                          mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+
+    if(devIpiv != nullptr)
+        CHECK_ROCBLAS_ERROR(rocsolver_zgetrf(
+            (rocblas_handle)handle, m, n, (rocblas_double_complex*)A, lda, devIpiv, devInfo));
+    else
+        CHECK_ROCBLAS_ERROR(rocsolver_zgetrf_npvt(
+            (rocblas_handle)handle, m, n, (rocblas_double_complex*)A, lda, devInfo));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRS ********************/
+hipsolverStatus_t hipsolverSgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             float*               A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             float*               B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_sgetrs((rocblas_handle)handle,
+                                                                   hip2rocblas_operation(trans),
+                                                                   n,
+                                                                   nrhs,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   ldb));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             double*              A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             double*              B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dgetrs((rocblas_handle)handle,
+                                                                   hip2rocblas_operation(trans),
+                                                                   n,
+                                                                   nrhs,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   ldb));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             hipFloatComplex*     B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cgetrs((rocblas_handle)handle,
+                                                                   hip2rocblas_operation(trans),
+                                                                   n,
+                                                                   nrhs,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   ldb));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             hipDoubleComplex*    B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zgetrs((rocblas_handle)handle,
+                                                                   hip2rocblas_operation(trans),
+                                                                   n,
+                                                                   nrhs,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   ldb));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  float*               A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  float*               B,
+                                  int                  ldb,
+                                  float*               work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    bool host;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_dispatch((rocblas_handle)handle,
+                                                 hip2rocblas_operation(trans),
+                                                 n,
+                                                 nrhs,
+                                                 A,
+                                                 lda,
+                                                 devIpiv,
+                                                 B,
+                                                 ldb,
+                                                 &host));
+    if(host)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSgetrs_bufferSize(
+            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_sgetrs(
+        (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, A, lda, devIpiv, B, ldb));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  double*              A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  double*              B,
+                                  int                  ldb,
+                                  double*              work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    bool host;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_dispatch((rocblas_handle)handle,
+                                                 hip2rocblas_operation(trans),
+                                                 n,
+                                                 nrhs,
+                                                 A,
+                                                 lda,
+                                                 devIpiv,
+                                                 B,
+                                                 ldb,
+                                                 &host));
+    if(host)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDgetrs_bufferSize(
+            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_dgetrs(
+        (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, A, lda, devIpiv, B, ldb));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  hipFloatComplex*     A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  hipFloatComplex*     B,
+                                  int                  ldb,
+                                  hipFloatComplex*     work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    bool host;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_dispatch((rocblas_handle)handle,
+                                                 hip2rocblas_operation(trans),
+                                                 n,
+                                                 nrhs,
+                                                 (rocblas_float_complex*)A,
+                                                 lda,
+                                                 devIpiv,
+                                                 (rocblas_float_complex*)B,
+                                                 ldb,
+                                                 &host));
+    if(host)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCgetrs_bufferSize(
+            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_cgetrs((rocblas_handle)handle,
+                                               hip2rocblas_operation(trans),
+                                               n,
+                                               nrhs,
+                                               (rocblas_float_complex*)A,
+                                               lda,
+                                               devIpiv,
+                                               (rocblas_float_complex*)B,
+                                               ldb));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  hipDoubleComplex*    A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  hipDoubleComplex*    B,
+                                  int                  ldb,
+                                  hipDoubleComplex*    work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    bool host;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_dispatch((rocblas_handle)handle,
+                                                 hip2rocblas_operation(trans),
+                                                 n,
+                                                 nrhs,
+                                                 (rocblas_double_complex*)A,
+                                                 lda,
+                                                 devIpiv,
+                                                 (rocblas_double_complex*)B,
+                                                 ldb,
+                                                 &host));
+    if(host)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZgetrs_bufferSize(
+            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_zgetrs((rocblas_handle)handle,
+                                               hip2rocblas_operation(trans),
+                                               n,
+                                               nrhs,
+                                               (rocblas_double_complex*)A,
+                                               lda,
+                                               devIpiv,
+                                               (rocblas_double_complex*)B,
+                                               ldb));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRF_HOST ********************/
+hipsolverStatus_t hipsolverSgetrfHost(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* ipiv, int* info)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_host_argCheck((rocblas_handle)handle, m, n, lda, A, info));
+
+    size_t size_host, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_host_size<float>(
+        (rocblas_handle)handle, m, n, ipiv != nullptr, false, &size_host, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_host);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrf_host_template(
+        (rocblas_handle)handle, m, n, A, lda, ipiv, info, mem[0]));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrfHost(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* ipiv, int* info)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_host_argCheck((rocblas_handle)handle, m, n, lda, A, info));
+
+    size_t size_host, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_host_size<double>(
+        (rocblas_handle)handle, m, n, ipiv != nullptr, false, &size_host, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_host);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrf_host_template(
+        (rocblas_handle)handle, m, n, A, lda, ipiv, info, mem[0]));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrfHost(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* ipiv, int* info)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_host_argCheck((rocblas_handle)handle, m, n, lda, A, info));
+
+    size_t size_host, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_host_size<rocblas_float_complex>(
+        (rocblas_handle)handle, m, n, ipiv != nullptr, false, &size_host, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_host);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrf_host_template(
+        (rocblas_handle)handle, m, n, (rocblas_float_complex*)A, lda, ipiv, info, mem[0]));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrfHost(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* ipiv, int* info)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_host_argCheck((rocblas_handle)handle, m, n, lda, A, info));
+
+    size_t size_host, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_host_size<rocblas_double_complex>(
+        (rocblas_handle)handle, m, n, ipiv != nullptr, false, &size_host, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_host);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrf_host_template(
+        (rocblas_handle)handle, m, n, (rocblas_double_complex*)A, lda, ipiv, info, mem[0]));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRF_BATCHED_HOST ********************/
+hipsolverStatus_t hipsolverSgetrfBatchedHost(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             float*            A[],
+                                             int               lda,
+                                             int*              ipiv,
+                                             int               strideP,
+                                             int*              info,
+                                             int               batch_count)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_host_argCheck(
+        (rocblas_handle)handle, m, n, lda, A, info, batch_count));
+
+    size_t size_host, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_host_size<float>(
+        (rocblas_handle)handle, m, n, ipiv != nullptr, true, &size_host, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_host);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrf_batched_host_template(
+        (rocblas_handle)handle, m, n, A, lda, ipiv, strideP, info, batch_count, mem[0]));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrfBatchedHost(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             double*           A[],
+                                             int               lda,
+                                             int*              ipiv,
+                                             int               strideP,
+                                             int*              info,
+                                             int               batch_count)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_host_argCheck(
+        (rocblas_handle)handle, m, n, lda, A, info, batch_count));
+
+    size_t size_host, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_host_size<double>(
+        (rocblas_handle)handle, m, n, ipiv != nullptr, true, &size_host, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_host);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrf_batched_host_template(
+        (rocblas_handle)handle, m, n, A, lda, ipiv, strideP, info, batch_count, mem[0]));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrfBatchedHost(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipFloatComplex*  A[],
+                                             int               lda,
+                                             int*              ipiv,
+                                             int               strideP,
+                                             int*              info,
+                                             int               batch_count)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_host_argCheck(
+        (rocblas_handle)handle, m, n, lda, A, info, batch_count));
+
+    size_t size_host, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_host_size<rocblas_float_complex>(
+        (rocblas_handle)handle, m, n, ipiv != nullptr, true, &size_host, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_host);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrf_batched_host_template((rocblas_handle)handle,
+                                                                    m,
+                                                                    n,
+                                                                    (rocblas_float_complex**)A,
+                                                                    lda,
+                                                                    ipiv,
+                                                                    strideP,
+                                                                    info,
+                                                                    batch_count,
+                                                                    mem[0]));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrfBatchedHost(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipDoubleComplex* A[],
+                                             int               lda,
+                                             int*              ipiv,
+                                             int               strideP,
+                                             int*              info,
+                                             int               batch_count)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_host_argCheck(
+        (rocblas_handle)handle, m, n, lda, A, info, batch_count));
+
+    size_t size_host, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_host_size<rocblas_double_complex>(
+        (rocblas_handle)handle, m, n, ipiv != nullptr, true, &size_host, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_host);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrf_batched_host_template((rocblas_handle)handle,
+                                                                    m,
+                                                                    n,
+                                                                    (rocblas_double_complex**)A,
+                                                                    lda,
+                                                                    ipiv,
+                                                                    strideP,
+                                                                    info,
+                                                                    batch_count,
+                                                                    mem[0]));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRS_HOST ********************/
+hipsolverStatus_t hipsolverSgetrsHost(hipsolverHandle_t    handle,
+                                      hipsolverOperation_t trans,
+                                      int                  n,
+                                      int                  nrhs,
+                                      const float*         A,
+                                      int                  lda,
+                                      const int*           ipiv,
+                                      float*               B,
+                                      int                  ldb,
+                                      int*                 info)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_host_argCheck(
+        (rocblas_handle)handle, n, nrhs, lda, ldb, A, ipiv, B, info));
+
+    size_t size_host, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_host_size<float>(
+        (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, false, &size_host, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_host);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrs_host_template((rocblas_handle)handle,
+                                                            hip2rocblas_operation(trans),
+                                                            n,
+                                                            nrhs,
+                                                            A,
+                                                            lda,
+                                                            ipiv,
+                                                            B,
+                                                            ldb,
+                                                            info,
+                                                            mem[0]));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrsHost(hipsolverHandle_t    handle,
+                                      hipsolverOperation_t trans,
+                                      int                  n,
+                                      int                  nrhs,
+                                      const double*        A,
+                                      int                  lda,
+                                      const int*           ipiv,
+                                      double*              B,
+                                      int                  ldb,
+                                      int*                 info)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_host_argCheck(
+        (rocblas_handle)handle, n, nrhs, lda, ldb, A, ipiv, B, info));
+
+    size_t size_host, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_host_size<double>(
+        (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, false, &size_host, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_host);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrs_host_template((rocblas_handle)handle,
+                                                            hip2rocblas_operation(trans),
+                                                            n,
+                                                            nrhs,
+                                                            A,
+                                                            lda,
+                                                            ipiv,
+                                                            B,
+                                                            ldb,
+                                                            info,
+                                                            mem[0]));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrsHost(hipsolverHandle_t      handle,
+                                      hipsolverOperation_t   trans,
+                                      int                    n,
+                                      int                    nrhs,
+                                      const hipFloatComplex* A,
+                                      int                    lda,
+                                      const int*             ipiv,
+                                      hipFloatComplex*       B,
+                                      int                    ldb,
+                                      int*                   info)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_host_argCheck(
+        (rocblas_handle)handle, n, nrhs, lda, ldb, A, ipiv, B, info));
+
+    size_t size_host, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_host_size<rocblas_float_complex>(
+        (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, false, &size_host, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_host);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrs_host_template((rocblas_handle)handle,
+                                                            hip2rocblas_operation(trans),
+                                                            n,
+                                                            nrhs,
+                                                            (const rocblas_float_complex*)A,
+                                                            lda,
+                                                            ipiv,
+                                                            (rocblas_float_complex*)B,
+                                                            ldb,
+                                                            info,
+                                                            mem[0]));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrsHost(hipsolverHandle_t       handle,
+                                      hipsolverOperation_t    trans,
+                                      int                     n,
+                                      int                     nrhs,
+                                      const hipDoubleComplex* A,
+                                      int                     lda,
+                                      const int*              ipiv,
+                                      hipDoubleComplex*       B,
+                                      int                     ldb,
+                                      int*                    info)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_host_argCheck(
+        (rocblas_handle)handle, n, nrhs, lda, ldb, A, ipiv, B, info));
+
+    size_t size_host, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_host_size<rocblas_double_complex>(
+        (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, false, &size_host, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_host);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrs_host_template((rocblas_handle)handle,
+                                                            hip2rocblas_operation(trans),
+                                                            n,
+                                                            nrhs,
+                                                            (const rocblas_double_complex*)A,
+                                                            lda,
+                                                            ipiv,
+                                                            (rocblas_double_complex*)B,
+                                                            ldb,
+                                                            info,
+                                                            mem[0]));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRS_BATCHED_HOST ********************/
+hipsolverStatus_t hipsolverSgetrsBatchedHost(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             float*               A[],
+                                             int                  lda,
+                                             const int*           ipiv,
+                                             int                  strideP,
+                                             float*               B[],
+                                             int                  ldb,
+                                             int*                 info,
+                                             int                  batch_count)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_host_argCheck(
+        (rocblas_handle)handle, n, nrhs, lda, ldb, A, ipiv, B, info, batch_count));
+
+    size_t size_host, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_host_size<float>(
+        (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, true, &size_host, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_host);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrs_batched_host_template((rocblas_handle)handle,
+                                                                    hip2rocblas_operation(trans),
+                                                                    n,
+                                                                    nrhs,
+                                                                    A,
+                                                                    lda,
+                                                                    ipiv,
+                                                                    strideP,
+                                                                    B,
+                                                                    ldb,
+                                                                    info,
+                                                                    batch_count,
+                                                                    mem[0]));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrsBatchedHost(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             double*              A[],
+                                             int                  lda,
+                                             const int*           ipiv,
+                                             int                  strideP,
+                                             double*              B[],
+                                             int                  ldb,
+                                             int*                 info,
+                                             int                  batch_count)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_host_argCheck(
+        (rocblas_handle)handle, n, nrhs, lda, ldb, A, ipiv, B, info, batch_count));
+
+    size_t size_host, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_host_size<double>(
+        (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, true, &size_host, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_host);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrs_batched_host_template((rocblas_handle)handle,
+                                                                    hip2rocblas_operation(trans),
+                                                                    n,
+                                                                    nrhs,
+                                                                    A,
+                                                                    lda,
+                                                                    ipiv,
+                                                                    strideP,
+                                                                    B,
+                                                                    ldb,
+                                                                    info,
+                                                                    batch_count,
+                                                                    mem[0]));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrsBatchedHost(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipFloatComplex*     A[],
+                                             int                  lda,
+                                             const int*           ipiv,
+                                             int                  strideP,
+                                             hipFloatComplex*     B[],
+                                             int                  ldb,
+                                             int*                 info,
+                                             int                  batch_count)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_host_argCheck(
+        (rocblas_handle)handle, n, nrhs, lda, ldb, A, ipiv, B, info, batch_count));
+
+    size_t size_host, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_host_size<rocblas_float_complex>(
+        (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, true, &size_host, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_host);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrs_batched_host_template((rocblas_handle)handle,
+                                                                    hip2rocblas_operation(trans),
+                                                                    n,
+                                                                    nrhs,
+                                                                    (rocblas_float_complex**)A,
+                                                                    lda,
+                                                                    ipiv,
+                                                                    strideP,
+                                                                    (rocblas_float_complex**)B,
+                                                                    ldb,
+                                                                    info,
+                                                                    batch_count,
+                                                                    mem[0]));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrsBatchedHost(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipDoubleComplex*    A[],
+                                             int                  lda,
+                                             const int*           ipiv,
+                                             int                  strideP,
+                                             hipDoubleComplex*    B[],
+                                             int                  ldb,
+                                             int*                 info,
+                                             int                  batch_count)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_host_argCheck(
+        (rocblas_handle)handle, n, nrhs, lda, ldb, A, ipiv, B, info, batch_count));
+
+    size_t size_host, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_getrs_host_size<rocblas_double_complex>(
+        (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, true, &size_host, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_host);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrs_batched_host_template((rocblas_handle)handle,
+                                                                    hip2rocblas_operation(trans),
+                                                                    n,
+                                                                    nrhs,
+                                                                    (rocblas_double_complex**)A,
+                                                                    lda,
+                                                                    ipiv,
+                                                                    strideP,
+                                                                    (rocblas_double_complex**)B,
+                                                                    ldb,
+                                                                    info,
+                                                                    batch_count,
+                                                                    mem[0]));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRF_COMPACT ********************/
+hipsolverStatus_t hipsolverSgetrfCompact(hipsolverHandle_t handle,
+                                         int               n,
+                                         float*            Ac,
+                                         int*              devIpiv,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_argCheck((rocblas_handle)handle, n, 0, batch_count));
+
+    size_t size_work, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_size<float>(
+        (rocblas_handle)handle, 'F', n, 0, batch_count, &size_work, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_work);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_compact_template(
+        (rocblas_handle)handle, n, Ac, devIpiv, devInfo, batch_count, mem[0]));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrfCompact(hipsolverHandle_t handle,
+                                         int               n,
+                                         double*           Ac,
+                                         int*              devIpiv,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_argCheck((rocblas_handle)handle, n, 0, batch_count));
+
+    size_t size_work, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_size<double>(
+        (rocblas_handle)handle, 'F', n, 0, batch_count, &size_work, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_work);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_compact_template(
+        (rocblas_handle)handle, n, Ac, devIpiv, devInfo, batch_count, mem[0]));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrfCompact(hipsolverHandle_t handle,
+                                         int               n,
+                                         hipFloatComplex*  Ac,
+                                         int*              devIpiv,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_argCheck((rocblas_handle)handle, n, 0, batch_count));
+
+    size_t size_work, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_size<rocblas_float_complex>(
+        (rocblas_handle)handle, 'F', n, 0, batch_count, &size_work, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_work);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_compact_template((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_float_complex*)Ac,
+                                                         devIpiv,
+                                                         devInfo,
+                                                         batch_count,
+                                                         mem[0]));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrfCompact(hipsolverHandle_t handle,
+                                         int               n,
+                                         hipDoubleComplex* Ac,
+                                         int*              devIpiv,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_argCheck((rocblas_handle)handle, n, 0, batch_count));
+
+    size_t size_work, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_size<rocblas_double_complex>(
+        (rocblas_handle)handle, 'F', n, 0, batch_count, &size_work, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_work);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_compact_template((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_double_complex*)Ac,
+                                                         devIpiv,
+                                                         devInfo,
+                                                         batch_count,
+                                                         mem[0]));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRS_COMPACT ********************/
+hipsolverStatus_t hipsolverSgetrsCompact(hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         const float*         Ac,
+                                         const int*           devIpiv,
+                                         float*               Bc,
+                                         int*                 devInfo,
+                                         int                  batch_count)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_argCheck((rocblas_handle)handle, n, nrhs, batch_count));
+
+    size_t size_work, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_size<float>(
+        (rocblas_handle)handle, 'S', n, nrhs, batch_count, &size_work, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_work);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrs_compact_template((rocblas_handle)handle,
+                                                               hip2rocblas_operation(trans),
+                                                               n,
+                                                               nrhs,
+                                                               Ac,
+                                                               devIpiv,
+                                                               Bc,
+                                                               devInfo,
+                                                               batch_count,
+                                                               mem[0]));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrsCompact(hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         const double*        Ac,
+                                         const int*           devIpiv,
+                                         double*              Bc,
+                                         int*                 devInfo,
+                                         int                  batch_count)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_argCheck((rocblas_handle)handle, n, nrhs, batch_count));
+
+    size_t size_work, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_size<double>(
+        (rocblas_handle)handle, 'S', n, nrhs, batch_count, &size_work, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_work);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrs_compact_template((rocblas_handle)handle,
+                                                               hip2rocblas_operation(trans),
+                                                               n,
+                                                               nrhs,
+                                                               Ac,
+                                                               devIpiv,
+                                                               Bc,
+                                                               devInfo,
+                                                               batch_count,
+                                                               mem[0]));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCungtr(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipFloatComplex*    A,
-                                  int                 lda,
-                                  hipFloatComplex*    tau,
-                                  hipFloatComplex*    work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverCgetrsCompact(hipsolverHandle_t      handle,
+                                         hipsolverOperation_t   trans,
+                                         int                    n,
+                                         int                    nrhs,
+                                         const hipFloatComplex* Ac,
+                                         const int*             devIpiv,
+                                         hipFloatComplex*       Bc,
+                                         int*                   devInfo,
+                                         int                    batch_count)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverCungtr_bufferSize((rocblas_handle)handle, uplo, n, A, lda, tau, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_argCheck((rocblas_handle)handle, n, nrhs, batch_count));
 
-    return rocblas2hip_status(rocsolver_cungtr((rocblas_handle)handle,
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               (rocblas_float_complex*)A,
-                                               lda,
-                                               (rocblas_float_complex*)tau));
+    size_t size_work, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_size<rocblas_float_complex>(
+        (rocblas_handle)handle, 'S', n, nrhs, batch_count, &size_work, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_work);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrs_compact_template((rocblas_handle)handle,
+                                                               hip2rocblas_operation(trans),
+                                                               n,
+                                                               nrhs,
+                                                               (const rocblas_float_complex*)Ac,
+                                                               devIpiv,
+                                                               (rocblas_float_complex*)Bc,
+                                                               devInfo,
+                                                               batch_count,
+                                                               mem[0]));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZungtr(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipDoubleComplex*   A,
-                                  int                 lda,
-                                  hipDoubleComplex*   tau,
-                                  hipDoubleComplex*   work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverZgetrsCompact(hipsolverHandle_t       handle,
+                                         hipsolverOperation_t    trans,
+                                         int                     n,
+                                         int                     nrhs,
+                                         const hipDoubleComplex* Ac,
+                                         const int*              devIpiv,
+                                         hipDoubleComplex*       Bc,
+                                         int*                    devInfo,
+                                         int                     batch_count)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverZungtr_bufferSize((rocblas_handle)handle, uplo, n, A, lda, tau, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_argCheck((rocblas_handle)handle, n, nrhs, batch_count));
 
-    return rocblas2hip_status(rocsolver_zungtr((rocblas_handle)handle,
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               (rocblas_double_complex*)A,
-                                               lda,
-                                               (rocblas_double_complex*)tau));
+    size_t size_work, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_size<rocblas_double_complex>(
+        (rocblas_handle)handle, 'S', n, nrhs, batch_count, &size_work, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_work);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_getrs_compact_template((rocblas_handle)handle,
+                                                               hip2rocblas_operation(trans),
+                                                               n,
+                                                               nrhs,
+                                                               (const rocblas_double_complex*)Ac,
+                                                               devIpiv,
+                                                               (rocblas_double_complex*)Bc,
+                                                               devInfo,
+                                                               batch_count,
+                                                               mem[0]));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** ORMQR/UNMQR ********************/
-hipsolverStatus_t hipsolverSormqr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             int                  k,
-                                             float*               A,
-                                             int                  lda,
-                                             float*               tau,
-                                             float*               C,
-                                             int                  ldc,
-                                             int*                 lwork)
+/******************** MG_GETRF ********************/
+hipsolverStatus_t hipsolverMgSgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               int                     m,
+                                               int                     n,
+                                               float*                  A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    ipiv[],
+                                               int*                    lwork)
 try
 {
     if(lwork == nullptr)
@@ -1090,20 +7950,18 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_sormqr((rocblas_handle)handle,
-                                                                   hip2rocblas_side(side),
-                                                                   hip2rocblas_operation(trans),
-                                                                   m,
-                                                                   n,
-                                                                   k,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   ldc));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_mg_bufferSize_template<float>(
+            (hipsolver_mg_handle*)handle,
+            hipsolver_mg_lu,
+            false,
+            false,
+            m,
+            n,
+            ia,
+            ja,
+            (hipsolver_mg_desc*)descA,
+            &sz));
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -1117,18 +7975,15 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDormqr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             int                  k,
-                                             double*              A,
-                                             int                  lda,
-                                             double*              tau,
-                                             double*              C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverMgDgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               int                     m,
+                                               int                     n,
+                                               double*                 A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    ipiv[],
+                                               int*                    lwork)
 try
 {
     if(lwork == nullptr)
@@ -1137,20 +7992,18 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dormqr((rocblas_handle)handle,
-                                                                   hip2rocblas_side(side),
-                                                                   hip2rocblas_operation(trans),
-                                                                   m,
-                                                                   n,
-                                                                   k,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   ldc));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_mg_bufferSize_template<double>(
+            (hipsolver_mg_handle*)handle,
+            hipsolver_mg_lu,
+            false,
+            false,
+            m,
+            n,
+            ia,
+            ja,
+            (hipsolver_mg_desc*)descA,
+            &sz));
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -1164,18 +8017,15 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCunmqr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             int                  k,
-                                             hipFloatComplex*     A,
-                                             int                  lda,
-                                             hipFloatComplex*     tau,
-                                             hipFloatComplex*     C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverMgCgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               int                     m,
+                                               int                     n,
+                                               hipFloatComplex*        A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    ipiv[],
+                                               int*                    lwork)
 try
 {
     if(lwork == nullptr)
@@ -1184,20 +8034,18 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cunmqr((rocblas_handle)handle,
-                                                                   hip2rocblas_side(side),
-                                                                   hip2rocblas_operation(trans),
-                                                                   m,
-                                                                   n,
-                                                                   k,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   ldc));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_mg_bufferSize_template<rocblas_float_complex>(
+            (hipsolver_mg_handle*)handle,
+            hipsolver_mg_lu,
+            false,
+            false,
+            m,
+            n,
+            ia,
+            ja,
+            (hipsolver_mg_desc*)descA,
+            &sz));
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -1211,18 +8059,15 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZunmqr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             int                  k,
-                                             hipDoubleComplex*    A,
-                                             int                  lda,
-                                             hipDoubleComplex*    tau,
-                                             hipDoubleComplex*    C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverMgZgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               int                     m,
+                                               int                     n,
+                                               hipDoubleComplex*       A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    ipiv[],
+                                               int*                    lwork)
 try
 {
     if(lwork == nullptr)
@@ -1231,20 +8076,18 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zunmqr((rocblas_handle)handle,
-                                                                   hip2rocblas_side(side),
-                                                                   hip2rocblas_operation(trans),
-                                                                   m,
-                                                                   n,
-                                                                   k,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   ldc));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_mg_bufferSize_template<rocblas_double_complex>(
+            (hipsolver_mg_handle*)handle,
+            hipsolver_mg_lu,
+            false,
+            false,
+            m,
+            n,
+            ia,
+            ja,
+            (hipsolver_mg_desc*)descA,
+            &sz));
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -1258,187 +8101,183 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSormqr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  int                  k,
-                                  float*               A,
-                                  int                  lda,
-                                  float*               tau,
-                                  float*               C,
-                                  int                  ldc,
-                                  float*               work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverMgSgetrf(hipsolverMgHandle_t     handle,
+                                    int                     m,
+                                    int                     n,
+                                    float*                  A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    int*                    ipiv[],
+                                    float*                  work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(hipsolverSormqr_bufferSize(
-            (rocblas_handle)handle, side, trans, m, n, k, A, lda, tau, C, ldc, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
-
-    return rocblas2hip_status(rocsolver_sormqr((rocblas_handle)handle,
-                                               hip2rocblas_side(side),
-                                               hip2rocblas_operation(trans),
-                                               m,
-                                               n,
-                                               k,
-                                               A,
-                                               lda,
-                                               tau,
-                                               C,
-                                               ldc));
-}
-catch(...)
-{
-    return exception2hip_status();
-}
+    int size_work;
+    CHECK_HIPSOLVER_ERROR(
+        hipsolverMgSgetrf_bufferSize(handle, m, n, A, ia, ja, descA, ipiv, &size_work));
 
-hipsolverStatus_t hipsolverDormqr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  int                  k,
-                                  double*              A,
-                                  int                  lda,
-                                  double*              tau,
-                                  double*              C,
-                                  int                  ldc,
-                                  double*              work,
-                                  int                  lwork,
-                                  int*                 devInfo)
-try
-{
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(hipsolverDormqr_bufferSize(
-            (rocblas_handle)handle, side, trans, m, n, k, A, lda, tau, C, ldc, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    if(work != nullptr && lwork < size_work)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    return rocblas2hip_status(rocsolver_dormqr((rocblas_handle)handle,
-                                               hip2rocblas_side(side),
-                                               hip2rocblas_operation(trans),
-                                               m,
-                                               n,
-                                               k,
-                                               A,
-                                               lda,
-                                               tau,
-                                               C,
-                                               ldc));
+    // the workspace is allocated on each device if not provided
+    return rocblas2hip_status(hipsolver_mg_template((hipsolver_mg_handle*)handle,
+                                                    hipsolver_mg_lu,
+                                                    false,
+                                                    false,
+                                                    m,
+                                                    n,
+                                                    A,
+                                                    ia,
+                                                    ja,
+                                                    (hipsolver_mg_desc*)descA,
+                                                    ipiv,
+                                                    (float*)nullptr,
+                                                    (void**)work,
+                                                    work ? size_t(lwork) : 0,
+                                                    info));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCunmqr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  int                  k,
-                                  hipFloatComplex*     A,
-                                  int                  lda,
-                                  hipFloatComplex*     tau,
-                                  hipFloatComplex*     C,
-                                  int                  ldc,
-                                  hipFloatComplex*     work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverMgDgetrf(hipsolverMgHandle_t     handle,
+                                    int                     m,
+                                    int                     n,
+                                    double*                 A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    int*                    ipiv[],
+                                    double*                 work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(hipsolverCunmqr_bufferSize(
-            (rocblas_handle)handle, side, trans, m, n, k, A, lda, tau, C, ldc, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    int size_work;
+    CHECK_HIPSOLVER_ERROR(
+        hipsolverMgDgetrf_bufferSize(handle, m, n, A, ia, ja, descA, ipiv, &size_work));
 
-    return rocblas2hip_status(rocsolver_cunmqr((rocblas_handle)handle,
-                                               hip2rocblas_side(side),
-                                               hip2rocblas_operation(trans),
-                                               m,
-                                               n,
-                                               k,
-                                               (rocblas_float_complex*)A,
-                                               lda,
-                                               (rocblas_float_complex*)tau,
-                                               (rocblas_float_complex*)C,
-                                               ldc));
+    if(work != nullptr && lwork < size_work)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the workspace is allocated on each device if not provided
+    return rocblas2hip_status(hipsolver_mg_template((hipsolver_mg_handle*)handle,
+                                                    hipsolver_mg_lu,
+                                                    false,
+                                                    false,
+                                                    m,
+                                                    n,
+                                                    A,
+                                                    ia,
+                                                    ja,
+                                                    (hipsolver_mg_desc*)descA,
+                                                    ipiv,
+                                                    (double*)nullptr,
+                                                    (void**)work,
+                                                    work ? size_t(lwork) : 0,
+                                                    info));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZunmqr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  int                  k,
-                                  hipDoubleComplex*    A,
-                                  int                  lda,
-                                  hipDoubleComplex*    tau,
-                                  hipDoubleComplex*    C,
-                                  int                  ldc,
-                                  hipDoubleComplex*    work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverMgCgetrf(hipsolverMgHandle_t     handle,
+                                    int                     m,
+                                    int                     n,
+                                    hipFloatComplex*        A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    int*                    ipiv[],
+                                    hipFloatComplex*        work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(hipsolverZunmqr_bufferSize(
-            (rocblas_handle)handle, side, trans, m, n, k, A, lda, tau, C, ldc, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    int size_work;
+    CHECK_HIPSOLVER_ERROR(
+        hipsolverMgCgetrf_bufferSize(handle, m, n, A, ia, ja, descA, ipiv, &size_work));
 
-    return rocblas2hip_status(rocsolver_zunmqr((rocblas_handle)handle,
-                                               hip2rocblas_side(side),
-                                               hip2rocblas_operation(trans),
-                                               m,
-                                               n,
-                                               k,
-                                               (rocblas_double_complex*)A,
-                                               lda,
-                                               (rocblas_double_complex*)tau,
-                                               (rocblas_double_complex*)C,
-                                               ldc));
+    if(work != nullptr && lwork < size_work)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the workspace is allocated on each device if not provided
+    return rocblas2hip_status(hipsolver_mg_template((hipsolver_mg_handle*)handle,
+                                                    hipsolver_mg_lu,
+                                                    false,
+                                                    false,
+                                                    m,
+                                                    n,
+                                                    (rocblas_float_complex**)A,
+                                                    ia,
+                                                    ja,
+                                                    (hipsolver_mg_desc*)descA,
+                                                    ipiv,
+                                                    (float*)nullptr,
+                                                    (void**)work,
+                                                    work ? size_t(lwork) : 0,
+                                                    info));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** ORMTR/UNMTR ********************/
-hipsolverStatus_t hipsolverSormtr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverFillMode_t  uplo,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             float*               A,
-                                             int                  lda,
-                                             float*               tau,
-                                             float*               C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverMgZgetrf(hipsolverMgHandle_t     handle,
+                                    int                     m,
+                                    int                     n,
+                                    hipDoubleComplex*       A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    int*                    ipiv[],
+                                    hipDoubleComplex*       work[],
+                                    int                     lwork,
+                                    int*                    info)
+try
+{
+    int size_work;
+    CHECK_HIPSOLVER_ERROR(
+        hipsolverMgZgetrf_bufferSize(handle, m, n, A, ia, ja, descA, ipiv, &size_work));
+
+    if(work != nullptr && lwork < size_work)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the workspace is allocated on each device if not provided
+    return rocblas2hip_status(hipsolver_mg_template((hipsolver_mg_handle*)handle,
+                                                    hipsolver_mg_lu,
+                                                    false,
+                                                    false,
+                                                    m,
+                                                    n,
+                                                    (rocblas_double_complex**)A,
+                                                    ia,
+                                                    ja,
+                                                    (hipsolver_mg_desc*)descA,
+                                                    ipiv,
+                                                    (double*)nullptr,
+                                                    (void**)work,
+                                                    work ? size_t(lwork) : 0,
+                                                    info));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** MG_POTRF ********************/
+hipsolverStatus_t hipsolverMgSpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               float*                  A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    lwork)
 try
 {
     if(lwork == nullptr)
@@ -1447,20 +8286,20 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_sormtr((rocblas_handle)handle,
-                                                                   hip2rocblas_side(side),
-                                                                   hip2rocblas_fill(uplo),
-                                                                   hip2rocblas_operation(trans),
-                                                                   m,
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   ldc));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    bool upper = hip2rocblas_fill(uplo) == rocblas_fill_upper;
 
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_mg_bufferSize_template<float>(
+            (hipsolver_mg_handle*)handle,
+            hipsolver_mg_cholesky,
+            upper,
+            false,
+            n,
+            n,
+            ia,
+            ja,
+            (hipsolver_mg_desc*)descA,
+            &sz));
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -1474,18 +8313,14 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDormtr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverFillMode_t  uplo,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             double*              A,
-                                             int                  lda,
-                                             double*              tau,
-                                             double*              C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverMgDpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               double*                 A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    lwork)
 try
 {
     if(lwork == nullptr)
@@ -1494,20 +8329,20 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dormtr((rocblas_handle)handle,
-                                                                   hip2rocblas_side(side),
-                                                                   hip2rocblas_fill(uplo),
-                                                                   hip2rocblas_operation(trans),
-                                                                   m,
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   ldc));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    bool upper = hip2rocblas_fill(uplo) == rocblas_fill_upper;
 
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_mg_bufferSize_template<double>(
+            (hipsolver_mg_handle*)handle,
+            hipsolver_mg_cholesky,
+            upper,
+            false,
+            n,
+            n,
+            ia,
+            ja,
+            (hipsolver_mg_desc*)descA,
+            &sz));
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -1521,18 +8356,14 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCunmtr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverFillMode_t  uplo,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             hipFloatComplex*     A,
-                                             int                  lda,
-                                             hipFloatComplex*     tau,
-                                             hipFloatComplex*     C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverMgCpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipFloatComplex*        A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    lwork)
 try
 {
     if(lwork == nullptr)
@@ -1541,20 +8372,20 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cunmtr((rocblas_handle)handle,
-                                                                   hip2rocblas_side(side),
-                                                                   hip2rocblas_fill(uplo),
-                                                                   hip2rocblas_operation(trans),
-                                                                   m,
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   ldc));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    bool upper = hip2rocblas_fill(uplo) == rocblas_fill_upper;
 
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_mg_bufferSize_template<rocblas_float_complex>(
+            (hipsolver_mg_handle*)handle,
+            hipsolver_mg_cholesky,
+            upper,
+            false,
+            n,
+            n,
+            ia,
+            ja,
+            (hipsolver_mg_desc*)descA,
+            &sz));
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -1568,18 +8399,14 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZunmtr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverFillMode_t  uplo,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             hipDoubleComplex*    A,
-                                             int                  lda,
-                                             hipDoubleComplex*    tau,
-                                             hipDoubleComplex*    C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverMgZpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipDoubleComplex*       A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    lwork)
 try
 {
     if(lwork == nullptr)
@@ -1588,20 +8415,20 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zunmtr((rocblas_handle)handle,
-                                                                   hip2rocblas_side(side),
-                                                                   hip2rocblas_fill(uplo),
-                                                                   hip2rocblas_operation(trans),
-                                                                   m,
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   ldc));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    bool upper = hip2rocblas_fill(uplo) == rocblas_fill_upper;
 
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_mg_bufferSize_template<rocblas_double_complex>(
+            (hipsolver_mg_handle*)handle,
+            hipsolver_mg_cholesky,
+            upper,
+            false,
+            n,
+            n,
+            ia,
+            ja,
+            (hipsolver_mg_desc*)descA,
+            &sz));
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -1615,176 +8442,185 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSormtr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverFillMode_t  uplo,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  float*               A,
-                                  int                  lda,
-                                  float*               tau,
-                                  float*               C,
-                                  int                  ldc,
-                                  float*               work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverMgSpotrf(hipsolverMgHandle_t     handle,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    float*                  A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    float*                  work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(hipsolverSormtr_bufferSize(
-            (rocblas_handle)handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    int  size_work;
+    bool upper = hip2rocblas_fill(uplo) == rocblas_fill_upper;
+    CHECK_HIPSOLVER_ERROR(
+        hipsolverMgSpotrf_bufferSize(handle, uplo, n, A, ia, ja, descA, &size_work));
 
-    return rocblas2hip_status(rocsolver_sormtr((rocblas_handle)handle,
-                                               hip2rocblas_side(side),
-                                               hip2rocblas_fill(uplo),
-                                               hip2rocblas_operation(trans),
-                                               m,
-                                               n,
-                                               A,
-                                               lda,
-                                               tau,
-                                               C,
-                                               ldc));
+    if(work != nullptr && lwork < size_work)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the workspace is allocated on each device if not provided
+    return rocblas2hip_status(hipsolver_mg_template((hipsolver_mg_handle*)handle,
+                                                    hipsolver_mg_cholesky,
+                                                    upper,
+                                                    false,
+                                                    n,
+                                                    n,
+                                                    A,
+                                                    ia,
+                                                    ja,
+                                                    (hipsolver_mg_desc*)descA,
+                                                    (int**)nullptr,
+                                                    (float*)nullptr,
+                                                    (void**)work,
+                                                    work ? size_t(lwork) : 0,
+                                                    info));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDormtr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverFillMode_t  uplo,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  double*              A,
-                                  int                  lda,
-                                  double*              tau,
-                                  double*              C,
-                                  int                  ldc,
-                                  double*              work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverMgDpotrf(hipsolverMgHandle_t     handle,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    double*                 A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    double*                 work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(hipsolverDormtr_bufferSize(
-            (rocblas_handle)handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    int  size_work;
+    bool upper = hip2rocblas_fill(uplo) == rocblas_fill_upper;
+    CHECK_HIPSOLVER_ERROR(
+        hipsolverMgDpotrf_bufferSize(handle, uplo, n, A, ia, ja, descA, &size_work));
 
-    return rocblas2hip_status(rocsolver_dormtr((rocblas_handle)handle,
-                                               hip2rocblas_side(side),
-                                               hip2rocblas_fill(uplo),
-                                               hip2rocblas_operation(trans),
-                                               m,
-                                               n,
-                                               A,
-                                               lda,
-                                               tau,
-                                               C,
-                                               ldc));
-}
-catch(...)
-{
-    return exception2hip_status();
-}
+    if(work != nullptr && lwork < size_work)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-hipsolverStatus_t hipsolverCunmtr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverFillMode_t  uplo,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  hipFloatComplex*     A,
-                                  int                  lda,
-                                  hipFloatComplex*     tau,
-                                  hipFloatComplex*     C,
-                                  int                  ldc,
-                                  hipFloatComplex*     work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+    // the workspace is allocated on each device if not provided
+    return rocblas2hip_status(hipsolver_mg_template((hipsolver_mg_handle*)handle,
+                                                    hipsolver_mg_cholesky,
+                                                    upper,
+                                                    false,
+                                                    n,
+                                                    n,
+                                                    A,
+                                                    ia,
+                                                    ja,
+                                                    (hipsolver_mg_desc*)descA,
+                                                    (int**)nullptr,
+                                                    (double*)nullptr,
+                                                    (void**)work,
+                                                    work ? size_t(lwork) : 0,
+                                                    info));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgCpotrf(hipsolverMgHandle_t     handle,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    hipFloatComplex*        A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    hipFloatComplex*        work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(hipsolverCunmtr_bufferSize(
-            (rocblas_handle)handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    int  size_work;
+    bool upper = hip2rocblas_fill(uplo) == rocblas_fill_upper;
+    CHECK_HIPSOLVER_ERROR(
+        hipsolverMgCpotrf_bufferSize(handle, uplo, n, A, ia, ja, descA, &size_work));
 
-    return rocblas2hip_status(rocsolver_cunmtr((rocblas_handle)handle,
-                                               hip2rocblas_side(side),
-                                               hip2rocblas_fill(uplo),
-                                               hip2rocblas_operation(trans),
-                                               m,
-                                               n,
-                                               (rocblas_float_complex*)A,
-                                               lda,
-                                               (rocblas_float_complex*)tau,
-                                               (rocblas_float_complex*)C,
-                                               ldc));
+    if(work != nullptr && lwork < size_work)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the workspace is allocated on each device if not provided
+    return rocblas2hip_status(hipsolver_mg_template((hipsolver_mg_handle*)handle,
+                                                    hipsolver_mg_cholesky,
+                                                    upper,
+                                                    false,
+                                                    n,
+                                                    n,
+                                                    (rocblas_float_complex**)A,
+                                                    ia,
+                                                    ja,
+                                                    (hipsolver_mg_desc*)descA,
+                                                    (int**)nullptr,
+                                                    (float*)nullptr,
+                                                    (void**)work,
+                                                    work ? size_t(lwork) : 0,
+                                                    info));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZunmtr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverFillMode_t  uplo,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  hipDoubleComplex*    A,
-                                  int                  lda,
-                                  hipDoubleComplex*    tau,
-                                  hipDoubleComplex*    C,
-                                  int                  ldc,
-                                  hipDoubleComplex*    work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverMgZpotrf(hipsolverMgHandle_t     handle,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    hipDoubleComplex*       A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    hipDoubleComplex*       work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(hipsolverZunmtr_bufferSize(
-            (rocblas_handle)handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    int  size_work;
+    bool upper = hip2rocblas_fill(uplo) == rocblas_fill_upper;
+    CHECK_HIPSOLVER_ERROR(
+        hipsolverMgZpotrf_bufferSize(handle, uplo, n, A, ia, ja, descA, &size_work));
 
-    return rocblas2hip_status(rocsolver_zunmtr((rocblas_handle)handle,
-                                               hip2rocblas_side(side),
-                                               hip2rocblas_fill(uplo),
-                                               hip2rocblas_operation(trans),
-                                               m,
-                                               n,
-                                               (rocblas_double_complex*)A,
-                                               lda,
-                                               (rocblas_double_complex*)tau,
-                                               (rocblas_double_complex*)C,
-                                               ldc));
+    if(work != nullptr && lwork < size_work)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the workspace is allocated on each device if not provided
+    return rocblas2hip_status(hipsolver_mg_template((hipsolver_mg_handle*)handle,
+                                                    hipsolver_mg_cholesky,
+                                                    upper,
+                                                    false,
+                                                    n,
+                                                    n,
+                                                    (rocblas_double_complex**)A,
+                                                    ia,
+                                                    ja,
+                                                    (hipsolver_mg_desc*)descA,
+                                                    (int**)nullptr,
+                                                    (double*)nullptr,
+                                                    (void**)work,
+                                                    work ? size_t(lwork) : 0,
+                                                    info));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** GEBRD ********************/
-hipsolverStatus_t hipsolverSgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+/******************** MG_SYEVD/MG_HEEVD ********************/
+hipsolverStatus_t hipsolverMgSsyevd_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               float*                  A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               float*                  W,
+                                               int*                    lwork)
 try
 {
     if(lwork == nullptr)
@@ -1793,11 +8629,21 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_sgebrd(
-        (rocblas_handle)handle, m, n, nullptr, m, nullptr, nullptr, nullptr, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    bool upper = hip2rocblas_fill(uplo) == rocblas_fill_upper;
+    bool evect = hip2rocblas_evect(jobz) == rocblas_evect_original;
 
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_mg_bufferSize_template<float>(
+            (hipsolver_mg_handle*)handle,
+            hipsolver_mg_eigen,
+            upper,
+            evect,
+            n,
+            n,
+            ia,
+            ja,
+            (hipsolver_mg_desc*)descA,
+            &sz));
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -1811,7 +8657,16 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+hipsolverStatus_t hipsolverMgDsyevd_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               double*                 A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               double*                 W,
+                                               int*                    lwork)
 try
 {
     if(lwork == nullptr)
@@ -1820,11 +8675,21 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dgebrd(
-        (rocblas_handle)handle, m, n, nullptr, m, nullptr, nullptr, nullptr, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    bool upper = hip2rocblas_fill(uplo) == rocblas_fill_upper;
+    bool evect = hip2rocblas_evect(jobz) == rocblas_evect_original;
 
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_mg_bufferSize_template<double>(
+            (hipsolver_mg_handle*)handle,
+            hipsolver_mg_eigen,
+            upper,
+            evect,
+            n,
+            n,
+            ia,
+            ja,
+            (hipsolver_mg_desc*)descA,
+            &sz));
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -1838,7 +8703,16 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+hipsolverStatus_t hipsolverMgCheevd_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipFloatComplex*        A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               float*                  W,
+                                               int*                    lwork)
 try
 {
     if(lwork == nullptr)
@@ -1847,11 +8721,21 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cgebrd(
-        (rocblas_handle)handle, m, n, nullptr, m, nullptr, nullptr, nullptr, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    bool upper = hip2rocblas_fill(uplo) == rocblas_fill_upper;
+    bool evect = hip2rocblas_evect(jobz) == rocblas_evect_original;
 
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_mg_bufferSize_template<rocblas_float_complex>(
+            (hipsolver_mg_handle*)handle,
+            hipsolver_mg_eigen,
+            upper,
+            evect,
+            n,
+            n,
+            ia,
+            ja,
+            (hipsolver_mg_desc*)descA,
+            &sz));
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -1865,7 +8749,16 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+hipsolverStatus_t hipsolverMgZheevd_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipDoubleComplex*       A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               double*                 W,
+                                               int*                    lwork)
 try
 {
     if(lwork == nullptr)
@@ -1874,11 +8767,21 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zgebrd(
-        (rocblas_handle)handle, m, n, nullptr, m, nullptr, nullptr, nullptr, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    bool upper = hip2rocblas_fill(uplo) == rocblas_fill_upper;
+    bool evect = hip2rocblas_evect(jobz) == rocblas_evect_original;
 
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_mg_bufferSize_template<rocblas_double_complex>(
+            (hipsolver_mg_handle*)handle,
+            hipsolver_mg_eigen,
+            upper,
+            evect,
+            n,
+            n,
+            ia,
+            ja,
+            (hipsolver_mg_desc*)descA,
+            &sz));
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -1892,143 +8795,472 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgebrd(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  float*            A,
-                                  int               lda,
-                                  float*            D,
-                                  float*            E,
-                                  float*            tauq,
-                                  float*            taup,
-                                  float*            work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverMgSsyevd(hipsolverMgHandle_t     handle,
+                                    hipsolverEigMode_t      jobz,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    float*                  A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    float*                  W,
+                                    float*                  work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(hipsolverSgebrd_bufferSize((rocblas_handle)handle, m, n, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    int  size_work;
+    bool upper = hip2rocblas_fill(uplo) == rocblas_fill_upper;
+    bool evect = hip2rocblas_evect(jobz) == rocblas_evect_original;
+    CHECK_HIPSOLVER_ERROR(
+        hipsolverMgSsyevd_bufferSize(handle, jobz, uplo, n, A, ia, ja, descA, W, &size_work));
 
-    return rocblas2hip_status(
-        rocsolver_sgebrd((rocblas_handle)handle, m, n, A, lda, D, E, tauq, taup));
+    if(work != nullptr && lwork < size_work)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the workspace is allocated on each device if not provided
+    return rocblas2hip_status(hipsolver_mg_template((hipsolver_mg_handle*)handle,
+                                                    hipsolver_mg_eigen,
+                                                    upper,
+                                                    evect,
+                                                    n,
+                                                    n,
+                                                    A,
+                                                    ia,
+                                                    ja,
+                                                    (hipsolver_mg_desc*)descA,
+                                                    (int**)nullptr,
+                                                    W,
+                                                    (void**)work,
+                                                    work ? size_t(lwork) : 0,
+                                                    info));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgebrd(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  double*           A,
-                                  int               lda,
-                                  double*           D,
-                                  double*           E,
-                                  double*           tauq,
-                                  double*           taup,
-                                  double*           work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverMgDsyevd(hipsolverMgHandle_t     handle,
+                                    hipsolverEigMode_t      jobz,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    double*                 A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    double*                 W,
+                                    double*                 work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(hipsolverDgebrd_bufferSize((rocblas_handle)handle, m, n, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    int  size_work;
+    bool upper = hip2rocblas_fill(uplo) == rocblas_fill_upper;
+    bool evect = hip2rocblas_evect(jobz) == rocblas_evect_original;
+    CHECK_HIPSOLVER_ERROR(
+        hipsolverMgDsyevd_bufferSize(handle, jobz, uplo, n, A, ia, ja, descA, W, &size_work));
 
-    return rocblas2hip_status(
-        rocsolver_dgebrd((rocblas_handle)handle, m, n, A, lda, D, E, tauq, taup));
+    if(work != nullptr && lwork < size_work)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the workspace is allocated on each device if not provided
+    return rocblas2hip_status(hipsolver_mg_template((hipsolver_mg_handle*)handle,
+                                                    hipsolver_mg_eigen,
+                                                    upper,
+                                                    evect,
+                                                    n,
+                                                    n,
+                                                    A,
+                                                    ia,
+                                                    ja,
+                                                    (hipsolver_mg_desc*)descA,
+                                                    (int**)nullptr,
+                                                    W,
+                                                    (void**)work,
+                                                    work ? size_t(lwork) : 0,
+                                                    info));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgebrd(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipFloatComplex*  A,
-                                  int               lda,
-                                  float*            D,
-                                  float*            E,
-                                  hipFloatComplex*  tauq,
-                                  hipFloatComplex*  taup,
-                                  hipFloatComplex*  work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverMgCheevd(hipsolverMgHandle_t     handle,
+                                    hipsolverEigMode_t      jobz,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    hipFloatComplex*        A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    float*                  W,
+                                    hipFloatComplex*        work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(hipsolverCgebrd_bufferSize((rocblas_handle)handle, m, n, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    int  size_work;
+    bool upper = hip2rocblas_fill(uplo) == rocblas_fill_upper;
+    bool evect = hip2rocblas_evect(jobz) == rocblas_evect_original;
+    CHECK_HIPSOLVER_ERROR(
+        hipsolverMgCheevd_bufferSize(handle, jobz, uplo, n, A, ia, ja, descA, W, &size_work));
 
-    return rocblas2hip_status(rocsolver_cgebrd((rocblas_handle)handle,
-                                               m,
-                                               n,
-                                               (rocblas_float_complex*)A,
-                                               lda,
-                                               D,
-                                               E,
-                                               (rocblas_float_complex*)tauq,
-                                               (rocblas_float_complex*)taup));
+    if(work != nullptr && lwork < size_work)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the workspace is allocated on each device if not provided
+    return rocblas2hip_status(hipsolver_mg_template((hipsolver_mg_handle*)handle,
+                                                    hipsolver_mg_eigen,
+                                                    upper,
+                                                    evect,
+                                                    n,
+                                                    n,
+                                                    (rocblas_float_complex**)A,
+                                                    ia,
+                                                    ja,
+                                                    (hipsolver_mg_desc*)descA,
+                                                    (int**)nullptr,
+                                                    W,
+                                                    (void**)work,
+                                                    work ? size_t(lwork) : 0,
+                                                    info));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgebrd(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipDoubleComplex* A,
-                                  int               lda,
-                                  double*           D,
-                                  double*           E,
-                                  hipDoubleComplex* tauq,
-                                  hipDoubleComplex* taup,
-                                  hipDoubleComplex* work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverMgZheevd(hipsolverMgHandle_t     handle,
+                                    hipsolverEigMode_t      jobz,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    hipDoubleComplex*       A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    double*                 W,
+                                    hipDoubleComplex*       work[],
+                                    int                     lwork,
+                                    int*                    info)
+try
+{
+    int  size_work;
+    bool upper = hip2rocblas_fill(uplo) == rocblas_fill_upper;
+    bool evect = hip2rocblas_evect(jobz) == rocblas_evect_original;
+    CHECK_HIPSOLVER_ERROR(
+        hipsolverMgZheevd_bufferSize(handle, jobz, uplo, n, A, ia, ja, descA, W, &size_work));
+
+    if(work != nullptr && lwork < size_work)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the workspace is allocated on each device if not provided
+    return rocblas2hip_status(hipsolver_mg_template((hipsolver_mg_handle*)handle,
+                                                    hipsolver_mg_eigen,
+                                                    upper,
+                                                    evect,
+                                                    n,
+                                                    n,
+                                                    (rocblas_double_complex**)A,
+                                                    ia,
+                                                    ja,
+                                                    (hipsolver_mg_desc*)descA,
+                                                    (int**)nullptr,
+                                                    W,
+                                                    (void**)work,
+                                                    work ? size_t(lwork) : 0,
+                                                    info));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** PACK_COMPACT ********************/
+hipsolverStatus_t hipsolverSpackCompact(hipsolverHandle_t handle,
+                                        int               m,
+                                        int               n,
+                                        const float*      A,
+                                        int               lda,
+                                        int               strideA,
+                                        float*            Ac,
+                                        int               batch_count)
+try
+{
+    return rocblas2hip_status(hipsolver_pack_compact_template(
+        (rocblas_handle)handle, m, n, A, lda, strideA, Ac, batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpackCompact(hipsolverHandle_t handle,
+                                        int               m,
+                                        int               n,
+                                        const double*     A,
+                                        int               lda,
+                                        int               strideA,
+                                        double*           Ac,
+                                        int               batch_count)
+try
+{
+    return rocblas2hip_status(hipsolver_pack_compact_template(
+        (rocblas_handle)handle, m, n, A, lda, strideA, Ac, batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpackCompact(hipsolverHandle_t      handle,
+                                        int                    m,
+                                        int                    n,
+                                        const hipFloatComplex* A,
+                                        int                    lda,
+                                        int                    strideA,
+                                        hipFloatComplex*       Ac,
+                                        int                    batch_count)
+try
+{
+    return rocblas2hip_status(hipsolver_pack_compact_template((rocblas_handle)handle,
+                                                              m,
+                                                              n,
+                                                              (const rocblas_float_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              (rocblas_float_complex*)Ac,
+                                                              batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpackCompact(hipsolverHandle_t       handle,
+                                        int                     m,
+                                        int                     n,
+                                        const hipDoubleComplex* A,
+                                        int                     lda,
+                                        int                     strideA,
+                                        hipDoubleComplex*       Ac,
+                                        int                     batch_count)
+try
+{
+    return rocblas2hip_status(hipsolver_pack_compact_template((rocblas_handle)handle,
+                                                              m,
+                                                              n,
+                                                              (const rocblas_double_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              (rocblas_double_complex*)Ac,
+                                                              batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** UNPACK_COMPACT ********************/
+hipsolverStatus_t hipsolverSunpackCompact(hipsolverHandle_t handle,
+                                          int               m,
+                                          int               n,
+                                          const float*      Ac,
+                                          float*            A,
+                                          int               lda,
+                                          int               strideA,
+                                          int               batch_count)
+try
+{
+    return rocblas2hip_status(hipsolver_unpack_compact_template(
+        (rocblas_handle)handle, m, n, Ac, A, lda, strideA, batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDunpackCompact(hipsolverHandle_t handle,
+                                          int               m,
+                                          int               n,
+                                          const double*     Ac,
+                                          double*           A,
+                                          int               lda,
+                                          int               strideA,
+                                          int               batch_count)
+try
+{
+    return rocblas2hip_status(hipsolver_unpack_compact_template(
+        (rocblas_handle)handle, m, n, Ac, A, lda, strideA, batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCunpackCompact(hipsolverHandle_t      handle,
+                                          int                    m,
+                                          int                    n,
+                                          const hipFloatComplex* Ac,
+                                          hipFloatComplex*       A,
+                                          int                    lda,
+                                          int                    strideA,
+                                          int                    batch_count)
+try
+{
+    return rocblas2hip_status(hipsolver_unpack_compact_template((rocblas_handle)handle,
+                                                                m,
+                                                                n,
+                                                                (const rocblas_float_complex*)Ac,
+                                                                (rocblas_float_complex*)A,
+                                                                lda,
+                                                                strideA,
+                                                                batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZunpackCompact(hipsolverHandle_t       handle,
+                                          int                     m,
+                                          int                     n,
+                                          const hipDoubleComplex* Ac,
+                                          hipDoubleComplex*       A,
+                                          int                     lda,
+                                          int                     strideA,
+                                          int                     batch_count)
+try
+{
+    return rocblas2hip_status(hipsolver_unpack_compact_template((rocblas_handle)handle,
+                                                                m,
+                                                                n,
+                                                                (const rocblas_double_complex*)Ac,
+                                                                (rocblas_double_complex*)A,
+                                                                lda,
+                                                                strideA,
+                                                                batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POSV_SUBMIT ********************/
+hipsolverStatus_t hipsolverSposvSubmit(hipsolverBatchQueue_t    queue,
+                                       hipsolverFillMode_t      uplo,
+                                       int                      n,
+                                       int                      nrhs,
+                                       float*                   A,
+                                       int                      lda,
+                                       float*                   B,
+                                       int                      ldb,
+                                       hipStream_t              stream,
+                                       hipsolverBatchRequest_t* request)
+try
+{
+    return rocblas2hip_status(hipsolver_posv_submit((hipsolver_batch_context*)queue,
+                                                    hip2rocblas_fill(uplo),
+                                                    n,
+                                                    nrhs,
+                                                    A,
+                                                    lda,
+                                                    B,
+                                                    ldb,
+                                                    stream,
+                                                    (hipsolver_batch_request**)request));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDposvSubmit(hipsolverBatchQueue_t    queue,
+                                       hipsolverFillMode_t      uplo,
+                                       int                      n,
+                                       int                      nrhs,
+                                       double*                  A,
+                                       int                      lda,
+                                       double*                  B,
+                                       int                      ldb,
+                                       hipStream_t              stream,
+                                       hipsolverBatchRequest_t* request)
+try
+{
+    return rocblas2hip_status(hipsolver_posv_submit((hipsolver_batch_context*)queue,
+                                                    hip2rocblas_fill(uplo),
+                                                    n,
+                                                    nrhs,
+                                                    A,
+                                                    lda,
+                                                    B,
+                                                    ldb,
+                                                    stream,
+                                                    (hipsolver_batch_request**)request));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCposvSubmit(hipsolverBatchQueue_t    queue,
+                                       hipsolverFillMode_t      uplo,
+                                       int                      n,
+                                       int                      nrhs,
+                                       hipFloatComplex*         A,
+                                       int                      lda,
+                                       hipFloatComplex*         B,
+                                       int                      ldb,
+                                       hipStream_t              stream,
+                                       hipsolverBatchRequest_t* request)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(hipsolverZgebrd_bufferSize((rocblas_handle)handle, m, n, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    return rocblas2hip_status(hipsolver_posv_submit((hipsolver_batch_context*)queue,
+                                                    hip2rocblas_fill(uplo),
+                                                    n,
+                                                    nrhs,
+                                                    (rocblas_float_complex*)A,
+                                                    lda,
+                                                    (rocblas_float_complex*)B,
+                                                    ldb,
+                                                    stream,
+                                                    (hipsolver_batch_request**)request));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
 
-    return rocblas2hip_status(rocsolver_zgebrd((rocblas_handle)handle,
-                                               m,
-                                               n,
-                                               (rocblas_double_complex*)A,
-                                               lda,
-                                               D,
-                                               E,
-                                               (rocblas_double_complex*)tauq,
-                                               (rocblas_double_complex*)taup));
+hipsolverStatus_t hipsolverZposvSubmit(hipsolverBatchQueue_t    queue,
+                                       hipsolverFillMode_t      uplo,
+                                       int                      n,
+                                       int                      nrhs,
+                                       hipDoubleComplex*        A,
+                                       int                      lda,
+                                       hipDoubleComplex*        B,
+                                       int                      ldb,
+                                       hipStream_t              stream,
+                                       hipsolverBatchRequest_t* request)
+try
+{
+    return rocblas2hip_status(hipsolver_posv_submit((hipsolver_batch_context*)queue,
+                                                    hip2rocblas_fill(uplo),
+                                                    n,
+                                                    nrhs,
+                                                    (rocblas_double_complex*)A,
+                                                    lda,
+                                                    (rocblas_double_complex*)B,
+                                                    ldb,
+                                                    stream,
+                                                    (hipsolver_batch_request**)request));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** GEQRF ********************/
-hipsolverStatus_t hipsolverSgeqrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+/******************** POTRF ********************/
+hipsolverStatus_t hipsolverSpotrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork)
 try
 {
     if(lwork == nullptr)
@@ -2037,13 +9269,20 @@ try
     *lwork = 0;
     size_t sz;
 
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, n, n);
+
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status
-        = rocblas2hip_status(rocsolver_sgeqrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_spotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    if(status == HIPSOLVER_STATUS_SUCCESS && tile.nb > 0)
+        status = rocblas2hip_status(hipsolver_tile_query<float>(
+            (rocblas_handle)handle, hipsolver_tile_cholesky, n, n, lda, tile));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
+
+    sz += hipsolver_tile_worksize<float>(hipsolver_tile_cholesky, tile, n, n);
     if(sz > INT_MAX)
         return HIPSOLVER_STATUS_INTERNAL_ERROR;
 
@@ -2055,8 +9294,8 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgeqrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverDpotrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork)
 try
 {
     if(lwork == nullptr)
@@ -2065,13 +9304,20 @@ try
     *lwork = 0;
     size_t sz;
 
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, n, n);
+
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status
-        = rocblas2hip_status(rocsolver_dgeqrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_dpotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    if(status == HIPSOLVER_STATUS_SUCCESS && tile.nb > 0)
+        status = rocblas2hip_status(hipsolver_tile_query<double>(
+            (rocblas_handle)handle, hipsolver_tile_cholesky, n, n, lda, tile));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
+
+    sz += hipsolver_tile_worksize<double>(hipsolver_tile_cholesky, tile, n, n);
     if(sz > INT_MAX)
         return HIPSOLVER_STATUS_INTERNAL_ERROR;
 
@@ -2083,8 +9329,12 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgeqrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverCpotrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             int*                lwork)
 try
 {
     if(lwork == nullptr)
@@ -2093,13 +9343,20 @@ try
     *lwork = 0;
     size_t sz;
 
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, n, n);
+
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status
-        = rocblas2hip_status(rocsolver_cgeqrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_cpotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    if(status == HIPSOLVER_STATUS_SUCCESS && tile.nb > 0)
+        status = rocblas2hip_status(hipsolver_tile_query<rocblas_float_complex>(
+            (rocblas_handle)handle, hipsolver_tile_cholesky, n, n, lda, tile));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
+
+    sz += hipsolver_tile_worksize<rocblas_float_complex>(hipsolver_tile_cholesky, tile, n, n);
     if(sz > INT_MAX)
         return HIPSOLVER_STATUS_INTERNAL_ERROR;
 
@@ -2111,8 +9368,12 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgeqrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverZpotrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             int*                lwork)
 try
 {
     if(lwork == nullptr)
@@ -2121,13 +9382,20 @@ try
     *lwork = 0;
     size_t sz;
 
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, n, n);
+
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status
-        = rocblas2hip_status(rocsolver_zgeqrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_zpotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    if(status == HIPSOLVER_STATUS_SUCCESS && tile.nb > 0)
+        status = rocblas2hip_status(hipsolver_tile_query<rocblas_double_complex>(
+            (rocblas_handle)handle, hipsolver_tile_cholesky, n, n, lda, tile));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
+
+    sz += hipsolver_tile_worksize<rocblas_double_complex>(hipsolver_tile_cholesky, tile, n, n);
     if(sz > INT_MAX)
         return HIPSOLVER_STATUS_INTERNAL_ERROR;
 
@@ -2139,147 +9407,313 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgeqrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  float*            A,
-                                  int               lda,
-                                  float*            tau,
-                                  float*            work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverSpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
+    bool host;
+    CHECK_ROCBLAS_ERROR(hipsolver_potrf_dispatch(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo, &host));
+    if(host)
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, n, n);
+
+    size_t size_tile = hipsolver_tile_worksize<float>(hipsolver_tile_cholesky, tile, n, n);
+
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    {
+        if(lwork < 0 || size_t(lwork) < size_tile)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_tile, lwork - size_tile));
+    }
     else
     {
         CHECK_HIPSOLVER_ERROR(
-            hipsolverSgeqrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+            hipsolverSpotrf_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_sgeqrf((rocblas_handle)handle, m, n, A, lda, tau));
+    if(tile.nb > 0 && work != nullptr)
+    {
+        CHECK_ROCBLAS_ERROR(hipsolver_potrf_tile_template(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo, tile, (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else if(tile.nb > 0)
+    {
+        rocblas_device_malloc mem((rocblas_handle)handle, size_tile);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_potrf_tile_template(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo, tile, mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+
+    CHECK_ROCBLAS_ERROR(
+        rocsolver_spotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgeqrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  double*           A,
-                                  int               lda,
-                                  double*           tau,
-                                  double*           work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverDpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
+    bool host;
+    CHECK_ROCBLAS_ERROR(hipsolver_potrf_dispatch(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo, &host));
+    if(host)
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, n, n);
+
+    size_t size_tile = hipsolver_tile_worksize<double>(hipsolver_tile_cholesky, tile, n, n);
+
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    {
+        if(lwork < 0 || size_t(lwork) < size_tile)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_tile, lwork - size_tile));
+    }
     else
     {
         CHECK_HIPSOLVER_ERROR(
-            hipsolverDgeqrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+            hipsolverDpotrf_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_dgeqrf((rocblas_handle)handle, m, n, A, lda, tau));
+    if(tile.nb > 0 && work != nullptr)
+    {
+        CHECK_ROCBLAS_ERROR(hipsolver_potrf_tile_template(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo, tile, (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else if(tile.nb > 0)
+    {
+        rocblas_device_malloc mem((rocblas_handle)handle, size_tile);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_potrf_tile_template(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo, tile, mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+
+    CHECK_ROCBLAS_ERROR(
+        rocsolver_dpotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgeqrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipFloatComplex*  A,
-                                  int               lda,
-                                  hipFloatComplex*  tau,
-                                  hipFloatComplex*  work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverCpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
+    bool host;
+    CHECK_ROCBLAS_ERROR(hipsolver_potrf_dispatch((rocblas_handle)handle,
+                                                 hip2rocblas_fill(uplo),
+                                                 n,
+                                                 (rocblas_float_complex*)A,
+                                                 lda,
+                                                 devInfo,
+                                                 &host));
+    if(host)
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, n, n);
+
+    size_t size_tile
+        = hipsolver_tile_worksize<rocblas_float_complex>(hipsolver_tile_cholesky, tile, n, n);
+
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    {
+        if(lwork < 0 || size_t(lwork) < size_tile)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_tile, lwork - size_tile));
+    }
     else
     {
         CHECK_HIPSOLVER_ERROR(
-            hipsolverCgeqrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+            hipsolverCpotrf_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_cgeqrf(
-        (rocblas_handle)handle, m, n, (rocblas_float_complex*)A, lda, (rocblas_float_complex*)tau));
+    if(tile.nb > 0 && work != nullptr)
+    {
+        CHECK_ROCBLAS_ERROR(hipsolver_potrf_tile_template((rocblas_handle)handle,
+                                                          hip2rocblas_fill(uplo),
+                                                          n,
+                                                          (rocblas_float_complex*)A,
+                                                          lda,
+                                                          devInfo,
+                                                          tile,
+                                                          (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else if(tile.nb > 0)
+    {
+        rocblas_device_malloc mem((rocblas_handle)handle, size_tile);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_potrf_tile_template((rocblas_handle)handle,
+                                                          hip2rocblas_fill(uplo),
+                                                          n,
+                                                          (rocblas_float_complex*)A,
+                                                          lda,
+                                                          devInfo,
+                                                          tile,
+                                                          mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_cpotrf((rocblas_handle)handle,
+                                         hip2rocblas_fill(uplo),
+                                         n,
+                                         (rocblas_float_complex*)A,
+                                         lda,
+                                         devInfo));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgeqrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipDoubleComplex* A,
-                                  int               lda,
-                                  hipDoubleComplex* tau,
-                                  hipDoubleComplex* work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverZpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
+    bool host;
+    CHECK_ROCBLAS_ERROR(hipsolver_potrf_dispatch((rocblas_handle)handle,
+                                                 hip2rocblas_fill(uplo),
+                                                 n,
+                                                 (rocblas_double_complex*)A,
+                                                 lda,
+                                                 devInfo,
+                                                 &host));
+    if(host)
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+
+    hipsolver_tile_config tile = hipsolver_get_tile_config((rocblas_handle)handle, n, n);
+
+    size_t size_tile
+        = hipsolver_tile_worksize<rocblas_double_complex>(hipsolver_tile_cholesky, tile, n, n);
+
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    {
+        if(lwork < 0 || size_t(lwork) < size_tile)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace(
+            (rocblas_handle)handle, (char*)work + size_tile, lwork - size_tile));
+    }
     else
     {
         CHECK_HIPSOLVER_ERROR(
-            hipsolverZgeqrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+            hipsolverZpotrf_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_zgeqrf((rocblas_handle)handle,
-                                               m,
-                                               n,
-                                               (rocblas_double_complex*)A,
-                                               lda,
-                                               (rocblas_double_complex*)tau));
+    if(tile.nb > 0 && work != nullptr)
+    {
+        CHECK_ROCBLAS_ERROR(hipsolver_potrf_tile_template((rocblas_handle)handle,
+                                                          hip2rocblas_fill(uplo),
+                                                          n,
+                                                          (rocblas_double_complex*)A,
+                                                          lda,
+                                                          devInfo,
+                                                          tile,
+                                                          (void*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+    else if(tile.nb > 0)
+    {
+        rocblas_device_malloc mem((rocblas_handle)handle, size_tile);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_potrf_tile_template((rocblas_handle)handle,
+                                                          hip2rocblas_fill(uplo),
+                                                          n,
+                                                          (rocblas_double_complex*)A,
+                                                          lda,
+                                                          devInfo,
+                                                          tile,
+                                                          mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_zpotrf((rocblas_handle)handle,
+                                         hip2rocblas_fill(uplo),
+                                         n,
+                                         (rocblas_double_complex*)A,
+                                         lda,
+                                         devInfo));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** GESVD ********************/
-hipsolverStatus_t hipsolverSgesvd_bufferSize(
-    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
-try
-{
-    if(lwork == nullptr)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-
-    *lwork = 0;
-    size_t sz;
-
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_sgesvd((rocblas_handle)handle,
-                                                                   char2rocblas_svect(jobu),
-                                                                   char2rocblas_svect(jobv),
-                                                                   m,
-                                                                   n,
-                                                                   nullptr,
-                                                                   m,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   m,
-                                                                   nullptr,
-                                                                   n,
-                                                                   nullptr,
-                                                                   rocblas_outofplace,
-                                                                   nullptr));
+/******************** POTRF_BATCHED ********************/
+hipsolverStatus_t hipsolverSpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_spotrf_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr, batch_count));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
@@ -2295,8 +9729,13 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgesvd_bufferSize(
-    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+hipsolverStatus_t hipsolverDpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
 try
 {
     if(lwork == nullptr)
@@ -2306,21 +9745,8 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dgesvd((rocblas_handle)handle,
-                                                                   char2rocblas_svect(jobu),
-                                                                   char2rocblas_svect(jobv),
-                                                                   m,
-                                                                   n,
-                                                                   nullptr,
-                                                                   m,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   m,
-                                                                   nullptr,
-                                                                   n,
-                                                                   nullptr,
-                                                                   rocblas_outofplace,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dpotrf_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr, batch_count));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
@@ -2336,8 +9762,13 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgesvd_bufferSize(
-    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+hipsolverStatus_t hipsolverCpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipFloatComplex*    A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
 try
 {
     if(lwork == nullptr)
@@ -2347,21 +9778,8 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cgesvd((rocblas_handle)handle,
-                                                                   char2rocblas_svect(jobu),
-                                                                   char2rocblas_svect(jobv),
-                                                                   m,
-                                                                   n,
-                                                                   nullptr,
-                                                                   m,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   m,
-                                                                   nullptr,
-                                                                   n,
-                                                                   nullptr,
-                                                                   rocblas_outofplace,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cpotrf_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr, batch_count));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
@@ -2377,8 +9795,13 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgesvd_bufferSize(
-    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+hipsolverStatus_t hipsolverZpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipDoubleComplex*   A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
 try
 {
     if(lwork == nullptr)
@@ -2388,21 +9811,8 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zgesvd((rocblas_handle)handle,
-                                                                   char2rocblas_svect(jobu),
-                                                                   char2rocblas_svect(jobv),
-                                                                   m,
-                                                                   n,
-                                                                   nullptr,
-                                                                   m,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   m,
-                                                                   nullptr,
-                                                                   n,
-                                                                   nullptr,
-                                                                   rocblas_outofplace,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zpotrf_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr, batch_count));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
@@ -2418,454 +9828,580 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgesvd(hipsolverHandle_t handle,
-                                  signed char       jobu,
-                                  signed char       jobv,
-                                  int               m,
-                                  int               n,
-                                  float*            A,
-                                  int               lda,
-                                  float*            S,
-                                  float*            U,
-                                  int               ldu,
-                                  float*            V,
-                                  int               ldv,
-                                  float*            work,
-                                  int               lwork,
-                                  float*            rwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverSpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A[],
+                                         int                 lda,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
 try
 {
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverSgesvd_bufferSize((rocblas_handle)handle, jobu, jobv, m, n, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverSpotrfBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_sgesvd((rocblas_handle)handle,
-                                               char2rocblas_svect(jobu),
-                                               char2rocblas_svect(jobv),
-                                               m,
-                                               n,
-                                               A,
-                                               lda,
-                                               S,
-                                               U,
-                                               ldu,
-                                               V,
-                                               ldv,
-                                               rwork,
-                                               rocblas_outofplace,
-                                               devInfo));
+    CHECK_ROCBLAS_ERROR(rocsolver_spotrf_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo, batch_count));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgesvd(hipsolverHandle_t handle,
-                                  signed char       jobu,
-                                  signed char       jobv,
-                                  int               m,
-                                  int               n,
-                                  double*           A,
-                                  int               lda,
-                                  double*           S,
-                                  double*           U,
-                                  int               ldu,
-                                  double*           V,
-                                  int               ldv,
-                                  double*           work,
-                                  int               lwork,
-                                  double*           rwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverDpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A[],
+                                         int                 lda,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
 try
 {
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverDgesvd_bufferSize((rocblas_handle)handle, jobu, jobv, m, n, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverDpotrfBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_dgesvd((rocblas_handle)handle,
-                                               char2rocblas_svect(jobu),
-                                               char2rocblas_svect(jobv),
-                                               m,
-                                               n,
-                                               A,
-                                               lda,
-                                               S,
-                                               U,
-                                               ldu,
-                                               V,
-                                               ldv,
-                                               rwork,
-                                               rocblas_outofplace,
-                                               devInfo));
+    CHECK_ROCBLAS_ERROR(rocsolver_dpotrf_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo, batch_count));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgesvd(hipsolverHandle_t handle,
-                                  signed char       jobu,
-                                  signed char       jobv,
-                                  int               m,
-                                  int               n,
-                                  hipFloatComplex*  A,
-                                  int               lda,
-                                  float*            S,
-                                  hipFloatComplex*  U,
-                                  int               ldu,
-                                  hipFloatComplex*  V,
-                                  int               ldv,
-                                  hipFloatComplex*  work,
-                                  int               lwork,
-                                  float*            rwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverCpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipFloatComplex*    A[],
+                                         int                 lda,
+                                         hipFloatComplex*    work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
 try
 {
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverCgesvd_bufferSize((rocblas_handle)handle, jobu, jobv, m, n, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverCpotrfBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_cpotrf_batched((rocblas_handle)handle,
+                                                 hip2rocblas_fill(uplo),
+                                                 n,
+                                                 (rocblas_float_complex**)A,
+                                                 lda,
+                                                 devInfo,
+                                                 batch_count));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipDoubleComplex*   A[],
+                                         int                 lda,
+                                         hipDoubleComplex*   work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZpotrfBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_cgesvd((rocblas_handle)handle,
-                                               char2rocblas_svect(jobu),
-                                               char2rocblas_svect(jobv),
-                                               m,
-                                               n,
-                                               (rocblas_float_complex*)A,
-                                               lda,
-                                               S,
-                                               (rocblas_float_complex*)U,
-                                               ldu,
-                                               (rocblas_float_complex*)V,
-                                               ldv,
-                                               rwork,
-                                               rocblas_outofplace,
-                                               devInfo));
+    CHECK_ROCBLAS_ERROR(rocsolver_zpotrf_batched((rocblas_handle)handle,
+                                                 hip2rocblas_fill(uplo),
+                                                 n,
+                                                 (rocblas_double_complex**)A,
+                                                 lda,
+                                                 devInfo,
+                                                 batch_count));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_COMPACT ********************/
+hipsolverStatus_t hipsolverSpotrfCompact(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              Ac,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_argCheck((rocblas_handle)handle, n, 0, batch_count));
+
+    size_t size_work, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_size<float>(
+        (rocblas_handle)handle, 'P', n, 0, batch_count, &size_work, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_work);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    CHECK_ROCBLAS_ERROR(hipsolver_potrf_compact_template(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, Ac, devInfo, batch_count, mem[0]));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfCompact(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             Ac,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_argCheck((rocblas_handle)handle, n, 0, batch_count));
+
+    size_t size_work, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_size<double>(
+        (rocblas_handle)handle, 'P', n, 0, batch_count, &size_work, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_work);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    CHECK_ROCBLAS_ERROR(hipsolver_potrf_compact_template(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, Ac, devInfo, batch_count, mem[0]));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfCompact(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipFloatComplex*    Ac,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_argCheck((rocblas_handle)handle, n, 0, batch_count));
+
+    size_t size_work, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_size<rocblas_float_complex>(
+        (rocblas_handle)handle, 'P', n, 0, batch_count, &size_work, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_work);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    CHECK_ROCBLAS_ERROR(hipsolver_potrf_compact_template((rocblas_handle)handle,
+                                                         hip2rocblas_fill(uplo),
+                                                         n,
+                                                         (rocblas_float_complex*)Ac,
+                                                         devInfo,
+                                                         batch_count,
+                                                         mem[0]));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgesvd(hipsolverHandle_t handle,
-                                  signed char       jobu,
-                                  signed char       jobv,
-                                  int               m,
-                                  int               n,
-                                  hipDoubleComplex* A,
-                                  int               lda,
-                                  double*           S,
-                                  hipDoubleComplex* U,
-                                  int               ldu,
-                                  hipDoubleComplex* V,
-                                  int               ldv,
-                                  hipDoubleComplex* work,
-                                  int               lwork,
-                                  double*           rwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverZpotrfCompact(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipDoubleComplex*   Ac,
+                                         int*                devInfo,
+                                         int                 batch_count)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverZgesvd_bufferSize((rocblas_handle)handle, jobu, jobv, m, n, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_argCheck((rocblas_handle)handle, n, 0, batch_count));
 
-    return rocblas2hip_status(rocsolver_zgesvd((rocblas_handle)handle,
-                                               char2rocblas_svect(jobu),
-                                               char2rocblas_svect(jobv),
-                                               m,
-                                               n,
-                                               (rocblas_double_complex*)A,
-                                               lda,
-                                               S,
-                                               (rocblas_double_complex*)U,
-                                               ldu,
-                                               (rocblas_double_complex*)V,
-                                               ldv,
-                                               rwork,
-                                               rocblas_outofplace,
-                                               devInfo));
+    size_t size_work, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_compact_size<rocblas_double_complex>(
+        (rocblas_handle)handle, 'P', n, 0, batch_count, &size_work, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_work);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    CHECK_ROCBLAS_ERROR(hipsolver_potrf_compact_template((rocblas_handle)handle,
+                                                         hip2rocblas_fill(uplo),
+                                                         n,
+                                                         (rocblas_double_complex*)Ac,
+                                                         devInfo,
+                                                         batch_count,
+                                                         mem[0]));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** GETRF ********************/
-hipsolverStatus_t hipsolverSgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+/******************** POTRF_OUT_OF_CORE ********************/
+hipsolverStatus_t hipsolverSpotrfOutOfCore(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           float*              A,
+                                           int                 lda,
+                                           size_t              deviceBudget,
+                                           int*                info)
 try
 {
-    if(lwork == nullptr)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-
-    *lwork = 0;
-    size_t sz;
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_ooc_argCheck(
+        (rocblas_handle)handle, n, 0, lda, n, A, nullptr, info));
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_sgetrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
-    rocsolver_sgetrf_npvt((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    int    nb, nslots;
+    size_t size_ooc, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_ooc_blocking<float>(
+        (rocblas_handle)handle, n, 0, deviceBudget, &nb, &nslots, &size_ooc, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
 
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    rocblas_device_malloc mem((rocblas_handle)handle, size_ooc);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
 
-    *lwork = (int)sz;
-    return status;
+    return rocblas2hip_status(hipsolver_potrf_ooc_template(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, info, nb, nslots, mem[0]));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverDpotrfOutOfCore(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           double*             A,
+                                           int                 lda,
+                                           size_t              deviceBudget,
+                                           int*                info)
 try
 {
-    if(lwork == nullptr)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-
-    *lwork = 0;
-    size_t sz;
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_ooc_argCheck(
+        (rocblas_handle)handle, n, 0, lda, n, A, nullptr, info));
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_dgetrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
-    rocsolver_dgetrf_npvt((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    int    nb, nslots;
+    size_t size_ooc, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_ooc_blocking<double>(
+        (rocblas_handle)handle, n, 0, deviceBudget, &nb, &nslots, &size_ooc, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
 
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    rocblas_device_malloc mem((rocblas_handle)handle, size_ooc);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
 
-    *lwork = (int)sz;
-    return status;
+    return rocblas2hip_status(hipsolver_potrf_ooc_template(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, info, nb, nslots, mem[0]));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverCpotrfOutOfCore(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           hipFloatComplex*    A,
+                                           int                 lda,
+                                           size_t              deviceBudget,
+                                           int*                info)
 try
 {
-    if(lwork == nullptr)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_ooc_argCheck(
+        (rocblas_handle)handle, n, 0, lda, n, A, nullptr, info));
 
-    *lwork = 0;
-    size_t sz;
-
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_cgetrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
-    rocsolver_cgetrf_npvt((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    int    nb, nslots;
+    size_t size_ooc, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_ooc_blocking<rocblas_float_complex>(
+        (rocblas_handle)handle, n, 0, deviceBudget, &nb, &nslots, &size_ooc, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
 
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    rocblas_device_malloc mem((rocblas_handle)handle, size_ooc);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
 
-    *lwork = (int)sz;
-    return status;
+    return rocblas2hip_status(hipsolver_potrf_ooc_template((rocblas_handle)handle,
+                                                           hip2rocblas_fill(uplo),
+                                                           n,
+                                                           (rocblas_float_complex*)A,
+                                                           lda,
+                                                           info,
+                                                           nb,
+                                                           nslots,
+                                                           mem[0]));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverZpotrfOutOfCore(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           hipDoubleComplex*   A,
+                                           int                 lda,
+                                           size_t              deviceBudget,
+                                           int*                info)
 try
 {
-    if(lwork == nullptr)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-
-    *lwork = 0;
-    size_t sz;
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_ooc_argCheck(
+        (rocblas_handle)handle, n, 0, lda, n, A, nullptr, info));
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_zgetrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
-    rocsolver_zgetrf_npvt((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    int    nb, nslots;
+    size_t size_ooc, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_ooc_blocking<rocblas_double_complex>(
+        (rocblas_handle)handle, n, 0, deviceBudget, &nb, &nslots, &size_ooc, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
 
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    rocblas_device_malloc mem((rocblas_handle)handle, size_ooc);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
 
-    *lwork = (int)sz;
-    return status;
+    return rocblas2hip_status(hipsolver_potrf_ooc_template((rocblas_handle)handle,
+                                                           hip2rocblas_fill(uplo),
+                                                           n,
+                                                           (rocblas_double_complex*)A,
+                                                           lda,
+                                                           info,
+                                                           nb,
+                                                           nslots,
+                                                           mem[0]));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgetrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  float*            A,
-                                  int               lda,
-                                  float*            work,
-                                  int               lwork,
-                                  int*              devIpiv,
-                                  int*              devInfo)
+/******************** POTRS_OUT_OF_CORE ********************/
+hipsolverStatus_t hipsolverSpotrsOutOfCore(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           int                 nrhs,
+                                           const float*        A,
+                                           int                 lda,
+                                           float*              B,
+                                           int                 ldb,
+                                           size_t              deviceBudget,
+                                           int*                info)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverSgetrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_ooc_argCheck(
+        (rocblas_handle)handle, n, nrhs, lda, ldb, A, B, info));
 
-    if(devIpiv != nullptr)
-        return rocblas2hip_status(
-            rocsolver_sgetrf((rocblas_handle)handle, m, n, A, lda, devIpiv, devInfo));
-    else
-        return rocblas2hip_status(
-            rocsolver_sgetrf_npvt((rocblas_handle)handle, m, n, A, lda, devInfo));
+    int    nb, nslots;
+    size_t size_ooc, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_ooc_blocking<float>(
+        (rocblas_handle)handle, n, nrhs, deviceBudget, &nb, &nslots, &size_ooc, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_ooc);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_potrs_ooc_template((rocblas_handle)handle,
+                                                           hip2rocblas_fill(uplo),
+                                                           n,
+                                                           nrhs,
+                                                           A,
+                                                           lda,
+                                                           B,
+                                                           ldb,
+                                                           info,
+                                                           nb,
+                                                           nslots,
+                                                           mem[0]));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgetrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  double*           A,
-                                  int               lda,
-                                  double*           work,
-                                  int               lwork,
-                                  int*              devIpiv,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverDpotrsOutOfCore(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           int                 nrhs,
+                                           const double*       A,
+                                           int                 lda,
+                                           double*             B,
+                                           int                 ldb,
+                                           size_t              deviceBudget,
+                                           int*                info)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverDgetrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_ooc_argCheck(
+        (rocblas_handle)handle, n, nrhs, lda, ldb, A, B, info));
 
-    if(devIpiv != nullptr)
-        return rocblas2hip_status(
-            rocsolver_dgetrf((rocblas_handle)handle, m, n, A, lda, devIpiv, devInfo));
-    else
-        return rocblas2hip_status(
-            rocsolver_dgetrf_npvt((rocblas_handle)handle, m, n, A, lda, devInfo));
+    int    nb, nslots;
+    size_t size_ooc, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_ooc_blocking<double>(
+        (rocblas_handle)handle, n, nrhs, deviceBudget, &nb, &nslots, &size_ooc, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_ooc);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_potrs_ooc_template((rocblas_handle)handle,
+                                                           hip2rocblas_fill(uplo),
+                                                           n,
+                                                           nrhs,
+                                                           A,
+                                                           lda,
+                                                           B,
+                                                           ldb,
+                                                           info,
+                                                           nb,
+                                                           nslots,
+                                                           mem[0]));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgetrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipFloatComplex*  A,
-                                  int               lda,
-                                  hipFloatComplex*  work,
-                                  int               lwork,
-                                  int*              devIpiv,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverCpotrsOutOfCore(hipsolverHandle_t      handle,
+                                           hipsolverFillMode_t    uplo,
+                                           int                    n,
+                                           int                    nrhs,
+                                           const hipFloatComplex* A,
+                                           int                    lda,
+                                           hipFloatComplex*       B,
+                                           int                    ldb,
+                                           size_t                 deviceBudget,
+                                           int*                   info)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverCgetrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_ooc_argCheck(
+        (rocblas_handle)handle, n, nrhs, lda, ldb, A, B, info));
 
-    if(devIpiv != nullptr)
-        return rocblas2hip_status(rocsolver_cgetrf(
-            (rocblas_handle)handle, m, n, (rocblas_float_complex*)A, lda, devIpiv, devInfo));
-    else
-        return rocblas2hip_status(rocsolver_cgetrf_npvt(
-            (rocblas_handle)handle, m, n, (rocblas_float_complex*)A, lda, devInfo));
+    int    nb, nslots;
+    size_t size_ooc, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_ooc_blocking<rocblas_float_complex>(
+        (rocblas_handle)handle, n, nrhs, deviceBudget, &nb, &nslots, &size_ooc, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_ooc);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_potrs_ooc_template((rocblas_handle)handle,
+                                                           hip2rocblas_fill(uplo),
+                                                           n,
+                                                           nrhs,
+                                                           (const rocblas_float_complex*)A,
+                                                           lda,
+                                                           (rocblas_float_complex*)B,
+                                                           ldb,
+                                                           info,
+                                                           nb,
+                                                           nslots,
+                                                           mem[0]));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgetrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipDoubleComplex* A,
-                                  int               lda,
-                                  hipDoubleComplex* work,
-                                  int               lwork,
-                                  int*              devIpiv,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverZpotrsOutOfCore(hipsolverHandle_t       handle,
+                                           hipsolverFillMode_t     uplo,
+                                           int                     n,
+                                           int                     nrhs,
+                                           const hipDoubleComplex* A,
+                                           int                     lda,
+                                           hipDoubleComplex*       B,
+                                           int                     ldb,
+                                           size_t                  deviceBudget,
+                                           int*                    info)
 try
 {
-    if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverZgetrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+    CHECK_ROCBLAS_ERROR(hipsolver_ooc_argCheck(
+        (rocblas_handle)handle, n, nrhs, lda, ldb, A, B, info));
 
-    if(devIpiv != nullptr)
-        return rocblas2hip_status(rocsolver_zgetrf(
-            (rocblas_handle)handle, m, n, (rocblas_double_complex*)A, lda, devIpiv, devInfo));
-    else
-        return rocblas2hip_status(rocsolver_zgetrf_npvt(
-            (rocblas_handle)handle, m, n, (rocblas_double_complex*)A, lda, devInfo));
+    int    nb, nslots;
+    size_t size_ooc, size;
+    CHECK_ROCBLAS_ERROR(hipsolver_ooc_blocking<rocblas_double_complex>(
+        (rocblas_handle)handle, n, nrhs, deviceBudget, &nb, &nslots, &size_ooc, &size));
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size));
+
+    rocblas_device_malloc mem((rocblas_handle)handle, size_ooc);
+    if(!mem)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    return rocblas2hip_status(hipsolver_potrs_ooc_template((rocblas_handle)handle,
+                                                           hip2rocblas_fill(uplo),
+                                                           n,
+                                                           nrhs,
+                                                           (const rocblas_double_complex*)A,
+                                                           lda,
+                                                           (rocblas_double_complex*)B,
+                                                           ldb,
+                                                           info,
+                                                           nb,
+                                                           nslots,
+                                                           mem[0]));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** GETRS ********************/
-hipsolverStatus_t hipsolverSgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             float*               A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             float*               B,
-                                             int                  ldb,
-                                             int*                 lwork)
+/******************** SYEVD/HEEVD ********************/
+hipsolverStatus_t hipsolverSsyevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              D,
+                                             int*                lwork)
 try
 {
     if(lwork == nullptr)
@@ -2875,17 +10411,20 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_sgetrs((rocblas_handle)handle,
-                                                                   hip2rocblas_operation(trans),
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_ssyevd((rocblas_handle)handle,
+                                                                   hip2rocblas_evect(jobz),
+                                                                   hip2rocblas_fill(uplo),
                                                                    n,
-                                                                   nrhs,
                                                                    nullptr,
                                                                    lda,
                                                                    nullptr,
                                                                    nullptr,
-                                                                   ldb));
+                                                                   nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
+    // space for E array
+    sz += sizeof(float) * n;
+
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -2899,16 +10438,14 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             double*              A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             double*              B,
-                                             int                  ldb,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverDsyevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             D,
+                                             int*                lwork)
 try
 {
     if(lwork == nullptr)
@@ -2918,17 +10455,20 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dgetrs((rocblas_handle)handle,
-                                                                   hip2rocblas_operation(trans),
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dsyevd((rocblas_handle)handle,
+                                                                   hip2rocblas_evect(jobz),
+                                                                   hip2rocblas_fill(uplo),
                                                                    n,
-                                                                   nrhs,
                                                                    nullptr,
                                                                    lda,
                                                                    nullptr,
                                                                    nullptr,
-                                                                   ldb));
+                                                                   nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
+    // space for E array
+    sz += sizeof(double) * n;
+
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -2942,16 +10482,14 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             hipFloatComplex*     A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             hipFloatComplex*     B,
-                                             int                  ldb,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverCheevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             float*              D,
+                                             int*                lwork)
 try
 {
     if(lwork == nullptr)
@@ -2961,17 +10499,20 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cgetrs((rocblas_handle)handle,
-                                                                   hip2rocblas_operation(trans),
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cheevd((rocblas_handle)handle,
+                                                                   hip2rocblas_evect(jobz),
+                                                                   hip2rocblas_fill(uplo),
                                                                    n,
-                                                                   nrhs,
                                                                    nullptr,
                                                                    lda,
                                                                    nullptr,
                                                                    nullptr,
-                                                                   ldb));
+                                                                   nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
+    // space for E array
+    sz += sizeof(float) * n;
+
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -2985,16 +10526,14 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             hipDoubleComplex*    A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             hipDoubleComplex*    B,
-                                             int                  ldb,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverZheevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             double*             D,
+                                             int*                lwork)
 try
 {
     if(lwork == nullptr)
@@ -3004,17 +10543,20 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zgetrs((rocblas_handle)handle,
-                                                                   hip2rocblas_operation(trans),
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zheevd((rocblas_handle)handle,
+                                                                   hip2rocblas_evect(jobz),
+                                                                   hip2rocblas_fill(uplo),
                                                                    n,
-                                                                   nrhs,
                                                                    nullptr,
                                                                    lda,
                                                                    nullptr,
                                                                    nullptr,
-                                                                   ldb));
+                                                                   nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
+    // space for E array
+    sz += sizeof(double) * n;
+
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -3028,147 +10570,254 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  float*               A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  float*               B,
-                                  int                  ldb,
-                                  float*               work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverSsyevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              D,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverSgetrs_bufferSize(
-            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+        float* E = work;
+        work     = E + n;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+
+        CHECK_ROCBLAS_ERROR(rocsolver_ssyevd((rocblas_handle)handle,
+                                             hip2rocblas_evect(jobz),
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             A,
+                                             lda,
+                                             D,
+                                             E,
+                                             devInfo));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
     }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverSsyevd_bufferSize((rocblas_handle)handle, jobz, uplo, n, A, lda, D, &lwork));
+        CHECK_ROCBLAS_ERROR(
+            hipsolverManageWorkspace((rocblas_handle)handle, lwork + sizeof(float) * n));
 
-    return rocblas2hip_status(rocsolver_sgetrs(
-        (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, A, lda, devIpiv, B, ldb));
+        rocblas_device_malloc mem((rocblas_handle)handle, sizeof(float) * n);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        float* E = (float*)mem[0];
+
+        CHECK_ROCBLAS_ERROR(rocsolver_ssyevd((rocblas_handle)handle,
+                                             hip2rocblas_evect(jobz),
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             A,
+                                             lda,
+                                             D,
+                                             E,
+                                             devInfo));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  double*              A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  double*              B,
-                                  int                  ldb,
-                                  double*              work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverDsyevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             D,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverDgetrs_bufferSize(
-            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+        double* E = work;
+        work      = E + n;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+
+        CHECK_ROCBLAS_ERROR(rocsolver_dsyevd((rocblas_handle)handle,
+                                             hip2rocblas_evect(jobz),
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             A,
+                                             lda,
+                                             D,
+                                             E,
+                                             devInfo));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
     }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverDsyevd_bufferSize((rocblas_handle)handle, jobz, uplo, n, A, lda, D, &lwork));
+        CHECK_ROCBLAS_ERROR(
+            hipsolverManageWorkspace((rocblas_handle)handle, lwork + sizeof(double) * n));
 
-    return rocblas2hip_status(rocsolver_dgetrs(
-        (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, A, lda, devIpiv, B, ldb));
+        rocblas_device_malloc mem((rocblas_handle)handle, sizeof(double) * n);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        double* E = (double*)mem[0];
+
+        CHECK_ROCBLAS_ERROR(rocsolver_dsyevd((rocblas_handle)handle,
+                                             hip2rocblas_evect(jobz),
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             A,
+                                             lda,
+                                             D,
+                                             E,
+                                             devInfo));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  hipFloatComplex*     A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  hipFloatComplex*     B,
-                                  int                  ldb,
-                                  hipFloatComplex*     work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverCheevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  float*              D,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverCgetrs_bufferSize(
-            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+        float* E = (float*)work;
+        work     = (hipFloatComplex*)(E + n);
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+
+        CHECK_ROCBLAS_ERROR(rocsolver_cheevd((rocblas_handle)handle,
+                                             hip2rocblas_evect(jobz),
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             (rocblas_float_complex*)A,
+                                             lda,
+                                             D,
+                                             E,
+                                             devInfo));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
     }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverCheevd_bufferSize((rocblas_handle)handle, jobz, uplo, n, A, lda, D, &lwork));
+        CHECK_ROCBLAS_ERROR(
+            hipsolverManageWorkspace((rocblas_handle)handle, lwork + sizeof(float) * n));
 
-    return rocblas2hip_status(rocsolver_cgetrs((rocblas_handle)handle,
-                                               hip2rocblas_operation(trans),
-                                               n,
-                                               nrhs,
-                                               (rocblas_float_complex*)A,
-                                               lda,
-                                               devIpiv,
-                                               (rocblas_float_complex*)B,
-                                               ldb));
+        rocblas_device_malloc mem((rocblas_handle)handle, sizeof(float) * n);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        float* E = (float*)mem[0];
+
+        CHECK_ROCBLAS_ERROR(rocsolver_cheevd((rocblas_handle)handle,
+                                             hip2rocblas_evect(jobz),
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             (rocblas_float_complex*)A,
+                                             lda,
+                                             D,
+                                             E,
+                                             devInfo));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  hipDoubleComplex*    A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  hipDoubleComplex*    B,
-                                  int                  ldb,
-                                  hipDoubleComplex*    work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverZheevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  double*             D,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverZgetrs_bufferSize(
-            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+        double* E = (double*)work;
+        work      = (hipDoubleComplex*)(E + n);
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+
+        CHECK_ROCBLAS_ERROR(rocsolver_zheevd((rocblas_handle)handle,
+                                             hip2rocblas_evect(jobz),
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             (rocblas_double_complex*)A,
+                                             lda,
+                                             D,
+                                             E,
+                                             devInfo));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
     }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverZheevd_bufferSize((rocblas_handle)handle, jobz, uplo, n, A, lda, D, &lwork));
+        CHECK_ROCBLAS_ERROR(
+            hipsolverManageWorkspace((rocblas_handle)handle, lwork + sizeof(double) * n));
 
-    return rocblas2hip_status(rocsolver_zgetrs((rocblas_handle)handle,
-                                               hip2rocblas_operation(trans),
-                                               n,
-                                               nrhs,
-                                               (rocblas_double_complex*)A,
-                                               lda,
-                                               devIpiv,
-                                               (rocblas_double_complex*)B,
-                                               ldb));
+        rocblas_device_malloc mem((rocblas_handle)handle, sizeof(double) * n);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        double* E = (double*)mem[0];
+
+        CHECK_ROCBLAS_ERROR(rocsolver_zheevd((rocblas_handle)handle,
+                                             hip2rocblas_evect(jobz),
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             (rocblas_double_complex*)A,
+                                             lda,
+                                             D,
+                                             E,
+                                             devInfo));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** POTRF ********************/
-hipsolverStatus_t hipsolverSpotrf_bufferSize(
-    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork)
+/******************** SYGVD/HEGVD ********************/
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvd_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverEigType_t  itype,
+                                                              hipsolverEigMode_t  jobz,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              float*              A,
+                                                              int                 lda,
+                                                              float*              B,
+                                                              int                 ldb,
+                                                              float*              D,
+                                                              int*                lwork)
 try
 {
     if(lwork == nullptr)
@@ -3178,10 +10827,23 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_spotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_ssygvd((rocblas_handle)handle,
+                                                                   hip2rocblas_eform(itype),
+                                                                   hip2rocblas_evect(jobz),
+                                                                   hip2rocblas_fill(uplo),
+                                                                   n,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   nullptr,
+                                                                   ldb,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
+    // space for E array
+    sz += sizeof(float) * n;
+
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -3195,8 +10857,17 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrf_bufferSize(
-    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvd_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverEigType_t  itype,
+                                                              hipsolverEigMode_t  jobz,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              double*             A,
+                                                              int                 lda,
+                                                              double*             B,
+                                                              int                 ldb,
+                                                              double*             D,
+                                                              int*                lwork)
 try
 {
     if(lwork == nullptr)
@@ -3206,10 +10877,23 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_dpotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dsygvd((rocblas_handle)handle,
+                                                                   hip2rocblas_eform(itype),
+                                                                   hip2rocblas_evect(jobz),
+                                                                   hip2rocblas_fill(uplo),
+                                                                   n,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   nullptr,
+                                                                   ldb,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
+    // space for E array
+    sz += sizeof(double) * n;
+
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -3223,12 +10907,17 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrf_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             hipFloatComplex*    A,
-                                             int                 lda,
-                                             int*                lwork)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvd_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverEigType_t  itype,
+                                                              hipsolverEigMode_t  jobz,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              hipFloatComplex*    A,
+                                                              int                 lda,
+                                                              hipFloatComplex*    B,
+                                                              int                 ldb,
+                                                              float*              D,
+                                                              int*                lwork)
 try
 {
     if(lwork == nullptr)
@@ -3238,10 +10927,23 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_cpotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_chegvd((rocblas_handle)handle,
+                                                                   hip2rocblas_eform(itype),
+                                                                   hip2rocblas_evect(jobz),
+                                                                   hip2rocblas_fill(uplo),
+                                                                   n,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   nullptr,
+                                                                   ldb,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
+    // space for E array
+    sz += sizeof(float) * n;
+
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -3255,12 +10957,17 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrf_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             hipDoubleComplex*   A,
-                                             int                 lda,
-                                             int*                lwork)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvd_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverEigType_t  itype,
+                                                              hipsolverEigMode_t  jobz,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              hipDoubleComplex*   A,
+                                                              int                 lda,
+                                                              hipDoubleComplex*   B,
+                                                              int                 ldb,
+                                                              double*             D,
+                                                              int*                lwork)
 try
 {
     if(lwork == nullptr)
@@ -3270,10 +10977,23 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_zpotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zhegvd((rocblas_handle)handle,
+                                                                   hip2rocblas_eform(itype),
+                                                                   hip2rocblas_evect(jobz),
+                                                                   hip2rocblas_fill(uplo),
+                                                                   n,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   nullptr,
+                                                                   ldb,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
+    // space for E array
+    sz += sizeof(double) * n;
+
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -3287,130 +11007,291 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpotrf(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  float*              A,
-                                  int                 lda,
-                                  float*              work,
-                                  int                 lwork,
-                                  int*                devInfo)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvd(hipsolverHandle_t   handle,
+                                                   hipsolverEigType_t  itype,
+                                                   hipsolverEigMode_t  jobz,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   float*              B,
+                                                   int                 ldb,
+                                                   float*              D,
+                                                   float*              work,
+                                                   int                 lwork,
+                                                   int*                devInfo)
 try
 {
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverSpotrf_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+        float* E = work;
+        work     = E + n;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+
+        CHECK_ROCBLAS_ERROR(rocsolver_ssygvd((rocblas_handle)handle,
+                                             hip2rocblas_eform(itype),
+                                             hip2rocblas_evect(jobz),
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             A,
+                                             lda,
+                                             B,
+                                             ldb,
+                                             D,
+                                             E,
+                                             devInfo));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
     }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSsygvd_bufferSize(
+            (rocblas_handle)handle, itype, jobz, uplo, n, A, lda, B, ldb, D, &lwork));
+        CHECK_ROCBLAS_ERROR(
+            hipsolverManageWorkspace((rocblas_handle)handle, lwork + sizeof(float) * n));
 
-    return rocblas2hip_status(
-        rocsolver_spotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo));
+        rocblas_device_malloc mem((rocblas_handle)handle, sizeof(float) * n);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        float* E = (float*)mem[0];
+
+        CHECK_ROCBLAS_ERROR(rocsolver_ssygvd((rocblas_handle)handle,
+                                             hip2rocblas_eform(itype),
+                                             hip2rocblas_evect(jobz),
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             A,
+                                             lda,
+                                             B,
+                                             ldb,
+                                             D,
+                                             E,
+                                             devInfo));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrf(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  double*             A,
-                                  int                 lda,
-                                  double*             work,
-                                  int                 lwork,
-                                  int*                devInfo)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvd(hipsolverHandle_t   handle,
+                                                   hipsolverEigType_t  itype,
+                                                   hipsolverEigMode_t  jobz,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   double*             B,
+                                                   int                 ldb,
+                                                   double*             D,
+                                                   double*             work,
+                                                   int                 lwork,
+                                                   int*                devInfo)
 try
 {
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverDpotrf_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+        double* E = work;
+        work      = E + n;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+
+        CHECK_ROCBLAS_ERROR(rocsolver_dsygvd((rocblas_handle)handle,
+                                             hip2rocblas_eform(itype),
+                                             hip2rocblas_evect(jobz),
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             A,
+                                             lda,
+                                             B,
+                                             ldb,
+                                             D,
+                                             E,
+                                             devInfo));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
     }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDsygvd_bufferSize(
+            (rocblas_handle)handle, itype, jobz, uplo, n, A, lda, B, ldb, D, &lwork));
+        CHECK_ROCBLAS_ERROR(
+            hipsolverManageWorkspace((rocblas_handle)handle, lwork + sizeof(double) * n));
 
-    return rocblas2hip_status(
-        rocsolver_dpotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo));
+        rocblas_device_malloc mem((rocblas_handle)handle, sizeof(double) * n);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        double* E = (double*)mem[0];
+
+        CHECK_ROCBLAS_ERROR(rocsolver_dsygvd((rocblas_handle)handle,
+                                             hip2rocblas_eform(itype),
+                                             hip2rocblas_evect(jobz),
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             A,
+                                             lda,
+                                             B,
+                                             ldb,
+                                             D,
+                                             E,
+                                             devInfo));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrf(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipFloatComplex*    A,
-                                  int                 lda,
-                                  hipFloatComplex*    work,
-                                  int                 lwork,
-                                  int*                devInfo)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvd(hipsolverHandle_t   handle,
+                                                   hipsolverEigType_t  itype,
+                                                   hipsolverEigMode_t  jobz,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipFloatComplex*    A,
+                                                   int                 lda,
+                                                   hipFloatComplex*    B,
+                                                   int                 ldb,
+                                                   float*              D,
+                                                   hipFloatComplex*    work,
+                                                   int                 lwork,
+                                                   int*                devInfo)
 try
 {
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverCpotrf_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+        float* E = (float*)work;
+        work     = (hipFloatComplex*)(E + n);
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+
+        CHECK_ROCBLAS_ERROR(rocsolver_chegvd((rocblas_handle)handle,
+                                             hip2rocblas_eform(itype),
+                                             hip2rocblas_evect(jobz),
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             (rocblas_float_complex*)A,
+                                             lda,
+                                             (rocblas_float_complex*)B,
+                                             ldb,
+                                             D,
+                                             E,
+                                             devInfo));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
     }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverChegvd_bufferSize(
+            (rocblas_handle)handle, itype, jobz, uplo, n, A, lda, B, ldb, D, &lwork));
+        CHECK_ROCBLAS_ERROR(
+            hipsolverManageWorkspace((rocblas_handle)handle, lwork + sizeof(float) * n));
 
-    return rocblas2hip_status(rocsolver_cpotrf((rocblas_handle)handle,
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               (rocblas_float_complex*)A,
-                                               lda,
-                                               devInfo));
+        rocblas_device_malloc mem((rocblas_handle)handle, sizeof(float) * n);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        float* E = (float*)mem[0];
+
+        CHECK_ROCBLAS_ERROR(rocsolver_chegvd((rocblas_handle)handle,
+                                             hip2rocblas_eform(itype),
+                                             hip2rocblas_evect(jobz),
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             (rocblas_float_complex*)A,
+                                             lda,
+                                             (rocblas_float_complex*)B,
+                                             ldb,
+                                             D,
+                                             E,
+                                             devInfo));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrf(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipDoubleComplex*   A,
-                                  int                 lda,
-                                  hipDoubleComplex*   work,
-                                  int                 lwork,
-                                  int*                devInfo)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvd(hipsolverHandle_t   handle,
+                                                   hipsolverEigType_t  itype,
+                                                   hipsolverEigMode_t  jobz,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipDoubleComplex*   A,
+                                                   int                 lda,
+                                                   hipDoubleComplex*   B,
+                                                   int                 ldb,
+                                                   double*             D,
+                                                   hipDoubleComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo)
 try
 {
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverZpotrf_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+        double* E = (double*)work;
+        work      = (hipDoubleComplex*)(E + n);
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+
+        CHECK_ROCBLAS_ERROR(rocsolver_zhegvd((rocblas_handle)handle,
+                                             hip2rocblas_eform(itype),
+                                             hip2rocblas_evect(jobz),
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             (rocblas_double_complex*)A,
+                                             lda,
+                                             (rocblas_double_complex*)B,
+                                             ldb,
+                                             D,
+                                             E,
+                                             devInfo));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
     }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZhegvd_bufferSize(
+            (rocblas_handle)handle, itype, jobz, uplo, n, A, lda, B, ldb, D, &lwork));
+        CHECK_ROCBLAS_ERROR(
+            hipsolverManageWorkspace((rocblas_handle)handle, lwork + sizeof(double) * n));
 
-    return rocblas2hip_status(rocsolver_zpotrf((rocblas_handle)handle,
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               (rocblas_double_complex*)A,
-                                               lda,
-                                               devInfo));
+        rocblas_device_malloc mem((rocblas_handle)handle, sizeof(double) * n);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        double* E = (double*)mem[0];
+
+        CHECK_ROCBLAS_ERROR(rocsolver_zhegvd((rocblas_handle)handle,
+                                             hip2rocblas_eform(itype),
+                                             hip2rocblas_evect(jobz),
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             (rocblas_double_complex*)A,
+                                             lda,
+                                             (rocblas_double_complex*)B,
+                                             ldb,
+                                             D,
+                                             E,
+                                             devInfo));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** POTRF_BATCHED ********************/
-hipsolverStatus_t hipsolverSpotrfBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    float*              A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+/******************** SYGVD_PIPELINED/HEGVD_PIPELINED ********************/
+hipsolverStatus_t hipsolverSsygvdPipelined_bufferSize(hipsolverHandle_t   handle,
+                                                      hipsolverEigType_t  itype,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      float*              A,
+                                                      int                 lda,
+                                                      float*              B,
+                                                      int                 ldb,
+                                                      float*              D,
+                                                      int*                lwork,
+                                                      int                 batch_count)
 try
 {
     if(lwork == nullptr)
@@ -3419,11 +11300,17 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_spotrf_batched(
-        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr, batch_count));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_sygvd_pipelined_bufferSize_template<float>(
+            (rocblas_handle)handle,
+            hip2rocblas_eform(itype),
+            hip2rocblas_evect(jobz),
+            hip2rocblas_fill(uplo),
+            n,
+            lda,
+            ldb,
+            batch_count,
+            &sz));
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -3437,13 +11324,18 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrfBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    double*             A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverDsygvdPipelined_bufferSize(hipsolverHandle_t   handle,
+                                                      hipsolverEigType_t  itype,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      double*             A,
+                                                      int                 lda,
+                                                      double*             B,
+                                                      int                 ldb,
+                                                      double*             D,
+                                                      int*                lwork,
+                                                      int                 batch_count)
 try
 {
     if(lwork == nullptr)
@@ -3452,11 +11344,17 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dpotrf_batched(
-        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr, batch_count));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_sygvd_pipelined_bufferSize_template<double>(
+            (rocblas_handle)handle,
+            hip2rocblas_eform(itype),
+            hip2rocblas_evect(jobz),
+            hip2rocblas_fill(uplo),
+            n,
+            lda,
+            ldb,
+            batch_count,
+            &sz));
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -3470,13 +11368,18 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrfBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    hipFloatComplex*    A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverChegvdPipelined_bufferSize(hipsolverHandle_t   handle,
+                                                      hipsolverEigType_t  itype,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipFloatComplex*    A,
+                                                      int                 lda,
+                                                      hipFloatComplex*    B,
+                                                      int                 ldb,
+                                                      float*              D,
+                                                      int*                lwork,
+                                                      int                 batch_count)
 try
 {
     if(lwork == nullptr)
@@ -3485,11 +11388,17 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cpotrf_batched(
-        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr, batch_count));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_sygvd_pipelined_bufferSize_template<rocblas_float_complex>(
+            (rocblas_handle)handle,
+            hip2rocblas_eform(itype),
+            hip2rocblas_evect(jobz),
+            hip2rocblas_fill(uplo),
+            n,
+            lda,
+            ldb,
+            batch_count,
+            &sz));
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -3503,13 +11412,18 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrfBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    hipDoubleComplex*   A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverZhegvdPipelined_bufferSize(hipsolverHandle_t   handle,
+                                                      hipsolverEigType_t  itype,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipDoubleComplex*   A,
+                                                      int                 lda,
+                                                      hipDoubleComplex*   B,
+                                                      int                 ldb,
+                                                      double*             D,
+                                                      int*                lwork,
+                                                      int                 batch_count)
 try
 {
     if(lwork == nullptr)
@@ -3518,11 +11432,17 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zpotrf_batched(
-        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr, batch_count));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_sygvd_pipelined_bufferSize_template<rocblas_double_complex>(
+            (rocblas_handle)handle,
+            hip2rocblas_eform(itype),
+            hip2rocblas_evect(jobz),
+            hip2rocblas_fill(uplo),
+            n,
+            lda,
+            ldb,
+            batch_count,
+            &sz));
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -3536,136 +11456,304 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpotrfBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         float*              A[],
-                                         int                 lda,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverSsygvdPipelined(hipsolverHandle_t   handle,
+                                           hipsolverEigType_t  itype,
+                                           hipsolverEigMode_t  jobz,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           float*              A,
+                                           int                 lda,
+                                           float*              B,
+                                           int                 ldb,
+                                           float*              D,
+                                           float*              work,
+                                           int                 lwork,
+                                           int*                devInfo,
+                                           int                 batch_count)
 try
 {
+    int size_work;
+    CHECK_HIPSOLVER_ERROR(hipsolverSsygvdPipelined_bufferSize(
+        handle, itype, jobz, uplo, n, A, lda, B, ldb, D, &size_work, batch_count));
+
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverSpotrfBatched_bufferSize(
-            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+        if(lwork < size_work)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+
+        CHECK_ROCBLAS_ERROR(hipsolver_sygvd_pipelined_template((rocblas_handle)handle,
+                                                               hip2rocblas_eform(itype),
+                                                               hip2rocblas_evect(jobz),
+                                                               hip2rocblas_fill(uplo),
+                                                               n,
+                                                               A,
+                                                               lda,
+                                                               B,
+                                                               ldb,
+                                                               D,
+                                                               devInfo,
+                                                               batch_count,
+                                                               (void*)work,
+                                                               lwork));
     }
+    else
+    {
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size_work));
 
-    return rocblas2hip_status(rocsolver_spotrf_batched(
-        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo, batch_count));
+        rocblas_device_malloc mem((rocblas_handle)handle, size_work);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_sygvd_pipelined_template((rocblas_handle)handle,
+                                                               hip2rocblas_eform(itype),
+                                                               hip2rocblas_evect(jobz),
+                                                               hip2rocblas_fill(uplo),
+                                                               n,
+                                                               A,
+                                                               lda,
+                                                               B,
+                                                               ldb,
+                                                               D,
+                                                               devInfo,
+                                                               batch_count,
+                                                               mem[0],
+                                                               size_work));
+    }
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrfBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         double*             A[],
-                                         int                 lda,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverDsygvdPipelined(hipsolverHandle_t   handle,
+                                           hipsolverEigType_t  itype,
+                                           hipsolverEigMode_t  jobz,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           double*             A,
+                                           int                 lda,
+                                           double*             B,
+                                           int                 ldb,
+                                           double*             D,
+                                           double*             work,
+                                           int                 lwork,
+                                           int*                devInfo,
+                                           int                 batch_count)
 try
 {
+    int size_work;
+    CHECK_HIPSOLVER_ERROR(hipsolverDsygvdPipelined_bufferSize(
+        handle, itype, jobz, uplo, n, A, lda, B, ldb, D, &size_work, batch_count));
+
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverDpotrfBatched_bufferSize(
-            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+        if(lwork < size_work)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+
+        CHECK_ROCBLAS_ERROR(hipsolver_sygvd_pipelined_template((rocblas_handle)handle,
+                                                               hip2rocblas_eform(itype),
+                                                               hip2rocblas_evect(jobz),
+                                                               hip2rocblas_fill(uplo),
+                                                               n,
+                                                               A,
+                                                               lda,
+                                                               B,
+                                                               ldb,
+                                                               D,
+                                                               devInfo,
+                                                               batch_count,
+                                                               (void*)work,
+                                                               lwork));
     }
+    else
+    {
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size_work));
 
-    return rocblas2hip_status(rocsolver_dpotrf_batched(
-        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo, batch_count));
+        rocblas_device_malloc mem((rocblas_handle)handle, size_work);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_sygvd_pipelined_template((rocblas_handle)handle,
+                                                               hip2rocblas_eform(itype),
+                                                               hip2rocblas_evect(jobz),
+                                                               hip2rocblas_fill(uplo),
+                                                               n,
+                                                               A,
+                                                               lda,
+                                                               B,
+                                                               ldb,
+                                                               D,
+                                                               devInfo,
+                                                               batch_count,
+                                                               mem[0],
+                                                               size_work));
+    }
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrfBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipFloatComplex*    A[],
-                                         int                 lda,
-                                         hipFloatComplex*    work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverChegvdPipelined(hipsolverHandle_t   handle,
+                                           hipsolverEigType_t  itype,
+                                           hipsolverEigMode_t  jobz,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           hipFloatComplex*    A,
+                                           int                 lda,
+                                           hipFloatComplex*    B,
+                                           int                 ldb,
+                                           float*              D,
+                                           hipFloatComplex*    work,
+                                           int                 lwork,
+                                           int*                devInfo,
+                                           int                 batch_count)
 try
 {
+    int size_work;
+    CHECK_HIPSOLVER_ERROR(hipsolverChegvdPipelined_bufferSize(
+        handle, itype, jobz, uplo, n, A, lda, B, ldb, D, &size_work, batch_count));
+
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverCpotrfBatched_bufferSize(
-            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+        if(lwork < size_work)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+
+        CHECK_ROCBLAS_ERROR(hipsolver_sygvd_pipelined_template((rocblas_handle)handle,
+                                                               hip2rocblas_eform(itype),
+                                                               hip2rocblas_evect(jobz),
+                                                               hip2rocblas_fill(uplo),
+                                                               n,
+                                                               (rocblas_float_complex*)A,
+                                                               lda,
+                                                               (rocblas_float_complex*)B,
+                                                               ldb,
+                                                               D,
+                                                               devInfo,
+                                                               batch_count,
+                                                               (void*)work,
+                                                               lwork));
     }
+    else
+    {
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size_work));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_work);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
 
-    return rocblas2hip_status(rocsolver_cpotrf_batched((rocblas_handle)handle,
-                                                       hip2rocblas_fill(uplo),
-                                                       n,
-                                                       (rocblas_float_complex**)A,
-                                                       lda,
-                                                       devInfo,
-                                                       batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolver_sygvd_pipelined_template((rocblas_handle)handle,
+                                                               hip2rocblas_eform(itype),
+                                                               hip2rocblas_evect(jobz),
+                                                               hip2rocblas_fill(uplo),
+                                                               n,
+                                                               (rocblas_float_complex*)A,
+                                                               lda,
+                                                               (rocblas_float_complex*)B,
+                                                               ldb,
+                                                               D,
+                                                               devInfo,
+                                                               batch_count,
+                                                               mem[0],
+                                                               size_work));
+    }
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrfBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipDoubleComplex*   A[],
-                                         int                 lda,
-                                         hipDoubleComplex*   work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverZhegvdPipelined(hipsolverHandle_t   handle,
+                                           hipsolverEigType_t  itype,
+                                           hipsolverEigMode_t  jobz,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           hipDoubleComplex*   A,
+                                           int                 lda,
+                                           hipDoubleComplex*   B,
+                                           int                 ldb,
+                                           double*             D,
+                                           hipDoubleComplex*   work,
+                                           int                 lwork,
+                                           int*                devInfo,
+                                           int                 batch_count)
 try
 {
+    int size_work;
+    CHECK_HIPSOLVER_ERROR(hipsolverZhegvdPipelined_bufferSize(
+        handle, itype, jobz, uplo, n, A, lda, B, ldb, D, &size_work, batch_count));
+
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverZpotrfBatched_bufferSize(
-            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+        if(lwork < size_work)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+
+        CHECK_ROCBLAS_ERROR(hipsolver_sygvd_pipelined_template((rocblas_handle)handle,
+                                                               hip2rocblas_eform(itype),
+                                                               hip2rocblas_evect(jobz),
+                                                               hip2rocblas_fill(uplo),
+                                                               n,
+                                                               (rocblas_double_complex*)A,
+                                                               lda,
+                                                               (rocblas_double_complex*)B,
+                                                               ldb,
+                                                               D,
+                                                               devInfo,
+                                                               batch_count,
+                                                               (void*)work,
+                                                               lwork));
     }
+    else
+    {
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, size_work));
+
+        rocblas_device_malloc mem((rocblas_handle)handle, size_work);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
 
-    return rocblas2hip_status(rocsolver_zpotrf_batched((rocblas_handle)handle,
-                                                       hip2rocblas_fill(uplo),
-                                                       n,
-                                                       (rocblas_double_complex**)A,
-                                                       lda,
-                                                       devInfo,
-                                                       batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolver_sygvd_pipelined_template((rocblas_handle)handle,
+                                                               hip2rocblas_eform(itype),
+                                                               hip2rocblas_evect(jobz),
+                                                               hip2rocblas_fill(uplo),
+                                                               n,
+                                                               (rocblas_double_complex*)A,
+                                                               lda,
+                                                               (rocblas_double_complex*)B,
+                                                               ldb,
+                                                               D,
+                                                               devInfo,
+                                                               batch_count,
+                                                               mem[0],
+                                                               size_work));
+    }
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, batch_count);
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** SYEVD/HEEVD ********************/
-hipsolverStatus_t hipsolverSsyevd_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverEigMode_t  jobz,
+
+/******************** SYTRD/HETRD ********************/
+hipsolverStatus_t hipsolverSsytrd_bufferSize(hipsolverHandle_t   handle,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
                                              float*              A,
                                              int                 lda,
                                              float*              D,
+                                             float*              E,
+                                             float*              tau,
                                              int*                lwork)
 try
 {
@@ -3676,8 +11764,7 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_ssyevd((rocblas_handle)handle,
-                                                                   hip2rocblas_evect(jobz),
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_ssytrd((rocblas_handle)handle,
                                                                    hip2rocblas_fill(uplo),
                                                                    n,
                                                                    nullptr,
@@ -3687,9 +11774,6 @@ try
                                                                    nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
-    // space for E array
-    sz += sizeof(float) * n;
-
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -3703,13 +11787,14 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDsyevd_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverEigMode_t  jobz,
+hipsolverStatus_t hipsolverDsytrd_bufferSize(hipsolverHandle_t   handle,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
                                              double*             A,
                                              int                 lda,
                                              double*             D,
+                                             double*             E,
+                                             double*             tau,
                                              int*                lwork)
 try
 {
@@ -3720,8 +11805,7 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dsyevd((rocblas_handle)handle,
-                                                                   hip2rocblas_evect(jobz),
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dsytrd((rocblas_handle)handle,
                                                                    hip2rocblas_fill(uplo),
                                                                    n,
                                                                    nullptr,
@@ -3731,9 +11815,6 @@ try
                                                                    nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
-    // space for E array
-    sz += sizeof(double) * n;
-
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -3747,13 +11828,14 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCheevd_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverEigMode_t  jobz,
+hipsolverStatus_t hipsolverChetrd_bufferSize(hipsolverHandle_t   handle,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
                                              hipFloatComplex*    A,
                                              int                 lda,
                                              float*              D,
+                                             float*              E,
+                                             hipFloatComplex*    tau,
                                              int*                lwork)
 try
 {
@@ -3764,8 +11846,7 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cheevd((rocblas_handle)handle,
-                                                                   hip2rocblas_evect(jobz),
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_chetrd((rocblas_handle)handle,
                                                                    hip2rocblas_fill(uplo),
                                                                    n,
                                                                    nullptr,
@@ -3775,9 +11856,6 @@ try
                                                                    nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
-    // space for E array
-    sz += sizeof(float) * n;
-
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -3791,13 +11869,14 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZheevd_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverEigMode_t  jobz,
+hipsolverStatus_t hipsolverZhetrd_bufferSize(hipsolverHandle_t   handle,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
                                              hipDoubleComplex*   A,
                                              int                 lda,
                                              double*             D,
+                                             double*             E,
+                                             hipDoubleComplex*   tau,
                                              int*                lwork)
 try
 {
@@ -3808,8 +11887,7 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zheevd((rocblas_handle)handle,
-                                                                   hip2rocblas_evect(jobz),
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zhetrd((rocblas_handle)handle,
                                                                    hip2rocblas_fill(uplo),
                                                                    n,
                                                                    nullptr,
@@ -3819,9 +11897,6 @@ try
                                                                    nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
-    // space for E array
-    sz += sizeof(double) * n;
-
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -3835,246 +11910,141 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSsyevd(hipsolverHandle_t   handle,
-                                  hipsolverEigMode_t  jobz,
+hipsolverStatus_t hipsolverSsytrd(hipsolverHandle_t   handle,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
                                   float*              A,
                                   int                 lda,
                                   float*              D,
+                                  float*              E,
+                                  float*              tau,
                                   float*              work,
-                                  int                 lwork,
-                                  int*                devInfo)
-try
-{
-    if(work != nullptr)
-    {
-        float* E = work;
-        work     = E + n;
-
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-
-        return rocblas2hip_status(rocsolver_ssyevd((rocblas_handle)handle,
-                                                   hip2rocblas_evect(jobz),
-                                                   hip2rocblas_fill(uplo),
-                                                   n,
-                                                   A,
-                                                   lda,
-                                                   D,
-                                                   E,
-                                                   devInfo));
-    }
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverSsyevd_bufferSize((rocblas_handle)handle, jobz, uplo, n, A, lda, D, &lwork));
-        CHECK_ROCBLAS_ERROR(
-            hipsolverManageWorkspace((rocblas_handle)handle, lwork + sizeof(float) * n));
-
-        rocblas_device_malloc mem((rocblas_handle)handle, sizeof(float) * n);
-        if(!mem)
-            return HIPSOLVER_STATUS_ALLOC_FAILED;
-        float* E = (float*)mem[0];
-
-        return rocblas2hip_status(rocsolver_ssyevd((rocblas_handle)handle,
-                                                   hip2rocblas_evect(jobz),
-                                                   hip2rocblas_fill(uplo),
-                                                   n,
-                                                   A,
-                                                   lda,
-                                                   D,
-                                                   E,
-                                                   devInfo));
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work != nullptr)
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverSsytrd_bufferSize((rocblas_handle)handle, uplo, n, A, lda, D, E, tau, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
+
+    return rocblas2hip_status(
+        rocsolver_ssytrd((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, D, E, tau));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDsyevd(hipsolverHandle_t   handle,
-                                  hipsolverEigMode_t  jobz,
+hipsolverStatus_t hipsolverDsytrd(hipsolverHandle_t   handle,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
                                   double*             A,
                                   int                 lda,
                                   double*             D,
+                                  double*             E,
+                                  double*             tau,
                                   double*             work,
                                   int                 lwork,
                                   int*                devInfo)
 try
 {
     if(work != nullptr)
-    {
-        double* E = work;
-        work      = E + n;
-
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-
-        return rocblas2hip_status(rocsolver_dsyevd((rocblas_handle)handle,
-                                                   hip2rocblas_evect(jobz),
-                                                   hip2rocblas_fill(uplo),
-                                                   n,
-                                                   A,
-                                                   lda,
-                                                   D,
-                                                   E,
-                                                   devInfo));
-    }
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
     else
     {
         CHECK_HIPSOLVER_ERROR(
-            hipsolverDsyevd_bufferSize((rocblas_handle)handle, jobz, uplo, n, A, lda, D, &lwork));
-        CHECK_ROCBLAS_ERROR(
-            hipsolverManageWorkspace((rocblas_handle)handle, lwork + sizeof(double) * n));
-
-        rocblas_device_malloc mem((rocblas_handle)handle, sizeof(double) * n);
-        if(!mem)
-            return HIPSOLVER_STATUS_ALLOC_FAILED;
-        double* E = (double*)mem[0];
-
-        return rocblas2hip_status(rocsolver_dsyevd((rocblas_handle)handle,
-                                                   hip2rocblas_evect(jobz),
-                                                   hip2rocblas_fill(uplo),
-                                                   n,
-                                                   A,
-                                                   lda,
-                                                   D,
-                                                   E,
-                                                   devInfo));
+            hipsolverDsytrd_bufferSize((rocblas_handle)handle, uplo, n, A, lda, D, E, tau, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
+
+    return rocblas2hip_status(
+        rocsolver_dsytrd((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, D, E, tau));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCheevd(hipsolverHandle_t   handle,
-                                  hipsolverEigMode_t  jobz,
+hipsolverStatus_t hipsolverChetrd(hipsolverHandle_t   handle,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
                                   hipFloatComplex*    A,
                                   int                 lda,
                                   float*              D,
+                                  float*              E,
+                                  hipFloatComplex*    tau,
                                   hipFloatComplex*    work,
                                   int                 lwork,
                                   int*                devInfo)
 try
 {
     if(work != nullptr)
-    {
-        float* E = (float*)work;
-        work     = (hipFloatComplex*)(E + n);
-
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-
-        return rocblas2hip_status(rocsolver_cheevd((rocblas_handle)handle,
-                                                   hip2rocblas_evect(jobz),
-                                                   hip2rocblas_fill(uplo),
-                                                   n,
-                                                   (rocblas_float_complex*)A,
-                                                   lda,
-                                                   D,
-                                                   E,
-                                                   devInfo));
-    }
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
     else
     {
         CHECK_HIPSOLVER_ERROR(
-            hipsolverCheevd_bufferSize((rocblas_handle)handle, jobz, uplo, n, A, lda, D, &lwork));
-        CHECK_ROCBLAS_ERROR(
-            hipsolverManageWorkspace((rocblas_handle)handle, lwork + sizeof(float) * n));
-
-        rocblas_device_malloc mem((rocblas_handle)handle, sizeof(float) * n);
-        if(!mem)
-            return HIPSOLVER_STATUS_ALLOC_FAILED;
-        float* E = (float*)mem[0];
-
-        return rocblas2hip_status(rocsolver_cheevd((rocblas_handle)handle,
-                                                   hip2rocblas_evect(jobz),
-                                                   hip2rocblas_fill(uplo),
-                                                   n,
-                                                   (rocblas_float_complex*)A,
-                                                   lda,
-                                                   D,
-                                                   E,
-                                                   devInfo));
+            hipsolverChetrd_bufferSize((rocblas_handle)handle, uplo, n, A, lda, D, E, tau, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
+
+    return rocblas2hip_status(rocsolver_chetrd((rocblas_handle)handle,
+                                               hip2rocblas_fill(uplo),
+                                               n,
+                                               (rocblas_float_complex*)A,
+                                               lda,
+                                               D,
+                                               E,
+                                               (rocblas_float_complex*)tau));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZheevd(hipsolverHandle_t   handle,
-                                  hipsolverEigMode_t  jobz,
+hipsolverStatus_t hipsolverZhetrd(hipsolverHandle_t   handle,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
                                   hipDoubleComplex*   A,
                                   int                 lda,
                                   double*             D,
+                                  double*             E,
+                                  hipDoubleComplex*   tau,
                                   hipDoubleComplex*   work,
                                   int                 lwork,
                                   int*                devInfo)
 try
 {
     if(work != nullptr)
-    {
-        double* E = (double*)work;
-        work      = (hipDoubleComplex*)(E + n);
-
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-
-        return rocblas2hip_status(rocsolver_zheevd((rocblas_handle)handle,
-                                                   hip2rocblas_evect(jobz),
-                                                   hip2rocblas_fill(uplo),
-                                                   n,
-                                                   (rocblas_double_complex*)A,
-                                                   lda,
-                                                   D,
-                                                   E,
-                                                   devInfo));
-    }
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
     else
     {
         CHECK_HIPSOLVER_ERROR(
-            hipsolverZheevd_bufferSize((rocblas_handle)handle, jobz, uplo, n, A, lda, D, &lwork));
-        CHECK_ROCBLAS_ERROR(
-            hipsolverManageWorkspace((rocblas_handle)handle, lwork + sizeof(double) * n));
-
-        rocblas_device_malloc mem((rocblas_handle)handle, sizeof(double) * n);
-        if(!mem)
-            return HIPSOLVER_STATUS_ALLOC_FAILED;
-        double* E = (double*)mem[0];
-
-        return rocblas2hip_status(rocsolver_zheevd((rocblas_handle)handle,
-                                                   hip2rocblas_evect(jobz),
-                                                   hip2rocblas_fill(uplo),
-                                                   n,
-                                                   (rocblas_double_complex*)A,
-                                                   lda,
-                                                   D,
-                                                   E,
-                                                   devInfo));
+            hipsolverZhetrd_bufferSize((rocblas_handle)handle, uplo, n, A, lda, D, E, tau, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
+
+    return rocblas2hip_status(rocsolver_zhetrd((rocblas_handle)handle,
+                                               hip2rocblas_fill(uplo),
+                                               n,
+                                               (rocblas_double_complex*)A,
+                                               lda,
+                                               D,
+                                               E,
+                                               (rocblas_double_complex*)tau));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** SYGVD/HEGVD ********************/
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvd_bufferSize(hipsolverHandle_t   handle,
-                                                              hipsolverEigType_t  itype,
-                                                              hipsolverEigMode_t  jobz,
-                                                              hipsolverFillMode_t uplo,
-                                                              int                 n,
-                                                              float*              A,
-                                                              int                 lda,
-                                                              float*              B,
-                                                              int                 ldb,
-                                                              float*              D,
-                                                              int*                lwork)
+/******************** SYTRF ********************/
+hipsolverStatus_t hipsolverSsytrf_bufferSize(
+    hipsolverHandle_t handle, int n, float* A, int lda, int* lwork)
 try
 {
     if(lwork == nullptr)
@@ -4084,23 +12054,10 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_ssygvd((rocblas_handle)handle,
-                                                                   hip2rocblas_eform(itype),
-                                                                   hip2rocblas_evect(jobz),
-                                                                   hip2rocblas_fill(uplo),
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   ldb,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_ssytrf(
+        (rocblas_handle)handle, rocblas_fill_upper, n, nullptr, lda, nullptr, nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
-    // space for E array
-    sz += sizeof(float) * n;
-
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -4114,17 +12071,8 @@ catch(...)
     return exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvd_bufferSize(hipsolverHandle_t   handle,
-                                                              hipsolverEigType_t  itype,
-                                                              hipsolverEigMode_t  jobz,
-                                                              hipsolverFillMode_t uplo,
-                                                              int                 n,
-                                                              double*             A,
-                                                              int                 lda,
-                                                              double*             B,
-                                                              int                 ldb,
-                                                              double*             D,
-                                                              int*                lwork)
+hipsolverStatus_t hipsolverDsytrf_bufferSize(
+    hipsolverHandle_t handle, int n, double* A, int lda, int* lwork)
 try
 {
     if(lwork == nullptr)
@@ -4134,23 +12082,10 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dsygvd((rocblas_handle)handle,
-                                                                   hip2rocblas_eform(itype),
-                                                                   hip2rocblas_evect(jobz),
-                                                                   hip2rocblas_fill(uplo),
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   ldb,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dsytrf(
+        (rocblas_handle)handle, rocblas_fill_upper, n, nullptr, lda, nullptr, nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
-    // space for E array
-    sz += sizeof(double) * n;
-
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -4164,17 +12099,8 @@ catch(...)
     return exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvd_bufferSize(hipsolverHandle_t   handle,
-                                                              hipsolverEigType_t  itype,
-                                                              hipsolverEigMode_t  jobz,
-                                                              hipsolverFillMode_t uplo,
-                                                              int                 n,
-                                                              hipFloatComplex*    A,
-                                                              int                 lda,
-                                                              hipFloatComplex*    B,
-                                                              int                 ldb,
-                                                              float*              D,
-                                                              int*                lwork)
+hipsolverStatus_t hipsolverCsytrf_bufferSize(
+    hipsolverHandle_t handle, int n, hipFloatComplex* A, int lda, int* lwork)
 try
 {
     if(lwork == nullptr)
@@ -4184,23 +12110,10 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_chegvd((rocblas_handle)handle,
-                                                                   hip2rocblas_eform(itype),
-                                                                   hip2rocblas_evect(jobz),
-                                                                   hip2rocblas_fill(uplo),
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   ldb,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_csytrf(
+        (rocblas_handle)handle, rocblas_fill_upper, n, nullptr, lda, nullptr, nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
-    // space for E array
-    sz += sizeof(float) * n;
-
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -4214,17 +12127,8 @@ catch(...)
     return exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvd_bufferSize(hipsolverHandle_t   handle,
-                                                              hipsolverEigType_t  itype,
-                                                              hipsolverEigMode_t  jobz,
-                                                              hipsolverFillMode_t uplo,
-                                                              int                 n,
-                                                              hipDoubleComplex*   A,
-                                                              int                 lda,
-                                                              hipDoubleComplex*   B,
-                                                              int                 ldb,
-                                                              double*             D,
-                                                              int*                lwork)
+hipsolverStatus_t hipsolverZsytrf_bufferSize(
+    hipsolverHandle_t handle, int n, hipDoubleComplex* A, int lda, int* lwork)
 try
 {
     if(lwork == nullptr)
@@ -4234,23 +12138,10 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zhegvd((rocblas_handle)handle,
-                                                                   hip2rocblas_eform(itype),
-                                                                   hip2rocblas_evect(jobz),
-                                                                   hip2rocblas_fill(uplo),
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   ldb,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zsytrf(
+        (rocblas_handle)handle, rocblas_fill_upper, n, nullptr, lda, nullptr, nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
-    // space for E array
-    sz += sizeof(double) * n;
-
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
     if(sz > INT_MAX)
@@ -4264,279 +12155,142 @@ catch(...)
     return exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvd(hipsolverHandle_t   handle,
-                                                   hipsolverEigType_t  itype,
-                                                   hipsolverEigMode_t  jobz,
-                                                   hipsolverFillMode_t uplo,
-                                                   int                 n,
-                                                   float*              A,
-                                                   int                 lda,
-                                                   float*              B,
-                                                   int                 ldb,
-                                                   float*              D,
-                                                   float*              work,
-                                                   int                 lwork,
-                                                   int*                devInfo)
+hipsolverStatus_t hipsolverSsytrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(work != nullptr)
-    {
-        float* E = work;
-        work     = E + n;
-
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-
-        return rocblas2hip_status(rocsolver_ssygvd((rocblas_handle)handle,
-                                                   hip2rocblas_eform(itype),
-                                                   hip2rocblas_evect(jobz),
-                                                   hip2rocblas_fill(uplo),
-                                                   n,
-                                                   A,
-                                                   lda,
-                                                   B,
-                                                   ldb,
-                                                   D,
-                                                   E,
-                                                   devInfo));
-    }
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverSsygvd_bufferSize(
-            (rocblas_handle)handle, itype, jobz, uplo, n, A, lda, B, ldb, D, &lwork));
-        CHECK_ROCBLAS_ERROR(
-            hipsolverManageWorkspace((rocblas_handle)handle, lwork + sizeof(float) * n));
-
-        rocblas_device_malloc mem((rocblas_handle)handle, sizeof(float) * n);
-        if(!mem)
-            return HIPSOLVER_STATUS_ALLOC_FAILED;
-        float* E = (float*)mem[0];
-
-        return rocblas2hip_status(rocsolver_ssygvd((rocblas_handle)handle,
-                                                   hip2rocblas_eform(itype),
-                                                   hip2rocblas_evect(jobz),
-                                                   hip2rocblas_fill(uplo),
-                                                   n,
-                                                   A,
-                                                   lda,
-                                                   B,
-                                                   ldb,
-                                                   D,
-                                                   E,
-                                                   devInfo));
+        CHECK_HIPSOLVER_ERROR(hipsolverSsytrf_bufferSize(
+            (rocblas_handle)handle, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_ssytrf(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devIpiv, devInfo));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
 }
 catch(...)
 {
     return exception2hip_status();
 }
-
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvd(hipsolverHandle_t   handle,
-                                                   hipsolverEigType_t  itype,
-                                                   hipsolverEigMode_t  jobz,
-                                                   hipsolverFillMode_t uplo,
-                                                   int                 n,
-                                                   double*             A,
-                                                   int                 lda,
-                                                   double*             B,
-                                                   int                 ldb,
-                                                   double*             D,
-                                                   double*             work,
-                                                   int                 lwork,
-                                                   int*                devInfo)
+
+hipsolverStatus_t hipsolverDsytrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(work != nullptr)
-    {
-        double* E = work;
-        work      = E + n;
-
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-
-        return rocblas2hip_status(rocsolver_dsygvd((rocblas_handle)handle,
-                                                   hip2rocblas_eform(itype),
-                                                   hip2rocblas_evect(jobz),
-                                                   hip2rocblas_fill(uplo),
-                                                   n,
-                                                   A,
-                                                   lda,
-                                                   B,
-                                                   ldb,
-                                                   D,
-                                                   E,
-                                                   devInfo));
-    }
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverDsygvd_bufferSize(
-            (rocblas_handle)handle, itype, jobz, uplo, n, A, lda, B, ldb, D, &lwork));
-        CHECK_ROCBLAS_ERROR(
-            hipsolverManageWorkspace((rocblas_handle)handle, lwork + sizeof(double) * n));
-
-        rocblas_device_malloc mem((rocblas_handle)handle, sizeof(double) * n);
-        if(!mem)
-            return HIPSOLVER_STATUS_ALLOC_FAILED;
-        double* E = (double*)mem[0];
-
-        return rocblas2hip_status(rocsolver_dsygvd((rocblas_handle)handle,
-                                                   hip2rocblas_eform(itype),
-                                                   hip2rocblas_evect(jobz),
-                                                   hip2rocblas_fill(uplo),
-                                                   n,
-                                                   A,
-                                                   lda,
-                                                   B,
-                                                   ldb,
-                                                   D,
-                                                   E,
-                                                   devInfo));
+        CHECK_HIPSOLVER_ERROR(hipsolverDsytrf_bufferSize(
+            (rocblas_handle)handle, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_dsytrf(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devIpiv, devInfo));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvd(hipsolverHandle_t   handle,
-                                                   hipsolverEigType_t  itype,
-                                                   hipsolverEigMode_t  jobz,
-                                                   hipsolverFillMode_t uplo,
-                                                   int                 n,
-                                                   hipFloatComplex*    A,
-                                                   int                 lda,
-                                                   hipFloatComplex*    B,
-                                                   int                 ldb,
-                                                   float*              D,
-                                                   hipFloatComplex*    work,
-                                                   int                 lwork,
-                                                   int*                devInfo)
+hipsolverStatus_t hipsolverCsytrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(work != nullptr)
-    {
-        float* E = (float*)work;
-        work     = (hipFloatComplex*)(E + n);
-
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-
-        return rocblas2hip_status(rocsolver_chegvd((rocblas_handle)handle,
-                                                   hip2rocblas_eform(itype),
-                                                   hip2rocblas_evect(jobz),
-                                                   hip2rocblas_fill(uplo),
-                                                   n,
-                                                   (rocblas_float_complex*)A,
-                                                   lda,
-                                                   (rocblas_float_complex*)B,
-                                                   ldb,
-                                                   D,
-                                                   E,
-                                                   devInfo));
-    }
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverChegvd_bufferSize(
-            (rocblas_handle)handle, itype, jobz, uplo, n, A, lda, B, ldb, D, &lwork));
-        CHECK_ROCBLAS_ERROR(
-            hipsolverManageWorkspace((rocblas_handle)handle, lwork + sizeof(float) * n));
-
-        rocblas_device_malloc mem((rocblas_handle)handle, sizeof(float) * n);
-        if(!mem)
-            return HIPSOLVER_STATUS_ALLOC_FAILED;
-        float* E = (float*)mem[0];
-
-        return rocblas2hip_status(rocsolver_chegvd((rocblas_handle)handle,
-                                                   hip2rocblas_eform(itype),
-                                                   hip2rocblas_evect(jobz),
-                                                   hip2rocblas_fill(uplo),
-                                                   n,
-                                                   (rocblas_float_complex*)A,
-                                                   lda,
-                                                   (rocblas_float_complex*)B,
-                                                   ldb,
-                                                   D,
-                                                   E,
-                                                   devInfo));
+        CHECK_HIPSOLVER_ERROR(hipsolverCsytrf_bufferSize(
+            (rocblas_handle)handle, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_csytrf((rocblas_handle)handle,
+                                         hip2rocblas_fill(uplo),
+                                         n,
+                                         (rocblas_float_complex*)A,
+                                         lda,
+                                         devIpiv,
+                                         devInfo));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvd(hipsolverHandle_t   handle,
-                                                   hipsolverEigType_t  itype,
-                                                   hipsolverEigMode_t  jobz,
-                                                   hipsolverFillMode_t uplo,
-                                                   int                 n,
-                                                   hipDoubleComplex*   A,
-                                                   int                 lda,
-                                                   hipDoubleComplex*   B,
-                                                   int                 ldb,
-                                                   double*             D,
-                                                   hipDoubleComplex*   work,
-                                                   int                 lwork,
-                                                   int*                devInfo)
+hipsolverStatus_t hipsolverZsytrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(work != nullptr)
-    {
-        double* E = (double*)work;
-        work      = (hipDoubleComplex*)(E + n);
-
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-
-        return rocblas2hip_status(rocsolver_zhegvd((rocblas_handle)handle,
-                                                   hip2rocblas_eform(itype),
-                                                   hip2rocblas_evect(jobz),
-                                                   hip2rocblas_fill(uplo),
-                                                   n,
-                                                   (rocblas_double_complex*)A,
-                                                   lda,
-                                                   (rocblas_double_complex*)B,
-                                                   ldb,
-                                                   D,
-                                                   E,
-                                                   devInfo));
-    }
+        CHECK_ROCBLAS_ERROR(hipsolverSetWorkspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverZhegvd_bufferSize(
-            (rocblas_handle)handle, itype, jobz, uplo, n, A, lda, B, ldb, D, &lwork));
-        CHECK_ROCBLAS_ERROR(
-            hipsolverManageWorkspace((rocblas_handle)handle, lwork + sizeof(double) * n));
-
-        rocblas_device_malloc mem((rocblas_handle)handle, sizeof(double) * n);
-        if(!mem)
-            return HIPSOLVER_STATUS_ALLOC_FAILED;
-        double* E = (double*)mem[0];
-
-        return rocblas2hip_status(rocsolver_zhegvd((rocblas_handle)handle,
-                                                   hip2rocblas_eform(itype),
-                                                   hip2rocblas_evect(jobz),
-                                                   hip2rocblas_fill(uplo),
-                                                   n,
-                                                   (rocblas_double_complex*)A,
-                                                   lda,
-                                                   (rocblas_double_complex*)B,
-                                                   ldb,
-                                                   D,
-                                                   E,
-                                                   devInfo));
+        CHECK_HIPSOLVER_ERROR(hipsolverZsytrf_bufferSize(
+            (rocblas_handle)handle, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_zsytrf((rocblas_handle)handle,
+                                         hip2rocblas_fill(uplo),
+                                         n,
+                                         (rocblas_double_complex*)A,
+                                         lda,
+                                         devIpiv,
+                                         devInfo));
+    return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** SYTRD/HETRD ********************/
-hipsolverStatus_t hipsolverSsytrd_bufferSize(hipsolverHandle_t   handle,
+/******************** SYTRS ********************/
+hipsolverStatus_t hipsolverSsytrs_bufferSize(hipsolverHandle_t   handle,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
+                                             int                 nrhs,
                                              float*              A,
                                              int                 lda,
-                                             float*              D,
-                                             float*              E,
-                                             float*              tau,
+                                             int*                devIpiv,
+                                             float*              B,
+                                             int                 ldb,
                                              int*                lwork)
 try
 {
@@ -4544,40 +12298,30 @@ try
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
     *lwork = 0;
-    size_t sz;
-
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_ssytrd((rocblas_handle)handle,
-                                                                   hip2rocblas_fill(uplo),
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    if(n < 0 || nrhs < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
+    size_t sz = hipsolver_sytrs_worksize<float>(n, nrhs);
     if(sz > INT_MAX)
         return HIPSOLVER_STATUS_INTERNAL_ERROR;
 
     *lwork = (int)sz;
-    return status;
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDsytrd_bufferSize(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverDsytrs_bufferSize(hipsolverHandle_t   handle,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
+                                             int                 nrhs,
                                              double*             A,
                                              int                 lda,
-                                             double*             D,
-                                             double*             E,
-                                             double*             tau,
+                                             int*                devIpiv,
+                                             double*             B,
+                                             int                 ldb,
                                              int*                lwork)
 try
 {
@@ -4585,40 +12329,30 @@ try
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
     *lwork = 0;
-    size_t sz;
-
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dsytrd((rocblas_handle)handle,
-                                                                   hip2rocblas_fill(uplo),
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    if(n < 0 || nrhs < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
+    size_t sz = hipsolver_sytrs_worksize<double>(n, nrhs);
     if(sz > INT_MAX)
         return HIPSOLVER_STATUS_INTERNAL_ERROR;
 
     *lwork = (int)sz;
-    return status;
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverChetrd_bufferSize(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverCsytrs_bufferSize(hipsolverHandle_t   handle,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
+                                             int                 nrhs,
                                              hipFloatComplex*    A,
                                              int                 lda,
-                                             float*              D,
-                                             float*              E,
-                                             hipFloatComplex*    tau,
+                                             int*                devIpiv,
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
                                              int*                lwork)
 try
 {
@@ -4626,40 +12360,30 @@ try
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
     *lwork = 0;
-    size_t sz;
-
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_chetrd((rocblas_handle)handle,
-                                                                   hip2rocblas_fill(uplo),
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    if(n < 0 || nrhs < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
+    size_t sz = hipsolver_sytrs_worksize<rocblas_float_complex>(n, nrhs);
     if(sz > INT_MAX)
         return HIPSOLVER_STATUS_INTERNAL_ERROR;
 
     *lwork = (int)sz;
-    return status;
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZhetrd_bufferSize(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverZsytrs_bufferSize(hipsolverHandle_t   handle,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
+                                             int                 nrhs,
                                              hipDoubleComplex*   A,
                                              int                 lda,
-                                             double*             D,
-                                             double*             E,
-                                             hipDoubleComplex*   tau,
+                                             int*                devIpiv,
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
                                              int*                lwork)
 try
 {
@@ -4667,158 +12391,267 @@ try
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
     *lwork = 0;
-    size_t sz;
-
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zhetrd((rocblas_handle)handle,
-                                                                   hip2rocblas_fill(uplo),
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    if(n < 0 || nrhs < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
+    size_t sz = hipsolver_sytrs_worksize<rocblas_double_complex>(n, nrhs);
     if(sz > INT_MAX)
         return HIPSOLVER_STATUS_INTERNAL_ERROR;
 
     *lwork = (int)sz;
-    return status;
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSsytrd(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverSsytrs(hipsolverHandle_t   handle,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
+                                  int                 nrhs,
                                   float*              A,
                                   int                 lda,
-                                  float*              D,
-                                  float*              E,
-                                  float*              tau,
+                                  int*                devIpiv,
+                                  float*              B,
+                                  int                 ldb,
                                   float*              work,
                                   int                 lwork,
                                   int*                devInfo)
 try
 {
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    {
+        if(lwork < 0 || size_t(lwork) < hipsolver_sytrs_worksize<float>(n, nrhs))
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_sytrs_template((rocblas_handle)handle,
+                                                     hip2rocblas_fill(uplo),
+                                                     n,
+                                                     nrhs,
+                                                     A,
+                                                     lda,
+                                                     devIpiv,
+                                                     B,
+                                                     ldb,
+                                                     devInfo,
+                                                     (float*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverSsytrd_bufferSize((rocblas_handle)handle, uplo, n, A, lda, D, E, tau, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverSsytrs_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
 
-    return rocblas2hip_status(
-        rocsolver_ssytrd((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, D, E, tau));
+        rocblas_device_malloc mem((rocblas_handle)handle, lwork);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_sytrs_template((rocblas_handle)handle,
+                                                     hip2rocblas_fill(uplo),
+                                                     n,
+                                                     nrhs,
+                                                     A,
+                                                     lda,
+                                                     devIpiv,
+                                                     B,
+                                                     ldb,
+                                                     devInfo,
+                                                     (float*)mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDsytrd(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverDsytrs(hipsolverHandle_t   handle,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
+                                  int                 nrhs,
                                   double*             A,
                                   int                 lda,
-                                  double*             D,
-                                  double*             E,
-                                  double*             tau,
+                                  int*                devIpiv,
+                                  double*             B,
+                                  int                 ldb,
                                   double*             work,
                                   int                 lwork,
                                   int*                devInfo)
 try
 {
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    {
+        if(lwork < 0 || size_t(lwork) < hipsolver_sytrs_worksize<double>(n, nrhs))
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_sytrs_template((rocblas_handle)handle,
+                                                     hip2rocblas_fill(uplo),
+                                                     n,
+                                                     nrhs,
+                                                     A,
+                                                     lda,
+                                                     devIpiv,
+                                                     B,
+                                                     ldb,
+                                                     devInfo,
+                                                     (double*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverDsytrd_bufferSize((rocblas_handle)handle, uplo, n, A, lda, D, E, tau, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverDsytrs_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
 
-    return rocblas2hip_status(
-        rocsolver_dsytrd((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, D, E, tau));
+        rocblas_device_malloc mem((rocblas_handle)handle, lwork);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_sytrs_template((rocblas_handle)handle,
+                                                     hip2rocblas_fill(uplo),
+                                                     n,
+                                                     nrhs,
+                                                     A,
+                                                     lda,
+                                                     devIpiv,
+                                                     B,
+                                                     ldb,
+                                                     devInfo,
+                                                     (double*)mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverChetrd(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverCsytrs(hipsolverHandle_t   handle,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
+                                  int                 nrhs,
                                   hipFloatComplex*    A,
                                   int                 lda,
-                                  float*              D,
-                                  float*              E,
-                                  hipFloatComplex*    tau,
+                                  int*                devIpiv,
+                                  hipFloatComplex*    B,
+                                  int                 ldb,
                                   hipFloatComplex*    work,
                                   int                 lwork,
                                   int*                devInfo)
 try
 {
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    {
+        if(lwork < 0 || size_t(lwork) < hipsolver_sytrs_worksize<rocblas_float_complex>(n, nrhs))
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_sytrs_template((rocblas_handle)handle,
+                                                     hip2rocblas_fill(uplo),
+                                                     n,
+                                                     nrhs,
+                                                     (rocblas_float_complex*)A,
+                                                     lda,
+                                                     devIpiv,
+                                                     (rocblas_float_complex*)B,
+                                                     ldb,
+                                                     devInfo,
+                                                     (rocblas_float_complex*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverChetrd_bufferSize((rocblas_handle)handle, uplo, n, A, lda, D, E, tau, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverCsytrs_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
 
-    return rocblas2hip_status(rocsolver_chetrd((rocblas_handle)handle,
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               (rocblas_float_complex*)A,
-                                               lda,
-                                               D,
-                                               E,
-                                               (rocblas_float_complex*)tau));
+        rocblas_device_malloc mem((rocblas_handle)handle, lwork);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_sytrs_template((rocblas_handle)handle,
+                                                     hip2rocblas_fill(uplo),
+                                                     n,
+                                                     nrhs,
+                                                     (rocblas_float_complex*)A,
+                                                     lda,
+                                                     devIpiv,
+                                                     (rocblas_float_complex*)B,
+                                                     ldb,
+                                                     devInfo,
+                                                     (rocblas_float_complex*)mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZhetrd(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverZsytrs(hipsolverHandle_t   handle,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
+                                  int                 nrhs,
                                   hipDoubleComplex*   A,
                                   int                 lda,
-                                  double*             D,
-                                  double*             E,
-                                  hipDoubleComplex*   tau,
+                                  int*                devIpiv,
+                                  hipDoubleComplex*   B,
+                                  int                 ldb,
                                   hipDoubleComplex*   work,
                                   int                 lwork,
                                   int*                devInfo)
 try
 {
+    CHECK_ROCBLAS_ERROR(hipsolverCheckHostSync((rocblas_handle)handle));
+
     if(work != nullptr)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    {
+        if(lwork < 0 || size_t(lwork) < hipsolver_sytrs_worksize<rocblas_double_complex>(n, nrhs))
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_sytrs_template((rocblas_handle)handle,
+                                                     hip2rocblas_fill(uplo),
+                                                     n,
+                                                     nrhs,
+                                                     (rocblas_double_complex*)A,
+                                                     lda,
+                                                     devIpiv,
+                                                     (rocblas_double_complex*)B,
+                                                     ldb,
+                                                     devInfo,
+                                                     (rocblas_double_complex*)work));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverZhetrd_bufferSize((rocblas_handle)handle, uplo, n, A, lda, D, E, tau, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverZsytrs_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
 
-    return rocblas2hip_status(rocsolver_zhetrd((rocblas_handle)handle,
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               (rocblas_double_complex*)A,
-                                               lda,
-                                               D,
-                                               E,
-                                               (rocblas_double_complex*)tau));
+        rocblas_device_malloc mem((rocblas_handle)handle, lwork);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        CHECK_ROCBLAS_ERROR(hipsolver_sytrs_template((rocblas_handle)handle,
+                                                     hip2rocblas_fill(uplo),
+                                                     n,
+                                                     nrhs,
+                                                     (rocblas_double_complex*)A,
+                                                     lda,
+                                                     devIpiv,
+                                                     (rocblas_double_complex*)B,
+                                                     ldb,
+                                                     devInfo,
+                                                     (rocblas_double_complex*)mem[0]));
+        return hipsolverDeferInfo((rocblas_handle)handle, devInfo, 1);
+    }
 }
 catch(...)
 {
@@ -0,0 +1,200 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "dispatch.hpp"
+#include "handle.hpp"
+#include "host_kernels.hpp"
+#include "rocblas_templates.hpp"
+#include <algorithm>
+#include <complex>
+#include <functional>
+#include <hip/hip_runtime_api.h>
+#include <initializer_list>
+#include <memory>
+
+/*
+ * ===========================================================================
+ *    Host engine of HIPSOLVER_DISPATCH_MODE_AUTO. For the smallest problems,
+ *    the fixed cost of a rocSOLVER call (its kernel launches and the
+ *    synchronization of the caller on devInfo) is larger than the time of
+ *    the factorization itself. If a call is routed to the host, the native
+ *    host kernels are enqueued on the handle's stream with
+ *    hipStreamAddCallback, so that they run on a host thread of the runtime
+ *    once the work before them is done, and the work enqueued after the call
+ *    waits for them. Nothing is copied: a call is only routed to the host if
+ *    all its arrays are in pinned, registered or managed memory, as reported
+ *    by hipPointerGetAttributes. Host callbacks cannot be captured into a
+ *    graph, so all calls run on the device in HIPSOLVER_CAPTURE_MODE_SAFE
+ *    and during a capture query.
+ * ===========================================================================
+ */
+
+// types of the host kernels
+template <typename T>
+struct hipsolver_host_type
+{
+    using type = T;
+};
+template <>
+struct hipsolver_host_type<rocblas_float_complex>
+{
+    using type = std::complex<float>;
+};
+template <>
+struct hipsolver_host_type<rocblas_double_complex>
+{
+    using type = std::complex<double>;
+};
+
+template <typename T>
+constexpr hipsolverPrecision_t hipsolver_precision();
+template <>
+constexpr hipsolverPrecision_t hipsolver_precision<float>()
+{
+    return HIPSOLVER_PRECISION_SINGLE;
+}
+template <>
+constexpr hipsolverPrecision_t hipsolver_precision<double>()
+{
+    return HIPSOLVER_PRECISION_DOUBLE;
+}
+template <>
+constexpr hipsolverPrecision_t hipsolver_precision<rocblas_float_complex>()
+{
+    return HIPSOLVER_PRECISION_SINGLE_COMPLEX;
+}
+template <>
+constexpr hipsolverPrecision_t hipsolver_precision<rocblas_double_complex>()
+{
+    return HIPSOLVER_PRECISION_DOUBLE_COMPLEX;
+}
+
+/* Returns whether the host can access ptr directly. Memory unknown to HIP,
+   such as pageable host memory, is left to the device, which reports it as
+   for any other call. */
+inline bool hipsolver_host_accessible(const void* ptr)
+{
+    if(!ptr)
+        return false;
+
+    hipPointerAttribute_t attr;
+    if(hipPointerGetAttributes(&attr, ptr) != hipSuccess)
+    {
+        // clear the error of the query
+        (void)hipGetLastError();
+        return false;
+    }
+    return attr.memoryType == hipMemoryTypeHost || attr.isManaged;
+}
+
+// whether a problem of size n of routine, on the arrays in ptrs, runs on the host
+template <typename T>
+bool hipsolver_dispatch_host(rocblas_handle                     handle,
+                             hipsolverDispatchRoutine_t         routine,
+                             int                                n,
+                             std::initializer_list<const void*> ptrs)
+{
+    bool host = hipsolver_read_settings(handle, [=](const hipsolver_handle_settings& settings) {
+        return settings.dispatch_mode == HIPSOLVER_DISPATCH_MODE_AUTO
+               && settings.capture_mode != HIPSOLVER_CAPTURE_MODE_SAFE && !settings.capture_query
+               && n <= settings.dispatch.at(routine, hipsolver_precision<T>());
+    });
+    if(!host)
+        return false;
+
+    for(const void* ptr : ptrs)
+        if(!hipsolver_host_accessible(ptr))
+            return false;
+    return true;
+}
+
+inline void hipsolver_host_engine_run(hipStream_t stream, hipError_t status, void* data)
+{
+    std::unique_ptr<std::function<void()>> task((std::function<void()>*)data);
+
+    // the arrays may not hold the inputs if the work before failed
+    if(status == hipSuccess)
+        (*task)();
+}
+
+// enqueues task on the stream of handle
+inline rocblas_status hipsolver_host_engine_enqueue(rocblas_handle        handle,
+                                                    std::function<void()> task)
+{
+    hipStream_t stream;
+    ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle, &stream));
+
+    std::unique_ptr<std::function<void()>> data(new std::function<void()>(std::move(task)));
+    HIP_RETURN_IF_ERROR(hipStreamAddCallback(stream, hipsolver_host_engine_run, data.get(), 0));
+    data.release();
+    return rocblas_status_success;
+}
+
+/******************** POTRF ********************/
+/* Enqueues potrf on the host and sets *host to true if the dispatch policy
+   of handle routes the call there; otherwise the call is left to rocSOLVER,
+   which also reports the invalid arguments. */
+template <typename T>
+rocblas_status hipsolver_potrf_dispatch(
+    rocblas_handle handle, rocblas_fill uplo, int n, T* A, int lda, int* info, bool* host)
+{
+    using H = typename hipsolver_host_type<T>::type;
+
+    *host = n > 0 && lda >= n
+            && hipsolver_dispatch_host<T>(handle, HIPSOLVER_DISPATCH_POTRF, n, {A, info});
+    if(!*host)
+        return rocblas_status_success;
+
+    char u = uplo == rocblas_fill_upper ? 'U' : 'L';
+    return hipsolver_host_engine_enqueue(
+        handle, [=] { hipsolver_kernel_potrf(u, n, (H*)A, lda, info); });
+}
+
+/******************** GETRF ********************/
+// as hipsolver_potrf_dispatch; unpivoted factorizations stay on the device
+template <typename T>
+rocblas_status hipsolver_getrf_dispatch(
+    rocblas_handle handle, int m, int n, T* A, int lda, int* ipiv, int* info, bool* host)
+{
+    using H = typename hipsolver_host_type<T>::type;
+
+    *host = m > 0 && n > 0 && lda >= m
+            && hipsolver_dispatch_host<T>(
+                handle, HIPSOLVER_DISPATCH_GETRF, std::max(m, n), {A, ipiv, info});
+    if(!*host)
+        return rocblas_status_success;
+
+    return hipsolver_host_engine_enqueue(
+        handle, [=] { hipsolver_kernel_getrf(m, n, (H*)A, lda, ipiv, info); });
+}
+
+/******************** GETRS ********************/
+// as hipsolver_potrf_dispatch; getrs does not write devInfo on either engine
+template <typename T>
+rocblas_status hipsolver_getrs_dispatch(rocblas_handle    handle,
+                                        rocblas_operation trans,
+                                        int               n,
+                                        int               nrhs,
+                                        T*                A,
+                                        int               lda,
+                                        int*              ipiv,
+                                        T*                B,
+                                        int               ldb,
+                                        bool*             host)
+{
+    using H = typename hipsolver_host_type<T>::type;
+
+    *host = n > 0 && nrhs > 0 && lda >= n && ldb >= n
+            && hipsolver_dispatch_host<T>(
+                handle, HIPSOLVER_DISPATCH_GETRS, std::max(n, nrhs), {A, ipiv, B});
+    if(!*host)
+        return rocblas_status_success;
+
+    char t = trans == rocblas_operation_none ? 'N'
+                                            : (trans == rocblas_operation_transpose ? 'T' : 'C');
+    return hipsolver_host_engine_enqueue(
+        handle, [=] { hipsolver_kernel_getrs(t, n, nrhs, (const H*)A, lda, ipiv, (H*)B, ldb); });
+}
@@ -0,0 +1,288 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas_templates.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <memory>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    The host-pointer functions (getrfHost, getrsHost and their batched
+ *    versions) move data between pageable host memory and the device through
+ *    pinned buffers owned by the handle. Copies between the user's memory and
+ *    one buffer run on the host while the other buffers are transferred, on
+ *    two streams of their own that also overlap with the computations on the
+ *    handle's stream. The buffers are allocated by the first host-pointer call
+ *    and released by hipsolverDestroy.
+ * ===========================================================================
+ */
+
+// number of pinned buffers for each direction and their minimum size in bytes
+#define HIPSOLVER_STAGING_BUFFERS 2
+#define HIPSOLVER_STAGING_BUFFER_SIZE (size_t(4) << 20)
+
+class hipsolver_staging
+{
+public:
+    // streams of the transfers to and from the device
+    hipStream_t h2d = nullptr;
+    hipStream_t d2h = nullptr;
+
+    hipsolver_staging()                         = default;
+    hipsolver_staging(const hipsolver_staging&) = delete;
+    hipsolver_staging& operator=(const hipsolver_staging&) = delete;
+
+    ~hipsolver_staging()
+    {
+        abandon();
+        release_buffers();
+        for(hipStream_t stream : {h2d, d2h})
+            if(stream)
+                hipStreamDestroy(stream);
+        for(hipEvent_t event : events_)
+            hipEventDestroy(event);
+        if(entry_)
+            hipEventDestroy(entry_);
+    }
+
+    /* Prepares a call that uses up to nevents events and transfers columns of
+       at most column_size bytes. The transfers are ordered after the work
+       already enqueued on stream, which may still use the same device memory. */
+    rocblas_status init(hipStream_t stream, size_t column_size, int nevents)
+    {
+        abandon();
+
+        if(!h2d)
+        {
+            HIP_RETURN_IF_ERROR(hipStreamCreateWithFlags(&h2d, hipStreamNonBlocking));
+            HIP_RETURN_IF_ERROR(hipStreamCreateWithFlags(&d2h, hipStreamNonBlocking));
+            HIP_RETURN_IF_ERROR(hipEventCreateWithFlags(&entry_, hipEventDisableTiming));
+        }
+        while(events_.size() < size_t(nevents))
+        {
+            hipEvent_t event;
+            HIP_RETURN_IF_ERROR(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+            events_.push_back(event);
+        }
+
+        size_t size = std::max<size_t>(HIPSOLVER_STAGING_BUFFER_SIZE, column_size);
+        if(size_ < size)
+        {
+            release_buffers();
+            for(buffer* b : all_buffers())
+            {
+                HIP_RETURN_IF_ERROR(hipHostMalloc((void**)&b->ptr, size, hipHostMallocDefault));
+                HIP_RETURN_IF_ERROR(hipEventCreateWithFlags(&b->done, hipEventDisableTiming));
+            }
+            size_ = size;
+        }
+
+        HIP_RETURN_IF_ERROR(hipEventRecord(entry_, stream));
+        HIP_RETURN_IF_ERROR(hipStreamWaitEvent(h2d, entry_, 0));
+        HIP_RETURN_IF_ERROR(hipStreamWaitEvent(d2h, entry_, 0));
+        return rocblas_status_success;
+    }
+
+    // events 0 to nevents - 1 order the streams of a call
+    rocblas_status record(hipStream_t from, int e)
+    {
+        HIP_RETURN_IF_ERROR(hipEventRecord(events_[e], from));
+        return rocblas_status_success;
+    }
+
+    rocblas_status wait(hipStream_t to, int e)
+    {
+        HIP_RETURN_IF_ERROR(hipStreamWaitEvent(to, events_[e], 0));
+        return rocblas_status_success;
+    }
+
+    /* Copies the rows-by-cols host matrix src to the device matrix dst on stream
+       h2d. src can be reused on return. Columns must fit in the buffers, as
+       requested by init. */
+    template <typename T>
+    rocblas_status upload(T* dst, int ldd, const T* src, int lds, int rows, int cols)
+    {
+        size_t width = sizeof(T) * rows;
+        int    chunk = width ? int(std::min<size_t>(size_ / width, cols)) : cols;
+
+        for(int c = 0; c < cols && rows > 0; c += chunk)
+        {
+            int     w = std::min(chunk, cols - c);
+            buffer& b = up_[next_up_];
+            next_up_  = (next_up_ + 1) % HIPSOLVER_STAGING_BUFFERS;
+            ROCBLAS_RETURN_IF_ERROR(acquire(b));
+
+            for(int j = 0; j < w; j++)
+                std::memcpy(b.ptr + width * j, src + size_t(lds) * (c + j), width);
+            HIP_RETURN_IF_ERROR(hipMemcpy2DAsync(dst + size_t(ldd) * c,
+                                                 sizeof(T) * ldd,
+                                                 b.ptr,
+                                                 width,
+                                                 width,
+                                                 w,
+                                                 hipMemcpyHostToDevice,
+                                                 h2d));
+            HIP_RETURN_IF_ERROR(hipEventRecord(b.done, h2d));
+            b.busy = true;
+        }
+        return rocblas_status_success;
+    }
+
+    /* Copies the rows-by-cols device matrix src to the host matrix dst on stream
+       d2h. dst is written when its buffer is reused or by finish. */
+    template <typename T>
+    rocblas_status download(T* dst, int ldd, const T* src, int lds, int rows, int cols)
+    {
+        size_t width = sizeof(T) * rows;
+        int    chunk = width ? int(std::min<size_t>(size_ / width, cols)) : cols;
+
+        for(int c = 0; c < cols && rows > 0; c += chunk)
+        {
+            int     w  = std::min(chunk, cols - c);
+            buffer& b  = down_[next_down_];
+            next_down_ = (next_down_ + 1) % HIPSOLVER_STAGING_BUFFERS;
+            ROCBLAS_RETURN_IF_ERROR(acquire(b));
+
+            HIP_RETURN_IF_ERROR(hipMemcpy2DAsync(b.ptr,
+                                                 width,
+                                                 src + size_t(lds) * c,
+                                                 sizeof(T) * lds,
+                                                 width,
+                                                 w,
+                                                 hipMemcpyDeviceToHost,
+                                                 d2h));
+            HIP_RETURN_IF_ERROR(hipEventRecord(b.done, d2h));
+            b.busy  = true;
+            b.dst   = (char*)(dst + size_t(ldd) * c);
+            b.ldd   = sizeof(T) * ldd;
+            b.width = width;
+            b.cols  = w;
+        }
+        return rocblas_status_success;
+    }
+
+    // waits for all the transfers and writes the downloaded data to its destination
+    rocblas_status finish()
+    {
+        for(buffer* b : all_buffers())
+            ROCBLAS_RETURN_IF_ERROR(acquire(*b));
+        HIP_RETURN_IF_ERROR(hipStreamSynchronize(h2d));
+        HIP_RETURN_IF_ERROR(hipStreamSynchronize(d2h));
+        return rocblas_status_success;
+    }
+
+    // waits for the transfers of a call that stopped on an error, dropping its downloads
+    void abandon()
+    {
+        for(hipStream_t stream : {h2d, d2h})
+            if(stream)
+                hipStreamSynchronize(stream);
+        for(buffer* b : all_buffers())
+        {
+            b->busy = false;
+            b->dst  = nullptr;
+        }
+    }
+
+private:
+    struct buffer
+    {
+        char*      ptr  = nullptr;
+        hipEvent_t done = nullptr;
+        bool       busy = false;
+
+        // destination of a pending download
+        char*  dst   = nullptr;
+        size_t ldd   = 0;
+        size_t width = 0;
+        int    cols  = 0;
+    };
+
+    buffer     up_[HIPSOLVER_STAGING_BUFFERS];
+    buffer     down_[HIPSOLVER_STAGING_BUFFERS];
+    int        next_up_   = 0;
+    int        next_down_ = 0;
+    size_t     size_      = 0;
+    hipEvent_t entry_     = nullptr;
+
+    std::vector<hipEvent_t> events_;
+
+    std::vector<buffer*> all_buffers()
+    {
+        std::vector<buffer*> all;
+        for(int i = 0; i < HIPSOLVER_STAGING_BUFFERS; i++)
+        {
+            all.push_back(&up_[i]);
+            all.push_back(&down_[i]);
+        }
+        return all;
+    }
+
+    // waits until b can be reused, completing its pending download
+    rocblas_status acquire(buffer& b)
+    {
+        if(!b.busy)
+            return rocblas_status_success;
+
+        HIP_RETURN_IF_ERROR(hipEventSynchronize(b.done));
+        b.busy = false;
+        if(b.dst)
+        {
+            for(int j = 0; j < b.cols; j++)
+                std::memcpy(b.dst + b.ldd * j, b.ptr + b.width * j, b.width);
+            b.dst = nullptr;
+        }
+        return rocblas_status_success;
+    }
+
+    void release_buffers()
+    {
+        for(buffer* b : all_buffers())
+        {
+            if(b->ptr)
+                hipHostFree(b->ptr);
+            if(b->done)
+                hipEventDestroy(b->done);
+            b->ptr  = nullptr;
+            b->done = nullptr;
+        }
+        size_ = 0;
+    }
+};
+
+// synchronizes the transfers of a call on every path out of it
+class hipsolver_staging_guard
+{
+public:
+    explicit hipsolver_staging_guard(hipsolver_staging& staging)
+        : staging_(staging)
+    {
+    }
+
+    ~hipsolver_staging_guard()
+    {
+        staging_.abandon();
+    }
+
+private:
+    hipsolver_staging& staging_;
+};
+
+// returns the staging of handle, creating it on first use
+inline std::shared_ptr<hipsolver_staging> hipsolver_get_staging(rocblas_handle handle)
+{
+    std::shared_ptr<hipsolver_staging> staging;
+    hipsolver_update_settings(handle, [&](hipsolver_handle_settings& settings) {
+        if(!settings.staging)
+            settings.staging = std::make_shared<hipsolver_staging>();
+        staging = settings.staging;
+    });
+    return staging;
+}
@@ -0,0 +1,847 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "mg_scheduler.hpp"
+#include "rocblas_templates.hpp"
+#include "rocsolver_templates.hpp"
+#include <algorithm>
+#include <cmath>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    Multi-device functions of hipsolverMg. A hipsolverMgHandle_t owns a
+ *    stream, a rocBLAS handle and an event on each of the devices selected
+ *    by hipsolverMgDeviceSelect, which also enables peer access between
+ *    them. The schedules of mg_scheduler.hpp are computed with rocBLAS and
+ *    rocSOLVER on those handles, and the panels are copied between devices
+ *    with peer copies issued on the stream of the receiving device. As with
+ *    cusolverMg, the functions are blocking: they wait for the work already
+ *    enqueued on the devices of the grid, and return once the result, and
+ *    the info on the host, are complete. The workspace of every device holds
+ *    its panel buffer, pivots and info followed by the device memory of
+ *    rocSOLVER; it is allocated by the function if the user provides none.
+ * ===========================================================================
+ */
+
+class hipsolver_mg_handle
+{
+public:
+    hipsolver_mg_handle()                           = default;
+    hipsolver_mg_handle(const hipsolver_mg_handle&) = delete;
+    hipsolver_mg_handle& operator=(const hipsolver_mg_handle&) = delete;
+
+    ~hipsolver_mg_handle()
+    {
+        int current;
+        bool restore = hipGetDevice(&current) == hipSuccess;
+        for(size_t d = 0; d < devices.size(); d++)
+        {
+            hipSetDevice(devices[d]);
+            if(d < handles.size())
+                rocblas_destroy_handle(handles[d]);
+            if(d < streams.size())
+            {
+                hipStreamSynchronize(streams[d]);
+                hipStreamDestroy(streams[d]);
+            }
+            if(d < events.size())
+                hipEventDestroy(events[d]);
+        }
+        if(restore)
+            hipSetDevice(current);
+    }
+
+    // device d of the handle, with its stream, rocBLAS handle and event
+    std::vector<int>            devices;
+    std::vector<hipStream_t>    streams;
+    std::vector<rocblas_handle> handles;
+    std::vector<hipEvent_t>     events;
+
+    // creates the resources of the ndev devices of ids; devices are selected only once
+    rocblas_status select(int ndev, const int* ids)
+    {
+        if(!devices.empty())
+            return rocblas_status_invalid_value;
+        if(ndev < 1)
+            return rocblas_status_invalid_size;
+        if(!ids)
+            return rocblas_status_invalid_pointer;
+
+        int count;
+        HIP_RETURN_IF_ERROR(hipGetDeviceCount(&count));
+        for(int d = 0; d < ndev; d++)
+        {
+            if(ids[d] < 0 || ids[d] >= count || std::count(ids, ids + d, ids[d]))
+                return rocblas_status_invalid_value;
+        }
+
+        int current;
+        HIP_RETURN_IF_ERROR(hipGetDevice(&current));
+        rocblas_status status = rocblas_status_success;
+        for(int d = 0; d < ndev && status == rocblas_status_success; d++)
+            status = create(ids[d], ids, ndev);
+        HIP_RETURN_IF_ERROR(hipSetDevice(current));
+        return status;
+    }
+
+    // the position of device among the selected devices, or -1
+    int find(int device) const
+    {
+        auto it = std::find(devices.begin(), devices.end(), device);
+        return it != devices.end() ? int(it - devices.begin()) : -1;
+    }
+
+private:
+    rocblas_status create(int device, const int* ids, int ndev)
+    {
+        hipStream_t    stream;
+        rocblas_handle handle;
+        hipEvent_t     event;
+
+        devices.push_back(device);
+        HIP_RETURN_IF_ERROR(hipSetDevice(device));
+        HIP_RETURN_IF_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+        streams.push_back(stream);
+        ROCBLAS_RETURN_IF_ERROR(rocblas_create_handle(&handle));
+        handles.push_back(handle);
+        ROCBLAS_RETURN_IF_ERROR(rocblas_set_stream(handle, stream));
+        HIP_RETURN_IF_ERROR(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+        events.push_back(event);
+
+        // without peer access, the copies between devices are staged by the runtime
+        for(int p = 0; p < ndev; p++)
+        {
+            int can = 0;
+            if(ids[p] == device || hipDeviceCanAccessPeer(&can, device, ids[p]) != hipSuccess
+               || !can)
+                continue;
+            hipError_t status = hipDeviceEnablePeerAccess(ids[p], 0);
+            if(status != hipSuccess && status != hipErrorPeerAccessAlreadyEnabled)
+                HIP_RETURN_IF_ERROR(status);
+        }
+        return rocblas_status_success;
+    }
+};
+
+// the object behind a hipsolverMgGrid_t; only grids of one row of devices are supported
+struct hipsolver_mg_grid
+{
+    std::vector<int> devices;
+};
+
+// the object behind a hipsolverMgMatrixDesc_t
+struct hipsolver_mg_desc
+{
+    int              rows      = 0; // also the leading dimension of the local matrices
+    int              cols      = 0;
+    int              col_block = 1;
+    std::vector<int> devices; // the devices of the grid
+};
+
+// restores the current device when it goes out of scope
+class hipsolver_mg_device_guard
+{
+public:
+    hipsolver_mg_device_guard()
+    {
+        if(hipGetDevice(&device_) != hipSuccess)
+            device_ = -1;
+    }
+    hipsolver_mg_device_guard(const hipsolver_mg_device_guard&) = delete;
+    hipsolver_mg_device_guard& operator=(const hipsolver_mg_device_guard&) = delete;
+
+    ~hipsolver_mg_device_guard()
+    {
+        if(device_ >= 0)
+            hipSetDevice(device_);
+    }
+
+private:
+    int device_;
+};
+
+// the parts of the workspace of a device are aligned to 256 bytes
+inline size_t hipsolver_mg_align(size_t size)
+{
+    return (size + 255) / 256 * 256;
+}
+
+// offsets in bytes of the parts of the workspace of device dev
+struct hipsolver_mg_workspace
+{
+    size_t panel  = 0;
+    size_t pivots = 0;
+    size_t info   = 0;
+    size_t E      = 0; // the eigensolver on device 0 only
+    size_t W      = 0;
+    size_t end    = 0; // followed by the device memory of rocSOLVER
+
+    template <typename T>
+    static hipsolver_mg_workspace make(hipsolver_mg_factorization fact,
+                                       bool                       upper,
+                                       const hipsolver_mg_layout& layout,
+                                       int                        dev)
+    {
+        using S = decltype(std::abs(T(0)));
+
+        int ld, cols;
+        hipsolver_mg_panel_shape(fact, upper, layout, dev, &ld, &cols);
+        bool eigen = fact == hipsolver_mg_eigen && dev == 0;
+        int  npiv  = fact == hipsolver_mg_lu ? std::min(layout.m, layout.n) : 0;
+
+        hipsolver_mg_workspace w;
+        w.pivots = w.panel + hipsolver_mg_align(sizeof(T) * ld * cols);
+        w.info   = w.pivots + hipsolver_mg_align(sizeof(int) * npiv);
+        w.E      = w.info + hipsolver_mg_align(sizeof(int) * hipsolver_mg_slots(fact, layout));
+        w.W      = w.E + (eigen ? hipsolver_mg_align(sizeof(S) * layout.n) : 0);
+        w.end    = w.W + (eigen ? hipsolver_mg_align(sizeof(S) * layout.n) : 0);
+        return w;
+    }
+};
+
+/* Device memory required by rocSOLVER on device dev (the current device) of a
+   multi-device function, for the largest operations of its schedule. */
+template <typename T>
+rocblas_status hipsolver_mg_query(rocblas_handle             handle,
+                                  hipsolver_mg_factorization fact,
+                                  bool                       upper,
+                                  bool                       evect,
+                                  const hipsolver_mg_layout& layout,
+                                  int                        dev,
+                                  int                        lda,
+                                  size_t*                    size)
+{
+    using S = decltype(std::abs(T(0)));
+
+    int m  = layout.m;
+    int n  = layout.n;
+    int nb = std::min(layout.nb, n);
+    int nc = layout.local_cols(dev);
+    T   one  = 1;
+    S   rone = 1;
+    int ld, cols;
+    hipsolver_mg_panel_shape(fact, upper, layout, dev, &ld, &cols);
+
+    auto ok = [](rocblas_status status) {
+        return status == rocblas_status_success || status == rocblas_status_size_unchanged
+               || status == rocblas_status_size_increased;
+    };
+
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_status status = rocblas_status_success;
+    if(fact == hipsolver_mg_eigen)
+    {
+        if(dev == 0)
+            status = rocsolverCall_syevd(handle,
+                                         evect ? rocblas_evect_original : rocblas_evect_none,
+                                         upper ? rocblas_fill_upper : rocblas_fill_lower,
+                                         n,
+                                         (T*)nullptr,
+                                         ld,
+                                         (S*)nullptr,
+                                         (S*)nullptr,
+                                         (int*)nullptr);
+    }
+    else
+    {
+        status = rocblasCall_gemm(handle,
+                                  rocblas_operation_none,
+                                  rocblas_operation_none,
+                                  m,
+                                  std::max(nb, nc),
+                                  nb,
+                                  &one,
+                                  (T*)nullptr,
+                                  lda,
+                                  (T*)nullptr,
+                                  lda,
+                                  &one,
+                                  (T*)nullptr,
+                                  lda);
+        if(ok(status))
+            status = rocblasCall_herk(handle,
+                                      upper ? rocblas_fill_upper : rocblas_fill_lower,
+                                      rocblas_operation_none,
+                                      nb,
+                                      nb,
+                                      &rone,
+                                      (T*)nullptr,
+                                      lda,
+                                      &rone,
+                                      (T*)nullptr,
+                                      lda);
+        if(ok(status))
+            status = rocblasCall_trsm(handle,
+                                      rocblas_side_left,
+                                      rocblas_fill_lower,
+                                      rocblas_operation_none,
+                                      rocblas_diagonal_unit,
+                                      nb,
+                                      std::max(nb, nc),
+                                      &one,
+                                      (T*)nullptr,
+                                      lda,
+                                      (T*)nullptr,
+                                      lda);
+        if(ok(status))
+            status = rocblasCall_trsm(handle,
+                                      rocblas_side_right,
+                                      rocblas_fill_lower,
+                                      rocblas_operation_conjugate_transpose,
+                                      rocblas_diagonal_non_unit,
+                                      m,
+                                      nb,
+                                      &one,
+                                      (T*)nullptr,
+                                      lda,
+                                      (T*)nullptr,
+                                      lda);
+        if(ok(status) && fact == hipsolver_mg_cholesky)
+            status = rocsolverCall_potrf(handle,
+                                         upper ? rocblas_fill_upper : rocblas_fill_lower,
+                                         nb,
+                                         (T*)nullptr,
+                                         lda,
+                                         (int*)nullptr);
+        if(ok(status) && fact == hipsolver_mg_lu)
+            status = rocsolverCall_getrf(
+                handle, m, nb, (T*)nullptr, lda, (int*)nullptr, (int*)nullptr);
+        if(ok(status) && fact == hipsolver_mg_lu)
+            status = rocsolverCall_laswp(
+                handle, std::max(1, nc), (T*)nullptr, lda, 1, nb, (int*)nullptr, 1);
+    }
+    rocblas_stop_device_memory_size_query(handle, size);
+
+    return ok(status) ? rocblas_status_success : status;
+}
+
+/* Backend of the multi-device schedules computing on the local matrices A of
+   the devices of the grid, which are the devices slots of the handle. work
+   holds the workspace of every device, laid out by hipsolver_mg_workspace.
+   The eigenvalues are copied to the host array W. */
+template <typename T>
+class hipsolver_mg_device
+{
+public:
+    using S = decltype(std::abs(T(0)));
+
+    hipsolver_mg_device(hipsolver_mg_handle&       handle,
+                        const std::vector<int>&    slots,
+                        hipsolver_mg_factorization fact,
+                        bool                       upper,
+                        const hipsolver_mg_layout& layout,
+                        T**                        A,
+                        int                        lda,
+                        void**                     work,
+                        size_t                     size_work,
+                        S*                         W)
+        : handle_(handle)
+        , slots_(slots)
+        , layout_(layout)
+        , A_(A)
+        , lda_(lda)
+        , work_(work)
+        , size_work_(size_work)
+        , W_(W)
+    {
+        for(int d = 0; d < layout.ndev; d++)
+        {
+            int ld, cols;
+            hipsolver_mg_panel_shape(fact, upper, layout, d, &ld, &cols);
+            ld_.push_back(ld);
+            parts_.push_back(hipsolver_mg_workspace::make<T>(fact, upper, layout, d));
+        }
+    }
+
+    ~hipsolver_mg_device()
+    {
+        // operations may still be in flight if the execution stopped on an error
+        for(int d = 0; d < layout_.ndev; d++)
+        {
+            hipSetDevice(handle_.devices[slots_[d]]);
+            hipStreamSynchronize(stream(d));
+            rocblas_set_workspace(handle(d), nullptr, 0);
+        }
+    }
+
+    rocblas_status init()
+    {
+        for(int d = 0; d < layout_.ndev; d++)
+        {
+            const hipsolver_mg_workspace& w = parts_[d];
+            ROCBLAS_RETURN_IF_ERROR(select(d));
+            ROCBLAS_RETURN_IF_ERROR(
+                rocblas_set_workspace(handle(d), part<char>(d, w.end), size_work_ - w.end));
+            HIP_RETURN_IF_ERROR(
+                hipMemsetAsync(part<int>(d, w.info), 0, w.E - w.info, stream(d)));
+        }
+        return rocblas_status_success;
+    }
+
+    rocblas_status record(int dev)
+    {
+        ROCBLAS_RETURN_IF_ERROR(select(dev));
+        HIP_RETURN_IF_ERROR(hipEventRecord(event(dev), stream(dev)));
+        return rocblas_status_success;
+    }
+
+    rocblas_status wait(int dev, int src)
+    {
+        ROCBLAS_RETURN_IF_ERROR(select(dev));
+        HIP_RETURN_IF_ERROR(hipStreamWaitEvent(stream(dev), event(src), 0));
+        return rocblas_status_success;
+    }
+
+    rocblas_status copy(hipsolver_mg_ref dst, hipsolver_mg_ref src, int rows, int cols)
+    {
+        if(rows == 0 || cols == 0)
+            return rocblas_status_success;
+
+        ROCBLAS_RETURN_IF_ERROR(select(dst.dev));
+        HIP_RETURN_IF_ERROR(hipMemcpy2DAsync(ptr(dst),
+                                             sizeof(T) * ld(dst),
+                                             ptr(src),
+                                             sizeof(T) * ld(src),
+                                             sizeof(T) * rows,
+                                             cols,
+                                             hipMemcpyDefault,
+                                             stream(dst.dev)));
+        return rocblas_status_success;
+    }
+
+    rocblas_status copy_pivots(int dst, int src, int offset, int count)
+    {
+        ROCBLAS_RETURN_IF_ERROR(select(dst));
+        HIP_RETURN_IF_ERROR(hipMemcpyAsync(pivots(dst) + offset,
+                                           pivots(src) + offset,
+                                           sizeof(int) * count,
+                                           hipMemcpyDefault,
+                                           stream(dst)));
+        return rocblas_status_success;
+    }
+
+    rocblas_status potrf(int dev, bool upper, hipsolver_mg_ref a, int n, int slot)
+    {
+        ROCBLAS_RETURN_IF_ERROR(select(dev));
+        return rocsolverCall_potrf(handle(dev), fill(upper), n, ptr(a), ld(a), info(dev) + slot);
+    }
+
+    rocblas_status getrf(int dev, hipsolver_mg_ref a, int m, int n, int slot, int offset)
+    {
+        ROCBLAS_RETURN_IF_ERROR(select(dev));
+        return rocsolverCall_getrf(
+            handle(dev), m, n, ptr(a), ld(a), pivots(dev) + offset, info(dev) + slot);
+    }
+
+    rocblas_status laswp(int dev, hipsolver_mg_ref a, int cols, int offset, int count)
+    {
+        if(cols == 0 || count == 0)
+            return rocblas_status_success;
+
+        ROCBLAS_RETURN_IF_ERROR(select(dev));
+        return rocsolverCall_laswp(
+            handle(dev), cols, ptr(a), ld(a), 1, count, pivots(dev) + offset, 1);
+    }
+
+    rocblas_status trsm(int              dev,
+                        bool             left,
+                        bool             upper,
+                        bool             conj,
+                        bool             unit,
+                        hipsolver_mg_ref a,
+                        hipsolver_mg_ref b,
+                        int              m,
+                        int              n)
+    {
+        if(m == 0 || n == 0)
+            return rocblas_status_success;
+
+        T one = 1;
+        ROCBLAS_RETURN_IF_ERROR(select(dev));
+        return rocblasCall_trsm(handle(dev),
+                                left ? rocblas_side_left : rocblas_side_right,
+                                fill(upper),
+                                op(conj),
+                                unit ? rocblas_diagonal_unit : rocblas_diagonal_non_unit,
+                                m,
+                                n,
+                                &one,
+                                ptr(a),
+                                ld(a),
+                                ptr(b),
+                                ld(b));
+    }
+
+    rocblas_status
+        herk(int dev, bool upper, bool conj, hipsolver_mg_ref c, hipsolver_mg_ref a, int n, int k)
+    {
+        S rone = 1, rminone = -1;
+        ROCBLAS_RETURN_IF_ERROR(select(dev));
+        return rocblasCall_herk(handle(dev),
+                                fill(upper),
+                                op(conj),
+                                n,
+                                k,
+                                &rminone,
+                                ptr(a),
+                                ld(a),
+                                &rone,
+                                ptr(c),
+                                ld(c));
+    }
+
+    rocblas_status gemm(int              dev,
+                        bool             conjA,
+                        bool             conjB,
+                        hipsolver_mg_ref c,
+                        hipsolver_mg_ref a,
+                        hipsolver_mg_ref b,
+                        int              m,
+                        int              n,
+                        int              k)
+    {
+        if(m == 0 || n == 0)
+            return rocblas_status_success;
+
+        T one = 1, minone = -1;
+        ROCBLAS_RETURN_IF_ERROR(select(dev));
+        return rocblasCall_gemm(handle(dev),
+                                op(conjA),
+                                op(conjB),
+                                m,
+                                n,
+                                k,
+                                &minone,
+                                ptr(a),
+                                ld(a),
+                                ptr(b),
+                                ld(b),
+                                &one,
+                                ptr(c),
+                                ld(c));
+    }
+
+    rocblas_status syevd(int dev, bool evect, bool upper, hipsolver_mg_ref a, int n, int slot)
+    {
+        const hipsolver_mg_workspace& w = parts_[dev];
+        ROCBLAS_RETURN_IF_ERROR(select(dev));
+        ROCBLAS_RETURN_IF_ERROR(
+            rocsolverCall_syevd(handle(dev),
+                                evect ? rocblas_evect_original : rocblas_evect_none,
+                                fill(upper),
+                                n,
+                                ptr(a),
+                                ld(a),
+                                part<S>(dev, w.W),
+                                part<S>(dev, w.E),
+                                info(dev) + slot));
+        HIP_RETURN_IF_ERROR(hipMemcpyAsync(
+            W_, part<S>(dev, w.W), sizeof(S) * n, hipMemcpyDeviceToHost, stream(dev)));
+        return rocblas_status_success;
+    }
+
+    rocblas_status finish(int nslots, int* tile_info, int npivots, int* ipiv)
+    {
+        std::vector<int> slot_info(size_t(nslots) * layout_.ndev);
+        for(int d = 0; d < layout_.ndev; d++)
+        {
+            ROCBLAS_RETURN_IF_ERROR(select(d));
+            if(nslots > 0)
+                HIP_RETURN_IF_ERROR(hipMemcpyAsync(slot_info.data() + size_t(d) * nslots,
+                                                   info(d),
+                                                   sizeof(int) * nslots,
+                                                   hipMemcpyDeviceToHost,
+                                                   stream(d)));
+            if(d == 0 && npivots > 0)
+                HIP_RETURN_IF_ERROR(hipMemcpyAsync(
+                    ipiv, pivots(0), sizeof(int) * npivots, hipMemcpyDeviceToHost, stream(0)));
+        }
+        for(int d = 0; d < layout_.ndev; d++)
+        {
+            ROCBLAS_RETURN_IF_ERROR(select(d));
+            HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream(d)));
+        }
+
+        // the slots not written by a device are zero
+        for(int k = 0; k < nslots; k++)
+        {
+            tile_info[k] = 0;
+            for(int d = 0; d < layout_.ndev; d++)
+                if(slot_info[k + size_t(d) * nslots] != 0)
+                    tile_info[k] = slot_info[k + size_t(d) * nslots];
+        }
+        return rocblas_status_success;
+    }
+
+private:
+    hipsolver_mg_handle&                handle_;
+    std::vector<int>                    slots_;
+    hipsolver_mg_layout                 layout_;
+    T**                                 A_;
+    int                                 lda_;
+    void**                              work_;
+    size_t                              size_work_;
+    S*                                  W_;
+    std::vector<int>                    ld_;
+    std::vector<hipsolver_mg_workspace> parts_;
+
+    rocblas_status select(int dev)
+    {
+        HIP_RETURN_IF_ERROR(hipSetDevice(handle_.devices[slots_[dev]]));
+        return rocblas_status_success;
+    }
+
+    hipStream_t stream(int dev)
+    {
+        return handle_.streams[slots_[dev]];
+    }
+
+    rocblas_handle handle(int dev)
+    {
+        return handle_.handles[slots_[dev]];
+    }
+
+    hipEvent_t event(int dev)
+    {
+        return handle_.events[slots_[dev]];
+    }
+
+    template <typename U>
+    U* part(int dev, size_t offset)
+    {
+        return (U*)((char*)work_[dev] + offset);
+    }
+
+    int* pivots(int dev)
+    {
+        return part<int>(dev, parts_[dev].pivots);
+    }
+
+    int* info(int dev)
+    {
+        return part<int>(dev, parts_[dev].info);
+    }
+
+    int ld(hipsolver_mg_ref ref)
+    {
+        return ref.buffer == hipsolver_mg_matrix ? lda_ : ld_[ref.dev];
+    }
+
+    T* ptr(hipsolver_mg_ref ref)
+    {
+        T* base = ref.buffer == hipsolver_mg_matrix ? A_[ref.dev]
+                                                    : part<T>(ref.dev, parts_[ref.dev].panel);
+        return base + ref.row + size_t(ref.col) * ld(ref);
+    }
+
+    static rocblas_fill fill(bool upper)
+    {
+        return upper ? rocblas_fill_upper : rocblas_fill_lower;
+    }
+
+    static rocblas_operation op(bool conj)
+    {
+        return conj ? rocblas_operation_conjugate_transpose : rocblas_operation_none;
+    }
+};
+
+/* Checks the arguments of a multi-device function on the m-by-n submatrix of
+   desc starting at (ia, ja), which must be (1, 1) as with cusolverMg, and
+   returns its layout and the position in the handle of every device of the
+   grid. */
+inline rocblas_status hipsolver_mg_argCheck(hipsolver_mg_handle*     handle,
+                                            const hipsolver_mg_desc* desc,
+                                            int                      m,
+                                            int                      n,
+                                            int                      ia,
+                                            int                      ja,
+                                            hipsolver_mg_layout*     layout,
+                                            std::vector<int>*        slots)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!desc)
+        return rocblas_status_invalid_pointer;
+    if(ia != 1 || ja != 1)
+        return rocblas_status_invalid_value;
+    if(m < 0 || n < 0 || m > desc->rows || n > desc->cols)
+        return rocblas_status_invalid_size;
+
+    slots->clear();
+    for(int device : desc->devices)
+    {
+        int slot = handle->find(device);
+        if(slot < 0)
+            return rocblas_status_invalid_value;
+        slots->push_back(slot);
+    }
+
+    layout->m    = m;
+    layout->n    = n;
+    layout->nb   = desc->col_block;
+    layout->ndev = int(desc->devices.size());
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_mg_bufferSize_template(hipsolver_mg_handle*       handle,
+                                                hipsolver_mg_factorization fact,
+                                                bool                       upper,
+                                                bool                       evect,
+                                                int                        m,
+                                                int                        n,
+                                                int                        ia,
+                                                int                        ja,
+                                                const hipsolver_mg_desc*   desc,
+                                                size_t*                    size)
+{
+    hipsolver_mg_layout layout;
+    std::vector<int>    slots;
+    ROCBLAS_RETURN_IF_ERROR(hipsolver_mg_argCheck(handle, desc, m, n, ia, ja, &layout, &slots));
+
+    *size = 0;
+    if(std::min(m, n) == 0)
+        return rocblas_status_success;
+
+    hipsolver_mg_device_guard guard;
+    for(int d = 0; d < layout.ndev; d++)
+    {
+        size_t internal;
+        HIP_RETURN_IF_ERROR(hipSetDevice(handle->devices[slots[d]]));
+        ROCBLAS_RETURN_IF_ERROR(hipsolver_mg_query<T>(
+            handle->handles[slots[d]], fact, upper, evect, layout, d, desc->rows, &internal));
+
+        size_t end = hipsolver_mg_workspace::make<T>(fact, upper, layout, d).end;
+        *size      = std::max(*size, end + hipsolver_mg_align(internal));
+    }
+    return rocblas_status_success;
+}
+
+/* Runs a multi-device factorization or eigensolver on the m-by-n matrix
+   distributed as described by desc, whose local matrices are A. ipiv receives
+   the pivots of the local columns of every device, and W the eigenvalues, on
+   the host. work is the workspace of size_work bytes of every device, or
+   nullptr to allocate it. */
+template <typename T, typename S>
+rocblas_status hipsolver_mg_template(hipsolver_mg_handle*       handle,
+                                     hipsolver_mg_factorization fact,
+                                     bool                       upper,
+                                     bool                       evect,
+                                     int                        m,
+                                     int                        n,
+                                     T**                        A,
+                                     int                        ia,
+                                     int                        ja,
+                                     const hipsolver_mg_desc*   desc,
+                                     int**                      ipiv,
+                                     S*                         W,
+                                     void**                     work,
+                                     size_t                     size_work,
+                                     int*                       info)
+{
+    hipsolver_mg_layout layout;
+    std::vector<int>    slots;
+    ROCBLAS_RETURN_IF_ERROR(hipsolver_mg_argCheck(handle, desc, m, n, ia, ja, &layout, &slots));
+    if(!info || (std::min(m, n) > 0 && !A) || (fact == hipsolver_mg_lu && !ipiv)
+       || (fact == hipsolver_mg_eigen && n > 0 && !W))
+        return rocblas_status_invalid_pointer;
+
+    // quick return
+    *info = 0;
+    if(std::min(m, n) == 0)
+        return rocblas_status_success;
+
+    for(int d = 0; d < layout.ndev; d++)
+    {
+        if(layout.local_cols(d) > 0 && (!A[d] || (fact == hipsolver_mg_lu && !ipiv[d])))
+            return rocblas_status_invalid_pointer;
+    }
+
+    size_t size_needed;
+    ROCBLAS_RETURN_IF_ERROR(hipsolver_mg_bufferSize_template<T>(
+        handle, fact, upper, evect, m, n, ia, ja, desc, &size_needed));
+
+    hipsolver_mg_device_guard guard;
+
+    // the workspace is allocated on every device if not provided
+    std::vector<void*> owned(layout.ndev, nullptr);
+    auto               release = [&]() {
+        for(int d = 0; d < layout.ndev; d++)
+            if(owned[d])
+            {
+                hipSetDevice(handle->devices[slots[d]]);
+                hipFree(owned[d]);
+            }
+    };
+
+    rocblas_status status = rocblas_status_success;
+    if(!work)
+    {
+        size_work = size_needed;
+        for(int d = 0; d < layout.ndev && status == rocblas_status_success; d++)
+        {
+            if(hipSetDevice(handle->devices[slots[d]]) != hipSuccess
+               || hipMalloc(&owned[d], size_work) != hipSuccess)
+                status = rocblas_status_memory_error;
+        }
+        work = owned.data();
+    }
+    else if(size_work < size_needed)
+        status = rocblas_status_memory_error;
+
+    // the work already enqueued on the devices of the grid is done first
+    for(int d = 0; d < layout.ndev && status == rocblas_status_success; d++)
+    {
+        if(hipSetDevice(handle->devices[slots[d]]) != hipSuccess
+           || hipDeviceSynchronize() != hipSuccess)
+            status = rocblas_status_internal_error;
+    }
+
+    std::vector<int> tile_info(hipsolver_mg_slots(fact, layout));
+    std::vector<int> pivots(fact == hipsolver_mg_lu ? std::min(m, n) : 0);
+    if(status == rocblas_status_success)
+    {
+        hipsolver_mg_device<T> dev(
+            *handle, slots, fact, upper, layout, A, desc->rows, work, size_work, W);
+        if(fact == hipsolver_mg_cholesky)
+            status = hipsolver_potrf_mg_schedule(dev, upper, layout, tile_info.data());
+        else if(fact == hipsolver_mg_lu)
+            status = hipsolver_getrf_mg_schedule(dev, layout, tile_info.data(), pivots.data());
+        else
+            status = hipsolver_syevd_mg_schedule(dev, evect, upper, layout, tile_info.data());
+    }
+
+    // the pivots of the local columns of every device
+    if(status == rocblas_status_success && fact == hipsolver_mg_lu)
+    {
+        hipsolver_mg_pivots(layout, int(pivots.size()), pivots.data());
+        std::vector<int> local;
+        for(int d = 0; d < layout.ndev && status == rocblas_status_success; d++)
+        {
+            local.clear();
+            for(int c = 0; c < layout.local_cols(d) && layout.global(d, c) < int(pivots.size());
+                c++)
+                local.push_back(pivots[layout.global(d, c)]);
+            if(!local.empty()
+               && (hipSetDevice(handle->devices[slots[d]]) != hipSuccess
+                   || hipMemcpy(ipiv[d],
+                                local.data(),
+                                sizeof(int) * local.size(),
+                                hipMemcpyHostToDevice)
+                          != hipSuccess))
+                status = rocblas_status_internal_error;
+        }
+    }
+
+    if(status == rocblas_status_success)
+        *info = fact == hipsolver_mg_eigen
+                    ? tile_info[0]
+                    : hipsolver_mg_info(int(tile_info.size()), tile_info.data(), layout.nb);
+    release();
+    return status;
+}
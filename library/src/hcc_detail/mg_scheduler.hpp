@@ -0,0 +1,501 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_templates.hpp"
+#include <algorithm>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    Multi-device schedules of the hipsolverMg functions. The m-by-n matrix
+ *    is distributed over the ndev devices of a grid with a 1D block-cyclic
+ *    column layout: column block jb, of nb columns, lives on device
+ *    jb % ndev, as local column block jb / ndev of the m-by-local_cols(dev)
+ *    matrix of that device. The factorizations are right-looking: at step k
+ *    the device owning the panel factorizes it, the other devices copy it
+ *    into a panel buffer of their own, and every device then updates its
+ *    local columns to the right of the panel. Devices only wait for each
+ *    other where they read data computed by another device, so the updates
+ *    of step k on one device overlap with the panel of step k + 1 on the
+ *    device owning it.
+ *
+ *    The schedules are templates over the device backend D, which has one
+ *    stream and one event per device and provides
+ *      init()                                  clears the info of the slots
+ *      record(dev)                             records the event of dev
+ *      wait(dev, src)                          dev waits for the event of src
+ *      copy(dst, src, rows, cols)              on the stream of dst.dev
+ *      copy_pivots(dst, src, offset, count)    on the stream of device dst
+ *      potrf(dev, upper, a, n, slot)           info of the block to slot
+ *      getrf(dev, a, m, n, slot, offset)       pivots relative to a to offset
+ *      laswp(dev, a, cols, offset, count)      interchanges of offset to rows of a
+ *      trsm(dev, left, upper, conj, unit, a, b, m, n)
+ *                                              b = op(a)^-1 * b or b * op(a)^-1
+ *      herk(dev, upper, conj, c, a, n, k)      c -= op(a) * op(a)^H
+ *      gemm(dev, conjA, conjB, c, a, b, m, n, k)
+ *                                              c -= op(a) * op(b)
+ *      syevd(dev, evect, upper, a, n, slot)    eigenvalues kept by the backend
+ *      finish(nslots, info, npivots, ipiv)     waits for all the devices
+ *    where op(x) is x^H if the corresponding flag is set and x otherwise, and
+ *    every operation except the copies runs on the stream of dev and only
+ *    references its memory. finish returns the value written to every info
+ *    slot by whichever device computed it (the slots are zero otherwise),
+ *    and the pivots held by device 0. All operations are asynchronous with
+ *    respect to the host, so a backend emulating the devices in host memory
+ *    can check the schedules by running the streams in any order that
+ *    respects the events.
+ * ===========================================================================
+ */
+
+// buffers of a device referenced by the schedules
+enum hipsolver_mg_buffer
+{
+    // the local columns of the distributed matrix, with the leading dimension of the layout
+    hipsolver_mg_matrix,
+    // the panel buffer, with the leading dimension given by hipsolver_mg_panel_shape
+    hipsolver_mg_panel,
+};
+
+// element (row, col) of a buffer of device dev
+struct hipsolver_mg_ref
+{
+    int                 dev;
+    hipsolver_mg_buffer buffer;
+    int                 row;
+    int                 col;
+};
+
+enum hipsolver_mg_factorization
+{
+    hipsolver_mg_cholesky,
+    hipsolver_mg_lu,
+    hipsolver_mg_eigen,
+};
+
+struct hipsolver_mg_layout
+{
+    int m    = 0;
+    int n    = 0;
+    int nb   = 1;
+    int ndev = 1;
+
+    // number of column blocks
+    int blocks() const
+    {
+        return n > 0 ? (n - 1) / nb + 1 : 0;
+    }
+
+    // number of columns of block jb
+    int cols(int jb) const
+    {
+        return std::min(nb, n - jb * nb);
+    }
+
+    int owner(int jb) const
+    {
+        return jb % ndev;
+    }
+
+    // first local column of block jb on its owner
+    int local(int jb) const
+    {
+        return jb / ndev * nb;
+    }
+
+    // number of local columns of device dev
+    int local_cols(int dev) const
+    {
+        int nt = blocks();
+        if(dev >= nt)
+            return 0;
+
+        int count = ((nt - 1 - dev) / ndev + 1) * nb;
+        if(owner(nt - 1) == dev)
+            count -= nb - cols(nt - 1);
+        return count;
+    }
+
+    // global column of local column c of device dev
+    int global(int dev, int c) const
+    {
+        return (c / nb * ndev + dev) * nb + c % nb;
+    }
+
+    // first local column of device dev belonging to a block jb or after it
+    int local_from(int dev, int jb) const
+    {
+        int first = jb + (dev - jb % ndev + ndev) % ndev;
+        return first < blocks() ? local(first) : local_cols(dev);
+    }
+};
+
+// number of info slots of a factorization
+inline int hipsolver_mg_slots(hipsolver_mg_factorization fact, const hipsolver_mg_layout& layout)
+{
+    int mn = std::min(layout.m, layout.n);
+    if(fact == hipsolver_mg_eigen)
+        return 1;
+    if(fact == hipsolver_mg_lu)
+        return mn > 0 ? (mn - 1) / layout.nb + 1 : 0;
+    return layout.blocks();
+}
+
+/* Leading dimension and number of columns of the panel buffer of every
+   device: a column of blocks for the lower Cholesky factorization and LU, a
+   row of blocks for the upper Cholesky factorization, and the whole matrix,
+   on device 0 only, for the eigensolver. */
+inline void hipsolver_mg_panel_shape(hipsolver_mg_factorization fact,
+                                     bool                       upper,
+                                     const hipsolver_mg_layout& layout,
+                                     int                        dev,
+                                     int*                       ld,
+                                     int*                       cols)
+{
+    *ld   = std::max(1, layout.m);
+    *cols = layout.nb;
+    if(fact == hipsolver_mg_cholesky && upper)
+    {
+        *ld   = layout.nb;
+        *cols = layout.n;
+    }
+    else if(fact == hipsolver_mg_eigen)
+        *cols = dev == 0 ? layout.n : 0;
+}
+
+inline hipsolver_mg_ref hipsolver_mg_matrix_ref(int dev, int row, int col)
+{
+    return {dev, hipsolver_mg_matrix, row, col};
+}
+
+inline hipsolver_mg_ref hipsolver_mg_panel_ref(int dev, int row, int col)
+{
+    return {dev, hipsolver_mg_panel, row, col};
+}
+
+// the info of a factorization from the info of its slots of nb columns
+inline int hipsolver_mg_info(int nslots, const int* tile_info, int nb)
+{
+    for(int k = 0; k < nslots; k++)
+        if(tile_info[k] != 0)
+            return k * nb + tile_info[k];
+    return 0;
+}
+
+// makes the pivots of every panel, relative to its first row, global
+inline void hipsolver_mg_pivots(const hipsolver_mg_layout& layout, int npivots, int* ipiv)
+{
+    for(int i = 0; i < npivots; i++)
+        ipiv[i] += i / layout.nb * layout.nb;
+}
+
+// every device waits for the work enqueued so far on all the others
+template <typename D>
+rocblas_status hipsolver_mg_barrier(D& dev, const hipsolver_mg_layout& layout)
+{
+    if(layout.ndev == 1)
+        return rocblas_status_success;
+
+    for(int d = 0; d < layout.ndev; d++)
+        ROCBLAS_RETURN_IF_ERROR(dev.record(d));
+    for(int d = 0; d < layout.ndev; d++)
+        for(int e = 0; e < layout.ndev; e++)
+            if(e != d)
+                ROCBLAS_RETURN_IF_ERROR(dev.wait(d, e));
+    return rocblas_status_success;
+}
+
+/******************** POTRF ********************/
+
+/* Schedules the Cholesky factorization of the n-by-n distributed matrix. In
+   the lower case, the owner of step k factorizes the diagonal block and
+   solves for the blocks below it, and the devices with columns to the right
+   copy that column of blocks. In the upper case, the rows of blocks of U are
+   distributed over the devices: the owner factorizes the diagonal block, the
+   other devices copy it and solve for their blocks of row k, and every
+   device then gathers the blocks of row k computed by the others. The info
+   of diagonal block k goes to slot k. */
+template <typename D>
+rocblas_status hipsolver_potrf_mg_schedule(D&                         dev,
+                                           bool                       upper,
+                                           const hipsolver_mg_layout& layout,
+                                           int*                       tile_info)
+{
+    auto mat = hipsolver_mg_matrix_ref;
+    auto pnl = hipsolver_mg_panel_ref;
+
+    int n    = layout.n;
+    int nb   = layout.nb;
+    int nt   = layout.blocks();
+    int ndev = layout.ndev;
+
+    // whether device d has columns to the right of block k
+    auto trailing
+        = [&](int d, int k) { return layout.local_from(d, k + 1) < layout.local_cols(d); };
+
+    ROCBLAS_RETURN_IF_ERROR(dev.init());
+    for(int k = 0; k < nt; k++)
+    {
+        int o  = layout.owner(k);
+        int k0 = k * nb;
+        int kb = layout.cols(k);
+        int kc = layout.local(k);
+
+        ROCBLAS_RETURN_IF_ERROR(dev.potrf(o, upper, mat(o, k0, kc), kb, k));
+
+        if(!upper)
+        {
+            // L(k + 1:, k) = A(k + 1:, k) * L(k, k)^-H
+            int below = n - k0 - kb;
+            if(below > 0)
+                ROCBLAS_RETURN_IF_ERROR(dev.trsm(
+                    o, false, false, true, false, mat(o, k0, kc), mat(o, k0 + kb, kc), below, kb));
+            ROCBLAS_RETURN_IF_ERROR(dev.record(o));
+
+            for(int d = 0; d < ndev; d++)
+            {
+                if(!trailing(d, k))
+                    continue;
+
+                // row r of the column of blocks, as held by device d
+                auto L = [&](int r) { return d == o ? mat(o, r, kc) : pnl(d, r, 0); };
+                if(d != o)
+                {
+                    ROCBLAS_RETURN_IF_ERROR(dev.wait(d, o));
+                    ROCBLAS_RETURN_IF_ERROR(dev.copy(pnl(d, k0, 0), mat(o, k0, kc), n - k0, kb));
+                }
+
+                for(int j = k + 1; j < nt; j++)
+                {
+                    if(layout.owner(j) != d)
+                        continue;
+
+                    int j0 = j * nb;
+                    int jb = layout.cols(j);
+                    int jc = layout.local(j);
+                    ROCBLAS_RETURN_IF_ERROR(
+                        dev.herk(d, false, false, mat(d, j0, jc), L(j0), jb, kb));
+                    if(n - j0 - jb > 0)
+                        ROCBLAS_RETURN_IF_ERROR(dev.gemm(d,
+                                                         false,
+                                                         true,
+                                                         mat(d, j0 + jb, jc),
+                                                         L(j0 + jb),
+                                                         L(j0),
+                                                         n - j0 - jb,
+                                                         jb,
+                                                         kb));
+                }
+            }
+        }
+        else
+        {
+            ROCBLAS_RETURN_IF_ERROR(dev.record(o));
+
+            // U(k, j) = U(k, k)^-H * A(k, j) for the blocks j > k of every device
+            for(int d = 0; d < ndev; d++)
+            {
+                if(!trailing(d, k))
+                    continue;
+
+                hipsolver_mg_ref diag = mat(o, k0, kc);
+                if(d != o)
+                {
+                    diag = pnl(d, 0, k0);
+                    ROCBLAS_RETURN_IF_ERROR(dev.wait(d, o));
+                    ROCBLAS_RETURN_IF_ERROR(dev.copy(diag, mat(o, k0, kc), kb, kb));
+                }
+
+                int c0 = layout.local_from(d, k + 1);
+                ROCBLAS_RETURN_IF_ERROR(dev.trsm(d,
+                                                 true,
+                                                 true,
+                                                 true,
+                                                 false,
+                                                 diag,
+                                                 mat(d, k0, c0),
+                                                 kb,
+                                                 layout.local_cols(d) - c0));
+                ROCBLAS_RETURN_IF_ERROR(dev.record(d));
+            }
+
+            // every device gathers the blocks of row k it needs, up to its last column
+            for(int d = 0; d < ndev; d++)
+            {
+                if(!trailing(d, k))
+                    continue;
+
+                int last = nt - 1;
+                while(layout.owner(last) != d)
+                    last--;
+
+                std::vector<bool> waited(ndev, false);
+                for(int j = k + 1; j <= last; j++)
+                {
+                    int e = layout.owner(j);
+                    if(e != d && !waited[e])
+                    {
+                        ROCBLAS_RETURN_IF_ERROR(dev.wait(d, e));
+                        waited[e] = true;
+                    }
+                    ROCBLAS_RETURN_IF_ERROR(dev.copy(
+                        pnl(d, 0, j * nb), mat(e, k0, layout.local(j)), kb, layout.cols(j)));
+                }
+
+                // A(j, j) -= U(k, j)^H * U(k, j) and the blocks above it
+                for(int j = k + 1; j < nt; j++)
+                {
+                    if(layout.owner(j) != d)
+                        continue;
+
+                    int j0 = j * nb;
+                    int jb = layout.cols(j);
+                    int jc = layout.local(j);
+                    ROCBLAS_RETURN_IF_ERROR(
+                        dev.herk(d, true, true, mat(d, j0, jc), pnl(d, 0, j0), jb, kb));
+                    if(j0 - k0 - kb > 0)
+                        ROCBLAS_RETURN_IF_ERROR(dev.gemm(d,
+                                                         true,
+                                                         false,
+                                                         mat(d, k0 + kb, jc),
+                                                         pnl(d, 0, k0 + kb),
+                                                         pnl(d, 0, j0),
+                                                         j0 - k0 - kb,
+                                                         jb,
+                                                         kb));
+                }
+            }
+        }
+    }
+
+    return dev.finish(nt, tile_info, 0, nullptr);
+}
+
+/******************** GETRF ********************/
+
+/* Schedules the LU factorization with partial pivoting of the m-by-n
+   distributed matrix. The owner of step k factorizes the column of blocks
+   from row k * nb down, and the devices with columns to the right copy it;
+   every device copies the pivots. Each device then applies the interchanges
+   and the updates to all its columns to the right of the panel at once, as
+   they are contiguous in its local matrix. The interchanges of the later
+   panels are applied to the columns on their left at the end, once the
+   panels have been copied. The pivots of panel k are relative to its first
+   row and its info goes to slot k. */
+template <typename D>
+rocblas_status hipsolver_getrf_mg_schedule(D&                         dev,
+                                           const hipsolver_mg_layout& layout,
+                                           int*                       tile_info,
+                                           int*                       ipiv)
+{
+    auto mat = hipsolver_mg_matrix_ref;
+    auto pnl = hipsolver_mg_panel_ref;
+
+    int m    = layout.m;
+    int nb   = layout.nb;
+    int ndev = layout.ndev;
+    int mn   = std::min(m, layout.n);
+    int np   = hipsolver_mg_slots(hipsolver_mg_lu, layout);
+
+    ROCBLAS_RETURN_IF_ERROR(dev.init());
+    for(int k = 0; k < np; k++)
+    {
+        int o  = layout.owner(k);
+        int k0 = k * nb;
+        int kb = layout.cols(k);
+        int kr = std::min(kb, m - k0);
+        int kc = layout.local(k);
+
+        ROCBLAS_RETURN_IF_ERROR(dev.getrf(o, mat(o, k0, kc), m - k0, kb, k, k0));
+        ROCBLAS_RETURN_IF_ERROR(dev.record(o));
+
+        for(int d = 0; d < ndev; d++)
+        {
+            int  c0 = layout.local_from(d, k + 1);
+            int  nc = layout.local_cols(d) - c0;
+            auto L  = [&](int r) { return d == o ? mat(o, r, kc) : pnl(d, r, 0); };
+            if(d != o)
+            {
+                ROCBLAS_RETURN_IF_ERROR(dev.wait(d, o));
+                ROCBLAS_RETURN_IF_ERROR(dev.copy_pivots(d, o, k0, kr));
+                if(nc > 0)
+                    ROCBLAS_RETURN_IF_ERROR(dev.copy(pnl(d, k0, 0), mat(o, k0, kc), m - k0, kb));
+            }
+            if(nc == 0)
+                continue;
+
+            // A(k, j) = L(k, k)^-1 * P(k) * A(k, j) and A(i, j) -= L(i, k) * A(k, j), i, j > k
+            ROCBLAS_RETURN_IF_ERROR(dev.laswp(d, mat(d, k0, c0), nc, k0, kr));
+            ROCBLAS_RETURN_IF_ERROR(
+                dev.trsm(d, true, false, false, true, L(k0), mat(d, k0, c0), kr, nc));
+            if(m - k0 - kr > 0)
+                ROCBLAS_RETURN_IF_ERROR(dev.gemm(d,
+                                                 false,
+                                                 false,
+                                                 mat(d, k0 + kr, c0),
+                                                 L(k0 + kr),
+                                                 mat(d, k0, c0),
+                                                 m - k0 - kr,
+                                                 nc,
+                                                 kr));
+        }
+    }
+
+    // the panels are not modified again before all the devices have copied them
+    ROCBLAS_RETURN_IF_ERROR(hipsolver_mg_barrier(dev, layout));
+    for(int k = 1; k < np; k++)
+    {
+        int k0 = k * nb;
+        int kr = std::min(layout.cols(k), m - k0);
+        for(int d = 0; d < ndev; d++)
+        {
+            int c1 = layout.local_from(d, k);
+            if(c1 > 0)
+                ROCBLAS_RETURN_IF_ERROR(dev.laswp(d, mat(d, k0, 0), c1, k0, kr));
+        }
+    }
+
+    return dev.finish(np, tile_info, mn, ipiv);
+}
+
+/******************** SYEVD ********************/
+
+/* Schedules the eigensolver of the n-by-n distributed matrix. rocSOLVER has
+   no distributed tridiagonal reduction, so the matrix is gathered in the
+   panel buffer of device 0, which computes the eigenvalues and eigenvectors,
+   and the eigenvectors are then copied back to the devices owning their
+   columns. The info goes to slot 0. */
+template <typename D>
+rocblas_status hipsolver_syevd_mg_schedule(
+    D& dev, bool evect, bool upper, const hipsolver_mg_layout& layout, int* info)
+{
+    auto mat = hipsolver_mg_matrix_ref;
+    auto pnl = hipsolver_mg_panel_ref;
+
+    int n  = layout.n;
+    int nb = layout.nb;
+    int nt = layout.blocks();
+
+    ROCBLAS_RETURN_IF_ERROR(dev.init());
+    for(int j = 0; j < nt; j++)
+        ROCBLAS_RETURN_IF_ERROR(dev.copy(
+            pnl(0, 0, j * nb), mat(layout.owner(j), 0, layout.local(j)), n, layout.cols(j)));
+    ROCBLAS_RETURN_IF_ERROR(dev.syevd(0, evect, upper, pnl(0, 0, 0), n, 0));
+
+    if(evect)
+    {
+        ROCBLAS_RETURN_IF_ERROR(dev.record(0));
+        for(int d = 1; d < std::min(layout.ndev, nt); d++)
+            ROCBLAS_RETURN_IF_ERROR(dev.wait(d, 0));
+        for(int j = 0; j < nt; j++)
+        {
+            int o = layout.owner(j);
+            ROCBLAS_RETURN_IF_ERROR(
+                dev.copy(mat(o, 0, layout.local(j)), pnl(0, 0, j * nb), n, layout.cols(j)));
+        }
+    }
+
+    return dev.finish(1, info, 0, nullptr);
+}
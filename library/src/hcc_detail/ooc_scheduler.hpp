@@ -0,0 +1,407 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_templates.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    Out-of-core tile scheduler. The matrices stay in host memory and are
+ *    moved through a fixed number of device tile slots of nb-by-nb elements.
+ *    Copies to the device, computations and copies back to the host are
+ *    issued on three streams; the tracker remembers which stream last used
+ *    every slot and which host tiles are still being written back, so that
+ *    every operation only waits for the operations it depends on.
+ *
+ *    The schedules are templates over the device backend D, which provides
+ *      load(slot, host, ld, rows, cols)      host tile -> slot, on stream h2d
+ *      store(slot, host, ld, rows, cols)     slot -> host tile, on stream d2h
+ *      record(stream, event), wait(stream, event)
+ *      potrf(upper, slot, n, tile)           tile info is returned by finish
+ *      trsm(left, upper, conj, a, b, m, n)   b = op(a)^-1 * b or b * op(a)^-1
+ *      herk(upper, conj, c, a, n, k)         c -= op(a) * op(a)^H
+ *      gemm(conjA, conjB, c, a, b, m, n, k)  c -= op(a) * op(b)
+ *      finish(ntiles, tile_info)             waits for all the streams
+ *    where op(x) is x^H if the corresponding flag is set and x otherwise.
+ *    Computations run on stream compute, and all operations are asynchronous
+ *    with respect to the host, so a backend emulating the device in host
+ *    memory can check the schedules by running the streams in any order
+ *    that respects the events.
+ * ===========================================================================
+ */
+
+// two slots each for the diagonal, row and streamed tiles, and a pool of at least two
+#define HIPSOLVER_OOC_MIN_SLOTS 8
+
+// slots 0 to HIPSOLVER_OOC_POOL - 1 are the working slots; the rest form the pool
+#define HIPSOLVER_OOC_POOL 6
+
+// identifies tile (row, col) of matrix 0 (A) or 1 (B) in the tracker
+inline int64_t hipsolver_ooc_key(int matrix, int row, int col)
+{
+    return (int64_t(matrix) << 62) | (int64_t(row) << 31) | int64_t(col);
+}
+
+class hipsolver_ooc_tracker
+{
+public:
+    static constexpr int h2d      = 0;
+    static constexpr int compute  = 1;
+    static constexpr int d2h      = 2;
+    static constexpr int nstreams = 3;
+
+    explicit hipsolver_ooc_tracker(int nslots)
+        : slot_(nslots)
+    {
+    }
+
+    // number of events the backend must provide for nslots slots
+    static int event_count(int nslots)
+    {
+        return nslots * nstreams + 1;
+    }
+
+    // returns the slot of the pool holding the host tile key, or -1
+    int find(int64_t key) const
+    {
+        auto it = resident_.find(key);
+        return it != resident_.end() && it->second >= HIPSOLVER_OOC_POOL ? it->second : -1;
+    }
+
+    template <typename D, typename T>
+    rocblas_status load(D& dev, int slot, int64_t key, const T* host, int ld, int rows, int cols)
+    {
+        slot_state& st = slot_[slot];
+
+        // the host tile may still be being written back
+        auto it = stored_.find(key);
+        if(it != stored_.end() && it->second > waited_)
+        {
+            ROCBLAS_RETURN_IF_ERROR(dev.wait(h2d, store_event()));
+            waited_ = nstored_;
+        }
+
+        // the previous contents of the slot may still be in use
+        for(int s = 0; s < nstreams; s++)
+            if(s != h2d && st.used[s])
+                ROCBLAS_RETURN_IF_ERROR(dev.wait(h2d, event(slot, s)));
+
+        ROCBLAS_RETURN_IF_ERROR(dev.load(slot, host, ld, rows, cols));
+        ROCBLAS_RETURN_IF_ERROR(dev.record(h2d, event(slot, h2d)));
+
+        auto old = resident_.find(st.key);
+        if(old != resident_.end() && old->second == slot)
+            resident_.erase(old);
+        resident_[key] = slot;
+        st.key         = key;
+        written(slot, h2d);
+        return rocblas_status_success;
+    }
+
+    template <typename D, typename T>
+    rocblas_status store(D& dev, int slot, int64_t key, T* host, int ld, int rows, int cols)
+    {
+        ROCBLAS_RETURN_IF_ERROR(await(dev, slot, d2h));
+        ROCBLAS_RETURN_IF_ERROR(dev.store(slot, host, ld, rows, cols));
+        ROCBLAS_RETURN_IF_ERROR(dev.record(d2h, event(slot, d2h)));
+        ROCBLAS_RETURN_IF_ERROR(dev.record(d2h, store_event()));
+
+        slot_[slot].used[d2h] = true;
+        stored_[key]          = ++nstored_;
+        return rocblas_status_success;
+    }
+
+    // runs op, which overwrites slot out and reads the slots in, on the compute stream
+    template <typename D, typename F>
+    rocblas_status run(D& dev, int out, std::initializer_list<int> in, F op)
+    {
+        ROCBLAS_RETURN_IF_ERROR(await(dev, out, compute));
+        if(slot_[out].used[d2h])
+            ROCBLAS_RETURN_IF_ERROR(dev.wait(compute, event(out, d2h)));
+        for(int s : in)
+            ROCBLAS_RETURN_IF_ERROR(await(dev, s, compute));
+
+        ROCBLAS_RETURN_IF_ERROR(op());
+
+        ROCBLAS_RETURN_IF_ERROR(dev.record(compute, event(out, compute)));
+        for(int s : in)
+        {
+            ROCBLAS_RETURN_IF_ERROR(dev.record(compute, event(s, compute)));
+            slot_[s].used[compute] = true;
+        }
+        written(out, compute);
+        slot_[out].used[compute] = true;
+        return rocblas_status_success;
+    }
+
+private:
+    struct slot_state
+    {
+        int64_t key    = -1;
+        int     writer = -1;
+        bool    used[nstreams] = {};
+        bool    seen[nstreams] = {};
+    };
+
+    std::vector<slot_state>              slot_;
+    std::unordered_map<int64_t, int>     resident_;
+    std::unordered_map<int64_t, int64_t> stored_;
+    int64_t                              nstored_ = 0;
+    int64_t                              waited_  = 0;
+
+    int event(int slot, int stream) const
+    {
+        return slot * nstreams + stream;
+    }
+
+    int store_event() const
+    {
+        return int(slot_.size()) * nstreams;
+    }
+
+    void written(int slot, int stream)
+    {
+        slot_state& st = slot_[slot];
+        st.writer      = stream;
+        for(int s = 0; s < nstreams; s++)
+        {
+            st.used[s] = false;
+            st.seen[s] = (s == stream);
+        }
+    }
+
+    // makes stream wait until the contents of slot have been written
+    template <typename D>
+    rocblas_status await(D& dev, int slot, int stream)
+    {
+        slot_state& st = slot_[slot];
+        if(st.writer >= 0 && !st.seen[stream])
+        {
+            ROCBLAS_RETURN_IF_ERROR(dev.wait(stream, event(slot, st.writer)));
+            st.seen[stream] = true;
+        }
+        return rocblas_status_success;
+    }
+};
+
+/******************** POTRF ********************/
+
+/* Schedules the Cholesky factorization of the n-by-n host matrix A with tiles
+   of nb-by-nb elements and nslots >= HIPSOLVER_OOC_MIN_SLOTS device slots. The
+   columns of tiles of the factor are computed left-looking: the diagonal tile
+   and the tiles below it are updated with the columns to their left, which are
+   streamed in again unless they are still resident in the pool. The tiles below
+   the diagonal are processed in chunks of at most half of the pool, so that the
+   copies back to the host of a chunk overlap with the loads of the next. The
+   info of the diagonal tiles is returned in tile_info. */
+template <typename T, typename D>
+rocblas_status hipsolver_potrf_ooc_schedule(
+    D& dev, bool upper, int n, T* A, int lda, int nb, int nslots, int* tile_info)
+{
+    using trk_t = hipsolver_ooc_tracker;
+
+    int nt    = (n - 1) / nb + 1;
+    int npool = nslots - HIPSOLVER_OOC_POOL;
+    int chunk = std::max(1, npool / 2);
+
+    auto bs = [&](int t) { return std::min(nb, n - t * nb); };
+
+    // block (i, j) of the lower triangular factor L is stored as L(i, j) or as U(j, i) = L(i, j)^H
+    auto tile = [&](int i, int j) {
+        return upper ? A + size_t(j) * nb + size_t(i) * nb * lda
+                     : A + size_t(i) * nb + size_t(j) * nb * lda;
+    };
+    auto key = [&](int i, int j) { return hipsolver_ooc_key(0, i, j); };
+
+    trk_t tracker(nslots);
+    int   next_pool = 0, next_r = 0, next_s = 0;
+
+    auto load_tile = [&](int slot, int i, int j) {
+        return upper ? tracker.load(dev, slot, key(i, j), tile(i, j), lda, bs(j), bs(i))
+                     : tracker.load(dev, slot, key(i, j), tile(i, j), lda, bs(i), bs(j));
+    };
+    auto store_tile = [&](int slot, int i, int j) {
+        return upper ? tracker.store(dev, slot, key(i, j), tile(i, j), lda, bs(j), bs(i))
+                     : tracker.store(dev, slot, key(i, j), tile(i, j), lda, bs(i), bs(j));
+    };
+
+    std::vector<int> panel(chunk);
+    for(int k = 0; k < nt; k++)
+    {
+        int diag = k % 2;
+        int nk   = bs(k);
+        ROCBLAS_RETURN_IF_ERROR(load_tile(diag, k, k));
+
+        int  i0    = k + 1;
+        bool first = true;
+        do
+        {
+            int i1 = std::min(nt, i0 + chunk);
+            for(int i = i0; i < i1; i++)
+            {
+                panel[i - i0] = HIPSOLVER_OOC_POOL + next_pool++ % npool;
+                ROCBLAS_RETURN_IF_ERROR(load_tile(panel[i - i0], i, k));
+            }
+
+            // update with the columns on the left
+            for(int j = 0; j < k; j++)
+            {
+                int nj  = bs(j);
+                int row = tracker.find(key(k, j));
+                if(row < 0)
+                {
+                    row = 2 + next_r++ % 2;
+                    ROCBLAS_RETURN_IF_ERROR(load_tile(row, k, j));
+                }
+
+                if(first)
+                    ROCBLAS_RETURN_IF_ERROR(tracker.run(dev, diag, {row}, [&] {
+                        return dev.herk(upper, upper, diag, row, nk, nj);
+                    }));
+
+                for(int i = i0; i < i1; i++)
+                {
+                    int ni   = bs(i);
+                    int p    = panel[i - i0];
+                    int strm = tracker.find(key(i, j));
+                    if(strm < 0)
+                    {
+                        strm = 4 + next_s++ % 2;
+                        ROCBLAS_RETURN_IF_ERROR(load_tile(strm, i, j));
+                    }
+
+                    ROCBLAS_RETURN_IF_ERROR(tracker.run(dev, p, {strm, row}, [&] {
+                        return upper ? dev.gemm(true, false, p, row, strm, nk, ni, nj)
+                                     : dev.gemm(false, true, p, strm, row, ni, nk, nj);
+                    }));
+                }
+            }
+
+            // factorize the diagonal tile and solve for the tiles below it
+            if(first)
+            {
+                ROCBLAS_RETURN_IF_ERROR(tracker.run(
+                    dev, diag, {}, [&] { return dev.potrf(upper, diag, nk, k); }));
+                ROCBLAS_RETURN_IF_ERROR(store_tile(diag, k, k));
+            }
+
+            for(int i = i0; i < i1; i++)
+            {
+                int ni = bs(i);
+                int p  = panel[i - i0];
+                ROCBLAS_RETURN_IF_ERROR(tracker.run(dev, p, {diag}, [&] {
+                    return upper ? dev.trsm(true, true, true, diag, p, nk, ni)
+                                 : dev.trsm(false, false, true, diag, p, ni, nk);
+                }));
+                ROCBLAS_RETURN_IF_ERROR(store_tile(p, i, k));
+            }
+
+            first = false;
+            i0    = i1;
+        } while(i0 < nt);
+    }
+
+    return dev.finish(nt, tile_info);
+}
+
+/******************** POTRS ********************/
+
+/* Schedules the solution of A * X = B, with A = L * L^H or A = U^H * U as
+   computed by hipsolver_potrf_ooc_schedule, for the n-by-nrhs host matrix B.
+   Each column of tiles of B is solved forward and then backward; the tiles of
+   the solution computed so far are streamed in again unless they are still
+   resident in the pool. */
+template <typename T, typename D>
+rocblas_status hipsolver_potrs_ooc_schedule(
+    D& dev, bool upper, int n, int nrhs, const T* A, int lda, T* B, int ldb, int nb, int nslots)
+{
+    using trk_t = hipsolver_ooc_tracker;
+
+    int nt    = (n - 1) / nb + 1;
+    int nc    = (nrhs - 1) / nb + 1;
+    int npool = nslots - HIPSOLVER_OOC_POOL;
+
+    auto bs = [&](int t) { return std::min(nb, n - t * nb); };
+
+    auto tile = [&](int i, int j) {
+        return upper ? A + size_t(j) * nb + size_t(i) * nb * lda
+                     : A + size_t(i) * nb + size_t(j) * nb * lda;
+    };
+    auto btile = [&](int i, int c) { return B + size_t(i) * nb + size_t(c) * nb * ldb; };
+
+    trk_t tracker(nslots);
+    int   next_pool = 0, next_d = 0, next_r = 0, next_s = 0;
+
+    auto load_tile = [&](int slot, int i, int j) {
+        int64_t key = hipsolver_ooc_key(0, i, j);
+        return upper ? tracker.load(dev, slot, key, tile(i, j), lda, bs(j), bs(i))
+                     : tracker.load(dev, slot, key, tile(i, j), lda, bs(i), bs(j));
+    };
+
+    for(int c = 0; c < nc; c++)
+    {
+        int w = std::min(nb, nrhs - c * nb);
+
+        // forward (L * Y = B or U^H * Y = B), then backward (L^H * X = Y or U * X = Y)
+        for(int pass = 0; pass < 2; pass++)
+        {
+            bool forward = (pass == 0);
+            for(int t = 0; t < nt; t++)
+            {
+                int k  = forward ? t : nt - 1 - t;
+                int nk = bs(k);
+
+                int x = tracker.find(hipsolver_ooc_key(1, k, c));
+                if(x < 0)
+                {
+                    x = HIPSOLVER_OOC_POOL + next_pool++ % npool;
+                    ROCBLAS_RETURN_IF_ERROR(tracker.load(
+                        dev, x, hipsolver_ooc_key(1, k, c), btile(k, c), ldb, nk, w));
+                }
+
+                int j0 = forward ? 0 : k + 1;
+                int j1 = forward ? k : nt;
+                for(int j = j0; j < j1; j++)
+                {
+                    int nj  = bs(j);
+                    int row = 2 + next_r++ % 2;
+                    if(forward)
+                        ROCBLAS_RETURN_IF_ERROR(load_tile(row, k, j));
+                    else
+                        ROCBLAS_RETURN_IF_ERROR(load_tile(row, j, k));
+
+                    int strm = tracker.find(hipsolver_ooc_key(1, j, c));
+                    if(strm < 0)
+                    {
+                        strm = 4 + next_s++ % 2;
+                        ROCBLAS_RETURN_IF_ERROR(tracker.load(
+                            dev, strm, hipsolver_ooc_key(1, j, c), btile(j, c), ldb, nj, w));
+                    }
+
+                    // the stored tile is L(k, j), U(j, k), L(j, k) or U(k, j)
+                    bool conj = (forward == upper);
+                    ROCBLAS_RETURN_IF_ERROR(tracker.run(dev, x, {row, strm}, [&] {
+                        return dev.gemm(conj, false, x, row, strm, nk, w, nj);
+                    }));
+                }
+
+                int diag = next_d++ % 2;
+                ROCBLAS_RETURN_IF_ERROR(load_tile(diag, k, k));
+                ROCBLAS_RETURN_IF_ERROR(tracker.run(dev, x, {diag}, [&] {
+                    return dev.trsm(true, upper, forward == upper, diag, x, nk, w);
+                }));
+                ROCBLAS_RETURN_IF_ERROR(
+                    tracker.store(dev, x, hipsolver_ooc_key(1, k, c), btile(k, c), ldb, nk, w));
+            }
+        }
+    }
+
+    return dev.finish(0, nullptr);
+}
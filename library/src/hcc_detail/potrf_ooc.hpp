@@ -0,0 +1,405 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "ooc_scheduler.hpp"
+#include "rocblas_templates.hpp"
+#include "rocsolver_templates.hpp"
+#include <cmath>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    potrfOutOfCore and potrsOutOfCore work on matrices in host memory that
+ *    need not fit in device memory. The tiles are scheduled as described in
+ *    ooc_scheduler.hpp; this file provides the device backend, which copies
+ *    tiles on two streams of its own and computes on the handle's stream,
+ *    and chooses the tile size that fits the device memory budget.
+ * ===========================================================================
+ */
+
+// largest tile size, used when the budget allows it
+#define HIPSOLVER_OOC_BLOCKSIZE 2048
+
+template <typename T>
+class hipsolver_ooc_device
+{
+public:
+    hipsolver_ooc_device(rocblas_handle handle, int nb, T* slots, int* tile_info)
+        : handle_(handle)
+        , nb_(nb)
+        , slots_(slots)
+        , tile_info_(tile_info)
+    {
+    }
+
+    ~hipsolver_ooc_device()
+    {
+        // operations may still be in flight if scheduling stopped on an error
+        for(hipStream_t stream : own_)
+        {
+            hipStreamSynchronize(stream);
+            hipStreamDestroy(stream);
+        }
+        if(stream_[hipsolver_ooc_tracker::compute])
+            hipStreamSynchronize(stream_[hipsolver_ooc_tracker::compute]);
+        for(hipEvent_t event : events_)
+            hipEventDestroy(event);
+    }
+
+    rocblas_status init(int nevents)
+    {
+        hipStream_t& compute = stream_[hipsolver_ooc_tracker::compute];
+        ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle_, &compute));
+        for(int s : {hipsolver_ooc_tracker::h2d, hipsolver_ooc_tracker::d2h})
+        {
+            HIP_RETURN_IF_ERROR(hipStreamCreateWithFlags(&stream_[s], hipStreamNonBlocking));
+            own_.push_back(stream_[s]);
+        }
+
+        // the last event orders the copies after earlier work on the handle's stream,
+        // which may still use the device memory of the slots
+        for(int e = 0; e <= nevents; e++)
+        {
+            hipEvent_t event;
+            HIP_RETURN_IF_ERROR(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+            events_.push_back(event);
+        }
+        ROCBLAS_RETURN_IF_ERROR(record(hipsolver_ooc_tracker::compute, nevents));
+        ROCBLAS_RETURN_IF_ERROR(wait(hipsolver_ooc_tracker::h2d, nevents));
+        ROCBLAS_RETURN_IF_ERROR(wait(hipsolver_ooc_tracker::d2h, nevents));
+        return rocblas_status_success;
+    }
+
+    rocblas_status load(int slot, const T* host, int ld, int rows, int cols)
+    {
+        HIP_RETURN_IF_ERROR(hipMemcpy2DAsync(tile(slot),
+                                             sizeof(T) * nb_,
+                                             host,
+                                             sizeof(T) * ld,
+                                             sizeof(T) * rows,
+                                             cols,
+                                             hipMemcpyHostToDevice,
+                                             stream_[hipsolver_ooc_tracker::h2d]));
+        return rocblas_status_success;
+    }
+
+    rocblas_status store(int slot, T* host, int ld, int rows, int cols)
+    {
+        HIP_RETURN_IF_ERROR(hipMemcpy2DAsync(host,
+                                             sizeof(T) * ld,
+                                             tile(slot),
+                                             sizeof(T) * nb_,
+                                             sizeof(T) * rows,
+                                             cols,
+                                             hipMemcpyDeviceToHost,
+                                             stream_[hipsolver_ooc_tracker::d2h]));
+        return rocblas_status_success;
+    }
+
+    rocblas_status record(int stream, int event)
+    {
+        HIP_RETURN_IF_ERROR(hipEventRecord(events_[event], stream_[stream]));
+        return rocblas_status_success;
+    }
+
+    rocblas_status wait(int stream, int event)
+    {
+        HIP_RETURN_IF_ERROR(hipStreamWaitEvent(stream_[stream], events_[event], 0));
+        return rocblas_status_success;
+    }
+
+    rocblas_status potrf(bool upper, int a, int n, int t)
+    {
+        return rocsolverCall_potrf(handle_, fill(upper), n, tile(a), nb_, tile_info_ + t);
+    }
+
+    rocblas_status trsm(bool left, bool upper, bool conj, int a, int b, int m, int n)
+    {
+        T one = 1;
+        return rocblasCall_trsm(handle_,
+                                left ? rocblas_side_left : rocblas_side_right,
+                                fill(upper),
+                                op(conj),
+                                rocblas_diagonal_non_unit,
+                                m,
+                                n,
+                                &one,
+                                tile(a),
+                                nb_,
+                                tile(b),
+                                nb_);
+    }
+
+    rocblas_status herk(bool upper, bool conj, int c, int a, int n, int k)
+    {
+        using S = decltype(std::abs(T(0)));
+
+        S one = 1, minone = -1;
+        return rocblasCall_herk(
+            handle_, fill(upper), op(conj), n, k, &minone, tile(a), nb_, &one, tile(c), nb_);
+    }
+
+    rocblas_status gemm(bool conjA, bool conjB, int c, int a, int b, int m, int n, int k)
+    {
+        T one = 1, minone = -1;
+        return rocblasCall_gemm(handle_,
+                                op(conjA),
+                                op(conjB),
+                                m,
+                                n,
+                                k,
+                                &minone,
+                                tile(a),
+                                nb_,
+                                tile(b),
+                                nb_,
+                                &one,
+                                tile(c),
+                                nb_);
+    }
+
+    rocblas_status finish(int ntiles, int* tile_info)
+    {
+        hipStream_t compute = stream_[hipsolver_ooc_tracker::compute];
+        if(ntiles > 0)
+            HIP_RETURN_IF_ERROR(hipMemcpyAsync(
+                tile_info, tile_info_, sizeof(int) * ntiles, hipMemcpyDeviceToHost, compute));
+
+        for(hipStream_t stream : stream_)
+            HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream));
+        return rocblas_status_success;
+    }
+
+private:
+    rocblas_handle           handle_;
+    int                      nb_;
+    T*                       slots_;
+    int*                     tile_info_;
+    hipStream_t              stream_[hipsolver_ooc_tracker::nstreams] = {};
+    std::vector<hipStream_t> own_;
+    std::vector<hipEvent_t>  events_;
+
+    T* tile(int slot)
+    {
+        return slots_ + size_t(slot) * nb_ * nb_;
+    }
+
+    static rocblas_fill fill(bool upper)
+    {
+        return upper ? rocblas_fill_upper : rocblas_fill_lower;
+    }
+
+    static rocblas_operation op(bool conj)
+    {
+        return conj ? rocblas_operation_conjugate_transpose : rocblas_operation_none;
+    }
+};
+
+inline rocblas_status hipsolver_ooc_argCheck(rocblas_handle handle,
+                                             int            n,
+                                             int            nrhs,
+                                             int            lda,
+                                             int            ldb,
+                                             const void*    A,
+                                             const void*    B,
+                                             int*           info)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n)
+        return rocblas_status_invalid_size;
+    if((n && !A) || (n && nrhs && !B) || !info)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_success;
+}
+
+// device memory required by rocBLAS and rocSOLVER for the operations on tiles of size nb
+template <typename T>
+rocblas_status hipsolver_ooc_internal_size(rocblas_handle handle, int nb, size_t* size)
+{
+    using S = decltype(std::abs(T(0)));
+
+    T one = 1;
+    S rone = 1;
+
+    auto ok = [](rocblas_status status) {
+        return status == rocblas_status_success || status == rocblas_status_size_unchanged
+               || status == rocblas_status_size_increased;
+    };
+
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_status status
+        = rocsolverCall_potrf(handle, rocblas_fill_upper, nb, (T*)nullptr, nb, (int*)nullptr);
+    if(ok(status))
+        status = rocblasCall_trsm(handle,
+                                  rocblas_side_left,
+                                  rocblas_fill_upper,
+                                  rocblas_operation_conjugate_transpose,
+                                  rocblas_diagonal_non_unit,
+                                  nb,
+                                  nb,
+                                  &one,
+                                  (T*)nullptr,
+                                  nb,
+                                  (T*)nullptr,
+                                  nb);
+    if(ok(status))
+        status = rocblasCall_herk(handle,
+                                  rocblas_fill_upper,
+                                  rocblas_operation_conjugate_transpose,
+                                  nb,
+                                  nb,
+                                  &rone,
+                                  (T*)nullptr,
+                                  nb,
+                                  &rone,
+                                  (T*)nullptr,
+                                  nb);
+    if(ok(status))
+        status = rocblasCall_gemm(handle,
+                                  rocblas_operation_conjugate_transpose,
+                                  rocblas_operation_none,
+                                  nb,
+                                  nb,
+                                  nb,
+                                  &one,
+                                  (T*)nullptr,
+                                  nb,
+                                  (T*)nullptr,
+                                  nb,
+                                  &one,
+                                  (T*)nullptr,
+                                  nb);
+    rocblas_stop_device_memory_size_query(handle, size);
+
+    return ok(status) ? rocblas_status_success : status;
+}
+
+/* Chooses the tile size nb and the number of slots nslots of an out-of-core
+   potrf (nrhs = 0) or potrs of order n, so that they use at most budget bytes
+   of device memory including the memory required by rocBLAS and rocSOLVER.
+   The largest tile size leaving twice the minimum number of slots is preferred,
+   since more slots give more overlap and fewer tiles are loaded again. size_ooc
+   is the memory needed for the slots and the tile info, and size the total. */
+template <typename T>
+rocblas_status hipsolver_ooc_blocking(rocblas_handle handle,
+                                      int            n,
+                                      int            nrhs,
+                                      size_t         budget,
+                                      int*           nb,
+                                      int*           nslots,
+                                      size_t*        size_ooc,
+                                      size_t*        size)
+{
+    *nb       = 0;
+    *nslots   = 0;
+    *size_ooc = 0;
+    *size     = 0;
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    for(int b = std::min(n, HIPSOLVER_OOC_BLOCKSIZE);; b /= 2)
+    {
+        int    nt = (n - 1) / b + 1;
+        size_t internal;
+        ROCBLAS_RETURN_IF_ERROR(hipsolver_ooc_internal_size<T>(handle, b, &internal));
+
+        // slots beyond one per tile are never used
+        int64_t ntiles = nrhs ? int64_t(nt) * ((nrhs - 1) / b + 1) : int64_t(nt) * (nt + 1) / 2;
+        int64_t useful = std::max<int64_t>(HIPSOLVER_OOC_MIN_SLOTS, HIPSOLVER_OOC_POOL + ntiles);
+
+        size_t  slot  = sizeof(T) * b * b;
+        size_t  fixed = internal + sizeof(int) * nt;
+        int64_t count = budget > fixed ? std::min<int64_t>((budget - fixed) / slot, useful) : 0;
+
+        if(count >= HIPSOLVER_OOC_MIN_SLOTS && (*nb == 0 || count >= 2 * HIPSOLVER_OOC_MIN_SLOTS))
+        {
+            *nb       = b;
+            *nslots   = int(count);
+            *size_ooc = slot * count + sizeof(int) * nt;
+            *size     = *size_ooc + internal;
+        }
+        if(count >= std::min<int64_t>(useful, 2 * HIPSOLVER_OOC_MIN_SLOTS) || b <= 32)
+            break;
+    }
+
+    return *nb ? rocblas_status_success : rocblas_status_memory_error;
+}
+
+/* Overwrites the host matrix A with its Cholesky factor and sets the host
+   integer info. work must point to at least size_ooc bytes of device memory,
+   as returned by hipsolver_ooc_blocking for nb and nslots. */
+template <typename T>
+rocblas_status hipsolver_potrf_ooc_template(rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            int            n,
+                                            T*             A,
+                                            int            lda,
+                                            int*           info,
+                                            int            nb,
+                                            int            nslots,
+                                            void*          work)
+{
+    // quick return
+    *info = 0;
+    if(n == 0)
+        return rocblas_status_success;
+
+    int  nt    = (n - 1) / nb + 1;
+    T*   slots = (T*)work;
+    int* dinfo = (int*)(slots + size_t(nslots) * nb * nb);
+
+    hipsolver_ooc_device<T> dev(handle, nb, slots, dinfo);
+    ROCBLAS_RETURN_IF_ERROR(dev.init(hipsolver_ooc_tracker::event_count(nslots)));
+
+    std::vector<int> tile_info(nt);
+    ROCBLAS_RETURN_IF_ERROR(hipsolver_potrf_ooc_schedule(
+        dev, uplo == rocblas_fill_upper, n, A, lda, nb, nslots, tile_info.data()));
+
+    // the first diagonal tile that is not positive definite determines info
+    for(int k = 0; k < nt; k++)
+    {
+        if(tile_info[k] > 0)
+        {
+            *info = k * nb + tile_info[k];
+            break;
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+/* Overwrites the host matrix B with the solution of A * X = B, where the host
+   matrix A holds the factor computed by hipsolver_potrf_ooc_template. */
+template <typename T>
+rocblas_status hipsolver_potrs_ooc_template(rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            int            n,
+                                            int            nrhs,
+                                            const T*       A,
+                                            int            lda,
+                                            T*             B,
+                                            int            ldb,
+                                            int*           info,
+                                            int            nb,
+                                            int            nslots,
+                                            void*          work)
+{
+    // quick return
+    *info = 0;
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    hipsolver_ooc_device<T> dev(handle, nb, (T*)work, nullptr);
+    ROCBLAS_RETURN_IF_ERROR(dev.init(hipsolver_ooc_tracker::event_count(nslots)));
+
+    return hipsolver_potrs_ooc_schedule(
+        dev, uplo == rocblas_fill_upper, n, nrhs, A, lda, B, ldb, nb, nslots);
+}
@@ -0,0 +1,1194 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+
+/*
+ * ===========================================================================
+ *    Type-overloaded wrappers of the rocBLAS functions used by the routines
+ *    that hipSOLVER composes itself. They allow those routines to be written
+ *    once as templates over float, double, rocblas_float_complex and
+ *    rocblas_double_complex.
+ * ===========================================================================
+ */
+
+#define ROCBLAS_RETURN_IF_ERROR(STATUS)       \
+    do                                        \
+    {                                         \
+        rocblas_status _status = (STATUS);    \
+        if(_status != rocblas_status_success) \
+            return _status;                   \
+    } while(0)
+
+// accepts the size statuses returned by calls made in device memory size query mode
+#define ROCBLAS_QUERY_RETURN_IF_ERROR(STATUS)                                            \
+    do                                                                                   \
+    {                                                                                    \
+        rocblas_status _status = (STATUS);                                               \
+        if(_status != rocblas_status_success && _status != rocblas_status_size_unchanged \
+           && _status != rocblas_status_size_increased)                                  \
+            return _status;                                                              \
+    } while(0)
+
+#define HIP_RETURN_IF_ERROR(STATUS)               \
+    do                                            \
+    {                                             \
+        hipError_t _status = (STATUS);            \
+        if(_status == hipErrorOutOfMemory)        \
+            return rocblas_status_memory_error;   \
+        if(_status != hipSuccess)                 \
+            return rocblas_status_internal_error; \
+    } while(0)
+
+// copy
+inline rocblas_status rocblasCall_copy(
+    rocblas_handle handle, int n, const float* x, int incx, float* y, int incy)
+{
+    return rocblas_scopy(handle, n, x, incx, y, incy);
+}
+
+inline rocblas_status rocblasCall_copy(
+    rocblas_handle handle, int n, const double* x, int incx, double* y, int incy)
+{
+    return rocblas_dcopy(handle, n, x, incx, y, incy);
+}
+
+inline rocblas_status rocblasCall_copy(rocblas_handle               handle,
+                                       int                          n,
+                                       const rocblas_float_complex* x,
+                                       int                          incx,
+                                       rocblas_float_complex*       y,
+                                       int                          incy)
+{
+    return rocblas_ccopy(handle, n, x, incx, y, incy);
+}
+
+inline rocblas_status rocblasCall_copy(rocblas_handle                handle,
+                                       int                           n,
+                                       const rocblas_double_complex* x,
+                                       int                           incx,
+                                       rocblas_double_complex*       y,
+                                       int                           incy)
+{
+    return rocblas_zcopy(handle, n, x, incx, y, incy);
+}
+
+// copy_strided_batched
+inline rocblas_status rocblasCall_copy_strided_batched(rocblas_handle handle,
+                                                       int            n,
+                                                       const float*   x,
+                                                       int            incx,
+                                                       rocblas_stride stridex,
+                                                       float*         y,
+                                                       int            incy,
+                                                       rocblas_stride stridey,
+                                                       int            batch_count)
+{
+    return rocblas_scopy_strided_batched(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+inline rocblas_status rocblasCall_copy_strided_batched(rocblas_handle handle,
+                                                       int            n,
+                                                       const double*  x,
+                                                       int            incx,
+                                                       rocblas_stride stridex,
+                                                       double*        y,
+                                                       int            incy,
+                                                       rocblas_stride stridey,
+                                                       int            batch_count)
+{
+    return rocblas_dcopy_strided_batched(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+inline rocblas_status rocblasCall_copy_strided_batched(rocblas_handle               handle,
+                                                       int                          n,
+                                                       const rocblas_float_complex* x,
+                                                       int                          incx,
+                                                       rocblas_stride               stridex,
+                                                       rocblas_float_complex*       y,
+                                                       int                          incy,
+                                                       rocblas_stride               stridey,
+                                                       int                          batch_count)
+{
+    return rocblas_ccopy_strided_batched(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+inline rocblas_status rocblasCall_copy_strided_batched(rocblas_handle                handle,
+                                                       int                           n,
+                                                       const rocblas_double_complex* x,
+                                                       int                           incx,
+                                                       rocblas_stride                stridex,
+                                                       rocblas_double_complex*       y,
+                                                       int                           incy,
+                                                       rocblas_stride                stridey,
+                                                       int                           batch_count)
+{
+    return rocblas_zcopy_strided_batched(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+// swap
+inline rocblas_status
+    rocblasCall_swap(rocblas_handle handle, int n, float* x, int incx, float* y, int incy)
+{
+    return rocblas_sswap(handle, n, x, incx, y, incy);
+}
+
+inline rocblas_status
+    rocblasCall_swap(rocblas_handle handle, int n, double* x, int incx, double* y, int incy)
+{
+    return rocblas_dswap(handle, n, x, incx, y, incy);
+}
+
+inline rocblas_status rocblasCall_swap(rocblas_handle         handle,
+                                       int                    n,
+                                       rocblas_float_complex* x,
+                                       int                    incx,
+                                       rocblas_float_complex* y,
+                                       int                    incy)
+{
+    return rocblas_cswap(handle, n, x, incx, y, incy);
+}
+
+inline rocblas_status rocblasCall_swap(rocblas_handle          handle,
+                                       int                     n,
+                                       rocblas_double_complex* x,
+                                       int                     incx,
+                                       rocblas_double_complex* y,
+                                       int                     incy)
+{
+    return rocblas_zswap(handle, n, x, incx, y, incy);
+}
+
+// scal
+inline rocblas_status
+    rocblasCall_scal(rocblas_handle handle, int n, const float* alpha, float* x, int incx)
+{
+    return rocblas_sscal(handle, n, alpha, x, incx);
+}
+
+inline rocblas_status
+    rocblasCall_scal(rocblas_handle handle, int n, const double* alpha, double* x, int incx)
+{
+    return rocblas_dscal(handle, n, alpha, x, incx);
+}
+
+inline rocblas_status rocblasCall_scal(rocblas_handle               handle,
+                                       int                          n,
+                                       const rocblas_float_complex* alpha,
+                                       rocblas_float_complex*       x,
+                                       int                          incx)
+{
+    return rocblas_cscal(handle, n, alpha, x, incx);
+}
+
+inline rocblas_status rocblasCall_scal(rocblas_handle                handle,
+                                       int                           n,
+                                       const rocblas_double_complex* alpha,
+                                       rocblas_double_complex*       x,
+                                       int                           incx)
+{
+    return rocblas_zscal(handle, n, alpha, x, incx);
+}
+
+// axpy
+inline rocblas_status rocblasCall_axpy(
+    rocblas_handle handle, int n, const float* alpha, const float* x, int incx, float* y, int incy)
+{
+    return rocblas_saxpy(handle, n, alpha, x, incx, y, incy);
+}
+
+inline rocblas_status rocblasCall_axpy(rocblas_handle handle,
+                                       int            n,
+                                       const double*  alpha,
+                                       const double*  x,
+                                       int            incx,
+                                       double*        y,
+                                       int            incy)
+{
+    return rocblas_daxpy(handle, n, alpha, x, incx, y, incy);
+}
+
+inline rocblas_status rocblasCall_axpy(rocblas_handle               handle,
+                                       int                          n,
+                                       const rocblas_float_complex* alpha,
+                                       const rocblas_float_complex* x,
+                                       int                          incx,
+                                       rocblas_float_complex*       y,
+                                       int                          incy)
+{
+    return rocblas_caxpy(handle, n, alpha, x, incx, y, incy);
+}
+
+inline rocblas_status rocblasCall_axpy(rocblas_handle                handle,
+                                       int                           n,
+                                       const rocblas_double_complex* alpha,
+                                       const rocblas_double_complex* x,
+                                       int                           incx,
+                                       rocblas_double_complex*       y,
+                                       int                           incy)
+{
+    return rocblas_zaxpy(handle, n, alpha, x, incx, y, incy);
+}
+
+// nrm2
+inline rocblas_status rocblasCall_nrm2(
+    rocblas_handle handle, int n, const float* x, int incx, float* result)
+{
+    return rocblas_snrm2(handle, n, x, incx, result);
+}
+
+inline rocblas_status rocblasCall_nrm2(
+    rocblas_handle handle, int n, const double* x, int incx, double* result)
+{
+    return rocblas_dnrm2(handle, n, x, incx, result);
+}
+
+inline rocblas_status rocblasCall_nrm2(
+    rocblas_handle handle, int n, const rocblas_float_complex* x, int incx, float* result)
+{
+    return rocblas_scnrm2(handle, n, x, incx, result);
+}
+
+inline rocblas_status rocblasCall_nrm2(
+    rocblas_handle handle, int n, const rocblas_double_complex* x, int incx, double* result)
+{
+    return rocblas_dznrm2(handle, n, x, incx, result);
+}
+
+// nrm2_strided_batched
+inline rocblas_status rocblasCall_nrm2_strided_batched(rocblas_handle handle,
+                                                       int            n,
+                                                       const float*   x,
+                                                       int            incx,
+                                                       rocblas_stride stridex,
+                                                       int            batch_count,
+                                                       float*         result)
+{
+    return rocblas_snrm2_strided_batched(handle, n, x, incx, stridex, batch_count, result);
+}
+
+inline rocblas_status rocblasCall_nrm2_strided_batched(rocblas_handle handle,
+                                                       int            n,
+                                                       const double*  x,
+                                                       int            incx,
+                                                       rocblas_stride stridex,
+                                                       int            batch_count,
+                                                       double*        result)
+{
+    return rocblas_dnrm2_strided_batched(handle, n, x, incx, stridex, batch_count, result);
+}
+
+inline rocblas_status rocblasCall_nrm2_strided_batched(rocblas_handle               handle,
+                                                       int                          n,
+                                                       const rocblas_float_complex* x,
+                                                       int                          incx,
+                                                       rocblas_stride               stridex,
+                                                       int                          batch_count,
+                                                       float*                       result)
+{
+    return rocblas_scnrm2_strided_batched(handle, n, x, incx, stridex, batch_count, result);
+}
+
+inline rocblas_status rocblasCall_nrm2_strided_batched(rocblas_handle                handle,
+                                                       int                           n,
+                                                       const rocblas_double_complex* x,
+                                                       int                           incx,
+                                                       rocblas_stride                stridex,
+                                                       int                           batch_count,
+                                                       double*                       result)
+{
+    return rocblas_dznrm2_strided_batched(handle, n, x, incx, stridex, batch_count, result);
+}
+
+// ger (unconjugated rank-1 update)
+inline rocblas_status rocblasCall_ger(rocblas_handle handle,
+                                      int            m,
+                                      int            n,
+                                      const float*   alpha,
+                                      const float*   x,
+                                      int            incx,
+                                      const float*   y,
+                                      int            incy,
+                                      float*         A,
+                                      int            lda)
+{
+    return rocblas_sger(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+inline rocblas_status rocblasCall_ger(rocblas_handle handle,
+                                      int            m,
+                                      int            n,
+                                      const double*  alpha,
+                                      const double*  x,
+                                      int            incx,
+                                      const double*  y,
+                                      int            incy,
+                                      double*        A,
+                                      int            lda)
+{
+    return rocblas_dger(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+inline rocblas_status rocblasCall_ger(rocblas_handle               handle,
+                                      int                          m,
+                                      int                          n,
+                                      const rocblas_float_complex* alpha,
+                                      const rocblas_float_complex* x,
+                                      int                          incx,
+                                      const rocblas_float_complex* y,
+                                      int                          incy,
+                                      rocblas_float_complex*       A,
+                                      int                          lda)
+{
+    return rocblas_cgeru(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+inline rocblas_status rocblasCall_ger(rocblas_handle                handle,
+                                      int                           m,
+                                      int                           n,
+                                      const rocblas_double_complex* alpha,
+                                      const rocblas_double_complex* x,
+                                      int                           incx,
+                                      const rocblas_double_complex* y,
+                                      int                           incy,
+                                      rocblas_double_complex*       A,
+                                      int                           lda)
+{
+    return rocblas_zgeru(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+// gemv
+inline rocblas_status rocblasCall_gemv(rocblas_handle    handle,
+                                       rocblas_operation trans,
+                                       int               m,
+                                       int               n,
+                                       const float*      alpha,
+                                       const float*      A,
+                                       int               lda,
+                                       const float*      x,
+                                       int               incx,
+                                       const float*      beta,
+                                       float*            y,
+                                       int               incy)
+{
+    return rocblas_sgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+inline rocblas_status rocblasCall_gemv(rocblas_handle    handle,
+                                       rocblas_operation trans,
+                                       int               m,
+                                       int               n,
+                                       const double*     alpha,
+                                       const double*     A,
+                                       int               lda,
+                                       const double*     x,
+                                       int               incx,
+                                       const double*     beta,
+                                       double*           y,
+                                       int               incy)
+{
+    return rocblas_dgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+inline rocblas_status rocblasCall_gemv(rocblas_handle               handle,
+                                       rocblas_operation            trans,
+                                       int                          m,
+                                       int                          n,
+                                       const rocblas_float_complex* alpha,
+                                       const rocblas_float_complex* A,
+                                       int                          lda,
+                                       const rocblas_float_complex* x,
+                                       int                          incx,
+                                       const rocblas_float_complex* beta,
+                                       rocblas_float_complex*       y,
+                                       int                          incy)
+{
+    return rocblas_cgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+inline rocblas_status rocblasCall_gemv(rocblas_handle                handle,
+                                       rocblas_operation             trans,
+                                       int                           m,
+                                       int                           n,
+                                       const rocblas_double_complex* alpha,
+                                       const rocblas_double_complex* A,
+                                       int                           lda,
+                                       const rocblas_double_complex* x,
+                                       int                           incx,
+                                       const rocblas_double_complex* beta,
+                                       rocblas_double_complex*       y,
+                                       int                           incy)
+{
+    return rocblas_zgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+// gemm
+inline rocblas_status rocblasCall_gemm(rocblas_handle    handle,
+                                       rocblas_operation transA,
+                                       rocblas_operation transB,
+                                       int               m,
+                                       int               n,
+                                       int               k,
+                                       const float*      alpha,
+                                       const float*      A,
+                                       int               lda,
+                                       const float*      B,
+                                       int               ldb,
+                                       const float*      beta,
+                                       float*            C,
+                                       int               ldc)
+{
+    return rocblas_sgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+inline rocblas_status rocblasCall_gemm(rocblas_handle    handle,
+                                       rocblas_operation transA,
+                                       rocblas_operation transB,
+                                       int               m,
+                                       int               n,
+                                       int               k,
+                                       const double*     alpha,
+                                       const double*     A,
+                                       int               lda,
+                                       const double*     B,
+                                       int               ldb,
+                                       const double*     beta,
+                                       double*           C,
+                                       int               ldc)
+{
+    return rocblas_dgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+inline rocblas_status rocblasCall_gemm(rocblas_handle               handle,
+                                       rocblas_operation            transA,
+                                       rocblas_operation            transB,
+                                       int                          m,
+                                       int                          n,
+                                       int                          k,
+                                       const rocblas_float_complex* alpha,
+                                       const rocblas_float_complex* A,
+                                       int                          lda,
+                                       const rocblas_float_complex* B,
+                                       int                          ldb,
+                                       const rocblas_float_complex* beta,
+                                       rocblas_float_complex*       C,
+                                       int                          ldc)
+{
+    return rocblas_cgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+inline rocblas_status rocblasCall_gemm(rocblas_handle                handle,
+                                       rocblas_operation             transA,
+                                       rocblas_operation             transB,
+                                       int                           m,
+                                       int                           n,
+                                       int                           k,
+                                       const rocblas_double_complex* alpha,
+                                       const rocblas_double_complex* A,
+                                       int                           lda,
+                                       const rocblas_double_complex* B,
+                                       int                           ldb,
+                                       const rocblas_double_complex* beta,
+                                       rocblas_double_complex*       C,
+                                       int                           ldc)
+{
+    return rocblas_zgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+// gemm_strided_batched
+inline rocblas_status rocblasCall_gemm_strided_batched(rocblas_handle    handle,
+                                                       rocblas_operation transA,
+                                                       rocblas_operation transB,
+                                                       int               m,
+                                                       int               n,
+                                                       int               k,
+                                                       const float*      alpha,
+                                                       const float*      A,
+                                                       int               lda,
+                                                       rocblas_stride    strideA,
+                                                       const float*      B,
+                                                       int               ldb,
+                                                       rocblas_stride    strideB,
+                                                       const float*      beta,
+                                                       float*            C,
+                                                       int               ldc,
+                                                       rocblas_stride    strideC,
+                                                       int               batch_count)
+{
+    return rocblas_sgemm_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status rocblasCall_gemm_strided_batched(rocblas_handle    handle,
+                                                       rocblas_operation transA,
+                                                       rocblas_operation transB,
+                                                       int               m,
+                                                       int               n,
+                                                       int               k,
+                                                       const double*     alpha,
+                                                       const double*     A,
+                                                       int               lda,
+                                                       rocblas_stride    strideA,
+                                                       const double*     B,
+                                                       int               ldb,
+                                                       rocblas_stride    strideB,
+                                                       const double*     beta,
+                                                       double*           C,
+                                                       int               ldc,
+                                                       rocblas_stride    strideC,
+                                                       int               batch_count)
+{
+    return rocblas_dgemm_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status rocblasCall_gemm_strided_batched(rocblas_handle               handle,
+                                                       rocblas_operation            transA,
+                                                       rocblas_operation            transB,
+                                                       int                          m,
+                                                       int                          n,
+                                                       int                          k,
+                                                       const rocblas_float_complex* alpha,
+                                                       const rocblas_float_complex* A,
+                                                       int                          lda,
+                                                       rocblas_stride               strideA,
+                                                       const rocblas_float_complex* B,
+                                                       int                          ldb,
+                                                       rocblas_stride               strideB,
+                                                       const rocblas_float_complex* beta,
+                                                       rocblas_float_complex*       C,
+                                                       int                          ldc,
+                                                       rocblas_stride               strideC,
+                                                       int                          batch_count)
+{
+    return rocblas_cgemm_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status rocblasCall_gemm_strided_batched(rocblas_handle                handle,
+                                                       rocblas_operation             transA,
+                                                       rocblas_operation             transB,
+                                                       int                           m,
+                                                       int                           n,
+                                                       int                           k,
+                                                       const rocblas_double_complex* alpha,
+                                                       const rocblas_double_complex* A,
+                                                       int                           lda,
+                                                       rocblas_stride                strideA,
+                                                       const rocblas_double_complex* B,
+                                                       int                           ldb,
+                                                       rocblas_stride                strideB,
+                                                       const rocblas_double_complex* beta,
+                                                       rocblas_double_complex*       C,
+                                                       int                           ldc,
+                                                       rocblas_stride                strideC,
+                                                       int                           batch_count)
+{
+    return rocblas_zgemm_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+// herk (syrk for real types)
+inline rocblas_status rocblasCall_herk(rocblas_handle    handle,
+                                       rocblas_fill      uplo,
+                                       rocblas_operation transA,
+                                       int               n,
+                                       int               k,
+                                       const float*      alpha,
+                                       const float*      A,
+                                       int               lda,
+                                       const float*      beta,
+                                       float*            C,
+                                       int               ldc)
+{
+    return rocblas_ssyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+inline rocblas_status rocblasCall_herk(rocblas_handle    handle,
+                                       rocblas_fill      uplo,
+                                       rocblas_operation transA,
+                                       int               n,
+                                       int               k,
+                                       const double*     alpha,
+                                       const double*     A,
+                                       int               lda,
+                                       const double*     beta,
+                                       double*           C,
+                                       int               ldc)
+{
+    return rocblas_dsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+inline rocblas_status rocblasCall_herk(rocblas_handle               handle,
+                                       rocblas_fill                 uplo,
+                                       rocblas_operation            transA,
+                                       int                          n,
+                                       int                          k,
+                                       const float*                 alpha,
+                                       const rocblas_float_complex* A,
+                                       int                          lda,
+                                       const float*                 beta,
+                                       rocblas_float_complex*       C,
+                                       int                          ldc)
+{
+    return rocblas_cherk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+inline rocblas_status rocblasCall_herk(rocblas_handle                handle,
+                                       rocblas_fill                  uplo,
+                                       rocblas_operation             transA,
+                                       int                           n,
+                                       int                           k,
+                                       const double*                 alpha,
+                                       const rocblas_double_complex* A,
+                                       int                           lda,
+                                       const double*                 beta,
+                                       rocblas_double_complex*       C,
+                                       int                           ldc)
+{
+    return rocblas_zherk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+// trmm
+inline rocblas_status rocblasCall_trmm(rocblas_handle    handle,
+                                       rocblas_side      side,
+                                       rocblas_fill      uplo,
+                                       rocblas_operation transA,
+                                       rocblas_diagonal  diag,
+                                       int               m,
+                                       int               n,
+                                       const float*      alpha,
+                                       const float*      A,
+                                       int               lda,
+                                       float*            B,
+                                       int               ldb)
+{
+    return rocblas_strmm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+inline rocblas_status rocblasCall_trmm(rocblas_handle    handle,
+                                       rocblas_side      side,
+                                       rocblas_fill      uplo,
+                                       rocblas_operation transA,
+                                       rocblas_diagonal  diag,
+                                       int               m,
+                                       int               n,
+                                       const double*     alpha,
+                                       const double*     A,
+                                       int               lda,
+                                       double*           B,
+                                       int               ldb)
+{
+    return rocblas_dtrmm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+inline rocblas_status rocblasCall_trmm(rocblas_handle               handle,
+                                       rocblas_side                 side,
+                                       rocblas_fill                 uplo,
+                                       rocblas_operation            transA,
+                                       rocblas_diagonal             diag,
+                                       int                          m,
+                                       int                          n,
+                                       const rocblas_float_complex* alpha,
+                                       const rocblas_float_complex* A,
+                                       int                          lda,
+                                       rocblas_float_complex*       B,
+                                       int                          ldb)
+{
+    return rocblas_ctrmm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+inline rocblas_status rocblasCall_trmm(rocblas_handle                handle,
+                                       rocblas_side                  side,
+                                       rocblas_fill                  uplo,
+                                       rocblas_operation             transA,
+                                       rocblas_diagonal              diag,
+                                       int                           m,
+                                       int                           n,
+                                       const rocblas_double_complex* alpha,
+                                       const rocblas_double_complex* A,
+                                       int                           lda,
+                                       rocblas_double_complex*       B,
+                                       int                           ldb)
+{
+    return rocblas_ztrmm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+// trmm_strided_batched
+inline rocblas_status rocblasCall_trmm_strided_batched(rocblas_handle    handle,
+                                                       rocblas_side      side,
+                                                       rocblas_fill      uplo,
+                                                       rocblas_operation transA,
+                                                       rocblas_diagonal  diag,
+                                                       int               m,
+                                                       int               n,
+                                                       const float*      alpha,
+                                                       const float*      A,
+                                                       int               lda,
+                                                       rocblas_stride    strideA,
+                                                       float*            B,
+                                                       int               ldb,
+                                                       rocblas_stride    strideB,
+                                                       int               batch_count)
+{
+    return rocblas_strmm_strided_batched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         batch_count);
+}
+
+inline rocblas_status rocblasCall_trmm_strided_batched(rocblas_handle    handle,
+                                                       rocblas_side      side,
+                                                       rocblas_fill      uplo,
+                                                       rocblas_operation transA,
+                                                       rocblas_diagonal  diag,
+                                                       int               m,
+                                                       int               n,
+                                                       const double*     alpha,
+                                                       const double*     A,
+                                                       int               lda,
+                                                       rocblas_stride    strideA,
+                                                       double*           B,
+                                                       int               ldb,
+                                                       rocblas_stride    strideB,
+                                                       int               batch_count)
+{
+    return rocblas_dtrmm_strided_batched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         batch_count);
+}
+
+inline rocblas_status rocblasCall_trmm_strided_batched(rocblas_handle               handle,
+                                                       rocblas_side                 side,
+                                                       rocblas_fill                 uplo,
+                                                       rocblas_operation            transA,
+                                                       rocblas_diagonal             diag,
+                                                       int                          m,
+                                                       int                          n,
+                                                       const rocblas_float_complex* alpha,
+                                                       const rocblas_float_complex* A,
+                                                       int                          lda,
+                                                       rocblas_stride               strideA,
+                                                       rocblas_float_complex*       B,
+                                                       int                          ldb,
+                                                       rocblas_stride               strideB,
+                                                       int                          batch_count)
+{
+    return rocblas_ctrmm_strided_batched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         batch_count);
+}
+
+inline rocblas_status rocblasCall_trmm_strided_batched(rocblas_handle                handle,
+                                                       rocblas_side                  side,
+                                                       rocblas_fill                  uplo,
+                                                       rocblas_operation             transA,
+                                                       rocblas_diagonal              diag,
+                                                       int                           m,
+                                                       int                           n,
+                                                       const rocblas_double_complex* alpha,
+                                                       const rocblas_double_complex* A,
+                                                       int                           lda,
+                                                       rocblas_stride                strideA,
+                                                       rocblas_double_complex*       B,
+                                                       int                           ldb,
+                                                       rocblas_stride                strideB,
+                                                       int                           batch_count)
+{
+    return rocblas_ztrmm_strided_batched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         batch_count);
+}
+
+// trsm
+inline rocblas_status rocblasCall_trsm(rocblas_handle    handle,
+                                       rocblas_side      side,
+                                       rocblas_fill      uplo,
+                                       rocblas_operation transA,
+                                       rocblas_diagonal  diag,
+                                       int               m,
+                                       int               n,
+                                       const float*      alpha,
+                                       const float*      A,
+                                       int               lda,
+                                       float*            B,
+                                       int               ldb)
+{
+    return rocblas_strsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+inline rocblas_status rocblasCall_trsm(rocblas_handle    handle,
+                                       rocblas_side      side,
+                                       rocblas_fill      uplo,
+                                       rocblas_operation transA,
+                                       rocblas_diagonal  diag,
+                                       int               m,
+                                       int               n,
+                                       const double*     alpha,
+                                       const double*     A,
+                                       int               lda,
+                                       double*           B,
+                                       int               ldb)
+{
+    return rocblas_dtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+inline rocblas_status rocblasCall_trsm(rocblas_handle               handle,
+                                       rocblas_side                 side,
+                                       rocblas_fill                 uplo,
+                                       rocblas_operation            transA,
+                                       rocblas_diagonal             diag,
+                                       int                          m,
+                                       int                          n,
+                                       const rocblas_float_complex* alpha,
+                                       const rocblas_float_complex* A,
+                                       int                          lda,
+                                       rocblas_float_complex*       B,
+                                       int                          ldb)
+{
+    return rocblas_ctrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+inline rocblas_status rocblasCall_trsm(rocblas_handle                handle,
+                                       rocblas_side                  side,
+                                       rocblas_fill                  uplo,
+                                       rocblas_operation             transA,
+                                       rocblas_diagonal              diag,
+                                       int                           m,
+                                       int                           n,
+                                       const rocblas_double_complex* alpha,
+                                       const rocblas_double_complex* A,
+                                       int                           lda,
+                                       rocblas_double_complex*       B,
+                                       int                           ldb)
+{
+    return rocblas_ztrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+// trsm_strided_batched
+inline rocblas_status rocblasCall_trsm_strided_batched(rocblas_handle    handle,
+                                                       rocblas_side      side,
+                                                       rocblas_fill      uplo,
+                                                       rocblas_operation transA,
+                                                       rocblas_diagonal  diag,
+                                                       int               m,
+                                                       int               n,
+                                                       const float*      alpha,
+                                                       const float*      A,
+                                                       int               lda,
+                                                       rocblas_stride    strideA,
+                                                       float*            B,
+                                                       int               ldb,
+                                                       rocblas_stride    strideB,
+                                                       int               batch_count)
+{
+    return rocblas_strsm_strided_batched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         batch_count);
+}
+
+inline rocblas_status rocblasCall_trsm_strided_batched(rocblas_handle    handle,
+                                                       rocblas_side      side,
+                                                       rocblas_fill      uplo,
+                                                       rocblas_operation transA,
+                                                       rocblas_diagonal  diag,
+                                                       int               m,
+                                                       int               n,
+                                                       const double*     alpha,
+                                                       const double*     A,
+                                                       int               lda,
+                                                       rocblas_stride    strideA,
+                                                       double*           B,
+                                                       int               ldb,
+                                                       rocblas_stride    strideB,
+                                                       int               batch_count)
+{
+    return rocblas_dtrsm_strided_batched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         batch_count);
+}
+
+inline rocblas_status rocblasCall_trsm_strided_batched(rocblas_handle               handle,
+                                                       rocblas_side                 side,
+                                                       rocblas_fill                 uplo,
+                                                       rocblas_operation            transA,
+                                                       rocblas_diagonal             diag,
+                                                       int                          m,
+                                                       int                          n,
+                                                       const rocblas_float_complex* alpha,
+                                                       const rocblas_float_complex* A,
+                                                       int                          lda,
+                                                       rocblas_stride               strideA,
+                                                       rocblas_float_complex*       B,
+                                                       int                          ldb,
+                                                       rocblas_stride               strideB,
+                                                       int                          batch_count)
+{
+    return rocblas_ctrsm_strided_batched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         batch_count);
+}
+
+inline rocblas_status rocblasCall_trsm_strided_batched(rocblas_handle                handle,
+                                                       rocblas_side                  side,
+                                                       rocblas_fill                  uplo,
+                                                       rocblas_operation             transA,
+                                                       rocblas_diagonal              diag,
+                                                       int                           m,
+                                                       int                           n,
+                                                       const rocblas_double_complex* alpha,
+                                                       const rocblas_double_complex* A,
+                                                       int                           lda,
+                                                       rocblas_stride                strideA,
+                                                       rocblas_double_complex*       B,
+                                                       int                           ldb,
+                                                       rocblas_stride                strideB,
+                                                       int                           batch_count)
+{
+    return rocblas_ztrsm_strided_batched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         batch_count);
+}
+
+// dgmm_strided_batched (C = diag(x) * A for side left)
+inline rocblas_status rocblasCall_dgmm_strided_batched(rocblas_handle handle,
+                                                       rocblas_side   side,
+                                                       int            m,
+                                                       int            n,
+                                                       const float*   A,
+                                                       int            lda,
+                                                       rocblas_stride strideA,
+                                                       const float*   x,
+                                                       int            incx,
+                                                       rocblas_stride stridex,
+                                                       float*         C,
+                                                       int            ldc,
+                                                       rocblas_stride strideC,
+                                                       int            batch_count)
+{
+    return rocblas_sdgmm_strided_batched(
+        handle, side, m, n, A, lda, strideA, x, incx, stridex, C, ldc, strideC, batch_count);
+}
+
+inline rocblas_status rocblasCall_dgmm_strided_batched(rocblas_handle handle,
+                                                       rocblas_side   side,
+                                                       int            m,
+                                                       int            n,
+                                                       const double*  A,
+                                                       int            lda,
+                                                       rocblas_stride strideA,
+                                                       const double*  x,
+                                                       int            incx,
+                                                       rocblas_stride stridex,
+                                                       double*        C,
+                                                       int            ldc,
+                                                       rocblas_stride strideC,
+                                                       int            batch_count)
+{
+    return rocblas_ddgmm_strided_batched(
+        handle, side, m, n, A, lda, strideA, x, incx, stridex, C, ldc, strideC, batch_count);
+}
+
+inline rocblas_status rocblasCall_dgmm_strided_batched(rocblas_handle               handle,
+                                                       rocblas_side                 side,
+                                                       int                          m,
+                                                       int                          n,
+                                                       const rocblas_float_complex* A,
+                                                       int                          lda,
+                                                       rocblas_stride               strideA,
+                                                       const rocblas_float_complex* x,
+                                                       int                          incx,
+                                                       rocblas_stride               stridex,
+                                                       rocblas_float_complex*       C,
+                                                       int                          ldc,
+                                                       rocblas_stride               strideC,
+                                                       int                          batch_count)
+{
+    return rocblas_cdgmm_strided_batched(
+        handle, side, m, n, A, lda, strideA, x, incx, stridex, C, ldc, strideC, batch_count);
+}
+
+inline rocblas_status rocblasCall_dgmm_strided_batched(rocblas_handle                handle,
+                                                       rocblas_side                  side,
+                                                       int                           m,
+                                                       int                           n,
+                                                       const rocblas_double_complex* A,
+                                                       int                           lda,
+                                                       rocblas_stride                strideA,
+                                                       const rocblas_double_complex* x,
+                                                       int                           incx,
+                                                       rocblas_stride                stridex,
+                                                       rocblas_double_complex*       C,
+                                                       int                           ldc,
+                                                       rocblas_stride                strideC,
+                                                       int                           batch_count)
+{
+    return rocblas_zdgmm_strided_batched(
+        handle, side, m, n, A, lda, strideA, x, incx, stridex, C, ldc, strideC, batch_count);
+}
@@ -0,0 +1,867 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocsolver.h"
+
+/*
+ * ===========================================================================
+ *    Type-overloaded wrappers of the rocSOLVER functions used by the routines
+ *    that hipSOLVER composes itself, in the same manner as the rocBLAS
+ *    wrappers in rocblas_templates.hpp.
+ * ===========================================================================
+ */
+
+// geqrf
+inline rocblas_status rocsolverCall_geqrf(
+    rocblas_handle handle, int m, int n, float* A, int lda, float* ipiv)
+{
+    return rocsolver_sgeqrf(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolverCall_geqrf(
+    rocblas_handle handle, int m, int n, double* A, int lda, double* ipiv)
+{
+    return rocsolver_dgeqrf(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolverCall_geqrf(rocblas_handle         handle,
+                                          int                    m,
+                                          int                    n,
+                                          rocblas_float_complex* A,
+                                          int                    lda,
+                                          rocblas_float_complex* ipiv)
+{
+    return rocsolver_cgeqrf(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolverCall_geqrf(rocblas_handle          handle,
+                                          int                     m,
+                                          int                     n,
+                                          rocblas_double_complex* A,
+                                          int                     lda,
+                                          rocblas_double_complex* ipiv)
+{
+    return rocsolver_zgeqrf(handle, m, n, A, lda, ipiv);
+}
+
+// geqrf_strided_batched
+inline rocblas_status rocsolverCall_geqrf_strided_batched(rocblas_handle handle,
+                                                          int            m,
+                                                          int            n,
+                                                          float*         A,
+                                                          int            lda,
+                                                          rocblas_stride strideA,
+                                                          float*         ipiv,
+                                                          rocblas_stride strideP,
+                                                          int            batch_count)
+{
+    return rocsolver_sgeqrf_strided_batched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, batch_count);
+}
+
+inline rocblas_status rocsolverCall_geqrf_strided_batched(rocblas_handle handle,
+                                                          int            m,
+                                                          int            n,
+                                                          double*        A,
+                                                          int            lda,
+                                                          rocblas_stride strideA,
+                                                          double*        ipiv,
+                                                          rocblas_stride strideP,
+                                                          int            batch_count)
+{
+    return rocsolver_dgeqrf_strided_batched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, batch_count);
+}
+
+inline rocblas_status rocsolverCall_geqrf_strided_batched(rocblas_handle         handle,
+                                                          int                    m,
+                                                          int                    n,
+                                                          rocblas_float_complex* A,
+                                                          int                    lda,
+                                                          rocblas_stride         strideA,
+                                                          rocblas_float_complex* ipiv,
+                                                          rocblas_stride         strideP,
+                                                          int                    batch_count)
+{
+    return rocsolver_cgeqrf_strided_batched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, batch_count);
+}
+
+inline rocblas_status rocsolverCall_geqrf_strided_batched(rocblas_handle          handle,
+                                                          int                     m,
+                                                          int                     n,
+                                                          rocblas_double_complex* A,
+                                                          int                     lda,
+                                                          rocblas_stride          strideA,
+                                                          rocblas_double_complex* ipiv,
+                                                          rocblas_stride          strideP,
+                                                          int                     batch_count)
+{
+    return rocsolver_zgeqrf_strided_batched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, batch_count);
+}
+
+// orgqr (ungqr for complex types)
+inline rocblas_status rocsolverCall_orgqr(
+    rocblas_handle handle, int m, int n, int k, float* A, int lda, float* ipiv)
+{
+    return rocsolver_sorgqr(handle, m, n, k, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolverCall_orgqr(
+    rocblas_handle handle, int m, int n, int k, double* A, int lda, double* ipiv)
+{
+    return rocsolver_dorgqr(handle, m, n, k, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolverCall_orgqr(rocblas_handle         handle,
+                                          int                    m,
+                                          int                    n,
+                                          int                    k,
+                                          rocblas_float_complex* A,
+                                          int                    lda,
+                                          rocblas_float_complex* ipiv)
+{
+    return rocsolver_cungqr(handle, m, n, k, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolverCall_orgqr(rocblas_handle          handle,
+                                          int                     m,
+                                          int                     n,
+                                          int                     k,
+                                          rocblas_double_complex* A,
+                                          int                     lda,
+                                          rocblas_double_complex* ipiv)
+{
+    return rocsolver_zungqr(handle, m, n, k, A, lda, ipiv);
+}
+
+// potrf
+inline rocblas_status rocsolverCall_potrf(
+    rocblas_handle handle, rocblas_fill uplo, int n, float* A, int lda, int* info)
+{
+    return rocsolver_spotrf(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status rocsolverCall_potrf(
+    rocblas_handle handle, rocblas_fill uplo, int n, double* A, int lda, int* info)
+{
+    return rocsolver_dpotrf(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status rocsolverCall_potrf(
+    rocblas_handle handle, rocblas_fill uplo, int n, rocblas_float_complex* A, int lda, int* info)
+{
+    return rocsolver_cpotrf(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status rocsolverCall_potrf(
+    rocblas_handle handle, rocblas_fill uplo, int n, rocblas_double_complex* A, int lda, int* info)
+{
+    return rocsolver_zpotrf(handle, uplo, n, A, lda, info);
+}
+
+// getrf
+inline rocblas_status rocsolverCall_getrf(
+    rocblas_handle handle, int m, int n, float* A, int lda, int* ipiv, int* info)
+{
+    return rocsolver_sgetrf(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolverCall_getrf(
+    rocblas_handle handle, int m, int n, double* A, int lda, int* ipiv, int* info)
+{
+    return rocsolver_dgetrf(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolverCall_getrf(
+    rocblas_handle handle, int m, int n, rocblas_float_complex* A, int lda, int* ipiv, int* info)
+{
+    return rocsolver_cgetrf(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolverCall_getrf(
+    rocblas_handle handle, int m, int n, rocblas_double_complex* A, int lda, int* ipiv, int* info)
+{
+    return rocsolver_zgetrf(handle, m, n, A, lda, ipiv, info);
+}
+
+// getrf_npvt
+inline rocblas_status rocsolverCall_getrf_npvt(
+    rocblas_handle handle, int m, int n, float* A, int lda, int* info)
+{
+    return rocsolver_sgetrf_npvt(handle, m, n, A, lda, info);
+}
+
+inline rocblas_status rocsolverCall_getrf_npvt(
+    rocblas_handle handle, int m, int n, double* A, int lda, int* info)
+{
+    return rocsolver_dgetrf_npvt(handle, m, n, A, lda, info);
+}
+
+inline rocblas_status rocsolverCall_getrf_npvt(
+    rocblas_handle handle, int m, int n, rocblas_float_complex* A, int lda, int* info)
+{
+    return rocsolver_cgetrf_npvt(handle, m, n, A, lda, info);
+}
+
+inline rocblas_status rocsolverCall_getrf_npvt(
+    rocblas_handle handle, int m, int n, rocblas_double_complex* A, int lda, int* info)
+{
+    return rocsolver_zgetrf_npvt(handle, m, n, A, lda, info);
+}
+
+// getrs
+inline rocblas_status rocsolverCall_getrs(rocblas_handle    handle,
+                                          rocblas_operation trans,
+                                          int               n,
+                                          int               nrhs,
+                                          float*            A,
+                                          int               lda,
+                                          const int*        ipiv,
+                                          float*            B,
+                                          int               ldb)
+{
+    return rocsolver_sgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolverCall_getrs(rocblas_handle    handle,
+                                          rocblas_operation trans,
+                                          int               n,
+                                          int               nrhs,
+                                          double*           A,
+                                          int               lda,
+                                          const int*        ipiv,
+                                          double*           B,
+                                          int               ldb)
+{
+    return rocsolver_dgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolverCall_getrs(rocblas_handle         handle,
+                                          rocblas_operation      trans,
+                                          int                    n,
+                                          int                    nrhs,
+                                          rocblas_float_complex* A,
+                                          int                    lda,
+                                          const int*             ipiv,
+                                          rocblas_float_complex* B,
+                                          int                    ldb)
+{
+    return rocsolver_cgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolverCall_getrs(rocblas_handle          handle,
+                                          rocblas_operation       trans,
+                                          int                     n,
+                                          int                     nrhs,
+                                          rocblas_double_complex* A,
+                                          int                     lda,
+                                          const int*              ipiv,
+                                          rocblas_double_complex* B,
+                                          int                     ldb)
+{
+    return rocsolver_zgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+// getrf_strided_batched
+inline rocblas_status rocsolverCall_getrf_strided_batched(rocblas_handle handle,
+                                                          int            m,
+                                                          int            n,
+                                                          float*         A,
+                                                          int            lda,
+                                                          rocblas_stride strideA,
+                                                          int*           ipiv,
+                                                          rocblas_stride strideP,
+                                                          int*           info,
+                                                          int            batch_count)
+{
+    return rocsolver_sgetrf_strided_batched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batch_count);
+}
+
+inline rocblas_status rocsolverCall_getrf_strided_batched(rocblas_handle handle,
+                                                          int            m,
+                                                          int            n,
+                                                          double*        A,
+                                                          int            lda,
+                                                          rocblas_stride strideA,
+                                                          int*           ipiv,
+                                                          rocblas_stride strideP,
+                                                          int*           info,
+                                                          int            batch_count)
+{
+    return rocsolver_dgetrf_strided_batched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batch_count);
+}
+
+inline rocblas_status rocsolverCall_getrf_strided_batched(rocblas_handle         handle,
+                                                          int                    m,
+                                                          int                    n,
+                                                          rocblas_float_complex* A,
+                                                          int                    lda,
+                                                          rocblas_stride         strideA,
+                                                          int*                   ipiv,
+                                                          rocblas_stride         strideP,
+                                                          int*                   info,
+                                                          int                    batch_count)
+{
+    return rocsolver_cgetrf_strided_batched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batch_count);
+}
+
+inline rocblas_status rocsolverCall_getrf_strided_batched(rocblas_handle          handle,
+                                                          int                     m,
+                                                          int                     n,
+                                                          rocblas_double_complex* A,
+                                                          int                     lda,
+                                                          rocblas_stride          strideA,
+                                                          int*                    ipiv,
+                                                          rocblas_stride          strideP,
+                                                          int*                    info,
+                                                          int                     batch_count)
+{
+    return rocsolver_zgetrf_strided_batched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batch_count);
+}
+
+// getrs_strided_batched
+inline rocblas_status rocsolverCall_getrs_strided_batched(rocblas_handle    handle,
+                                                          rocblas_operation trans,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          float*            A,
+                                                          int               lda,
+                                                          rocblas_stride    strideA,
+                                                          const int*        ipiv,
+                                                          rocblas_stride    strideP,
+                                                          float*            B,
+                                                          int               ldb,
+                                                          rocblas_stride    strideB,
+                                                          int               batch_count)
+{
+    return rocsolver_sgetrs_strided_batched(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, batch_count);
+}
+
+inline rocblas_status rocsolverCall_getrs_strided_batched(rocblas_handle    handle,
+                                                          rocblas_operation trans,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          double*           A,
+                                                          int               lda,
+                                                          rocblas_stride    strideA,
+                                                          const int*        ipiv,
+                                                          rocblas_stride    strideP,
+                                                          double*           B,
+                                                          int               ldb,
+                                                          rocblas_stride    strideB,
+                                                          int               batch_count)
+{
+    return rocsolver_dgetrs_strided_batched(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, batch_count);
+}
+
+inline rocblas_status rocsolverCall_getrs_strided_batched(rocblas_handle         handle,
+                                                          rocblas_operation      trans,
+                                                          int                    n,
+                                                          int                    nrhs,
+                                                          rocblas_float_complex* A,
+                                                          int                    lda,
+                                                          rocblas_stride         strideA,
+                                                          const int*             ipiv,
+                                                          rocblas_stride         strideP,
+                                                          rocblas_float_complex* B,
+                                                          int                    ldb,
+                                                          rocblas_stride         strideB,
+                                                          int                    batch_count)
+{
+    return rocsolver_cgetrs_strided_batched(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, batch_count);
+}
+
+inline rocblas_status rocsolverCall_getrs_strided_batched(rocblas_handle          handle,
+                                                          rocblas_operation       trans,
+                                                          int                     n,
+                                                          int                     nrhs,
+                                                          rocblas_double_complex* A,
+                                                          int                     lda,
+                                                          rocblas_stride          strideA,
+                                                          const int*              ipiv,
+                                                          rocblas_stride          strideP,
+                                                          rocblas_double_complex* B,
+                                                          int                     ldb,
+                                                          rocblas_stride          strideB,
+                                                          int                     batch_count)
+{
+    return rocsolver_zgetrs_strided_batched(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, batch_count);
+}
+
+// laswp
+inline rocblas_status rocsolverCall_laswp(
+    rocblas_handle handle, int n, float* A, int lda, int k1, int k2, const int* ipiv, int incx)
+{
+    return rocsolver_slaswp(handle, n, A, lda, k1, k2, ipiv, incx);
+}
+
+inline rocblas_status rocsolverCall_laswp(
+    rocblas_handle handle, int n, double* A, int lda, int k1, int k2, const int* ipiv, int incx)
+{
+    return rocsolver_dlaswp(handle, n, A, lda, k1, k2, ipiv, incx);
+}
+
+inline rocblas_status rocsolverCall_laswp(rocblas_handle         handle,
+                                          int                    n,
+                                          rocblas_float_complex* A,
+                                          int                    lda,
+                                          int                    k1,
+                                          int                    k2,
+                                          const int*             ipiv,
+                                          int                    incx)
+{
+    return rocsolver_claswp(handle, n, A, lda, k1, k2, ipiv, incx);
+}
+
+inline rocblas_status rocsolverCall_laswp(rocblas_handle          handle,
+                                          int                     n,
+                                          rocblas_double_complex* A,
+                                          int                     lda,
+                                          int                     k1,
+                                          int                     k2,
+                                          const int*              ipiv,
+                                          int                     incx)
+{
+    return rocsolver_zlaswp(handle, n, A, lda, k1, k2, ipiv, incx);
+}
+
+// larfg
+inline rocblas_status rocsolverCall_larfg(
+    rocblas_handle handle, int n, float* alpha, float* x, int incx, float* tau)
+{
+    return rocsolver_slarfg(handle, n, alpha, x, incx, tau);
+}
+
+inline rocblas_status rocsolverCall_larfg(
+    rocblas_handle handle, int n, double* alpha, double* x, int incx, double* tau)
+{
+    return rocsolver_dlarfg(handle, n, alpha, x, incx, tau);
+}
+
+inline rocblas_status rocsolverCall_larfg(rocblas_handle         handle,
+                                          int                    n,
+                                          rocblas_float_complex* alpha,
+                                          rocblas_float_complex* x,
+                                          int                    incx,
+                                          rocblas_float_complex* tau)
+{
+    return rocsolver_clarfg(handle, n, alpha, x, incx, tau);
+}
+
+inline rocblas_status rocsolverCall_larfg(rocblas_handle          handle,
+                                          int                     n,
+                                          rocblas_double_complex* alpha,
+                                          rocblas_double_complex* x,
+                                          int                     incx,
+                                          rocblas_double_complex* tau)
+{
+    return rocsolver_zlarfg(handle, n, alpha, x, incx, tau);
+}
+
+// larft
+inline rocblas_status rocsolverCall_larft(rocblas_handle handle,
+                                          rocblas_direct direct,
+                                          rocblas_storev storev,
+                                          int            n,
+                                          int            k,
+                                          float*         V,
+                                          int            ldv,
+                                          float*         tau,
+                                          float*         T,
+                                          int            ldt)
+{
+    return rocsolver_slarft(handle, direct, storev, n, k, V, ldv, tau, T, ldt);
+}
+
+inline rocblas_status rocsolverCall_larft(rocblas_handle handle,
+                                          rocblas_direct direct,
+                                          rocblas_storev storev,
+                                          int            n,
+                                          int            k,
+                                          double*        V,
+                                          int            ldv,
+                                          double*        tau,
+                                          double*        T,
+                                          int            ldt)
+{
+    return rocsolver_dlarft(handle, direct, storev, n, k, V, ldv, tau, T, ldt);
+}
+
+inline rocblas_status rocsolverCall_larft(rocblas_handle         handle,
+                                          rocblas_direct         direct,
+                                          rocblas_storev         storev,
+                                          int                    n,
+                                          int                    k,
+                                          rocblas_float_complex* V,
+                                          int                    ldv,
+                                          rocblas_float_complex* tau,
+                                          rocblas_float_complex* T,
+                                          int                    ldt)
+{
+    return rocsolver_clarft(handle, direct, storev, n, k, V, ldv, tau, T, ldt);
+}
+
+inline rocblas_status rocsolverCall_larft(rocblas_handle          handle,
+                                          rocblas_direct          direct,
+                                          rocblas_storev          storev,
+                                          int                     n,
+                                          int                     k,
+                                          rocblas_double_complex* V,
+                                          int                     ldv,
+                                          rocblas_double_complex* tau,
+                                          rocblas_double_complex* T,
+                                          int                     ldt)
+{
+    return rocsolver_zlarft(handle, direct, storev, n, k, V, ldv, tau, T, ldt);
+}
+
+// larfb
+inline rocblas_status rocsolverCall_larfb(rocblas_handle    handle,
+                                          rocblas_side      side,
+                                          rocblas_operation trans,
+                                          rocblas_direct    direct,
+                                          rocblas_storev    storev,
+                                          int               m,
+                                          int               n,
+                                          int               k,
+                                          float*            V,
+                                          int               ldv,
+                                          float*            T,
+                                          int               ldt,
+                                          float*            A,
+                                          int               lda)
+{
+    return rocsolver_slarfb(handle, side, trans, direct, storev, m, n, k, V, ldv, T, ldt, A, lda);
+}
+
+inline rocblas_status rocsolverCall_larfb(rocblas_handle    handle,
+                                          rocblas_side      side,
+                                          rocblas_operation trans,
+                                          rocblas_direct    direct,
+                                          rocblas_storev    storev,
+                                          int               m,
+                                          int               n,
+                                          int               k,
+                                          double*           V,
+                                          int               ldv,
+                                          double*           T,
+                                          int               ldt,
+                                          double*           A,
+                                          int               lda)
+{
+    return rocsolver_dlarfb(handle, side, trans, direct, storev, m, n, k, V, ldv, T, ldt, A, lda);
+}
+
+inline rocblas_status rocsolverCall_larfb(rocblas_handle         handle,
+                                          rocblas_side           side,
+                                          rocblas_operation      trans,
+                                          rocblas_direct         direct,
+                                          rocblas_storev         storev,
+                                          int                    m,
+                                          int                    n,
+                                          int                    k,
+                                          rocblas_float_complex* V,
+                                          int                    ldv,
+                                          rocblas_float_complex* T,
+                                          int                    ldt,
+                                          rocblas_float_complex* A,
+                                          int                    lda)
+{
+    return rocsolver_clarfb(handle, side, trans, direct, storev, m, n, k, V, ldv, T, ldt, A, lda);
+}
+
+inline rocblas_status rocsolverCall_larfb(rocblas_handle          handle,
+                                          rocblas_side            side,
+                                          rocblas_operation       trans,
+                                          rocblas_direct          direct,
+                                          rocblas_storev          storev,
+                                          int                     m,
+                                          int                     n,
+                                          int                     k,
+                                          rocblas_double_complex* V,
+                                          int                     ldv,
+                                          rocblas_double_complex* T,
+                                          int                     ldt,
+                                          rocblas_double_complex* A,
+                                          int                     lda)
+{
+    return rocsolver_zlarfb(handle, side, trans, direct, storev, m, n, k, V, ldv, T, ldt, A, lda);
+}
+
+// potrf_batched
+inline rocblas_status rocsolverCall_potrf_batched(rocblas_handle handle,
+                                                  rocblas_fill   uplo,
+                                                  int            n,
+                                                  float* const   A[],
+                                                  int            lda,
+                                                  int*           info,
+                                                  int            batch_count)
+{
+    return rocsolver_spotrf_batched(handle, uplo, n, A, lda, info, batch_count);
+}
+
+inline rocblas_status rocsolverCall_potrf_batched(rocblas_handle handle,
+                                                  rocblas_fill   uplo,
+                                                  int            n,
+                                                  double* const  A[],
+                                                  int            lda,
+                                                  int*           info,
+                                                  int            batch_count)
+{
+    return rocsolver_dpotrf_batched(handle, uplo, n, A, lda, info, batch_count);
+}
+
+inline rocblas_status rocsolverCall_potrf_batched(rocblas_handle               handle,
+                                                  rocblas_fill                 uplo,
+                                                  int                          n,
+                                                  rocblas_float_complex* const A[],
+                                                  int                          lda,
+                                                  int*                         info,
+                                                  int                          batch_count)
+{
+    return rocsolver_cpotrf_batched(handle, uplo, n, A, lda, info, batch_count);
+}
+
+inline rocblas_status rocsolverCall_potrf_batched(rocblas_handle                handle,
+                                                  rocblas_fill                  uplo,
+                                                  int                           n,
+                                                  rocblas_double_complex* const A[],
+                                                  int                           lda,
+                                                  int*                          info,
+                                                  int                           batch_count)
+{
+    return rocsolver_zpotrf_batched(handle, uplo, n, A, lda, info, batch_count);
+}
+
+// potrf_strided_batched
+inline rocblas_status rocsolverCall_potrf_strided_batched(rocblas_handle handle,
+                                                          rocblas_fill   uplo,
+                                                          int            n,
+                                                          float*         A,
+                                                          int            lda,
+                                                          rocblas_stride strideA,
+                                                          int*           info,
+                                                          int            batch_count)
+{
+    return rocsolver_spotrf_strided_batched(handle, uplo, n, A, lda, strideA, info, batch_count);
+}
+
+inline rocblas_status rocsolverCall_potrf_strided_batched(rocblas_handle handle,
+                                                          rocblas_fill   uplo,
+                                                          int            n,
+                                                          double*        A,
+                                                          int            lda,
+                                                          rocblas_stride strideA,
+                                                          int*           info,
+                                                          int            batch_count)
+{
+    return rocsolver_dpotrf_strided_batched(handle, uplo, n, A, lda, strideA, info, batch_count);
+}
+
+inline rocblas_status rocsolverCall_potrf_strided_batched(rocblas_handle         handle,
+                                                          rocblas_fill           uplo,
+                                                          int                    n,
+                                                          rocblas_float_complex* A,
+                                                          int                    lda,
+                                                          rocblas_stride         strideA,
+                                                          int*                   info,
+                                                          int                    batch_count)
+{
+    return rocsolver_cpotrf_strided_batched(handle, uplo, n, A, lda, strideA, info, batch_count);
+}
+
+inline rocblas_status rocsolverCall_potrf_strided_batched(rocblas_handle          handle,
+                                                          rocblas_fill            uplo,
+                                                          int                     n,
+                                                          rocblas_double_complex* A,
+                                                          int                     lda,
+                                                          rocblas_stride          strideA,
+                                                          int*                    info,
+                                                          int                     batch_count)
+{
+    return rocsolver_zpotrf_strided_batched(handle, uplo, n, A, lda, strideA, info, batch_count);
+}
+
+// potrs_batched
+inline rocblas_status rocsolverCall_potrs_batched(rocblas_handle handle,
+                                                  rocblas_fill   uplo,
+                                                  int            n,
+                                                  int            nrhs,
+                                                  float* const   A[],
+                                                  int            lda,
+                                                  float* const   B[],
+                                                  int            ldb,
+                                                  int            batch_count)
+{
+    return rocsolver_spotrs_batched(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
+}
+
+inline rocblas_status rocsolverCall_potrs_batched(rocblas_handle handle,
+                                                  rocblas_fill   uplo,
+                                                  int            n,
+                                                  int            nrhs,
+                                                  double* const  A[],
+                                                  int            lda,
+                                                  double* const  B[],
+                                                  int            ldb,
+                                                  int            batch_count)
+{
+    return rocsolver_dpotrs_batched(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
+}
+
+inline rocblas_status rocsolverCall_potrs_batched(rocblas_handle               handle,
+                                                  rocblas_fill                 uplo,
+                                                  int                          n,
+                                                  int                          nrhs,
+                                                  rocblas_float_complex* const A[],
+                                                  int                          lda,
+                                                  rocblas_float_complex* const B[],
+                                                  int                          ldb,
+                                                  int                          batch_count)
+{
+    return rocsolver_cpotrs_batched(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
+}
+
+inline rocblas_status rocsolverCall_potrs_batched(rocblas_handle                handle,
+                                                  rocblas_fill                  uplo,
+                                                  int                           n,
+                                                  int                           nrhs,
+                                                  rocblas_double_complex* const A[],
+                                                  int                           lda,
+                                                  rocblas_double_complex* const B[],
+                                                  int                           ldb,
+                                                  int                           batch_count)
+{
+    return rocsolver_zpotrs_batched(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
+}
+
+// syevd/heevd
+inline rocblas_status rocsolverCall_syevd(rocblas_handle handle,
+                                          rocblas_evect  evect,
+                                          rocblas_fill   uplo,
+                                          int            n,
+                                          float*         A,
+                                          int            lda,
+                                          float*         D,
+                                          float*         E,
+                                          int*           info)
+{
+    return rocsolver_ssyevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status rocsolverCall_syevd(rocblas_handle handle,
+                                          rocblas_evect  evect,
+                                          rocblas_fill   uplo,
+                                          int            n,
+                                          double*        A,
+                                          int            lda,
+                                          double*        D,
+                                          double*        E,
+                                          int*           info)
+{
+    return rocsolver_dsyevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status rocsolverCall_syevd(rocblas_handle         handle,
+                                          rocblas_evect          evect,
+                                          rocblas_fill           uplo,
+                                          int                    n,
+                                          rocblas_float_complex* A,
+                                          int                    lda,
+                                          float*                 D,
+                                          float*                 E,
+                                          int*                   info)
+{
+    return rocsolver_cheevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status rocsolverCall_syevd(rocblas_handle          handle,
+                                          rocblas_evect           evect,
+                                          rocblas_fill            uplo,
+                                          int                     n,
+                                          rocblas_double_complex* A,
+                                          int                     lda,
+                                          double*                 D,
+                                          double*                 E,
+                                          int*                    info)
+{
+    return rocsolver_zheevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+// sygvd/hegvd
+inline rocblas_status rocsolverCall_sygvd(rocblas_handle handle,
+                                          rocblas_eform  itype,
+                                          rocblas_evect  evect,
+                                          rocblas_fill   uplo,
+                                          int            n,
+                                          float*         A,
+                                          int            lda,
+                                          float*         B,
+                                          int            ldb,
+                                          float*         D,
+                                          float*         E,
+                                          int*           info)
+{
+    return rocsolver_ssygvd(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+inline rocblas_status rocsolverCall_sygvd(rocblas_handle handle,
+                                          rocblas_eform  itype,
+                                          rocblas_evect  evect,
+                                          rocblas_fill   uplo,
+                                          int            n,
+                                          double*        A,
+                                          int            lda,
+                                          double*        B,
+                                          int            ldb,
+                                          double*        D,
+                                          double*        E,
+                                          int*           info)
+{
+    return rocsolver_dsygvd(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+inline rocblas_status rocsolverCall_sygvd(rocblas_handle         handle,
+                                          rocblas_eform          itype,
+                                          rocblas_evect          evect,
+                                          rocblas_fill           uplo,
+                                          int                    n,
+                                          rocblas_float_complex* A,
+                                          int                    lda,
+                                          rocblas_float_complex* B,
+                                          int                    ldb,
+                                          float*                 D,
+                                          float*                 E,
+                                          int*                   info)
+{
+    return rocsolver_chegvd(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+inline rocblas_status rocsolverCall_sygvd(rocblas_handle          handle,
+                                          rocblas_eform           itype,
+                                          rocblas_evect           evect,
+                                          rocblas_fill            uplo,
+                                          int                     n,
+                                          rocblas_double_complex* A,
+                                          int                     lda,
+                                          rocblas_double_complex* B,
+                                          int                     ldb,
+                                          double*                 D,
+                                          double*                 E,
+                                          int*                    info)
+{
+    return rocsolver_zhegvd(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+}
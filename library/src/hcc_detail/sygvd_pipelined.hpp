@@ -0,0 +1,191 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_templates.hpp"
+#include "rocsolver_templates.hpp"
+#include "tile_device.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <memory>
+
+/*
+ * ===========================================================================
+ *    Pipelined sygvd/hegvd of batch_count independent problems. Each problem
+ *    goes through potrf(B), the reduction to standard form, syevd and the
+ *    back-transformation in a single rocSOLVER call, so the problems are
+ *    distributed round-robin over a small pool of streams, those of the tile
+ *    workers of the handle: the stages of consecutive problems then overlap
+ *    on the device instead of running one after the other. The streams of
+ *    the pool wait for the handle's stream before the first problem, and the
+ *    handle's stream waits for all of them after the last one, so the
+ *    function behaves as if it ran on the handle's stream and does not
+ *    synchronize. Each stream has its own lane of the workspace, with the
+ *    off-diagonal array E followed by the device memory of rocSOLVER.
+ * ===========================================================================
+ */
+
+// maximum number of streams over which the problems are distributed
+#define HIPSOLVER_PIPELINE_STREAMS 4
+
+// number of streams used for batch_count problems
+inline int hipsolver_pipeline_streams(int batch_count)
+{
+    return std::max(1, std::min(HIPSOLVER_PIPELINE_STREAMS, batch_count));
+}
+
+// the lanes of the workspace are aligned to 256 bytes
+inline size_t hipsolver_pipeline_align(size_t size)
+{
+    return (size + 255) / 256 * 256;
+}
+
+inline rocblas_status hipsolver_sygvd_pipelined_argCheck(rocblas_handle handle,
+                                                         int            n,
+                                                         int            lda,
+                                                         int            ldb,
+                                                         const void*    A,
+                                                         const void*    B,
+                                                         const void*    D,
+                                                         int*           info,
+                                                         int            batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(n < 0 || lda < std::max(1, n) || ldb < std::max(1, n) || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if((n && batch_count && (!A || !B || !D)) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_sygvd_pipelined_bufferSize_template(rocblas_handle handle,
+                                                             rocblas_eform  itype,
+                                                             rocblas_evect  evect,
+                                                             rocblas_fill   uplo,
+                                                             int            n,
+                                                             int            lda,
+                                                             int            ldb,
+                                                             int            batch_count,
+                                                             size_t*        size)
+{
+    using S = decltype(std::abs(T(0)));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    *size = 0;
+    if(n == 0 || batch_count <= 0)
+        return rocblas_status_success;
+
+    // the worker handles require as much device memory as the handle itself
+    size_t internal_size;
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_status status = rocsolverCall_sygvd(handle,
+                                                itype,
+                                                evect,
+                                                uplo,
+                                                n,
+                                                (T*)nullptr,
+                                                lda,
+                                                (T*)nullptr,
+                                                ldb,
+                                                (S*)nullptr,
+                                                (S*)nullptr,
+                                                (int*)nullptr);
+    rocblas_stop_device_memory_size_query(handle, &internal_size);
+
+    if(status != rocblas_status_success && status != rocblas_status_size_unchanged
+       && status != rocblas_status_size_increased)
+        return status;
+
+    size_t size_lane
+        = hipsolver_pipeline_align(sizeof(S) * n) + hipsolver_pipeline_align(internal_size);
+    *size = size_lane * hipsolver_pipeline_streams(batch_count);
+    return rocblas_status_success;
+}
+
+/* The problems are stored one after the other: problem b is in
+   A + b * lda * n, B + b * ldb * n and D + b * n, and its info in info[b]. */
+template <typename T, typename S>
+rocblas_status hipsolver_sygvd_pipelined_template(rocblas_handle handle,
+                                                  rocblas_eform  itype,
+                                                  rocblas_evect  evect,
+                                                  rocblas_fill   uplo,
+                                                  int            n,
+                                                  T*             A,
+                                                  int            lda,
+                                                  T*             B,
+                                                  int            ldb,
+                                                  S*             D,
+                                                  int*           info,
+                                                  int            batch_count,
+                                                  void*          work,
+                                                  size_t         size_work)
+{
+    ROCBLAS_RETURN_IF_ERROR(
+        hipsolver_sygvd_pipelined_argCheck(handle, n, lda, ldb, A, B, D, info, batch_count));
+
+    hipStream_t stream;
+    ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle, &stream));
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+    if(n == 0)
+    {
+        HIP_RETURN_IF_ERROR(hipMemsetAsync(info, 0, sizeof(int) * batch_count, stream));
+        return rocblas_status_success;
+    }
+
+    int    nstreams  = hipsolver_pipeline_streams(batch_count);
+    size_t size_lane = size_work / nstreams / 256 * 256;
+    size_t size_E    = hipsolver_pipeline_align(sizeof(S) * n);
+    if(!work || size_lane < size_E)
+        return rocblas_status_memory_error;
+
+    std::shared_ptr<hipsolver_tile_workers> workers = hipsolver_get_tile_workers(handle);
+    ROCBLAS_RETURN_IF_ERROR(workers->reserve(nstreams, nstreams + 1));
+
+    // the pool waits for the work already enqueued on the handle's stream
+    hipEvent_t fork = workers->events[nstreams];
+    HIP_RETURN_IF_ERROR(hipEventRecord(fork, stream));
+    for(int s = 0; s < nstreams; s++)
+        HIP_RETURN_IF_ERROR(hipStreamWaitEvent(workers->streams[s], fork, 0));
+
+    auto lane = [&](int s) { return (char*)work + s * size_lane; };
+
+    rocblas_status status = rocblas_status_success;
+    for(int s = 0; s < nstreams && status == rocblas_status_success; s++)
+        status = rocblas_set_workspace(workers->handles[s], lane(s) + size_E, size_lane - size_E);
+
+    for(int b = 0; b < batch_count && status == rocblas_status_success; b++)
+    {
+        int s  = b % nstreams;
+        status = rocsolverCall_sygvd(workers->handles[s],
+                                     itype,
+                                     evect,
+                                     uplo,
+                                     n,
+                                     A + size_t(b) * lda * n,
+                                     lda,
+                                     B + size_t(b) * ldb * n,
+                                     ldb,
+                                     D + size_t(b) * n,
+                                     (S*)lane(s),
+                                     info + b);
+    }
+
+    // the handle's stream waits for the pool, even if a problem could not be enqueued
+    for(int s = 0; s < nstreams; s++)
+    {
+        rocblas_set_workspace(workers->handles[s], nullptr, 0);
+        HIP_RETURN_IF_ERROR(hipEventRecord(workers->events[s], workers->streams[s]));
+        HIP_RETURN_IF_ERROR(hipStreamWaitEvent(stream, workers->events[s], 0));
+    }
+    return status;
+}
@@ -0,0 +1,361 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_templates.hpp"
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    sytrs solves A * X = B with the Bunch-Kaufman factorization computed by
+ *    sytrf. rocSOLVER does not provide it, so the reference LAPACK algorithm
+ *    is sequenced here with rocBLAS level-1 and level-2 calls.
+ * ===========================================================================
+ */
+
+template <typename T>
+size_t hipsolver_sytrs_worksize(int n, int nrhs)
+{
+    // diagonal and off-diagonal of D, plus one row of B
+    return sizeof(T) * (2 * size_t(n) + nrhs);
+}
+
+// B(r1,:) and B(r2,:) <- inv([d1 e; e d2]) * [B(r1,:); B(r2,:)], with d1 = akm1 * e, d2 = ak * e
+template <typename T>
+rocblas_status hipsolver_sytrs_block2(
+    rocblas_handle handle, int nrhs, T e, T d1, T d2, T* B1, T* B2, int ldb, T* tmp)
+{
+    T one   = 1;
+    T akm1  = d1 / e;
+    T ak    = d2 / e;
+    T s     = one / (e * (akm1 * ak - one));
+    T s1    = ak * s;
+    T s2    = akm1 * s;
+    T minus = -s;
+
+    ROCBLAS_RETURN_IF_ERROR(rocblasCall_copy(handle, nrhs, B1, ldb, tmp, 1));
+    ROCBLAS_RETURN_IF_ERROR(rocblasCall_scal(handle, nrhs, &s1, B1, ldb));
+    ROCBLAS_RETURN_IF_ERROR(rocblasCall_axpy(handle, nrhs, &minus, B2, ldb, B1, ldb));
+    ROCBLAS_RETURN_IF_ERROR(rocblasCall_scal(handle, nrhs, &s2, B2, ldb));
+    return rocblasCall_axpy(handle, nrhs, &minus, tmp, 1, B2, ldb);
+}
+
+template <typename T>
+rocblas_status hipsolver_sytrs_argCheck(rocblas_handle handle,
+                                        rocblas_fill   uplo,
+                                        int            n,
+                                        int            nrhs,
+                                        T*             A,
+                                        int            lda,
+                                        int*           ipiv,
+                                        T*             B,
+                                        int            ldb,
+                                        int*           info)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n)
+        return rocblas_status_invalid_size;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !ipiv) || (n && nrhs && !B) || !info)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/*! \brief Solves A * X = B given the factorization of A returned by sytrf.
+
+    work must hold hipsolver_sytrs_worksize<T>(n, nrhs) bytes. The pivots and the diagonal
+    blocks of D are read back to the host, so the call synchronizes the handle's stream
+    once before the solve is enqueued.
+*/
+template <typename T>
+rocblas_status hipsolver_sytrs_template(rocblas_handle handle,
+                                        rocblas_fill   uplo,
+                                        int            n,
+                                        int            nrhs,
+                                        T*             A,
+                                        int            lda,
+                                        int*           ipiv,
+                                        T*             B,
+                                        int            ldb,
+                                        int*           info,
+                                        T*             work)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    rocblas_status status
+        = hipsolver_sytrs_argCheck(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, info);
+    if(status != rocblas_status_continue)
+        return status;
+
+    hipStream_t stream;
+    ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle, &stream));
+
+    // info is only set for consistency with the cuSOLVER backend
+    HIP_RETURN_IF_ERROR(hipMemsetAsync(info, 0, sizeof(int), stream));
+
+    // quick return
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    T* dD  = work;
+    T* dE  = work + n;
+    T* tmp = work + 2 * n;
+
+    // gather the diagonal and the off-diagonal of D and the pivots on the host
+    std::vector<T>   D(2 * n);
+    std::vector<int> piv(n);
+    T*               E = D.data() + n;
+
+    int offd = (uplo == rocblas_fill_upper) ? lda : 1;
+    ROCBLAS_RETURN_IF_ERROR(rocblasCall_copy(handle, n, A, lda + 1, dD, 1));
+    if(n > 1)
+        ROCBLAS_RETURN_IF_ERROR(rocblasCall_copy(handle, n - 1, A + offd, lda + 1, dE, 1));
+    HIP_RETURN_IF_ERROR(
+        hipMemcpyAsync(D.data(), dD, sizeof(T) * (2 * n - 1), hipMemcpyDeviceToHost, stream));
+    HIP_RETURN_IF_ERROR(
+        hipMemcpyAsync(piv.data(), ipiv, sizeof(int) * n, hipMemcpyDeviceToHost, stream));
+    HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream));
+
+    T one = 1, minone = -1;
+    T rcp;
+    int k, kp;
+
+    if(uplo == rocblas_fill_upper)
+    {
+        // solve U * D * Y = B, overwriting B with Y
+        k = n - 1;
+        while(k >= 0)
+        {
+            if(piv[k] > 0)
+            {
+                // 1 x 1 diagonal block
+                kp = piv[k] - 1;
+                if(kp != k)
+                    ROCBLAS_RETURN_IF_ERROR(
+                        rocblasCall_swap(handle, nrhs, B + k, ldb, B + kp, ldb));
+
+                if(k > 0)
+                    ROCBLAS_RETURN_IF_ERROR(rocblasCall_ger(
+                        handle, k, nrhs, &minone, A + k * lda, 1, B + k, ldb, B, ldb));
+
+                rcp = one / D[k];
+                ROCBLAS_RETURN_IF_ERROR(rocblasCall_scal(handle, nrhs, &rcp, B + k, ldb));
+                k--;
+            }
+            else
+            {
+                // 2 x 2 diagonal block
+                kp = -piv[k] - 1;
+                if(kp != k - 1)
+                    ROCBLAS_RETURN_IF_ERROR(
+                        rocblasCall_swap(handle, nrhs, B + k - 1, ldb, B + kp, ldb));
+
+                if(k > 1)
+                {
+                    ROCBLAS_RETURN_IF_ERROR(rocblasCall_ger(
+                        handle, k - 1, nrhs, &minone, A + k * lda, 1, B + k, ldb, B, ldb));
+                    ROCBLAS_RETURN_IF_ERROR(rocblasCall_ger(handle,
+                                                            k - 1,
+                                                            nrhs,
+                                                            &minone,
+                                                            A + (k - 1) * lda,
+                                                            1,
+                                                            B + k - 1,
+                                                            ldb,
+                                                            B,
+                                                            ldb));
+                }
+
+                ROCBLAS_RETURN_IF_ERROR(hipsolver_sytrs_block2(
+                    handle, nrhs, E[k - 1], D[k - 1], D[k], B + k - 1, B + k, ldb, tmp));
+                k -= 2;
+            }
+        }
+
+        // solve U**T * X = Y, overwriting B with X
+        k = 0;
+        while(k < n)
+        {
+            if(k > 0)
+                ROCBLAS_RETURN_IF_ERROR(rocblasCall_gemv(handle,
+                                                         rocblas_operation_transpose,
+                                                         k,
+                                                         nrhs,
+                                                         &minone,
+                                                         B,
+                                                         ldb,
+                                                         A + k * lda,
+                                                         1,
+                                                         &one,
+                                                         B + k,
+                                                         ldb));
+
+            if(piv[k] > 0)
+            {
+                // 1 x 1 diagonal block
+                kp = piv[k] - 1;
+                if(kp != k)
+                    ROCBLAS_RETURN_IF_ERROR(
+                        rocblasCall_swap(handle, nrhs, B + k, ldb, B + kp, ldb));
+                k++;
+            }
+            else
+            {
+                // 2 x 2 diagonal block
+                if(k > 0)
+                    ROCBLAS_RETURN_IF_ERROR(rocblasCall_gemv(handle,
+                                                             rocblas_operation_transpose,
+                                                             k,
+                                                             nrhs,
+                                                             &minone,
+                                                             B,
+                                                             ldb,
+                                                             A + (k + 1) * lda,
+                                                             1,
+                                                             &one,
+                                                             B + k + 1,
+                                                             ldb));
+
+                kp = -piv[k] - 1;
+                if(kp != k)
+                    ROCBLAS_RETURN_IF_ERROR(
+                        rocblasCall_swap(handle, nrhs, B + k, ldb, B + kp, ldb));
+                k += 2;
+            }
+        }
+    }
+    else
+    {
+        // solve L * D * Y = B, overwriting B with Y
+        k = 0;
+        while(k < n)
+        {
+            if(piv[k] > 0)
+            {
+                // 1 x 1 diagonal block
+                kp = piv[k] - 1;
+                if(kp != k)
+                    ROCBLAS_RETURN_IF_ERROR(
+                        rocblasCall_swap(handle, nrhs, B + k, ldb, B + kp, ldb));
+
+                if(k < n - 1)
+                    ROCBLAS_RETURN_IF_ERROR(rocblasCall_ger(handle,
+                                                            n - k - 1,
+                                                            nrhs,
+                                                            &minone,
+                                                            A + (k + 1) + k * lda,
+                                                            1,
+                                                            B + k,
+                                                            ldb,
+                                                            B + k + 1,
+                                                            ldb));
+
+                rcp = one / D[k];
+                ROCBLAS_RETURN_IF_ERROR(rocblasCall_scal(handle, nrhs, &rcp, B + k, ldb));
+                k++;
+            }
+            else
+            {
+                // 2 x 2 diagonal block
+                kp = -piv[k + 1] - 1;
+                if(kp != k + 1)
+                    ROCBLAS_RETURN_IF_ERROR(
+                        rocblasCall_swap(handle, nrhs, B + k + 1, ldb, B + kp, ldb));
+
+                if(k < n - 2)
+                {
+                    ROCBLAS_RETURN_IF_ERROR(rocblasCall_ger(handle,
+                                                            n - k - 2,
+                                                            nrhs,
+                                                            &minone,
+                                                            A + (k + 2) + k * lda,
+                                                            1,
+                                                            B + k,
+                                                            ldb,
+                                                            B + k + 2,
+                                                            ldb));
+                    ROCBLAS_RETURN_IF_ERROR(rocblasCall_ger(handle,
+                                                            n - k - 2,
+                                                            nrhs,
+                                                            &minone,
+                                                            A + (k + 2) + (k + 1) * lda,
+                                                            1,
+                                                            B + k + 1,
+                                                            ldb,
+                                                            B + k + 2,
+                                                            ldb));
+                }
+
+                ROCBLAS_RETURN_IF_ERROR(hipsolver_sytrs_block2(
+                    handle, nrhs, E[k], D[k], D[k + 1], B + k, B + k + 1, ldb, tmp));
+                k += 2;
+            }
+        }
+
+        // solve L**T * X = Y, overwriting B with X
+        k = n - 1;
+        while(k >= 0)
+        {
+            if(k < n - 1)
+                ROCBLAS_RETURN_IF_ERROR(rocblasCall_gemv(handle,
+                                                         rocblas_operation_transpose,
+                                                         n - k - 1,
+                                                         nrhs,
+                                                         &minone,
+                                                         B + k + 1,
+                                                         ldb,
+                                                         A + (k + 1) + k * lda,
+                                                         1,
+                                                         &one,
+                                                         B + k,
+                                                         ldb));
+
+            if(piv[k] > 0)
+            {
+                // 1 x 1 diagonal block
+                kp = piv[k] - 1;
+                if(kp != k)
+                    ROCBLAS_RETURN_IF_ERROR(
+                        rocblasCall_swap(handle, nrhs, B + k, ldb, B + kp, ldb));
+                k--;
+            }
+            else
+            {
+                // 2 x 2 diagonal block
+                if(k < n - 1)
+                    ROCBLAS_RETURN_IF_ERROR(rocblasCall_gemv(handle,
+                                                             rocblas_operation_transpose,
+                                                             n - k - 1,
+                                                             nrhs,
+                                                             &minone,
+                                                             B + k + 1,
+                                                             ldb,
+                                                             A + (k + 1) + (k - 1) * lda,
+                                                             1,
+                                                             &one,
+                                                             B + k - 1,
+                                                             ldb));
+
+                kp = -piv[k] - 1;
+                if(kp != k)
+                    ROCBLAS_RETURN_IF_ERROR(
+                        rocblasCall_swap(handle, nrhs, B + k, ldb, B + kp, ldb));
+                k -= 2;
+            }
+        }
+    }
+
+    return rocblas_status_success;
+}
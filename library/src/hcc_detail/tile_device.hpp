@@ -0,0 +1,724 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas_templates.hpp"
+#include "rocsolver_templates.hpp"
+#include "tile_scheduler.hpp"
+#include <cmath>
+#include <hip/hip_runtime_api.h>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    Tiled potrf, getrf and geqrf, enabled per handle by
+ *    hipsolverSetTileExecution. The tasks of tile_scheduler.hpp are computed
+ *    with rocBLAS and rocSOLVER: the tasks on stream 0 use the user's handle
+ *    and stream, and the other streams each have a stream and a rocBLAS handle
+ *    of their own, owned by the user's handle, so that they do not share its
+ *    device workspace. The pivots and info of the tiles are combined on the
+ *    host at the end, so the tiled functions synchronize the handle's stream.
+ * ===========================================================================
+ */
+
+enum hipsolver_tile_factorization
+{
+    hipsolver_tile_cholesky,
+    hipsolver_tile_lu,
+    hipsolver_tile_qr,
+};
+
+// streams, rocBLAS handles and events used by the tiled functions of a handle
+class hipsolver_tile_workers
+{
+public:
+    hipsolver_tile_workers()                              = default;
+    hipsolver_tile_workers(const hipsolver_tile_workers&) = delete;
+    hipsolver_tile_workers& operator=(const hipsolver_tile_workers&) = delete;
+
+    ~hipsolver_tile_workers()
+    {
+        for(rocblas_handle handle : handles)
+            rocblas_destroy_handle(handle);
+        for(hipStream_t stream : streams)
+        {
+            hipStreamSynchronize(stream);
+            hipStreamDestroy(stream);
+        }
+        for(hipEvent_t event : events)
+            hipEventDestroy(event);
+    }
+
+    // stream s + 1 of a tiled call and its rocBLAS handle
+    std::vector<hipStream_t>    streams;
+    std::vector<rocblas_handle> handles;
+    std::vector<hipEvent_t>     events;
+
+    // creates the streams, handles and events that are still missing
+    rocblas_status reserve(int nworkers, int nevents)
+    {
+        while(streams.size() < size_t(nworkers))
+        {
+            hipStream_t    stream;
+            rocblas_handle handle;
+            HIP_RETURN_IF_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+            streams.push_back(stream);
+            ROCBLAS_RETURN_IF_ERROR(rocblas_create_handle(&handle));
+            handles.push_back(handle);
+            ROCBLAS_RETURN_IF_ERROR(rocblas_set_stream(handle, stream));
+        }
+        while(events.size() < size_t(nevents))
+        {
+            hipEvent_t event;
+            HIP_RETURN_IF_ERROR(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+            events.push_back(event);
+        }
+        return rocblas_status_success;
+    }
+};
+
+// returns the workers of handle, creating them on first use
+inline std::shared_ptr<hipsolver_tile_workers> hipsolver_get_tile_workers(rocblas_handle handle)
+{
+    std::shared_ptr<hipsolver_tile_workers> workers;
+    hipsolver_update_settings(handle, [&](hipsolver_handle_settings& settings) {
+        if(!settings.tile_workers)
+            settings.tile_workers = std::make_shared<hipsolver_tile_workers>();
+        workers = settings.tile_workers;
+    });
+    return workers;
+}
+
+struct hipsolver_tile_config
+{
+    int nb        = 0; // 0 if the factorization is not tiled
+    int nstreams  = 1;
+    int lookahead = 0;
+};
+
+/* Returns the tiling of an m-by-n factorization on handle. Factorizations
+   are only tiled when enabled, when they have at least two tiles in each
+   dimension, and outside of stream capture, as they synchronize the stream. */
+inline hipsolver_tile_config hipsolver_get_tile_config(rocblas_handle handle, int m, int n)
+{
+    return hipsolver_read_settings(handle, [=](const hipsolver_handle_settings& settings) {
+        hipsolver_tile_config config;
+        if(settings.tile_streams == 0 || settings.capture_mode != HIPSOLVER_CAPTURE_MODE_DEFAULT
+           || settings.capture_query)
+            return config;
+        if(std::min(m, n) < 2 * settings.tile_blocksize)
+            return config;
+
+        config.nb        = settings.tile_blocksize;
+        config.nstreams  = settings.tile_streams;
+        config.lookahead = settings.tile_lookahead;
+        return config;
+    });
+}
+
+// number of slots for the triangular factors of the QR panels
+inline int hipsolver_tile_factor_slots(const hipsolver_tile_config& config)
+{
+    return config.lookahead + 2;
+}
+
+// device memory required by a tiled factorization, besides the workspace of rocSOLVER
+template <typename T>
+size_t hipsolver_tile_worksize(hipsolver_tile_factorization fact,
+                               const hipsolver_tile_config& config,
+                               int                          m,
+                               int                          n)
+{
+    if(config.nb == 0)
+        return 0;
+
+    // the info of every panel, or the triangular factors of the QR panels
+    if(fact == hipsolver_tile_qr)
+        return sizeof(T) * config.nb * config.nb * hipsolver_tile_factor_slots(config);
+    return sizeof(int) * ((std::min(m, n) - 1) / config.nb + 1);
+}
+
+// the conjugate transpose as accepted by rocSOLVER, which only takes the transpose for real types
+template <typename T>
+rocblas_operation hipsolver_tile_adjoint()
+{
+    return std::is_floating_point<T>::value ? rocblas_operation_transpose
+                                            : rocblas_operation_conjugate_transpose;
+}
+
+/* Device memory required from the handle by the tasks run on stream 0 of an
+   m-by-n tiled factorization. Must be called during a device memory size query. */
+template <typename T>
+rocblas_status hipsolver_tile_query(rocblas_handle               handle,
+                                    hipsolver_tile_factorization fact,
+                                    int                          m,
+                                    int                          n,
+                                    int                          lda,
+                                    const hipsolver_tile_config& config)
+{
+    using S = decltype(std::abs(T(0)));
+
+    int nb   = config.nb;
+    T   one  = 1;
+    S   rone = 1;
+
+    auto ok = [](rocblas_status status) {
+        return status == rocblas_status_success || status == rocblas_status_size_unchanged
+               || status == rocblas_status_size_increased;
+    };
+
+    rocblas_status status = rocblasCall_gemm(handle,
+                                             rocblas_operation_none,
+                                             rocblas_operation_conjugate_transpose,
+                                             nb,
+                                             nb,
+                                             nb,
+                                             &one,
+                                             (T*)nullptr,
+                                             lda,
+                                             (T*)nullptr,
+                                             lda,
+                                             &one,
+                                             (T*)nullptr,
+                                             lda);
+    if(fact == hipsolver_tile_cholesky)
+    {
+        for(rocblas_fill uplo : {rocblas_fill_upper, rocblas_fill_lower})
+        {
+            bool upper = uplo == rocblas_fill_upper;
+            if(ok(status))
+                status = rocsolverCall_potrf(handle, uplo, nb, (T*)nullptr, lda, (int*)nullptr);
+            if(ok(status))
+                status = rocblasCall_trsm(handle,
+                                          upper ? rocblas_side_left : rocblas_side_right,
+                                          uplo,
+                                          rocblas_operation_conjugate_transpose,
+                                          rocblas_diagonal_non_unit,
+                                          nb,
+                                          nb,
+                                          &one,
+                                          (T*)nullptr,
+                                          lda,
+                                          (T*)nullptr,
+                                          lda);
+            if(ok(status))
+                status = rocblasCall_herk(handle,
+                                          uplo,
+                                          upper ? rocblas_operation_conjugate_transpose
+                                                : rocblas_operation_none,
+                                          nb,
+                                          nb,
+                                          &rone,
+                                          (T*)nullptr,
+                                          lda,
+                                          &rone,
+                                          (T*)nullptr,
+                                          lda);
+        }
+    }
+    else if(fact == hipsolver_tile_lu)
+    {
+        if(ok(status))
+            status = rocsolverCall_getrf(
+                handle, m, nb, (T*)nullptr, lda, (int*)nullptr, (int*)nullptr);
+        if(ok(status))
+            status = rocsolverCall_laswp(handle, n, (T*)nullptr, lda, 1, nb, (int*)nullptr, 1);
+        if(ok(status))
+            status = rocblasCall_trsm(handle,
+                                      rocblas_side_left,
+                                      rocblas_fill_lower,
+                                      rocblas_operation_none,
+                                      rocblas_diagonal_unit,
+                                      nb,
+                                      nb,
+                                      &one,
+                                      (T*)nullptr,
+                                      lda,
+                                      (T*)nullptr,
+                                      lda);
+    }
+    else
+    {
+        if(ok(status))
+            status = rocsolverCall_geqrf(handle, m, nb, (T*)nullptr, lda, (T*)nullptr);
+        if(ok(status))
+            status = rocsolverCall_larft(handle,
+                                         rocblas_forward_direction,
+                                         rocblas_column_wise,
+                                         m,
+                                         nb,
+                                         (T*)nullptr,
+                                         lda,
+                                         (T*)nullptr,
+                                         (T*)nullptr,
+                                         nb);
+        if(ok(status))
+            status = rocsolverCall_larfb(handle,
+                                         rocblas_side_left,
+                                         hipsolver_tile_adjoint<T>(),
+                                         rocblas_forward_direction,
+                                         rocblas_column_wise,
+                                         m,
+                                         nb,
+                                         nb,
+                                         (T*)nullptr,
+                                         lda,
+                                         (T*)nullptr,
+                                         nb,
+                                         (T*)nullptr,
+                                         lda);
+    }
+
+    return ok(status) ? rocblas_status_success : status;
+}
+
+/* Backend of the tiled task engine computing the tasks on the m-by-n device
+   matrix A. ipiv, tau and factors are only used by the factorizations that
+   produce them. finish copies the info of the tiles to the host. */
+template <typename T>
+class hipsolver_tile_device
+{
+public:
+    hipsolver_tile_device(rocblas_handle               handle,
+                          hipsolver_tile_workers&      workers,
+                          hipsolver_tile_factorization fact,
+                          bool                         upper,
+                          int                          m,
+                          int                          n,
+                          int                          nb,
+                          int                          nstreams,
+                          T*                           A,
+                          int                          lda,
+                          int*                         dinfo)
+        : handle_(handle)
+        , workers_(workers)
+        , fact_(fact)
+        , upper_(upper)
+        , m_(m)
+        , n_(n)
+        , nb_(nb)
+        , nstreams_(nstreams)
+        , A_(A)
+        , lda_(lda)
+        , dinfo_(dinfo)
+    {
+    }
+
+    ~hipsolver_tile_device()
+    {
+        // operations may still be in flight if the execution stopped on an error
+        for(int s = 1; s < int(stream_.size()); s++)
+            hipStreamSynchronize(stream_[s]);
+    }
+
+    int* ipiv    = nullptr;
+    T*   tau     = nullptr;
+    T*   factors = nullptr;
+
+    std::vector<int> tile_info;
+
+    rocblas_status init(int nevents)
+    {
+        hipStream_t stream;
+        ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle_, &stream));
+        ROCBLAS_RETURN_IF_ERROR(workers_.reserve(nstreams_ - 1, nevents));
+
+        stream_.assign(1, stream);
+        handles_.assign(1, handle_);
+        for(int s = 0; s < nstreams_ - 1; s++)
+        {
+            stream_.push_back(workers_.streams[s]);
+            handles_.push_back(workers_.handles[s]);
+        }
+        return rocblas_status_success;
+    }
+
+    rocblas_status record(int stream, int event)
+    {
+        HIP_RETURN_IF_ERROR(hipEventRecord(workers_.events[event], stream_[stream]));
+        return rocblas_status_success;
+    }
+
+    rocblas_status wait(int stream, int event)
+    {
+        HIP_RETURN_IF_ERROR(hipStreamWaitEvent(stream_[stream], workers_.events[event], 0));
+        return rocblas_status_success;
+    }
+
+    rocblas_status run(int stream, const hipsolver_tile_task& task)
+    {
+        using S = decltype(std::abs(T(0)));
+
+        rocblas_handle handle = handles_[stream];
+
+        int k0 = task.k * nb_;
+        int kb = cols(task.k);
+        int kr = std::min(kb, m_ - k0);
+        T   one  = 1;
+        S   rone = 1, rminone = -1;
+
+        switch(task.kernel)
+        {
+        case hipsolver_tile_potrf:
+            return rocsolverCall_potrf(
+                handle, fill(), kb, tile(task.k, task.k), lda_, dinfo_ + task.k);
+
+        case hipsolver_tile_trsm:
+            // the upper factor holds U(k, i) = L(i, k)^H = U(k, k)^-H * A(k, i)
+            if(upper_)
+                return rocblasCall_trsm(handle,
+                                        rocblas_side_left,
+                                        rocblas_fill_upper,
+                                        rocblas_operation_conjugate_transpose,
+                                        rocblas_diagonal_non_unit,
+                                        kb,
+                                        rows(task.i),
+                                        &one,
+                                        tile(task.k, task.k),
+                                        lda_,
+                                        tile(task.k, task.i),
+                                        lda_);
+            return rocblasCall_trsm(handle,
+                                    rocblas_side_right,
+                                    rocblas_fill_lower,
+                                    rocblas_operation_conjugate_transpose,
+                                    rocblas_diagonal_non_unit,
+                                    rows(task.i),
+                                    kb,
+                                    &one,
+                                    tile(task.k, task.k),
+                                    lda_,
+                                    tile(task.i, task.k),
+                                    lda_);
+
+        case hipsolver_tile_herk:
+            return rocblasCall_herk(handle,
+                                    fill(),
+                                    upper_ ? rocblas_operation_conjugate_transpose
+                                           : rocblas_operation_none,
+                                    cols(task.j),
+                                    kb,
+                                    &rminone,
+                                    upper_ ? tile(task.k, task.j) : tile(task.j, task.k),
+                                    lda_,
+                                    &rone,
+                                    tile(task.j, task.j),
+                                    lda_);
+
+        case hipsolver_tile_gemm:
+            if(fact_ == hipsolver_tile_lu)
+                return gemm(handle,
+                            rocblas_operation_none,
+                            rocblas_operation_none,
+                            rows(task.i),
+                            cols(task.j),
+                            kb,
+                            tile(task.i, task.k),
+                            tile(task.k, task.j),
+                            tile(task.i, task.j));
+            if(upper_)
+                return gemm(handle,
+                            rocblas_operation_conjugate_transpose,
+                            rocblas_operation_none,
+                            cols(task.j),
+                            rows(task.i),
+                            kb,
+                            tile(task.k, task.j),
+                            tile(task.k, task.i),
+                            tile(task.j, task.i));
+            return gemm(handle,
+                        rocblas_operation_none,
+                        rocblas_operation_conjugate_transpose,
+                        rows(task.i),
+                        cols(task.j),
+                        kb,
+                        tile(task.i, task.k),
+                        tile(task.j, task.k),
+                        tile(task.i, task.j));
+
+        case hipsolver_tile_getrf:
+            // the pivots are relative to row k0 until hipsolver_getrf_tile_template adjusts them
+            return rocsolverCall_getrf(
+                handle, m_ - k0, kb, tile(task.k, task.k), lda_, ipiv + k0, dinfo_ + task.k);
+
+        case hipsolver_tile_swptrsm:
+            ROCBLAS_RETURN_IF_ERROR(rocsolverCall_laswp(
+                handle, cols(task.j), tile(task.k, task.j), lda_, 1, kr, ipiv + k0, 1));
+            return rocblasCall_trsm(handle,
+                                    rocblas_side_left,
+                                    rocblas_fill_lower,
+                                    rocblas_operation_none,
+                                    rocblas_diagonal_unit,
+                                    kr,
+                                    cols(task.j),
+                                    &one,
+                                    tile(task.k, task.k),
+                                    lda_,
+                                    tile(task.k, task.j),
+                                    lda_);
+
+        case hipsolver_tile_laswp:
+            return rocsolverCall_laswp(handle, k0, A_ + k0, lda_, 1, kr, ipiv + k0, 1);
+
+        case hipsolver_tile_geqrt:
+            ROCBLAS_RETURN_IF_ERROR(
+                rocsolverCall_geqrf(handle, m_ - k0, kb, tile(task.k, task.k), lda_, tau + k0));
+            return rocsolverCall_larft(handle,
+                                       rocblas_forward_direction,
+                                       rocblas_column_wise,
+                                       m_ - k0,
+                                       kr,
+                                       tile(task.k, task.k),
+                                       lda_,
+                                       tau + k0,
+                                       factor(task.t),
+                                       nb_);
+
+        case hipsolver_tile_larfb:
+            return rocsolverCall_larfb(handle,
+                                       rocblas_side_left,
+                                       hipsolver_tile_adjoint<T>(),
+                                       rocblas_forward_direction,
+                                       rocblas_column_wise,
+                                       m_ - k0,
+                                       cols(task.j),
+                                       kr,
+                                       tile(task.k, task.k),
+                                       lda_,
+                                       factor(task.t),
+                                       nb_,
+                                       tile(task.k, task.j),
+                                       lda_);
+        }
+        return rocblas_status_internal_error;
+    }
+
+    rocblas_status finish()
+    {
+        // nothing to read back without info
+        if(!dinfo_)
+            return rocblas_status_success;
+
+        tile_info.assign((std::min(m_, n_) - 1) / nb_ + 1, 0);
+        HIP_RETURN_IF_ERROR(hipMemcpyAsync(tile_info.data(),
+                                           dinfo_,
+                                           sizeof(int) * tile_info.size(),
+                                           hipMemcpyDeviceToHost,
+                                           stream_[0]));
+        HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream_[0]));
+        return rocblas_status_success;
+    }
+
+private:
+    rocblas_handle               handle_;
+    hipsolver_tile_workers&      workers_;
+    hipsolver_tile_factorization fact_;
+    bool                         upper_;
+    int                          m_;
+    int                          n_;
+    int                          nb_;
+    int                          nstreams_;
+    T*                           A_;
+    int                          lda_;
+    int*                         dinfo_;
+
+    std::vector<hipStream_t>    stream_;
+    std::vector<rocblas_handle> handles_;
+
+    int rows(int t)
+    {
+        return std::min(nb_, m_ - t * nb_);
+    }
+
+    int cols(int t)
+    {
+        return std::min(nb_, n_ - t * nb_);
+    }
+
+    T* tile(int i, int j)
+    {
+        return A_ + size_t(i) * nb_ + size_t(j) * nb_ * lda_;
+    }
+
+    T* factor(int slot)
+    {
+        return factors + size_t(slot) * nb_ * nb_;
+    }
+
+    rocblas_fill fill()
+    {
+        return upper_ ? rocblas_fill_upper : rocblas_fill_lower;
+    }
+
+    // C -= op(A) * op(B)
+    rocblas_status gemm(rocblas_handle    handle,
+                        rocblas_operation transA,
+                        rocblas_operation transB,
+                        int               m,
+                        int               n,
+                        int               k,
+                        T*                A,
+                        T*                B,
+                        T*                C)
+    {
+        T one = 1, minone = -1;
+        return rocblasCall_gemm(
+            handle, transA, transB, m, n, k, &minone, A, lda_, B, lda_, &one, C, lda_);
+    }
+};
+
+// out is the pivots of getrf, the Householder scalars of geqrf, or A for potrf
+inline rocblas_status hipsolver_tile_argCheck(
+    rocblas_handle handle, int m, int n, int lda, const void* A, const void* out)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(m < 0 || n < 0 || lda < m || lda < 1)
+        return rocblas_status_invalid_size;
+    if((m && n && !A) || (m && n && !out))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_success;
+}
+
+// runs the tasks of dag with the tiling of config
+template <typename T>
+rocblas_status hipsolver_tile_run(hipsolver_tile_device<T>&    dev,
+                                  const hipsolver_tile_dag&    dag,
+                                  const hipsolver_tile_config& config)
+{
+    hipsolver_tile_plan plan = hipsolver_tile_schedule(dag, config.nstreams, config.lookahead);
+    return hipsolver_tile_execute(dev, dag, plan);
+}
+
+// writes the first nonzero info of the tiles, offset by the first column of its tile, to info
+inline rocblas_status hipsolver_tile_info(rocblas_handle          handle,
+                                          const std::vector<int>& tile_info,
+                                          int                     nb,
+                                          int*                    info)
+{
+    hipStream_t stream;
+    ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle, &stream));
+
+    int value = 0;
+    for(size_t k = 0; k < tile_info.size() && value == 0; k++)
+        if(tile_info[k] > 0)
+            value = int(k) * nb + tile_info[k];
+
+    HIP_RETURN_IF_ERROR(hipMemcpyAsync(info, &value, sizeof(int), hipMemcpyHostToDevice, stream));
+    HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream));
+    return rocblas_status_success;
+}
+
+/* Tiled potrf. work must point to at least hipsolver_tile_worksize bytes of
+   device memory. */
+template <typename T>
+rocblas_status hipsolver_potrf_tile_template(rocblas_handle               handle,
+                                             rocblas_fill                 uplo,
+                                             int                          n,
+                                             T*                           A,
+                                             int                          lda,
+                                             int*                         info,
+                                             const hipsolver_tile_config& config,
+                                             void*                        work)
+{
+    ROCBLAS_RETURN_IF_ERROR(hipsolver_tile_argCheck(handle, n, n, lda, A, A));
+    if(!info)
+        return rocblas_status_invalid_pointer;
+
+    int                                     nb      = config.nb;
+    int                                     nt      = (n - 1) / nb + 1;
+    std::shared_ptr<hipsolver_tile_workers> workers = hipsolver_get_tile_workers(handle);
+
+    hipsolver_tile_device<T> dev(handle,
+                                 *workers,
+                                 hipsolver_tile_cholesky,
+                                 uplo == rocblas_fill_upper,
+                                 n,
+                                 n,
+                                 nb,
+                                 config.nstreams,
+                                 A,
+                                 lda,
+                                 (int*)work);
+    ROCBLAS_RETURN_IF_ERROR(hipsolver_tile_run(dev, hipsolver_potrf_tile_dag(nt), config));
+
+    return hipsolver_tile_info(handle, dev.tile_info, nb, info);
+}
+
+/* Tiled getrf with partial pivoting. work must point to at least
+   hipsolver_tile_worksize bytes of device memory. */
+template <typename T>
+rocblas_status hipsolver_getrf_tile_template(rocblas_handle               handle,
+                                             int                          m,
+                                             int                          n,
+                                             T*                           A,
+                                             int                          lda,
+                                             int*                         ipiv,
+                                             int*                         info,
+                                             const hipsolver_tile_config& config,
+                                             void*                        work)
+{
+    ROCBLAS_RETURN_IF_ERROR(hipsolver_tile_argCheck(handle, m, n, lda, A, ipiv));
+    if(!info)
+        return rocblas_status_invalid_pointer;
+
+    int                                     nb      = config.nb;
+    int                                     mn      = std::min(m, n);
+    int                                     mt      = (m - 1) / nb + 1;
+    int                                     nt      = (n - 1) / nb + 1;
+    std::shared_ptr<hipsolver_tile_workers> workers = hipsolver_get_tile_workers(handle);
+
+    hipsolver_tile_device<T> dev(
+        handle, *workers, hipsolver_tile_lu, false, m, n, nb, config.nstreams, A, lda, (int*)work);
+    dev.ipiv = ipiv;
+    ROCBLAS_RETURN_IF_ERROR(
+        hipsolver_tile_run(dev, hipsolver_getrf_tile_dag(mt, nt), config));
+
+    // the pivots of every panel are relative to its first row
+    hipStream_t stream;
+    ROCBLAS_RETURN_IF_ERROR(rocblas_get_stream(handle, &stream));
+
+    std::vector<int> hipiv(mn);
+    HIP_RETURN_IF_ERROR(
+        hipMemcpyAsync(hipiv.data(), ipiv, sizeof(int) * mn, hipMemcpyDeviceToHost, stream));
+    HIP_RETURN_IF_ERROR(hipStreamSynchronize(stream));
+    for(int c = 0; c < mn; c++)
+        hipiv[c] += c / nb * nb;
+    HIP_RETURN_IF_ERROR(
+        hipMemcpyAsync(ipiv, hipiv.data(), sizeof(int) * mn, hipMemcpyHostToDevice, stream));
+
+    return hipsolver_tile_info(handle, dev.tile_info, nb, info);
+}
+
+/* Tiled geqrf. work must point to at least hipsolver_tile_worksize bytes of
+   device memory. */
+template <typename T>
+rocblas_status hipsolver_geqrf_tile_template(rocblas_handle               handle,
+                                             int                          m,
+                                             int                          n,
+                                             T*                           A,
+                                             int                          lda,
+                                             T*                           tau,
+                                             const hipsolver_tile_config& config,
+                                             void*                        work)
+{
+    ROCBLAS_RETURN_IF_ERROR(hipsolver_tile_argCheck(handle, m, n, lda, A, tau));
+
+    int                                     nb      = config.nb;
+    int                                     mt      = (m - 1) / nb + 1;
+    int                                     nt      = (n - 1) / nb + 1;
+    int                                     nslots  = hipsolver_tile_factor_slots(config);
+    std::shared_ptr<hipsolver_tile_workers> workers = hipsolver_get_tile_workers(handle);
+
+    hipsolver_tile_device<T> dev(
+        handle, *workers, hipsolver_tile_qr, false, m, n, nb, config.nstreams, A, lda, nullptr);
+    dev.tau     = tau;
+    dev.factors = (T*)work;
+    return hipsolver_tile_run(dev, hipsolver_geqrf_tile_dag(mt, nt, nslots), config);
+}
@@ -0,0 +1,401 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_templates.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    Tiled task engine. A factorization of a matrix in device memory is split
+ *    into tasks on nb-by-nb tiles (or on columns of tiles, for the panels of
+ *    LU and QR). Every task declares the data it reads and writes, from which
+ *    the dependencies between tasks are derived. The tasks are then issued on
+ *    several streams: the panels, and the updates of the next lookahead
+ *    columns of tiles, run on stream 0 (the handle's stream) and the rest of
+ *    the trailing updates on the other streams, so that the next panels can be
+ *    factorized while the trailing matrix is still being updated. Streams only
+ *    wait for each other where a task depends on a task of another stream.
+ *
+ *    The plan is executed on a backend D, which provides
+ *      init(nevents)                 prepares nevents events
+ *      record(stream, event), wait(stream, event)
+ *      run(stream, task)             issues the computation of a task
+ *      finish()                      completes the execution
+ *    All operations are asynchronous with respect to the host, so a backend
+ *    emulating the device in host memory can check the plans by running the
+ *    streams in any order that respects the events.
+ * ===========================================================================
+ */
+
+// computations performed by the tasks
+enum hipsolver_tile_kernel
+{
+    // Cholesky: A(k, k) = L(k, k) * L(k, k)^H
+    hipsolver_tile_potrf,
+    // Cholesky: A(i, k) = A(i, k) * L(k, k)^-H
+    hipsolver_tile_trsm,
+    // Cholesky: A(j, j) -= A(j, k) * A(j, k)^H
+    hipsolver_tile_herk,
+    // Cholesky: A(i, j) -= A(i, k) * A(j, k)^H; LU: A(i, j) -= A(i, k) * A(k, j)
+    hipsolver_tile_gemm,
+    // LU: factorization with partial pivoting of the tiles k to mt - 1 of column k
+    hipsolver_tile_getrf,
+    // LU: row interchanges of panel k in column j > k, then A(k, j) = L(k, k)^-1 * A(k, j)
+    hipsolver_tile_swptrsm,
+    // LU: row interchanges of panel k in the columns to its left
+    hipsolver_tile_laswp,
+    // QR: factorization of the tiles k to mt - 1 of column k and its triangular factor
+    hipsolver_tile_geqrt,
+    // QR: application of the reflectors of panel k to column j > k
+    hipsolver_tile_larfb,
+};
+
+struct hipsolver_tile_task
+{
+    hipsolver_tile_kernel kernel;
+
+    int k; // step, i.e. the panel the task belongs to
+    int i; // tile row
+    int j; // tile column, or -1 for the columns to the left of the panel
+    int t; // slot of the triangular factor of a QR panel
+};
+
+// identifies tile (row, col) of the matrix, slot row of the QR factors, or the pivots of panel row
+inline int64_t hipsolver_tile_key(int kind, int row, int col)
+{
+    return (int64_t(kind) << 62) | (int64_t(row) << 31) | int64_t(col);
+}
+
+#define HIPSOLVER_TILE_MATRIX 0
+#define HIPSOLVER_TILE_FACTOR 1
+#define HIPSOLVER_TILE_PIVOTS 2
+
+class hipsolver_tile_dag
+{
+public:
+    std::vector<hipsolver_tile_task> tasks;
+
+    // deps[t] holds the earlier tasks that task t depends on
+    std::vector<std::vector<int>> deps;
+
+    // adds a task that reads the data in reads and overwrites the data in writes
+    void add(hipsolver_tile_task         task,
+             const std::vector<int64_t>& reads,
+             const std::vector<int64_t>& writes)
+    {
+        int              id = int(tasks.size());
+        std::vector<int> d;
+
+        for(int64_t key : reads)
+        {
+            access& a = access_[key];
+            if(a.writer >= 0)
+                d.push_back(a.writer);
+            a.readers.push_back(id);
+        }
+        for(int64_t key : writes)
+        {
+            access& a = access_[key];
+            if(a.writer >= 0)
+                d.push_back(a.writer);
+            for(int r : a.readers)
+                if(r != id)
+                    d.push_back(r);
+            a.writer = id;
+            a.readers.clear();
+        }
+
+        std::sort(d.begin(), d.end());
+        d.erase(std::unique(d.begin(), d.end()), d.end());
+        tasks.push_back(task);
+        deps.push_back(d);
+    }
+
+private:
+    struct access
+    {
+        int              writer = -1;
+        std::vector<int> readers;
+    };
+
+    std::unordered_map<int64_t, access> access_;
+};
+
+/******************** DAGS ********************/
+
+// tiles of rows r0 to r1 - 1 of column j
+inline std::vector<int64_t> hipsolver_tile_column(int r0, int r1, int j)
+{
+    std::vector<int64_t> keys;
+    for(int r = r0; r < r1; r++)
+        keys.push_back(hipsolver_tile_key(HIPSOLVER_TILE_MATRIX, r, j));
+    return keys;
+}
+
+/* Right-looking tiled Cholesky factorization of a matrix with nt-by-nt tiles.
+   Tile (i, j) refers to the lower triangular factor; the backend stores it as
+   the conjugate transpose of tile (j, i) when the upper one is computed. */
+inline hipsolver_tile_dag hipsolver_potrf_tile_dag(int nt)
+{
+    auto tile = [](int i, int j) { return hipsolver_tile_key(HIPSOLVER_TILE_MATRIX, i, j); };
+
+    hipsolver_tile_dag dag;
+    for(int k = 0; k < nt; k++)
+    {
+        dag.add({hipsolver_tile_potrf, k, k, k, 0}, {}, {tile(k, k)});
+        for(int i = k + 1; i < nt; i++)
+            dag.add({hipsolver_tile_trsm, k, i, k, 0}, {tile(k, k)}, {tile(i, k)});
+
+        for(int j = k + 1; j < nt; j++)
+        {
+            dag.add({hipsolver_tile_herk, k, j, j, 0}, {tile(j, k)}, {tile(j, j)});
+            for(int i = j + 1; i < nt; i++)
+                dag.add({hipsolver_tile_gemm, k, i, j, 0}, {tile(i, k), tile(j, k)}, {tile(i, j)});
+        }
+    }
+    return dag;
+}
+
+/* Right-looking tiled LU factorization with partial pivoting of a matrix with
+   mt-by-nt tiles. The pivots of a panel are searched in the whole column of
+   tiles, so the panel is a single task, and so is the application of its row
+   interchanges to each of the columns of tiles on its right. */
+inline hipsolver_tile_dag hipsolver_getrf_tile_dag(int mt, int nt)
+{
+    auto tile   = [](int i, int j) { return hipsolver_tile_key(HIPSOLVER_TILE_MATRIX, i, j); };
+    auto pivots = [](int k) { return hipsolver_tile_key(HIPSOLVER_TILE_PIVOTS, k, 0); };
+
+    hipsolver_tile_dag dag;
+    int                np = std::min(mt, nt);
+    for(int k = 0; k < np; k++)
+    {
+        std::vector<int64_t> panel = hipsolver_tile_column(k, mt, k);
+
+        std::vector<int64_t> out = panel;
+        out.push_back(pivots(k));
+        dag.add({hipsolver_tile_getrf, k, k, k, 0}, {}, out);
+
+        for(int j = k + 1; j < nt; j++)
+        {
+            std::vector<int64_t> in = {tile(k, k), pivots(k)};
+            dag.add({hipsolver_tile_swptrsm, k, k, j, 0}, in, hipsolver_tile_column(k, mt, j));
+            for(int i = k + 1; i < mt; i++)
+                dag.add({hipsolver_tile_gemm, k, i, j, 0}, {tile(i, k), tile(k, j)}, {tile(i, j)});
+        }
+
+        // the interchanges of the later panels also apply to the columns on the left
+        if(k > 0)
+        {
+            std::vector<int64_t> left;
+            for(int j = 0; j < k; j++)
+            {
+                std::vector<int64_t> col = hipsolver_tile_column(k, mt, j);
+                left.insert(left.end(), col.begin(), col.end());
+            }
+            dag.add({hipsolver_tile_laswp, k, k, -1, 0}, {pivots(k)}, left);
+        }
+    }
+    return dag;
+}
+
+/* Right-looking tiled QR factorization of a matrix with mt-by-nt tiles. The
+   triangular factors of the block reflectors are kept in nslots slots, which
+   are reused once the updates of their panel are done. */
+inline hipsolver_tile_dag hipsolver_geqrf_tile_dag(int mt, int nt, int nslots)
+{
+    auto factor = [](int s) { return hipsolver_tile_key(HIPSOLVER_TILE_FACTOR, s, 0); };
+
+    hipsolver_tile_dag dag;
+    int                np = std::min(mt, nt);
+    for(int k = 0; k < np; k++)
+    {
+        int s = k % nslots;
+
+        std::vector<int64_t> panel = hipsolver_tile_column(k, mt, k);
+
+        std::vector<int64_t> out = panel;
+        out.push_back(factor(s));
+        dag.add({hipsolver_tile_geqrt, k, k, k, s}, {}, out);
+
+        std::vector<int64_t> in = panel;
+        in.push_back(factor(s));
+        for(int j = k + 1; j < nt; j++)
+            dag.add({hipsolver_tile_larfb, k, k, j, s}, in, hipsolver_tile_column(k, mt, j));
+    }
+    return dag;
+}
+
+/******************** PLAN ********************/
+
+struct hipsolver_tile_op
+{
+    enum
+    {
+        run,
+        record,
+        wait
+    } type;
+
+    int stream;
+    int arg; // the task to run, or the event to record or wait for
+};
+
+struct hipsolver_tile_plan
+{
+    std::vector<hipsolver_tile_op> ops;
+    int                            nevents = 0;
+};
+
+/* Orders the tasks of dag for look-ahead and assigns them to nstreams streams.
+   A task is critical if it belongs to a panel or updates one of the lookahead
+   columns of tiles that follow its panel. Critical tasks are issued as early as
+   their dependencies allow and run on stream 0, while the other tasks run on
+   streams 1 to nstreams - 1 by column of tiles, in the order of their steps.
+   Events are only recorded after the tasks that other streams depend on, and
+   are reused once all those streams have been told to wait for them. */
+inline hipsolver_tile_plan
+    hipsolver_tile_schedule(const hipsolver_tile_dag& dag, int nstreams, int lookahead)
+{
+    int ntasks = int(dag.tasks.size());
+
+    // the priority of critical tasks is their column shifted back by the look-ahead;
+    // that of the other tasks falls between two steps
+    std::vector<int64_t> key(ntasks);
+    std::vector<int>     stream(ntasks);
+    for(int t = 0; t < ntasks; t++)
+    {
+        const hipsolver_tile_task& task = dag.tasks[t];
+
+        bool critical = task.j >= 0 && task.j - task.k <= lookahead;
+        key[t]        = critical ? 2 * int64_t(task.j - lookahead) : 2 * int64_t(task.k) + 1;
+
+        int col   = task.j >= 0 ? task.j : task.k;
+        stream[t] = (critical || nstreams == 1) ? 0 : 1 + col % (nstreams - 1);
+    }
+
+    std::vector<int> order(ntasks);
+    for(int t = 0; t < ntasks; t++)
+        order[t] = t;
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return key[a] < key[b]; });
+
+    // the order must respect the dependencies; otherwise fall back to the order of the dag
+    std::vector<int> pos(ntasks);
+    bool             valid = true;
+    for(int p = 0; p < ntasks; p++)
+        pos[order[p]] = p;
+    for(int t = 0; t < ntasks; t++)
+        for(int d : dag.deps[t])
+            valid = valid && pos[d] < pos[t];
+    for(int p = 0; p < ntasks && !valid; p++)
+        order[p] = p;
+
+    // number of dependents of every task on other streams
+    std::vector<int> remote(ntasks, 0);
+    for(int t = 0; t < ntasks; t++)
+        for(int d : dag.deps[t])
+            if(stream[d] != stream[t])
+                remote[d]++;
+
+    hipsolver_tile_plan plan;
+    std::vector<int>    free_events;
+    std::vector<int>    event(ntasks, -1);
+    std::vector<int>    count(nstreams, 0);
+    std::vector<int>    seq(ntasks, 0);
+    std::vector<bool>   used(nstreams, false);
+
+    // waited[s * nstreams + r] is the number of tasks of stream r that stream s waited for
+    std::vector<int> waited(nstreams * nstreams, 0);
+
+    auto new_event = [&]() {
+        if(free_events.empty())
+            free_events.push_back(plan.nevents++);
+        int e = free_events.back();
+        free_events.pop_back();
+        return e;
+    };
+
+    // the other streams start after the work already enqueued on stream 0
+    int entry = -1;
+    if(nstreams > 1)
+    {
+        entry = new_event();
+        plan.ops.push_back({hipsolver_tile_op::record, 0, entry});
+    }
+
+    for(int t : order)
+    {
+        int s = stream[t];
+        if(s > 0 && !used[s])
+        {
+            plan.ops.push_back({hipsolver_tile_op::wait, s, entry});
+            used[s] = true;
+        }
+
+        for(int d : dag.deps[t])
+        {
+            int r = stream[d];
+            if(r == s)
+                continue;
+
+            if(waited[s * nstreams + r] < seq[d])
+            {
+                plan.ops.push_back({hipsolver_tile_op::wait, s, event[d]});
+                waited[s * nstreams + r] = seq[d];
+            }
+            if(--remote[d] == 0)
+                free_events.push_back(event[d]);
+        }
+
+        plan.ops.push_back({hipsolver_tile_op::run, s, t});
+        seq[t] = ++count[s];
+
+        if(remote[t] > 0)
+        {
+            event[t] = new_event();
+            plan.ops.push_back({hipsolver_tile_op::record, s, event[t]});
+        }
+    }
+
+    // stream 0 finishes after all the other streams
+    for(int s = 1; s < nstreams; s++)
+    {
+        if(!used[s])
+            continue;
+        int e = new_event();
+        plan.ops.push_back({hipsolver_tile_op::record, s, e});
+        plan.ops.push_back({hipsolver_tile_op::wait, 0, e});
+    }
+
+    return plan;
+}
+
+// runs the tasks of dag on dev as planned by hipsolver_tile_schedule
+template <typename D>
+rocblas_status
+    hipsolver_tile_execute(D& dev, const hipsolver_tile_dag& dag, const hipsolver_tile_plan& plan)
+{
+    ROCBLAS_RETURN_IF_ERROR(dev.init(plan.nevents));
+    for(const hipsolver_tile_op& op : plan.ops)
+    {
+        switch(op.type)
+        {
+        case hipsolver_tile_op::run:
+            ROCBLAS_RETURN_IF_ERROR(dev.run(op.stream, dag.tasks[op.arg]));
+            break;
+        case hipsolver_tile_op::record:
+            ROCBLAS_RETURN_IF_ERROR(dev.record(op.stream, op.arg));
+            break;
+        case hipsolver_tile_op::wait:
+            ROCBLAS_RETURN_IF_ERROR(dev.wait(op.stream, op.arg));
+            break;
+        }
+    }
+    return dev.finish();
+}
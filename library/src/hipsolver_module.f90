@@ -36,6 +36,50 @@ module hipsolver_enums
         enumerator :: HIPSOLVER_EIG_TYPE_3 = 213
     end enum
 
+    enum, bind(c)
+        enumerator :: HIPSOLVER_CAPTURE_MODE_DEFAULT = 221
+        enumerator :: HIPSOLVER_CAPTURE_MODE_SAFE    = 222
+    end enum
+
+    enum, bind(c)
+        enumerator :: HIPSOLVER_ALLOC_MODE_DEFAULT        = 231
+        enumerator :: HIPSOLVER_ALLOC_MODE_STREAM_ORDERED = 232
+    end enum
+
+    enum, bind(c)
+        enumerator :: HIPSOLVER_ERROR_MODE_DEFAULT  = 241
+        enumerator :: HIPSOLVER_ERROR_MODE_DEFERRED = 242
+    end enum
+
+    enum, bind(c)
+        enumerator :: HIPSOLVER_MG_GRID_MAPPING_ROW_MAJOR = 251
+        enumerator :: HIPSOLVER_MG_GRID_MAPPING_COL_MAJOR = 252
+    end enum
+
+    enum, bind(c)
+        enumerator :: HIPSOLVER_HOST_AFFINITY_NONE   = 261
+        enumerator :: HIPSOLVER_HOST_AFFINITY_CLOSE  = 262
+        enumerator :: HIPSOLVER_HOST_AFFINITY_SPREAD = 263
+    end enum
+
+    enum, bind(c)
+        enumerator :: HIPSOLVER_DISPATCH_MODE_DEVICE = 271
+        enumerator :: HIPSOLVER_DISPATCH_MODE_AUTO   = 272
+    end enum
+
+    enum, bind(c)
+        enumerator :: HIPSOLVER_DISPATCH_POTRF = 281
+        enumerator :: HIPSOLVER_DISPATCH_GETRF = 282
+        enumerator :: HIPSOLVER_DISPATCH_GETRS = 283
+    end enum
+
+    enum, bind(c)
+        enumerator :: HIPSOLVER_PRECISION_SINGLE         = 291
+        enumerator :: HIPSOLVER_PRECISION_DOUBLE         = 292
+        enumerator :: HIPSOLVER_PRECISION_SINGLE_COMPLEX = 293
+        enumerator :: HIPSOLVER_PRECISION_DOUBLE_COMPLEX = 294
+    end enum
+
     enum, bind(c)
         enumerator :: HIPSOLVER_STATUS_SUCCESS           = 0
         enumerator :: HIPSOLVER_STATUS_NOT_INITIALIZED   = 1
@@ -935,67 +979,83 @@ module hipsolver
         end function hipsolverZunmtr
     end interface
     
-    ! ******************** GEBRD ********************
+    ! ******************** CHOLQR2 ********************
     interface
-        function hipsolverSgebrd_bufferSize(handle, m, n, lwork) &
+        function hipsolverScholqr2_bufferSize(handle, m, n, A, lda, R, ldr, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgebrd_bufferSize')
+                bind(c, name = 'hipsolverScholqr2_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: R
+            integer(c_int), value :: ldr
             type(c_ptr), value :: lwork
-        end function hipsolverSgebrd_bufferSize
+        end function hipsolverScholqr2_bufferSize
     end interface
-    
+
     interface
-        function hipsolverDgebrd_bufferSize(handle, m, n, lwork) &
+        function hipsolverDcholqr2_bufferSize(handle, m, n, A, lda, R, ldr, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgebrd_bufferSize')
+                bind(c, name = 'hipsolverDcholqr2_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: R
+            integer(c_int), value :: ldr
             type(c_ptr), value :: lwork
-        end function hipsolverDgebrd_bufferSize
+        end function hipsolverDcholqr2_bufferSize
     end interface
-    
+
     interface
-        function hipsolverCgebrd_bufferSize(handle, m, n, lwork) &
+        function hipsolverCcholqr2_bufferSize(handle, m, n, A, lda, R, ldr, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgebrd_bufferSize')
+                bind(c, name = 'hipsolverCcholqr2_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: R
+            integer(c_int), value :: ldr
             type(c_ptr), value :: lwork
-        end function hipsolverCgebrd_bufferSize
+        end function hipsolverCcholqr2_bufferSize
     end interface
-    
+
     interface
-        function hipsolverZgebrd_bufferSize(handle, m, n, lwork) &
+        function hipsolverZcholqr2_bufferSize(handle, m, n, A, lda, R, ldr, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgebrd_bufferSize')
+                bind(c, name = 'hipsolverZcholqr2_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: R
+            integer(c_int), value :: ldr
             type(c_ptr), value :: lwork
-        end function hipsolverZgebrd_bufferSize
+        end function hipsolverZcholqr2_bufferSize
     end interface
 
     interface
-        function hipsolverSgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+        function hipsolverScholqr2(handle, m, n, A, lda, R, ldr, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgebrd')
+                bind(c, name = 'hipsolverScholqr2')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -1004,20 +1064,18 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tauq
-            type(c_ptr), value :: taup
+            type(c_ptr), value :: R
+            integer(c_int), value :: ldr
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSgebrd
+        end function hipsolverScholqr2
     end interface
 
     interface
-        function hipsolverDgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+        function hipsolverDcholqr2(handle, m, n, A, lda, R, ldr, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgebrd')
+                bind(c, name = 'hipsolverDcholqr2')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -1026,20 +1084,18 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tauq
-            type(c_ptr), value :: taup
+            type(c_ptr), value :: R
+            integer(c_int), value :: ldr
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDgebrd
+        end function hipsolverDcholqr2
     end interface
 
     interface
-        function hipsolverCgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+        function hipsolverCcholqr2(handle, m, n, A, lda, R, ldr, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgebrd')
+                bind(c, name = 'hipsolverCcholqr2')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -1048,20 +1104,18 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tauq
-            type(c_ptr), value :: taup
+            type(c_ptr), value :: R
+            integer(c_int), value :: ldr
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCgebrd
+        end function hipsolverCcholqr2
     end interface
 
     interface
-        function hipsolverZgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+        function hipsolverZcholqr2(handle, m, n, A, lda, R, ldr, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgebrd')
+                bind(c, name = 'hipsolverZcholqr2')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -1070,21 +1124,19 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tauq
-            type(c_ptr), value :: taup
+            type(c_ptr), value :: R
+            integer(c_int), value :: ldr
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZgebrd
+        end function hipsolverZcholqr2
     end interface
-    
-    ! ******************** GEQRF ********************
+
+    ! ******************** CHOLQR3 ********************
     interface
-        function hipsolverSgeqrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverScholqr3_bufferSize(handle, m, n, A, lda, R, ldr, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgeqrf_bufferSize')
+                bind(c, name = 'hipsolverScholqr3_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -1093,14 +1145,16 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: R
+            integer(c_int), value :: ldr
             type(c_ptr), value :: lwork
-        end function hipsolverSgeqrf_bufferSize
+        end function hipsolverScholqr3_bufferSize
     end interface
 
     interface
-        function hipsolverDgeqrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverDcholqr3_bufferSize(handle, m, n, A, lda, R, ldr, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgeqrf_bufferSize')
+                bind(c, name = 'hipsolverDcholqr3_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -1109,14 +1163,16 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: R
+            integer(c_int), value :: ldr
             type(c_ptr), value :: lwork
-        end function hipsolverDgeqrf_bufferSize
+        end function hipsolverDcholqr3_bufferSize
     end interface
 
     interface
-        function hipsolverCgeqrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverCcholqr3_bufferSize(handle, m, n, A, lda, R, ldr, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgeqrf_bufferSize')
+                bind(c, name = 'hipsolverCcholqr3_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -1125,14 +1181,16 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: R
+            integer(c_int), value :: ldr
             type(c_ptr), value :: lwork
-        end function hipsolverCgeqrf_bufferSize
+        end function hipsolverCcholqr3_bufferSize
     end interface
 
     interface
-        function hipsolverZgeqrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverZcholqr3_bufferSize(handle, m, n, A, lda, R, ldr, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgeqrf_bufferSize')
+                bind(c, name = 'hipsolverZcholqr3_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -1141,14 +1199,16 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: R
+            integer(c_int), value :: ldr
             type(c_ptr), value :: lwork
-        end function hipsolverZgeqrf_bufferSize
+        end function hipsolverZcholqr3_bufferSize
     end interface
 
     interface
-        function hipsolverSgeqrf(handle, m, n, A, lda, tau, work, lwork, info) &
+        function hipsolverScholqr3(handle, m, n, A, lda, R, ldr, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgeqrf')
+                bind(c, name = 'hipsolverScholqr3')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -1157,17 +1217,18 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: R
+            integer(c_int), value :: ldr
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSgeqrf
+        end function hipsolverScholqr3
     end interface
 
     interface
-        function hipsolverDgeqrf(handle, m, n, A, lda, tau, work, lwork, info) &
+        function hipsolverDcholqr3(handle, m, n, A, lda, R, ldr, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgeqrf')
+                bind(c, name = 'hipsolverDcholqr3')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -1176,17 +1237,18 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: R
+            integer(c_int), value :: ldr
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDgeqrf
+        end function hipsolverDcholqr3
     end interface
 
     interface
-        function hipsolverCgeqrf(handle, m, n, A, lda, tau, work, lwork, info) &
+        function hipsolverCcholqr3(handle, m, n, A, lda, R, ldr, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgeqrf')
+                bind(c, name = 'hipsolverCcholqr3')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -1195,17 +1257,18 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: R
+            integer(c_int), value :: ldr
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCgeqrf
+        end function hipsolverCcholqr3
     end interface
 
     interface
-        function hipsolverZgeqrf(handle, m, n, A, lda, tau, work, lwork, info) &
+        function hipsolverZcholqr3(handle, m, n, A, lda, R, ldr, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgeqrf')
+                bind(c, name = 'hipsolverZcholqr3')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -1214,1263 +1277,4232 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: R
+            integer(c_int), value :: ldr
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZgeqrf
+        end function hipsolverZcholqr3
     end interface
-    
-    ! ******************** GESVD ********************
+
+    ! ******************** GEBRD ********************
     interface
-        function hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+        function hipsolverSgebrd_bufferSize(handle, m, n, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgesvd_bufferSize')
+                bind(c, name = 'hipsolverSgebrd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_signed_char), value :: jobu
-            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: lwork
-        end function hipsolverSgesvd_bufferSize
+        end function hipsolverSgebrd_bufferSize
     end interface
     
     interface
-        function hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+        function hipsolverDgebrd_bufferSize(handle, m, n, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgesvd_bufferSize')
+                bind(c, name = 'hipsolverDgebrd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_signed_char), value :: jobu
-            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: lwork
-        end function hipsolverDgesvd_bufferSize
+        end function hipsolverDgebrd_bufferSize
     end interface
     
     interface
-        function hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+        function hipsolverCgebrd_bufferSize(handle, m, n, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgesvd_bufferSize')
+                bind(c, name = 'hipsolverCgebrd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_signed_char), value :: jobu
-            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: lwork
-        end function hipsolverCgesvd_bufferSize
+        end function hipsolverCgebrd_bufferSize
     end interface
     
     interface
-        function hipsolverZgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+        function hipsolverZgebrd_bufferSize(handle, m, n, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgesvd_bufferSize')
+                bind(c, name = 'hipsolverZgebrd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_signed_char), value :: jobu
-            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: lwork
-        end function hipsolverZgesvd_bufferSize
+        end function hipsolverZgebrd_bufferSize
     end interface
 
     interface
-        function hipsolverSgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+        function hipsolverSgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgesvd')
+                bind(c, name = 'hipsolverSgebrd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_signed_char), value :: jobu
-            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: S
-            type(c_ptr), value :: U
-            integer(c_int), value :: ldu
-            type(c_ptr), value :: V
-            integer(c_int), value :: ldv
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tauq
+            type(c_ptr), value :: taup
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
-            type(c_ptr), value :: rwork
             type(c_ptr), value :: info
-        end function hipsolverSgesvd
+        end function hipsolverSgebrd
     end interface
 
     interface
-        function hipsolverDgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+        function hipsolverDgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgesvd')
+                bind(c, name = 'hipsolverDgebrd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_signed_char), value :: jobu
-            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: S
-            type(c_ptr), value :: U
-            integer(c_int), value :: ldu
-            type(c_ptr), value :: V
-            integer(c_int), value :: ldv
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tauq
+            type(c_ptr), value :: taup
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
-            type(c_ptr), value :: rwork
             type(c_ptr), value :: info
-        end function hipsolverDgesvd
+        end function hipsolverDgebrd
     end interface
 
     interface
-        function hipsolverCgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+        function hipsolverCgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgesvd')
+                bind(c, name = 'hipsolverCgebrd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_signed_char), value :: jobu
-            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: S
-            type(c_ptr), value :: U
-            integer(c_int), value :: ldu
-            type(c_ptr), value :: V
-            integer(c_int), value :: ldv
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tauq
+            type(c_ptr), value :: taup
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
-            type(c_ptr), value :: rwork
             type(c_ptr), value :: info
-        end function hipsolverCgesvd
+        end function hipsolverCgebrd
     end interface
 
     interface
-        function hipsolverZgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+        function hipsolverZgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgesvd')
+                bind(c, name = 'hipsolverZgebrd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_signed_char), value :: jobu
-            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: S
-            type(c_ptr), value :: U
-            integer(c_int), value :: ldu
-            type(c_ptr), value :: V
-            integer(c_int), value :: ldv
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tauq
+            type(c_ptr), value :: taup
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
-            type(c_ptr), value :: rwork
             type(c_ptr), value :: info
-        end function hipsolverZgesvd
+        end function hipsolverZgebrd
     end interface
-
-    ! ******************** GETRF ********************
+    
+    ! ******************** GELS ********************
     interface
-        function hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverSSgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgetrf_bufferSize')
+                bind(c, name = 'hipsolverSSgels_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             type(c_ptr), value :: lwork
-        end function hipsolverSgetrf_bufferSize
+        end function hipsolverSSgels_bufferSize
     end interface
-    
+
     interface
-        function hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverDDgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgetrf_bufferSize')
+                bind(c, name = 'hipsolverDDgels_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             type(c_ptr), value :: lwork
-        end function hipsolverDgetrf_bufferSize
+        end function hipsolverDDgels_bufferSize
     end interface
-    
+
     interface
-        function hipsolverCgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverCCgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgetrf_bufferSize')
+                bind(c, name = 'hipsolverCCgels_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             type(c_ptr), value :: lwork
-        end function hipsolverCgetrf_bufferSize
+        end function hipsolverCCgels_bufferSize
     end interface
-    
+
     interface
-        function hipsolverZgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverZZgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgetrf_bufferSize')
+                bind(c, name = 'hipsolverZZgels_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             type(c_ptr), value :: lwork
-        end function hipsolverZgetrf_bufferSize
+        end function hipsolverZZgels_bufferSize
     end interface
 
     interface
-        function hipsolverSgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+        function hipsolverSSgels(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgetrf')
+                bind(c, name = 'hipsolverSSgels')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
-            type(c_ptr), value :: ipiv
+            integer(c_size_t), value :: lwork
+            type(c_ptr), value :: niters
             type(c_ptr), value :: info
-        end function hipsolverSgetrf
+        end function hipsolverSSgels
     end interface
-    
+
     interface
-        function hipsolverDgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+        function hipsolverDDgels(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgetrf')
+                bind(c, name = 'hipsolverDDgels')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
-            type(c_ptr), value :: ipiv
+            integer(c_size_t), value :: lwork
+            type(c_ptr), value :: niters
             type(c_ptr), value :: info
-        end function hipsolverDgetrf
+        end function hipsolverDDgels
     end interface
-    
+
     interface
-        function hipsolverCgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+        function hipsolverCCgels(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgetrf')
+                bind(c, name = 'hipsolverCCgels')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
-            type(c_ptr), value :: ipiv
+            integer(c_size_t), value :: lwork
+            type(c_ptr), value :: niters
             type(c_ptr), value :: info
-        end function hipsolverCgetrf
+        end function hipsolverCCgels
     end interface
-    
+
     interface
-        function hipsolverZgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+        function hipsolverZZgels(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgetrf')
+                bind(c, name = 'hipsolverZZgels')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
-            type(c_ptr), value :: ipiv
+            integer(c_size_t), value :: lwork
+            type(c_ptr), value :: niters
             type(c_ptr), value :: info
-        end function hipsolverZgetrf
+        end function hipsolverZZgels
     end interface
 
-    ! ******************** GETRS ********************
+    ! ******************** GELS_BATCHED ********************
     interface
-        function hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+        function hipsolverSSgelsBatched_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgetrs_bufferSize')
+                bind(c, name = 'hipsolverSSgelsBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             type(c_ptr), value :: lwork
-        end function hipsolverSgetrs_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverSSgelsBatched_bufferSize
     end interface
-    
+
     interface
-        function hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+        function hipsolverDDgelsBatched_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgetrs_bufferSize')
+                bind(c, name = 'hipsolverDDgelsBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             type(c_ptr), value :: lwork
-        end function hipsolverDgetrs_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverDDgelsBatched_bufferSize
     end interface
-    
+
     interface
-        function hipsolverCgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+        function hipsolverCCgelsBatched_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgetrs_bufferSize')
+                bind(c, name = 'hipsolverCCgelsBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             type(c_ptr), value :: lwork
-        end function hipsolverCgetrs_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverCCgelsBatched_bufferSize
     end interface
-    
+
     interface
-        function hipsolverZgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+        function hipsolverZZgelsBatched_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgetrs_bufferSize')
+                bind(c, name = 'hipsolverZZgelsBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             type(c_ptr), value :: lwork
-        end function hipsolverZgetrs_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverZZgelsBatched_bufferSize
     end interface
 
     interface
-        function hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+        function hipsolverSSgelsBatched(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgetrs')
+                bind(c, name = 'hipsolverSSgelsBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
+            integer(c_size_t), value :: lwork
+            type(c_ptr), value :: niters
             type(c_ptr), value :: info
-        end function hipsolverSgetrs
+            integer(c_int), value :: batch_count
+        end function hipsolverSSgelsBatched
     end interface
-    
+
     interface
-        function hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+        function hipsolverDDgelsBatched(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgetrs')
+                bind(c, name = 'hipsolverDDgelsBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
+            integer(c_size_t), value :: lwork
+            type(c_ptr), value :: niters
             type(c_ptr), value :: info
-        end function hipsolverDgetrs
+            integer(c_int), value :: batch_count
+        end function hipsolverDDgelsBatched
     end interface
-    
+
     interface
-        function hipsolverCgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+        function hipsolverCCgelsBatched(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgetrs')
+                bind(c, name = 'hipsolverCCgelsBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
+            integer(c_size_t), value :: lwork
+            type(c_ptr), value :: niters
             type(c_ptr), value :: info
-        end function hipsolverCgetrs
+            integer(c_int), value :: batch_count
+        end function hipsolverCCgelsBatched
     end interface
-    
+
     interface
-        function hipsolverZgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+        function hipsolverZZgelsBatched(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgetrs')
+                bind(c, name = 'hipsolverZZgelsBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             type(c_ptr), value :: work
-            integer(c_int), value :: lwork
+            integer(c_size_t), value :: lwork
+            type(c_ptr), value :: niters
             type(c_ptr), value :: info
-        end function hipsolverZgetrs
+            integer(c_int), value :: batch_count
+        end function hipsolverZZgelsBatched
     end interface
 
-    ! ******************** POTRF ********************
+    ! ******************** GEQP3 ********************
     interface
-        function hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+        function hipsolverSgeqp3_bufferSize(handle, m, n, A, lda, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSpotrf_bufferSize')
+                bind(c, name = 'hipsolverSgeqp3_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: lwork
-        end function hipsolverSpotrf_bufferSize
+        end function hipsolverSgeqp3_bufferSize
     end interface
-    
+
     interface
-        function hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+        function hipsolverDgeqp3_bufferSize(handle, m, n, A, lda, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDpotrf_bufferSize')
+                bind(c, name = 'hipsolverDgeqp3_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: lwork
-        end function hipsolverDpotrf_bufferSize
+        end function hipsolverDgeqp3_bufferSize
     end interface
-    
+
     interface
-        function hipsolverCpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+        function hipsolverCgeqp3_bufferSize(handle, m, n, A, lda, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCpotrf_bufferSize')
+                bind(c, name = 'hipsolverCgeqp3_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: lwork
-        end function hipsolverCpotrf_bufferSize
+        end function hipsolverCgeqp3_bufferSize
     end interface
-    
+
     interface
-        function hipsolverZpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+        function hipsolverZgeqp3_bufferSize(handle, m, n, A, lda, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZpotrf_bufferSize')
+                bind(c, name = 'hipsolverZgeqp3_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: lwork
-        end function hipsolverZpotrf_bufferSize
+        end function hipsolverZgeqp3_bufferSize
     end interface
 
     interface
-        function hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+        function hipsolverSgeqp3(handle, m, n, A, lda, jpvt, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSpotrf')
+                bind(c, name = 'hipsolverSgeqp3')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: jpvt
+            type(c_ptr), value :: tau
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSpotrf
+        end function hipsolverSgeqp3
     end interface
 
     interface
-        function hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+        function hipsolverDgeqp3(handle, m, n, A, lda, jpvt, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDpotrf')
+                bind(c, name = 'hipsolverDgeqp3')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: jpvt
+            type(c_ptr), value :: tau
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDpotrf
+        end function hipsolverDgeqp3
     end interface
 
     interface
-        function hipsolverCpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+        function hipsolverCgeqp3(handle, m, n, A, lda, jpvt, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCpotrf')
+                bind(c, name = 'hipsolverCgeqp3')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: jpvt
+            type(c_ptr), value :: tau
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCpotrf
+        end function hipsolverCgeqp3
     end interface
 
     interface
-        function hipsolverZpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+        function hipsolverZgeqp3(handle, m, n, A, lda, jpvt, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZpotrf')
+                bind(c, name = 'hipsolverZgeqp3')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: jpvt
+            type(c_ptr), value :: tau
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZpotrf
+        end function hipsolverZgeqp3
     end interface
-    
-    ! ******************** POTRF_BATCHED ********************
+
+    ! ******************** GEQP3_TRUNCATED ********************
     interface
-        function hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+        function hipsolverSgeqp3Truncated_bufferSize(handle, m, n, A, lda, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSpotrfBatched_bufferSize')
+                bind(c, name = 'hipsolverSgeqp3Truncated_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: lwork
-            integer(c_int), value :: batch_count
-        end function hipsolverSpotrfBatched_bufferSize
+        end function hipsolverSgeqp3Truncated_bufferSize
     end interface
-    
+
     interface
-        function hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+        function hipsolverDgeqp3Truncated_bufferSize(handle, m, n, A, lda, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDpotrfBatched_bufferSize')
+                bind(c, name = 'hipsolverDgeqp3Truncated_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: lwork
-            integer(c_int), value :: batch_count
-        end function hipsolverDpotrfBatched_bufferSize
+        end function hipsolverDgeqp3Truncated_bufferSize
     end interface
-    
+
     interface
-        function hipsolverCpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+        function hipsolverCgeqp3Truncated_bufferSize(handle, m, n, A, lda, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCpotrfBatched_bufferSize')
+                bind(c, name = 'hipsolverCgeqp3Truncated_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: lwork
-            integer(c_int), value :: batch_count
-        end function hipsolverCpotrfBatched_bufferSize
+        end function hipsolverCgeqp3Truncated_bufferSize
     end interface
-    
+
     interface
-        function hipsolverZpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+        function hipsolverZgeqp3Truncated_bufferSize(handle, m, n, A, lda, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZpotrfBatched_bufferSize')
+                bind(c, name = 'hipsolverZgeqp3Truncated_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: lwork
-            integer(c_int), value :: batch_count
-        end function hipsolverZpotrfBatched_bufferSize
+        end function hipsolverZgeqp3Truncated_bufferSize
     end interface
 
     interface
-        function hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+        function hipsolverSgeqp3Truncated(handle, m, n, A, lda, tol, jpvt, tau, rank, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSpotrfBatched')
+                bind(c, name = 'hipsolverSgeqp3Truncated')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            real(c_float), value :: tol
+            type(c_ptr), value :: jpvt
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: rank
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-            integer(c_int), value :: batch_count
-        end function hipsolverSpotrfBatched
+        end function hipsolverSgeqp3Truncated
     end interface
-    
+
     interface
-        function hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+        function hipsolverDgeqp3Truncated(handle, m, n, A, lda, tol, jpvt, tau, rank, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDpotrfBatched')
+                bind(c, name = 'hipsolverDgeqp3Truncated')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            real(c_double), value :: tol
+            type(c_ptr), value :: jpvt
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: rank
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-            integer(c_int), value :: batch_count
-        end function hipsolverDpotrfBatched
+        end function hipsolverDgeqp3Truncated
     end interface
-    
+
     interface
-        function hipsolverCpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+        function hipsolverCgeqp3Truncated(handle, m, n, A, lda, tol, jpvt, tau, rank, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCpotrfBatched')
+                bind(c, name = 'hipsolverCgeqp3Truncated')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            real(c_float), value :: tol
+            type(c_ptr), value :: jpvt
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: rank
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-            integer(c_int), value :: batch_count
-        end function hipsolverCpotrfBatched
+        end function hipsolverCgeqp3Truncated
     end interface
-    
+
     interface
-        function hipsolverZpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+        function hipsolverZgeqp3Truncated(handle, m, n, A, lda, tol, jpvt, tau, rank, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZpotrfBatched')
+                bind(c, name = 'hipsolverZgeqp3Truncated')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            real(c_double), value :: tol
+            type(c_ptr), value :: jpvt
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: rank
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-            integer(c_int), value :: batch_count
-        end function hipsolverZpotrfBatched
+        end function hipsolverZgeqp3Truncated
     end interface
 
-    ! ******************** SYEVD/HEEVD ********************
+    ! ******************** GEQRF ********************
     interface
-        function hipsolverSsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork) &
+        function hipsolverSgeqrf_bufferSize(handle, m, n, A, lda, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSsyevd_bufferSize')
+                bind(c, name = 'hipsolverSgeqrf_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
             type(c_ptr), value :: lwork
-        end function hipsolverSsyevd_bufferSize
+        end function hipsolverSgeqrf_bufferSize
     end interface
-    
+
     interface
-        function hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork) &
+        function hipsolverDgeqrf_bufferSize(handle, m, n, A, lda, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDsyevd_bufferSize')
+                bind(c, name = 'hipsolverDgeqrf_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
             type(c_ptr), value :: lwork
-        end function hipsolverDsyevd_bufferSize
+        end function hipsolverDgeqrf_bufferSize
     end interface
-    
+
     interface
-        function hipsolverCheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork) &
+        function hipsolverCgeqrf_bufferSize(handle, m, n, A, lda, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCheevd_bufferSize')
+                bind(c, name = 'hipsolverCgeqrf_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverCgeqrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverZgeqrf_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgeqrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverZgeqrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgeqrf(handle, m, n, A, lda, tau, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgeqrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSgeqrf
+    end interface
+
+    interface
+        function hipsolverDgeqrf(handle, m, n, A, lda, tau, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgeqrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDgeqrf
+    end interface
+
+    interface
+        function hipsolverCgeqrf(handle, m, n, A, lda, tau, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgeqrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCgeqrf
+    end interface
+
+    interface
+        function hipsolverZgeqrf(handle, m, n, A, lda, tau, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgeqrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZgeqrf
+    end interface
+    
+    ! ******************** GEQRF_TSQR ********************
+    interface
+        function hipsolverSgeqrfTsqr_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgeqrfTsqr_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverSgeqrfTsqr_bufferSize
+    end interface
+
+    interface
+        function hipsolverDgeqrfTsqr_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgeqrfTsqr_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverDgeqrfTsqr_bufferSize
+    end interface
+
+    interface
+        function hipsolverCgeqrfTsqr_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgeqrfTsqr_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverCgeqrfTsqr_bufferSize
+    end interface
+
+    interface
+        function hipsolverZgeqrfTsqr_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgeqrfTsqr_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverZgeqrfTsqr_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgeqrfTsqr(handle, m, n, A, lda, tau, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgeqrfTsqr')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSgeqrfTsqr
+    end interface
+
+    interface
+        function hipsolverDgeqrfTsqr(handle, m, n, A, lda, tau, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgeqrfTsqr')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDgeqrfTsqr
+    end interface
+
+    interface
+        function hipsolverCgeqrfTsqr(handle, m, n, A, lda, tau, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgeqrfTsqr')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCgeqrfTsqr
+    end interface
+
+    interface
+        function hipsolverZgeqrfTsqr(handle, m, n, A, lda, tau, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgeqrfTsqr')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZgeqrfTsqr
+    end interface
+
+    ! ******************** GESVD ********************
+    interface
+        function hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgesvd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: lwork
+        end function hipsolverSgesvd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgesvd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: lwork
+        end function hipsolverDgesvd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgesvd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: lwork
+        end function hipsolverCgesvd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgesvd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: lwork
+        end function hipsolverZgesvd_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgesvd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: rwork
+            type(c_ptr), value :: info
+        end function hipsolverSgesvd
+    end interface
+
+    interface
+        function hipsolverDgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgesvd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: rwork
+            type(c_ptr), value :: info
+        end function hipsolverDgesvd
+    end interface
+
+    interface
+        function hipsolverCgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgesvd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: rwork
+            type(c_ptr), value :: info
+        end function hipsolverCgesvd
+    end interface
+
+    interface
+        function hipsolverZgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgesvd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: rwork
+            type(c_ptr), value :: info
+        end function hipsolverZgesvd
+    end interface
+
+    ! ******************** GETRF ********************
+    interface
+        function hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverSgetrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverDgetrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverCgetrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverZgetrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverSgetrf
+    end interface
+    
+    interface
+        function hipsolverDgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverDgetrf
+    end interface
+    
+    interface
+        function hipsolverCgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverCgetrf
+    end interface
+    
+    interface
+        function hipsolverZgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverZgetrf
+    end interface
+
+    ! ******************** GETRS ********************
+    interface
+        function hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverSgetrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverDgetrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverCgetrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverZgetrs_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSgetrs
+    end interface
+    
+    interface
+        function hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDgetrs
+    end interface
+    
+    interface
+        function hipsolverCgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCgetrs
+    end interface
+    
+    interface
+        function hipsolverZgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZgetrs
+    end interface
+
+    ! ******************** GETRF_HOST ********************
+    interface
+        function hipsolverSgetrfHost(handle, m, n, A, lda, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrfHost')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverSgetrfHost
+    end interface
+
+    interface
+        function hipsolverDgetrfHost(handle, m, n, A, lda, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrfHost')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverDgetrfHost
+    end interface
+
+    interface
+        function hipsolverCgetrfHost(handle, m, n, A, lda, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrfHost')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverCgetrfHost
+    end interface
+
+    interface
+        function hipsolverZgetrfHost(handle, m, n, A, lda, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrfHost')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverZgetrfHost
+    end interface
+
+    ! ******************** GETRF_BATCHED_HOST ********************
+    interface
+        function hipsolverSgetrfBatchedHost(handle, m, n, A, lda, ipiv, strideP, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrfBatchedHost')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrfBatchedHost
+    end interface
+
+    interface
+        function hipsolverDgetrfBatchedHost(handle, m, n, A, lda, ipiv, strideP, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrfBatchedHost')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrfBatchedHost
+    end interface
+
+    interface
+        function hipsolverCgetrfBatchedHost(handle, m, n, A, lda, ipiv, strideP, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrfBatchedHost')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrfBatchedHost
+    end interface
+
+    interface
+        function hipsolverZgetrfBatchedHost(handle, m, n, A, lda, ipiv, strideP, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrfBatchedHost')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrfBatchedHost
+    end interface
+
+    ! ******************** GETRS_HOST ********************
+    interface
+        function hipsolverSgetrsHost(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrsHost')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipsolverSgetrsHost
+    end interface
+
+    interface
+        function hipsolverDgetrsHost(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrsHost')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipsolverDgetrsHost
+    end interface
+
+    interface
+        function hipsolverCgetrsHost(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrsHost')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipsolverCgetrsHost
+    end interface
+
+    interface
+        function hipsolverZgetrsHost(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrsHost')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipsolverZgetrsHost
+    end interface
+
+    ! ******************** GETRS_BATCHED_HOST ********************
+    interface
+        function hipsolverSgetrsBatchedHost(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrsBatchedHost')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrsBatchedHost
+    end interface
+
+    interface
+        function hipsolverDgetrsBatchedHost(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrsBatchedHost')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrsBatchedHost
+    end interface
+
+    interface
+        function hipsolverCgetrsBatchedHost(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrsBatchedHost')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrsBatchedHost
+    end interface
+
+    interface
+        function hipsolverZgetrsBatchedHost(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrsBatchedHost')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrsBatchedHost
+    end interface
+
+    ! ******************** GETRF_COMPACT ********************
+    interface
+        function hipsolverSgetrfCompact(handle, n, Ac, devIpiv, devInfo, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrfCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: Ac
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: devInfo
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrfCompact
+    end interface
+
+    interface
+        function hipsolverDgetrfCompact(handle, n, Ac, devIpiv, devInfo, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrfCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: Ac
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: devInfo
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrfCompact
+    end interface
+
+    interface
+        function hipsolverCgetrfCompact(handle, n, Ac, devIpiv, devInfo, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrfCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: Ac
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: devInfo
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrfCompact
+    end interface
+
+    interface
+        function hipsolverZgetrfCompact(handle, n, Ac, devIpiv, devInfo, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrfCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: Ac
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: devInfo
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrfCompact
+    end interface
+
+    ! ******************** GETRS_COMPACT ********************
+    interface
+        function hipsolverSgetrsCompact(handle, trans, n, nrhs, Ac, devIpiv, Bc, devInfo, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrsCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: Ac
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: Bc
+            type(c_ptr), value :: devInfo
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrsCompact
+    end interface
+
+    interface
+        function hipsolverDgetrsCompact(handle, trans, n, nrhs, Ac, devIpiv, Bc, devInfo, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrsCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: Ac
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: Bc
+            type(c_ptr), value :: devInfo
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrsCompact
+    end interface
+
+    interface
+        function hipsolverCgetrsCompact(handle, trans, n, nrhs, Ac, devIpiv, Bc, devInfo, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrsCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: Ac
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: Bc
+            type(c_ptr), value :: devInfo
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrsCompact
+    end interface
+
+    interface
+        function hipsolverZgetrsCompact(handle, trans, n, nrhs, Ac, devIpiv, Bc, devInfo, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrsCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: Ac
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: Bc
+            type(c_ptr), value :: devInfo
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrsCompact
+    end interface
+
+    ! ******************** MG_GETRF ********************
+    interface
+        function hipsolverMgSgetrf_bufferSize(handle, m, n, A, ia, ja, descA, ipiv, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgSgetrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: lwork
+        end function hipsolverMgSgetrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverMgDgetrf_bufferSize(handle, m, n, A, ia, ja, descA, ipiv, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgDgetrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: lwork
+        end function hipsolverMgDgetrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverMgCgetrf_bufferSize(handle, m, n, A, ia, ja, descA, ipiv, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgCgetrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: lwork
+        end function hipsolverMgCgetrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverMgZgetrf_bufferSize(handle, m, n, A, ia, ja, descA, ipiv, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgZgetrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: lwork
+        end function hipsolverMgZgetrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverMgSgetrf(handle, m, n, A, ia, ja, descA, ipiv, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgSgetrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverMgSgetrf
+    end interface
+
+    interface
+        function hipsolverMgDgetrf(handle, m, n, A, ia, ja, descA, ipiv, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgDgetrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverMgDgetrf
+    end interface
+
+    interface
+        function hipsolverMgCgetrf(handle, m, n, A, ia, ja, descA, ipiv, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgCgetrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverMgCgetrf
+    end interface
+
+    interface
+        function hipsolverMgZgetrf(handle, m, n, A, ia, ja, descA, ipiv, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgZgetrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverMgZgetrf
+    end interface
+
+    ! ******************** MG_POTRF ********************
+    interface
+        function hipsolverMgSpotrf_bufferSize(handle, uplo, n, A, ia, ja, descA, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgSpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_UPPER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: lwork
+        end function hipsolverMgSpotrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverMgDpotrf_bufferSize(handle, uplo, n, A, ia, ja, descA, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgDpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_UPPER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: lwork
+        end function hipsolverMgDpotrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverMgCpotrf_bufferSize(handle, uplo, n, A, ia, ja, descA, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgCpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_UPPER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: lwork
+        end function hipsolverMgCpotrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverMgZpotrf_bufferSize(handle, uplo, n, A, ia, ja, descA, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgZpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_UPPER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: lwork
+        end function hipsolverMgZpotrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverMgSpotrf(handle, uplo, n, A, ia, ja, descA, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgSpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_UPPER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverMgSpotrf
+    end interface
+
+    interface
+        function hipsolverMgDpotrf(handle, uplo, n, A, ia, ja, descA, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgDpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_UPPER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverMgDpotrf
+    end interface
+
+    interface
+        function hipsolverMgCpotrf(handle, uplo, n, A, ia, ja, descA, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgCpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_UPPER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverMgCpotrf
+    end interface
+
+    interface
+        function hipsolverMgZpotrf(handle, uplo, n, A, ia, ja, descA, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgZpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_UPPER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverMgZpotrf
+    end interface
+
+    ! ******************** MG_SYEVD/MG_HEEVD ********************
+    interface
+        function hipsolverMgSsyevd_bufferSize(handle, jobz, uplo, n, A, ia, ja, descA, W, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgSsyevd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_UPPER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: W
+            type(c_ptr), value :: lwork
+        end function hipsolverMgSsyevd_bufferSize
+    end interface
+
+    interface
+        function hipsolverMgDsyevd_bufferSize(handle, jobz, uplo, n, A, ia, ja, descA, W, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgDsyevd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_UPPER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: W
+            type(c_ptr), value :: lwork
+        end function hipsolverMgDsyevd_bufferSize
+    end interface
+
+    interface
+        function hipsolverMgCheevd_bufferSize(handle, jobz, uplo, n, A, ia, ja, descA, W, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgCheevd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_UPPER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: W
+            type(c_ptr), value :: lwork
+        end function hipsolverMgCheevd_bufferSize
+    end interface
+
+    interface
+        function hipsolverMgZheevd_bufferSize(handle, jobz, uplo, n, A, ia, ja, descA, W, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgZheevd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_UPPER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: W
+            type(c_ptr), value :: lwork
+        end function hipsolverMgZheevd_bufferSize
+    end interface
+
+    interface
+        function hipsolverMgSsyevd(handle, jobz, uplo, n, A, ia, ja, descA, W, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgSsyevd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_UPPER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: W
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverMgSsyevd
+    end interface
+
+    interface
+        function hipsolverMgDsyevd(handle, jobz, uplo, n, A, ia, ja, descA, W, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgDsyevd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_UPPER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: W
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverMgDsyevd
+    end interface
+
+    interface
+        function hipsolverMgCheevd(handle, jobz, uplo, n, A, ia, ja, descA, W, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgCheevd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_UPPER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: W
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverMgCheevd
+    end interface
+
+    interface
+        function hipsolverMgZheevd(handle, jobz, uplo, n, A, ia, ja, descA, W, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverMgZheevd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_UPPER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: ia
+            integer(c_int), value :: ja
+            type(c_ptr), value :: descA
+            type(c_ptr), value :: W
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverMgZheevd
+    end interface
+
+    ! ******************** PACK_COMPACT/UNPACK_COMPACT ********************
+    interface
+        function hipsolverSpackCompact(handle, m, n, A, lda, strideA, Ac, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpackCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: Ac
+            integer(c_int), value :: batch_count
+        end function hipsolverSpackCompact
+    end interface
+
+    interface
+        function hipsolverDpackCompact(handle, m, n, A, lda, strideA, Ac, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpackCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: Ac
+            integer(c_int), value :: batch_count
+        end function hipsolverDpackCompact
+    end interface
+
+    interface
+        function hipsolverCpackCompact(handle, m, n, A, lda, strideA, Ac, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpackCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: Ac
+            integer(c_int), value :: batch_count
+        end function hipsolverCpackCompact
+    end interface
+
+    interface
+        function hipsolverZpackCompact(handle, m, n, A, lda, strideA, Ac, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpackCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: Ac
+            integer(c_int), value :: batch_count
+        end function hipsolverZpackCompact
+    end interface
+
+    interface
+        function hipsolverSunpackCompact(handle, m, n, Ac, A, lda, strideA, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSunpackCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: Ac
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            integer(c_int), value :: batch_count
+        end function hipsolverSunpackCompact
+    end interface
+
+    interface
+        function hipsolverDunpackCompact(handle, m, n, Ac, A, lda, strideA, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDunpackCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: Ac
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            integer(c_int), value :: batch_count
+        end function hipsolverDunpackCompact
+    end interface
+
+    interface
+        function hipsolverCunpackCompact(handle, m, n, Ac, A, lda, strideA, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCunpackCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: Ac
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            integer(c_int), value :: batch_count
+        end function hipsolverCunpackCompact
+    end interface
+
+    interface
+        function hipsolverZunpackCompact(handle, m, n, Ac, A, lda, strideA, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZunpackCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: Ac
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            integer(c_int), value :: batch_count
+        end function hipsolverZunpackCompact
+    end interface
+
+    ! ******************** POSV_SUBMIT ********************
+    interface
+        function hipsolverSposvSubmit(queue, uplo, n, nrhs, A, lda, B, ldb, stream, request) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSposvSubmit')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: queue
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: stream
+            type(c_ptr), value :: request
+        end function hipsolverSposvSubmit
+    end interface
+
+    interface
+        function hipsolverDposvSubmit(queue, uplo, n, nrhs, A, lda, B, ldb, stream, request) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDposvSubmit')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: queue
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: stream
+            type(c_ptr), value :: request
+        end function hipsolverDposvSubmit
+    end interface
+
+    interface
+        function hipsolverCposvSubmit(queue, uplo, n, nrhs, A, lda, B, ldb, stream, request) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCposvSubmit')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: queue
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: stream
+            type(c_ptr), value :: request
+        end function hipsolverCposvSubmit
+    end interface
+
+    interface
+        function hipsolverZposvSubmit(queue, uplo, n, nrhs, A, lda, B, ldb, stream, request) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZposvSubmit')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: queue
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: stream
+            type(c_ptr), value :: request
+        end function hipsolverZposvSubmit
+    end interface
+
+    ! ******************** POTRF ********************
+    interface
+        function hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverSpotrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverDpotrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverCpotrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverZpotrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSpotrf
+    end interface
+
+    interface
+        function hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDpotrf
+    end interface
+
+    interface
+        function hipsolverCpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCpotrf
+    end interface
+
+    interface
+        function hipsolverZpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZpotrf
+    end interface
+    
+    ! ******************** POTRF_BATCHED ********************
+    interface
+        function hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfBatched_bufferSize
+    end interface
+
+    interface
+        function hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfBatched
+    end interface
+    
+    interface
+        function hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfBatched
+    end interface
+    
+    interface
+        function hipsolverCpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfBatched
+    end interface
+    
+    interface
+        function hipsolverZpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfBatched
+    end interface
+
+    ! ******************** POTRF_COMPACT ********************
+    interface
+        function hipsolverSpotrfCompact(handle, uplo, n, Ac, devInfo, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: Ac
+            type(c_ptr), value :: devInfo
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfCompact
+    end interface
+
+    interface
+        function hipsolverDpotrfCompact(handle, uplo, n, Ac, devInfo, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: Ac
+            type(c_ptr), value :: devInfo
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfCompact
+    end interface
+
+    interface
+        function hipsolverCpotrfCompact(handle, uplo, n, Ac, devInfo, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: Ac
+            type(c_ptr), value :: devInfo
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfCompact
+    end interface
+
+    interface
+        function hipsolverZpotrfCompact(handle, uplo, n, Ac, devInfo, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfCompact')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: Ac
+            type(c_ptr), value :: devInfo
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfCompact
+    end interface
+
+    ! ******************** POTRF_OUT_OF_CORE ********************
+    interface
+        function hipsolverSpotrfOutOfCore(handle, uplo, n, A, lda, deviceBudget, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfOutOfCore')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_size_t), value :: deviceBudget
+            type(c_ptr), value :: info
+        end function hipsolverSpotrfOutOfCore
+    end interface
+
+    interface
+        function hipsolverDpotrfOutOfCore(handle, uplo, n, A, lda, deviceBudget, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfOutOfCore')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_size_t), value :: deviceBudget
+            type(c_ptr), value :: info
+        end function hipsolverDpotrfOutOfCore
+    end interface
+
+    interface
+        function hipsolverCpotrfOutOfCore(handle, uplo, n, A, lda, deviceBudget, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfOutOfCore')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_size_t), value :: deviceBudget
+            type(c_ptr), value :: info
+        end function hipsolverCpotrfOutOfCore
+    end interface
+
+    interface
+        function hipsolverZpotrfOutOfCore(handle, uplo, n, A, lda, deviceBudget, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfOutOfCore')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_size_t), value :: deviceBudget
+            type(c_ptr), value :: info
+        end function hipsolverZpotrfOutOfCore
+    end interface
+
+    ! ******************** POTRS_OUT_OF_CORE ********************
+    interface
+        function hipsolverSpotrsOutOfCore(handle, uplo, n, nrhs, A, lda, B, ldb, deviceBudget, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrsOutOfCore')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_size_t), value :: deviceBudget
+            type(c_ptr), value :: info
+        end function hipsolverSpotrsOutOfCore
+    end interface
+
+    interface
+        function hipsolverDpotrsOutOfCore(handle, uplo, n, nrhs, A, lda, B, ldb, deviceBudget, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrsOutOfCore')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_size_t), value :: deviceBudget
+            type(c_ptr), value :: info
+        end function hipsolverDpotrsOutOfCore
+    end interface
+
+    interface
+        function hipsolverCpotrsOutOfCore(handle, uplo, n, nrhs, A, lda, B, ldb, deviceBudget, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrsOutOfCore')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_size_t), value :: deviceBudget
+            type(c_ptr), value :: info
+        end function hipsolverCpotrsOutOfCore
+    end interface
+
+    interface
+        function hipsolverZpotrsOutOfCore(handle, uplo, n, nrhs, A, lda, B, ldb, deviceBudget, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrsOutOfCore')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_size_t), value :: deviceBudget
+            type(c_ptr), value :: info
+        end function hipsolverZpotrsOutOfCore
+    end interface
+
+    ! ******************** SYEVD/HEEVD ********************
+    interface
+        function hipsolverSsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSsyevd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: lwork
+        end function hipsolverSsyevd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDsyevd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: lwork
+        end function hipsolverDsyevd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCheevd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: lwork
+        end function hipsolverCheevd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZheevd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: lwork
+        end function hipsolverZheevd_bufferSize
+    end interface
+
+    interface
+        function hipsolverSsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSsyevd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSsyevd
+    end interface
+
+    interface
+        function hipsolverDsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDsyevd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDsyevd
+    end interface
+
+    interface
+        function hipsolverCheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCheevd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCheevd
+    end interface
+
+    interface
+        function hipsolverZheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZheevd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZheevd
+    end interface
+
+    ! ******************** SYGVD/HEGVD ********************
+    interface
+        function hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSsygvd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: D
+            type(c_ptr), value :: lwork
+        end function hipsolverSsygvd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDsygvd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: D
+            type(c_ptr), value :: lwork
+        end function hipsolverDsygvd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverChegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverChegvd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: D
+            type(c_ptr), value :: lwork
+        end function hipsolverChegvd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZhegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZhegvd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: D
+            type(c_ptr), value :: lwork
+        end function hipsolverZhegvd_bufferSize
+    end interface
+
+    interface
+        function hipsolverSsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSsygvd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: D
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSsygvd
+    end interface
+
+    interface
+        function hipsolverDsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDsygvd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: D
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDsygvd
+    end interface
+
+    interface
+        function hipsolverChegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverChegvd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: D
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverChegvd
+    end interface
+
+    interface
+        function hipsolverZhegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZhegvd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: D
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZhegvd
+    end interface
+
+    ! ******************** SYGVD_PIPELINED/HEGVD_PIPELINED ********************
+    interface
+        function hipsolverSsygvdPipelined_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSsygvdPipelined_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: D
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSsygvdPipelined_bufferSize
+    end interface
+
+    interface
+        function hipsolverDsygvdPipelined_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDsygvdPipelined_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: D
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDsygvdPipelined_bufferSize
+    end interface
+
+    interface
+        function hipsolverChegvdPipelined_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverChegvdPipelined_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: D
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverChegvdPipelined_bufferSize
+    end interface
+
+    interface
+        function hipsolverZhegvdPipelined_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZhegvdPipelined_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: D
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZhegvdPipelined_bufferSize
+    end interface
+
+    interface
+        function hipsolverSsygvdPipelined(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSsygvdPipelined')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: D
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSsygvdPipelined
+    end interface
+
+    interface
+        function hipsolverDsygvdPipelined(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDsygvdPipelined')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: D
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDsygvdPipelined
+    end interface
+
+    interface
+        function hipsolverChegvdPipelined(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverChegvdPipelined')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: D
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverChegvdPipelined
+    end interface
+
+    interface
+        function hipsolverZhegvdPipelined(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZhegvdPipelined')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: D
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZhegvdPipelined
+    end interface
+
+    ! ******************** SYTRD/HETRD ********************
+    interface
+        function hipsolverSsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSsytrd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: lwork
-        end function hipsolverCheevd_bufferSize
+        end function hipsolverSsytrd_bufferSize
     end interface
     
     interface
-        function hipsolverZheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork) &
+        function hipsolverDsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZheevd_bufferSize')
+                bind(c, name = 'hipsolverDsytrd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: lwork
-        end function hipsolverZheevd_bufferSize
+        end function hipsolverDsytrd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverChetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverChetrd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: lwork
+        end function hipsolverChetrd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZhetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZhetrd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: lwork
+        end function hipsolverZhetrd_bufferSize
     end interface
 
     interface
-        function hipsolverSsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+        function hipsolverSsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSsyevd')
+                bind(c, name = 'hipsolverSsytrd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSsyevd
+        end function hipsolverSsytrd
     end interface
 
     interface
-        function hipsolverDsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+        function hipsolverDsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDsyevd')
+                bind(c, name = 'hipsolverDsytrd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDsyevd
+        end function hipsolverDsytrd
     end interface
 
     interface
-        function hipsolverCheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+        function hipsolverChetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCheevd')
+                bind(c, name = 'hipsolverChetrd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCheevd
+        end function hipsolverChetrd
     end interface
 
     interface
-        function hipsolverZheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+        function hipsolverZhetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZheevd')
+                bind(c, name = 'hipsolverZhetrd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZheevd
+        end function hipsolverZhetrd
     end interface
 
-    ! ******************** SYGVD/HEGVD ********************
+    ! ******************** SYTRF ********************
     interface
-        function hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+        function hipsolverSsytrf_bufferSize(handle, n, A, lda, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSsygvd_bufferSize')
+                bind(c, name = 'hipsolverSsytrf_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: D
             type(c_ptr), value :: lwork
-        end function hipsolverSsygvd_bufferSize
+        end function hipsolverSsytrf_bufferSize
     end interface
-    
+
     interface
-        function hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+        function hipsolverDsytrf_bufferSize(handle, n, A, lda, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDsygvd_bufferSize')
+                bind(c, name = 'hipsolverDsytrf_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: D
             type(c_ptr), value :: lwork
-        end function hipsolverDsygvd_bufferSize
+        end function hipsolverDsytrf_bufferSize
     end interface
-    
+
     interface
-        function hipsolverChegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+        function hipsolverCsytrf_bufferSize(handle, n, A, lda, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverChegvd_bufferSize')
+                bind(c, name = 'hipsolverCsytrf_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: D
             type(c_ptr), value :: lwork
-        end function hipsolverChegvd_bufferSize
+        end function hipsolverCsytrf_bufferSize
     end interface
-    
+
     interface
-        function hipsolverZhegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+        function hipsolverZsytrf_bufferSize(handle, n, A, lda, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZhegvd_bufferSize')
+                bind(c, name = 'hipsolverZsytrf_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: D
             type(c_ptr), value :: lwork
-        end function hipsolverZhegvd_bufferSize
+        end function hipsolverZsytrf_bufferSize
     end interface
 
     interface
-        function hipsolverSsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+        function hipsolverSsytrf(handle, uplo, n, A, lda, devIpiv, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSsygvd')
+                bind(c, name = 'hipsolverSsytrf')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: D
+            type(c_ptr), value :: devIpiv
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSsygvd
+        end function hipsolverSsytrf
     end interface
 
     interface
-        function hipsolverDsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+        function hipsolverDsytrf(handle, uplo, n, A, lda, devIpiv, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDsygvd')
+                bind(c, name = 'hipsolverDsytrf')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: D
+            type(c_ptr), value :: devIpiv
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDsygvd
+        end function hipsolverDsytrf
     end interface
 
     interface
-        function hipsolverChegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+        function hipsolverCsytrf(handle, uplo, n, A, lda, devIpiv, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverChegvd')
+                bind(c, name = 'hipsolverCsytrf')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: D
+            type(c_ptr), value :: devIpiv
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverChegvd
+        end function hipsolverCsytrf
     end interface
 
     interface
-        function hipsolverZhegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+        function hipsolverZsytrf(handle, uplo, n, A, lda, devIpiv, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZhegvd')
+                bind(c, name = 'hipsolverZsytrf')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: D
+            type(c_ptr), value :: devIpiv
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZhegvd
+        end function hipsolverZsytrf
     end interface
 
-    ! ******************** SYTRD/HETRD ********************
+    ! ******************** SYTRS ********************
     interface
-        function hipsolverSsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
+        function hipsolverSsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSsytrd_bufferSize')
+                bind(c, name = 'hipsolverSsytrs_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: lwork
-        end function hipsolverSsytrd_bufferSize
+        end function hipsolverSsytrs_bufferSize
     end interface
-    
+
     interface
-        function hipsolverDsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
+        function hipsolverDsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDsytrd_bufferSize')
+                bind(c, name = 'hipsolverDsytrs_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: lwork
-        end function hipsolverDsytrd_bufferSize
+        end function hipsolverDsytrs_bufferSize
     end interface
-    
+
     interface
-        function hipsolverChetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
+        function hipsolverCsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverChetrd_bufferSize')
+                bind(c, name = 'hipsolverCsytrs_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: lwork
-        end function hipsolverChetrd_bufferSize
+        end function hipsolverCsytrs_bufferSize
     end interface
-    
+
     interface
-        function hipsolverZhetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
+        function hipsolverZsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZhetrd_bufferSize')
+                bind(c, name = 'hipsolverZsytrs_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: lwork
-        end function hipsolverZhetrd_bufferSize
+        end function hipsolverZsytrs_bufferSize
     end interface
 
     interface
-        function hipsolverSsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+        function hipsolverSsytrs(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSsytrd')
+                bind(c, name = 'hipsolverSsytrs')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSsytrd
+        end function hipsolverSsytrs
     end interface
 
     interface
-        function hipsolverDsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+        function hipsolverDsytrs(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDsytrd')
+                bind(c, name = 'hipsolverDsytrs')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDsytrd
+        end function hipsolverDsytrs
     end interface
 
     interface
-        function hipsolverChetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+        function hipsolverCsytrs(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverChetrd')
+                bind(c, name = 'hipsolverCsytrs')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverChetrd
+        end function hipsolverCsytrs
     end interface
 
     interface
-        function hipsolverZhetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+        function hipsolverZsytrs(handle, uplo, n, nrhs, A, lda, devIpiv, B, ldb, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZhetrd')
+                bind(c, name = 'hipsolverZsytrs')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tau
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZhetrd
+        end function hipsolverZsytrs
     end interface
     
 end module hipsolver
@@ -0,0 +1,148 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "lapack_routines.hpp"
+#include <memory>
+
+/*
+ * ===========================================================================
+ *    Batch queue and completion objects of the host backend. There is no
+ *    device to coalesce requests for or to poll, so a request is solved when
+ *    it is submitted, once the work enqueued on its stream is done, and a
+ *    completion is complete as soon as it is recorded; its callback runs on
+ *    the thread that records it.
+ * ===========================================================================
+ */
+
+/******************** BATCH QUEUE ********************/
+// the object behind a hipsolverBatchQueue_t; the limits are only validated
+struct hipsolver_host_batch_queue
+{
+    int max_batch = 1;
+    int window_us = 0;
+};
+
+// the object behind a hipsolverBatchRequest_t, which is always done
+struct hipsolver_host_batch_request
+{
+    int info = 0;
+};
+
+inline hipsolverStatus_t
+    hipsolver_batch_queue_create(hipsolver_host_batch_queue** queue, int max_batch, int window_us)
+{
+    if(!queue)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(max_batch < 1 || window_us < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_host_batch_queue* q = new hipsolver_host_batch_queue;
+    q->max_batch                  = max_batch;
+    q->window_us                  = window_us;
+    *queue                        = q;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/* Solves A * X = B for the Hermitian positive definite A, overwriting A with
+   its Cholesky factor and B with X, and returns a request holding the info
+   of the factorization. */
+template <typename T>
+hipsolverStatus_t hipsolver_posv_submit(hipsolver_host_batch_queue*    queue,
+                                        char                           uplo,
+                                        int                            n,
+                                        int                            nrhs,
+                                        T*                             A,
+                                        int                            lda,
+                                        T*                             B,
+                                        int                            ldb,
+                                        hipStream_t                    stream,
+                                        hipsolver_host_batch_request** request)
+{
+    if(!queue)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nrhs < 0 || lda < std::max(1, n) || (nrhs > 0 && ldb < std::max(1, n)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!request || (n > 0 && !A) || (n > 0 && nrhs > 0 && !B))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    std::unique_ptr<hipsolver_host_batch_request> req(new hipsolver_host_batch_request);
+    if(n > 0)
+    {
+        if(hipStreamSynchronize(stream) != hipSuccess)
+            return HIPSOLVER_STATUS_EXECUTION_FAILED;
+
+        hipsolver_potrf_factor(uplo, n, A, lda, &req->info);
+        if(req->info == 0 && nrhs > 0)
+        {
+            int iinfo;
+            lapackCall_potrs(uplo, n, nrhs, A, lda, B, ldb, &iinfo);
+            HIPSOLVER_RETURN_IF_ERROR(hipsolver_lapack_status(iinfo));
+        }
+    }
+
+    *request = req.release();
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** COMPLETION ********************/
+// the object behind a hipsolverCompletion_t
+struct hipsolver_host_completion
+{
+    std::mutex       mutex;
+    std::vector<int> info;
+
+    hipsolverCompletionCallback_t callback  = nullptr;
+    void*                         user_data = nullptr;
+
+    void set_callback(hipsolverCompletionCallback_t cb, void* data)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        callback  = cb;
+        user_data = data;
+    }
+
+    // copies the count values of info and runs the callback, if any
+    void record(const int* values, int count)
+    {
+        hipsolverCompletionCallback_t cb;
+        void*                         data;
+        std::vector<int>              copy(values, values + count);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            info = copy;
+            cb   = callback;
+            data = user_data;
+        }
+
+        if(cb)
+            cb(HIPSOLVER_STATUS_SUCCESS, copy.data(), count, data);
+    }
+
+    // copies the recorded info into out, if not null
+    void get(int* out)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(out)
+            std::copy(info.begin(), info.end(), out);
+    }
+};
+
+/* Records the count values of devInfo in completion once the work enqueued on
+   the stream of handle is done. */
+inline hipsolverStatus_t hipsolver_completion_record(hipsolver_host_handle*     handle,
+                                                     const int*                 devInfo,
+                                                     int                        count,
+                                                     hipsolver_host_completion* completion)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!completion || count < 0 || (count > 0 && !devInfo))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    completion->record(devInfo, count);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
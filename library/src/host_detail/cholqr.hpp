@@ -0,0 +1,121 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "lapack_routines.hpp"
+
+/*
+ * ===========================================================================
+ *    CholeskyQR2 and shifted CholeskyQR3 of a tall m-by-n matrix, as in the
+ *    rocSOLVER backend: each pass forms the Gram matrix G = A' * A, factorizes
+ *    it as U' * U and overwrites A with A * U^-1, and R is the product of the
+ *    factors of the passes. The first pass of CholeskyQR3 factorizes G + s * I
+ *    so that it succeeds on ill-conditioned matrices.
+ * ===========================================================================
+ */
+
+inline hipsolverStatus_t hipsolver_cholqr_argCheck(int m, int n, int lda, int ldr)
+{
+    if(m < 0 || n < 0 || m < n || lda < m || ldr < n)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// the Gram matrix and the info of the passes not reported
+template <typename T>
+int hipsolver_cholqr_worksize(int n)
+{
+    return std::max(1, n * n);
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_cholqr_bufferSize_template(
+    hipsolver_host_handle* handle, int m, int n, int lda, int ldr, int* lwork)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_cholqr_argCheck(m, n, lda, ldr));
+
+    if(n > 0)
+        *lwork = hipsolver_cholqr_worksize<T>(n);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/* Overwrites A with Q and writes R into the upper triangular part of R; the
+   strictly lower triangular part of R is set to zero. info reports the
+   Cholesky factorization of the first unshifted pass. */
+template <typename T>
+hipsolverStatus_t hipsolver_cholqr_template(hipsolver_host_handle* handle,
+                                            bool                   shifted,
+                                            int                    m,
+                                            int                    n,
+                                            T*                     A,
+                                            int                    lda,
+                                            T*                     R,
+                                            int                    ldr,
+                                            T*                     work,
+                                            int                    lwork,
+                                            int*                   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_cholqr_argCheck(m, n, lda, ldr));
+    if((m && n && !A) || (n && !R) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    *info = 0;
+    if(n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    using S = decltype(std::real(T{}));
+
+    hipsolver_host_workspace<T> w(work, lwork, hipsolver_cholqr_worksize<T>(n));
+    T*                          G = w.data();
+
+    int passes = shifted ? 3 : 2;
+    for(int k = 0; k < passes; k++)
+    {
+        // G = A' * A
+        lapackCall_gemm('C', 'N', n, n, m, T(1), A, lda, A, lda, T(0), G, n);
+
+        if(shifted && k == 0)
+        {
+            // G = G + s * I with s = 11 * (m * n + n * (n + 1)) * u * ||A||_F^2, which
+            // bounds the shift proposed for ||A||_2^2 from above
+            S trace = 0;
+            for(int i = 0; i < n; i++)
+                trace += std::abs(G[i + size_t(i) * n]);
+
+            S shift = 11 * (S(m) * n + S(n) * (n + 1)) * std::numeric_limits<S>::epsilon() * trace;
+            for(int i = 0; i < n; i++)
+                G[i + size_t(i) * n] += T(shift);
+        }
+
+        // G = U' * U; only the first unshifted pass reports its result in info
+        int  iinfo;
+        int* pass_info = (k == (shifted ? 1 : 0)) ? info : &iinfo;
+        lapackCall_potrf('U', n, G, n, pass_info);
+        HIPSOLVER_RETURN_IF_ERROR(hipsolver_lapack_status(*pass_info));
+
+        // A = A * U^-1
+        lapackCall_trsm('R', 'U', 'N', 'N', m, n, T(1), G, n, A, lda);
+
+        // R = U_k * ... * U_1
+        if(k == 0)
+        {
+            for(int j = 0; j < n; j++)
+                for(int i = 0; i < n; i++)
+                    R[i + size_t(j) * ldr] = i <= j ? G[i + size_t(j) * n] : T(0);
+        }
+        else
+            lapackCall_trmm('L', 'U', 'N', 'N', n, n, T(1), G, n, R, ldr);
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
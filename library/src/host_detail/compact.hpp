@@ -0,0 +1,498 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "lapack_routines.hpp"
+
+/*
+ * ===========================================================================
+ *    Compact batch layout. The matrices of a batch are interleaved in groups
+ *    of W = HIPSOLVER_COMPACT_GROUP_BYTES / sizeof(T) matrices: element (i,j)
+ *    of the W matrices of a group is stored in W consecutive entries, one
+ *    per matrix. Every loop of the kernels below but the row interchanges
+ *    runs over the W lanes of a group innermost, with no dependence between
+ *    the lanes, so that the compiler vectorizes it with one matrix per vector
+ *    lane; a call for a whole group costs about as much as LAPACK would for a
+ *    single matrix.
+ *    The pivots are chosen as in LAPACK.
+ * ===========================================================================
+ */
+
+// number of matrices in a group of the compact layout
+template <typename T>
+constexpr int hipsolver_compact_width()
+{
+    return HIPSOLVER_COMPACT_GROUP_BYTES / sizeof(T);
+}
+
+/******************** HELPERS ********************/
+// the products and reciprocals of complex numbers are spelled out, as the
+// operators of std::complex handle infinities and NaNs out of line and do not vectorize
+template <typename T>
+inline T hipsolver_compact_mul(T a, T b)
+{
+    return a * b;
+}
+template <typename S>
+inline std::complex<S> hipsolver_compact_mul(std::complex<S> a, std::complex<S> b)
+{
+    return std::complex<S>(a.real() * b.real() - a.imag() * b.imag(),
+                           a.real() * b.imag() + a.imag() * b.real());
+}
+
+template <typename T>
+inline T hipsolver_compact_inv(T a)
+{
+    return T(1) / a;
+}
+template <typename S>
+inline std::complex<S> hipsolver_compact_inv(std::complex<S> a)
+{
+    S s = S(1) / (a.real() * a.real() + a.imag() * a.imag());
+    return std::complex<S>(a.real() * s, -a.imag() * s);
+}
+
+template <typename T>
+inline T hipsolver_compact_abs2(T a)
+{
+    return a * a;
+}
+template <typename S>
+inline S hipsolver_compact_abs2(std::complex<S> a)
+{
+    return a.real() * a.real() + a.imag() * a.imag();
+}
+
+// y[l] -= a[l] * x[l], or a[l] * conj(x[l]) if CONJ, for the W lanes of a group
+template <bool CONJ = false, typename T>
+inline void hipsolver_compact_fms(T* __restrict y, const T* __restrict a, const T* __restrict x)
+{
+    constexpr int W = hipsolver_compact_width<T>();
+    for(int l = 0; l < W; l++)
+        y[l] -= hipsolver_compact_mul(a[l], CONJ ? hipsolver_kernel_conj(x[l]) : x[l]);
+}
+
+// y[l] = y[l] * r[l] for the W lanes of a group
+template <typename T>
+inline void hipsolver_compact_scale(T* __restrict y, const T* __restrict r)
+{
+    constexpr int W = hipsolver_compact_width<T>();
+    for(int l = 0; l < W; l++)
+        y[l] = hipsolver_compact_mul(y[l], r[l]);
+}
+
+/* Interchanges row j with row p[l] >= j in lane l of the n-by-ncols matrix A
+   of a group. The lanes are swapped one at a time: vector blends over every
+   row selected by some lane touch more memory than the scalar swaps. */
+template <typename T, typename S>
+inline void hipsolver_compact_swap(int n, int ncols, T* A, int j, const S* p)
+{
+    constexpr int W = hipsolver_compact_width<T>();
+
+    for(int l = 0; l < W; l++)
+    {
+        int i = int(p[l]);
+        if(i == j)
+            continue;
+        for(int k = 0; k < ncols; k++)
+            std::swap(A[(j + k * n) * W + l], A[(i + k * n) * W + l]);
+    }
+}
+
+/******************** PACK/UNPACK ********************/
+inline hipsolverStatus_t hipsolver_pack_compact_argCheck(hipsolver_host_handle* handle,
+                                                         int                    m,
+                                                         int                    n,
+                                                         int                    lda,
+                                                         const void*            A,
+                                                         const void*            Ac,
+                                                         int                    batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(m < 0 || n < 0 || lda < m || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(m && n && batch_count && (!A || !Ac))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// the lanes of the last group that hold no matrix are set to zero
+template <typename T>
+hipsolverStatus_t hipsolver_pack_compact_template(hipsolver_host_handle* handle,
+                                                  int                    m,
+                                                  int                    n,
+                                                  const T*               A,
+                                                  int                    lda,
+                                                  int                    strideA,
+                                                  T*                     Ac,
+                                                  int                    batch_count)
+{
+    HIPSOLVER_RETURN_IF_ERROR(
+        hipsolver_pack_compact_argCheck(handle, m, n, lda, A, Ac, batch_count));
+    HIPSOLVER_HOST_SYNC(handle);
+
+    constexpr int W       = hipsolver_compact_width<T>();
+    int           ngroups = (batch_count + W - 1) / W;
+    size_t        mn      = size_t(m) * n;
+
+    hipsolver_host_parallel_for(handle, ngroups, [&](int g) {
+        T*  G     = Ac + g * mn * W;
+        int lanes = std::min(W, batch_count - g * W);
+        for(int l = 0; l < W; l++)
+        {
+            const T* Ab = A + (size_t(g) * W + l) * strideA;
+            for(int j = 0; j < n; j++)
+                for(int i = 0; i < m; i++)
+                    G[(i + size_t(j) * m) * W + l] = l < lanes ? Ab[i + size_t(j) * lda] : T(0);
+        }
+    });
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_unpack_compact_template(hipsolver_host_handle* handle,
+                                                    int                    m,
+                                                    int                    n,
+                                                    const T*               Ac,
+                                                    T*                     A,
+                                                    int                    lda,
+                                                    int                    strideA,
+                                                    int                    batch_count)
+{
+    HIPSOLVER_RETURN_IF_ERROR(
+        hipsolver_pack_compact_argCheck(handle, m, n, lda, A, Ac, batch_count));
+    HIPSOLVER_HOST_SYNC(handle);
+
+    constexpr int W       = hipsolver_compact_width<T>();
+    int           ngroups = (batch_count + W - 1) / W;
+    size_t        mn      = size_t(m) * n;
+
+    hipsolver_host_parallel_for(handle, ngroups, [&](int g) {
+        const T* G     = Ac + g * mn * W;
+        int      lanes = std::min(W, batch_count - g * W);
+        for(int l = 0; l < lanes; l++)
+        {
+            T* Ab = A + (size_t(g) * W + l) * strideA;
+            for(int j = 0; j < n; j++)
+                for(int i = 0; i < m; i++)
+                    Ab[i + size_t(j) * lda] = G[(i + size_t(j) * m) * W + l];
+        }
+    });
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** POTRF_COMPACT ********************/
+/* Factorizes the W matrices of a group. A lane that is not positive definite
+   records the first failing column in info and is computed on regardless, so
+   its factor is undefined. */
+template <typename T>
+void hipsolver_compact_potrf(char uplo, int n, T* A, int* info)
+{
+    using S         = decltype(std::real(T{}));
+    constexpr int W = hipsolver_compact_width<T>();
+    bool upper      = (uplo == 'U');
+
+    S   d[W];
+    T   r[W], acc[W];
+    int linfo[W] = {};
+
+    // the stored element L(i,j) or U(j,i) of the factor
+    auto F = [&](int i, int j) { return upper ? A + (j + i * n) * W : A + (i + j * n) * W; };
+
+    for(int j = 0; j < n; j++)
+    {
+        T* Fjj = A + (j + j * n) * W;
+        for(int l = 0; l < W; l++)
+            d[l] = std::real(Fjj[l]);
+        for(int k = 0; k < j; k++)
+        {
+            const T* Fjk = F(j, k);
+            for(int l = 0; l < W; l++)
+                d[l] -= hipsolver_compact_abs2(Fjk[l]);
+        }
+        for(int l = 0; l < W; l++)
+        {
+            linfo[l] = (linfo[l] == 0 && !(d[l] > 0)) ? j + 1 : linfo[l];
+            d[l]     = std::sqrt(d[l]);
+            Fjj[l]   = d[l];
+            r[l]     = S(1) / d[l];
+        }
+
+        // column j of L, or row j of U; as U = L^H, both are
+        // (A(i,j) - sum of F(i,k) * conj(F(j,k))) / F(j,j) with F(i,k) the stored L(i,k) or U(k,i)
+        for(int i = j + 1; i < n; i++)
+        {
+            T* Fij = F(i, j);
+            for(int l = 0; l < W; l++)
+                acc[l] = Fij[l];
+            for(int k = 0; k < j; k++)
+                hipsolver_compact_fms<true>(acc, F(i, k), F(j, k));
+            hipsolver_compact_scale(acc, r);
+            std::copy(acc, acc + W, Fij);
+        }
+    }
+
+    for(int l = 0; l < W; l++)
+        info[l] = linfo[l];
+}
+
+inline hipsolverStatus_t
+    hipsolver_compact_argCheck(hipsolver_host_handle* handle, int n, int nrhs, int batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || n > HIPSOLVER_COMPACT_MAX_SIZE || nrhs < 0 || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_potrf_compact_template(
+    hipsolver_host_handle* handle, char uplo, int n, T* Ac, int* info, int batch_count)
+{
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_compact_argCheck(handle, n, 0, batch_count));
+    if((n && batch_count && !Ac) || (batch_count && !info))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    constexpr int W       = hipsolver_compact_width<T>();
+    int           ngroups = (batch_count + W - 1) / W;
+    size_t        nn      = size_t(n) * n;
+
+    hipsolver_host_parallel_for(handle, ngroups, [&](int g) {
+        int linfo[W];
+        hipsolver_compact_potrf(uplo, n, Ac + g * nn * W, linfo);
+        std::copy(linfo, linfo + std::min(W, batch_count - g * W), info + g * W);
+    });
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** GETRF_COMPACT ********************/
+/* Factorizes the W matrices of a group with partial pivoting. As in LAPACK, a
+   zero pivot is recorded in info and its column is left unscaled. The
+   pivots of lane l are written to ipiv[l * n + j], and only the first
+   lanes lanes are written to ipiv and info. */
+template <typename T>
+void hipsolver_compact_getrf(int n, T* A, int* ipiv, int* info, int lanes)
+{
+    using S         = decltype(std::real(T{}));
+    constexpr int W = hipsolver_compact_width<T>();
+
+    // the rows of the pivots are kept as S, so that the search only involves one vector type
+    S   amax[W], p[W];
+    T   r[W];
+    int linfo[W] = {};
+
+    auto E = [&](int i, int j) { return A + (i + j * n) * W; };
+
+    for(int j = 0; j < n; j++)
+    {
+        // choose the pivots
+        const T* Ejj = E(j, j);
+        for(int l = 0; l < W; l++)
+        {
+            p[l]    = j;
+            amax[l] = hipsolver_kernel_abs1(Ejj[l]);
+        }
+        for(int i = j + 1; i < n; i++)
+        {
+            const T* Eij = E(i, j);
+            for(int l = 0; l < W; l++)
+            {
+                S a     = hipsolver_kernel_abs1(Eij[l]);
+                p[l]    = a > amax[l] ? S(i) : p[l];
+                amax[l] = a > amax[l] ? a : amax[l];
+            }
+        }
+
+        // interchange the rows
+        for(int l = 0; l < lanes; l++)
+            ipiv[l * n + j] = int(p[l]) + 1;
+        hipsolver_compact_swap(n, n, A, j, p);
+
+        // scale the column below the pivot
+        for(int l = 0; l < W; l++)
+        {
+            bool zero = (Ejj[l] == T(0));
+            linfo[l]  = (linfo[l] == 0 && zero) ? j + 1 : linfo[l];
+            r[l]      = zero ? T(1) : hipsolver_compact_inv(Ejj[l]);
+        }
+        for(int i = j + 1; i < n; i++)
+            hipsolver_compact_scale(E(i, j), r);
+
+        // update the trailing matrix
+        for(int k = j + 1; k < n; k++)
+            for(int i = j + 1; i < n; i++)
+                hipsolver_compact_fms(E(i, k), E(i, j), E(j, k));
+    }
+
+    for(int l = 0; l < lanes; l++)
+        info[l] = linfo[l];
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_getrf_compact_template(
+    hipsolver_host_handle* handle, int n, T* Ac, int* ipiv, int* info, int batch_count)
+{
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_compact_argCheck(handle, n, 0, batch_count));
+    if((n && batch_count && (!Ac || !ipiv)) || (batch_count && !info))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    constexpr int W       = hipsolver_compact_width<T>();
+    int           ngroups = (batch_count + W - 1) / W;
+    size_t        nn      = size_t(n) * n;
+
+    hipsolver_host_parallel_for(handle, ngroups, [&](int g) {
+        hipsolver_compact_getrf(n,
+                                Ac + g * nn * W,
+                                ipiv + size_t(g) * W * n,
+                                info + g * W,
+                                std::min(W, batch_count - g * W));
+    });
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** GETRS_COMPACT ********************/
+// interchanges rows i and ipiv[l * n + i] - 1 of lane l of the n-by-nrhs B
+template <typename T>
+inline void hipsolver_compact_laswp(int n, int nrhs, T* B, int i, const int* ipiv, int lanes)
+{
+    using S         = decltype(std::real(T{}));
+    constexpr int W = hipsolver_compact_width<T>();
+
+    S p[W];
+    for(int l = 0; l < W; l++)
+        p[l] = l < lanes ? S(ipiv[l * n + i] - 1) : S(i);
+    hipsolver_compact_swap(n, nrhs, B, i, p);
+}
+
+/* Solves op(A) * X = B for the W matrices of a group, from the LU factors of
+   A. The lanes past lanes have no pivots and are solved without
+   interchanges. */
+template <typename T>
+void hipsolver_compact_getrs(
+    char trans, int n, int nrhs, const T* A, const int* ipiv, T* B, int lanes)
+{
+    constexpr int W    = hipsolver_compact_width<T>();
+    bool          conj = (trans == 'C');
+
+    // the reciprocals of the diagonal of U
+    T r[HIPSOLVER_COMPACT_MAX_SIZE][W];
+    for(int k = 0; k < n; k++)
+    {
+        const T* Akk = A + (k + k * n) * W;
+        for(int l = 0; l < W; l++)
+            r[k][l] = hipsolver_compact_inv(conj ? hipsolver_kernel_conj(Akk[l]) : Akk[l]);
+    }
+
+    auto E = [&](int i, int j) { return A + (i + j * n) * W; };
+
+    if(trans == 'N')
+    {
+        for(int i = 0; i < n; i++)
+            hipsolver_compact_laswp(n, nrhs, B, i, ipiv, lanes);
+
+        for(int c = 0; c < nrhs; c++)
+        {
+            T* Bc = B + c * n * W;
+
+            // L * Y = B
+            for(int k = 0; k < n; k++)
+            {
+                for(int i = k + 1; i < n; i++)
+                {
+                    const T* Eik = E(i, k);
+                    for(int l = 0; l < W; l++)
+                        Bc[i * W + l] -= hipsolver_compact_mul(Eik[l], Bc[k * W + l]);
+                }
+            }
+
+            // U * X = Y
+            for(int k = n - 1; k >= 0; k--)
+            {
+                for(int l = 0; l < W; l++)
+                    Bc[k * W + l] = hipsolver_compact_mul(Bc[k * W + l], r[k][l]);
+                for(int i = 0; i < k; i++)
+                {
+                    const T* Eik = E(i, k);
+                    for(int l = 0; l < W; l++)
+                        Bc[i * W + l] -= hipsolver_compact_mul(Eik[l], Bc[k * W + l]);
+                }
+            }
+        }
+    }
+    else
+    {
+        auto op = [conj](T a) { return conj ? hipsolver_kernel_conj(a) : a; };
+
+        for(int c = 0; c < nrhs; c++)
+        {
+            T* Bc = B + c * n * W;
+
+            // op(U) * Y = B
+            for(int k = 0; k < n; k++)
+            {
+                for(int i = 0; i < k; i++)
+                {
+                    const T* Eik = E(i, k);
+                    for(int l = 0; l < W; l++)
+                        Bc[k * W + l] -= hipsolver_compact_mul(op(Eik[l]), Bc[i * W + l]);
+                }
+                for(int l = 0; l < W; l++)
+                    Bc[k * W + l] = hipsolver_compact_mul(Bc[k * W + l], r[k][l]);
+            }
+
+            // op(L) * X = Y
+            for(int k = n - 1; k >= 0; k--)
+            {
+                for(int i = k + 1; i < n; i++)
+                {
+                    const T* Eik = E(i, k);
+                    for(int l = 0; l < W; l++)
+                        Bc[k * W + l] -= hipsolver_compact_mul(op(Eik[l]), Bc[i * W + l]);
+                }
+            }
+        }
+
+        for(int i = n - 1; i >= 0; i--)
+            hipsolver_compact_laswp(n, nrhs, B, i, ipiv, lanes);
+    }
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_getrs_compact_template(hipsolver_host_handle* handle,
+                                                   char                   trans,
+                                                   int                    n,
+                                                   int                    nrhs,
+                                                   const T*               Ac,
+                                                   const int*             ipiv,
+                                                   T*                     Bc,
+                                                   int*                   info,
+                                                   int                    batch_count)
+{
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_compact_argCheck(handle, n, nrhs, batch_count));
+    if((n && batch_count && (!Ac || !ipiv)) || (n && nrhs && batch_count && !Bc) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    constexpr int W       = hipsolver_compact_width<T>();
+    int           ngroups = (batch_count + W - 1) / W;
+    size_t        nn      = size_t(n) * n;
+    size_t        nb      = size_t(n) * nrhs;
+
+    *info = 0;
+    hipsolver_host_parallel_for(handle, ngroups, [&](int g) {
+        hipsolver_compact_getrs(trans,
+                                n,
+                                nrhs,
+                                Ac + g * nn * W,
+                                ipiv + size_t(g) * W * n,
+                                Bc + g * nb * W,
+                                std::min(W, batch_count - g * W));
+    });
+    return HIPSOLVER_STATUS_SUCCESS;
+}
@@ -0,0 +1,232 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "lapack_routines.hpp"
+
+/*
+ * ===========================================================================
+ *    geqp3 computes the QR factorization with column pivoting A * P = Q * R.
+ *    The full factorization is the one of LAPACK with all the columns free.
+ *    The truncated variant has no LAPACK counterpart, so it is the unblocked
+ *    algorithm of LAPACK (xLAQP2) with the stopping criterion of the rocSOLVER
+ *    backend: it stops as soon as the largest partial column norm falls below
+ *    a tolerance relative to the largest column norm of A, which leaves the
+ *    numerical rank in rank.
+ * ===========================================================================
+ */
+
+template <typename S>
+hipsolverStatus_t hipsolver_geqp3_argCheck(int         m,
+                                           int         n,
+                                           int         lda,
+                                           const bool  truncated,
+                                           S           tol,
+                                           const void* A,
+                                           int*        jpvt,
+                                           const void* tau,
+                                           int*        rank,
+                                           int*        info)
+{
+    if(m < 0 || n < 0 || lda < m)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(truncated && !(tol >= 0))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if((m && n && !A) || (n && !jpvt) || (m && n && !tau) || (truncated && !rank) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+int hipsolver_geqp3_worksize(bool truncated, int m, int n, int lda)
+{
+    using S = decltype(std::real(T{}));
+
+    // the truncated variant applies the reflectors one column at a time
+    if(truncated)
+        return std::max(1, n);
+
+    T   query, dummy;
+    S   rdummy;
+    int idummy, info;
+    lapackCall_geqp3(m, n, &dummy, lda, &idummy, &dummy, &query, -1, &rdummy, &info);
+    return hipsolver_lapack_size(query);
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_geqp3_bufferSize_template(
+    hipsolver_host_handle* handle, bool truncated, int m, int n, int lda, int* lwork)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(m < 0 || n < 0 || lda < m)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    if(m > 0 && n > 0)
+        *lwork = hipsolver_geqp3_worksize<T>(truncated, m, n, lda);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// the 2-norm of x, scaled to avoid overflow as in xNRM2
+template <typename T>
+auto hipsolver_nrm2(int n, const T* x) -> decltype(std::real(T{}))
+{
+    using S = decltype(std::real(T{}));
+
+    S scale = 0, ssq = 1;
+    for(int i = 0; i < n; i++)
+    {
+        S a = std::abs(x[i]);
+        if(a == 0)
+            continue;
+        if(scale < a)
+        {
+            ssq   = 1 + ssq * (scale / a) * (scale / a);
+            scale = a;
+        }
+        else
+            ssq += (a / scale) * (a / scale);
+    }
+    return scale * std::sqrt(ssq);
+}
+
+template <typename T>
+void hipsolver_geqp3_truncated(int                       m,
+                               int                       n,
+                               T*                        A,
+                               int                       lda,
+                               decltype(std::real(T{})) tol,
+                               int*                      jpvt,
+                               T*                        tau,
+                               int*                      rank,
+                               T*                        work)
+{
+    using S = decltype(std::real(T{}));
+
+    const S tol3z = std::sqrt(std::numeric_limits<S>::epsilon());
+    int     mn    = std::min(m, n);
+
+    // vn1 holds the partial column norms, and vn2 the norms they were last computed from
+    std::vector<S> vn1(n), vn2(n);
+    S              maxnorm = 0;
+    for(int j = 0; j < n; j++)
+    {
+        vn1[j]  = hipsolver_nrm2(m, A + size_t(j) * lda);
+        vn2[j]  = vn1[j];
+        maxnorm = std::max(maxnorm, vn1[j]);
+    }
+    S thresh = tol * maxnorm;
+
+    int j = 0;
+    for(; j < mn; j++)
+    {
+        int pvt = int(std::max_element(vn1.begin() + j, vn1.end()) - vn1.begin());
+        if(vn1[pvt] <= thresh)
+            break;
+
+        T* Aj = A + size_t(j) * lda;
+        if(pvt != j)
+        {
+            std::swap_ranges(Aj, Aj + m, A + size_t(pvt) * lda);
+            std::swap(jpvt[pvt], jpvt[j]);
+            vn1[pvt] = vn1[j];
+            vn2[pvt] = vn2[j];
+        }
+
+        // generate the reflector H(j) that annihilates A(j+1:m, j)
+        if(j < m - 1)
+            lapackCall_larfg(m - j, Aj + j, Aj + j + 1, 1, tau + j);
+        else
+            lapackCall_larfg(1, Aj + m - 1, Aj + m - 1, 1, tau + j);
+
+        // apply H(j)' to A(j:m, j+1:n) from the left
+        if(j < n - 1)
+        {
+            T aii  = Aj[j];
+            Aj[j]  = 1;
+            T ctau = hipsolver_conj(tau[j]);
+            lapackCall_larf('L', m - j, n - j - 1, Aj + j, 1, &ctau, Aj + j + lda, lda, work);
+            Aj[j] = aii;
+        }
+
+        // downdate the partial column norms, recomputing those that lost their accuracy
+        for(int k = j + 1; k < n; k++)
+        {
+            if(vn1[k] == 0)
+                continue;
+
+            T* Ak   = A + size_t(k) * lda;
+            S  temp = std::abs(Ak[j]) / vn1[k];
+            temp    = std::max(S(0), (1 + temp) * (1 - temp));
+            S temp2 = temp * (vn1[k] / vn2[k]) * (vn1[k] / vn2[k]);
+            if(temp2 <= tol3z)
+            {
+                vn1[k] = j < m - 1 ? hipsolver_nrm2(m - j - 1, Ak + j + 1) : S(0);
+                vn2[k] = vn1[k];
+            }
+            else
+                vn1[k] *= std::sqrt(temp);
+        }
+    }
+
+    // the reflectors that were not generated are the identity
+    std::fill(tau + j, tau + mn, T(0));
+    *rank = j;
+}
+
+/* Overwrites A with R and the reflectors of Q, and writes the 1-based column
+   permutation P into jpvt. With truncated, stops once the partial column
+   norms are all within tol times the largest column norm of A, and writes the
+   number of reflectors generated into rank. */
+template <typename T, typename S>
+hipsolverStatus_t hipsolver_geqp3_template(hipsolver_host_handle* handle,
+                                           int                    m,
+                                           int                    n,
+                                           T*                     A,
+                                           int                    lda,
+                                           int*                   jpvt,
+                                           T*                     tau,
+                                           const bool             truncated,
+                                           S                      tol,
+                                           int*                   rank,
+                                           T*                     work,
+                                           int                    lwork,
+                                           int*                   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(
+        hipsolver_geqp3_argCheck(m, n, lda, truncated, tol, A, jpvt, tau, rank, info));
+    HIPSOLVER_HOST_SYNC(handle);
+
+    *info = 0;
+    for(int j = 0; j < n; j++)
+        jpvt[j] = truncated ? j + 1 : 0;
+
+    // quick return
+    if(std::min(m, n) == 0)
+    {
+        for(int j = 0; j < n; j++)
+            jpvt[j] = j + 1;
+        if(truncated)
+            *rank = 0;
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    hipsolver_host_workspace<T> w(work, lwork, hipsolver_geqp3_worksize<T>(truncated, m, n, lda));
+    if(truncated)
+    {
+        hipsolver_geqp3_truncated(m, n, A, lda, tol, jpvt, tau, rank, w.data());
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    // all the columns are free
+    std::vector<S> rwork(2 * n);
+    lapackCall_geqp3(m, n, A, lda, jpvt, tau, w.data(), w.size(), rwork.data(), info);
+    return hipsolver_lapack_status(*info);
+}
@@ -0,0 +1,284 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "lapack_routines.hpp"
+#include "parallel.hpp"
+
+/*
+ * ===========================================================================
+ *    getrf, getrfHost and getrsHost. With pivots, matrices of up to
+ *    HIPSOLVER_GETRF_KERNEL_MAX_SIZE rows and columns are factorized with the
+ *    native kernels of getrf_kernel.hpp. Without pivots, the factorization is
+ *    the right-looking blocked algorithm of LAPACK with the row interchanges
+ *    left out, as LAPACK has no unpivoted LU. On this backend, the host
+ *    functions are the same as the others, except that they report their
+ *    info on the host and that the batched ones run their problems on the
+ *    threads of the backend.
+ * ===========================================================================
+ */
+
+// width of the panels of the unpivoted factorization
+#define HIPSOLVER_GETRF_NPVT_BLOCKSIZE 64
+
+// unblocked factorization of the m-by-n panel A; info is relative to its first column
+template <typename T>
+void hipsolver_getf2_npvt(int m, int n, T* A, int lda, int* info)
+{
+    *info = 0;
+    for(int j = 0; j < std::min(m, n); j++)
+    {
+        T* Aj    = A + size_t(j) * lda;
+        T  pivot = Aj[j];
+
+        // a zero pivot is reported and its column is left unscaled
+        if(pivot == T(0))
+        {
+            if(*info == 0)
+                *info = j + 1;
+        }
+        else
+        {
+            T inv = T(1) / pivot;
+            for(int i = j + 1; i < m; i++)
+                Aj[i] *= inv;
+        }
+
+        // rank-1 update of the trailing columns of the panel
+        for(int k = j + 1; k < n; k++)
+        {
+            T* Ak = A + size_t(k) * lda;
+            T  a  = Ak[j];
+            if(a == T(0))
+                continue;
+            for(int i = j + 1; i < m; i++)
+                Ak[i] -= Aj[i] * a;
+        }
+    }
+}
+
+template <typename T>
+void hipsolver_getrf_npvt(int m, int n, T* A, int lda, int* info)
+{
+    const int nb = HIPSOLVER_GETRF_NPVT_BLOCKSIZE;
+
+    *info  = 0;
+    int mn = std::min(m, n);
+    for(int j = 0; j < mn; j += nb)
+    {
+        int jb = std::min(nb, mn - j);
+        T*  Ajj = A + j + size_t(j) * lda;
+
+        int iinfo;
+        hipsolver_getf2_npvt(m - j, jb, Ajj, lda, &iinfo);
+        if(*info == 0 && iinfo > 0)
+            *info = j + iinfo;
+
+        int nr = n - j - jb;
+        if(nr > 0)
+        {
+            // U12 = L11^-1 * A12 and A22 = A22 - L21 * U12
+            T* A12 = Ajj + size_t(jb) * lda;
+            lapackCall_trsm('L', 'L', 'N', 'U', jb, nr, T(1), Ajj, lda, A12, lda);
+            if(m - j - jb > 0)
+                lapackCall_gemm('N',
+                                'N',
+                                m - j - jb,
+                                nr,
+                                jb,
+                                T(-1),
+                                Ajj + jb,
+                                lda,
+                                A12,
+                                lda,
+                                T(1),
+                                A12 + jb,
+                                lda);
+        }
+    }
+}
+
+// factorizes one problem, without pivoting if ipiv is null
+template <typename T>
+void hipsolver_getrf_factor(int m, int n, T* A, int lda, int* ipiv, int* info)
+{
+    *info = 0;
+    if(m == 0 || n == 0)
+        return;
+
+    if(ipiv && std::max(m, n) <= HIPSOLVER_GETRF_KERNEL_MAX_SIZE)
+        hipsolver_kernel_getrf(m, n, A, lda, ipiv, info);
+    else if(ipiv)
+    {
+        lapackCall_getrf(m, n, A, lda, ipiv, info);
+        if(*info < 0)
+            throw HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    else
+        hipsolver_getrf_npvt(m, n, A, lda, info);
+}
+
+/******************** GETRF ********************/
+inline hipsolverStatus_t hipsolver_getrf_argCheck(int m, int n, int lda)
+{
+    if(m < 0 || n < 0 || lda < m)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_getrf_bufferSize_template(
+    hipsolver_host_handle* handle, int m, int n, int lda, int* lwork)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    return hipsolver_getrf_argCheck(m, n, lda);
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_getrf_template(
+    hipsolver_host_handle* handle, int m, int n, T* A, int lda, int* ipiv, int* info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_getrf_argCheck(m, n, lda));
+    if((m && n && !A) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    hipsolver_getrf_factor(m, n, A, lda, ipiv, info);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** GETRF_HOST ********************/
+inline hipsolverStatus_t hipsolver_getrf_host_argCheck(hipsolver_host_handle* handle,
+                                                       int                    m,
+                                                       int                    n,
+                                                       int                    lda,
+                                                       const void*            A,
+                                                       int*                   info,
+                                                       int                    batch_count = 1)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(m < 0 || n < 0 || lda < m || lda < 1 || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if((m && n && batch_count && !A) || (batch_count && !info))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+inline hipsolverStatus_t hipsolver_getrs_host_argCheck(hipsolver_host_handle* handle,
+                                                       int                    n,
+                                                       int                    nrhs,
+                                                       int                    lda,
+                                                       int                    ldb,
+                                                       const void*            A,
+                                                       const int*             ipiv,
+                                                       const void*            B,
+                                                       int*                   info,
+                                                       int                    batch_count = 1)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n || lda < 1 || ldb < 1 || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if((n && batch_count && (!A || !ipiv)) || (n && nrhs && batch_count && !B) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_getrf_host_template(
+    hipsolver_host_handle* handle, int m, int n, T* A, int lda, int* ipiv, int* info)
+{
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_getrf_host_argCheck(handle, m, n, lda, A, info));
+    HIPSOLVER_HOST_SYNC(handle);
+
+    hipsolver_getrf_factor(m, n, A, lda, ipiv, info);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/* Batched version of hipsolver_getrf_host_template, with the pivots of problem
+   b at ipiv + b * strideP and its info at info[b]. */
+template <typename T>
+hipsolverStatus_t hipsolver_getrf_batched_host_template(hipsolver_host_handle* handle,
+                                                        int                    m,
+                                                        int                    n,
+                                                        T* const               A[],
+                                                        int                    lda,
+                                                        int*                   ipiv,
+                                                        int                    strideP,
+                                                        int*                   info,
+                                                        int                    batch_count)
+{
+    HIPSOLVER_RETURN_IF_ERROR(
+        hipsolver_getrf_host_argCheck(handle, m, n, lda, A, info, batch_count));
+    HIPSOLVER_HOST_SYNC(handle);
+
+    hipsolver_host_parallel_for(handle, batch_count, [&](int b) {
+        hipsolver_getrf_factor(
+            m, n, A[b], lda, ipiv ? ipiv + size_t(strideP) * b : nullptr, info + b);
+    });
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** GETRS_HOST ********************/
+template <typename T>
+hipsolverStatus_t hipsolver_getrs_host_template(hipsolver_host_handle* handle,
+                                                char                   trans,
+                                                int                    n,
+                                                int                    nrhs,
+                                                const T*               A,
+                                                int                    lda,
+                                                const int*             ipiv,
+                                                T*                     B,
+                                                int                    ldb,
+                                                int*                   info)
+{
+    HIPSOLVER_RETURN_IF_ERROR(
+        hipsolver_getrs_host_argCheck(handle, n, nrhs, lda, ldb, A, ipiv, B, info));
+    HIPSOLVER_HOST_SYNC(handle);
+
+    *info = 0;
+    if(n == 0 || nrhs == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolver_getrs_solve(trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/* Batched version of hipsolver_getrs_host_template, with the pivots of problem
+   b at ipiv + b * strideP. */
+template <typename T>
+hipsolverStatus_t hipsolver_getrs_batched_host_template(hipsolver_host_handle* handle,
+                                                        char                   trans,
+                                                        int                    n,
+                                                        int                    nrhs,
+                                                        T* const               A[],
+                                                        int                    lda,
+                                                        const int*             ipiv,
+                                                        int                    strideP,
+                                                        T* const               B[],
+                                                        int                    ldb,
+                                                        int*                   info,
+                                                        int                    batch_count)
+{
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_getrs_host_argCheck(
+        handle, n, nrhs, lda, ldb, A, ipiv, B, info, batch_count));
+    HIPSOLVER_HOST_SYNC(handle);
+
+    *info = 0;
+    if(n == 0 || nrhs == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolver_host_parallel_for(handle, batch_count, [&](int b) {
+        hipsolver_getrs_solve(trans, n, nrhs, A[b], lda, ipiv + size_t(strideP) * b, B[b], ldb);
+    });
+    return HIPSOLVER_STATUS_SUCCESS;
+}
@@ -0,0 +1,111 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "thread_pool.hpp"
+#include "tuning.hpp"
+#include <hip/hip_runtime_api.h>
+#include <memory>
+#include <mutex>
+
+#define HIPSOLVER_RETURN_IF_ERROR(STATUS)       \
+    do                                          \
+    {                                           \
+        hipsolverStatus_t _status = (STATUS);   \
+        if(_status != HIPSOLVER_STATUS_SUCCESS) \
+            return _status;                     \
+    } while(0)
+
+/*
+ * ===========================================================================
+ *    hipsolverHandle_t of the host backend. Device memory is host memory, so
+ *    a call waits for the work already enqueued on the stream of its handle
+ *    and then runs on the calling thread; nothing is left enqueued once it
+ *    returns. A call therefore cannot be captured, and the capture query only
+ *    records that some call was made.
+ * ===========================================================================
+ */
+
+struct hipsolver_host_handle
+{
+    std::mutex mutex;
+
+    hipStream_t stream = 0;
+
+    hipsolverCaptureMode_t capture_mode = HIPSOLVER_CAPTURE_MODE_DEFAULT;
+
+    // set between hipsolverStartCaptureQuery and hipsolverStopCaptureQuery
+    bool capture_query = false;
+    bool capturable    = true;
+
+    // only stored; the host backend does not allocate workspace ahead of time
+    hipsolverAllocMode_t alloc_mode     = HIPSOLVER_ALLOC_MODE_DEFAULT;
+    int                  tile_streams   = 0;
+    int                  tile_lookahead = 0;
+    int                  tile_blocksize = HIPSOLVER_TILE_BLOCKSIZE;
+
+    // the OR of the info values of the deferred error mode since the last reset
+    hipsolverErrorMode_t error_mode  = HIPSOLVER_ERROR_MODE_DEFAULT;
+    int                  error_state = 0;
+
+    // set by hipsolverSetHostThreadPool; the pool is created on first use
+    int                                  pool_threads  = 0;
+    hipsolverHostAffinity_t              pool_affinity = HIPSOLVER_HOST_AFFINITY_NONE;
+    std::shared_ptr<hipsolver_host_pool> pool;
+
+    // only stored, as all the calls run on the host
+    hipsolverDispatchMode_t  dispatch_mode = HIPSOLVER_DISPATCH_MODE_DEVICE;
+    hipsolver_dispatch_table dispatch;
+};
+
+/* Waits for the work enqueued on the stream of handle. Returns
+   HIPSOLVER_STATUS_SUCCESS with *run set to false during a capture query,
+   in which case the call must return without running. */
+inline hipsolverStatus_t hipsolver_host_sync(hipsolver_host_handle* handle, bool* run)
+{
+    hipStream_t stream;
+    {
+        std::lock_guard<std::mutex> lock(handle->mutex);
+        *run = !handle->capture_query;
+        if(handle->capture_query)
+        {
+            handle->capturable = false;
+            return HIPSOLVER_STATUS_SUCCESS;
+        }
+
+        if(handle->capture_mode == HIPSOLVER_CAPTURE_MODE_SAFE)
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        stream = handle->stream;
+    }
+
+    if(hipStreamSynchronize(stream) != hipSuccess)
+        return HIPSOLVER_STATUS_EXECUTION_FAILED;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// returns from the calling function unless the call must run now
+#define HIPSOLVER_HOST_SYNC(HANDLE)                                       \
+    do                                                                    \
+    {                                                                     \
+        bool              _run;                                           \
+        hipsolverStatus_t _status = hipsolver_host_sync((HANDLE), &_run); \
+        if(_status != HIPSOLVER_STATUS_SUCCESS || !_run)                  \
+            return _status;                                               \
+    } while(0)
+
+/* With HIPSOLVER_ERROR_MODE_DEFERRED, adds the count values of info to the error
+   state. Nothing is added during a capture query, as the call did not run. */
+inline void hipsolver_host_defer_info(hipsolver_host_handle* handle, const int* info, int count)
+{
+    if(!info || count <= 0)
+        return;
+
+    std::lock_guard<std::mutex> lock(handle->mutex);
+    if(handle->error_mode != HIPSOLVER_ERROR_MODE_DEFERRED || handle->capture_query)
+        return;
+    for(int i = 0; i < count; i++)
+        handle->error_state |= info[i];
+}
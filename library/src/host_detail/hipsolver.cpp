@@ -0,0 +1,7526 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipsolver.h"
+#include "exceptions.hpp"
+#include "batch.hpp"
+#include "cholqr.hpp"
+#include "compact.hpp"
+#include "geqp3.hpp"
+#include "getrf.hpp"
+#include "handle.hpp"
+#include "lapack_routines.hpp"
+#include "mg.hpp"
+#include <algorithm>
+#include <complex>
+#include <memory>
+
+using namespace std;
+
+extern "C" {
+
+/******************** HELPERS ********************/
+char hip2lapack_operation(hipsolverOperation_t op)
+{
+    switch(op)
+    {
+    case HIPSOLVER_OP_N:
+        return 'N';
+    case HIPSOLVER_OP_T:
+        return 'T';
+    case HIPSOLVER_OP_C:
+        return 'C';
+    default:
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+}
+
+char hip2lapack_fill(hipsolverFillMode_t fill)
+{
+    switch(fill)
+    {
+    case HIPSOLVER_FILL_MODE_UPPER:
+        return 'U';
+    case HIPSOLVER_FILL_MODE_LOWER:
+        return 'L';
+    default:
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+}
+
+char hip2lapack_side(hipsolverSideMode_t side)
+{
+    switch(side)
+    {
+    case HIPSOLVER_SIDE_LEFT:
+        return 'L';
+    case HIPSOLVER_SIDE_RIGHT:
+        return 'R';
+    default:
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+}
+
+char hip2lapack_evect(hipsolverEigMode_t eig)
+{
+    switch(eig)
+    {
+    case HIPSOLVER_EIG_MODE_NOVECTOR:
+        return 'N';
+    case HIPSOLVER_EIG_MODE_VECTOR:
+        return 'V';
+    default:
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+}
+
+int hip2lapack_eform(hipsolverEigType_t eig)
+{
+    switch(eig)
+    {
+    case HIPSOLVER_EIG_TYPE_1:
+        return 1;
+    case HIPSOLVER_EIG_TYPE_2:
+        return 2;
+    case HIPSOLVER_EIG_TYPE_3:
+        return 3;
+    default:
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+}
+
+// the matrix generated by xORGBR: Q when applied from the left, P when applied from the right
+char hip2lapack_side2vect(hipsolverSideMode_t side)
+{
+    switch(side)
+    {
+    case HIPSOLVER_SIDE_LEFT:
+        return 'Q';
+    case HIPSOLVER_SIDE_RIGHT:
+        return 'P';
+    default:
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+}
+
+char char2lapack_svect(signed char svect)
+{
+    switch(svect)
+    {
+    case 'N':
+    case 'A':
+    case 'S':
+    case 'O':
+        return char(svect);
+    default:
+        throw HIPSOLVER_STATUS_INVALID_VALUE;
+    }
+}
+
+/* With HIPSOLVER_ERROR_MODE_DEFERRED, adds the count values of devInfo to the
+   error state of handle once the call that writes them has succeeded. */
+inline hipsolverStatus_t hipsolverDeferInfo(hipsolverHandle_t handle,
+                                            hipsolverStatus_t status,
+                                            const int*        devInfo,
+                                            int               count)
+{
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        hipsolver_host_defer_info((hipsolver_host_handle*)handle, devInfo, count);
+    return status;
+}
+
+/******************** AUXLIARY ********************/
+hipsolverStatus_t hipsolverCreate(hipsolverHandle_t* handle)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_HANDLE_IS_NULLPTR;
+
+    *handle = new hipsolver_host_handle;
+
+    // a tuning file that cannot be loaded leaves the defaults, so that the handle is still usable
+    const char* path = hipsolver_tuning_file();
+    if(path)
+        hipsolverLoadTuningFile(*handle, path);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDestroy(hipsolverHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    hipsolver_host_handle* h = (hipsolver_host_handle*)handle;
+    delete h;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSetStream(hipsolverHandle_t handle, hipStream_t streamId)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    h->stream = streamId;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetStream(hipsolverHandle_t handle, hipStream_t* streamId)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!streamId)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    *streamId = h->stream;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** STREAM CAPTURE ********************/
+hipsolverStatus_t hipsolverSetCaptureMode(hipsolverHandle_t handle, hipsolverCaptureMode_t mode)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(mode != HIPSOLVER_CAPTURE_MODE_DEFAULT && mode != HIPSOLVER_CAPTURE_MODE_SAFE)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    h->capture_mode = mode;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetCaptureMode(hipsolverHandle_t handle, hipsolverCaptureMode_t* mode)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    *mode = h->capture_mode;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverReserveWorkspace(hipsolverHandle_t handle, size_t size)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    // the calls allocate host memory as they need it
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverStartCaptureQuery(hipsolverHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    if(h->capture_query)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    h->capture_query = true;
+    h->capturable    = true;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverStopCaptureQuery(hipsolverHandle_t handle, int* capturable)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!capturable)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    if(!h->capture_query)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *capturable      = h->capturable ? 1 : 0;
+    h->capture_query = false;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** WORKSPACE ALLOCATION ********************/
+hipsolverStatus_t hipsolverSetAllocMode(hipsolverHandle_t handle, hipsolverAllocMode_t mode)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(mode != HIPSOLVER_ALLOC_MODE_DEFAULT && mode != HIPSOLVER_ALLOC_MODE_STREAM_ORDERED)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    // there is no device memory to allocate on the stream
+    if(mode == HIPSOLVER_ALLOC_MODE_STREAM_ORDERED)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    h->alloc_mode = mode;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetAllocMode(hipsolverHandle_t handle, hipsolverAllocMode_t* mode)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    *mode = h->alloc_mode;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** TILED FACTORIZATIONS ********************/
+hipsolverStatus_t hipsolverSetTileExecution(hipsolverHandle_t handle, int nstreams, int lookahead)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(nstreams < 0 || lookahead < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // only stored, as the factorizations are not tiled on this backend
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    h->tile_streams   = nstreams;
+    h->tile_lookahead = lookahead;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetTileExecution(hipsolverHandle_t handle, int* nstreams, int* lookahead)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!nstreams || !lookahead)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    *nstreams  = h->tile_streams;
+    *lookahead = h->tile_lookahead;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSetTileBlockSize(hipsolverHandle_t handle, int nb)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(nb < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // only stored, as the factorizations are not tiled on this backend
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    h->tile_blocksize = nb;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetTileBlockSize(hipsolverHandle_t handle, int* nb)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!nb)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    *nb = h->tile_blocksize;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** HOST THREAD POOL ********************/
+hipsolverStatus_t hipsolverSetHostThreadPool(hipsolverHandle_t       handle,
+                                             int                     nthreads,
+                                             hipsolverHostAffinity_t affinity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(nthreads < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(affinity != HIPSOLVER_HOST_AFFINITY_NONE && affinity != HIPSOLVER_HOST_AFFINITY_CLOSE
+       && affinity != HIPSOLVER_HOST_AFFINITY_SPREAD)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    // the pool is rebuilt on first use, and the old one is released outside the lock; a
+    // call running on it keeps it until done
+    std::shared_ptr<hipsolver_host_pool> old;
+    {
+        hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+        std::lock_guard<std::mutex> lock(h->mutex);
+        if(h->pool_threads == nthreads && h->pool_affinity == affinity)
+            return HIPSOLVER_STATUS_SUCCESS;
+        h->pool_threads  = nthreads;
+        h->pool_affinity = affinity;
+        old              = std::move(h->pool);
+    }
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetHostThreadPool(hipsolverHandle_t        handle,
+                                             int*                     nthreads,
+                                             hipsolverHostAffinity_t* affinity)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!nthreads || !affinity)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    *nthreads = h->pool_threads;
+    *affinity = h->pool_affinity;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** DISPATCH ********************/
+hipsolverStatus_t hipsolverSetDispatchMode(hipsolverHandle_t handle, hipsolverDispatchMode_t mode)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(mode != HIPSOLVER_DISPATCH_MODE_DEVICE && mode != HIPSOLVER_DISPATCH_MODE_AUTO)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    // only stored, as all the calls run on the host on this backend
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    h->dispatch_mode = mode;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetDispatchMode(hipsolverHandle_t handle, hipsolverDispatchMode_t* mode)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    *mode = h->dispatch_mode;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSetDispatchThreshold(hipsolverHandle_t          handle,
+                                                hipsolverDispatchRoutine_t routine,
+                                                hipsolverPrecision_t       precision,
+                                                int                        n)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!hipsolver_dispatch_table::valid(routine, precision))
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(n < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    h->dispatch.at(routine, precision) = n;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetDispatchThreshold(hipsolverHandle_t          handle,
+                                                hipsolverDispatchRoutine_t routine,
+                                                hipsolverPrecision_t       precision,
+                                                int*                       n)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!hipsolver_dispatch_table::valid(routine, precision))
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(!n)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    *n = h->dispatch.at(routine, precision);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** TUNING ********************/
+hipsolverStatus_t hipsolverLoadTuningFile(hipsolverHandle_t handle, const char* path)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!path)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_host_handle* h = (hipsolver_host_handle*)handle;
+    hipsolver_tuning       tuning;
+    {
+        std::lock_guard<std::mutex> lock(h->mutex);
+        tuning.dispatch       = h->dispatch;
+        tuning.tile_blocksize = h->tile_blocksize;
+    }
+
+    hipsolverStatus_t status = hipsolver_read_tuning(path, &tuning);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    std::lock_guard<std::mutex> lock(h->mutex);
+    h->dispatch       = tuning.dispatch;
+    h->tile_blocksize = tuning.tile_blocksize;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** BATCH QUEUE ********************/
+hipsolverStatus_t
+    hipsolverCreateBatchQueue(hipsolverBatchQueue_t* queue, int maxBatch, int windowUs)
+try
+{
+    return hipsolver_batch_queue_create((hipsolver_host_batch_queue**)queue, maxBatch, windowUs);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDestroyBatchQueue(hipsolverBatchQueue_t queue)
+try
+{
+    if(!queue)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    hipsolver_host_batch_queue* q = (hipsolver_host_batch_queue*)queue;
+    delete q;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverBatchQueueFlush(hipsolverBatchQueue_t queue)
+try
+{
+    if(!queue)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    // the requests are solved when they are submitted
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverBatchRequestQuery(hipsolverBatchRequest_t request, int* done)
+try
+{
+    if(!request || !done)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *done = 1;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverBatchRequestWait(hipsolverBatchRequest_t request, int* info)
+try
+{
+    if(!request || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the request is released once it is done
+    std::unique_ptr<hipsolver_host_batch_request> req((hipsolver_host_batch_request*)request);
+    *info = req->info;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** COMPLETION ********************/
+hipsolverStatus_t hipsolverCreateCompletion(hipsolverCompletion_t* completion)
+try
+{
+    if(!completion)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *completion = new hipsolver_host_completion;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDestroyCompletion(hipsolverCompletion_t completion)
+try
+{
+    if(!completion)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    hipsolver_host_completion* c = (hipsolver_host_completion*)completion;
+    delete c;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSetCompletionCallback(hipsolverCompletion_t         completion,
+                                                 hipsolverCompletionCallback_t callback,
+                                                 void*                         userData)
+try
+{
+    if(!completion)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    ((hipsolver_host_completion*)completion)->set_callback(callback, userData);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverRecordCompletion(hipsolverHandle_t     handle,
+                                            const int*            devInfo,
+                                            int                   count,
+                                            hipsolverCompletion_t completion)
+try
+{
+    return hipsolver_completion_record(
+        (hipsolver_host_handle*)handle, devInfo, count, (hipsolver_host_completion*)completion);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverQueryCompletion(hipsolverCompletion_t completion, int* done, int* info)
+try
+{
+    if(!completion || !done)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    ((hipsolver_host_completion*)completion)->get(info);
+    *done = 1;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverWaitCompletion(hipsolverCompletion_t completion, int* info)
+try
+{
+    if(!completion)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    ((hipsolver_host_completion*)completion)->get(info);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** DEFERRED ERRORS ********************/
+hipsolverStatus_t hipsolverSetErrorMode(hipsolverHandle_t handle, hipsolverErrorMode_t mode)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(mode != HIPSOLVER_ERROR_MODE_DEFAULT && mode != HIPSOLVER_ERROR_MODE_DEFERRED)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    // the state starts clean every time the deferred mode is entered
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    if(mode == HIPSOLVER_ERROR_MODE_DEFERRED && h->error_mode != mode)
+        h->error_state = 0;
+    h->error_mode = mode;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetErrorMode(hipsolverHandle_t handle, hipsolverErrorMode_t* mode)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    *mode = h->error_mode;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetErrorState(hipsolverHandle_t handle, int* state)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!state)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_host_handle* h = (hipsolver_host_handle*)handle;
+    {
+        std::lock_guard<std::mutex> lock(h->mutex);
+        if(h->error_mode != HIPSOLVER_ERROR_MODE_DEFERRED)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+    }
+
+    HIPSOLVER_HOST_SYNC(h);
+
+    std::lock_guard<std::mutex> lock(h->mutex);
+    *state = h->error_state;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverResetErrorState(hipsolverHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    hipsolver_host_handle*      h = (hipsolver_host_handle*)handle;
+    std::lock_guard<std::mutex> lock(h->mutex);
+    if(h->error_mode != HIPSOLVER_ERROR_MODE_DEFERRED)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    h->error_state = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** MULTI-DEVICE ********************/
+hipsolverStatus_t hipsolverMgCreate(hipsolverMgHandle_t* handle)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *handle = new hipsolver_host_mg_handle;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgDestroy(hipsolverMgHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    hipsolver_host_mg_handle* h = (hipsolver_host_mg_handle*)handle;
+    delete h;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t
+    hipsolverMgDeviceSelect(hipsolverMgHandle_t handle, int nbDevices, const int deviceId[])
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return ((hipsolver_host_mg_handle*)handle)->select(nbDevices, deviceId);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgCreateDeviceGrid(hipsolverMgGrid_t*       grid,
+                                              int                      numRowDevices,
+                                              int                      numColDevices,
+                                              const int                deviceId[],
+                                              hipsolverMgGridMapping_t mapping)
+try
+{
+    if(!grid || !deviceId)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(mapping != HIPSOLVER_MG_GRID_MAPPING_ROW_MAJOR
+       && mapping != HIPSOLVER_MG_GRID_MAPPING_COL_MAJOR)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    // the columns are distributed over a single row of devices
+    if(numRowDevices != 1)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    if(numColDevices < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_host_mg_grid* g = new hipsolver_host_mg_grid;
+    g->devices.assign(deviceId, deviceId + numColDevices);
+    *grid = g;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgDestroyGrid(hipsolverMgGrid_t grid)
+try
+{
+    if(!grid)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    hipsolver_host_mg_grid* g = (hipsolver_host_mg_grid*)grid;
+    delete g;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgCreateMatrixDesc(hipsolverMgMatrixDesc_t* desc,
+                                              int                      numRows,
+                                              int                      numCols,
+                                              int                      rowBlockSize,
+                                              int                      colBlockSize,
+                                              hipsolverMgGrid_t        grid)
+try
+{
+    if(!desc)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!grid)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(numRows < 0 || numCols < 0 || rowBlockSize < 1 || colBlockSize < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the rows are not distributed, so rowBlockSize does not change the layout
+    hipsolver_host_mg_desc* d = new hipsolver_host_mg_desc;
+    d->rows                   = numRows;
+    d->cols                   = numCols;
+    d->col_block              = colBlockSize;
+    d->devices                = ((hipsolver_host_mg_grid*)grid)->devices;
+    *desc                     = d;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgDestroyMatrixDesc(hipsolverMgMatrixDesc_t desc)
+try
+{
+    if(!desc)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    hipsolver_host_mg_desc* d = (hipsolver_host_mg_desc*)desc;
+    delete d;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** ORGBR/UNGBR ********************/
+hipsolverStatus_t hipsolverSorgbr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              tau,
+                                             int*                lwork)
+try
+{
+    return hipsolver_orgbr_bufferSize_template<float>(
+        (hipsolver_host_handle*)handle, hip2lapack_side2vect(side), m, n, k, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDorgbr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             tau,
+                                             int*                lwork)
+try
+{
+    return hipsolver_orgbr_bufferSize_template<double>(
+        (hipsolver_host_handle*)handle, hip2lapack_side2vect(side), m, n, k, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungbr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             hipFloatComplex*    tau,
+                                             int*                lwork)
+try
+{
+    return hipsolver_orgbr_bufferSize_template<std::complex<float>>(
+        (hipsolver_host_handle*)handle, hip2lapack_side2vect(side), m, n, k, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungbr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             hipDoubleComplex*   tau,
+                                             int*                lwork)
+try
+{
+    return hipsolver_orgbr_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, hip2lapack_side2vect(side), m, n, k, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSorgbr(hipsolverHandle_t   handle,
+                                  hipsolverSideMode_t side,
+                                  int                 m,
+                                  int                 n,
+                                  int                 k,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              tau,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return hipsolver_orgbr_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_side2vect(side),
+                                    m,
+                                    n,
+                                    k,
+                                    A,
+                                    lda,
+                                    tau,
+                                    work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDorgbr(hipsolverHandle_t   handle,
+                                  hipsolverSideMode_t side,
+                                  int                 m,
+                                  int                 n,
+                                  int                 k,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             tau,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return hipsolver_orgbr_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_side2vect(side),
+                                    m,
+                                    n,
+                                    k,
+                                    A,
+                                    lda,
+                                    tau,
+                                    work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungbr(hipsolverHandle_t   handle,
+                                  hipsolverSideMode_t side,
+                                  int                 m,
+                                  int                 n,
+                                  int                 k,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    tau,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return hipsolver_orgbr_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_side2vect(side),
+                                    m,
+                                    n,
+                                    k,
+                                    (std::complex<float>*)A,
+                                    lda,
+                                    (std::complex<float>*)tau,
+                                    (std::complex<float>*)work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungbr(hipsolverHandle_t   handle,
+                                  hipsolverSideMode_t side,
+                                  int                 m,
+                                  int                 n,
+                                  int                 k,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   tau,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return hipsolver_orgbr_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_side2vect(side),
+                                    m,
+                                    n,
+                                    k,
+                                    (std::complex<double>*)A,
+                                    lda,
+                                    (std::complex<double>*)tau,
+                                    (std::complex<double>*)work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** ORGQR/UNGQR ********************/
+hipsolverStatus_t hipsolverSorgqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, int k, float* A, int lda, float* tau, int* lwork)
+try
+{
+    return hipsolver_orgqr_bufferSize_template<float>(
+        (hipsolver_host_handle*)handle, m, n, k, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDorgqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, int k, double* A, int lda, double* tau, int* lwork)
+try
+{
+    return hipsolver_orgqr_bufferSize_template<double>(
+        (hipsolver_host_handle*)handle, m, n, k, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungqr_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               k,
+                                             hipFloatComplex*  A,
+                                             int               lda,
+                                             hipFloatComplex*  tau,
+                                             int*              lwork)
+try
+{
+    return hipsolver_orgqr_bufferSize_template<std::complex<float>>(
+        (hipsolver_host_handle*)handle, m, n, k, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungqr_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               k,
+                                             hipDoubleComplex* A,
+                                             int               lda,
+                                             hipDoubleComplex* tau,
+                                             int*              lwork)
+try
+{
+    return hipsolver_orgqr_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, m, n, k, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSorgqr(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  float*            A,
+                                  int               lda,
+                                  float*            tau,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return hipsolver_orgqr_template(
+        (hipsolver_host_handle*)handle, m, n, k, A, lda, tau, work, lwork, devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDorgqr(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  double*           A,
+                                  int               lda,
+                                  double*           tau,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return hipsolver_orgqr_template(
+        (hipsolver_host_handle*)handle, m, n, k, A, lda, tau, work, lwork, devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungqr(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  hipFloatComplex*  tau,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return hipsolver_orgqr_template((hipsolver_host_handle*)handle,
+                                    m,
+                                    n,
+                                    k,
+                                    (std::complex<float>*)A,
+                                    lda,
+                                    (std::complex<float>*)tau,
+                                    (std::complex<float>*)work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungqr(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  hipDoubleComplex* tau,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return hipsolver_orgqr_template((hipsolver_host_handle*)handle,
+                                    m,
+                                    n,
+                                    k,
+                                    (std::complex<double>*)A,
+                                    lda,
+                                    (std::complex<double>*)tau,
+                                    (std::complex<double>*)work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** ORGTR/UNGTR ********************/
+hipsolverStatus_t hipsolverSorgtr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              tau,
+                                             int*                lwork)
+try
+{
+    return hipsolver_orgtr_bufferSize_template<float>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDorgtr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             tau,
+                                             int*                lwork)
+try
+{
+    return hipsolver_orgtr_bufferSize_template<double>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungtr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             hipFloatComplex*    tau,
+                                             int*                lwork)
+try
+{
+    return hipsolver_orgtr_bufferSize_template<std::complex<float>>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungtr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             hipDoubleComplex*   tau,
+                                             int*                lwork)
+try
+{
+    return hipsolver_orgtr_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSorgtr(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              tau,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return hipsolver_orgtr_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_fill(uplo),
+                                    n,
+                                    A,
+                                    lda,
+                                    tau,
+                                    work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDorgtr(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             tau,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return hipsolver_orgtr_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_fill(uplo),
+                                    n,
+                                    A,
+                                    lda,
+                                    tau,
+                                    work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungtr(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    tau,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return hipsolver_orgtr_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_fill(uplo),
+                                    n,
+                                    (std::complex<float>*)A,
+                                    lda,
+                                    (std::complex<float>*)tau,
+                                    (std::complex<float>*)work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungtr(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   tau,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return hipsolver_orgtr_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_fill(uplo),
+                                    n,
+                                    (std::complex<double>*)A,
+                                    lda,
+                                    (std::complex<double>*)tau,
+                                    (std::complex<double>*)work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** ORMQR/UNMQR ********************/
+hipsolverStatus_t hipsolverSormqr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             float*               A,
+                                             int                  lda,
+                                             float*               tau,
+                                             float*               C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    return hipsolver_ormqr_bufferSize_template<float>((hipsolver_host_handle*)handle,
+                                                      hip2lapack_side(side),
+                                                      hip2lapack_operation(trans),
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      lda,
+                                                      ldc,
+                                                      lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDormqr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             double*              A,
+                                             int                  lda,
+                                             double*              tau,
+                                             double*              C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    return hipsolver_ormqr_bufferSize_template<double>((hipsolver_host_handle*)handle,
+                                                       hip2lapack_side(side),
+                                                       hip2lapack_operation(trans),
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       lda,
+                                                       ldc,
+                                                       lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCunmqr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             hipFloatComplex*     tau,
+                                             hipFloatComplex*     C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    return hipsolver_ormqr_bufferSize_template<std::complex<float>>((hipsolver_host_handle*)handle,
+                                                                    hip2lapack_side(side),
+                                                                    hip2lapack_operation(trans),
+                                                                    m,
+                                                                    n,
+                                                                    k,
+                                                                    lda,
+                                                                    ldc,
+                                                                    lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZunmqr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             hipDoubleComplex*    tau,
+                                             hipDoubleComplex*    C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    return hipsolver_ormqr_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle,
+        hip2lapack_side(side),
+        hip2lapack_operation(trans),
+        m,
+        n,
+        k,
+        lda,
+        ldc,
+        lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSormqr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  int                  k,
+                                  float*               A,
+                                  int                  lda,
+                                  float*               tau,
+                                  float*               C,
+                                  int                  ldc,
+                                  float*               work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return hipsolver_ormqr_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_side(side),
+                                    hip2lapack_operation(trans),
+                                    m,
+                                    n,
+                                    k,
+                                    A,
+                                    lda,
+                                    tau,
+                                    C,
+                                    ldc,
+                                    work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDormqr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  int                  k,
+                                  double*              A,
+                                  int                  lda,
+                                  double*              tau,
+                                  double*              C,
+                                  int                  ldc,
+                                  double*              work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return hipsolver_ormqr_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_side(side),
+                                    hip2lapack_operation(trans),
+                                    m,
+                                    n,
+                                    k,
+                                    A,
+                                    lda,
+                                    tau,
+                                    C,
+                                    ldc,
+                                    work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCunmqr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  int                  k,
+                                  hipFloatComplex*     A,
+                                  int                  lda,
+                                  hipFloatComplex*     tau,
+                                  hipFloatComplex*     C,
+                                  int                  ldc,
+                                  hipFloatComplex*     work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return hipsolver_ormqr_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_side(side),
+                                    hip2lapack_operation(trans),
+                                    m,
+                                    n,
+                                    k,
+                                    (std::complex<float>*)A,
+                                    lda,
+                                    (std::complex<float>*)tau,
+                                    (std::complex<float>*)C,
+                                    ldc,
+                                    (std::complex<float>*)work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZunmqr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  int                  k,
+                                  hipDoubleComplex*    A,
+                                  int                  lda,
+                                  hipDoubleComplex*    tau,
+                                  hipDoubleComplex*    C,
+                                  int                  ldc,
+                                  hipDoubleComplex*    work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return hipsolver_ormqr_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_side(side),
+                                    hip2lapack_operation(trans),
+                                    m,
+                                    n,
+                                    k,
+                                    (std::complex<double>*)A,
+                                    lda,
+                                    (std::complex<double>*)tau,
+                                    (std::complex<double>*)C,
+                                    ldc,
+                                    (std::complex<double>*)work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** ORMTR/UNMTR ********************/
+hipsolverStatus_t hipsolverSormtr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverFillMode_t  uplo,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             float*               A,
+                                             int                  lda,
+                                             float*               tau,
+                                             float*               C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    return hipsolver_ormtr_bufferSize_template<float>((hipsolver_host_handle*)handle,
+                                                      hip2lapack_side(side),
+                                                      hip2lapack_fill(uplo),
+                                                      hip2lapack_operation(trans),
+                                                      m,
+                                                      n,
+                                                      lda,
+                                                      ldc,
+                                                      lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDormtr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverFillMode_t  uplo,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             double*              A,
+                                             int                  lda,
+                                             double*              tau,
+                                             double*              C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    return hipsolver_ormtr_bufferSize_template<double>((hipsolver_host_handle*)handle,
+                                                       hip2lapack_side(side),
+                                                       hip2lapack_fill(uplo),
+                                                       hip2lapack_operation(trans),
+                                                       m,
+                                                       n,
+                                                       lda,
+                                                       ldc,
+                                                       lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCunmtr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverFillMode_t  uplo,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             hipFloatComplex*     tau,
+                                             hipFloatComplex*     C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    return hipsolver_ormtr_bufferSize_template<std::complex<float>>((hipsolver_host_handle*)handle,
+                                                                    hip2lapack_side(side),
+                                                                    hip2lapack_fill(uplo),
+                                                                    hip2lapack_operation(trans),
+                                                                    m,
+                                                                    n,
+                                                                    lda,
+                                                                    ldc,
+                                                                    lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZunmtr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverFillMode_t  uplo,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             hipDoubleComplex*    tau,
+                                             hipDoubleComplex*    C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    return hipsolver_ormtr_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle,
+        hip2lapack_side(side),
+        hip2lapack_fill(uplo),
+        hip2lapack_operation(trans),
+        m,
+        n,
+        lda,
+        ldc,
+        lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSormtr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverFillMode_t  uplo,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  float*               A,
+                                  int                  lda,
+                                  float*               tau,
+                                  float*               C,
+                                  int                  ldc,
+                                  float*               work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return hipsolver_ormtr_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_side(side),
+                                    hip2lapack_fill(uplo),
+                                    hip2lapack_operation(trans),
+                                    m,
+                                    n,
+                                    A,
+                                    lda,
+                                    tau,
+                                    C,
+                                    ldc,
+                                    work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDormtr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverFillMode_t  uplo,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  double*              A,
+                                  int                  lda,
+                                  double*              tau,
+                                  double*              C,
+                                  int                  ldc,
+                                  double*              work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return hipsolver_ormtr_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_side(side),
+                                    hip2lapack_fill(uplo),
+                                    hip2lapack_operation(trans),
+                                    m,
+                                    n,
+                                    A,
+                                    lda,
+                                    tau,
+                                    C,
+                                    ldc,
+                                    work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCunmtr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverFillMode_t  uplo,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  hipFloatComplex*     A,
+                                  int                  lda,
+                                  hipFloatComplex*     tau,
+                                  hipFloatComplex*     C,
+                                  int                  ldc,
+                                  hipFloatComplex*     work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return hipsolver_ormtr_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_side(side),
+                                    hip2lapack_fill(uplo),
+                                    hip2lapack_operation(trans),
+                                    m,
+                                    n,
+                                    (std::complex<float>*)A,
+                                    lda,
+                                    (std::complex<float>*)tau,
+                                    (std::complex<float>*)C,
+                                    ldc,
+                                    (std::complex<float>*)work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZunmtr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverFillMode_t  uplo,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  hipDoubleComplex*    A,
+                                  int                  lda,
+                                  hipDoubleComplex*    tau,
+                                  hipDoubleComplex*    C,
+                                  int                  ldc,
+                                  hipDoubleComplex*    work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return hipsolver_ormtr_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_side(side),
+                                    hip2lapack_fill(uplo),
+                                    hip2lapack_operation(trans),
+                                    m,
+                                    n,
+                                    (std::complex<double>*)A,
+                                    lda,
+                                    (std::complex<double>*)tau,
+                                    (std::complex<double>*)C,
+                                    ldc,
+                                    (std::complex<double>*)work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** CHOLQR2 ********************/
+hipsolverStatus_t hipsolverScholqr2_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, float* R, int ldr, int* lwork)
+try
+{
+    return hipsolver_cholqr_bufferSize_template<float>(
+        (hipsolver_host_handle*)handle, m, n, lda, ldr, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDcholqr2_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, double* R, int ldr, int* lwork)
+try
+{
+    return hipsolver_cholqr_bufferSize_template<double>(
+        (hipsolver_host_handle*)handle, m, n, lda, ldr, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCcholqr2_bufferSize(hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               hipFloatComplex*  A,
+                                               int               lda,
+                                               hipFloatComplex*  R,
+                                               int               ldr,
+                                               int*              lwork)
+try
+{
+    return hipsolver_cholqr_bufferSize_template<std::complex<float>>(
+        (hipsolver_host_handle*)handle, m, n, lda, ldr, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZcholqr2_bufferSize(hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               hipDoubleComplex* A,
+                                               int               lda,
+                                               hipDoubleComplex* R,
+                                               int               ldr,
+                                               int*              lwork)
+try
+{
+    return hipsolver_cholqr_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, m, n, lda, ldr, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverScholqr2(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    float*            A,
+                                    int               lda,
+                                    float*            R,
+                                    int               ldr,
+                                    float*            work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_cholqr_template(
+        (hipsolver_host_handle*)handle, false, m, n, A, lda, R, ldr, work, lwork, devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDcholqr2(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    double*           A,
+                                    int               lda,
+                                    double*           R,
+                                    int               ldr,
+                                    double*           work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_cholqr_template(
+        (hipsolver_host_handle*)handle, false, m, n, A, lda, R, ldr, work, lwork, devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCcholqr2(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    hipFloatComplex*  A,
+                                    int               lda,
+                                    hipFloatComplex*  R,
+                                    int               ldr,
+                                    hipFloatComplex*  work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_cholqr_template((hipsolver_host_handle*)handle,
+                                                         false,
+                                                         m,
+                                                         n,
+                                                         (std::complex<float>*)A,
+                                                         lda,
+                                                         (std::complex<float>*)R,
+                                                         ldr,
+                                                         (std::complex<float>*)work,
+                                                         lwork,
+                                                         devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZcholqr2(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    hipDoubleComplex* A,
+                                    int               lda,
+                                    hipDoubleComplex* R,
+                                    int               ldr,
+                                    hipDoubleComplex* work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_cholqr_template((hipsolver_host_handle*)handle,
+                                                         false,
+                                                         m,
+                                                         n,
+                                                         (std::complex<double>*)A,
+                                                         lda,
+                                                         (std::complex<double>*)R,
+                                                         ldr,
+                                                         (std::complex<double>*)work,
+                                                         lwork,
+                                                         devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** CHOLQR3 ********************/
+hipsolverStatus_t hipsolverScholqr3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, float* R, int ldr, int* lwork)
+try
+{
+    return hipsolver_cholqr_bufferSize_template<float>(
+        (hipsolver_host_handle*)handle, m, n, lda, ldr, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDcholqr3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, double* R, int ldr, int* lwork)
+try
+{
+    return hipsolver_cholqr_bufferSize_template<double>(
+        (hipsolver_host_handle*)handle, m, n, lda, ldr, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCcholqr3_bufferSize(hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               hipFloatComplex*  A,
+                                               int               lda,
+                                               hipFloatComplex*  R,
+                                               int               ldr,
+                                               int*              lwork)
+try
+{
+    return hipsolver_cholqr_bufferSize_template<std::complex<float>>(
+        (hipsolver_host_handle*)handle, m, n, lda, ldr, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZcholqr3_bufferSize(hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               hipDoubleComplex* A,
+                                               int               lda,
+                                               hipDoubleComplex* R,
+                                               int               ldr,
+                                               int*              lwork)
+try
+{
+    return hipsolver_cholqr_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, m, n, lda, ldr, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverScholqr3(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    float*            A,
+                                    int               lda,
+                                    float*            R,
+                                    int               ldr,
+                                    float*            work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_cholqr_template(
+        (hipsolver_host_handle*)handle, true, m, n, A, lda, R, ldr, work, lwork, devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDcholqr3(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    double*           A,
+                                    int               lda,
+                                    double*           R,
+                                    int               ldr,
+                                    double*           work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_cholqr_template(
+        (hipsolver_host_handle*)handle, true, m, n, A, lda, R, ldr, work, lwork, devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCcholqr3(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    hipFloatComplex*  A,
+                                    int               lda,
+                                    hipFloatComplex*  R,
+                                    int               ldr,
+                                    hipFloatComplex*  work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_cholqr_template((hipsolver_host_handle*)handle,
+                                                         true,
+                                                         m,
+                                                         n,
+                                                         (std::complex<float>*)A,
+                                                         lda,
+                                                         (std::complex<float>*)R,
+                                                         ldr,
+                                                         (std::complex<float>*)work,
+                                                         lwork,
+                                                         devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZcholqr3(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    hipDoubleComplex* A,
+                                    int               lda,
+                                    hipDoubleComplex* R,
+                                    int               ldr,
+                                    hipDoubleComplex* work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_cholqr_template((hipsolver_host_handle*)handle,
+                                                         true,
+                                                         m,
+                                                         n,
+                                                         (std::complex<double>*)A,
+                                                         lda,
+                                                         (std::complex<double>*)R,
+                                                         ldr,
+                                                         (std::complex<double>*)work,
+                                                         lwork,
+                                                         devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GEBRD ********************/
+hipsolverStatus_t hipsolverSgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+try
+{
+    return hipsolver_gebrd_bufferSize_template<float>((hipsolver_host_handle*)handle, m, n, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+try
+{
+    return hipsolver_gebrd_bufferSize_template<double>((hipsolver_host_handle*)handle, m, n, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+try
+{
+    return hipsolver_gebrd_bufferSize_template<std::complex<float>>((hipsolver_host_handle*)handle,
+                                                                    m,
+                                                                    n,
+                                                                    lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+try
+{
+    return hipsolver_gebrd_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, m, n, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgebrd(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  float*            D,
+                                  float*            E,
+                                  float*            tauq,
+                                  float*            taup,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return hipsolver_gebrd_template(
+        (hipsolver_host_handle*)handle, m, n, A, lda, D, E, tauq, taup, work, lwork, devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgebrd(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  double*           D,
+                                  double*           E,
+                                  double*           tauq,
+                                  double*           taup,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return hipsolver_gebrd_template(
+        (hipsolver_host_handle*)handle, m, n, A, lda, D, E, tauq, taup, work, lwork, devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgebrd(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  float*            D,
+                                  float*            E,
+                                  hipFloatComplex*  tauq,
+                                  hipFloatComplex*  taup,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return hipsolver_gebrd_template((hipsolver_host_handle*)handle,
+                                    m,
+                                    n,
+                                    (std::complex<float>*)A,
+                                    lda,
+                                    D,
+                                    E,
+                                    (std::complex<float>*)tauq,
+                                    (std::complex<float>*)taup,
+                                    (std::complex<float>*)work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgebrd(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  double*           D,
+                                  double*           E,
+                                  hipDoubleComplex* tauq,
+                                  hipDoubleComplex* taup,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return hipsolver_gebrd_template((hipsolver_host_handle*)handle,
+                                    m,
+                                    n,
+                                    (std::complex<double>*)A,
+                                    lda,
+                                    D,
+                                    E,
+                                    (std::complex<double>*)tauq,
+                                    (std::complex<double>*)taup,
+                                    (std::complex<double>*)work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GELS ********************/
+hipsolverStatus_t hipsolverSSgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             float*            A,
+                                             int               lda,
+                                             float*            B,
+                                             int               ldb,
+                                             float*            X,
+                                             int               ldx,
+                                             size_t*           lwork)
+try
+{
+    return hipsolver_gels_bufferSize_template<float>(
+        (hipsolver_host_handle*)handle, m, n, nrhs, lda, ldb, ldx, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDDgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             double*           A,
+                                             int               lda,
+                                             double*           B,
+                                             int               ldb,
+                                             double*           X,
+                                             int               ldx,
+                                             size_t*           lwork)
+try
+{
+    return hipsolver_gels_bufferSize_template<double>(
+        (hipsolver_host_handle*)handle, m, n, nrhs, lda, ldb, ldx, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCCgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             hipFloatComplex*  A,
+                                             int               lda,
+                                             hipFloatComplex*  B,
+                                             int               ldb,
+                                             hipFloatComplex*  X,
+                                             int               ldx,
+                                             size_t*           lwork)
+try
+{
+    return hipsolver_gels_bufferSize_template<std::complex<float>>(
+        (hipsolver_host_handle*)handle, m, n, nrhs, lda, ldb, ldx, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZZgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             hipDoubleComplex* A,
+                                             int               lda,
+                                             hipDoubleComplex* B,
+                                             int               ldb,
+                                             hipDoubleComplex* X,
+                                             int               ldx,
+                                             size_t*           lwork)
+try
+{
+    return hipsolver_gels_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, m, n, nrhs, lda, ldb, ldx, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSSgels(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               nrhs,
+                                  float*            A,
+                                  int               lda,
+                                  float*            B,
+                                  int               ldb,
+                                  float*            X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
+                                  int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_gels_template((hipsolver_host_handle*)handle,
+                                                       m,
+                                                       n,
+                                                       nrhs,
+                                                       A,
+                                                       lda,
+                                                       B,
+                                                       ldb,
+                                                       X,
+                                                       ldx,
+                                                       work,
+                                                       lwork,
+                                                       niters,
+                                                       devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDDgels(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               nrhs,
+                                  double*           A,
+                                  int               lda,
+                                  double*           B,
+                                  int               ldb,
+                                  double*           X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
+                                  int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_gels_template((hipsolver_host_handle*)handle,
+                                                       m,
+                                                       n,
+                                                       nrhs,
+                                                       A,
+                                                       lda,
+                                                       B,
+                                                       ldb,
+                                                       X,
+                                                       ldx,
+                                                       work,
+                                                       lwork,
+                                                       niters,
+                                                       devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCCgels(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               nrhs,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  hipFloatComplex*  B,
+                                  int               ldb,
+                                  hipFloatComplex*  X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
+                                  int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_gels_template((hipsolver_host_handle*)handle,
+                                                       m,
+                                                       n,
+                                                       nrhs,
+                                                       (std::complex<float>*)A,
+                                                       lda,
+                                                       (std::complex<float>*)B,
+                                                       ldb,
+                                                       (std::complex<float>*)X,
+                                                       ldx,
+                                                       work,
+                                                       lwork,
+                                                       niters,
+                                                       devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZZgels(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               nrhs,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  hipDoubleComplex* B,
+                                  int               ldb,
+                                  hipDoubleComplex* X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
+                                  int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_gels_template((hipsolver_host_handle*)handle,
+                                                       m,
+                                                       n,
+                                                       nrhs,
+                                                       (std::complex<double>*)A,
+                                                       lda,
+                                                       (std::complex<double>*)B,
+                                                       ldb,
+                                                       (std::complex<double>*)X,
+                                                       ldx,
+                                                       work,
+                                                       lwork,
+                                                       niters,
+                                                       devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSSgelsBatched_bufferSize(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    int               nrhs,
+                                                    float*            A[],
+                                                    int               lda,
+                                                    float*            B[],
+                                                    int               ldb,
+                                                    float*            X[],
+                                                    int               ldx,
+                                                    size_t*           lwork,
+                                                    int               batch_count)
+try
+{
+    return hipsolver_gels_bufferSize_template<float>(
+        (hipsolver_host_handle*)handle, m, n, nrhs, lda, ldb, ldx, lwork, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDDgelsBatched_bufferSize(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    int               nrhs,
+                                                    double*           A[],
+                                                    int               lda,
+                                                    double*           B[],
+                                                    int               ldb,
+                                                    double*           X[],
+                                                    int               ldx,
+                                                    size_t*           lwork,
+                                                    int               batch_count)
+try
+{
+    return hipsolver_gels_bufferSize_template<double>(
+        (hipsolver_host_handle*)handle, m, n, nrhs, lda, ldb, ldx, lwork, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCCgelsBatched_bufferSize(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    int               nrhs,
+                                                    hipFloatComplex*  A[],
+                                                    int               lda,
+                                                    hipFloatComplex*  B[],
+                                                    int               ldb,
+                                                    hipFloatComplex*  X[],
+                                                    int               ldx,
+                                                    size_t*           lwork,
+                                                    int               batch_count)
+try
+{
+    return hipsolver_gels_bufferSize_template<std::complex<float>>(
+        (hipsolver_host_handle*)handle, m, n, nrhs, lda, ldb, ldx, lwork, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZZgelsBatched_bufferSize(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    int               nrhs,
+                                                    hipDoubleComplex* A[],
+                                                    int               lda,
+                                                    hipDoubleComplex* B[],
+                                                    int               ldb,
+                                                    hipDoubleComplex* X[],
+                                                    int               ldx,
+                                                    size_t*           lwork,
+                                                    int               batch_count)
+try
+{
+    return hipsolver_gels_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, m, n, nrhs, lda, ldb, ldx, lwork, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSSgelsBatched(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         int               nrhs,
+                                         float*            A[],
+                                         int               lda,
+                                         float*            B[],
+                                         int               ldb,
+                                         float*            X[],
+                                         int               ldx,
+                                         void*             work,
+                                         size_t            lwork,
+                                         int*              niters,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_gels_batched_template((hipsolver_host_handle*)handle,
+                                                               m,
+                                                               n,
+                                                               nrhs,
+                                                               A,
+                                                               lda,
+                                                               B,
+                                                               ldb,
+                                                               X,
+                                                               ldx,
+                                                               niters,
+                                                               devInfo,
+                                                               batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDDgelsBatched(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         int               nrhs,
+                                         double*           A[],
+                                         int               lda,
+                                         double*           B[],
+                                         int               ldb,
+                                         double*           X[],
+                                         int               ldx,
+                                         void*             work,
+                                         size_t            lwork,
+                                         int*              niters,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_gels_batched_template((hipsolver_host_handle*)handle,
+                                                               m,
+                                                               n,
+                                                               nrhs,
+                                                               A,
+                                                               lda,
+                                                               B,
+                                                               ldb,
+                                                               X,
+                                                               ldx,
+                                                               niters,
+                                                               devInfo,
+                                                               batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCCgelsBatched(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         int               nrhs,
+                                         hipFloatComplex*  A[],
+                                         int               lda,
+                                         hipFloatComplex*  B[],
+                                         int               ldb,
+                                         hipFloatComplex*  X[],
+                                         int               ldx,
+                                         void*             work,
+                                         size_t            lwork,
+                                         int*              niters,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_gels_batched_template((hipsolver_host_handle*)handle,
+                                                               m,
+                                                               n,
+                                                               nrhs,
+                                                               (std::complex<float>**)A,
+                                                               lda,
+                                                               (std::complex<float>**)B,
+                                                               ldb,
+                                                               (std::complex<float>**)X,
+                                                               ldx,
+                                                               niters,
+                                                               devInfo,
+                                                               batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZZgelsBatched(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         int               nrhs,
+                                         hipDoubleComplex* A[],
+                                         int               lda,
+                                         hipDoubleComplex* B[],
+                                         int               ldb,
+                                         hipDoubleComplex* X[],
+                                         int               ldx,
+                                         void*             work,
+                                         size_t            lwork,
+                                         int*              niters,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_gels_batched_template((hipsolver_host_handle*)handle,
+                                                               m,
+                                                               n,
+                                                               nrhs,
+                                                               (std::complex<double>**)A,
+                                                               lda,
+                                                               (std::complex<double>**)B,
+                                                               ldb,
+                                                               (std::complex<double>**)X,
+                                                               ldx,
+                                                               niters,
+                                                               devInfo,
+                                                               batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GEQP3 ********************/
+hipsolverStatus_t hipsolverSgeqp3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+try
+{
+    return hipsolver_geqp3_bufferSize_template<float>(
+        (hipsolver_host_handle*)handle, false, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqp3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+try
+{
+    return hipsolver_geqp3_bufferSize_template<double>(
+        (hipsolver_host_handle*)handle, false, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqp3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+try
+{
+    return hipsolver_geqp3_bufferSize_template<std::complex<float>>(
+        (hipsolver_host_handle*)handle, false, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqp3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+try
+{
+    return hipsolver_geqp3_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, false, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgeqp3(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  int*              jpvt,
+                                  float*            tau,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_geqp3_template((hipsolver_host_handle*)handle,
+                                                        m,
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        jpvt,
+                                                        tau,
+                                                        false,
+                                                        float(0),
+                                                        (int*)nullptr,
+                                                        work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqp3(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  int*              jpvt,
+                                  double*           tau,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_geqp3_template((hipsolver_host_handle*)handle,
+                                                        m,
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        jpvt,
+                                                        tau,
+                                                        false,
+                                                        double(0),
+                                                        (int*)nullptr,
+                                                        work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqp3(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  int*              jpvt,
+                                  hipFloatComplex*  tau,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_geqp3_template((hipsolver_host_handle*)handle,
+                                                        m,
+                                                        n,
+                                                        (std::complex<float>*)A,
+                                                        lda,
+                                                        jpvt,
+                                                        (std::complex<float>*)tau,
+                                                        false,
+                                                        float(0),
+                                                        (int*)nullptr,
+                                                        (std::complex<float>*)work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqp3(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  int*              jpvt,
+                                  hipDoubleComplex* tau,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_geqp3_template((hipsolver_host_handle*)handle,
+                                                        m,
+                                                        n,
+                                                        (std::complex<double>*)A,
+                                                        lda,
+                                                        jpvt,
+                                                        (std::complex<double>*)tau,
+                                                        false,
+                                                        double(0),
+                                                        (int*)nullptr,
+                                                        (std::complex<double>*)work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GEQP3_TRUNCATED ********************/
+hipsolverStatus_t hipsolverSgeqp3Truncated_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+try
+{
+    return hipsolver_geqp3_bufferSize_template<float>(
+        (hipsolver_host_handle*)handle, true, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqp3Truncated_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+try
+{
+    return hipsolver_geqp3_bufferSize_template<double>(
+        (hipsolver_host_handle*)handle, true, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqp3Truncated_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+try
+{
+    return hipsolver_geqp3_bufferSize_template<std::complex<float>>(
+        (hipsolver_host_handle*)handle, true, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqp3Truncated_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+try
+{
+    return hipsolver_geqp3_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, true, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgeqp3Truncated(hipsolverHandle_t handle,
+                                           int               m,
+                                           int               n,
+                                           float*            A,
+                                           int               lda,
+                                           float             tol,
+                                           int*              jpvt,
+                                           float*            tau,
+                                           int*              rank,
+                                           float*            work,
+                                           int               lwork,
+                                           int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_geqp3_template((hipsolver_host_handle*)handle,
+                                                        m,
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        jpvt,
+                                                        tau,
+                                                        true,
+                                                        tol,
+                                                        rank,
+                                                        work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqp3Truncated(hipsolverHandle_t handle,
+                                           int               m,
+                                           int               n,
+                                           double*           A,
+                                           int               lda,
+                                           double            tol,
+                                           int*              jpvt,
+                                           double*           tau,
+                                           int*              rank,
+                                           double*           work,
+                                           int               lwork,
+                                           int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_geqp3_template((hipsolver_host_handle*)handle,
+                                                        m,
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        jpvt,
+                                                        tau,
+                                                        true,
+                                                        tol,
+                                                        rank,
+                                                        work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqp3Truncated(hipsolverHandle_t handle,
+                                           int               m,
+                                           int               n,
+                                           hipFloatComplex*  A,
+                                           int               lda,
+                                           float             tol,
+                                           int*              jpvt,
+                                           hipFloatComplex*  tau,
+                                           int*              rank,
+                                           hipFloatComplex*  work,
+                                           int               lwork,
+                                           int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_geqp3_template((hipsolver_host_handle*)handle,
+                                                        m,
+                                                        n,
+                                                        (std::complex<float>*)A,
+                                                        lda,
+                                                        jpvt,
+                                                        (std::complex<float>*)tau,
+                                                        true,
+                                                        tol,
+                                                        rank,
+                                                        (std::complex<float>*)work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqp3Truncated(hipsolverHandle_t handle,
+                                           int               m,
+                                           int               n,
+                                           hipDoubleComplex* A,
+                                           int               lda,
+                                           double            tol,
+                                           int*              jpvt,
+                                           hipDoubleComplex* tau,
+                                           int*              rank,
+                                           hipDoubleComplex* work,
+                                           int               lwork,
+                                           int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_geqp3_template((hipsolver_host_handle*)handle,
+                                                        m,
+                                                        n,
+                                                        (std::complex<double>*)A,
+                                                        lda,
+                                                        jpvt,
+                                                        (std::complex<double>*)tau,
+                                                        true,
+                                                        tol,
+                                                        rank,
+                                                        (std::complex<double>*)work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GEQRF ********************/
+hipsolverStatus_t hipsolverSgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+try
+{
+    return hipsolver_geqrf_bufferSize_template<float>(
+        (hipsolver_host_handle*)handle, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+try
+{
+    return hipsolver_geqrf_bufferSize_template<double>(
+        (hipsolver_host_handle*)handle, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+try
+{
+    return hipsolver_geqrf_bufferSize_template<std::complex<float>>(
+        (hipsolver_host_handle*)handle, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+try
+{
+    return hipsolver_geqrf_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgeqrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  float*            tau,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return hipsolver_geqrf_template(
+        (hipsolver_host_handle*)handle, m, n, A, lda, tau, work, lwork, devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  double*           tau,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return hipsolver_geqrf_template(
+        (hipsolver_host_handle*)handle, m, n, A, lda, tau, work, lwork, devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  hipFloatComplex*  tau,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return hipsolver_geqrf_template((hipsolver_host_handle*)handle,
+                                    m,
+                                    n,
+                                    (std::complex<float>*)A,
+                                    lda,
+                                    (std::complex<float>*)tau,
+                                    (std::complex<float>*)work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  hipDoubleComplex* tau,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return hipsolver_geqrf_template((hipsolver_host_handle*)handle,
+                                    m,
+                                    n,
+                                    (std::complex<double>*)A,
+                                    lda,
+                                    (std::complex<double>*)tau,
+                                    (std::complex<double>*)work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GEQRF_TSQR ********************/
+hipsolverStatus_t hipsolverSgeqrfTsqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+try
+{
+    return hipsolver_geqrf_bufferSize_template<float>(
+        (hipsolver_host_handle*)handle, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqrfTsqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+try
+{
+    return hipsolver_geqrf_bufferSize_template<double>(
+        (hipsolver_host_handle*)handle, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqrfTsqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+try
+{
+    return hipsolver_geqrf_bufferSize_template<std::complex<float>>(
+        (hipsolver_host_handle*)handle, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqrfTsqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+try
+{
+    return hipsolver_geqrf_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgeqrfTsqr(hipsolverHandle_t handle,
+                                      int               m,
+                                      int               n,
+                                      float*            A,
+                                      int               lda,
+                                      float*            tau,
+                                      float*            work,
+                                      int               lwork,
+                                      int*              devInfo)
+try
+{
+    return hipsolver_geqrf_template(
+        (hipsolver_host_handle*)handle, m, n, A, lda, tau, work, lwork, devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqrfTsqr(hipsolverHandle_t handle,
+                                      int               m,
+                                      int               n,
+                                      double*           A,
+                                      int               lda,
+                                      double*           tau,
+                                      double*           work,
+                                      int               lwork,
+                                      int*              devInfo)
+try
+{
+    return hipsolver_geqrf_template(
+        (hipsolver_host_handle*)handle, m, n, A, lda, tau, work, lwork, devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqrfTsqr(hipsolverHandle_t handle,
+                                      int               m,
+                                      int               n,
+                                      hipFloatComplex*  A,
+                                      int               lda,
+                                      hipFloatComplex*  tau,
+                                      hipFloatComplex*  work,
+                                      int               lwork,
+                                      int*              devInfo)
+try
+{
+    return hipsolver_geqrf_template((hipsolver_host_handle*)handle,
+                                    m,
+                                    n,
+                                    (std::complex<float>*)A,
+                                    lda,
+                                    (std::complex<float>*)tau,
+                                    (std::complex<float>*)work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqrfTsqr(hipsolverHandle_t handle,
+                                      int               m,
+                                      int               n,
+                                      hipDoubleComplex* A,
+                                      int               lda,
+                                      hipDoubleComplex* tau,
+                                      hipDoubleComplex* work,
+                                      int               lwork,
+                                      int*              devInfo)
+try
+{
+    return hipsolver_geqrf_template((hipsolver_host_handle*)handle,
+                                    m,
+                                    n,
+                                    (std::complex<double>*)A,
+                                    lda,
+                                    (std::complex<double>*)tau,
+                                    (std::complex<double>*)work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GESVD ********************/
+hipsolverStatus_t hipsolverSgesvd_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+try
+{
+    return hipsolver_gesvd_bufferSize_template<float>((hipsolver_host_handle*)handle,
+                                                      char2lapack_svect(jobu),
+                                                      char2lapack_svect(jobv),
+                                                      m,
+                                                      n,
+                                                      lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgesvd_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+try
+{
+    return hipsolver_gesvd_bufferSize_template<double>((hipsolver_host_handle*)handle,
+                                                       char2lapack_svect(jobu),
+                                                       char2lapack_svect(jobv),
+                                                       m,
+                                                       n,
+                                                       lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgesvd_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+try
+{
+    return hipsolver_gesvd_bufferSize_template<std::complex<float>>((hipsolver_host_handle*)handle,
+                                                                    char2lapack_svect(jobu),
+                                                                    char2lapack_svect(jobv),
+                                                                    m,
+                                                                    n,
+                                                                    lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgesvd_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+try
+{
+    return hipsolver_gesvd_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle,
+        char2lapack_svect(jobu),
+        char2lapack_svect(jobv),
+        m,
+        n,
+        lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgesvd(hipsolverHandle_t handle,
+                                  signed char       jobu,
+                                  signed char       jobv,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  float*            S,
+                                  float*            U,
+                                  int               ldu,
+                                  float*            V,
+                                  int               ldv,
+                                  float*            work,
+                                  int               lwork,
+                                  float*            rwork,
+                                  int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_gesvd_template((hipsolver_host_handle*)handle,
+                                                        char2lapack_svect(jobu),
+                                                        char2lapack_svect(jobv),
+                                                        m,
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        S,
+                                                        U,
+                                                        ldu,
+                                                        V,
+                                                        ldv,
+                                                        work,
+                                                        lwork,
+                                                        rwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgesvd(hipsolverHandle_t handle,
+                                  signed char       jobu,
+                                  signed char       jobv,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  double*           S,
+                                  double*           U,
+                                  int               ldu,
+                                  double*           V,
+                                  int               ldv,
+                                  double*           work,
+                                  int               lwork,
+                                  double*           rwork,
+                                  int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_gesvd_template((hipsolver_host_handle*)handle,
+                                                        char2lapack_svect(jobu),
+                                                        char2lapack_svect(jobv),
+                                                        m,
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        S,
+                                                        U,
+                                                        ldu,
+                                                        V,
+                                                        ldv,
+                                                        work,
+                                                        lwork,
+                                                        rwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgesvd(hipsolverHandle_t handle,
+                                  signed char       jobu,
+                                  signed char       jobv,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  float*            S,
+                                  hipFloatComplex*  U,
+                                  int               ldu,
+                                  hipFloatComplex*  V,
+                                  int               ldv,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  float*            rwork,
+                                  int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_gesvd_template((hipsolver_host_handle*)handle,
+                                                        char2lapack_svect(jobu),
+                                                        char2lapack_svect(jobv),
+                                                        m,
+                                                        n,
+                                                        (std::complex<float>*)A,
+                                                        lda,
+                                                        S,
+                                                        (std::complex<float>*)U,
+                                                        ldu,
+                                                        (std::complex<float>*)V,
+                                                        ldv,
+                                                        (std::complex<float>*)work,
+                                                        lwork,
+                                                        rwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgesvd(hipsolverHandle_t handle,
+                                  signed char       jobu,
+                                  signed char       jobv,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  double*           S,
+                                  hipDoubleComplex* U,
+                                  int               ldu,
+                                  hipDoubleComplex* V,
+                                  int               ldv,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  double*           rwork,
+                                  int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_gesvd_template((hipsolver_host_handle*)handle,
+                                                        char2lapack_svect(jobu),
+                                                        char2lapack_svect(jobv),
+                                                        m,
+                                                        n,
+                                                        (std::complex<double>*)A,
+                                                        lda,
+                                                        S,
+                                                        (std::complex<double>*)U,
+                                                        ldu,
+                                                        (std::complex<double>*)V,
+                                                        ldv,
+                                                        (std::complex<double>*)work,
+                                                        lwork,
+                                                        rwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRF ********************/
+hipsolverStatus_t hipsolverSgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+try
+{
+    return hipsolver_getrf_bufferSize_template<float>(
+        (hipsolver_host_handle*)handle, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+try
+{
+    return hipsolver_getrf_bufferSize_template<double>(
+        (hipsolver_host_handle*)handle, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+try
+{
+    return hipsolver_getrf_bufferSize_template<std::complex<float>>(
+        (hipsolver_host_handle*)handle, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+try
+{
+    return hipsolver_getrf_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, m, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_getrf_template(
+        (hipsolver_host_handle*)handle, m, n, A, lda, devIpiv, devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_getrf_template(
+        (hipsolver_host_handle*)handle, m, n, A, lda, devIpiv, devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_getrf_template(
+        (hipsolver_host_handle*)handle, m, n, (std::complex<float>*)A, lda, devIpiv, devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_getrf_template(
+        (hipsolver_host_handle*)handle, m, n, (std::complex<double>*)A, lda, devIpiv, devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRS ********************/
+hipsolverStatus_t hipsolverSgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             float*               A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             float*               B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    return hipsolver_getrs_bufferSize_template<float>(
+        (hipsolver_host_handle*)handle, hip2lapack_operation(trans), n, nrhs, lda, ldb, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             double*              A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             double*              B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    return hipsolver_getrs_bufferSize_template<double>(
+        (hipsolver_host_handle*)handle, hip2lapack_operation(trans), n, nrhs, lda, ldb, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             hipFloatComplex*     B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    return hipsolver_getrs_bufferSize_template<std::complex<float>>(
+        (hipsolver_host_handle*)handle, hip2lapack_operation(trans), n, nrhs, lda, ldb, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             hipDoubleComplex*    B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    return hipsolver_getrs_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, hip2lapack_operation(trans), n, nrhs, lda, ldb, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  float*               A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  float*               B,
+                                  int                  ldb,
+                                  float*               work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return hipsolver_getrs_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_operation(trans),
+                                    n,
+                                    nrhs,
+                                    A,
+                                    lda,
+                                    devIpiv,
+                                    B,
+                                    ldb,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  double*              A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  double*              B,
+                                  int                  ldb,
+                                  double*              work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return hipsolver_getrs_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_operation(trans),
+                                    n,
+                                    nrhs,
+                                    A,
+                                    lda,
+                                    devIpiv,
+                                    B,
+                                    ldb,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  hipFloatComplex*     A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  hipFloatComplex*     B,
+                                  int                  ldb,
+                                  hipFloatComplex*     work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return hipsolver_getrs_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_operation(trans),
+                                    n,
+                                    nrhs,
+                                    (std::complex<float>*)A,
+                                    lda,
+                                    devIpiv,
+                                    (std::complex<float>*)B,
+                                    ldb,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  hipDoubleComplex*    A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  hipDoubleComplex*    B,
+                                  int                  ldb,
+                                  hipDoubleComplex*    work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return hipsolver_getrs_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_operation(trans),
+                                    n,
+                                    nrhs,
+                                    (std::complex<double>*)A,
+                                    lda,
+                                    devIpiv,
+                                    (std::complex<double>*)B,
+                                    ldb,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRF_HOST ********************/
+hipsolverStatus_t hipsolverSgetrfHost(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* ipiv, int* info)
+try
+{
+    return hipsolver_getrf_host_template((hipsolver_host_handle*)handle, m, n, A, lda, ipiv, info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrfHost(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* ipiv, int* info)
+try
+{
+    return hipsolver_getrf_host_template((hipsolver_host_handle*)handle, m, n, A, lda, ipiv, info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrfHost(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* ipiv, int* info)
+try
+{
+    return hipsolver_getrf_host_template(
+        (hipsolver_host_handle*)handle, m, n, (std::complex<float>*)A, lda, ipiv, info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrfHost(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* ipiv, int* info)
+try
+{
+    return hipsolver_getrf_host_template(
+        (hipsolver_host_handle*)handle, m, n, (std::complex<double>*)A, lda, ipiv, info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRF_BATCHED_HOST ********************/
+hipsolverStatus_t hipsolverSgetrfBatchedHost(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             float*            A[],
+                                             int               lda,
+                                             int*              ipiv,
+                                             int               strideP,
+                                             int*              info,
+                                             int               batch_count)
+try
+{
+    return hipsolver_getrf_batched_host_template(
+        (hipsolver_host_handle*)handle, m, n, A, lda, ipiv, strideP, info, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrfBatchedHost(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             double*           A[],
+                                             int               lda,
+                                             int*              ipiv,
+                                             int               strideP,
+                                             int*              info,
+                                             int               batch_count)
+try
+{
+    return hipsolver_getrf_batched_host_template(
+        (hipsolver_host_handle*)handle, m, n, A, lda, ipiv, strideP, info, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrfBatchedHost(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipFloatComplex*  A[],
+                                             int               lda,
+                                             int*              ipiv,
+                                             int               strideP,
+                                             int*              info,
+                                             int               batch_count)
+try
+{
+    return hipsolver_getrf_batched_host_template((hipsolver_host_handle*)handle,
+                                                 m,
+                                                 n,
+                                                 (std::complex<float>**)A,
+                                                 lda,
+                                                 ipiv,
+                                                 strideP,
+                                                 info,
+                                                 batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrfBatchedHost(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipDoubleComplex* A[],
+                                             int               lda,
+                                             int*              ipiv,
+                                             int               strideP,
+                                             int*              info,
+                                             int               batch_count)
+try
+{
+    return hipsolver_getrf_batched_host_template((hipsolver_host_handle*)handle,
+                                                 m,
+                                                 n,
+                                                 (std::complex<double>**)A,
+                                                 lda,
+                                                 ipiv,
+                                                 strideP,
+                                                 info,
+                                                 batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRS_HOST ********************/
+hipsolverStatus_t hipsolverSgetrsHost(hipsolverHandle_t    handle,
+                                      hipsolverOperation_t trans,
+                                      int                  n,
+                                      int                  nrhs,
+                                      const float*         A,
+                                      int                  lda,
+                                      const int*           ipiv,
+                                      float*               B,
+                                      int                  ldb,
+                                      int*                 info)
+try
+{
+    return hipsolver_getrs_host_template((hipsolver_host_handle*)handle,
+                                         hip2lapack_operation(trans),
+                                         n,
+                                         nrhs,
+                                         A,
+                                         lda,
+                                         ipiv,
+                                         B,
+                                         ldb,
+                                         info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrsHost(hipsolverHandle_t    handle,
+                                      hipsolverOperation_t trans,
+                                      int                  n,
+                                      int                  nrhs,
+                                      const double*        A,
+                                      int                  lda,
+                                      const int*           ipiv,
+                                      double*              B,
+                                      int                  ldb,
+                                      int*                 info)
+try
+{
+    return hipsolver_getrs_host_template((hipsolver_host_handle*)handle,
+                                         hip2lapack_operation(trans),
+                                         n,
+                                         nrhs,
+                                         A,
+                                         lda,
+                                         ipiv,
+                                         B,
+                                         ldb,
+                                         info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrsHost(hipsolverHandle_t      handle,
+                                      hipsolverOperation_t   trans,
+                                      int                    n,
+                                      int                    nrhs,
+                                      const hipFloatComplex* A,
+                                      int                    lda,
+                                      const int*             ipiv,
+                                      hipFloatComplex*       B,
+                                      int                    ldb,
+                                      int*                   info)
+try
+{
+    return hipsolver_getrs_host_template((hipsolver_host_handle*)handle,
+                                         hip2lapack_operation(trans),
+                                         n,
+                                         nrhs,
+                                         (const std::complex<float>*)A,
+                                         lda,
+                                         ipiv,
+                                         (std::complex<float>*)B,
+                                         ldb,
+                                         info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrsHost(hipsolverHandle_t       handle,
+                                      hipsolverOperation_t    trans,
+                                      int                     n,
+                                      int                     nrhs,
+                                      const hipDoubleComplex* A,
+                                      int                     lda,
+                                      const int*              ipiv,
+                                      hipDoubleComplex*       B,
+                                      int                     ldb,
+                                      int*                    info)
+try
+{
+    return hipsolver_getrs_host_template((hipsolver_host_handle*)handle,
+                                         hip2lapack_operation(trans),
+                                         n,
+                                         nrhs,
+                                         (const std::complex<double>*)A,
+                                         lda,
+                                         ipiv,
+                                         (std::complex<double>*)B,
+                                         ldb,
+                                         info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRS_BATCHED_HOST ********************/
+hipsolverStatus_t hipsolverSgetrsBatchedHost(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             float*               A[],
+                                             int                  lda,
+                                             const int*           ipiv,
+                                             int                  strideP,
+                                             float*               B[],
+                                             int                  ldb,
+                                             int*                 info,
+                                             int                  batch_count)
+try
+{
+    return hipsolver_getrs_batched_host_template((hipsolver_host_handle*)handle,
+                                                 hip2lapack_operation(trans),
+                                                 n,
+                                                 nrhs,
+                                                 A,
+                                                 lda,
+                                                 ipiv,
+                                                 strideP,
+                                                 B,
+                                                 ldb,
+                                                 info,
+                                                 batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrsBatchedHost(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             double*              A[],
+                                             int                  lda,
+                                             const int*           ipiv,
+                                             int                  strideP,
+                                             double*              B[],
+                                             int                  ldb,
+                                             int*                 info,
+                                             int                  batch_count)
+try
+{
+    return hipsolver_getrs_batched_host_template((hipsolver_host_handle*)handle,
+                                                 hip2lapack_operation(trans),
+                                                 n,
+                                                 nrhs,
+                                                 A,
+                                                 lda,
+                                                 ipiv,
+                                                 strideP,
+                                                 B,
+                                                 ldb,
+                                                 info,
+                                                 batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrsBatchedHost(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipFloatComplex*     A[],
+                                             int                  lda,
+                                             const int*           ipiv,
+                                             int                  strideP,
+                                             hipFloatComplex*     B[],
+                                             int                  ldb,
+                                             int*                 info,
+                                             int                  batch_count)
+try
+{
+    return hipsolver_getrs_batched_host_template((hipsolver_host_handle*)handle,
+                                                 hip2lapack_operation(trans),
+                                                 n,
+                                                 nrhs,
+                                                 (std::complex<float>**)A,
+                                                 lda,
+                                                 ipiv,
+                                                 strideP,
+                                                 (std::complex<float>**)B,
+                                                 ldb,
+                                                 info,
+                                                 batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrsBatchedHost(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipDoubleComplex*    A[],
+                                             int                  lda,
+                                             const int*           ipiv,
+                                             int                  strideP,
+                                             hipDoubleComplex*    B[],
+                                             int                  ldb,
+                                             int*                 info,
+                                             int                  batch_count)
+try
+{
+    return hipsolver_getrs_batched_host_template((hipsolver_host_handle*)handle,
+                                                 hip2lapack_operation(trans),
+                                                 n,
+                                                 nrhs,
+                                                 (std::complex<double>**)A,
+                                                 lda,
+                                                 ipiv,
+                                                 strideP,
+                                                 (std::complex<double>**)B,
+                                                 ldb,
+                                                 info,
+                                                 batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRF_COMPACT ********************/
+hipsolverStatus_t hipsolverSgetrfCompact(hipsolverHandle_t handle,
+                                         int               n,
+                                         float*            Ac,
+                                         int*              devIpiv,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_getrf_compact_template(
+        (hipsolver_host_handle*)handle, n, Ac, devIpiv, devInfo, batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrfCompact(hipsolverHandle_t handle,
+                                         int               n,
+                                         double*           Ac,
+                                         int*              devIpiv,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_getrf_compact_template(
+        (hipsolver_host_handle*)handle, n, Ac, devIpiv, devInfo, batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrfCompact(hipsolverHandle_t handle,
+                                         int               n,
+                                         hipFloatComplex*  Ac,
+                                         int*              devIpiv,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_getrf_compact_template(
+        (hipsolver_host_handle*)handle, n, (std::complex<float>*)Ac, devIpiv, devInfo, batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrfCompact(hipsolverHandle_t handle,
+                                         int               n,
+                                         hipDoubleComplex* Ac,
+                                         int*              devIpiv,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_getrf_compact_template((hipsolver_host_handle*)handle,
+                                                                n,
+                                                                (std::complex<double>*)Ac,
+                                                                devIpiv,
+                                                                devInfo,
+                                                                batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRS_COMPACT ********************/
+hipsolverStatus_t hipsolverSgetrsCompact(hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         const float*         Ac,
+                                         const int*           devIpiv,
+                                         float*               Bc,
+                                         int*                 devInfo,
+                                         int                  batch_count)
+try
+{
+    return hipsolver_getrs_compact_template((hipsolver_host_handle*)handle,
+                                            hip2lapack_operation(trans),
+                                            n,
+                                            nrhs,
+                                            Ac,
+                                            devIpiv,
+                                            Bc,
+                                            devInfo,
+                                            batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrsCompact(hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         const double*        Ac,
+                                         const int*           devIpiv,
+                                         double*              Bc,
+                                         int*                 devInfo,
+                                         int                  batch_count)
+try
+{
+    return hipsolver_getrs_compact_template((hipsolver_host_handle*)handle,
+                                            hip2lapack_operation(trans),
+                                            n,
+                                            nrhs,
+                                            Ac,
+                                            devIpiv,
+                                            Bc,
+                                            devInfo,
+                                            batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrsCompact(hipsolverHandle_t      handle,
+                                         hipsolverOperation_t   trans,
+                                         int                    n,
+                                         int                    nrhs,
+                                         const hipFloatComplex* Ac,
+                                         const int*             devIpiv,
+                                         hipFloatComplex*       Bc,
+                                         int*                   devInfo,
+                                         int                    batch_count)
+try
+{
+    return hipsolver_getrs_compact_template((hipsolver_host_handle*)handle,
+                                            hip2lapack_operation(trans),
+                                            n,
+                                            nrhs,
+                                            (const std::complex<float>*)Ac,
+                                            devIpiv,
+                                            (std::complex<float>*)Bc,
+                                            devInfo,
+                                            batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrsCompact(hipsolverHandle_t       handle,
+                                         hipsolverOperation_t    trans,
+                                         int                     n,
+                                         int                     nrhs,
+                                         const hipDoubleComplex* Ac,
+                                         const int*              devIpiv,
+                                         hipDoubleComplex*       Bc,
+                                         int*                    devInfo,
+                                         int                     batch_count)
+try
+{
+    return hipsolver_getrs_compact_template((hipsolver_host_handle*)handle,
+                                            hip2lapack_operation(trans),
+                                            n,
+                                            nrhs,
+                                            (const std::complex<double>*)Ac,
+                                            devIpiv,
+                                            (std::complex<double>*)Bc,
+                                            devInfo,
+                                            batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** MG_GETRF ********************/
+hipsolverStatus_t hipsolverMgSgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               int                     m,
+                                               int                     n,
+                                               float*                  A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    ipiv[],
+                                               int*                    lwork)
+try
+{
+    return hipsolver_mg_bufferSize_template((hipsolver_host_mg_handle*)handle,
+                                            'L',
+                                            'N',
+                                            m,
+                                            n,
+                                            ia,
+                                            ja,
+                                            (hipsolver_host_mg_desc*)descA,
+                                            lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgDgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               int                     m,
+                                               int                     n,
+                                               double*                 A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    ipiv[],
+                                               int*                    lwork)
+try
+{
+    return hipsolver_mg_bufferSize_template((hipsolver_host_mg_handle*)handle,
+                                            'L',
+                                            'N',
+                                            m,
+                                            n,
+                                            ia,
+                                            ja,
+                                            (hipsolver_host_mg_desc*)descA,
+                                            lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgCgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               int                     m,
+                                               int                     n,
+                                               hipFloatComplex*        A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    ipiv[],
+                                               int*                    lwork)
+try
+{
+    return hipsolver_mg_bufferSize_template((hipsolver_host_mg_handle*)handle,
+                                            'L',
+                                            'N',
+                                            m,
+                                            n,
+                                            ia,
+                                            ja,
+                                            (hipsolver_host_mg_desc*)descA,
+                                            lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgZgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               int                     m,
+                                               int                     n,
+                                               hipDoubleComplex*       A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    ipiv[],
+                                               int*                    lwork)
+try
+{
+    return hipsolver_mg_bufferSize_template((hipsolver_host_mg_handle*)handle,
+                                            'L',
+                                            'N',
+                                            m,
+                                            n,
+                                            ia,
+                                            ja,
+                                            (hipsolver_host_mg_desc*)descA,
+                                            lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgSgetrf(hipsolverMgHandle_t     handle,
+                                    int                     m,
+                                    int                     n,
+                                    float*                  A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    int*                    ipiv[],
+                                    float*                  work[],
+                                    int                     lwork,
+                                    int*                    info)
+try
+{
+    return hipsolver_mg_template((hipsolver_host_mg_handle*)handle,
+                                 hipsolver_host_mg_lu,
+                                 'L',
+                                 'N',
+                                 m,
+                                 n,
+                                 A,
+                                 ia,
+                                 ja,
+                                 (hipsolver_host_mg_desc*)descA,
+                                 ipiv,
+                                 (float*)nullptr,
+                                 info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgDgetrf(hipsolverMgHandle_t     handle,
+                                    int                     m,
+                                    int                     n,
+                                    double*                 A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    int*                    ipiv[],
+                                    double*                 work[],
+                                    int                     lwork,
+                                    int*                    info)
+try
+{
+    return hipsolver_mg_template((hipsolver_host_mg_handle*)handle,
+                                 hipsolver_host_mg_lu,
+                                 'L',
+                                 'N',
+                                 m,
+                                 n,
+                                 A,
+                                 ia,
+                                 ja,
+                                 (hipsolver_host_mg_desc*)descA,
+                                 ipiv,
+                                 (double*)nullptr,
+                                 info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgCgetrf(hipsolverMgHandle_t     handle,
+                                    int                     m,
+                                    int                     n,
+                                    hipFloatComplex*        A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    int*                    ipiv[],
+                                    hipFloatComplex*        work[],
+                                    int                     lwork,
+                                    int*                    info)
+try
+{
+    return hipsolver_mg_template((hipsolver_host_mg_handle*)handle,
+                                 hipsolver_host_mg_lu,
+                                 'L',
+                                 'N',
+                                 m,
+                                 n,
+                                 (std::complex<float>**)A,
+                                 ia,
+                                 ja,
+                                 (hipsolver_host_mg_desc*)descA,
+                                 ipiv,
+                                 (float*)nullptr,
+                                 info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgZgetrf(hipsolverMgHandle_t     handle,
+                                    int                     m,
+                                    int                     n,
+                                    hipDoubleComplex*       A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    int*                    ipiv[],
+                                    hipDoubleComplex*       work[],
+                                    int                     lwork,
+                                    int*                    info)
+try
+{
+    return hipsolver_mg_template((hipsolver_host_mg_handle*)handle,
+                                 hipsolver_host_mg_lu,
+                                 'L',
+                                 'N',
+                                 m,
+                                 n,
+                                 (std::complex<double>**)A,
+                                 ia,
+                                 ja,
+                                 (hipsolver_host_mg_desc*)descA,
+                                 ipiv,
+                                 (double*)nullptr,
+                                 info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** MG_POTRF ********************/
+hipsolverStatus_t hipsolverMgSpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               float*                  A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    lwork)
+try
+{
+    return hipsolver_mg_bufferSize_template((hipsolver_host_mg_handle*)handle,
+                                            hip2lapack_fill(uplo),
+                                            'N',
+                                            n,
+                                            n,
+                                            ia,
+                                            ja,
+                                            (hipsolver_host_mg_desc*)descA,
+                                            lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgDpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               double*                 A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    lwork)
+try
+{
+    return hipsolver_mg_bufferSize_template((hipsolver_host_mg_handle*)handle,
+                                            hip2lapack_fill(uplo),
+                                            'N',
+                                            n,
+                                            n,
+                                            ia,
+                                            ja,
+                                            (hipsolver_host_mg_desc*)descA,
+                                            lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgCpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipFloatComplex*        A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    lwork)
+try
+{
+    return hipsolver_mg_bufferSize_template((hipsolver_host_mg_handle*)handle,
+                                            hip2lapack_fill(uplo),
+                                            'N',
+                                            n,
+                                            n,
+                                            ia,
+                                            ja,
+                                            (hipsolver_host_mg_desc*)descA,
+                                            lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgZpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipDoubleComplex*       A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    lwork)
+try
+{
+    return hipsolver_mg_bufferSize_template((hipsolver_host_mg_handle*)handle,
+                                            hip2lapack_fill(uplo),
+                                            'N',
+                                            n,
+                                            n,
+                                            ia,
+                                            ja,
+                                            (hipsolver_host_mg_desc*)descA,
+                                            lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgSpotrf(hipsolverMgHandle_t     handle,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    float*                  A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    float*                  work[],
+                                    int                     lwork,
+                                    int*                    info)
+try
+{
+    return hipsolver_mg_template((hipsolver_host_mg_handle*)handle,
+                                 hipsolver_host_mg_cholesky,
+                                 hip2lapack_fill(uplo),
+                                 'N',
+                                 n,
+                                 n,
+                                 A,
+                                 ia,
+                                 ja,
+                                 (hipsolver_host_mg_desc*)descA,
+                                 (int**)nullptr,
+                                 (float*)nullptr,
+                                 info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgDpotrf(hipsolverMgHandle_t     handle,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    double*                 A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    double*                 work[],
+                                    int                     lwork,
+                                    int*                    info)
+try
+{
+    return hipsolver_mg_template((hipsolver_host_mg_handle*)handle,
+                                 hipsolver_host_mg_cholesky,
+                                 hip2lapack_fill(uplo),
+                                 'N',
+                                 n,
+                                 n,
+                                 A,
+                                 ia,
+                                 ja,
+                                 (hipsolver_host_mg_desc*)descA,
+                                 (int**)nullptr,
+                                 (double*)nullptr,
+                                 info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgCpotrf(hipsolverMgHandle_t     handle,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    hipFloatComplex*        A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    hipFloatComplex*        work[],
+                                    int                     lwork,
+                                    int*                    info)
+try
+{
+    return hipsolver_mg_template((hipsolver_host_mg_handle*)handle,
+                                 hipsolver_host_mg_cholesky,
+                                 hip2lapack_fill(uplo),
+                                 'N',
+                                 n,
+                                 n,
+                                 (std::complex<float>**)A,
+                                 ia,
+                                 ja,
+                                 (hipsolver_host_mg_desc*)descA,
+                                 (int**)nullptr,
+                                 (float*)nullptr,
+                                 info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgZpotrf(hipsolverMgHandle_t     handle,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    hipDoubleComplex*       A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    hipDoubleComplex*       work[],
+                                    int                     lwork,
+                                    int*                    info)
+try
+{
+    return hipsolver_mg_template((hipsolver_host_mg_handle*)handle,
+                                 hipsolver_host_mg_cholesky,
+                                 hip2lapack_fill(uplo),
+                                 'N',
+                                 n,
+                                 n,
+                                 (std::complex<double>**)A,
+                                 ia,
+                                 ja,
+                                 (hipsolver_host_mg_desc*)descA,
+                                 (int**)nullptr,
+                                 (double*)nullptr,
+                                 info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** MG_SYEVD/MG_HEEVD ********************/
+hipsolverStatus_t hipsolverMgSsyevd_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               float*                  A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               float*                  W,
+                                               int*                    lwork)
+try
+{
+    return hipsolver_mg_bufferSize_template((hipsolver_host_mg_handle*)handle,
+                                            hip2lapack_fill(uplo),
+                                            hip2lapack_evect(jobz),
+                                            n,
+                                            n,
+                                            ia,
+                                            ja,
+                                            (hipsolver_host_mg_desc*)descA,
+                                            lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgDsyevd_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               double*                 A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               double*                 W,
+                                               int*                    lwork)
+try
+{
+    return hipsolver_mg_bufferSize_template((hipsolver_host_mg_handle*)handle,
+                                            hip2lapack_fill(uplo),
+                                            hip2lapack_evect(jobz),
+                                            n,
+                                            n,
+                                            ia,
+                                            ja,
+                                            (hipsolver_host_mg_desc*)descA,
+                                            lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgCheevd_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipFloatComplex*        A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               float*                  W,
+                                               int*                    lwork)
+try
+{
+    return hipsolver_mg_bufferSize_template((hipsolver_host_mg_handle*)handle,
+                                            hip2lapack_fill(uplo),
+                                            hip2lapack_evect(jobz),
+                                            n,
+                                            n,
+                                            ia,
+                                            ja,
+                                            (hipsolver_host_mg_desc*)descA,
+                                            lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgZheevd_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipDoubleComplex*       A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               double*                 W,
+                                               int*                    lwork)
+try
+{
+    return hipsolver_mg_bufferSize_template((hipsolver_host_mg_handle*)handle,
+                                            hip2lapack_fill(uplo),
+                                            hip2lapack_evect(jobz),
+                                            n,
+                                            n,
+                                            ia,
+                                            ja,
+                                            (hipsolver_host_mg_desc*)descA,
+                                            lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgSsyevd(hipsolverMgHandle_t     handle,
+                                    hipsolverEigMode_t      jobz,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    float*                  A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    float*                  W,
+                                    float*                  work[],
+                                    int                     lwork,
+                                    int*                    info)
+try
+{
+    return hipsolver_mg_template((hipsolver_host_mg_handle*)handle,
+                                 hipsolver_host_mg_eigen,
+                                 hip2lapack_fill(uplo),
+                                 hip2lapack_evect(jobz),
+                                 n,
+                                 n,
+                                 A,
+                                 ia,
+                                 ja,
+                                 (hipsolver_host_mg_desc*)descA,
+                                 (int**)nullptr,
+                                 W,
+                                 info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgDsyevd(hipsolverMgHandle_t     handle,
+                                    hipsolverEigMode_t      jobz,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    double*                 A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    double*                 W,
+                                    double*                 work[],
+                                    int                     lwork,
+                                    int*                    info)
+try
+{
+    return hipsolver_mg_template((hipsolver_host_mg_handle*)handle,
+                                 hipsolver_host_mg_eigen,
+                                 hip2lapack_fill(uplo),
+                                 hip2lapack_evect(jobz),
+                                 n,
+                                 n,
+                                 A,
+                                 ia,
+                                 ja,
+                                 (hipsolver_host_mg_desc*)descA,
+                                 (int**)nullptr,
+                                 W,
+                                 info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgCheevd(hipsolverMgHandle_t     handle,
+                                    hipsolverEigMode_t      jobz,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    hipFloatComplex*        A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    float*                  W,
+                                    hipFloatComplex*        work[],
+                                    int                     lwork,
+                                    int*                    info)
+try
+{
+    return hipsolver_mg_template((hipsolver_host_mg_handle*)handle,
+                                 hipsolver_host_mg_eigen,
+                                 hip2lapack_fill(uplo),
+                                 hip2lapack_evect(jobz),
+                                 n,
+                                 n,
+                                 (std::complex<float>**)A,
+                                 ia,
+                                 ja,
+                                 (hipsolver_host_mg_desc*)descA,
+                                 (int**)nullptr,
+                                 W,
+                                 info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgZheevd(hipsolverMgHandle_t     handle,
+                                    hipsolverEigMode_t      jobz,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    hipDoubleComplex*       A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    double*                 W,
+                                    hipDoubleComplex*       work[],
+                                    int                     lwork,
+                                    int*                    info)
+try
+{
+    return hipsolver_mg_template((hipsolver_host_mg_handle*)handle,
+                                 hipsolver_host_mg_eigen,
+                                 hip2lapack_fill(uplo),
+                                 hip2lapack_evect(jobz),
+                                 n,
+                                 n,
+                                 (std::complex<double>**)A,
+                                 ia,
+                                 ja,
+                                 (hipsolver_host_mg_desc*)descA,
+                                 (int**)nullptr,
+                                 W,
+                                 info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** PACK_COMPACT ********************/
+hipsolverStatus_t hipsolverSpackCompact(hipsolverHandle_t handle,
+                                        int               m,
+                                        int               n,
+                                        const float*      A,
+                                        int               lda,
+                                        int               strideA,
+                                        float*            Ac,
+                                        int               batch_count)
+try
+{
+    return hipsolver_pack_compact_template(
+        (hipsolver_host_handle*)handle, m, n, A, lda, strideA, Ac, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpackCompact(hipsolverHandle_t handle,
+                                        int               m,
+                                        int               n,
+                                        const double*     A,
+                                        int               lda,
+                                        int               strideA,
+                                        double*           Ac,
+                                        int               batch_count)
+try
+{
+    return hipsolver_pack_compact_template(
+        (hipsolver_host_handle*)handle, m, n, A, lda, strideA, Ac, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpackCompact(hipsolverHandle_t      handle,
+                                        int                    m,
+                                        int                    n,
+                                        const hipFloatComplex* A,
+                                        int                    lda,
+                                        int                    strideA,
+                                        hipFloatComplex*       Ac,
+                                        int                    batch_count)
+try
+{
+    return hipsolver_pack_compact_template((hipsolver_host_handle*)handle,
+                                           m,
+                                           n,
+                                           (const std::complex<float>*)A,
+                                           lda,
+                                           strideA,
+                                           (std::complex<float>*)Ac,
+                                           batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpackCompact(hipsolverHandle_t       handle,
+                                        int                     m,
+                                        int                     n,
+                                        const hipDoubleComplex* A,
+                                        int                     lda,
+                                        int                     strideA,
+                                        hipDoubleComplex*       Ac,
+                                        int                     batch_count)
+try
+{
+    return hipsolver_pack_compact_template((hipsolver_host_handle*)handle,
+                                           m,
+                                           n,
+                                           (const std::complex<double>*)A,
+                                           lda,
+                                           strideA,
+                                           (std::complex<double>*)Ac,
+                                           batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** UNPACK_COMPACT ********************/
+hipsolverStatus_t hipsolverSunpackCompact(hipsolverHandle_t handle,
+                                          int               m,
+                                          int               n,
+                                          const float*      Ac,
+                                          float*            A,
+                                          int               lda,
+                                          int               strideA,
+                                          int               batch_count)
+try
+{
+    return hipsolver_unpack_compact_template(
+        (hipsolver_host_handle*)handle, m, n, Ac, A, lda, strideA, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDunpackCompact(hipsolverHandle_t handle,
+                                          int               m,
+                                          int               n,
+                                          const double*     Ac,
+                                          double*           A,
+                                          int               lda,
+                                          int               strideA,
+                                          int               batch_count)
+try
+{
+    return hipsolver_unpack_compact_template(
+        (hipsolver_host_handle*)handle, m, n, Ac, A, lda, strideA, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCunpackCompact(hipsolverHandle_t      handle,
+                                          int                    m,
+                                          int                    n,
+                                          const hipFloatComplex* Ac,
+                                          hipFloatComplex*       A,
+                                          int                    lda,
+                                          int                    strideA,
+                                          int                    batch_count)
+try
+{
+    return hipsolver_unpack_compact_template((hipsolver_host_handle*)handle,
+                                             m,
+                                             n,
+                                             (const std::complex<float>*)Ac,
+                                             (std::complex<float>*)A,
+                                             lda,
+                                             strideA,
+                                             batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZunpackCompact(hipsolverHandle_t       handle,
+                                          int                     m,
+                                          int                     n,
+                                          const hipDoubleComplex* Ac,
+                                          hipDoubleComplex*       A,
+                                          int                     lda,
+                                          int                     strideA,
+                                          int                     batch_count)
+try
+{
+    return hipsolver_unpack_compact_template((hipsolver_host_handle*)handle,
+                                             m,
+                                             n,
+                                             (const std::complex<double>*)Ac,
+                                             (std::complex<double>*)A,
+                                             lda,
+                                             strideA,
+                                             batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POSV_SUBMIT ********************/
+hipsolverStatus_t hipsolverSposvSubmit(hipsolverBatchQueue_t    queue,
+                                       hipsolverFillMode_t      uplo,
+                                       int                      n,
+                                       int                      nrhs,
+                                       float*                   A,
+                                       int                      lda,
+                                       float*                   B,
+                                       int                      ldb,
+                                       hipStream_t              stream,
+                                       hipsolverBatchRequest_t* request)
+try
+{
+    return hipsolver_posv_submit((hipsolver_host_batch_queue*)queue,
+                                 hip2lapack_fill(uplo),
+                                 n,
+                                 nrhs,
+                                 A,
+                                 lda,
+                                 B,
+                                 ldb,
+                                 stream,
+                                 (hipsolver_host_batch_request**)request);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDposvSubmit(hipsolverBatchQueue_t    queue,
+                                       hipsolverFillMode_t      uplo,
+                                       int                      n,
+                                       int                      nrhs,
+                                       double*                  A,
+                                       int                      lda,
+                                       double*                  B,
+                                       int                      ldb,
+                                       hipStream_t              stream,
+                                       hipsolverBatchRequest_t* request)
+try
+{
+    return hipsolver_posv_submit((hipsolver_host_batch_queue*)queue,
+                                 hip2lapack_fill(uplo),
+                                 n,
+                                 nrhs,
+                                 A,
+                                 lda,
+                                 B,
+                                 ldb,
+                                 stream,
+                                 (hipsolver_host_batch_request**)request);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCposvSubmit(hipsolverBatchQueue_t    queue,
+                                       hipsolverFillMode_t      uplo,
+                                       int                      n,
+                                       int                      nrhs,
+                                       hipFloatComplex*         A,
+                                       int                      lda,
+                                       hipFloatComplex*         B,
+                                       int                      ldb,
+                                       hipStream_t              stream,
+                                       hipsolverBatchRequest_t* request)
+try
+{
+    return hipsolver_posv_submit((hipsolver_host_batch_queue*)queue,
+                                 hip2lapack_fill(uplo),
+                                 n,
+                                 nrhs,
+                                 (std::complex<float>*)A,
+                                 lda,
+                                 (std::complex<float>*)B,
+                                 ldb,
+                                 stream,
+                                 (hipsolver_host_batch_request**)request);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZposvSubmit(hipsolverBatchQueue_t    queue,
+                                       hipsolverFillMode_t      uplo,
+                                       int                      n,
+                                       int                      nrhs,
+                                       hipDoubleComplex*        A,
+                                       int                      lda,
+                                       hipDoubleComplex*        B,
+                                       int                      ldb,
+                                       hipStream_t              stream,
+                                       hipsolverBatchRequest_t* request)
+try
+{
+    return hipsolver_posv_submit((hipsolver_host_batch_queue*)queue,
+                                 hip2lapack_fill(uplo),
+                                 n,
+                                 nrhs,
+                                 (std::complex<double>*)A,
+                                 lda,
+                                 (std::complex<double>*)B,
+                                 ldb,
+                                 stream,
+                                 (hipsolver_host_batch_request**)request);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF ********************/
+hipsolverStatus_t hipsolverSpotrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork)
+try
+{
+    return hipsolver_potrf_bufferSize_template<float>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork)
+try
+{
+    return hipsolver_potrf_bufferSize_template<double>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             int*                lwork)
+try
+{
+    return hipsolver_potrf_bufferSize_template<std::complex<float>>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             int*                lwork)
+try
+{
+    return hipsolver_potrf_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_potrf_template(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, A, lda, devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_potrf_template(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, A, lda, devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_potrf_template((hipsolver_host_handle*)handle,
+                                                        hip2lapack_fill(uplo),
+                                                        n,
+                                                        (std::complex<float>*)A,
+                                                        lda,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_potrf_template((hipsolver_host_handle*)handle,
+                                                        hip2lapack_fill(uplo),
+                                                        n,
+                                                        (std::complex<double>*)A,
+                                                        lda,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_BATCHED ********************/
+hipsolverStatus_t hipsolverSpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    return hipsolver_potrf_bufferSize_template<float>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, lda, lwork, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    return hipsolver_potrf_bufferSize_template<double>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, lda, lwork, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipFloatComplex*    A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    return hipsolver_potrf_bufferSize_template<std::complex<float>>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, lda, lwork, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipDoubleComplex*   A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    return hipsolver_potrf_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, lda, lwork, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A[],
+                                         int                 lda,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_potrf_batched_template(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, A, lda, devInfo, batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A[],
+                                         int                 lda,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_potrf_batched_template(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, A, lda, devInfo, batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipFloatComplex*    A[],
+                                         int                 lda,
+                                         hipFloatComplex*    work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_potrf_batched_template((hipsolver_host_handle*)handle,
+                                                                hip2lapack_fill(uplo),
+                                                                n,
+                                                                (std::complex<float>**)A,
+                                                                lda,
+                                                                devInfo,
+                                                                batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipDoubleComplex*   A[],
+                                         int                 lda,
+                                         hipDoubleComplex*   work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_potrf_batched_template((hipsolver_host_handle*)handle,
+                                                                hip2lapack_fill(uplo),
+                                                                n,
+                                                                (std::complex<double>**)A,
+                                                                lda,
+                                                                devInfo,
+                                                                batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_COMPACT ********************/
+hipsolverStatus_t hipsolverSpotrfCompact(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              Ac,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_potrf_compact_template(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, Ac, devInfo, batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfCompact(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             Ac,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_potrf_compact_template(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, Ac, devInfo, batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfCompact(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipFloatComplex*    Ac,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_potrf_compact_template((hipsolver_host_handle*)handle,
+                                                                hip2lapack_fill(uplo),
+                                                                n,
+                                                                (std::complex<float>*)Ac,
+                                                                devInfo,
+                                                                batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfCompact(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipDoubleComplex*   Ac,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_potrf_compact_template((hipsolver_host_handle*)handle,
+                                                                hip2lapack_fill(uplo),
+                                                                n,
+                                                                (std::complex<double>*)Ac,
+                                                                devInfo,
+                                                                batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_OUT_OF_CORE ********************/
+hipsolverStatus_t hipsolverSpotrfOutOfCore(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           float*              A,
+                                           int                 lda,
+                                           size_t              deviceBudget,
+                                           int*                info)
+try
+{
+    return hipsolver_potrf_ooc_template(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, A, lda, info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfOutOfCore(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           double*             A,
+                                           int                 lda,
+                                           size_t              deviceBudget,
+                                           int*                info)
+try
+{
+    return hipsolver_potrf_ooc_template(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, A, lda, info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfOutOfCore(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           hipFloatComplex*    A,
+                                           int                 lda,
+                                           size_t              deviceBudget,
+                                           int*                info)
+try
+{
+    return hipsolver_potrf_ooc_template((hipsolver_host_handle*)handle,
+                                        hip2lapack_fill(uplo),
+                                        n,
+                                        (std::complex<float>*)A,
+                                        lda,
+                                        info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfOutOfCore(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           hipDoubleComplex*   A,
+                                           int                 lda,
+                                           size_t              deviceBudget,
+                                           int*                info)
+try
+{
+    return hipsolver_potrf_ooc_template((hipsolver_host_handle*)handle,
+                                        hip2lapack_fill(uplo),
+                                        n,
+                                        (std::complex<double>*)A,
+                                        lda,
+                                        info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRS_OUT_OF_CORE ********************/
+hipsolverStatus_t hipsolverSpotrsOutOfCore(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           int                 nrhs,
+                                           const float*        A,
+                                           int                 lda,
+                                           float*              B,
+                                           int                 ldb,
+                                           size_t              deviceBudget,
+                                           int*                info)
+try
+{
+    return hipsolver_potrs_ooc_template(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, nrhs, A, lda, B, ldb, info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrsOutOfCore(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           int                 nrhs,
+                                           const double*       A,
+                                           int                 lda,
+                                           double*             B,
+                                           int                 ldb,
+                                           size_t              deviceBudget,
+                                           int*                info)
+try
+{
+    return hipsolver_potrs_ooc_template(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, nrhs, A, lda, B, ldb, info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrsOutOfCore(hipsolverHandle_t      handle,
+                                           hipsolverFillMode_t    uplo,
+                                           int                    n,
+                                           int                    nrhs,
+                                           const hipFloatComplex* A,
+                                           int                    lda,
+                                           hipFloatComplex*       B,
+                                           int                    ldb,
+                                           size_t                 deviceBudget,
+                                           int*                   info)
+try
+{
+    return hipsolver_potrs_ooc_template((hipsolver_host_handle*)handle,
+                                        hip2lapack_fill(uplo),
+                                        n,
+                                        nrhs,
+                                        (const std::complex<float>*)A,
+                                        lda,
+                                        (std::complex<float>*)B,
+                                        ldb,
+                                        info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrsOutOfCore(hipsolverHandle_t       handle,
+                                           hipsolverFillMode_t     uplo,
+                                           int                     n,
+                                           int                     nrhs,
+                                           const hipDoubleComplex* A,
+                                           int                     lda,
+                                           hipDoubleComplex*       B,
+                                           int                     ldb,
+                                           size_t                  deviceBudget,
+                                           int*                    info)
+try
+{
+    return hipsolver_potrs_ooc_template((hipsolver_host_handle*)handle,
+                                        hip2lapack_fill(uplo),
+                                        n,
+                                        nrhs,
+                                        (const std::complex<double>*)A,
+                                        lda,
+                                        (std::complex<double>*)B,
+                                        ldb,
+                                        info);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** SYEVD/HEEVD ********************/
+hipsolverStatus_t hipsolverSsyevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              D,
+                                             int*                lwork)
+try
+{
+    return hipsolver_syevd_bufferSize_template<float>((hipsolver_host_handle*)handle,
+                                                      hip2lapack_evect(jobz),
+                                                      hip2lapack_fill(uplo),
+                                                      n,
+                                                      lda,
+                                                      lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsyevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             D,
+                                             int*                lwork)
+try
+{
+    return hipsolver_syevd_bufferSize_template<double>((hipsolver_host_handle*)handle,
+                                                       hip2lapack_evect(jobz),
+                                                       hip2lapack_fill(uplo),
+                                                       n,
+                                                       lda,
+                                                       lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCheevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             float*              D,
+                                             int*                lwork)
+try
+{
+    return hipsolver_syevd_bufferSize_template<std::complex<float>>((hipsolver_host_handle*)handle,
+                                                                    hip2lapack_evect(jobz),
+                                                                    hip2lapack_fill(uplo),
+                                                                    n,
+                                                                    lda,
+                                                                    lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZheevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             double*             D,
+                                             int*                lwork)
+try
+{
+    return hipsolver_syevd_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle,
+        hip2lapack_evect(jobz),
+        hip2lapack_fill(uplo),
+        n,
+        lda,
+        lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsyevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              D,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_syevd_template((hipsolver_host_handle*)handle,
+                                                        hip2lapack_evect(jobz),
+                                                        hip2lapack_fill(uplo),
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        D,
+                                                        work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsyevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             D,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_syevd_template((hipsolver_host_handle*)handle,
+                                                        hip2lapack_evect(jobz),
+                                                        hip2lapack_fill(uplo),
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        D,
+                                                        work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCheevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  float*              D,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_syevd_template((hipsolver_host_handle*)handle,
+                                                        hip2lapack_evect(jobz),
+                                                        hip2lapack_fill(uplo),
+                                                        n,
+                                                        (std::complex<float>*)A,
+                                                        lda,
+                                                        D,
+                                                        (std::complex<float>*)work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZheevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  double*             D,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_syevd_template((hipsolver_host_handle*)handle,
+                                                        hip2lapack_evect(jobz),
+                                                        hip2lapack_fill(uplo),
+                                                        n,
+                                                        (std::complex<double>*)A,
+                                                        lda,
+                                                        D,
+                                                        (std::complex<double>*)work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** SYGVD/HEGVD ********************/
+hipsolverStatus_t hipsolverSsygvd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigType_t  itype,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              B,
+                                             int                 ldb,
+                                             float*              D,
+                                             int*                lwork)
+try
+{
+    return hipsolver_sygvd_bufferSize_template<float>((hipsolver_host_handle*)handle,
+                                                      hip2lapack_eform(itype),
+                                                      hip2lapack_evect(jobz),
+                                                      hip2lapack_fill(uplo),
+                                                      n,
+                                                      lda,
+                                                      ldb,
+                                                      lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsygvd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigType_t  itype,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             B,
+                                             int                 ldb,
+                                             double*             D,
+                                             int*                lwork)
+try
+{
+    return hipsolver_sygvd_bufferSize_template<double>((hipsolver_host_handle*)handle,
+                                                       hip2lapack_eform(itype),
+                                                       hip2lapack_evect(jobz),
+                                                       hip2lapack_fill(uplo),
+                                                       n,
+                                                       lda,
+                                                       ldb,
+                                                       lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverChegvd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigType_t  itype,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
+                                             float*              D,
+                                             int*                lwork)
+try
+{
+    return hipsolver_sygvd_bufferSize_template<std::complex<float>>((hipsolver_host_handle*)handle,
+                                                                    hip2lapack_eform(itype),
+                                                                    hip2lapack_evect(jobz),
+                                                                    hip2lapack_fill(uplo),
+                                                                    n,
+                                                                    lda,
+                                                                    ldb,
+                                                                    lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZhegvd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigType_t  itype,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
+                                             double*             D,
+                                             int*                lwork)
+try
+{
+    return hipsolver_sygvd_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle,
+        hip2lapack_eform(itype),
+        hip2lapack_evect(jobz),
+        hip2lapack_fill(uplo),
+        n,
+        lda,
+        ldb,
+        lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsygvd(hipsolverHandle_t   handle,
+                                  hipsolverEigType_t  itype,
+                                  hipsolverEigMode_t  jobz,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              B,
+                                  int                 ldb,
+                                  float*              D,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_sygvd_template((hipsolver_host_handle*)handle,
+                                                        hip2lapack_eform(itype),
+                                                        hip2lapack_evect(jobz),
+                                                        hip2lapack_fill(uplo),
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        B,
+                                                        ldb,
+                                                        D,
+                                                        work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsygvd(hipsolverHandle_t   handle,
+                                  hipsolverEigType_t  itype,
+                                  hipsolverEigMode_t  jobz,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             B,
+                                  int                 ldb,
+                                  double*             D,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_sygvd_template((hipsolver_host_handle*)handle,
+                                                        hip2lapack_eform(itype),
+                                                        hip2lapack_evect(jobz),
+                                                        hip2lapack_fill(uplo),
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        B,
+                                                        ldb,
+                                                        D,
+                                                        work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverChegvd(hipsolverHandle_t   handle,
+                                  hipsolverEigType_t  itype,
+                                  hipsolverEigMode_t  jobz,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    B,
+                                  int                 ldb,
+                                  float*              D,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_sygvd_template((hipsolver_host_handle*)handle,
+                                                        hip2lapack_eform(itype),
+                                                        hip2lapack_evect(jobz),
+                                                        hip2lapack_fill(uplo),
+                                                        n,
+                                                        (std::complex<float>*)A,
+                                                        lda,
+                                                        (std::complex<float>*)B,
+                                                        ldb,
+                                                        D,
+                                                        (std::complex<float>*)work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZhegvd(hipsolverHandle_t   handle,
+                                  hipsolverEigType_t  itype,
+                                  hipsolverEigMode_t  jobz,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   B,
+                                  int                 ldb,
+                                  double*             D,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_sygvd_template((hipsolver_host_handle*)handle,
+                                                        hip2lapack_eform(itype),
+                                                        hip2lapack_evect(jobz),
+                                                        hip2lapack_fill(uplo),
+                                                        n,
+                                                        (std::complex<double>*)A,
+                                                        lda,
+                                                        (std::complex<double>*)B,
+                                                        ldb,
+                                                        D,
+                                                        (std::complex<double>*)work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** SYGVD_PIPELINED/HEGVD_PIPELINED ********************/
+hipsolverStatus_t hipsolverSsygvdPipelined_bufferSize(hipsolverHandle_t   handle,
+                                                      hipsolverEigType_t  itype,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      float*              A,
+                                                      int                 lda,
+                                                      float*              B,
+                                                      int                 ldb,
+                                                      float*              D,
+                                                      int*                lwork,
+                                                      int                 batch_count)
+try
+{
+    return hipsolver_sygvd_bufferSize_template<float>((hipsolver_host_handle*)handle,
+                                                      hip2lapack_eform(itype),
+                                                      hip2lapack_evect(jobz),
+                                                      hip2lapack_fill(uplo),
+                                                      n,
+                                                      lda,
+                                                      ldb,
+                                                      lwork,
+                                                      batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsygvdPipelined_bufferSize(hipsolverHandle_t   handle,
+                                                      hipsolverEigType_t  itype,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      double*             A,
+                                                      int                 lda,
+                                                      double*             B,
+                                                      int                 ldb,
+                                                      double*             D,
+                                                      int*                lwork,
+                                                      int                 batch_count)
+try
+{
+    return hipsolver_sygvd_bufferSize_template<double>((hipsolver_host_handle*)handle,
+                                                       hip2lapack_eform(itype),
+                                                       hip2lapack_evect(jobz),
+                                                       hip2lapack_fill(uplo),
+                                                       n,
+                                                       lda,
+                                                       ldb,
+                                                       lwork,
+                                                       batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverChegvdPipelined_bufferSize(hipsolverHandle_t   handle,
+                                                      hipsolverEigType_t  itype,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipFloatComplex*    A,
+                                                      int                 lda,
+                                                      hipFloatComplex*    B,
+                                                      int                 ldb,
+                                                      float*              D,
+                                                      int*                lwork,
+                                                      int                 batch_count)
+try
+{
+    return hipsolver_sygvd_bufferSize_template<std::complex<float>>((hipsolver_host_handle*)handle,
+                                                                    hip2lapack_eform(itype),
+                                                                    hip2lapack_evect(jobz),
+                                                                    hip2lapack_fill(uplo),
+                                                                    n,
+                                                                    lda,
+                                                                    ldb,
+                                                                    lwork,
+                                                                    batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZhegvdPipelined_bufferSize(hipsolverHandle_t   handle,
+                                                      hipsolverEigType_t  itype,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipDoubleComplex*   A,
+                                                      int                 lda,
+                                                      hipDoubleComplex*   B,
+                                                      int                 ldb,
+                                                      double*             D,
+                                                      int*                lwork,
+                                                      int                 batch_count)
+try
+{
+    return hipsolver_sygvd_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle,
+        hip2lapack_eform(itype),
+        hip2lapack_evect(jobz),
+        hip2lapack_fill(uplo),
+        n,
+        lda,
+        ldb,
+        lwork,
+        batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsygvdPipelined(hipsolverHandle_t   handle,
+                                           hipsolverEigType_t  itype,
+                                           hipsolverEigMode_t  jobz,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           float*              A,
+                                           int                 lda,
+                                           float*              B,
+                                           int                 ldb,
+                                           float*              D,
+                                           float*              work,
+                                           int                 lwork,
+                                           int*                devInfo,
+                                           int                 batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_sygvd_pipelined_template((hipsolver_host_handle*)handle,
+                                                                  hip2lapack_eform(itype),
+                                                                  hip2lapack_evect(jobz),
+                                                                  hip2lapack_fill(uplo),
+                                                                  n,
+                                                                  A,
+                                                                  lda,
+                                                                  B,
+                                                                  ldb,
+                                                                  D,
+                                                                  devInfo,
+                                                                  batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsygvdPipelined(hipsolverHandle_t   handle,
+                                           hipsolverEigType_t  itype,
+                                           hipsolverEigMode_t  jobz,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           double*             A,
+                                           int                 lda,
+                                           double*             B,
+                                           int                 ldb,
+                                           double*             D,
+                                           double*             work,
+                                           int                 lwork,
+                                           int*                devInfo,
+                                           int                 batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_sygvd_pipelined_template((hipsolver_host_handle*)handle,
+                                                                  hip2lapack_eform(itype),
+                                                                  hip2lapack_evect(jobz),
+                                                                  hip2lapack_fill(uplo),
+                                                                  n,
+                                                                  A,
+                                                                  lda,
+                                                                  B,
+                                                                  ldb,
+                                                                  D,
+                                                                  devInfo,
+                                                                  batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverChegvdPipelined(hipsolverHandle_t   handle,
+                                           hipsolverEigType_t  itype,
+                                           hipsolverEigMode_t  jobz,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           hipFloatComplex*    A,
+                                           int                 lda,
+                                           hipFloatComplex*    B,
+                                           int                 ldb,
+                                           float*              D,
+                                           hipFloatComplex*    work,
+                                           int                 lwork,
+                                           int*                devInfo,
+                                           int                 batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_sygvd_pipelined_template((hipsolver_host_handle*)handle,
+                                                                  hip2lapack_eform(itype),
+                                                                  hip2lapack_evect(jobz),
+                                                                  hip2lapack_fill(uplo),
+                                                                  n,
+                                                                  (std::complex<float>*)A,
+                                                                  lda,
+                                                                  (std::complex<float>*)B,
+                                                                  ldb,
+                                                                  D,
+                                                                  devInfo,
+                                                                  batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZhegvdPipelined(hipsolverHandle_t   handle,
+                                           hipsolverEigType_t  itype,
+                                           hipsolverEigMode_t  jobz,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           hipDoubleComplex*   A,
+                                           int                 lda,
+                                           hipDoubleComplex*   B,
+                                           int                 ldb,
+                                           double*             D,
+                                           hipDoubleComplex*   work,
+                                           int                 lwork,
+                                           int*                devInfo,
+                                           int                 batch_count)
+try
+{
+    hipsolverStatus_t status = hipsolver_sygvd_pipelined_template((hipsolver_host_handle*)handle,
+                                                                  hip2lapack_eform(itype),
+                                                                  hip2lapack_evect(jobz),
+                                                                  hip2lapack_fill(uplo),
+                                                                  n,
+                                                                  (std::complex<double>*)A,
+                                                                  lda,
+                                                                  (std::complex<double>*)B,
+                                                                  ldb,
+                                                                  D,
+                                                                  devInfo,
+                                                                  batch_count);
+    return hipsolverDeferInfo(handle, status, devInfo, batch_count);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** SYTRD/HETRD ********************/
+hipsolverStatus_t hipsolverSsytrd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              D,
+                                             float*              E,
+                                             float*              tau,
+                                             int*                lwork)
+try
+{
+    return hipsolver_sytrd_bufferSize_template<float>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsytrd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             D,
+                                             double*             E,
+                                             double*             tau,
+                                             int*                lwork)
+try
+{
+    return hipsolver_sytrd_bufferSize_template<double>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverChetrd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             float*              D,
+                                             float*              E,
+                                             hipFloatComplex*    tau,
+                                             int*                lwork)
+try
+{
+    return hipsolver_sytrd_bufferSize_template<std::complex<float>>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZhetrd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             double*             D,
+                                             double*             E,
+                                             hipDoubleComplex*   tau,
+                                             int*                lwork)
+try
+{
+    return hipsolver_sytrd_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsytrd(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              D,
+                                  float*              E,
+                                  float*              tau,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return hipsolver_sytrd_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_fill(uplo),
+                                    n,
+                                    A,
+                                    lda,
+                                    D,
+                                    E,
+                                    tau,
+                                    work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsytrd(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             D,
+                                  double*             E,
+                                  double*             tau,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return hipsolver_sytrd_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_fill(uplo),
+                                    n,
+                                    A,
+                                    lda,
+                                    D,
+                                    E,
+                                    tau,
+                                    work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverChetrd(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  float*              D,
+                                  float*              E,
+                                  hipFloatComplex*    tau,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return hipsolver_sytrd_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_fill(uplo),
+                                    n,
+                                    (std::complex<float>*)A,
+                                    lda,
+                                    D,
+                                    E,
+                                    (std::complex<float>*)tau,
+                                    (std::complex<float>*)work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZhetrd(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  double*             D,
+                                  double*             E,
+                                  hipDoubleComplex*   tau,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return hipsolver_sytrd_template((hipsolver_host_handle*)handle,
+                                    hip2lapack_fill(uplo),
+                                    n,
+                                    (std::complex<double>*)A,
+                                    lda,
+                                    D,
+                                    E,
+                                    (std::complex<double>*)tau,
+                                    (std::complex<double>*)work,
+                                    lwork,
+                                    devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** SYTRF ********************/
+hipsolverStatus_t hipsolverSsytrf_bufferSize(
+    hipsolverHandle_t handle, int n, float* A, int lda, int* lwork)
+try
+{
+    return hipsolver_sytrf_bufferSize_template<float>((hipsolver_host_handle*)handle,
+                                                      n,
+                                                      lda,
+                                                      lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsytrf_bufferSize(
+    hipsolverHandle_t handle, int n, double* A, int lda, int* lwork)
+try
+{
+    return hipsolver_sytrf_bufferSize_template<double>((hipsolver_host_handle*)handle,
+                                                       n,
+                                                       lda,
+                                                       lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCsytrf_bufferSize(
+    hipsolverHandle_t handle, int n, hipFloatComplex* A, int lda, int* lwork)
+try
+{
+    return hipsolver_sytrf_bufferSize_template<std::complex<float>>((hipsolver_host_handle*)handle,
+                                                                    n,
+                                                                    lda,
+                                                                    lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZsytrf_bufferSize(
+    hipsolverHandle_t handle, int n, hipDoubleComplex* A, int lda, int* lwork)
+try
+{
+    return hipsolver_sytrf_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, n, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsytrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_sytrf_template((hipsolver_host_handle*)handle,
+                                                        hip2lapack_fill(uplo),
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        devIpiv,
+                                                        work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsytrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_sytrf_template((hipsolver_host_handle*)handle,
+                                                        hip2lapack_fill(uplo),
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        devIpiv,
+                                                        work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCsytrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_sytrf_template((hipsolver_host_handle*)handle,
+                                                        hip2lapack_fill(uplo),
+                                                        n,
+                                                        (std::complex<float>*)A,
+                                                        lda,
+                                                        devIpiv,
+                                                        (std::complex<float>*)work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZsytrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_sytrf_template((hipsolver_host_handle*)handle,
+                                                        hip2lapack_fill(uplo),
+                                                        n,
+                                                        (std::complex<double>*)A,
+                                                        lda,
+                                                        devIpiv,
+                                                        (std::complex<double>*)work,
+                                                        lwork,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** SYTRS ********************/
+hipsolverStatus_t hipsolverSsytrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             float*              A,
+                                             int                 lda,
+                                             int*                devIpiv,
+                                             float*              B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    return hipsolver_sytrs_bufferSize_template<float>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, nrhs, lda, ldb, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsytrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             double*             A,
+                                             int                 lda,
+                                             int*                devIpiv,
+                                             double*             B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    return hipsolver_sytrs_bufferSize_template<double>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, nrhs, lda, ldb, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCsytrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             int*                devIpiv,
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    return hipsolver_sytrs_bufferSize_template<std::complex<float>>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, nrhs, lda, ldb, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZsytrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             int*                devIpiv,
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    return hipsolver_sytrs_bufferSize_template<std::complex<double>>(
+        (hipsolver_host_handle*)handle, hip2lapack_fill(uplo), n, nrhs, lda, ldb, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsytrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  float*              A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  float*              B,
+                                  int                 ldb,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_sytrs_template((hipsolver_host_handle*)handle,
+                                                        hip2lapack_fill(uplo),
+                                                        n,
+                                                        nrhs,
+                                                        A,
+                                                        lda,
+                                                        devIpiv,
+                                                        B,
+                                                        ldb,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsytrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  double*             A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  double*             B,
+                                  int                 ldb,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_sytrs_template((hipsolver_host_handle*)handle,
+                                                        hip2lapack_fill(uplo),
+                                                        n,
+                                                        nrhs,
+                                                        A,
+                                                        lda,
+                                                        devIpiv,
+                                                        B,
+                                                        ldb,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCsytrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  hipFloatComplex*    B,
+                                  int                 ldb,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_sytrs_template((hipsolver_host_handle*)handle,
+                                                        hip2lapack_fill(uplo),
+                                                        n,
+                                                        nrhs,
+                                                        (std::complex<float>*)A,
+                                                        lda,
+                                                        devIpiv,
+                                                        (std::complex<float>*)B,
+                                                        ldb,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZsytrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  hipDoubleComplex*   B,
+                                  int                 ldb,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    hipsolverStatus_t status = hipsolver_sytrs_template((hipsolver_host_handle*)handle,
+                                                        hip2lapack_fill(uplo),
+                                                        n,
+                                                        nrhs,
+                                                        (std::complex<double>*)A,
+                                                        lda,
+                                                        devIpiv,
+                                                        (std::complex<double>*)B,
+                                                        ldb,
+                                                        devInfo);
+    return hipsolverDeferInfo(handle, status, devInfo, 1);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+} // extern C
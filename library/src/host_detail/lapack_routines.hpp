@@ -0,0 +1,1486 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "host_kernels.hpp"
+#include "lapack_templates.hpp"
+#include "parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    The functions of the host backend that map to a single LAPACK routine.
+ *    The arguments are checked as rocSOLVER checks them, so that both
+ *    backends return the same status, and so that LAPACK never reaches
+ *    xerbla: sizes first, then pointers, then a quick return when there is
+ *    nothing to compute. Workspace sizes are in elements of the matrix type,
+ *    as returned by the LAPACK workspace queries; a null work argument is
+ *    replaced by memory allocated for the call, and a smaller lwork than
+ *    the one returned by the bufferSize function is an invalid value. The
+ *    batched functions solve their problems on the threads of the backend,
+ *    each with memory of its own, so they do not use their work argument.
+ * ===========================================================================
+ */
+
+template <typename T>
+struct hipsolver_is_complex : std::false_type
+{
+};
+
+template <typename T>
+struct hipsolver_is_complex<std::complex<T>> : std::true_type
+{
+};
+
+// std::conj of a real number is complex
+template <typename T>
+inline T hipsolver_conj(T x)
+{
+    return x;
+}
+
+template <typename T>
+inline std::complex<T> hipsolver_conj(std::complex<T> x)
+{
+    return std::conj(x);
+}
+
+// the workspace size returned by a LAPACK workspace query
+template <typename T>
+inline int hipsolver_lapack_size(T query)
+{
+    using S = decltype(std::real(query));
+
+    // large sizes are rounded when stored in single precision
+    S size = std::nextafter(std::real(query), std::numeric_limits<S>::max());
+    return std::max(1, int(size));
+}
+
+// work, which must hold size elements, or memory owned by the object when work is null
+template <typename T>
+class hipsolver_host_workspace
+{
+public:
+    hipsolver_host_workspace(T* work, int lwork, int size)
+    {
+        if(work)
+        {
+            // lwork is below the size returned by the bufferSize function
+            if(lwork < size)
+                throw HIPSOLVER_STATUS_INVALID_VALUE;
+            data_ = work;
+            size_ = lwork;
+        }
+        else
+        {
+            owned_.resize(size);
+            data_ = owned_.data();
+            size_ = size;
+        }
+    }
+
+    T* data() const
+    {
+        return data_;
+    }
+    int size() const
+    {
+        return size_;
+    }
+
+private:
+    std::vector<T> owned_;
+    T*             data_ = nullptr;
+    int            size_ = 0;
+};
+
+// the arguments were checked before LAPACK was called
+inline hipsolverStatus_t hipsolver_lapack_status(int info)
+{
+    return info < 0 ? HIPSOLVER_STATUS_INTERNAL_ERROR : HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** ORGBR/UNGBR ********************/
+inline hipsolverStatus_t hipsolver_orgbr_argCheck(char vect, int m, int n, int k, int lda)
+{
+    if(m < 0 || n < 0 || k < 0 || lda < m)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(vect == 'Q' && (n > m || n < std::min(m, k)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(vect == 'P' && (m > n || m < std::min(n, k)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+int hipsolver_orgbr_worksize(char vect, int m, int n, int k, int lda)
+{
+    T   query, dummy;
+    int info;
+    lapackCall_orgbr(vect, m, n, k, &dummy, lda, &dummy, &query, -1, &info);
+    return hipsolver_lapack_size(query);
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_orgbr_bufferSize_template(
+    hipsolver_host_handle* handle, char vect, int m, int n, int k, int lda, int* lwork)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_orgbr_argCheck(vect, m, n, k, lda));
+
+    if(m > 0 && n > 0)
+        *lwork = hipsolver_orgbr_worksize<T>(vect, m, n, k, lda);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_orgbr_template(hipsolver_host_handle* handle,
+                                           char                   vect,
+                                           int                    m,
+                                           int                    n,
+                                           int                    k,
+                                           T*                     A,
+                                           int                    lda,
+                                           T*                     tau,
+                                           T*                     work,
+                                           int                    lwork,
+                                           int*                   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_orgbr_argCheck(vect, m, n, k, lda));
+    if((m && n && !A) || (k && !tau) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    *info = 0;
+    if(m == 0 || n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolver_host_workspace<T> w(work, lwork, hipsolver_orgbr_worksize<T>(vect, m, n, k, lda));
+    lapackCall_orgbr(vect, m, n, k, A, lda, tau, w.data(), w.size(), info);
+    return hipsolver_lapack_status(*info);
+}
+
+/******************** ORGQR/UNGQR ********************/
+inline hipsolverStatus_t hipsolver_orgqr_argCheck(int m, int n, int k, int lda)
+{
+    if(m < 0 || n < 0 || k < 0 || n > m || k > n || lda < m)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+int hipsolver_orgqr_worksize(int m, int n, int k, int lda)
+{
+    T   query, dummy;
+    int info;
+    lapackCall_orgqr(m, n, k, &dummy, lda, &dummy, &query, -1, &info);
+    return hipsolver_lapack_size(query);
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_orgqr_bufferSize_template(
+    hipsolver_host_handle* handle, int m, int n, int k, int lda, int* lwork)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_orgqr_argCheck(m, n, k, lda));
+
+    if(n > 0)
+        *lwork = hipsolver_orgqr_worksize<T>(m, n, k, lda);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_orgqr_template(hipsolver_host_handle* handle,
+                                           int                    m,
+                                           int                    n,
+                                           int                    k,
+                                           T*                     A,
+                                           int                    lda,
+                                           T*                     tau,
+                                           T*                     work,
+                                           int                    lwork,
+                                           int*                   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_orgqr_argCheck(m, n, k, lda));
+    if((m && n && !A) || (k && !tau) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    *info = 0;
+    if(n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolver_host_workspace<T> w(work, lwork, hipsolver_orgqr_worksize<T>(m, n, k, lda));
+    lapackCall_orgqr(m, n, k, A, lda, tau, w.data(), w.size(), info);
+    return hipsolver_lapack_status(*info);
+}
+
+/******************** ORGTR/UNGTR ********************/
+inline hipsolverStatus_t hipsolver_orgtr_argCheck(int n, int lda)
+{
+    if(n < 0 || lda < n)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+int hipsolver_orgtr_worksize(char uplo, int n, int lda)
+{
+    T   query, dummy;
+    int info;
+    lapackCall_orgtr(uplo, n, &dummy, lda, &dummy, &query, -1, &info);
+    return hipsolver_lapack_size(query);
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_orgtr_bufferSize_template(
+    hipsolver_host_handle* handle, char uplo, int n, int lda, int* lwork)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_orgtr_argCheck(n, lda));
+
+    if(n > 0)
+        *lwork = hipsolver_orgtr_worksize<T>(uplo, n, lda);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_orgtr_template(hipsolver_host_handle* handle,
+                                           char                   uplo,
+                                           int                    n,
+                                           T*                     A,
+                                           int                    lda,
+                                           T*                     tau,
+                                           T*                     work,
+                                           int                    lwork,
+                                           int*                   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_orgtr_argCheck(n, lda));
+    if((n && (!A || !tau)) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    *info = 0;
+    if(n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolver_host_workspace<T> w(work, lwork, hipsolver_orgtr_worksize<T>(uplo, n, lda));
+    lapackCall_orgtr(uplo, n, A, lda, tau, w.data(), w.size(), info);
+    return hipsolver_lapack_status(*info);
+}
+
+/******************** ORMQR/UNMQR ********************/
+// real matrices are not conjugated, and complex ones are not only transposed
+template <typename T>
+hipsolverStatus_t hipsolver_trans_argCheck(char trans)
+{
+    if(trans == (hipsolver_is_complex<T>::value ? 'T' : 'C'))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+inline hipsolverStatus_t
+    hipsolver_ormqr_argCheck(char side, int m, int n, int k, int lda, int ldc)
+{
+    int nq = side == 'L' ? m : n;
+    if(m < 0 || n < 0 || k < 0 || ldc < m || k > nq || lda < nq)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+int hipsolver_ormqr_worksize(char side, char trans, int m, int n, int k, int lda, int ldc)
+{
+    T   query, dummy;
+    int info;
+    lapackCall_ormqr(side, trans, m, n, k, &dummy, lda, &dummy, &dummy, ldc, &query, -1, &info);
+    return hipsolver_lapack_size(query);
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_ormqr_bufferSize_template(hipsolver_host_handle* handle,
+                                                      char                   side,
+                                                      char                   trans,
+                                                      int                    m,
+                                                      int                    n,
+                                                      int                    k,
+                                                      int                    lda,
+                                                      int                    ldc,
+                                                      int*                   lwork)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_trans_argCheck<T>(trans));
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_ormqr_argCheck(side, m, n, k, lda, ldc));
+
+    if(m > 0 && n > 0 && k > 0)
+        *lwork = hipsolver_ormqr_worksize<T>(side, trans, m, n, k, lda, ldc);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_ormqr_template(hipsolver_host_handle* handle,
+                                           char                   side,
+                                           char                   trans,
+                                           int                    m,
+                                           int                    n,
+                                           int                    k,
+                                           T*                     A,
+                                           int                    lda,
+                                           T*                     tau,
+                                           T*                     C,
+                                           int                    ldc,
+                                           T*                     work,
+                                           int                    lwork,
+                                           int*                   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_trans_argCheck<T>(trans));
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_ormqr_argCheck(side, m, n, k, lda, ldc));
+    if((k && !A) || (k && !tau) || (m && n && !C) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    *info = 0;
+    if(m == 0 || n == 0 || k == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolver_host_workspace<T> w(
+        work, lwork, hipsolver_ormqr_worksize<T>(side, trans, m, n, k, lda, ldc));
+    lapackCall_ormqr(side, trans, m, n, k, A, lda, tau, C, ldc, w.data(), w.size(), info);
+    return hipsolver_lapack_status(*info);
+}
+
+/******************** ORMTR/UNMTR ********************/
+inline hipsolverStatus_t hipsolver_ormtr_argCheck(char side, int m, int n, int lda, int ldc)
+{
+    int nq = side == 'L' ? m : n;
+    if(m < 0 || n < 0 || ldc < m || lda < nq)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+int hipsolver_ormtr_worksize(char side, char uplo, char trans, int m, int n, int lda, int ldc)
+{
+    T   query, dummy;
+    int info;
+    lapackCall_ormtr(side, uplo, trans, m, n, &dummy, lda, &dummy, &dummy, ldc, &query, -1, &info);
+    return hipsolver_lapack_size(query);
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_ormtr_bufferSize_template(hipsolver_host_handle* handle,
+                                                      char                   side,
+                                                      char                   uplo,
+                                                      char                   trans,
+                                                      int                    m,
+                                                      int                    n,
+                                                      int                    lda,
+                                                      int                    ldc,
+                                                      int*                   lwork)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_trans_argCheck<T>(trans));
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_ormtr_argCheck(side, m, n, lda, ldc));
+
+    if(m > 0 && n > 0)
+        *lwork = hipsolver_ormtr_worksize<T>(side, uplo, trans, m, n, lda, ldc);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_ormtr_template(hipsolver_host_handle* handle,
+                                           char                   side,
+                                           char                   uplo,
+                                           char                   trans,
+                                           int                    m,
+                                           int                    n,
+                                           T*                     A,
+                                           int                    lda,
+                                           T*                     tau,
+                                           T*                     C,
+                                           int                    ldc,
+                                           T*                     work,
+                                           int                    lwork,
+                                           int*                   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_trans_argCheck<T>(trans));
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_ormtr_argCheck(side, m, n, lda, ldc));
+
+    int nq = side == 'L' ? m : n;
+    if((nq && (!A || !tau)) || (m && n && !C) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    *info = 0;
+    if(m == 0 || n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolver_host_workspace<T> w(
+        work, lwork, hipsolver_ormtr_worksize<T>(side, uplo, trans, m, n, lda, ldc));
+    lapackCall_ormtr(side, uplo, trans, m, n, A, lda, tau, C, ldc, w.data(), w.size(), info);
+    return hipsolver_lapack_status(*info);
+}
+
+/******************** GEBRD ********************/
+inline hipsolverStatus_t hipsolver_gebrd_argCheck(int m, int n, int lda)
+{
+    if(m < 0 || n < 0 || lda < m)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+int hipsolver_gebrd_worksize(int m, int n, int lda)
+{
+    using S = decltype(std::real(T{}));
+
+    T   query, dummy;
+    S   rdummy;
+    int info;
+    lapackCall_gebrd(m, n, &dummy, lda, &rdummy, &rdummy, &dummy, &dummy, &query, -1, &info);
+    return hipsolver_lapack_size(query);
+}
+
+template <typename T>
+hipsolverStatus_t
+    hipsolver_gebrd_bufferSize_template(hipsolver_host_handle* handle, int m, int n, int* lwork)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_gebrd_argCheck(m, n, m));
+
+    if(m > 0 && n > 0)
+        *lwork = hipsolver_gebrd_worksize<T>(m, n, m);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T, typename S>
+hipsolverStatus_t hipsolver_gebrd_template(hipsolver_host_handle* handle,
+                                           int                    m,
+                                           int                    n,
+                                           T*                     A,
+                                           int                    lda,
+                                           S*                     D,
+                                           S*                     E,
+                                           T*                     tauq,
+                                           T*                     taup,
+                                           T*                     work,
+                                           int                    lwork,
+                                           int*                   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_gebrd_argCheck(m, n, lda));
+    if((m && n && (!A || !D || !E || !tauq || !taup)) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    *info = 0;
+    if(m == 0 || n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolver_host_workspace<T> w(work, lwork, hipsolver_gebrd_worksize<T>(m, n, lda));
+    lapackCall_gebrd(m, n, A, lda, D, E, tauq, taup, w.data(), w.size(), info);
+    return hipsolver_lapack_status(*info);
+}
+
+/******************** GELS ********************/
+inline hipsolverStatus_t
+    hipsolver_gels_argCheck(int m, int n, int nrhs, int lda, int ldb, int ldx, int batch_count = 1)
+{
+    if(m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < m || ldb < n || ldx < n || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+int hipsolver_gels_worksize(int m, int n, int nrhs, int lda, int ldb)
+{
+    T   query, dummy;
+    int info;
+    lapackCall_gels('N', m, n, nrhs, &dummy, lda, &dummy, ldb, &query, -1, &info);
+    return hipsolver_lapack_size(query);
+}
+
+// the size is in bytes, as the work argument of gels is untyped
+template <typename T>
+hipsolverStatus_t hipsolver_gels_bufferSize_template(hipsolver_host_handle* handle,
+                                                     int                    m,
+                                                     int                    n,
+                                                     int                    nrhs,
+                                                     int                    lda,
+                                                     int                    ldb,
+                                                     int                    ldx,
+                                                     size_t*                lwork,
+                                                     int                    batch_count = 1)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_gels_argCheck(m, n, nrhs, lda, ldb, ldx, batch_count));
+
+    if(m > 0 && n > 0 && nrhs > 0)
+        *lwork = sizeof(T) * hipsolver_gels_worksize<T>(m, n, nrhs, lda, ldb);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// solves one problem, with the n-by-nrhs solution copied from B into X
+template <typename T>
+void hipsolver_gels_solve(int  m,
+                          int  n,
+                          int  nrhs,
+                          T*   A,
+                          int  lda,
+                          T*   B,
+                          int  ldb,
+                          T*   X,
+                          int  ldx,
+                          T*   work,
+                          int  lwork,
+                          int* info)
+{
+    *info = 0;
+    if(nrhs == 0)
+        return;
+
+    // the minimum norm solution of an empty system is zero
+    if(m == 0 || n == 0)
+    {
+        for(int j = 0; j < nrhs; j++)
+        {
+            std::fill(B + size_t(j) * ldb, B + size_t(j) * ldb + std::max(m, n), T(0));
+            std::fill(X + size_t(j) * ldx, X + size_t(j) * ldx + n, T(0));
+        }
+        return;
+    }
+
+    hipsolver_host_workspace<T> w(work, lwork, hipsolver_gels_worksize<T>(m, n, nrhs, lda, ldb));
+    lapackCall_gels('N', m, n, nrhs, A, lda, B, ldb, w.data(), w.size(), info);
+    if(*info < 0)
+        throw HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    for(int j = 0; j < nrhs; j++)
+        std::copy(B + size_t(j) * ldb, B + size_t(j) * ldb + n, X + size_t(j) * ldx);
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_gels_template(hipsolver_host_handle* handle,
+                                          int                    m,
+                                          int                    n,
+                                          int                    nrhs,
+                                          T*                     A,
+                                          int                    lda,
+                                          T*                     B,
+                                          int                    ldb,
+                                          T*                     X,
+                                          int                    ldx,
+                                          void*                  work,
+                                          size_t                 lwork,
+                                          int*                   niters,
+                                          int*                   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_gels_argCheck(m, n, nrhs, lda, ldb, ldx));
+    if((m && n && !A) || (std::max(m, n) && nrhs && !B) || (n && nrhs && !X) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    int size = int(std::min(lwork / sizeof(T), size_t(std::numeric_limits<int>::max())));
+    hipsolver_gels_solve(m, n, nrhs, A, lda, B, ldb, X, ldx, (T*)work, size, info);
+
+    // the solution is not refined
+    if(niters)
+        *niters = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_gels_batched_template(hipsolver_host_handle* handle,
+                                                  int                    m,
+                                                  int                    n,
+                                                  int                    nrhs,
+                                                  T* const               A[],
+                                                  int                    lda,
+                                                  T* const               B[],
+                                                  int                    ldb,
+                                                  T* const               X[],
+                                                  int                    ldx,
+                                                  int*                   niters,
+                                                  int*                   info,
+                                                  int                    batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_gels_argCheck(m, n, nrhs, lda, ldb, ldx, batch_count));
+    if(batch_count
+       && ((m && n && !A) || (std::max(m, n) && nrhs && !B) || (n && nrhs && !X) || !info))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    hipsolver_host_parallel_for(handle, batch_count, [&](int b) {
+        hipsolver_gels_solve(
+            m, n, nrhs, A[b], lda, B[b], ldb, X[b], ldx, (T*)nullptr, 0, info + b);
+    });
+
+    if(niters)
+        *niters = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** GEQRF ********************/
+inline hipsolverStatus_t hipsolver_geqrf_argCheck(int m, int n, int lda)
+{
+    if(m < 0 || n < 0 || lda < m)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+int hipsolver_geqrf_worksize(int m, int n, int lda)
+{
+    T   query, dummy;
+    int info;
+    lapackCall_geqrf(m, n, &dummy, lda, &dummy, &query, -1, &info);
+    return hipsolver_lapack_size(query);
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_geqrf_bufferSize_template(
+    hipsolver_host_handle* handle, int m, int n, int lda, int* lwork)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_geqrf_argCheck(m, n, lda));
+
+    if(m > 0 && n > 0)
+        *lwork = hipsolver_geqrf_worksize<T>(m, n, lda);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_geqrf_template(hipsolver_host_handle* handle,
+                                           int                    m,
+                                           int                    n,
+                                           T*                     A,
+                                           int                    lda,
+                                           T*                     tau,
+                                           T*                     work,
+                                           int                    lwork,
+                                           int*                   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_geqrf_argCheck(m, n, lda));
+    if((m && n && (!A || !tau)) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    *info = 0;
+    if(m == 0 || n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolver_host_workspace<T> w(work, lwork, hipsolver_geqrf_worksize<T>(m, n, lda));
+    lapackCall_geqrf(m, n, A, lda, tau, w.data(), w.size(), info);
+    return hipsolver_lapack_status(*info);
+}
+
+/******************** GESVD ********************/
+inline hipsolverStatus_t hipsolver_gesvd_argCheck(
+    char jobu, char jobv, int m, int n, int lda, int ldu, int ldv)
+{
+    if(jobu == 'O' && jobv == 'O')
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(m < 0 || n < 0 || lda < m || ldu < 1 || ldv < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if((jobu == 'A' || jobu == 'S') && ldu < m)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if((jobv == 'A' && ldv < n) || (jobv == 'S' && ldv < std::min(m, n)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+int hipsolver_gesvd_worksize(char jobu, char jobv, int m, int n, int lda, int ldu, int ldv)
+{
+    using S = decltype(std::real(T{}));
+
+    T   query, dummy;
+    S   rdummy;
+    int info;
+    lapackCall_gesvd(jobu,
+                     jobv,
+                     m,
+                     n,
+                     &dummy,
+                     lda,
+                     &rdummy,
+                     &dummy,
+                     ldu,
+                     &dummy,
+                     ldv,
+                     &query,
+                     -1,
+                     &rdummy,
+                     &info);
+    return hipsolver_lapack_size(query);
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_gesvd_bufferSize_template(
+    hipsolver_host_handle* handle, char jobu, char jobv, int m, int n, int* lwork)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    int lda = std::max(1, m);
+    int ldv = std::max(1, jobv == 'A' ? n : std::min(m, n));
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_gesvd_argCheck(jobu, jobv, m, n, lda, lda, ldv));
+
+    if(m > 0 && n > 0)
+        *lwork = hipsolver_gesvd_worksize<T>(jobu, jobv, m, n, lda, lda, ldv);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/* rwork receives the min(m, n) - 1 superdiagonal elements of the bidiagonal
+   form that did not converge when info > 0, as in rocSOLVER. */
+template <typename T, typename S>
+hipsolverStatus_t hipsolver_gesvd_template(hipsolver_host_handle* handle,
+                                           char                   jobu,
+                                           char                   jobv,
+                                           int                    m,
+                                           int                    n,
+                                           T*                     A,
+                                           int                    lda,
+                                           S*                     Sv,
+                                           T*                     U,
+                                           int                    ldu,
+                                           T*                     V,
+                                           int                    ldv,
+                                           T*                     work,
+                                           int                    lwork,
+                                           S*                     rwork,
+                                           int*                   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_gesvd_argCheck(jobu, jobv, m, n, lda, ldu, ldv));
+
+    int mn = std::min(m, n);
+    if((m && n && !A) || (mn && !Sv) || (mn > 1 && !rwork) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(((jobu == 'A' || jobu == 'S') && m && !U) || ((jobv == 'A' || jobv == 'S') && n && !V))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    *info = 0;
+    if(mn == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolver_host_workspace<T> w(
+        work, lwork, hipsolver_gesvd_worksize<T>(jobu, jobv, m, n, lda, ldu, ldv));
+    std::vector<S> E(5 * mn);
+    lapackCall_gesvd(
+        jobu, jobv, m, n, A, lda, Sv, U, ldu, V, ldv, w.data(), w.size(), E.data(), info);
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_lapack_status(*info));
+
+    // the real functions return the superdiagonal in work instead of rwork
+    for(int i = 0; i < mn - 1; i++)
+    {
+        S e      = hipsolver_is_complex<T>::value ? E[i] : std::real(w.data()[i + 1]);
+        rwork[i] = *info > 0 ? e : S(0);
+    }
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** GETRS ********************/
+// solves with the factors of getrf, with the native kernel on small matrices
+template <typename T>
+void hipsolver_getrs_solve(
+    char trans, int n, int nrhs, const T* A, int lda, const int* ipiv, T* B, int ldb)
+{
+    if(n <= HIPSOLVER_GETRF_KERNEL_MAX_SIZE)
+        hipsolver_kernel_getrs(trans, n, nrhs, A, lda, ipiv, B, ldb);
+    else
+    {
+        int info;
+        lapackCall_getrs(trans, n, nrhs, (T*)A, lda, (int*)ipiv, B, ldb, &info);
+        if(info < 0)
+            throw HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrs_argCheck(int n, int nrhs, int lda, int ldb)
+{
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_getrs_bufferSize_template(
+    hipsolver_host_handle* handle, char trans, int n, int nrhs, int lda, int ldb, int* lwork)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    return hipsolver_getrs_argCheck(n, nrhs, lda, ldb);
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_getrs_template(hipsolver_host_handle* handle,
+                                           char                   trans,
+                                           int                    n,
+                                           int                    nrhs,
+                                           T*                     A,
+                                           int                    lda,
+                                           int*                   ipiv,
+                                           T*                     B,
+                                           int                    ldb,
+                                           int*                   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_getrs_argCheck(n, nrhs, lda, ldb));
+    if((n && (!A || !ipiv)) || (n && nrhs && !B) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    *info = 0;
+    if(n == 0 || nrhs == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolver_getrs_solve(trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** POTRF ********************/
+inline hipsolverStatus_t hipsolver_potrf_argCheck(int n, int lda, int batch_count = 1)
+{
+    if(n < 0 || lda < n || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_potrf_bufferSize_template(
+    hipsolver_host_handle* handle, char uplo, int n, int lda, int* lwork, int batch_count = 1)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    return hipsolver_potrf_argCheck(n, lda, batch_count);
+}
+
+// factorizes one problem
+template <typename T>
+void hipsolver_potrf_factor(char uplo, int n, T* A, int lda, int* info)
+{
+    *info = 0;
+    if(n == 0)
+        return;
+
+    lapackCall_potrf(uplo, n, A, lda, info);
+    if(*info < 0)
+        throw HIPSOLVER_STATUS_INTERNAL_ERROR;
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_potrf_template(
+    hipsolver_host_handle* handle, char uplo, int n, T* A, int lda, int* info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_potrf_argCheck(n, lda));
+    if((n && !A) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    hipsolver_potrf_factor(uplo, n, A, lda, info);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** POTRF_BATCHED ********************/
+template <typename T>
+hipsolverStatus_t hipsolver_potrf_batched_template(hipsolver_host_handle* handle,
+                                                   char                   uplo,
+                                                   int                    n,
+                                                   T* const               A[],
+                                                   int                    lda,
+                                                   int*                   info,
+                                                   int                    batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_potrf_argCheck(n, lda, batch_count));
+    if((n && batch_count && !A) || (batch_count && !info))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    hipsolver_host_parallel_for(handle, batch_count, [&](int b) {
+        hipsolver_potrf_factor(uplo, n, A[b], lda, info + b);
+    });
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** POTRF_OUT_OF_CORE ********************/
+inline hipsolverStatus_t hipsolver_ooc_argCheck(hipsolver_host_handle* handle,
+                                                int                    n,
+                                                int                    nrhs,
+                                                int                    lda,
+                                                int                    ldb,
+                                                const void*            A,
+                                                const void*            B,
+                                                int*                   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if((n && !A) || (n && nrhs && !B) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// all of host memory is available, so the device budget does not apply
+template <typename T>
+hipsolverStatus_t hipsolver_potrf_ooc_template(
+    hipsolver_host_handle* handle, char uplo, int n, T* A, int lda, int* info)
+{
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_ooc_argCheck(handle, n, 0, lda, n, A, nullptr, info));
+    HIPSOLVER_HOST_SYNC(handle);
+
+    hipsolver_potrf_factor(uplo, n, A, lda, info);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** POTRS_OUT_OF_CORE ********************/
+template <typename T>
+hipsolverStatus_t hipsolver_potrs_ooc_template(hipsolver_host_handle* handle,
+                                               char                   uplo,
+                                               int                    n,
+                                               int                    nrhs,
+                                               const T*               A,
+                                               int                    lda,
+                                               T*                     B,
+                                               int                    ldb,
+                                               int*                   info)
+{
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_ooc_argCheck(handle, n, nrhs, lda, ldb, A, B, info));
+    HIPSOLVER_HOST_SYNC(handle);
+
+    *info = 0;
+    if(n == 0 || nrhs == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    lapackCall_potrs(uplo, n, nrhs, (T*)A, lda, B, ldb, info);
+    return hipsolver_lapack_status(*info);
+}
+
+/******************** SYEVD/HEEVD ********************/
+inline hipsolverStatus_t hipsolver_syevd_argCheck(int n, int lda)
+{
+    if(n < 0 || lda < n)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// the sizes of work, rwork and iwork
+template <typename T>
+void hipsolver_syevd_worksize(
+    char jobz, char uplo, int n, int lda, int* lwork, int* lrwork, int* liwork)
+{
+    using S = decltype(std::real(T{}));
+
+    T   query, dummy;
+    S   rquery = 0, rdummy;
+    int iquery, info;
+    lapackCall_syevd(
+        jobz, uplo, n, &dummy, lda, &rdummy, &query, -1, &rquery, -1, &iquery, -1, &info);
+    *lwork  = hipsolver_lapack_size(query);
+    *lrwork = hipsolver_lapack_size(rquery);
+    *liwork = std::max(1, iquery);
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_syevd_bufferSize_template(
+    hipsolver_host_handle* handle, char jobz, char uplo, int n, int lda, int* lwork)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_syevd_argCheck(n, lda));
+
+    int lrwork, liwork;
+    if(n > 0)
+        hipsolver_syevd_worksize<T>(jobz, uplo, n, lda, lwork, &lrwork, &liwork);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// solves one problem, with work of size lwork if large enough
+template <typename T, typename S>
+void hipsolver_syevd_solve(
+    char jobz, char uplo, int n, T* A, int lda, S* D, T* work, int lwork, int* info)
+{
+    *info = 0;
+    if(n == 0)
+        return;
+
+    int size_work, size_rwork, size_iwork;
+    hipsolver_syevd_worksize<T>(jobz, uplo, n, lda, &size_work, &size_rwork, &size_iwork);
+
+    hipsolver_host_workspace<T> w(work, lwork, size_work);
+    std::vector<S>              rwork(size_rwork);
+    std::vector<int>            iwork(size_iwork);
+    lapackCall_syevd(jobz,
+                     uplo,
+                     n,
+                     A,
+                     lda,
+                     D,
+                     w.data(),
+                     w.size(),
+                     rwork.data(),
+                     size_rwork,
+                     iwork.data(),
+                     size_iwork,
+                     info);
+    if(*info < 0)
+        throw HIPSOLVER_STATUS_INTERNAL_ERROR;
+}
+
+template <typename T, typename S>
+hipsolverStatus_t hipsolver_syevd_template(hipsolver_host_handle* handle,
+                                           char                   jobz,
+                                           char                   uplo,
+                                           int                    n,
+                                           T*                     A,
+                                           int                    lda,
+                                           S*                     D,
+                                           T*                     work,
+                                           int                    lwork,
+                                           int*                   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_syevd_argCheck(n, lda));
+    if((n && (!A || !D)) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    hipsolver_syevd_solve(jobz, uplo, n, A, lda, D, work, lwork, info);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** SYGVD/HEGVD ********************/
+inline hipsolverStatus_t hipsolver_sygvd_argCheck(int n, int lda, int ldb, int batch_count = 1)
+{
+    if(n < 0 || lda < n || ldb < n || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// the sizes of work, rwork and iwork
+template <typename T>
+void hipsolver_sygvd_worksize(int  itype,
+                              char jobz,
+                              char uplo,
+                              int  n,
+                              int  lda,
+                              int  ldb,
+                              int* lwork,
+                              int* lrwork,
+                              int* liwork)
+{
+    using S = decltype(std::real(T{}));
+
+    T   query, dummy;
+    S   rquery = 0, rdummy;
+    int iquery, info;
+    lapackCall_sygvd(itype,
+                     jobz,
+                     uplo,
+                     n,
+                     &dummy,
+                     lda,
+                     &dummy,
+                     ldb,
+                     &rdummy,
+                     &query,
+                     -1,
+                     &rquery,
+                     -1,
+                     &iquery,
+                     -1,
+                     &info);
+    *lwork  = hipsolver_lapack_size(query);
+    *lrwork = hipsolver_lapack_size(rquery);
+    *liwork = std::max(1, iquery);
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_sygvd_bufferSize_template(hipsolver_host_handle* handle,
+                                                      int                    itype,
+                                                      char                   jobz,
+                                                      char                   uplo,
+                                                      int                    n,
+                                                      int                    lda,
+                                                      int                    ldb,
+                                                      int*                   lwork,
+                                                      int                    batch_count = 1)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_sygvd_argCheck(n, lda, ldb, batch_count));
+
+    int lrwork, liwork;
+    if(n > 0)
+        hipsolver_sygvd_worksize<T>(itype, jobz, uplo, n, lda, ldb, lwork, &lrwork, &liwork);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// solves one problem
+template <typename T, typename S>
+void hipsolver_sygvd_solve(int  itype,
+                           char jobz,
+                           char uplo,
+                           int  n,
+                           T*   A,
+                           int  lda,
+                           T*   B,
+                           int  ldb,
+                           S*   D,
+                           T*   work,
+                           int  lwork,
+                           int* info)
+{
+    *info = 0;
+    if(n == 0)
+        return;
+
+    int size_work, size_rwork, size_iwork;
+    hipsolver_sygvd_worksize<T>(
+        itype, jobz, uplo, n, lda, ldb, &size_work, &size_rwork, &size_iwork);
+
+    hipsolver_host_workspace<T> w(work, lwork, size_work);
+    std::vector<S>              rwork(size_rwork);
+    std::vector<int>            iwork(size_iwork);
+    lapackCall_sygvd(itype,
+                     jobz,
+                     uplo,
+                     n,
+                     A,
+                     lda,
+                     B,
+                     ldb,
+                     D,
+                     w.data(),
+                     w.size(),
+                     rwork.data(),
+                     size_rwork,
+                     iwork.data(),
+                     size_iwork,
+                     info);
+    if(*info < 0)
+        throw HIPSOLVER_STATUS_INTERNAL_ERROR;
+}
+
+template <typename T, typename S>
+hipsolverStatus_t hipsolver_sygvd_template(hipsolver_host_handle* handle,
+                                           int                    itype,
+                                           char                   jobz,
+                                           char                   uplo,
+                                           int                    n,
+                                           T*                     A,
+                                           int                    lda,
+                                           T*                     B,
+                                           int                    ldb,
+                                           S*                     D,
+                                           T*                     work,
+                                           int                    lwork,
+                                           int*                   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_sygvd_argCheck(n, lda, ldb));
+    if((n && (!A || !B || !D)) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    hipsolver_sygvd_solve(itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** SYGVD_PIPELINED/HEGVD_PIPELINED ********************/
+/* Solves the batch_count problems of order n at A + b * lda * n, B + b * ldb * n
+   and D + b * n, with info[b]. */
+template <typename T, typename S>
+hipsolverStatus_t hipsolver_sygvd_pipelined_template(hipsolver_host_handle* handle,
+                                                     int                    itype,
+                                                     char                   jobz,
+                                                     char                   uplo,
+                                                     int                    n,
+                                                     T*                     A,
+                                                     int                    lda,
+                                                     T*                     B,
+                                                     int                    ldb,
+                                                     S*                     D,
+                                                     int*                   info,
+                                                     int                    batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || ldb < std::max(1, n) || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if((n && batch_count && (!A || !B || !D)) || (batch_count && !info))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    hipsolver_host_parallel_for(handle, batch_count, [&](int b) {
+        hipsolver_sygvd_solve(itype,
+                              jobz,
+                              uplo,
+                              n,
+                              A + size_t(b) * lda * n,
+                              lda,
+                              B + size_t(b) * ldb * n,
+                              ldb,
+                              D + size_t(b) * n,
+                              (T*)nullptr,
+                              0,
+                              info + b);
+    });
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** SYTRD/HETRD ********************/
+inline hipsolverStatus_t hipsolver_sytrd_argCheck(int n, int lda)
+{
+    if(n < 0 || lda < n)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+int hipsolver_sytrd_worksize(char uplo, int n, int lda)
+{
+    using S = decltype(std::real(T{}));
+
+    T   query, dummy;
+    S   rdummy;
+    int info;
+    lapackCall_sytrd(uplo, n, &dummy, lda, &rdummy, &rdummy, &dummy, &query, -1, &info);
+    return hipsolver_lapack_size(query);
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_sytrd_bufferSize_template(
+    hipsolver_host_handle* handle, char uplo, int n, int lda, int* lwork)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_sytrd_argCheck(n, lda));
+
+    if(n > 0)
+        *lwork = hipsolver_sytrd_worksize<T>(uplo, n, lda);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T, typename S>
+hipsolverStatus_t hipsolver_sytrd_template(hipsolver_host_handle* handle,
+                                           char                   uplo,
+                                           int                    n,
+                                           T*                     A,
+                                           int                    lda,
+                                           S*                     D,
+                                           S*                     E,
+                                           T*                     tau,
+                                           T*                     work,
+                                           int                    lwork,
+                                           int*                   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_sytrd_argCheck(n, lda));
+    if((n && (!A || !D || !E || !tau)) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    *info = 0;
+    if(n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolver_host_workspace<T> w(work, lwork, hipsolver_sytrd_worksize<T>(uplo, n, lda));
+    lapackCall_sytrd(uplo, n, A, lda, D, E, tau, w.data(), w.size(), info);
+    return hipsolver_lapack_status(*info);
+}
+
+/******************** SYTRF ********************/
+inline hipsolverStatus_t hipsolver_sytrf_argCheck(int n, int lda)
+{
+    if(n < 0 || lda < n)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// the block size of LAPACK does not depend on uplo
+template <typename T>
+int hipsolver_sytrf_worksize(int n, int lda)
+{
+    T   query, dummy;
+    int idummy, info;
+    lapackCall_sytrf('U', n, &dummy, lda, &idummy, &query, -1, &info);
+    return hipsolver_lapack_size(query);
+}
+
+template <typename T>
+hipsolverStatus_t
+    hipsolver_sytrf_bufferSize_template(hipsolver_host_handle* handle, int n, int lda, int* lwork)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_sytrf_argCheck(n, lda));
+
+    if(n > 0)
+        *lwork = hipsolver_sytrf_worksize<T>(n, lda);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_sytrf_template(hipsolver_host_handle* handle,
+                                           char                   uplo,
+                                           int                    n,
+                                           T*                     A,
+                                           int                    lda,
+                                           int*                   ipiv,
+                                           T*                     work,
+                                           int                    lwork,
+                                           int*                   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_sytrf_argCheck(n, lda));
+    if((n && (!A || !ipiv)) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    *info = 0;
+    if(n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolver_host_workspace<T> w(work, lwork, hipsolver_sytrf_worksize<T>(n, lda));
+    lapackCall_sytrf(uplo, n, A, lda, ipiv, w.data(), w.size(), info);
+    return hipsolver_lapack_status(*info);
+}
+
+/******************** SYTRS ********************/
+inline hipsolverStatus_t hipsolver_sytrs_argCheck(int n, int nrhs, int lda, int ldb)
+{
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_sytrs_bufferSize_template(
+    hipsolver_host_handle* handle, char uplo, int n, int nrhs, int lda, int ldb, int* lwork)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    return hipsolver_sytrs_argCheck(n, nrhs, lda, ldb);
+}
+
+template <typename T>
+hipsolverStatus_t hipsolver_sytrs_template(hipsolver_host_handle* handle,
+                                           char                   uplo,
+                                           int                    n,
+                                           int                    nrhs,
+                                           T*                     A,
+                                           int                    lda,
+                                           int*                   ipiv,
+                                           T*                     B,
+                                           int                    ldb,
+                                           int*                   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_sytrs_argCheck(n, nrhs, lda, ldb));
+    if((n && (!A || !ipiv)) || (n && nrhs && !B) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    HIPSOLVER_HOST_SYNC(handle);
+
+    // info is only set for consistency with the cuSOLVER backend
+    *info = 0;
+    if(n == 0 || nrhs == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    lapackCall_sytrs(uplo, n, nrhs, A, lda, ipiv, B, ldb, info);
+    return hipsolver_lapack_status(*info);
+}
@@ -0,0 +1,2072 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include <complex>
+
+/*
+ * ===========================================================================
+ *    Type-overloaded wrappers of the Fortran LAPACK and BLAS functions used
+ *    by the host backend, in the same manner as the rocSOLVER wrappers of the
+ *    rocSOLVER backend. Scalars are taken by value. Complex matrices are
+ *    std::complex, which has the layout of hipFloatComplex and
+ *    hipDoubleComplex. The rwork arguments of the complex functions are
+ *    ignored by the real ones.
+ * ===========================================================================
+ */
+
+extern "C" {
+
+void sorgbr_(char*  vect,
+             int*   m,
+             int*   n,
+             int*   k,
+             float* A,
+             int*   lda,
+             float* tau,
+             float* work,
+             int*   lwork,
+             int*   info);
+void dorgbr_(char*   vect,
+             int*    m,
+             int*    n,
+             int*    k,
+             double* A,
+             int*    lda,
+             double* tau,
+             double* work,
+             int*    lwork,
+             int*    info);
+void cungbr_(char*                vect,
+             int*                 m,
+             int*                 n,
+             int*                 k,
+             std::complex<float>* A,
+             int*                 lda,
+             std::complex<float>* tau,
+             std::complex<float>* work,
+             int*                 lwork,
+             int*                 info);
+void zungbr_(char*                 vect,
+             int*                  m,
+             int*                  n,
+             int*                  k,
+             std::complex<double>* A,
+             int*                  lda,
+             std::complex<double>* tau,
+             std::complex<double>* work,
+             int*                  lwork,
+             int*                  info);
+void sorgqr_(
+    int* m, int* n, int* k, float* A, int* lda, float* tau, float* work, int* lwork, int* info);
+void dorgqr_(
+    int* m, int* n, int* k, double* A, int* lda, double* tau, double* work, int* lwork, int* info);
+void cungqr_(int*                 m,
+             int*                 n,
+             int*                 k,
+             std::complex<float>* A,
+             int*                 lda,
+             std::complex<float>* tau,
+             std::complex<float>* work,
+             int*                 lwork,
+             int*                 info);
+void zungqr_(int*                  m,
+             int*                  n,
+             int*                  k,
+             std::complex<double>* A,
+             int*                  lda,
+             std::complex<double>* tau,
+             std::complex<double>* work,
+             int*                  lwork,
+             int*                  info);
+void sorgtr_(
+    char* uplo, int* n, float* A, int* lda, float* tau, float* work, int* lwork, int* info);
+void dorgtr_(
+    char* uplo, int* n, double* A, int* lda, double* tau, double* work, int* lwork, int* info);
+void cungtr_(char*                uplo,
+             int*                 n,
+             std::complex<float>* A,
+             int*                 lda,
+             std::complex<float>* tau,
+             std::complex<float>* work,
+             int*                 lwork,
+             int*                 info);
+void zungtr_(char*                 uplo,
+             int*                  n,
+             std::complex<double>* A,
+             int*                  lda,
+             std::complex<double>* tau,
+             std::complex<double>* work,
+             int*                  lwork,
+             int*                  info);
+void sormqr_(char*  side,
+             char*  trans,
+             int*   m,
+             int*   n,
+             int*   k,
+             float* A,
+             int*   lda,
+             float* tau,
+             float* C,
+             int*   ldc,
+             float* work,
+             int*   lwork,
+             int*   info);
+void dormqr_(char*   side,
+             char*   trans,
+             int*    m,
+             int*    n,
+             int*    k,
+             double* A,
+             int*    lda,
+             double* tau,
+             double* C,
+             int*    ldc,
+             double* work,
+             int*    lwork,
+             int*    info);
+void cunmqr_(char*                side,
+             char*                trans,
+             int*                 m,
+             int*                 n,
+             int*                 k,
+             std::complex<float>* A,
+             int*                 lda,
+             std::complex<float>* tau,
+             std::complex<float>* C,
+             int*                 ldc,
+             std::complex<float>* work,
+             int*                 lwork,
+             int*                 info);
+void zunmqr_(char*                 side,
+             char*                 trans,
+             int*                  m,
+             int*                  n,
+             int*                  k,
+             std::complex<double>* A,
+             int*                  lda,
+             std::complex<double>* tau,
+             std::complex<double>* C,
+             int*                  ldc,
+             std::complex<double>* work,
+             int*                  lwork,
+             int*                  info);
+void sormtr_(char*  side,
+             char*  uplo,
+             char*  trans,
+             int*   m,
+             int*   n,
+             float* A,
+             int*   lda,
+             float* tau,
+             float* C,
+             int*   ldc,
+             float* work,
+             int*   lwork,
+             int*   info);
+void dormtr_(char*   side,
+             char*   uplo,
+             char*   trans,
+             int*    m,
+             int*    n,
+             double* A,
+             int*    lda,
+             double* tau,
+             double* C,
+             int*    ldc,
+             double* work,
+             int*    lwork,
+             int*    info);
+void cunmtr_(char*                side,
+             char*                uplo,
+             char*                trans,
+             int*                 m,
+             int*                 n,
+             std::complex<float>* A,
+             int*                 lda,
+             std::complex<float>* tau,
+             std::complex<float>* C,
+             int*                 ldc,
+             std::complex<float>* work,
+             int*                 lwork,
+             int*                 info);
+void zunmtr_(char*                 side,
+             char*                 uplo,
+             char*                 trans,
+             int*                  m,
+             int*                  n,
+             std::complex<double>* A,
+             int*                  lda,
+             std::complex<double>* tau,
+             std::complex<double>* C,
+             int*                  ldc,
+             std::complex<double>* work,
+             int*                  lwork,
+             int*                  info);
+void sgebrd_(int*   m,
+             int*   n,
+             float* A,
+             int*   lda,
+             float* D,
+             float* E,
+             float* tauq,
+             float* taup,
+             float* work,
+             int*   lwork,
+             int*   info);
+void dgebrd_(int*    m,
+             int*    n,
+             double* A,
+             int*    lda,
+             double* D,
+             double* E,
+             double* tauq,
+             double* taup,
+             double* work,
+             int*    lwork,
+             int*    info);
+void cgebrd_(int*                 m,
+             int*                 n,
+             std::complex<float>* A,
+             int*                 lda,
+             float*               D,
+             float*               E,
+             std::complex<float>* tauq,
+             std::complex<float>* taup,
+             std::complex<float>* work,
+             int*                 lwork,
+             int*                 info);
+void zgebrd_(int*                  m,
+             int*                  n,
+             std::complex<double>* A,
+             int*                  lda,
+             double*               D,
+             double*               E,
+             std::complex<double>* tauq,
+             std::complex<double>* taup,
+             std::complex<double>* work,
+             int*                  lwork,
+             int*                  info);
+void sgels_(char*  trans,
+            int*   m,
+            int*   n,
+            int*   nrhs,
+            float* A,
+            int*   lda,
+            float* B,
+            int*   ldb,
+            float* work,
+            int*   lwork,
+            int*   info);
+void dgels_(char*   trans,
+            int*    m,
+            int*    n,
+            int*    nrhs,
+            double* A,
+            int*    lda,
+            double* B,
+            int*    ldb,
+            double* work,
+            int*    lwork,
+            int*    info);
+void cgels_(char*                trans,
+            int*                 m,
+            int*                 n,
+            int*                 nrhs,
+            std::complex<float>* A,
+            int*                 lda,
+            std::complex<float>* B,
+            int*                 ldb,
+            std::complex<float>* work,
+            int*                 lwork,
+            int*                 info);
+void zgels_(char*                 trans,
+            int*                  m,
+            int*                  n,
+            int*                  nrhs,
+            std::complex<double>* A,
+            int*                  lda,
+            std::complex<double>* B,
+            int*                  ldb,
+            std::complex<double>* work,
+            int*                  lwork,
+            int*                  info);
+void sgeqp3_(
+    int* m, int* n, float* A, int* lda, int* jpvt, float* tau, float* work, int* lwork, int* info);
+void dgeqp3_(int*    m,
+             int*    n,
+             double* A,
+             int*    lda,
+             int*    jpvt,
+             double* tau,
+             double* work,
+             int*    lwork,
+             int*    info);
+void cgeqp3_(int*                 m,
+             int*                 n,
+             std::complex<float>* A,
+             int*                 lda,
+             int*                 jpvt,
+             std::complex<float>* tau,
+             std::complex<float>* work,
+             int*                 lwork,
+             float*               rwork,
+             int*                 info);
+void zgeqp3_(int*                  m,
+             int*                  n,
+             std::complex<double>* A,
+             int*                  lda,
+             int*                  jpvt,
+             std::complex<double>* tau,
+             std::complex<double>* work,
+             int*                  lwork,
+             double*               rwork,
+             int*                  info);
+void sgeqrf_(int* m, int* n, float* A, int* lda, float* tau, float* work, int* lwork, int* info);
+void dgeqrf_(int* m, int* n, double* A, int* lda, double* tau, double* work, int* lwork, int* info);
+void cgeqrf_(int*                 m,
+             int*                 n,
+             std::complex<float>* A,
+             int*                 lda,
+             std::complex<float>* tau,
+             std::complex<float>* work,
+             int*                 lwork,
+             int*                 info);
+void zgeqrf_(int*                  m,
+             int*                  n,
+             std::complex<double>* A,
+             int*                  lda,
+             std::complex<double>* tau,
+             std::complex<double>* work,
+             int*                  lwork,
+             int*                  info);
+void sgesvd_(char*  jobu,
+             char*  jobvt,
+             int*   m,
+             int*   n,
+             float* A,
+             int*   lda,
+             float* S,
+             float* U,
+             int*   ldu,
+             float* VT,
+             int*   ldvt,
+             float* work,
+             int*   lwork,
+             int*   info);
+void dgesvd_(char*   jobu,
+             char*   jobvt,
+             int*    m,
+             int*    n,
+             double* A,
+             int*    lda,
+             double* S,
+             double* U,
+             int*    ldu,
+             double* VT,
+             int*    ldvt,
+             double* work,
+             int*    lwork,
+             int*    info);
+void cgesvd_(char*                jobu,
+             char*                jobvt,
+             int*                 m,
+             int*                 n,
+             std::complex<float>* A,
+             int*                 lda,
+             float*               S,
+             std::complex<float>* U,
+             int*                 ldu,
+             std::complex<float>* VT,
+             int*                 ldvt,
+             std::complex<float>* work,
+             int*                 lwork,
+             float*               rwork,
+             int*                 info);
+void zgesvd_(char*                 jobu,
+             char*                 jobvt,
+             int*                  m,
+             int*                  n,
+             std::complex<double>* A,
+             int*                  lda,
+             double*               S,
+             std::complex<double>* U,
+             int*                  ldu,
+             std::complex<double>* VT,
+             int*                  ldvt,
+             std::complex<double>* work,
+             int*                  lwork,
+             double*               rwork,
+             int*                  info);
+void sgetrf_(int* m, int* n, float* A, int* lda, int* ipiv, int* info);
+void dgetrf_(int* m, int* n, double* A, int* lda, int* ipiv, int* info);
+void cgetrf_(int* m, int* n, std::complex<float>* A, int* lda, int* ipiv, int* info);
+void zgetrf_(int* m, int* n, std::complex<double>* A, int* lda, int* ipiv, int* info);
+void sgetrs_(
+    char* trans, int* n, int* nrhs, float* A, int* lda, int* ipiv, float* B, int* ldb, int* info);
+void dgetrs_(
+    char* trans, int* n, int* nrhs, double* A, int* lda, int* ipiv, double* B, int* ldb, int* info);
+void cgetrs_(char*                trans,
+             int*                 n,
+             int*                 nrhs,
+             std::complex<float>* A,
+             int*                 lda,
+             int*                 ipiv,
+             std::complex<float>* B,
+             int*                 ldb,
+             int*                 info);
+void zgetrs_(char*                 trans,
+             int*                  n,
+             int*                  nrhs,
+             std::complex<double>* A,
+             int*                  lda,
+             int*                  ipiv,
+             std::complex<double>* B,
+             int*                  ldb,
+             int*                  info);
+void spotrf_(char* uplo, int* n, float* A, int* lda, int* info);
+void dpotrf_(char* uplo, int* n, double* A, int* lda, int* info);
+void cpotrf_(char* uplo, int* n, std::complex<float>* A, int* lda, int* info);
+void zpotrf_(char* uplo, int* n, std::complex<double>* A, int* lda, int* info);
+void spotrs_(char* uplo, int* n, int* nrhs, float* A, int* lda, float* B, int* ldb, int* info);
+void dpotrs_(char* uplo, int* n, int* nrhs, double* A, int* lda, double* B, int* ldb, int* info);
+void cpotrs_(char*                uplo,
+             int*                 n,
+             int*                 nrhs,
+             std::complex<float>* A,
+             int*                 lda,
+             std::complex<float>* B,
+             int*                 ldb,
+             int*                 info);
+void zpotrs_(char*                 uplo,
+             int*                  n,
+             int*                  nrhs,
+             std::complex<double>* A,
+             int*                  lda,
+             std::complex<double>* B,
+             int*                  ldb,
+             int*                  info);
+void ssyevd_(char*  jobz,
+             char*  uplo,
+             int*   n,
+             float* A,
+             int*   lda,
+             float* W,
+             float* work,
+             int*   lwork,
+             int*   iwork,
+             int*   liwork,
+             int*   info);
+void dsyevd_(char*   jobz,
+             char*   uplo,
+             int*    n,
+             double* A,
+             int*    lda,
+             double* W,
+             double* work,
+             int*    lwork,
+             int*    iwork,
+             int*    liwork,
+             int*    info);
+void cheevd_(char*                jobz,
+             char*                uplo,
+             int*                 n,
+             std::complex<float>* A,
+             int*                 lda,
+             float*               W,
+             std::complex<float>* work,
+             int*                 lwork,
+             float*               rwork,
+             int*                 lrwork,
+             int*                 iwork,
+             int*                 liwork,
+             int*                 info);
+void zheevd_(char*                 jobz,
+             char*                 uplo,
+             int*                  n,
+             std::complex<double>* A,
+             int*                  lda,
+             double*               W,
+             std::complex<double>* work,
+             int*                  lwork,
+             double*               rwork,
+             int*                  lrwork,
+             int*                  iwork,
+             int*                  liwork,
+             int*                  info);
+void ssygvd_(int*   itype,
+             char*  jobz,
+             char*  uplo,
+             int*   n,
+             float* A,
+             int*   lda,
+             float* B,
+             int*   ldb,
+             float* W,
+             float* work,
+             int*   lwork,
+             int*   iwork,
+             int*   liwork,
+             int*   info);
+void dsygvd_(int*    itype,
+             char*   jobz,
+             char*   uplo,
+             int*    n,
+             double* A,
+             int*    lda,
+             double* B,
+             int*    ldb,
+             double* W,
+             double* work,
+             int*    lwork,
+             int*    iwork,
+             int*    liwork,
+             int*    info);
+void chegvd_(int*                 itype,
+             char*                jobz,
+             char*                uplo,
+             int*                 n,
+             std::complex<float>* A,
+             int*                 lda,
+             std::complex<float>* B,
+             int*                 ldb,
+             float*               W,
+             std::complex<float>* work,
+             int*                 lwork,
+             float*               rwork,
+             int*                 lrwork,
+             int*                 iwork,
+             int*                 liwork,
+             int*                 info);
+void zhegvd_(int*                  itype,
+             char*                 jobz,
+             char*                 uplo,
+             int*                  n,
+             std::complex<double>* A,
+             int*                  lda,
+             std::complex<double>* B,
+             int*                  ldb,
+             double*               W,
+             std::complex<double>* work,
+             int*                  lwork,
+             double*               rwork,
+             int*                  lrwork,
+             int*                  iwork,
+             int*                  liwork,
+             int*                  info);
+void ssytrd_(char*  uplo,
+             int*   n,
+             float* A,
+             int*   lda,
+             float* D,
+             float* E,
+             float* tau,
+             float* work,
+             int*   lwork,
+             int*   info);
+void dsytrd_(char*   uplo,
+             int*    n,
+             double* A,
+             int*    lda,
+             double* D,
+             double* E,
+             double* tau,
+             double* work,
+             int*    lwork,
+             int*    info);
+void chetrd_(char*                uplo,
+             int*                 n,
+             std::complex<float>* A,
+             int*                 lda,
+             float*               D,
+             float*               E,
+             std::complex<float>* tau,
+             std::complex<float>* work,
+             int*                 lwork,
+             int*                 info);
+void zhetrd_(char*                 uplo,
+             int*                  n,
+             std::complex<double>* A,
+             int*                  lda,
+             double*               D,
+             double*               E,
+             std::complex<double>* tau,
+             std::complex<double>* work,
+             int*                  lwork,
+             int*                  info);
+void ssytrf_(char* uplo, int* n, float* A, int* lda, int* ipiv, float* work, int* lwork, int* info);
+void dsytrf_(
+    char* uplo, int* n, double* A, int* lda, int* ipiv, double* work, int* lwork, int* info);
+void csytrf_(char*                uplo,
+             int*                 n,
+             std::complex<float>* A,
+             int*                 lda,
+             int*                 ipiv,
+             std::complex<float>* work,
+             int*                 lwork,
+             int*                 info);
+void zsytrf_(char*                 uplo,
+             int*                  n,
+             std::complex<double>* A,
+             int*                  lda,
+             int*                  ipiv,
+             std::complex<double>* work,
+             int*                  lwork,
+             int*                  info);
+void ssytrs_(
+    char* uplo, int* n, int* nrhs, float* A, int* lda, int* ipiv, float* B, int* ldb, int* info);
+void dsytrs_(
+    char* uplo, int* n, int* nrhs, double* A, int* lda, int* ipiv, double* B, int* ldb, int* info);
+void csytrs_(char*                uplo,
+             int*                 n,
+             int*                 nrhs,
+             std::complex<float>* A,
+             int*                 lda,
+             int*                 ipiv,
+             std::complex<float>* B,
+             int*                 ldb,
+             int*                 info);
+void zsytrs_(char*                 uplo,
+             int*                  n,
+             int*                  nrhs,
+             std::complex<double>* A,
+             int*                  lda,
+             int*                  ipiv,
+             std::complex<double>* B,
+             int*                  ldb,
+             int*                  info);
+void slarfg_(int* n, float* alpha, float* x, int* incx, float* tau);
+void dlarfg_(int* n, double* alpha, double* x, int* incx, double* tau);
+void clarfg_(int*                 n,
+             std::complex<float>* alpha,
+             std::complex<float>* x,
+             int*                 incx,
+             std::complex<float>* tau);
+void zlarfg_(int*                  n,
+             std::complex<double>* alpha,
+             std::complex<double>* x,
+             int*                  incx,
+             std::complex<double>* tau);
+void slarf_(
+    char* side, int* m, int* n, float* v, int* incv, float* tau, float* C, int* ldc, float* work);
+void dlarf_(char*   side,
+            int*    m,
+            int*    n,
+            double* v,
+            int*    incv,
+            double* tau,
+            double* C,
+            int*    ldc,
+            double* work);
+void clarf_(char*                side,
+            int*                 m,
+            int*                 n,
+            std::complex<float>* v,
+            int*                 incv,
+            std::complex<float>* tau,
+            std::complex<float>* C,
+            int*                 ldc,
+            std::complex<float>* work);
+void zlarf_(char*                 side,
+            int*                  m,
+            int*                  n,
+            std::complex<double>* v,
+            int*                  incv,
+            std::complex<double>* tau,
+            std::complex<double>* C,
+            int*                  ldc,
+            std::complex<double>* work);
+void sgemm_(char*  transA,
+            char*  transB,
+            int*   m,
+            int*   n,
+            int*   k,
+            float* alpha,
+            float* A,
+            int*   lda,
+            float* B,
+            int*   ldb,
+            float* beta,
+            float* C,
+            int*   ldc);
+void dgemm_(char*   transA,
+            char*   transB,
+            int*    m,
+            int*    n,
+            int*    k,
+            double* alpha,
+            double* A,
+            int*    lda,
+            double* B,
+            int*    ldb,
+            double* beta,
+            double* C,
+            int*    ldc);
+void cgemm_(char*                transA,
+            char*                transB,
+            int*                 m,
+            int*                 n,
+            int*                 k,
+            std::complex<float>* alpha,
+            std::complex<float>* A,
+            int*                 lda,
+            std::complex<float>* B,
+            int*                 ldb,
+            std::complex<float>* beta,
+            std::complex<float>* C,
+            int*                 ldc);
+void zgemm_(char*                 transA,
+            char*                 transB,
+            int*                  m,
+            int*                  n,
+            int*                  k,
+            std::complex<double>* alpha,
+            std::complex<double>* A,
+            int*                  lda,
+            std::complex<double>* B,
+            int*                  ldb,
+            std::complex<double>* beta,
+            std::complex<double>* C,
+            int*                  ldc);
+void strsm_(char*  side,
+            char*  uplo,
+            char*  transA,
+            char*  diag,
+            int*   m,
+            int*   n,
+            float* alpha,
+            float* A,
+            int*   lda,
+            float* B,
+            int*   ldb);
+void dtrsm_(char*   side,
+            char*   uplo,
+            char*   transA,
+            char*   diag,
+            int*    m,
+            int*    n,
+            double* alpha,
+            double* A,
+            int*    lda,
+            double* B,
+            int*    ldb);
+void ctrsm_(char*                side,
+            char*                uplo,
+            char*                transA,
+            char*                diag,
+            int*                 m,
+            int*                 n,
+            std::complex<float>* alpha,
+            std::complex<float>* A,
+            int*                 lda,
+            std::complex<float>* B,
+            int*                 ldb);
+void ztrsm_(char*                 side,
+            char*                 uplo,
+            char*                 transA,
+            char*                 diag,
+            int*                  m,
+            int*                  n,
+            std::complex<double>* alpha,
+            std::complex<double>* A,
+            int*                  lda,
+            std::complex<double>* B,
+            int*                  ldb);
+void strmm_(char*  side,
+            char*  uplo,
+            char*  transA,
+            char*  diag,
+            int*   m,
+            int*   n,
+            float* alpha,
+            float* A,
+            int*   lda,
+            float* B,
+            int*   ldb);
+void dtrmm_(char*   side,
+            char*   uplo,
+            char*   transA,
+            char*   diag,
+            int*    m,
+            int*    n,
+            double* alpha,
+            double* A,
+            int*    lda,
+            double* B,
+            int*    ldb);
+void ctrmm_(char*                side,
+            char*                uplo,
+            char*                transA,
+            char*                diag,
+            int*                 m,
+            int*                 n,
+            std::complex<float>* alpha,
+            std::complex<float>* A,
+            int*                 lda,
+            std::complex<float>* B,
+            int*                 ldb);
+void ztrmm_(char*                 side,
+            char*                 uplo,
+            char*                 transA,
+            char*                 diag,
+            int*                  m,
+            int*                  n,
+            std::complex<double>* alpha,
+            std::complex<double>* A,
+            int*                  lda,
+            std::complex<double>* B,
+            int*                  ldb);
+}
+
+// orgbr
+inline void lapackCall_orgbr(char   vect,
+                             int    m,
+                             int    n,
+                             int    k,
+                             float* A,
+                             int    lda,
+                             float* tau,
+                             float* work,
+                             int    lwork,
+                             int*   info)
+{
+    sorgbr_(&vect, &m, &n, &k, A, &lda, tau, work, &lwork, info);
+}
+
+inline void lapackCall_orgbr(char    vect,
+                             int     m,
+                             int     n,
+                             int     k,
+                             double* A,
+                             int     lda,
+                             double* tau,
+                             double* work,
+                             int     lwork,
+                             int*    info)
+{
+    dorgbr_(&vect, &m, &n, &k, A, &lda, tau, work, &lwork, info);
+}
+
+inline void lapackCall_orgbr(char                 vect,
+                             int                  m,
+                             int                  n,
+                             int                  k,
+                             std::complex<float>* A,
+                             int                  lda,
+                             std::complex<float>* tau,
+                             std::complex<float>* work,
+                             int                  lwork,
+                             int*                 info)
+{
+    cungbr_(&vect, &m, &n, &k, A, &lda, tau, work, &lwork, info);
+}
+
+inline void lapackCall_orgbr(char                  vect,
+                             int                   m,
+                             int                   n,
+                             int                   k,
+                             std::complex<double>* A,
+                             int                   lda,
+                             std::complex<double>* tau,
+                             std::complex<double>* work,
+                             int                   lwork,
+                             int*                  info)
+{
+    zungbr_(&vect, &m, &n, &k, A, &lda, tau, work, &lwork, info);
+}
+
+// orgqr
+inline void lapackCall_orgqr(
+    int m, int n, int k, float* A, int lda, float* tau, float* work, int lwork, int* info)
+{
+    sorgqr_(&m, &n, &k, A, &lda, tau, work, &lwork, info);
+}
+
+inline void lapackCall_orgqr(
+    int m, int n, int k, double* A, int lda, double* tau, double* work, int lwork, int* info)
+{
+    dorgqr_(&m, &n, &k, A, &lda, tau, work, &lwork, info);
+}
+
+inline void lapackCall_orgqr(int                  m,
+                             int                  n,
+                             int                  k,
+                             std::complex<float>* A,
+                             int                  lda,
+                             std::complex<float>* tau,
+                             std::complex<float>* work,
+                             int                  lwork,
+                             int*                 info)
+{
+    cungqr_(&m, &n, &k, A, &lda, tau, work, &lwork, info);
+}
+
+inline void lapackCall_orgqr(int                   m,
+                             int                   n,
+                             int                   k,
+                             std::complex<double>* A,
+                             int                   lda,
+                             std::complex<double>* tau,
+                             std::complex<double>* work,
+                             int                   lwork,
+                             int*                  info)
+{
+    zungqr_(&m, &n, &k, A, &lda, tau, work, &lwork, info);
+}
+
+// orgtr
+inline void lapackCall_orgtr(
+    char uplo, int n, float* A, int lda, float* tau, float* work, int lwork, int* info)
+{
+    sorgtr_(&uplo, &n, A, &lda, tau, work, &lwork, info);
+}
+
+inline void lapackCall_orgtr(
+    char uplo, int n, double* A, int lda, double* tau, double* work, int lwork, int* info)
+{
+    dorgtr_(&uplo, &n, A, &lda, tau, work, &lwork, info);
+}
+
+inline void lapackCall_orgtr(char                 uplo,
+                             int                  n,
+                             std::complex<float>* A,
+                             int                  lda,
+                             std::complex<float>* tau,
+                             std::complex<float>* work,
+                             int                  lwork,
+                             int*                 info)
+{
+    cungtr_(&uplo, &n, A, &lda, tau, work, &lwork, info);
+}
+
+inline void lapackCall_orgtr(char                  uplo,
+                             int                   n,
+                             std::complex<double>* A,
+                             int                   lda,
+                             std::complex<double>* tau,
+                             std::complex<double>* work,
+                             int                   lwork,
+                             int*                  info)
+{
+    zungtr_(&uplo, &n, A, &lda, tau, work, &lwork, info);
+}
+
+// ormqr
+inline void lapackCall_ormqr(char   side,
+                             char   trans,
+                             int    m,
+                             int    n,
+                             int    k,
+                             float* A,
+                             int    lda,
+                             float* tau,
+                             float* C,
+                             int    ldc,
+                             float* work,
+                             int    lwork,
+                             int*   info)
+{
+    sormqr_(&side, &trans, &m, &n, &k, A, &lda, tau, C, &ldc, work, &lwork, info);
+}
+
+inline void lapackCall_ormqr(char    side,
+                             char    trans,
+                             int     m,
+                             int     n,
+                             int     k,
+                             double* A,
+                             int     lda,
+                             double* tau,
+                             double* C,
+                             int     ldc,
+                             double* work,
+                             int     lwork,
+                             int*    info)
+{
+    dormqr_(&side, &trans, &m, &n, &k, A, &lda, tau, C, &ldc, work, &lwork, info);
+}
+
+inline void lapackCall_ormqr(char                 side,
+                             char                 trans,
+                             int                  m,
+                             int                  n,
+                             int                  k,
+                             std::complex<float>* A,
+                             int                  lda,
+                             std::complex<float>* tau,
+                             std::complex<float>* C,
+                             int                  ldc,
+                             std::complex<float>* work,
+                             int                  lwork,
+                             int*                 info)
+{
+    cunmqr_(&side, &trans, &m, &n, &k, A, &lda, tau, C, &ldc, work, &lwork, info);
+}
+
+inline void lapackCall_ormqr(char                  side,
+                             char                  trans,
+                             int                   m,
+                             int                   n,
+                             int                   k,
+                             std::complex<double>* A,
+                             int                   lda,
+                             std::complex<double>* tau,
+                             std::complex<double>* C,
+                             int                   ldc,
+                             std::complex<double>* work,
+                             int                   lwork,
+                             int*                  info)
+{
+    zunmqr_(&side, &trans, &m, &n, &k, A, &lda, tau, C, &ldc, work, &lwork, info);
+}
+
+// ormtr
+inline void lapackCall_ormtr(char   side,
+                             char   uplo,
+                             char   trans,
+                             int    m,
+                             int    n,
+                             float* A,
+                             int    lda,
+                             float* tau,
+                             float* C,
+                             int    ldc,
+                             float* work,
+                             int    lwork,
+                             int*   info)
+{
+    sormtr_(&side, &uplo, &trans, &m, &n, A, &lda, tau, C, &ldc, work, &lwork, info);
+}
+
+inline void lapackCall_ormtr(char    side,
+                             char    uplo,
+                             char    trans,
+                             int     m,
+                             int     n,
+                             double* A,
+                             int     lda,
+                             double* tau,
+                             double* C,
+                             int     ldc,
+                             double* work,
+                             int     lwork,
+                             int*    info)
+{
+    dormtr_(&side, &uplo, &trans, &m, &n, A, &lda, tau, C, &ldc, work, &lwork, info);
+}
+
+inline void lapackCall_ormtr(char                 side,
+                             char                 uplo,
+                             char                 trans,
+                             int                  m,
+                             int                  n,
+                             std::complex<float>* A,
+                             int                  lda,
+                             std::complex<float>* tau,
+                             std::complex<float>* C,
+                             int                  ldc,
+                             std::complex<float>* work,
+                             int                  lwork,
+                             int*                 info)
+{
+    cunmtr_(&side, &uplo, &trans, &m, &n, A, &lda, tau, C, &ldc, work, &lwork, info);
+}
+
+inline void lapackCall_ormtr(char                  side,
+                             char                  uplo,
+                             char                  trans,
+                             int                   m,
+                             int                   n,
+                             std::complex<double>* A,
+                             int                   lda,
+                             std::complex<double>* tau,
+                             std::complex<double>* C,
+                             int                   ldc,
+                             std::complex<double>* work,
+                             int                   lwork,
+                             int*                  info)
+{
+    zunmtr_(&side, &uplo, &trans, &m, &n, A, &lda, tau, C, &ldc, work, &lwork, info);
+}
+
+// gebrd
+inline void lapackCall_gebrd(int    m,
+                             int    n,
+                             float* A,
+                             int    lda,
+                             float* D,
+                             float* E,
+                             float* tauq,
+                             float* taup,
+                             float* work,
+                             int    lwork,
+                             int*   info)
+{
+    sgebrd_(&m, &n, A, &lda, D, E, tauq, taup, work, &lwork, info);
+}
+
+inline void lapackCall_gebrd(int     m,
+                             int     n,
+                             double* A,
+                             int     lda,
+                             double* D,
+                             double* E,
+                             double* tauq,
+                             double* taup,
+                             double* work,
+                             int     lwork,
+                             int*    info)
+{
+    dgebrd_(&m, &n, A, &lda, D, E, tauq, taup, work, &lwork, info);
+}
+
+inline void lapackCall_gebrd(int                  m,
+                             int                  n,
+                             std::complex<float>* A,
+                             int                  lda,
+                             float*               D,
+                             float*               E,
+                             std::complex<float>* tauq,
+                             std::complex<float>* taup,
+                             std::complex<float>* work,
+                             int                  lwork,
+                             int*                 info)
+{
+    cgebrd_(&m, &n, A, &lda, D, E, tauq, taup, work, &lwork, info);
+}
+
+inline void lapackCall_gebrd(int                   m,
+                             int                   n,
+                             std::complex<double>* A,
+                             int                   lda,
+                             double*               D,
+                             double*               E,
+                             std::complex<double>* tauq,
+                             std::complex<double>* taup,
+                             std::complex<double>* work,
+                             int                   lwork,
+                             int*                  info)
+{
+    zgebrd_(&m, &n, A, &lda, D, E, tauq, taup, work, &lwork, info);
+}
+
+// gels
+inline void lapackCall_gels(char   trans,
+                            int    m,
+                            int    n,
+                            int    nrhs,
+                            float* A,
+                            int    lda,
+                            float* B,
+                            int    ldb,
+                            float* work,
+                            int    lwork,
+                            int*   info)
+{
+    sgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+inline void lapackCall_gels(char    trans,
+                            int     m,
+                            int     n,
+                            int     nrhs,
+                            double* A,
+                            int     lda,
+                            double* B,
+                            int     ldb,
+                            double* work,
+                            int     lwork,
+                            int*    info)
+{
+    dgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+inline void lapackCall_gels(char                 trans,
+                            int                  m,
+                            int                  n,
+                            int                  nrhs,
+                            std::complex<float>* A,
+                            int                  lda,
+                            std::complex<float>* B,
+                            int                  ldb,
+                            std::complex<float>* work,
+                            int                  lwork,
+                            int*                 info)
+{
+    cgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+inline void lapackCall_gels(char                  trans,
+                            int                   m,
+                            int                   n,
+                            int                   nrhs,
+                            std::complex<double>* A,
+                            int                   lda,
+                            std::complex<double>* B,
+                            int                   ldb,
+                            std::complex<double>* work,
+                            int                   lwork,
+                            int*                  info)
+{
+    zgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+// geqp3
+inline void lapackCall_geqp3(int    m,
+                             int    n,
+                             float* A,
+                             int    lda,
+                             int*   jpvt,
+                             float* tau,
+                             float* work,
+                             int    lwork,
+                             float* rwork,
+                             int*   info)
+{
+    sgeqp3_(&m, &n, A, &lda, jpvt, tau, work, &lwork, info);
+}
+
+inline void lapackCall_geqp3(int     m,
+                             int     n,
+                             double* A,
+                             int     lda,
+                             int*    jpvt,
+                             double* tau,
+                             double* work,
+                             int     lwork,
+                             double* rwork,
+                             int*    info)
+{
+    dgeqp3_(&m, &n, A, &lda, jpvt, tau, work, &lwork, info);
+}
+
+inline void lapackCall_geqp3(int                  m,
+                             int                  n,
+                             std::complex<float>* A,
+                             int                  lda,
+                             int*                 jpvt,
+                             std::complex<float>* tau,
+                             std::complex<float>* work,
+                             int                  lwork,
+                             float*               rwork,
+                             int*                 info)
+{
+    cgeqp3_(&m, &n, A, &lda, jpvt, tau, work, &lwork, rwork, info);
+}
+
+inline void lapackCall_geqp3(int                   m,
+                             int                   n,
+                             std::complex<double>* A,
+                             int                   lda,
+                             int*                  jpvt,
+                             std::complex<double>* tau,
+                             std::complex<double>* work,
+                             int                   lwork,
+                             double*               rwork,
+                             int*                  info)
+{
+    zgeqp3_(&m, &n, A, &lda, jpvt, tau, work, &lwork, rwork, info);
+}
+
+// geqrf
+inline void lapackCall_geqrf(
+    int m, int n, float* A, int lda, float* tau, float* work, int lwork, int* info)
+{
+    sgeqrf_(&m, &n, A, &lda, tau, work, &lwork, info);
+}
+
+inline void lapackCall_geqrf(
+    int m, int n, double* A, int lda, double* tau, double* work, int lwork, int* info)
+{
+    dgeqrf_(&m, &n, A, &lda, tau, work, &lwork, info);
+}
+
+inline void lapackCall_geqrf(int                  m,
+                             int                  n,
+                             std::complex<float>* A,
+                             int                  lda,
+                             std::complex<float>* tau,
+                             std::complex<float>* work,
+                             int                  lwork,
+                             int*                 info)
+{
+    cgeqrf_(&m, &n, A, &lda, tau, work, &lwork, info);
+}
+
+inline void lapackCall_geqrf(int                   m,
+                             int                   n,
+                             std::complex<double>* A,
+                             int                   lda,
+                             std::complex<double>* tau,
+                             std::complex<double>* work,
+                             int                   lwork,
+                             int*                  info)
+{
+    zgeqrf_(&m, &n, A, &lda, tau, work, &lwork, info);
+}
+
+// gesvd
+inline void lapackCall_gesvd(char   jobu,
+                             char   jobvt,
+                             int    m,
+                             int    n,
+                             float* A,
+                             int    lda,
+                             float* S,
+                             float* U,
+                             int    ldu,
+                             float* VT,
+                             int    ldvt,
+                             float* work,
+                             int    lwork,
+                             float* rwork,
+                             int*   info)
+{
+    sgesvd_(&jobu, &jobvt, &m, &n, A, &lda, S, U, &ldu, VT, &ldvt, work, &lwork, info);
+}
+
+inline void lapackCall_gesvd(char    jobu,
+                             char    jobvt,
+                             int     m,
+                             int     n,
+                             double* A,
+                             int     lda,
+                             double* S,
+                             double* U,
+                             int     ldu,
+                             double* VT,
+                             int     ldvt,
+                             double* work,
+                             int     lwork,
+                             double* rwork,
+                             int*    info)
+{
+    dgesvd_(&jobu, &jobvt, &m, &n, A, &lda, S, U, &ldu, VT, &ldvt, work, &lwork, info);
+}
+
+inline void lapackCall_gesvd(char                 jobu,
+                             char                 jobvt,
+                             int                  m,
+                             int                  n,
+                             std::complex<float>* A,
+                             int                  lda,
+                             float*               S,
+                             std::complex<float>* U,
+                             int                  ldu,
+                             std::complex<float>* VT,
+                             int                  ldvt,
+                             std::complex<float>* work,
+                             int                  lwork,
+                             float*               rwork,
+                             int*                 info)
+{
+    cgesvd_(&jobu, &jobvt, &m, &n, A, &lda, S, U, &ldu, VT, &ldvt, work, &lwork, rwork, info);
+}
+
+inline void lapackCall_gesvd(char                  jobu,
+                             char                  jobvt,
+                             int                   m,
+                             int                   n,
+                             std::complex<double>* A,
+                             int                   lda,
+                             double*               S,
+                             std::complex<double>* U,
+                             int                   ldu,
+                             std::complex<double>* VT,
+                             int                   ldvt,
+                             std::complex<double>* work,
+                             int                   lwork,
+                             double*               rwork,
+                             int*                  info)
+{
+    zgesvd_(&jobu, &jobvt, &m, &n, A, &lda, S, U, &ldu, VT, &ldvt, work, &lwork, rwork, info);
+}
+
+// getrf
+inline void lapackCall_getrf(int m, int n, float* A, int lda, int* ipiv, int* info)
+{
+    sgetrf_(&m, &n, A, &lda, ipiv, info);
+}
+
+inline void lapackCall_getrf(int m, int n, double* A, int lda, int* ipiv, int* info)
+{
+    dgetrf_(&m, &n, A, &lda, ipiv, info);
+}
+
+inline void lapackCall_getrf(int m, int n, std::complex<float>* A, int lda, int* ipiv, int* info)
+{
+    cgetrf_(&m, &n, A, &lda, ipiv, info);
+}
+
+inline void lapackCall_getrf(int m, int n, std::complex<double>* A, int lda, int* ipiv, int* info)
+{
+    zgetrf_(&m, &n, A, &lda, ipiv, info);
+}
+
+// getrs
+inline void lapackCall_getrs(
+    char trans, int n, int nrhs, float* A, int lda, int* ipiv, float* B, int ldb, int* info)
+{
+    sgetrs_(&trans, &n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+inline void lapackCall_getrs(
+    char trans, int n, int nrhs, double* A, int lda, int* ipiv, double* B, int ldb, int* info)
+{
+    dgetrs_(&trans, &n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+inline void lapackCall_getrs(char                 trans,
+                             int                  n,
+                             int                  nrhs,
+                             std::complex<float>* A,
+                             int                  lda,
+                             int*                 ipiv,
+                             std::complex<float>* B,
+                             int                  ldb,
+                             int*                 info)
+{
+    cgetrs_(&trans, &n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+inline void lapackCall_getrs(char                  trans,
+                             int                   n,
+                             int                   nrhs,
+                             std::complex<double>* A,
+                             int                   lda,
+                             int*                  ipiv,
+                             std::complex<double>* B,
+                             int                   ldb,
+                             int*                  info)
+{
+    zgetrs_(&trans, &n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+// potrf
+inline void lapackCall_potrf(char uplo, int n, float* A, int lda, int* info)
+{
+    spotrf_(&uplo, &n, A, &lda, info);
+}
+
+inline void lapackCall_potrf(char uplo, int n, double* A, int lda, int* info)
+{
+    dpotrf_(&uplo, &n, A, &lda, info);
+}
+
+inline void lapackCall_potrf(char uplo, int n, std::complex<float>* A, int lda, int* info)
+{
+    cpotrf_(&uplo, &n, A, &lda, info);
+}
+
+inline void lapackCall_potrf(char uplo, int n, std::complex<double>* A, int lda, int* info)
+{
+    zpotrf_(&uplo, &n, A, &lda, info);
+}
+
+// potrs
+inline void lapackCall_potrs(
+    char uplo, int n, int nrhs, float* A, int lda, float* B, int ldb, int* info)
+{
+    spotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, info);
+}
+
+inline void lapackCall_potrs(
+    char uplo, int n, int nrhs, double* A, int lda, double* B, int ldb, int* info)
+{
+    dpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, info);
+}
+
+inline void lapackCall_potrs(char                 uplo,
+                             int                  n,
+                             int                  nrhs,
+                             std::complex<float>* A,
+                             int                  lda,
+                             std::complex<float>* B,
+                             int                  ldb,
+                             int*                 info)
+{
+    cpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, info);
+}
+
+inline void lapackCall_potrs(char                  uplo,
+                             int                   n,
+                             int                   nrhs,
+                             std::complex<double>* A,
+                             int                   lda,
+                             std::complex<double>* B,
+                             int                   ldb,
+                             int*                  info)
+{
+    zpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, info);
+}
+
+// syevd
+inline void lapackCall_syevd(char   jobz,
+                             char   uplo,
+                             int    n,
+                             float* A,
+                             int    lda,
+                             float* W,
+                             float* work,
+                             int    lwork,
+                             float* rwork,
+                             int    lrwork,
+                             int*   iwork,
+                             int    liwork,
+                             int*   info)
+{
+    ssyevd_(&jobz, &uplo, &n, A, &lda, W, work, &lwork, iwork, &liwork, info);
+}
+
+inline void lapackCall_syevd(char    jobz,
+                             char    uplo,
+                             int     n,
+                             double* A,
+                             int     lda,
+                             double* W,
+                             double* work,
+                             int     lwork,
+                             double* rwork,
+                             int     lrwork,
+                             int*    iwork,
+                             int     liwork,
+                             int*    info)
+{
+    dsyevd_(&jobz, &uplo, &n, A, &lda, W, work, &lwork, iwork, &liwork, info);
+}
+
+inline void lapackCall_syevd(char                 jobz,
+                             char                 uplo,
+                             int                  n,
+                             std::complex<float>* A,
+                             int                  lda,
+                             float*               W,
+                             std::complex<float>* work,
+                             int                  lwork,
+                             float*               rwork,
+                             int                  lrwork,
+                             int*                 iwork,
+                             int                  liwork,
+                             int*                 info)
+{
+    cheevd_(&jobz, &uplo, &n, A, &lda, W, work, &lwork, rwork, &lrwork, iwork, &liwork, info);
+}
+
+inline void lapackCall_syevd(char                  jobz,
+                             char                  uplo,
+                             int                   n,
+                             std::complex<double>* A,
+                             int                   lda,
+                             double*               W,
+                             std::complex<double>* work,
+                             int                   lwork,
+                             double*               rwork,
+                             int                   lrwork,
+                             int*                  iwork,
+                             int                   liwork,
+                             int*                  info)
+{
+    zheevd_(&jobz, &uplo, &n, A, &lda, W, work, &lwork, rwork, &lrwork, iwork, &liwork, info);
+}
+
+// sygvd
+inline void lapackCall_sygvd(int    itype,
+                             char   jobz,
+                             char   uplo,
+                             int    n,
+                             float* A,
+                             int    lda,
+                             float* B,
+                             int    ldb,
+                             float* W,
+                             float* work,
+                             int    lwork,
+                             float* rwork,
+                             int    lrwork,
+                             int*   iwork,
+                             int    liwork,
+                             int*   info)
+{
+    ssygvd_(&itype, &jobz, &uplo, &n, A, &lda, B, &ldb, W, work, &lwork, iwork, &liwork, info);
+}
+
+inline void lapackCall_sygvd(int     itype,
+                             char    jobz,
+                             char    uplo,
+                             int     n,
+                             double* A,
+                             int     lda,
+                             double* B,
+                             int     ldb,
+                             double* W,
+                             double* work,
+                             int     lwork,
+                             double* rwork,
+                             int     lrwork,
+                             int*    iwork,
+                             int     liwork,
+                             int*    info)
+{
+    dsygvd_(&itype, &jobz, &uplo, &n, A, &lda, B, &ldb, W, work, &lwork, iwork, &liwork, info);
+}
+
+inline void lapackCall_sygvd(int                  itype,
+                             char                 jobz,
+                             char                 uplo,
+                             int                  n,
+                             std::complex<float>* A,
+                             int                  lda,
+                             std::complex<float>* B,
+                             int                  ldb,
+                             float*               W,
+                             std::complex<float>* work,
+                             int                  lwork,
+                             float*               rwork,
+                             int                  lrwork,
+                             int*                 iwork,
+                             int                  liwork,
+                             int*                 info)
+{
+    chegvd_(&itype,
+            &jobz,
+            &uplo,
+            &n,
+            A,
+            &lda,
+            B,
+            &ldb,
+            W,
+            work,
+            &lwork,
+            rwork,
+            &lrwork,
+            iwork,
+            &liwork,
+            info);
+}
+
+inline void lapackCall_sygvd(int                   itype,
+                             char                  jobz,
+                             char                  uplo,
+                             int                   n,
+                             std::complex<double>* A,
+                             int                   lda,
+                             std::complex<double>* B,
+                             int                   ldb,
+                             double*               W,
+                             std::complex<double>* work,
+                             int                   lwork,
+                             double*               rwork,
+                             int                   lrwork,
+                             int*                  iwork,
+                             int                   liwork,
+                             int*                  info)
+{
+    zhegvd_(&itype,
+            &jobz,
+            &uplo,
+            &n,
+            A,
+            &lda,
+            B,
+            &ldb,
+            W,
+            work,
+            &lwork,
+            rwork,
+            &lrwork,
+            iwork,
+            &liwork,
+            info);
+}
+
+// sytrd
+inline void lapackCall_sytrd(char   uplo,
+                             int    n,
+                             float* A,
+                             int    lda,
+                             float* D,
+                             float* E,
+                             float* tau,
+                             float* work,
+                             int    lwork,
+                             int*   info)
+{
+    ssytrd_(&uplo, &n, A, &lda, D, E, tau, work, &lwork, info);
+}
+
+inline void lapackCall_sytrd(char    uplo,
+                             int     n,
+                             double* A,
+                             int     lda,
+                             double* D,
+                             double* E,
+                             double* tau,
+                             double* work,
+                             int     lwork,
+                             int*    info)
+{
+    dsytrd_(&uplo, &n, A, &lda, D, E, tau, work, &lwork, info);
+}
+
+inline void lapackCall_sytrd(char                 uplo,
+                             int                  n,
+                             std::complex<float>* A,
+                             int                  lda,
+                             float*               D,
+                             float*               E,
+                             std::complex<float>* tau,
+                             std::complex<float>* work,
+                             int                  lwork,
+                             int*                 info)
+{
+    chetrd_(&uplo, &n, A, &lda, D, E, tau, work, &lwork, info);
+}
+
+inline void lapackCall_sytrd(char                  uplo,
+                             int                   n,
+                             std::complex<double>* A,
+                             int                   lda,
+                             double*               D,
+                             double*               E,
+                             std::complex<double>* tau,
+                             std::complex<double>* work,
+                             int                   lwork,
+                             int*                  info)
+{
+    zhetrd_(&uplo, &n, A, &lda, D, E, tau, work, &lwork, info);
+}
+
+// sytrf
+inline void lapackCall_sytrf(
+    char uplo, int n, float* A, int lda, int* ipiv, float* work, int lwork, int* info)
+{
+    ssytrf_(&uplo, &n, A, &lda, ipiv, work, &lwork, info);
+}
+
+inline void lapackCall_sytrf(
+    char uplo, int n, double* A, int lda, int* ipiv, double* work, int lwork, int* info)
+{
+    dsytrf_(&uplo, &n, A, &lda, ipiv, work, &lwork, info);
+}
+
+inline void lapackCall_sytrf(char                 uplo,
+                             int                  n,
+                             std::complex<float>* A,
+                             int                  lda,
+                             int*                 ipiv,
+                             std::complex<float>* work,
+                             int                  lwork,
+                             int*                 info)
+{
+    csytrf_(&uplo, &n, A, &lda, ipiv, work, &lwork, info);
+}
+
+inline void lapackCall_sytrf(char                  uplo,
+                             int                   n,
+                             std::complex<double>* A,
+                             int                   lda,
+                             int*                  ipiv,
+                             std::complex<double>* work,
+                             int                   lwork,
+                             int*                  info)
+{
+    zsytrf_(&uplo, &n, A, &lda, ipiv, work, &lwork, info);
+}
+
+// sytrs
+inline void lapackCall_sytrs(
+    char uplo, int n, int nrhs, float* A, int lda, int* ipiv, float* B, int ldb, int* info)
+{
+    ssytrs_(&uplo, &n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+inline void lapackCall_sytrs(
+    char uplo, int n, int nrhs, double* A, int lda, int* ipiv, double* B, int ldb, int* info)
+{
+    dsytrs_(&uplo, &n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+inline void lapackCall_sytrs(char                 uplo,
+                             int                  n,
+                             int                  nrhs,
+                             std::complex<float>* A,
+                             int                  lda,
+                             int*                 ipiv,
+                             std::complex<float>* B,
+                             int                  ldb,
+                             int*                 info)
+{
+    csytrs_(&uplo, &n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+inline void lapackCall_sytrs(char                  uplo,
+                             int                   n,
+                             int                   nrhs,
+                             std::complex<double>* A,
+                             int                   lda,
+                             int*                  ipiv,
+                             std::complex<double>* B,
+                             int                   ldb,
+                             int*                  info)
+{
+    zsytrs_(&uplo, &n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+// larfg
+inline void lapackCall_larfg(int n, float* alpha, float* x, int incx, float* tau)
+{
+    slarfg_(&n, alpha, x, &incx, tau);
+}
+
+inline void lapackCall_larfg(int n, double* alpha, double* x, int incx, double* tau)
+{
+    dlarfg_(&n, alpha, x, &incx, tau);
+}
+
+inline void lapackCall_larfg(
+    int n, std::complex<float>* alpha, std::complex<float>* x, int incx, std::complex<float>* tau)
+{
+    clarfg_(&n, alpha, x, &incx, tau);
+}
+
+inline void lapackCall_larfg(int                   n,
+                             std::complex<double>* alpha,
+                             std::complex<double>* x,
+                             int                   incx,
+                             std::complex<double>* tau)
+{
+    zlarfg_(&n, alpha, x, &incx, tau);
+}
+
+// larf
+inline void lapackCall_larf(
+    char side, int m, int n, float* v, int incv, float* tau, float* C, int ldc, float* work)
+{
+    slarf_(&side, &m, &n, v, &incv, tau, C, &ldc, work);
+}
+
+inline void lapackCall_larf(
+    char side, int m, int n, double* v, int incv, double* tau, double* C, int ldc, double* work)
+{
+    dlarf_(&side, &m, &n, v, &incv, tau, C, &ldc, work);
+}
+
+inline void lapackCall_larf(char                 side,
+                            int                  m,
+                            int                  n,
+                            std::complex<float>* v,
+                            int                  incv,
+                            std::complex<float>* tau,
+                            std::complex<float>* C,
+                            int                  ldc,
+                            std::complex<float>* work)
+{
+    clarf_(&side, &m, &n, v, &incv, tau, C, &ldc, work);
+}
+
+inline void lapackCall_larf(char                  side,
+                            int                   m,
+                            int                   n,
+                            std::complex<double>* v,
+                            int                   incv,
+                            std::complex<double>* tau,
+                            std::complex<double>* C,
+                            int                   ldc,
+                            std::complex<double>* work)
+{
+    zlarf_(&side, &m, &n, v, &incv, tau, C, &ldc, work);
+}
+
+// gemm
+inline void lapackCall_gemm(char   transA,
+                            char   transB,
+                            int    m,
+                            int    n,
+                            int    k,
+                            float  alpha,
+                            float* A,
+                            int    lda,
+                            float* B,
+                            int    ldb,
+                            float  beta,
+                            float* C,
+                            int    ldc)
+{
+    sgemm_(&transA, &transB, &m, &n, &k, &alpha, A, &lda, B, &ldb, &beta, C, &ldc);
+}
+
+inline void lapackCall_gemm(char    transA,
+                            char    transB,
+                            int     m,
+                            int     n,
+                            int     k,
+                            double  alpha,
+                            double* A,
+                            int     lda,
+                            double* B,
+                            int     ldb,
+                            double  beta,
+                            double* C,
+                            int     ldc)
+{
+    dgemm_(&transA, &transB, &m, &n, &k, &alpha, A, &lda, B, &ldb, &beta, C, &ldc);
+}
+
+inline void lapackCall_gemm(char                 transA,
+                            char                 transB,
+                            int                  m,
+                            int                  n,
+                            int                  k,
+                            std::complex<float>  alpha,
+                            std::complex<float>* A,
+                            int                  lda,
+                            std::complex<float>* B,
+                            int                  ldb,
+                            std::complex<float>  beta,
+                            std::complex<float>* C,
+                            int                  ldc)
+{
+    cgemm_(&transA, &transB, &m, &n, &k, &alpha, A, &lda, B, &ldb, &beta, C, &ldc);
+}
+
+inline void lapackCall_gemm(char                  transA,
+                            char                  transB,
+                            int                   m,
+                            int                   n,
+                            int                   k,
+                            std::complex<double>  alpha,
+                            std::complex<double>* A,
+                            int                   lda,
+                            std::complex<double>* B,
+                            int                   ldb,
+                            std::complex<double>  beta,
+                            std::complex<double>* C,
+                            int                   ldc)
+{
+    zgemm_(&transA, &transB, &m, &n, &k, &alpha, A, &lda, B, &ldb, &beta, C, &ldc);
+}
+
+// trsm
+inline void lapackCall_trsm(char   side,
+                            char   uplo,
+                            char   transA,
+                            char   diag,
+                            int    m,
+                            int    n,
+                            float  alpha,
+                            float* A,
+                            int    lda,
+                            float* B,
+                            int    ldb)
+{
+    strsm_(&side, &uplo, &transA, &diag, &m, &n, &alpha, A, &lda, B, &ldb);
+}
+
+inline void lapackCall_trsm(char    side,
+                            char    uplo,
+                            char    transA,
+                            char    diag,
+                            int     m,
+                            int     n,
+                            double  alpha,
+                            double* A,
+                            int     lda,
+                            double* B,
+                            int     ldb)
+{
+    dtrsm_(&side, &uplo, &transA, &diag, &m, &n, &alpha, A, &lda, B, &ldb);
+}
+
+inline void lapackCall_trsm(char                 side,
+                            char                 uplo,
+                            char                 transA,
+                            char                 diag,
+                            int                  m,
+                            int                  n,
+                            std::complex<float>  alpha,
+                            std::complex<float>* A,
+                            int                  lda,
+                            std::complex<float>* B,
+                            int                  ldb)
+{
+    ctrsm_(&side, &uplo, &transA, &diag, &m, &n, &alpha, A, &lda, B, &ldb);
+}
+
+inline void lapackCall_trsm(char                  side,
+                            char                  uplo,
+                            char                  transA,
+                            char                  diag,
+                            int                   m,
+                            int                   n,
+                            std::complex<double>  alpha,
+                            std::complex<double>* A,
+                            int                   lda,
+                            std::complex<double>* B,
+                            int                   ldb)
+{
+    ztrsm_(&side, &uplo, &transA, &diag, &m, &n, &alpha, A, &lda, B, &ldb);
+}
+
+// trmm
+inline void lapackCall_trmm(char   side,
+                            char   uplo,
+                            char   transA,
+                            char   diag,
+                            int    m,
+                            int    n,
+                            float  alpha,
+                            float* A,
+                            int    lda,
+                            float* B,
+                            int    ldb)
+{
+    strmm_(&side, &uplo, &transA, &diag, &m, &n, &alpha, A, &lda, B, &ldb);
+}
+
+inline void lapackCall_trmm(char    side,
+                            char    uplo,
+                            char    transA,
+                            char    diag,
+                            int     m,
+                            int     n,
+                            double  alpha,
+                            double* A,
+                            int     lda,
+                            double* B,
+                            int     ldb)
+{
+    dtrmm_(&side, &uplo, &transA, &diag, &m, &n, &alpha, A, &lda, B, &ldb);
+}
+
+inline void lapackCall_trmm(char                 side,
+                            char                 uplo,
+                            char                 transA,
+                            char                 diag,
+                            int                  m,
+                            int                  n,
+                            std::complex<float>  alpha,
+                            std::complex<float>* A,
+                            int                  lda,
+                            std::complex<float>* B,
+                            int                  ldb)
+{
+    ctrmm_(&side, &uplo, &transA, &diag, &m, &n, &alpha, A, &lda, B, &ldb);
+}
+
+inline void lapackCall_trmm(char                  side,
+                            char                  uplo,
+                            char                  transA,
+                            char                  diag,
+                            int                   m,
+                            int                   n,
+                            std::complex<double>  alpha,
+                            std::complex<double>* A,
+                            int                   lda,
+                            std::complex<double>* B,
+                            int                   ldb)
+{
+    ztrmm_(&side, &uplo, &transA, &diag, &m, &n, &alpha, A, &lda, B, &ldb);
+}
@@ -0,0 +1,188 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "lapack_routines.hpp"
+
+/*
+ * ===========================================================================
+ *    Multi-device functions of the host backend. The devices of a grid are
+ *    only names for the owners of the column blocks: the local matrices keep
+ *    the 1D block-cyclic layout of the other backends, with block jb on
+ *    device jb % ndev, so that the same distributed matrices can be passed
+ *    to any backend. The columns are gathered into one dense matrix, solved
+ *    with LAPACK and scattered back.
+ * ===========================================================================
+ */
+
+// the object behind a hipsolverMgHandle_t
+struct hipsolver_host_mg_handle
+{
+    std::vector<int> devices;
+
+    // devices are selected only once
+    hipsolverStatus_t select(int ndev, const int* ids)
+    {
+        if(!devices.empty())
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+        if(ndev < 1 || !ids)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+        for(int d = 0; d < ndev; d++)
+        {
+            if(ids[d] < 0 || std::count(ids, ids + d, ids[d]))
+                return HIPSOLVER_STATUS_INVALID_VALUE;
+        }
+
+        devices.assign(ids, ids + ndev);
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+};
+
+// the object behind a hipsolverMgGrid_t; only grids of one row of devices are supported
+struct hipsolver_host_mg_grid
+{
+    std::vector<int> devices;
+};
+
+// the object behind a hipsolverMgMatrixDesc_t
+struct hipsolver_host_mg_desc
+{
+    int              rows      = 0; // also the leading dimension of the local matrices
+    int              cols      = 0;
+    int              col_block = 1;
+    std::vector<int> devices; // the devices of the grid
+};
+
+enum hipsolver_host_mg_factorization
+{
+    hipsolver_host_mg_cholesky,
+    hipsolver_host_mg_lu,
+    hipsolver_host_mg_eigen,
+};
+
+// the device and local column of the global column j
+inline void hipsolver_mg_locate(int j, int nb, int ndev, int* dev, int* local)
+{
+    int jb = j / nb;
+    *dev   = jb % ndev;
+    *local = jb / ndev * nb + j % nb;
+}
+
+/* Checks the arguments of a multi-device function on the m-by-n submatrix of
+   desc starting at (ia, ja), which must be (1, 1) as with cusolverMg. */
+inline hipsolverStatus_t hipsolver_mg_argCheck(hipsolver_host_mg_handle*     handle,
+                                               const hipsolver_host_mg_desc* desc,
+                                               int                           m,
+                                               int                           n,
+                                               int                           ia,
+                                               int                           ja)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!desc)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(ia != 1 || ja != 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(m < 0 || n < 0 || m > desc->rows || n > desc->cols)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    for(int device : desc->devices)
+    {
+        if(std::find(handle->devices.begin(), handle->devices.end(), device)
+           == handle->devices.end())
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+    }
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// no workspace is needed, as the dense matrix is allocated by the call
+inline hipsolverStatus_t hipsolver_mg_bufferSize_template(hipsolver_host_mg_handle*     handle,
+                                                          char                          uplo,
+                                                          char                          jobz,
+                                                          int                           m,
+                                                          int                           n,
+                                                          int                           ia,
+                                                          int                           ja,
+                                                          const hipsolver_host_mg_desc* desc,
+                                                          int*                          lwork)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    *lwork = 0;
+    return hipsolver_mg_argCheck(handle, desc, m, n, ia, ja);
+}
+
+/* Runs a multi-device factorization or eigensolver on the m-by-n matrix
+   distributed as described by desc, whose local matrices are A. ipiv receives
+   the pivots of the local columns of every device, and W the eigenvalues. */
+template <typename T, typename S>
+hipsolverStatus_t hipsolver_mg_template(hipsolver_host_mg_handle*       handle,
+                                        hipsolver_host_mg_factorization fact,
+                                        char                            uplo,
+                                        char                            jobz,
+                                        int                             m,
+                                        int                             n,
+                                        T**                             A,
+                                        int                             ia,
+                                        int                             ja,
+                                        const hipsolver_host_mg_desc*   desc,
+                                        int**                           ipiv,
+                                        S*                              W,
+                                        int*                            info)
+{
+    HIPSOLVER_RETURN_IF_ERROR(hipsolver_mg_argCheck(handle, desc, m, n, ia, ja));
+    if(!info || (std::min(m, n) > 0 && !A) || (fact == hipsolver_host_mg_lu && !ipiv)
+       || (fact == hipsolver_host_mg_eigen && n > 0 && !W))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // quick return
+    *info = 0;
+    if(std::min(m, n) == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    int ndev = int(desc->devices.size());
+    int nb   = desc->col_block;
+    int ld   = desc->rows;
+    for(int d = 0; d < ndev; d++)
+    {
+        // device d owns block d, if any
+        if(size_t(d) * nb < size_t(n) && (!A[d] || (fact == hipsolver_host_mg_lu && !ipiv[d])))
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+    }
+
+    // gather
+    std::vector<T> dense(size_t(m) * n);
+    for(int j = 0; j < n; j++)
+    {
+        int dev, local;
+        hipsolver_mg_locate(j, nb, ndev, &dev, &local);
+        const T* col = A[dev] + size_t(local) * ld;
+        std::copy(col, col + m, dense.begin() + size_t(j) * m);
+    }
+
+    std::vector<int> pivots;
+    if(fact == hipsolver_host_mg_cholesky)
+        hipsolver_potrf_factor(uplo, n, dense.data(), m, info);
+    else if(fact == hipsolver_host_mg_lu)
+    {
+        pivots.resize(std::min(m, n));
+        lapackCall_getrf(m, n, dense.data(), m, pivots.data(), info);
+        HIPSOLVER_RETURN_IF_ERROR(hipsolver_lapack_status(*info));
+    }
+    else
+        hipsolver_syevd_solve(jobz, uplo, n, dense.data(), m, W, (T*)nullptr, 0, info);
+
+    // scatter
+    for(int j = 0; j < n; j++)
+    {
+        int dev, local;
+        hipsolver_mg_locate(j, nb, ndev, &dev, &local);
+        auto col = dense.begin() + size_t(j) * m;
+        std::copy(col, col + m, A[dev] + size_t(local) * ld);
+        if(j < int(pivots.size()))
+            ipiv[dev][local] = pivots[j];
+    }
+    return HIPSOLVER_STATUS_SUCCESS;
+}
@@ -0,0 +1,35 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "thread_pool.hpp"
+
+/* Calls func(b) for b in [0, count) on the thread pool of handle, which is
+   created on first use with the size and affinity set by
+   hipsolverSetHostThreadPool. The first exception thrown by func is rethrown
+   once all the calls are done. */
+template <typename F>
+void hipsolver_host_parallel_for(hipsolver_host_handle* handle, int count, F func)
+{
+    if(count <= 0)
+        return;
+    if(count == 1)
+    {
+        func(0);
+        return;
+    }
+
+    std::shared_ptr<hipsolver_host_pool> pool;
+    {
+        std::lock_guard<std::mutex> lock(handle->mutex);
+        if(!handle->pool)
+            handle->pool = std::make_shared<hipsolver_host_pool>(handle->pool_threads,
+                                                                 handle->pool_affinity);
+        pool = handle->pool;
+    }
+
+    pool->run(count, std::function<void(int)>(func));
+}
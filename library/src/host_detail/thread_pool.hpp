@@ -0,0 +1,283 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/*
+ * ===========================================================================
+ *    Work-stealing thread pool of the batched functions of the host backend.
+ *    The problems of a batch differ in cost: some fail early with info > 0
+ *    and the grouped functions mix sizes, so a static split leaves threads
+ *    idle. Each slot owns a range of the problems, dealt out evenly at the
+ *    start of a run, and takes them from its front; a slot that runs out
+ *    steals the back half of the range of another slot. The calling thread
+ *    is slot 0 and keeps its own affinity; the other slots are threads of
+ *    the pool, pinned to the CPUs of the process as set by the affinity.
+ * ===========================================================================
+ */
+
+// the CPUs the process may run on
+inline std::vector<int> hipsolver_host_cpus()
+{
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if(sched_getaffinity(0, sizeof(set), &set) == 0)
+    {
+        for(int c = 0; c < CPU_SETSIZE; c++)
+            if(CPU_ISSET(c, &set))
+                cpus.push_back(c);
+    }
+#endif
+    return cpus;
+}
+
+// the number of threads of a pool of size 0
+inline int hipsolver_host_default_threads()
+{
+    int count = int(hipsolver_host_cpus().size());
+    if(count == 0)
+        count = int(std::thread::hardware_concurrency());
+    return std::max(count, 1);
+}
+
+class hipsolver_host_pool
+{
+public:
+    hipsolver_host_pool(int nthreads, hipsolverHostAffinity_t affinity)
+    {
+        int size = nthreads > 0 ? nthreads : hipsolver_host_default_threads();
+        slots.reset(new slot[size]);
+        nslots = size;
+
+        std::vector<int> cpus;
+        if(affinity != HIPSOLVER_HOST_AFFINITY_NONE)
+            cpus = hipsolver_host_cpus();
+
+        try
+        {
+            for(int s = 1; s < size; s++)
+            {
+                threads.emplace_back([this, s] { loop(s); });
+                if(!cpus.empty())
+                {
+                    int p   = int(cpus.size());
+                    int cpu = affinity == HIPSOLVER_HOST_AFFINITY_CLOSE ? cpus[s % p]
+                                                                        : cpus[(s * p / size) % p];
+                    pin(threads.back(), cpu);
+                }
+            }
+        }
+        catch(...)
+        {
+            shutdown();
+            throw;
+        }
+    }
+
+    ~hipsolver_host_pool()
+    {
+        shutdown();
+    }
+
+    hipsolver_host_pool(const hipsolver_host_pool&) = delete;
+    hipsolver_host_pool& operator=(const hipsolver_host_pool&) = delete;
+
+    int size() const
+    {
+        return nslots;
+    }
+
+    /* Calls func(b) for b in [0, count) on the threads of the pool and
+       returns once all the calls are done. The first exception thrown by
+       func is rethrown then. Runs on the same pool are serialized. */
+    void run(int count, const std::function<void(int)>& func)
+    {
+        if(count <= 0)
+            return;
+
+        std::lock_guard<std::mutex> run_lock(run_mutex);
+        error = nullptr;
+
+        if(count == 1 || nslots == 1)
+        {
+            for(int b = 0; b < count; b++)
+                call(func, b);
+        }
+        else
+        {
+            for(int s = 0; s < nslots; s++)
+            {
+                std::lock_guard<std::mutex> lock(slots[s].mutex);
+                slots[s].begin = int(int64_t(count) * s / nslots);
+                slots[s].end   = int(int64_t(count) * (s + 1) / nslots);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                task   = &func;
+                active = nslots - 1;
+                generation++;
+            }
+            start.notify_all();
+
+            work(0);
+
+            std::unique_lock<std::mutex> lock(mutex);
+            done.wait(lock, [this] { return active == 0; });
+            task = nullptr;
+        }
+
+        if(error)
+            std::rethrow_exception(error);
+    }
+
+private:
+    // the range of problems owned by a slot
+    struct alignas(64) slot
+    {
+        std::mutex mutex;
+        int        begin = 0;
+        int        end   = 0;
+    };
+
+    std::unique_ptr<slot[]>  slots;
+    int                      nslots = 0;
+    std::vector<std::thread> threads;
+
+    std::mutex                      run_mutex;
+    std::mutex                      mutex;
+    std::condition_variable         start;
+    std::condition_variable         done;
+    const std::function<void(int)>* task       = nullptr;
+    unsigned                        generation = 0;
+    int                             active     = 0;
+    bool                            stop       = false;
+    std::exception_ptr              error;
+
+    static void pin(std::thread& thread, int cpu)
+    {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        // best effort; the thread still runs if the CPU cannot be set
+        pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#endif
+    }
+
+    void call(const std::function<void(int)>& func, int b)
+    {
+        try
+        {
+            func(b);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(!error)
+                error = std::current_exception();
+        }
+    }
+
+    // takes the next problem of slot s, stealing if its range is empty
+    bool next(int s, int* b)
+    {
+        {
+            std::lock_guard<std::mutex> lock(slots[s].mutex);
+            if(slots[s].begin < slots[s].end)
+            {
+                *b = slots[s].begin++;
+                return true;
+            }
+        }
+
+        for(int k = 1; k < nslots; k++)
+        {
+            slot& victim = slots[(s + k) % nslots];
+            int   first, last;
+            {
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                int left = victim.end - victim.begin;
+                if(left <= 0)
+                    continue;
+                last       = victim.end;
+                first      = last - (left + 1) / 2;
+                victim.end = first;
+            }
+
+            std::lock_guard<std::mutex> lock(slots[s].mutex);
+            *b             = first;
+            slots[s].begin = first + 1;
+            slots[s].end   = last;
+            return true;
+        }
+
+        // all the problems are taken; the ones in flight belong to other slots
+        return false;
+    }
+
+    void work(int s)
+    {
+        const std::function<void(int)>& func = *task;
+
+        int b;
+        while(next(s, &b))
+            call(func, b);
+    }
+
+    void loop(int s)
+    {
+        unsigned seen = 0;
+        while(true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                start.wait(lock, [&] { return stop || generation != seen; });
+                if(stop)
+                    return;
+                seen = generation;
+            }
+
+            work(s);
+
+            bool last;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                last = --active == 0;
+            }
+            if(last)
+                done.notify_one();
+        }
+    }
+
+    void shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        start.notify_all();
+        for(auto& thread : threads)
+            thread.join();
+        threads.clear();
+    }
+};
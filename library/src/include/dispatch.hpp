@@ -0,0 +1,48 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+
+/*
+ * ===========================================================================
+ *    Crossover thresholds of HIPSOLVER_DISPATCH_MODE_AUTO. A call of a
+ *    routine in the table runs on the host if its matrix has at most as many
+ *    rows and columns as the threshold of its routine and precision, and its
+ *    data is in host-accessible memory; a threshold of 0 keeps the routine on
+ *    the device. The defaults are where the host kernels and the device
+ *    functions, including the fixed cost of their launches, take about the
+ *    same time on common systems.
+ * ===========================================================================
+ */
+
+#define HIPSOLVER_DISPATCH_ROUTINES 3
+#define HIPSOLVER_DISPATCH_PRECISIONS 4
+
+struct hipsolver_dispatch_table
+{
+    // indexed by routine and precision, in the order of their enums
+    int n[HIPSOLVER_DISPATCH_ROUTINES][HIPSOLVER_DISPATCH_PRECISIONS] = {
+        {64, 64, 32, 32}, // potrf
+        {48, 48, 24, 24}, // getrf
+        {64, 64, 32, 32}, // getrs
+    };
+
+    static bool valid(hipsolverDispatchRoutine_t routine, hipsolverPrecision_t precision)
+    {
+        return routine >= HIPSOLVER_DISPATCH_POTRF && routine <= HIPSOLVER_DISPATCH_GETRS
+               && precision >= HIPSOLVER_PRECISION_SINGLE
+               && precision <= HIPSOLVER_PRECISION_DOUBLE_COMPLEX;
+    }
+
+    int& at(hipsolverDispatchRoutine_t routine, hipsolverPrecision_t precision)
+    {
+        return n[routine - HIPSOLVER_DISPATCH_POTRF][precision - HIPSOLVER_PRECISION_SINGLE];
+    }
+    int at(hipsolverDispatchRoutine_t routine, hipsolverPrecision_t precision) const
+    {
+        return n[routine - HIPSOLVER_DISPATCH_POTRF][precision - HIPSOLVER_PRECISION_SINGLE];
+    }
+};
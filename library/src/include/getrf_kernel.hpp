@@ -0,0 +1,550 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/* Included by host_kernels.hpp once for each instruction set, inside the
+   namespace of its kernels; HIPSOLVER_KERNEL_AVX2 or HIPSOLVER_KERNEL_AVX512
+   is defined for the vector instruction sets. */
+
+/*
+ * ===========================================================================
+ *    Native LU kernels on the host. For matrices of up to a few hundred rows
+ *    and columns, the time of LAPACK getrf and getrs is mostly spent in the
+ *    overhead of the calls and of the level 2 updates of its unblocked
+ *    panels. These kernels factorize panels of
+ *    HIPSOLVER_GETRF_KERNEL_BLOCKSIZE columns, which stay in the L1 and L2
+ *    caches, and update the trailing matrix with a register-blocked
+ *    microkernel. The vector instructions are those of hipsolver_simd:
+ *    AVX-512 or AVX2 for float and double in the namespaces of these
+ *    instruction sets, and scalar code otherwise (including complex types).
+ *    The pivots are chosen as in LAPACK, so the factors only differ from
+ *    those of LAPACK by rounding.
+ * ===========================================================================
+ */
+
+/******************** SIMD ********************/
+// scalar fallback, also used for the complex types
+template <typename T>
+struct hipsolver_simd
+{
+    using vec                  = T;
+    static constexpr int width = 1;
+    static constexpr int mr    = 2; // rows of the tiles of hipsolver_kernel_gemm, in vectors
+    static constexpr int nr    = 4; // columns of the tiles of hipsolver_kernel_gemm
+
+    static vec load(const T* p)
+    {
+        return *p;
+    }
+    static void store(T* p, vec v)
+    {
+        *p = v;
+    }
+    static vec set1(T a)
+    {
+        return a;
+    }
+    // c - a * b
+    static vec fnmadd(vec a, vec b, vec c)
+    {
+        return c - a * b;
+    }
+    // c + a * b
+    static vec fmadd(vec a, vec b, vec c)
+    {
+        return c + a * b;
+    }
+    static T reduce(vec v)
+    {
+        return v;
+    }
+};
+
+#if defined(HIPSOLVER_KERNEL_AVX512)
+template <>
+struct hipsolver_simd<float>
+{
+    using vec                  = __m512;
+    static constexpr int width = 16;
+    static constexpr int mr    = 2;
+    static constexpr int nr    = 8;
+
+    static vec load(const float* p)
+    {
+        return _mm512_loadu_ps(p);
+    }
+    static void store(float* p, vec v)
+    {
+        _mm512_storeu_ps(p, v);
+    }
+    static vec set1(float a)
+    {
+        return _mm512_set1_ps(a);
+    }
+    static vec fnmadd(vec a, vec b, vec c)
+    {
+        return _mm512_fnmadd_ps(a, b, c);
+    }
+    static vec fmadd(vec a, vec b, vec c)
+    {
+        return _mm512_fmadd_ps(a, b, c);
+    }
+    static float reduce(vec v)
+    {
+        return _mm512_reduce_add_ps(v);
+    }
+};
+
+template <>
+struct hipsolver_simd<double>
+{
+    using vec                  = __m512d;
+    static constexpr int width = 8;
+    static constexpr int mr    = 2;
+    static constexpr int nr    = 8;
+
+    static vec load(const double* p)
+    {
+        return _mm512_loadu_pd(p);
+    }
+    static void store(double* p, vec v)
+    {
+        _mm512_storeu_pd(p, v);
+    }
+    static vec set1(double a)
+    {
+        return _mm512_set1_pd(a);
+    }
+    static vec fnmadd(vec a, vec b, vec c)
+    {
+        return _mm512_fnmadd_pd(a, b, c);
+    }
+    static vec fmadd(vec a, vec b, vec c)
+    {
+        return _mm512_fmadd_pd(a, b, c);
+    }
+    static double reduce(vec v)
+    {
+        return _mm512_reduce_add_pd(v);
+    }
+};
+#elif defined(HIPSOLVER_KERNEL_AVX2)
+template <>
+struct hipsolver_simd<float>
+{
+    using vec                  = __m256;
+    static constexpr int width = 8;
+    static constexpr int mr    = 2;
+    static constexpr int nr    = 6;
+
+    static vec load(const float* p)
+    {
+        return _mm256_loadu_ps(p);
+    }
+    static void store(float* p, vec v)
+    {
+        _mm256_storeu_ps(p, v);
+    }
+    static vec set1(float a)
+    {
+        return _mm256_set1_ps(a);
+    }
+    static vec fnmadd(vec a, vec b, vec c)
+    {
+        return _mm256_fnmadd_ps(a, b, c);
+    }
+    static vec fmadd(vec a, vec b, vec c)
+    {
+        return _mm256_fmadd_ps(a, b, c);
+    }
+    static float reduce(vec v)
+    {
+        __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+        s        = _mm_add_ps(s, _mm_movehl_ps(s, s));
+        s        = _mm_add_ss(s, _mm_movehdup_ps(s));
+        return _mm_cvtss_f32(s);
+    }
+};
+
+template <>
+struct hipsolver_simd<double>
+{
+    using vec                  = __m256d;
+    static constexpr int width = 4;
+    static constexpr int mr    = 2;
+    static constexpr int nr    = 6;
+
+    static vec load(const double* p)
+    {
+        return _mm256_loadu_pd(p);
+    }
+    static void store(double* p, vec v)
+    {
+        _mm256_storeu_pd(p, v);
+    }
+    static vec set1(double a)
+    {
+        return _mm256_set1_pd(a);
+    }
+    static vec fnmadd(vec a, vec b, vec c)
+    {
+        return _mm256_fnmadd_pd(a, b, c);
+    }
+    static vec fmadd(vec a, vec b, vec c)
+    {
+        return _mm256_fmadd_pd(a, b, c);
+    }
+    static double reduce(vec v)
+    {
+        __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+        return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+    }
+};
+#endif
+
+/******************** HELPERS ********************/
+// y = y - a * x, for vectors of length len
+template <typename T>
+inline void hipsolver_kernel_axpy(int len, T a, const T* x, T* y)
+{
+    using simd       = hipsolver_simd<T>;
+    constexpr int w  = simd::width;
+    auto          va = simd::set1(a);
+    int           i  = 0;
+    for(; i + w <= len; i += w)
+        simd::store(y + i, simd::fnmadd(simd::load(x + i), va, simd::load(y + i)));
+    for(; i < len; i++)
+        y[i] -= x[i] * a;
+}
+
+// sum of op(x[i]) * y[i], where op conjugates x if CONJ
+template <bool CONJ, typename T>
+inline T hipsolver_kernel_dot(int len, const T* x, const T* y)
+{
+    using simd      = hipsolver_simd<T>;
+    constexpr int w = simd::width;
+    int           i = 0;
+    T             s = T(0);
+    if(w > 1)
+    {
+        auto acc = simd::set1(T(0));
+        for(; i + w <= len; i += w)
+            acc = simd::fmadd(simd::load(x + i), simd::load(y + i), acc);
+        s = simd::reduce(acc);
+    }
+    for(; i < len; i++)
+        s += (CONJ ? hipsolver_kernel_conj(x[i]) : x[i]) * y[i];
+    return s;
+}
+
+// interchanges the rows k1 to k2 - 1 of the n columns of A with the rows in ipiv (1-based)
+template <typename T>
+inline void hipsolver_kernel_laswp(int n, T* A, int lda, int k1, int k2, const int* ipiv)
+{
+    for(int j = 0; j < n; j++)
+    {
+        T* Aj = A + size_t(j) * lda;
+        for(int i = k1; i < k2; i++)
+        {
+            int p = ipiv[i] - 1;
+            if(p != i)
+                std::swap(Aj[i], Aj[p]);
+        }
+    }
+}
+
+/******************** MICROKERNEL ********************/
+/* C = C - A * B, where C is m-by-n, A is m-by-k and B is k-by-n. Each tile
+   of C of simd::mr vectors by simd::nr columns is kept in registers while
+   the k columns of A are applied to it; the rows and columns left over are
+   updated with axpy. */
+template <typename T>
+void hipsolver_kernel_gemm(
+    int m, int n, int k, const T* A, int lda, const T* B, int ldb, T* C, int ldc)
+{
+    using simd       = hipsolver_simd<T>;
+    using vec        = typename simd::vec;
+    constexpr int w  = simd::width;
+    constexpr int MR = simd::mr;
+    constexpr int NR = simd::nr;
+
+    int j = 0;
+    for(; j + NR <= n; j += NR)
+    {
+        int i = 0;
+        for(; i + MR * w <= m; i += MR * w)
+        {
+            vec c[MR][NR];
+            for(int q = 0; q < NR; q++)
+                for(int r = 0; r < MR; r++)
+                    c[r][q] = simd::load(C + i + r * w + size_t(j + q) * ldc);
+
+            for(int l = 0; l < k; l++)
+            {
+                const T* Al = A + i + size_t(l) * lda;
+                vec      a[MR];
+                for(int r = 0; r < MR; r++)
+                    a[r] = simd::load(Al + r * w);
+                for(int q = 0; q < NR; q++)
+                {
+                    vec b = simd::set1(B[l + size_t(j + q) * ldb]);
+                    for(int r = 0; r < MR; r++)
+                        c[r][q] = simd::fnmadd(a[r], b, c[r][q]);
+                }
+            }
+
+            for(int q = 0; q < NR; q++)
+                for(int r = 0; r < MR; r++)
+                    simd::store(C + i + r * w + size_t(j + q) * ldc, c[r][q]);
+        }
+
+        // rows left over
+        if(i < m)
+        {
+            for(int q = j; q < j + NR; q++)
+                for(int l = 0; l < k; l++)
+                    hipsolver_kernel_axpy(m - i,
+                                          B[l + size_t(q) * ldb],
+                                          A + i + size_t(l) * lda,
+                                          C + i + size_t(q) * ldc);
+        }
+    }
+
+    // columns left over
+    for(; j < n; j++)
+        for(int l = 0; l < k; l++)
+            hipsolver_kernel_axpy(
+                m, B[l + size_t(j) * ldb], A + size_t(l) * lda, C + size_t(j) * ldc);
+}
+
+/******************** GETRF ********************/
+/* Unblocked LU factorization with partial pivoting of the m-by-n panel A,
+   with the interchanges applied to its n columns only. ipiv and info are
+   relative to the panel. */
+template <typename T>
+void hipsolver_kernel_getf2(int m, int n, T* A, int lda, int* ipiv, int* info)
+{
+    using S = decltype(std::real(T{}));
+
+    const S sfmin = std::numeric_limits<S>::min();
+
+    *info = 0;
+    for(int j = 0; j < std::min(m, n); j++)
+    {
+        T* Aj = A + size_t(j) * lda;
+
+        // first row with the largest |A(i, j)|
+        int p    = j;
+        S   amax = hipsolver_kernel_abs1(Aj[j]);
+        for(int i = j + 1; i < m; i++)
+        {
+            S a = hipsolver_kernel_abs1(Aj[i]);
+            if(a > amax)
+            {
+                p    = i;
+                amax = a;
+            }
+        }
+        ipiv[j] = p + 1;
+
+        // a zero pivot is reported and its column is left unscaled
+        if(Aj[p] != T(0))
+        {
+            if(p != j)
+            {
+                for(int k = 0; k < n; k++)
+                    std::swap(A[j + size_t(k) * lda], A[p + size_t(k) * lda]);
+            }
+
+            if(std::abs(Aj[j]) >= sfmin)
+            {
+                T inv = T(1) / Aj[j];
+                for(int i = j + 1; i < m; i++)
+                    Aj[i] *= inv;
+            }
+            else
+            {
+                for(int i = j + 1; i < m; i++)
+                    Aj[i] /= Aj[j];
+            }
+        }
+        else if(*info == 0)
+            *info = j + 1;
+
+        // rank-1 update of the trailing columns of the panel
+        for(int k = j + 1; k < n; k++)
+        {
+            T* Ak = A + size_t(k) * lda;
+            hipsolver_kernel_axpy(m - j - 1, Ak[j], Aj + j + 1, Ak + j + 1);
+        }
+    }
+}
+
+/* B = L^-1 * B, where L is the k-by-k unit lower triangular matrix and B is
+   k-by-n. The diagonal blocks of L are solved with axpy, and the rows below
+   them are updated with hipsolver_kernel_gemm. */
+template <typename T>
+void hipsolver_kernel_trsm(int k, int n, const T* L, int ldl, T* B, int ldb)
+{
+    const int kb = HIPSOLVER_GETRF_KERNEL_RECURSION_MIN;
+
+    for(int l0 = 0; l0 < k; l0 += kb)
+    {
+        int lb = std::min(kb, k - l0);
+        for(int c = 0; c < n; c++)
+        {
+            T* col = B + size_t(c) * ldb;
+            for(int l = l0; l < l0 + lb; l++)
+                hipsolver_kernel_axpy(
+                    l0 + lb - l - 1, col[l], L + l + 1 + size_t(l) * ldl, col + l + 1);
+        }
+
+        if(l0 + lb < k)
+            hipsolver_kernel_gemm(k - l0 - lb,
+                                  n,
+                                  lb,
+                                  L + l0 + lb + size_t(l0) * ldl,
+                                  ldl,
+                                  B + l0,
+                                  ldb,
+                                  B + l0 + lb,
+                                  ldb);
+    }
+}
+
+/* Recursive LU factorization with partial pivoting of the m-by-n panel A,
+   with the interchanges applied to its n columns only, as LAPACK getrf2.
+   Splitting the columns in halves turns most of the work on the panel into
+   calls to hipsolver_kernel_gemm. ipiv and info are relative to the panel. */
+template <typename T>
+void hipsolver_kernel_getrf2(int m, int n, T* A, int lda, int* ipiv, int* info)
+{
+    if(n <= HIPSOLVER_GETRF_KERNEL_RECURSION_MIN || m <= n)
+    {
+        hipsolver_kernel_getf2(m, n, A, lda, ipiv, info);
+        return;
+    }
+
+    int n1 = n / 2;
+    int n2 = n - n1;
+    T*  A12 = A + size_t(n1) * lda;
+
+    // left half
+    hipsolver_kernel_getrf2(m, n1, A, lda, ipiv, info);
+    hipsolver_kernel_laswp(n2, A12, lda, 0, n1, ipiv);
+
+    // U12 = L11^-1 * A12 and A22 = A22 - L21 * U12
+    hipsolver_kernel_trsm(n1, n2, A, lda, A12, lda);
+    hipsolver_kernel_gemm(m - n1, n2, n1, A + n1, lda, A12, lda, A12 + n1, lda);
+
+    // right half
+    int iinfo;
+    hipsolver_kernel_getrf2(m - n1, n2, A12 + n1, lda, ipiv + n1, &iinfo);
+    if(*info == 0 && iinfo > 0)
+        *info = n1 + iinfo;
+    for(int i = n1; i < n; i++)
+        ipiv[i] += n1;
+    hipsolver_kernel_laswp(n1, A, lda, n1, n, ipiv);
+}
+
+/* Blocked LU factorization with partial pivoting of the m-by-n matrix A, with
+   the same output as LAPACK getrf. */
+template <typename T>
+void hipsolver_kernel_getrf(int m, int n, T* A, int lda, int* ipiv, int* info)
+{
+    const int nb = HIPSOLVER_GETRF_KERNEL_BLOCKSIZE;
+
+    *info  = 0;
+    int mn = std::min(m, n);
+    for(int j = 0; j < mn; j += nb)
+    {
+        int jb  = std::min(nb, mn - j);
+        T*  Ajj = A + j + size_t(j) * lda;
+
+        int iinfo;
+        hipsolver_kernel_getrf2(m - j, jb, Ajj, lda, ipiv + j, &iinfo);
+        if(*info == 0 && iinfo > 0)
+            *info = j + iinfo;
+        for(int i = j; i < j + jb; i++)
+            ipiv[i] += j;
+
+        // apply the interchanges to the columns on both sides of the panel
+        hipsolver_kernel_laswp(j, A, lda, j, j + jb, ipiv);
+        int nr = n - j - jb;
+        if(nr > 0)
+        {
+            T* A12 = Ajj + size_t(jb) * lda;
+            hipsolver_kernel_laswp(nr, A + size_t(j + jb) * lda, lda, j, j + jb, ipiv);
+
+            // U12 = L11^-1 * A12 and A22 = A22 - L21 * U12
+            hipsolver_kernel_trsm(jb, nr, Ajj, lda, A12, lda);
+            if(m - j - jb > 0)
+                hipsolver_kernel_gemm(m - j - jb, nr, jb, Ajj + jb, lda, A12, lda, A12 + jb, lda);
+        }
+    }
+}
+
+/******************** GETRS ********************/
+/* Solves op(A) * X = B with the factors computed by hipsolver_kernel_getrf,
+   as LAPACK getrs. */
+template <typename T>
+void hipsolver_kernel_getrs(
+    char trans, int n, int nrhs, const T* A, int lda, const int* ipiv, T* B, int ldb)
+{
+    if(trans == 'N')
+    {
+        hipsolver_kernel_laswp(nrhs, B, ldb, 0, n, ipiv);
+        for(int c = 0; c < nrhs; c++)
+        {
+            T* b = B + size_t(c) * ldb;
+
+            // L * Y = B, with L unit lower triangular
+            for(int k = 0; k < n; k++)
+                hipsolver_kernel_axpy(n - k - 1, b[k], A + k + 1 + size_t(k) * lda, b + k + 1);
+
+            // U * X = Y
+            for(int k = n - 1; k >= 0; k--)
+            {
+                b[k] /= A[k + size_t(k) * lda];
+                hipsolver_kernel_axpy(k, b[k], A + size_t(k) * lda, b);
+            }
+        }
+    }
+    else
+    {
+        for(int c = 0; c < nrhs; c++)
+        {
+            T* b = B + size_t(c) * ldb;
+
+            // op(U) * Y = B
+            for(int k = 0; k < n; k++)
+            {
+                const T* Ak = A + size_t(k) * lda;
+                T        d  = trans == 'C' ? hipsolver_kernel_conj(Ak[k]) : Ak[k];
+                T        s  = trans == 'C' ? hipsolver_kernel_dot<true>(k, Ak, b)
+                                           : hipsolver_kernel_dot<false>(k, Ak, b);
+                b[k]        = (b[k] - s) / d;
+            }
+
+            // op(L) * X = Y, with L unit lower triangular
+            for(int k = n - 1; k >= 0; k--)
+            {
+                const T* Ak = A + k + 1 + size_t(k) * lda;
+                b[k] -= trans == 'C' ? hipsolver_kernel_dot<true>(n - k - 1, Ak, b + k + 1)
+                                     : hipsolver_kernel_dot<false>(n - k - 1, Ak, b + k + 1);
+            }
+        }
+
+        // the interchanges are undone in reverse order
+        for(int c = 0; c < nrhs; c++)
+        {
+            T* b = B + size_t(c) * ldb;
+            for(int i = n - 1; i >= 0; i--)
+            {
+                int p = ipiv[i] - 1;
+                if(p != i)
+                    std::swap(b[i], b[p]);
+            }
+        }
+    }
+}
@@ -0,0 +1,194 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+
+// the device pass of hipcc also defines the macros of the host architecture
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(__HIP_DEVICE_COMPILE__)
+#define HIPSOLVER_KERNEL_X86
+#include <immintrin.h>
+#endif
+
+/*
+ * ===========================================================================
+ *    Native kernels on the host, used by the host backend and by the host
+ *    engine of the rocSOLVER backend: getrf and getrs in getrf_kernel.hpp,
+ *    and potrf in potrf_kernel.hpp. Their code is compiled once for each
+ *    instruction set, in a namespace of its own and with the target of its
+ *    functions set by pragmas, so that the library runs on any CPU of its
+ *    architecture without -march=native: hipsolver_scalar_kernels for all
+ *    CPUs, and on x86 hipsolver_avx2_kernels for AVX2 with FMA and
+ *    hipsolver_avx512_kernels for AVX-512. The functions below call those of
+ *    the widest instruction set supported by the CPU, which is detected once
+ *    per process.
+ * ===========================================================================
+ */
+
+// largest m and n for which getrf and getrs use the native kernels instead of LAPACK
+#define HIPSOLVER_GETRF_KERNEL_MAX_SIZE 128
+
+// width of the panels of the native factorization
+#define HIPSOLVER_GETRF_KERNEL_BLOCKSIZE 32
+
+// width below which the panels are factorized, and the triangles solved, without recursion
+#define HIPSOLVER_GETRF_KERNEL_RECURSION_MIN 8
+
+/******************** HELPERS ********************/
+// |a| as used by LAPACK to choose the pivots, i.e. |re(a)| + |im(a)| for complex types
+template <typename T>
+inline T hipsolver_kernel_abs1(T a)
+{
+    return std::abs(a);
+}
+template <typename S>
+inline S hipsolver_kernel_abs1(std::complex<S> a)
+{
+    return std::abs(a.real()) + std::abs(a.imag());
+}
+
+template <typename T>
+inline T hipsolver_kernel_conj(T a)
+{
+    return a;
+}
+template <typename S>
+inline std::complex<S> hipsolver_kernel_conj(std::complex<S> a)
+{
+    return std::conj(a);
+}
+
+/******************** INSTRUCTION SETS ********************/
+enum hipsolver_kernel_isa
+{
+    hipsolver_kernel_isa_scalar,
+    hipsolver_kernel_isa_avx2,
+    hipsolver_kernel_isa_avx512,
+};
+
+// the widest instruction set of the kernels that the CPU supports
+inline hipsolver_kernel_isa hipsolver_kernel_isa_detect()
+{
+#ifdef HIPSOLVER_KERNEL_X86
+    __builtin_cpu_init();
+    bool avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    if(avx2 && __builtin_cpu_supports("avx512f"))
+        return hipsolver_kernel_isa_avx512;
+    if(avx2)
+        return hipsolver_kernel_isa_avx2;
+#endif
+    return hipsolver_kernel_isa_scalar;
+}
+
+inline hipsolver_kernel_isa hipsolver_kernel_isa_current()
+{
+    static const hipsolver_kernel_isa isa = hipsolver_kernel_isa_detect();
+    return isa;
+}
+
+/******************** KERNELS ********************/
+namespace hipsolver_scalar_kernels
+{
+#include "getrf_kernel.hpp"
+#include "potrf_kernel.hpp"
+}
+
+#ifdef HIPSOLVER_KERNEL_X86
+
+#define HIPSOLVER_KERNEL_AVX2
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2,fma"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#endif
+namespace hipsolver_avx2_kernels
+{
+#include "getrf_kernel.hpp"
+#include "potrf_kernel.hpp"
+}
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+#undef HIPSOLVER_KERNEL_AVX2
+
+#define HIPSOLVER_KERNEL_AVX512
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx512f,avx2,fma"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx2,fma")
+#endif
+namespace hipsolver_avx512_kernels
+{
+#include "getrf_kernel.hpp"
+#include "potrf_kernel.hpp"
+}
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+#undef HIPSOLVER_KERNEL_AVX512
+
+#endif
+
+/******************** DISPATCH ********************/
+template <typename T>
+void hipsolver_kernel_getrf(int m, int n, T* A, int lda, int* ipiv, int* info)
+{
+    switch(hipsolver_kernel_isa_current())
+    {
+#ifdef HIPSOLVER_KERNEL_X86
+    case hipsolver_kernel_isa_avx512:
+        return hipsolver_avx512_kernels::hipsolver_kernel_getrf(m, n, A, lda, ipiv, info);
+    case hipsolver_kernel_isa_avx2:
+        return hipsolver_avx2_kernels::hipsolver_kernel_getrf(m, n, A, lda, ipiv, info);
+#endif
+    default:
+        return hipsolver_scalar_kernels::hipsolver_kernel_getrf(m, n, A, lda, ipiv, info);
+    }
+}
+
+template <typename T>
+void hipsolver_kernel_getrs(
+    char trans, int n, int nrhs, const T* A, int lda, const int* ipiv, T* B, int ldb)
+{
+    switch(hipsolver_kernel_isa_current())
+    {
+#ifdef HIPSOLVER_KERNEL_X86
+    case hipsolver_kernel_isa_avx512:
+        return hipsolver_avx512_kernels::hipsolver_kernel_getrs(
+            trans, n, nrhs, A, lda, ipiv, B, ldb);
+    case hipsolver_kernel_isa_avx2:
+        return hipsolver_avx2_kernels::hipsolver_kernel_getrs(
+            trans, n, nrhs, A, lda, ipiv, B, ldb);
+#endif
+    default:
+        return hipsolver_scalar_kernels::hipsolver_kernel_getrs(
+            trans, n, nrhs, A, lda, ipiv, B, ldb);
+    }
+}
+
+template <typename T>
+void hipsolver_kernel_potrf(char uplo, int n, T* A, int lda, int* info)
+{
+    switch(hipsolver_kernel_isa_current())
+    {
+#ifdef HIPSOLVER_KERNEL_X86
+    case hipsolver_kernel_isa_avx512:
+        return hipsolver_avx512_kernels::hipsolver_kernel_potrf(uplo, n, A, lda, info);
+    case hipsolver_kernel_isa_avx2:
+        return hipsolver_avx2_kernels::hipsolver_kernel_potrf(uplo, n, A, lda, info);
+#endif
+    default:
+        return hipsolver_scalar_kernels::hipsolver_kernel_potrf(uplo, n, A, lda, info);
+    }
+}
@@ -0,0 +1,63 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/* Included by host_kernels.hpp once for each instruction set, after
+   getrf_kernel.hpp and inside the same namespace. */
+
+/******************** POTRF ********************/
+/* Unblocked Cholesky factorization of the n-by-n matrix A on the host, with
+   the same output as LAPACK potrf. It is meant for the small matrices of the
+   host engine, for which the whole matrix stays in the L1 cache. The upper
+   factor is computed a column at a time from the columns to its left, and
+   the lower factor a column at a time with a right-looking update, so that
+   the inner loops run down contiguous columns in both cases. */
+template <typename T>
+void hipsolver_kernel_potrf(char uplo, int n, T* A, int lda, int* info)
+{
+    using std::real;
+    using std::sqrt;
+
+    *info = 0;
+    for(int j = 0; j < n; j++)
+    {
+        T* Aj = A + size_t(j) * lda;
+
+        if(uplo == 'U')
+        {
+            // A(j, j:n) = A(j, j:n) - U(0:j, j)^H * U(0:j, j:n)
+            for(int k = j; k < n; k++)
+            {
+                T* Ak = A + size_t(k) * lda;
+                Ak[j] -= hipsolver_kernel_dot<true>(j, Aj, Ak);
+            }
+        }
+
+        auto d = real(Aj[j]);
+        if(!(d > 0))
+        {
+            *info = j + 1;
+            return;
+        }
+        d     = sqrt(d);
+        Aj[j] = d;
+
+        if(uplo == 'U')
+        {
+            for(int k = j + 1; k < n; k++)
+                A[j + size_t(k) * lda] /= d;
+        }
+        else
+        {
+            for(int i = j + 1; i < n; i++)
+                Aj[i] /= d;
+
+            // A(k:n, k) = A(k:n, k) - L(k:n, j) * conj(L(k, j))
+            for(int k = j + 1; k < n; k++)
+                hipsolver_kernel_axpy(n - k,
+                                      hipsolver_kernel_conj(Aj[k]),
+                                      Aj + k,
+                                      A + k + size_t(k) * lda);
+        }
+    }
+}
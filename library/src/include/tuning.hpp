@@ -0,0 +1,137 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "dispatch.hpp"
+#include "hipsolver.h"
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+/*
+ * ===========================================================================
+ *    Tuning files, as written by hipsolver-tune. A tuning file holds the
+ *    settings of a handle that depend on the system: the crossover
+ *    thresholds of HIPSOLVER_DISPATCH_MODE_AUTO and the size of the tiles
+ *    of the tiled factorizations. hipsolverCreate loads the file named by
+ *    the HIPSOLVER_TUNING_FILE environment variable, if any, and
+ *    hipsolverLoadTuningFile loads a file into an existing handle.
+ *
+ *    The file is text. Empty lines and lines starting with # are skipped.
+ *    The first line must be "hipsolver_tuning <version>", and each of the
+ *    other lines is one of
+ *        dispatch <routine> <precision> <n>
+ *        tile_blocksize <nb>
+ *    with the routine one of potrf, getrf and getrs, and the precision one
+ *    of s, d, c and z. Settings missing from the file keep their values.
+ *    Files of another version are rejected as a whole, as are files with an
+ *    unknown or invalid line.
+ * ===========================================================================
+ */
+
+#define HIPSOLVER_TUNING_VERSION 1
+
+// default size of the tiles; smaller matrices are factorized without tiling
+#define HIPSOLVER_TILE_BLOCKSIZE 512
+
+struct hipsolver_tuning
+{
+    hipsolver_dispatch_table dispatch;
+    int                      tile_blocksize = HIPSOLVER_TILE_BLOCKSIZE;
+};
+
+inline bool hipsolver_tuning_routine(const std::string& name, hipsolverDispatchRoutine_t* routine)
+{
+    static const char* names[HIPSOLVER_DISPATCH_ROUTINES] = {"potrf", "getrf", "getrs"};
+    for(int r = 0; r < HIPSOLVER_DISPATCH_ROUTINES; r++)
+    {
+        if(name == names[r])
+        {
+            *routine = hipsolverDispatchRoutine_t(HIPSOLVER_DISPATCH_POTRF + r);
+            return true;
+        }
+    }
+    return false;
+}
+
+inline bool hipsolver_tuning_precision(const std::string& name, hipsolverPrecision_t* precision)
+{
+    static const char* names[HIPSOLVER_DISPATCH_PRECISIONS] = {"s", "d", "c", "z"};
+    for(int p = 0; p < HIPSOLVER_DISPATCH_PRECISIONS; p++)
+    {
+        if(name == names[p])
+        {
+            *precision = hipsolverPrecision_t(HIPSOLVER_PRECISION_SINGLE + p);
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Reads the tuning file at path over tuning. tuning is only changed if the
+   whole file is valid. */
+inline hipsolverStatus_t hipsolver_read_tuning(const char* path, hipsolver_tuning* tuning)
+{
+    std::ifstream file(path);
+    if(!file)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_tuning result  = *tuning;
+    bool             version = false;
+    std::string      line;
+    while(std::getline(file, line))
+    {
+        std::istringstream words(line);
+        std::string        key;
+        if(!(words >> key) || key[0] == '#')
+            continue;
+
+        if(!version)
+        {
+            int v;
+            if(key != "hipsolver_tuning" || !(words >> v) || v != HIPSOLVER_TUNING_VERSION)
+                return HIPSOLVER_STATUS_INVALID_VALUE;
+            version = true;
+        }
+        else if(key == "dispatch")
+        {
+            std::string                r, p;
+            hipsolverDispatchRoutine_t routine;
+            hipsolverPrecision_t       precision;
+            int                        n;
+            if(!(words >> r >> p >> n) || !hipsolver_tuning_routine(r, &routine)
+               || !hipsolver_tuning_precision(p, &precision) || n < 0)
+                return HIPSOLVER_STATUS_INVALID_VALUE;
+            result.dispatch.at(routine, precision) = n;
+        }
+        else if(key == "tile_blocksize")
+        {
+            int nb;
+            if(!(words >> nb) || nb < 1)
+                return HIPSOLVER_STATUS_INVALID_VALUE;
+            result.tile_blocksize = nb;
+        }
+        else
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        // trailing words
+        std::string extra;
+        if(words >> extra && extra[0] != '#')
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+    }
+    if(!version)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *tuning = result;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// the tuning file named by HIPSOLVER_TUNING_FILE, or nullptr
+inline const char* hipsolver_tuning_file()
+{
+    const char* path = std::getenv("HIPSOLVER_TUNING_FILE");
+    return path && path[0] ? path : nullptr;
+}
@@ -217,758 +217,1467 @@ catch(...)
     return exception2hip_status();
 }
 
-/******************** ORGBR/UNGBR ********************/
-hipsolverStatus_t hipsolverSorgbr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverSideMode_t side,
-                                             int                 m,
-                                             int                 n,
-                                             int                 k,
-                                             float*              A,
-                                             int                 lda,
-                                             float*              tau,
-                                             int*                lwork)
+/******************** STREAM CAPTURE ********************/
+hipsolverStatus_t hipsolverSetCaptureMode(hipsolverHandle_t handle, hipsolverCaptureMode_t mode)
 try
 {
-    return cuda2hip_status(cusolverDnSorgbr_bufferSize(
-        (cusolverDnHandle_t)handle, hip2cuda_side(side), m, n, k, A, lda, tau, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDorgbr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverSideMode_t side,
-                                             int                 m,
-                                             int                 n,
-                                             int                 k,
-                                             double*             A,
-                                             int                 lda,
-                                             double*             tau,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverGetCaptureMode(hipsolverHandle_t handle, hipsolverCaptureMode_t* mode)
 try
 {
-    return cuda2hip_status(cusolverDnDorgbr_bufferSize(
-        (cusolverDnHandle_t)handle, hip2cuda_side(side), m, n, k, A, lda, tau, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCungbr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverSideMode_t side,
-                                             int                 m,
-                                             int                 n,
-                                             int                 k,
-                                             hipFloatComplex*    A,
-                                             int                 lda,
-                                             hipFloatComplex*    tau,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverReserveWorkspace(hipsolverHandle_t handle, size_t size)
 try
 {
-    return cuda2hip_status(cusolverDnCungbr_bufferSize((cusolverDnHandle_t)handle,
-                                                       hip2cuda_side(side),
-                                                       m,
-                                                       n,
-                                                       k,
-                                                       (cuComplex*)A,
-                                                       lda,
-                                                       (cuComplex*)tau,
-                                                       lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZungbr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverSideMode_t side,
-                                             int                 m,
-                                             int                 n,
-                                             int                 k,
-                                             hipDoubleComplex*   A,
-                                             int                 lda,
-                                             hipDoubleComplex*   tau,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverStartCaptureQuery(hipsolverHandle_t handle)
 try
 {
-    return cuda2hip_status(cusolverDnZungbr_bufferSize((cusolverDnHandle_t)handle,
-                                                       hip2cuda_side(side),
-                                                       m,
-                                                       n,
-                                                       k,
-                                                       (cuDoubleComplex*)A,
-                                                       lda,
-                                                       (cuDoubleComplex*)tau,
-                                                       lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSorgbr(hipsolverHandle_t   handle,
-                                  hipsolverSideMode_t side,
-                                  int                 m,
-                                  int                 n,
-                                  int                 k,
-                                  float*              A,
-                                  int                 lda,
-                                  float*              tau,
-                                  float*              work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverStopCaptureQuery(hipsolverHandle_t handle, int* capturable)
 try
 {
-    return cuda2hip_status(cusolverDnSorgbr((cusolverDnHandle_t)handle,
-                                            hip2cuda_side(side),
-                                            m,
-                                            n,
-                                            k,
-                                            A,
-                                            lda,
-                                            tau,
-                                            work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDorgbr(hipsolverHandle_t   handle,
-                                  hipsolverSideMode_t side,
-                                  int                 m,
-                                  int                 n,
-                                  int                 k,
-                                  double*             A,
-                                  int                 lda,
-                                  double*             tau,
-                                  double*             work,
-                                  int                 lwork,
-                                  int*                devInfo)
+/******************** WORKSPACE ALLOCATION ********************/
+hipsolverStatus_t hipsolverSetAllocMode(hipsolverHandle_t handle, hipsolverAllocMode_t mode)
 try
 {
-    return cuda2hip_status(cusolverDnDorgbr((cusolverDnHandle_t)handle,
-                                            hip2cuda_side(side),
-                                            m,
-                                            n,
-                                            k,
-                                            A,
-                                            lda,
-                                            tau,
-                                            work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCungbr(hipsolverHandle_t   handle,
-                                  hipsolverSideMode_t side,
-                                  int                 m,
-                                  int                 n,
-                                  int                 k,
-                                  hipFloatComplex*    A,
-                                  int                 lda,
-                                  hipFloatComplex*    tau,
-                                  hipFloatComplex*    work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverGetAllocMode(hipsolverHandle_t handle, hipsolverAllocMode_t* mode)
 try
 {
-    return cuda2hip_status(cusolverDnCungbr((cusolverDnHandle_t)handle,
-                                            hip2cuda_side(side),
-                                            m,
-                                            n,
-                                            k,
-                                            (cuComplex*)A,
-                                            lda,
-                                            (cuComplex*)tau,
-                                            (cuComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZungbr(hipsolverHandle_t   handle,
-                                  hipsolverSideMode_t side,
-                                  int                 m,
-                                  int                 n,
-                                  int                 k,
-                                  hipDoubleComplex*   A,
-                                  int                 lda,
-                                  hipDoubleComplex*   tau,
-                                  hipDoubleComplex*   work,
-                                  int                 lwork,
-                                  int*                devInfo)
+/******************** TILED FACTORIZATIONS ********************/
+hipsolverStatus_t hipsolverSetTileExecution(hipsolverHandle_t handle, int nstreams, int lookahead)
 try
 {
-    return cuda2hip_status(cusolverDnZungbr((cusolverDnHandle_t)handle,
-                                            hip2cuda_side(side),
-                                            m,
-                                            n,
-                                            k,
-                                            (cuDoubleComplex*)A,
-                                            lda,
-                                            (cuDoubleComplex*)tau,
-                                            (cuDoubleComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** ORGQR/UNGQR ********************/
-hipsolverStatus_t hipsolverSorgqr_bufferSize(
-    hipsolverHandle_t handle, int m, int n, int k, float* A, int lda, float* tau, int* lwork)
+hipsolverStatus_t hipsolverGetTileExecution(hipsolverHandle_t handle, int* nstreams, int* lookahead)
 try
 {
-    return cuda2hip_status(
-        cusolverDnSorgqr_bufferSize((cusolverDnHandle_t)handle, m, n, k, A, lda, tau, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDorgqr_bufferSize(
-    hipsolverHandle_t handle, int m, int n, int k, double* A, int lda, double* tau, int* lwork)
+hipsolverStatus_t hipsolverSetTileBlockSize(hipsolverHandle_t handle, int nb)
 try
 {
-    return cuda2hip_status(
-        cusolverDnDorgqr_bufferSize((cusolverDnHandle_t)handle, m, n, k, A, lda, tau, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCungqr_bufferSize(hipsolverHandle_t handle,
-                                             int               m,
-                                             int               n,
-                                             int               k,
-                                             hipFloatComplex*  A,
-                                             int               lda,
-                                             hipFloatComplex*  tau,
-                                             int*              lwork)
+hipsolverStatus_t hipsolverGetTileBlockSize(hipsolverHandle_t handle, int* nb)
 try
 {
-    return cuda2hip_status(cusolverDnCungqr_bufferSize(
-        (cusolverDnHandle_t)handle, m, n, k, (cuComplex*)A, lda, (cuComplex*)tau, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZungqr_bufferSize(hipsolverHandle_t handle,
-                                             int               m,
-                                             int               n,
-                                             int               k,
-                                             hipDoubleComplex* A,
-                                             int               lda,
-                                             hipDoubleComplex* tau,
-                                             int*              lwork)
+/******************** HOST THREAD POOL ********************/
+hipsolverStatus_t hipsolverSetHostThreadPool(hipsolverHandle_t       handle,
+                                             int                     nthreads,
+                                             hipsolverHostAffinity_t affinity)
 try
 {
-    return cuda2hip_status(cusolverDnZungqr_bufferSize((cusolverDnHandle_t)handle,
-                                                       m,
-                                                       n,
-                                                       k,
-                                                       (cuDoubleComplex*)A,
-                                                       lda,
-                                                       (cuDoubleComplex*)tau,
-                                                       lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSorgqr(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  int               k,
-                                  float*            A,
-                                  int               lda,
-                                  float*            tau,
-                                  float*            work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverGetHostThreadPool(hipsolverHandle_t        handle,
+                                             int*                     nthreads,
+                                             hipsolverHostAffinity_t* affinity)
 try
 {
-    return cuda2hip_status(
-        cusolverDnSorgqr((cusolverDnHandle_t)handle, m, n, k, A, lda, tau, work, lwork, devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDorgqr(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  int               k,
-                                  double*           A,
-                                  int               lda,
-                                  double*           tau,
-                                  double*           work,
-                                  int               lwork,
-                                  int*              devInfo)
+/******************** DISPATCH ********************/
+hipsolverStatus_t hipsolverSetDispatchMode(hipsolverHandle_t handle, hipsolverDispatchMode_t mode)
 try
 {
-    return cuda2hip_status(
-        cusolverDnDorgqr((cusolverDnHandle_t)handle, m, n, k, A, lda, tau, work, lwork, devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCungqr(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  int               k,
-                                  hipFloatComplex*  A,
-                                  int               lda,
-                                  hipFloatComplex*  tau,
-                                  hipFloatComplex*  work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverGetDispatchMode(hipsolverHandle_t handle, hipsolverDispatchMode_t* mode)
 try
 {
-    return cuda2hip_status(cusolverDnCungqr((cusolverDnHandle_t)handle,
-                                            m,
-                                            n,
-                                            k,
-                                            (cuComplex*)A,
-                                            lda,
-                                            (cuComplex*)tau,
-                                            (cuComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZungqr(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  int               k,
-                                  hipDoubleComplex* A,
-                                  int               lda,
-                                  hipDoubleComplex* tau,
-                                  hipDoubleComplex* work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverSetDispatchThreshold(hipsolverHandle_t          handle,
+                                                hipsolverDispatchRoutine_t routine,
+                                                hipsolverPrecision_t       precision,
+                                                int                        n)
 try
 {
-    return cuda2hip_status(cusolverDnZungqr((cusolverDnHandle_t)handle,
-                                            m,
-                                            n,
-                                            k,
-                                            (cuDoubleComplex*)A,
-                                            lda,
-                                            (cuDoubleComplex*)tau,
-                                            (cuDoubleComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** ORGTR/UNGTR ********************/
-hipsolverStatus_t hipsolverSorgtr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             float*              A,
-                                             int                 lda,
-                                             float*              tau,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverGetDispatchThreshold(hipsolverHandle_t          handle,
+                                                hipsolverDispatchRoutine_t routine,
+                                                hipsolverPrecision_t       precision,
+                                                int*                       n)
 try
 {
-    return cuda2hip_status(cusolverDnSorgtr_bufferSize(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, tau, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDorgtr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             double*             A,
-                                             int                 lda,
-                                             double*             tau,
-                                             int*                lwork)
+/******************** TUNING ********************/
+hipsolverStatus_t hipsolverLoadTuningFile(hipsolverHandle_t handle, const char* path)
 try
 {
-    return cuda2hip_status(cusolverDnDorgtr_bufferSize(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, tau, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCungtr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             hipFloatComplex*    A,
-                                             int                 lda,
-                                             hipFloatComplex*    tau,
-                                             int*                lwork)
+/******************** BATCH QUEUE ********************/
+hipsolverStatus_t
+    hipsolverCreateBatchQueue(hipsolverBatchQueue_t* queue, int maxBatch, int windowUs)
 try
 {
-    return cuda2hip_status(cusolverDnCungtr_bufferSize((cusolverDnHandle_t)handle,
-                                                       hip2cuda_fill(uplo),
-                                                       n,
-                                                       (cuComplex*)A,
-                                                       lda,
-                                                       (cuComplex*)tau,
-                                                       lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZungtr_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             hipDoubleComplex*   A,
-                                             int                 lda,
-                                             hipDoubleComplex*   tau,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverDestroyBatchQueue(hipsolverBatchQueue_t queue)
 try
 {
-    return cuda2hip_status(cusolverDnZungtr_bufferSize((cusolverDnHandle_t)handle,
-                                                       hip2cuda_fill(uplo),
-                                                       n,
-                                                       (cuDoubleComplex*)A,
-                                                       lda,
-                                                       (cuDoubleComplex*)tau,
-                                                       lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSorgtr(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  float*              A,
-                                  int                 lda,
-                                  float*              tau,
-                                  float*              work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverBatchQueueFlush(hipsolverBatchQueue_t queue)
 try
 {
-    return cuda2hip_status(cusolverDnSorgtr(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, tau, work, lwork, devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDorgtr(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  double*             A,
-                                  int                 lda,
-                                  double*             tau,
-                                  double*             work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverBatchRequestQuery(hipsolverBatchRequest_t request, int* done)
 try
 {
-    return cuda2hip_status(cusolverDnDorgtr(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, tau, work, lwork, devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCungtr(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipFloatComplex*    A,
-                                  int                 lda,
-                                  hipFloatComplex*    tau,
-                                  hipFloatComplex*    work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverBatchRequestWait(hipsolverBatchRequest_t request, int* info)
 try
 {
-    return cuda2hip_status(cusolverDnCungtr((cusolverDnHandle_t)handle,
-                                            hip2cuda_fill(uplo),
-                                            n,
-                                            (cuComplex*)A,
-                                            lda,
-                                            (cuComplex*)tau,
-                                            (cuComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZungtr(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipDoubleComplex*   A,
-                                  int                 lda,
-                                  hipDoubleComplex*   tau,
-                                  hipDoubleComplex*   work,
-                                  int                 lwork,
-                                  int*                devInfo)
+/******************** COMPLETION ********************/
+hipsolverStatus_t hipsolverCreateCompletion(hipsolverCompletion_t* completion)
 try
 {
-    return cuda2hip_status(cusolverDnZungtr((cusolverDnHandle_t)handle,
-                                            hip2cuda_fill(uplo),
-                                            n,
-                                            (cuDoubleComplex*)A,
-                                            lda,
-                                            (cuDoubleComplex*)tau,
-                                            (cuDoubleComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** ORMQR/UNMQR ********************/
-hipsolverStatus_t hipsolverSormqr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             int                  k,
-                                             float*               A,
-                                             int                  lda,
-                                             float*               tau,
-                                             float*               C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverDestroyCompletion(hipsolverCompletion_t completion)
 try
 {
-    return cuda2hip_status(cusolverDnSormqr_bufferSize((cusolverDnHandle_t)handle,
-                                                       hip2cuda_side(side),
-                                                       hip2cuda_operation(trans),
-                                                       m,
-                                                       n,
-                                                       k,
-                                                       A,
-                                                       lda,
-                                                       tau,
-                                                       C,
-                                                       ldc,
-                                                       lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDormqr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             int                  k,
-                                             double*              A,
-                                             int                  lda,
-                                             double*              tau,
-                                             double*              C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverSetCompletionCallback(hipsolverCompletion_t         completion,
+                                                 hipsolverCompletionCallback_t callback,
+                                                 void*                         userData)
 try
 {
-    return cuda2hip_status(cusolverDnDormqr_bufferSize((cusolverDnHandle_t)handle,
-                                                       hip2cuda_side(side),
-                                                       hip2cuda_operation(trans),
-                                                       m,
-                                                       n,
-                                                       k,
-                                                       A,
-                                                       lda,
-                                                       tau,
-                                                       C,
-                                                       ldc,
-                                                       lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCunmqr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             int                  k,
-                                             hipFloatComplex*     A,
-                                             int                  lda,
-                                             hipFloatComplex*     tau,
-                                             hipFloatComplex*     C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverRecordCompletion(hipsolverHandle_t     handle,
+                                            const int*            devInfo,
+                                            int                   count,
+                                            hipsolverCompletion_t completion)
 try
 {
-    return cuda2hip_status(cusolverDnCunmqr_bufferSize((cusolverDnHandle_t)handle,
-                                                       hip2cuda_side(side),
-                                                       hip2cuda_operation(trans),
-                                                       m,
-                                                       n,
-                                                       k,
-                                                       (cuComplex*)A,
-                                                       lda,
-                                                       (cuComplex*)tau,
-                                                       (cuComplex*)C,
-                                                       ldc,
-                                                       lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZunmqr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             int                  k,
-                                             hipDoubleComplex*    A,
-                                             int                  lda,
-                                             hipDoubleComplex*    tau,
-                                             hipDoubleComplex*    C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverQueryCompletion(hipsolverCompletion_t completion, int* done, int* info)
 try
 {
-    return cuda2hip_status(cusolverDnZunmqr_bufferSize((cusolverDnHandle_t)handle,
-                                                       hip2cuda_side(side),
-                                                       hip2cuda_operation(trans),
-                                                       m,
-                                                       n,
-                                                       k,
-                                                       (cuDoubleComplex*)A,
-                                                       lda,
-                                                       (cuDoubleComplex*)tau,
-                                                       (cuDoubleComplex*)C,
-                                                       ldc,
-                                                       lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSormqr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  int                  k,
-                                  float*               A,
-                                  int                  lda,
-                                  float*               tau,
-                                  float*               C,
-                                  int                  ldc,
-                                  float*               work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverWaitCompletion(hipsolverCompletion_t completion, int* info)
 try
 {
-    return cuda2hip_status(cusolverDnSormqr((cusolverDnHandle_t)handle,
-                                            hip2cuda_side(side),
-                                            hip2cuda_operation(trans),
-                                            m,
-                                            n,
-                                            k,
-                                            A,
-                                            lda,
-                                            tau,
-                                            C,
-                                            ldc,
-                                            work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDormqr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  int                  k,
-                                  double*              A,
-                                  int                  lda,
-                                  double*              tau,
-                                  double*              C,
-                                  int                  ldc,
-                                  double*              work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+/******************** DEFERRED ERRORS ********************/
+hipsolverStatus_t hipsolverSetErrorMode(hipsolverHandle_t handle, hipsolverErrorMode_t mode)
 try
 {
-    return cuda2hip_status(cusolverDnDormqr((cusolverDnHandle_t)handle,
-                                            hip2cuda_side(side),
-                                            hip2cuda_operation(trans),
-                                            m,
-                                            n,
-                                            k,
-                                            A,
-                                            lda,
-                                            tau,
-                                            C,
-                                            ldc,
-                                            work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCunmqr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  int                  k,
-                                  hipFloatComplex*     A,
-                                  int                  lda,
+hipsolverStatus_t hipsolverGetErrorMode(hipsolverHandle_t handle, hipsolverErrorMode_t* mode)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetErrorState(hipsolverHandle_t handle, int* state)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverResetErrorState(hipsolverHandle_t handle)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** MULTI-DEVICE ********************/
+hipsolverStatus_t hipsolverMgCreate(hipsolverMgHandle_t* handle)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgDestroy(hipsolverMgHandle_t handle)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t
+    hipsolverMgDeviceSelect(hipsolverMgHandle_t handle, int nbDevices, const int deviceId[])
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgCreateDeviceGrid(hipsolverMgGrid_t*       grid,
+                                              int                      numRowDevices,
+                                              int                      numColDevices,
+                                              const int                deviceId[],
+                                              hipsolverMgGridMapping_t mapping)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgDestroyGrid(hipsolverMgGrid_t grid)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgCreateMatrixDesc(hipsolverMgMatrixDesc_t* desc,
+                                              int                      numRows,
+                                              int                      numCols,
+                                              int                      rowBlockSize,
+                                              int                      colBlockSize,
+                                              hipsolverMgGrid_t        grid)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgDestroyMatrixDesc(hipsolverMgMatrixDesc_t desc)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** ORGBR/UNGBR ********************/
+hipsolverStatus_t hipsolverSorgbr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              tau,
+                                             int*                lwork)
+try
+{
+    return cuda2hip_status(cusolverDnSorgbr_bufferSize(
+        (cusolverDnHandle_t)handle, hip2cuda_side(side), m, n, k, A, lda, tau, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDorgbr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             tau,
+                                             int*                lwork)
+try
+{
+    return cuda2hip_status(cusolverDnDorgbr_bufferSize(
+        (cusolverDnHandle_t)handle, hip2cuda_side(side), m, n, k, A, lda, tau, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungbr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             hipFloatComplex*    tau,
+                                             int*                lwork)
+try
+{
+    return cuda2hip_status(cusolverDnCungbr_bufferSize((cusolverDnHandle_t)handle,
+                                                       hip2cuda_side(side),
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       (cuComplex*)A,
+                                                       lda,
+                                                       (cuComplex*)tau,
+                                                       lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungbr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             hipDoubleComplex*   tau,
+                                             int*                lwork)
+try
+{
+    return cuda2hip_status(cusolverDnZungbr_bufferSize((cusolverDnHandle_t)handle,
+                                                       hip2cuda_side(side),
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       (cuDoubleComplex*)tau,
+                                                       lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSorgbr(hipsolverHandle_t   handle,
+                                  hipsolverSideMode_t side,
+                                  int                 m,
+                                  int                 n,
+                                  int                 k,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              tau,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnSorgbr((cusolverDnHandle_t)handle,
+                                            hip2cuda_side(side),
+                                            m,
+                                            n,
+                                            k,
+                                            A,
+                                            lda,
+                                            tau,
+                                            work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDorgbr(hipsolverHandle_t   handle,
+                                  hipsolverSideMode_t side,
+                                  int                 m,
+                                  int                 n,
+                                  int                 k,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             tau,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnDorgbr((cusolverDnHandle_t)handle,
+                                            hip2cuda_side(side),
+                                            m,
+                                            n,
+                                            k,
+                                            A,
+                                            lda,
+                                            tau,
+                                            work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungbr(hipsolverHandle_t   handle,
+                                  hipsolverSideMode_t side,
+                                  int                 m,
+                                  int                 n,
+                                  int                 k,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    tau,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnCungbr((cusolverDnHandle_t)handle,
+                                            hip2cuda_side(side),
+                                            m,
+                                            n,
+                                            k,
+                                            (cuComplex*)A,
+                                            lda,
+                                            (cuComplex*)tau,
+                                            (cuComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungbr(hipsolverHandle_t   handle,
+                                  hipsolverSideMode_t side,
+                                  int                 m,
+                                  int                 n,
+                                  int                 k,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   tau,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnZungbr((cusolverDnHandle_t)handle,
+                                            hip2cuda_side(side),
+                                            m,
+                                            n,
+                                            k,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            (cuDoubleComplex*)tau,
+                                            (cuDoubleComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** ORGQR/UNGQR ********************/
+hipsolverStatus_t hipsolverSorgqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, int k, float* A, int lda, float* tau, int* lwork)
+try
+{
+    return cuda2hip_status(
+        cusolverDnSorgqr_bufferSize((cusolverDnHandle_t)handle, m, n, k, A, lda, tau, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDorgqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, int k, double* A, int lda, double* tau, int* lwork)
+try
+{
+    return cuda2hip_status(
+        cusolverDnDorgqr_bufferSize((cusolverDnHandle_t)handle, m, n, k, A, lda, tau, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungqr_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               k,
+                                             hipFloatComplex*  A,
+                                             int               lda,
+                                             hipFloatComplex*  tau,
+                                             int*              lwork)
+try
+{
+    return cuda2hip_status(cusolverDnCungqr_bufferSize(
+        (cusolverDnHandle_t)handle, m, n, k, (cuComplex*)A, lda, (cuComplex*)tau, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungqr_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               k,
+                                             hipDoubleComplex* A,
+                                             int               lda,
+                                             hipDoubleComplex* tau,
+                                             int*              lwork)
+try
+{
+    return cuda2hip_status(cusolverDnZungqr_bufferSize((cusolverDnHandle_t)handle,
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       (cuDoubleComplex*)tau,
+                                                       lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSorgqr(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  float*            A,
+                                  int               lda,
+                                  float*            tau,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(
+        cusolverDnSorgqr((cusolverDnHandle_t)handle, m, n, k, A, lda, tau, work, lwork, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDorgqr(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  double*           A,
+                                  int               lda,
+                                  double*           tau,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(
+        cusolverDnDorgqr((cusolverDnHandle_t)handle, m, n, k, A, lda, tau, work, lwork, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungqr(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  hipFloatComplex*  tau,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnCungqr((cusolverDnHandle_t)handle,
+                                            m,
+                                            n,
+                                            k,
+                                            (cuComplex*)A,
+                                            lda,
+                                            (cuComplex*)tau,
+                                            (cuComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungqr(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  hipDoubleComplex* tau,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnZungqr((cusolverDnHandle_t)handle,
+                                            m,
+                                            n,
+                                            k,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            (cuDoubleComplex*)tau,
+                                            (cuDoubleComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** ORGTR/UNGTR ********************/
+hipsolverStatus_t hipsolverSorgtr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              tau,
+                                             int*                lwork)
+try
+{
+    return cuda2hip_status(cusolverDnSorgtr_bufferSize(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, tau, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDorgtr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             tau,
+                                             int*                lwork)
+try
+{
+    return cuda2hip_status(cusolverDnDorgtr_bufferSize(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, tau, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungtr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             hipFloatComplex*    tau,
+                                             int*                lwork)
+try
+{
+    return cuda2hip_status(cusolverDnCungtr_bufferSize((cusolverDnHandle_t)handle,
+                                                       hip2cuda_fill(uplo),
+                                                       n,
+                                                       (cuComplex*)A,
+                                                       lda,
+                                                       (cuComplex*)tau,
+                                                       lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungtr_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             hipDoubleComplex*   tau,
+                                             int*                lwork)
+try
+{
+    return cuda2hip_status(cusolverDnZungtr_bufferSize((cusolverDnHandle_t)handle,
+                                                       hip2cuda_fill(uplo),
+                                                       n,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       (cuDoubleComplex*)tau,
+                                                       lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSorgtr(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              tau,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnSorgtr(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, tau, work, lwork, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDorgtr(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             tau,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnDorgtr(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, tau, work, lwork, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCungtr(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    tau,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnCungtr((cusolverDnHandle_t)handle,
+                                            hip2cuda_fill(uplo),
+                                            n,
+                                            (cuComplex*)A,
+                                            lda,
+                                            (cuComplex*)tau,
+                                            (cuComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZungtr(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   tau,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnZungtr((cusolverDnHandle_t)handle,
+                                            hip2cuda_fill(uplo),
+                                            n,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            (cuDoubleComplex*)tau,
+                                            (cuDoubleComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** ORMQR/UNMQR ********************/
+hipsolverStatus_t hipsolverSormqr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             float*               A,
+                                             int                  lda,
+                                             float*               tau,
+                                             float*               C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    return cuda2hip_status(cusolverDnSormqr_bufferSize((cusolverDnHandle_t)handle,
+                                                       hip2cuda_side(side),
+                                                       hip2cuda_operation(trans),
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       A,
+                                                       lda,
+                                                       tau,
+                                                       C,
+                                                       ldc,
+                                                       lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDormqr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             double*              A,
+                                             int                  lda,
+                                             double*              tau,
+                                             double*              C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    return cuda2hip_status(cusolverDnDormqr_bufferSize((cusolverDnHandle_t)handle,
+                                                       hip2cuda_side(side),
+                                                       hip2cuda_operation(trans),
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       A,
+                                                       lda,
+                                                       tau,
+                                                       C,
+                                                       ldc,
+                                                       lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCunmqr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             hipFloatComplex*     tau,
+                                             hipFloatComplex*     C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    return cuda2hip_status(cusolverDnCunmqr_bufferSize((cusolverDnHandle_t)handle,
+                                                       hip2cuda_side(side),
+                                                       hip2cuda_operation(trans),
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       (cuComplex*)A,
+                                                       lda,
+                                                       (cuComplex*)tau,
+                                                       (cuComplex*)C,
+                                                       ldc,
+                                                       lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZunmqr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             hipDoubleComplex*    tau,
+                                             hipDoubleComplex*    C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    return cuda2hip_status(cusolverDnZunmqr_bufferSize((cusolverDnHandle_t)handle,
+                                                       hip2cuda_side(side),
+                                                       hip2cuda_operation(trans),
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       (cuDoubleComplex*)tau,
+                                                       (cuDoubleComplex*)C,
+                                                       ldc,
+                                                       lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSormqr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  int                  k,
+                                  float*               A,
+                                  int                  lda,
+                                  float*               tau,
+                                  float*               C,
+                                  int                  ldc,
+                                  float*               work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnSormqr((cusolverDnHandle_t)handle,
+                                            hip2cuda_side(side),
+                                            hip2cuda_operation(trans),
+                                            m,
+                                            n,
+                                            k,
+                                            A,
+                                            lda,
+                                            tau,
+                                            C,
+                                            ldc,
+                                            work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDormqr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  int                  k,
+                                  double*              A,
+                                  int                  lda,
+                                  double*              tau,
+                                  double*              C,
+                                  int                  ldc,
+                                  double*              work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnDormqr((cusolverDnHandle_t)handle,
+                                            hip2cuda_side(side),
+                                            hip2cuda_operation(trans),
+                                            m,
+                                            n,
+                                            k,
+                                            A,
+                                            lda,
+                                            tau,
+                                            C,
+                                            ldc,
+                                            work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCunmqr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  int                  k,
+                                  hipFloatComplex*     A,
+                                  int                  lda,
+                                  hipFloatComplex*     tau,
+                                  hipFloatComplex*     C,
+                                  int                  ldc,
+                                  hipFloatComplex*     work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnCunmqr((cusolverDnHandle_t)handle,
+                                            hip2cuda_side(side),
+                                            hip2cuda_operation(trans),
+                                            m,
+                                            n,
+                                            k,
+                                            (cuComplex*)A,
+                                            lda,
+                                            (cuComplex*)tau,
+                                            (cuComplex*)C,
+                                            ldc,
+                                            (cuComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZunmqr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  int                  k,
+                                  hipDoubleComplex*    A,
+                                  int                  lda,
+                                  hipDoubleComplex*    tau,
+                                  hipDoubleComplex*    C,
+                                  int                  ldc,
+                                  hipDoubleComplex*    work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnZunmqr((cusolverDnHandle_t)handle,
+                                            hip2cuda_side(side),
+                                            hip2cuda_operation(trans),
+                                            m,
+                                            n,
+                                            k,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            (cuDoubleComplex*)tau,
+                                            (cuDoubleComplex*)C,
+                                            ldc,
+                                            (cuDoubleComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** ORMTR/UNMTR ********************/
+hipsolverStatus_t hipsolverSormtr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverFillMode_t  uplo,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             float*               A,
+                                             int                  lda,
+                                             float*               tau,
+                                             float*               C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    return cuda2hip_status(cusolverDnSormtr_bufferSize((cusolverDnHandle_t)handle,
+                                                       hip2cuda_side(side),
+                                                       hip2cuda_fill(uplo),
+                                                       hip2cuda_operation(trans),
+                                                       m,
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       tau,
+                                                       C,
+                                                       ldc,
+                                                       lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDormtr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverFillMode_t  uplo,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             double*              A,
+                                             int                  lda,
+                                             double*              tau,
+                                             double*              C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    return cuda2hip_status(cusolverDnDormtr_bufferSize((cusolverDnHandle_t)handle,
+                                                       hip2cuda_side(side),
+                                                       hip2cuda_fill(uplo),
+                                                       hip2cuda_operation(trans),
+                                                       m,
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       tau,
+                                                       C,
+                                                       ldc,
+                                                       lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCunmtr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverFillMode_t  uplo,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             hipFloatComplex*     tau,
+                                             hipFloatComplex*     C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    return cuda2hip_status(cusolverDnCunmtr_bufferSize((cusolverDnHandle_t)handle,
+                                                       hip2cuda_side(side),
+                                                       hip2cuda_fill(uplo),
+                                                       hip2cuda_operation(trans),
+                                                       m,
+                                                       n,
+                                                       (cuComplex*)A,
+                                                       lda,
+                                                       (cuComplex*)tau,
+                                                       (cuComplex*)C,
+                                                       ldc,
+                                                       lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZunmtr_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverFillMode_t  uplo,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             hipDoubleComplex*    tau,
+                                             hipDoubleComplex*    C,
+                                             int                  ldc,
+                                             int*                 lwork)
+try
+{
+    return cuda2hip_status(cusolverDnZunmtr_bufferSize((cusolverDnHandle_t)handle,
+                                                       hip2cuda_side(side),
+                                                       hip2cuda_fill(uplo),
+                                                       hip2cuda_operation(trans),
+                                                       m,
+                                                       n,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       (cuDoubleComplex*)tau,
+                                                       (cuDoubleComplex*)C,
+                                                       ldc,
+                                                       lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSormtr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverFillMode_t  uplo,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  float*               A,
+                                  int                  lda,
+                                  float*               tau,
+                                  float*               C,
+                                  int                  ldc,
+                                  float*               work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnSormtr((cusolverDnHandle_t)handle,
+                                            hip2cuda_side(side),
+                                            hip2cuda_fill(uplo),
+                                            hip2cuda_operation(trans),
+                                            m,
+                                            n,
+                                            A,
+                                            lda,
+                                            tau,
+                                            C,
+                                            ldc,
+                                            work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDormtr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverFillMode_t  uplo,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  double*              A,
+                                  int                  lda,
+                                  double*              tau,
+                                  double*              C,
+                                  int                  ldc,
+                                  double*              work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnDormtr((cusolverDnHandle_t)handle,
+                                            hip2cuda_side(side),
+                                            hip2cuda_fill(uplo),
+                                            hip2cuda_operation(trans),
+                                            m,
+                                            n,
+                                            A,
+                                            lda,
+                                            tau,
+                                            C,
+                                            ldc,
+                                            work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCunmtr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverFillMode_t  uplo,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  hipFloatComplex*     A,
+                                  int                  lda,
                                   hipFloatComplex*     tau,
                                   hipFloatComplex*     C,
                                   int                  ldc,
@@ -977,1154 +1686,3053 @@ hipsolverStatus_t hipsolverCunmqr(hipsolverHandle_t    handle,
                                   int*                 devInfo)
 try
 {
-    return cuda2hip_status(cusolverDnCunmqr((cusolverDnHandle_t)handle,
-                                            hip2cuda_side(side),
-                                            hip2cuda_operation(trans),
-                                            m,
-                                            n,
-                                            k,
-                                            (cuComplex*)A,
-                                            lda,
-                                            (cuComplex*)tau,
-                                            (cuComplex*)C,
-                                            ldc,
-                                            (cuComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return cuda2hip_status(cusolverDnCunmtr((cusolverDnHandle_t)handle,
+                                            hip2cuda_side(side),
+                                            hip2cuda_fill(uplo),
+                                            hip2cuda_operation(trans),
+                                            m,
+                                            n,
+                                            (cuComplex*)A,
+                                            lda,
+                                            (cuComplex*)tau,
+                                            (cuComplex*)C,
+                                            ldc,
+                                            (cuComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZunmtr(hipsolverHandle_t    handle,
+                                  hipsolverSideMode_t  side,
+                                  hipsolverFillMode_t  uplo,
+                                  hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  hipDoubleComplex*    A,
+                                  int                  lda,
+                                  hipDoubleComplex*    tau,
+                                  hipDoubleComplex*    C,
+                                  int                  ldc,
+                                  hipDoubleComplex*    work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnZunmtr((cusolverDnHandle_t)handle,
+                                            hip2cuda_side(side),
+                                            hip2cuda_fill(uplo),
+                                            hip2cuda_operation(trans),
+                                            m,
+                                            n,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            (cuDoubleComplex*)tau,
+                                            (cuDoubleComplex*)C,
+                                            ldc,
+                                            (cuDoubleComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** CHOLQR2 ********************/
+hipsolverStatus_t hipsolverScholqr2_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, float* R, int ldr, int* lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDcholqr2_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, double* R, int ldr, int* lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCcholqr2_bufferSize(hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               hipFloatComplex*  A,
+                                               int               lda,
+                                               hipFloatComplex*  R,
+                                               int               ldr,
+                                               int*              lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZcholqr2_bufferSize(hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               hipDoubleComplex* A,
+                                               int               lda,
+                                               hipDoubleComplex* R,
+                                               int               ldr,
+                                               int*              lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverScholqr2(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    float*            A,
+                                    int               lda,
+                                    float*            R,
+                                    int               ldr,
+                                    float*            work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDcholqr2(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    double*           A,
+                                    int               lda,
+                                    double*           R,
+                                    int               ldr,
+                                    double*           work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCcholqr2(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    hipFloatComplex*  A,
+                                    int               lda,
+                                    hipFloatComplex*  R,
+                                    int               ldr,
+                                    hipFloatComplex*  work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZcholqr2(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    hipDoubleComplex* A,
+                                    int               lda,
+                                    hipDoubleComplex* R,
+                                    int               ldr,
+                                    hipDoubleComplex* work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** CHOLQR3 ********************/
+hipsolverStatus_t hipsolverScholqr3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, float* R, int ldr, int* lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDcholqr3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, double* R, int ldr, int* lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCcholqr3_bufferSize(hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               hipFloatComplex*  A,
+                                               int               lda,
+                                               hipFloatComplex*  R,
+                                               int               ldr,
+                                               int*              lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZcholqr3_bufferSize(hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               hipDoubleComplex* A,
+                                               int               lda,
+                                               hipDoubleComplex* R,
+                                               int               ldr,
+                                               int*              lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverScholqr3(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    float*            A,
+                                    int               lda,
+                                    float*            R,
+                                    int               ldr,
+                                    float*            work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDcholqr3(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    double*           A,
+                                    int               lda,
+                                    double*           R,
+                                    int               ldr,
+                                    double*           work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCcholqr3(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    hipFloatComplex*  A,
+                                    int               lda,
+                                    hipFloatComplex*  R,
+                                    int               ldr,
+                                    hipFloatComplex*  work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZcholqr3(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    hipDoubleComplex* A,
+                                    int               lda,
+                                    hipDoubleComplex* R,
+                                    int               ldr,
+                                    hipDoubleComplex* work,
+                                    int               lwork,
+                                    int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GEBRD ********************/
+hipsolverStatus_t hipsolverSgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnSgebrd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnDgebrd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnCgebrd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnZgebrd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgebrd(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  float*            D,
+                                  float*            E,
+                                  float*            tauq,
+                                  float*            taup,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnSgebrd(
+        (cusolverDnHandle_t)handle, m, n, A, lda, D, E, tauq, taup, work, lwork, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgebrd(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  double*           D,
+                                  double*           E,
+                                  double*           tauq,
+                                  double*           taup,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnDgebrd(
+        (cusolverDnHandle_t)handle, m, n, A, lda, D, E, tauq, taup, work, lwork, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgebrd(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  float*            D,
+                                  float*            E,
+                                  hipFloatComplex*  tauq,
+                                  hipFloatComplex*  taup,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnCgebrd((cusolverDnHandle_t)handle,
+                                            m,
+                                            n,
+                                            (cuComplex*)A,
+                                            lda,
+                                            D,
+                                            E,
+                                            (cuComplex*)tauq,
+                                            (cuComplex*)taup,
+                                            (cuComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgebrd(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  double*           D,
+                                  double*           E,
+                                  hipDoubleComplex* tauq,
+                                  hipDoubleComplex* taup,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnZgebrd((cusolverDnHandle_t)handle,
+                                            m,
+                                            n,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            D,
+                                            E,
+                                            (cuDoubleComplex*)tauq,
+                                            (cuDoubleComplex*)taup,
+                                            (cuDoubleComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GELS ********************/
+hipsolverStatus_t hipsolverSSgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             float*            A,
+                                             int               lda,
+                                             float*            B,
+                                             int               ldb,
+                                             float*            X,
+                                             int               ldx,
+                                             size_t*           lwork)
+try
+{
+    return cuda2hip_status(cusolverDnSSgels_bufferSize(
+        (cusolverDnHandle_t)handle, m, n, nrhs, A, lda, B, ldb, X, ldx, nullptr, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDDgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             double*           A,
+                                             int               lda,
+                                             double*           B,
+                                             int               ldb,
+                                             double*           X,
+                                             int               ldx,
+                                             size_t*           lwork)
+try
+{
+    return cuda2hip_status(cusolverDnDDgels_bufferSize(
+        (cusolverDnHandle_t)handle, m, n, nrhs, A, lda, B, ldb, X, ldx, nullptr, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCCgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             hipFloatComplex*  A,
+                                             int               lda,
+                                             hipFloatComplex*  B,
+                                             int               ldb,
+                                             hipFloatComplex*  X,
+                                             int               ldx,
+                                             size_t*           lwork)
+try
+{
+    return cuda2hip_status(cusolverDnCCgels_bufferSize((cusolverDnHandle_t)handle,
+                                                       m,
+                                                       n,
+                                                       nrhs,
+                                                       (cuComplex*)A,
+                                                       lda,
+                                                       (cuComplex*)B,
+                                                       ldb,
+                                                       (cuComplex*)X,
+                                                       ldx,
+                                                       nullptr,
+                                                       lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZZgels_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               nrhs,
+                                             hipDoubleComplex* A,
+                                             int               lda,
+                                             hipDoubleComplex* B,
+                                             int               ldb,
+                                             hipDoubleComplex* X,
+                                             int               ldx,
+                                             size_t*           lwork)
+try
+{
+    return cuda2hip_status(cusolverDnZZgels_bufferSize((cusolverDnHandle_t)handle,
+                                                       m,
+                                                       n,
+                                                       nrhs,
+                                                       (cuDoubleComplex*)A,
+                                                       lda,
+                                                       (cuDoubleComplex*)B,
+                                                       ldb,
+                                                       (cuDoubleComplex*)X,
+                                                       ldx,
+                                                       nullptr,
+                                                       lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSSgels(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               nrhs,
+                                  float*            A,
+                                  int               lda,
+                                  float*            B,
+                                  int               ldb,
+                                  float*            X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnSSgels((cusolverDnHandle_t)handle,
+                                            m,
+                                            n,
+                                            nrhs,
+                                            A,
+                                            lda,
+                                            B,
+                                            ldb,
+                                            X,
+                                            ldx,
+                                            work,
+                                            lwork,
+                                            niters,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDDgels(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               nrhs,
+                                  double*           A,
+                                  int               lda,
+                                  double*           B,
+                                  int               ldb,
+                                  double*           X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnDDgels((cusolverDnHandle_t)handle,
+                                            m,
+                                            n,
+                                            nrhs,
+                                            A,
+                                            lda,
+                                            B,
+                                            ldb,
+                                            X,
+                                            ldx,
+                                            work,
+                                            lwork,
+                                            niters,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCCgels(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               nrhs,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  hipFloatComplex*  B,
+                                  int               ldb,
+                                  hipFloatComplex*  X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnCCgels((cusolverDnHandle_t)handle,
+                                            m,
+                                            n,
+                                            nrhs,
+                                            (cuComplex*)A,
+                                            lda,
+                                            (cuComplex*)B,
+                                            ldb,
+                                            (cuComplex*)X,
+                                            ldx,
+                                            work,
+                                            lwork,
+                                            niters,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZZgels(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  int               nrhs,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  hipDoubleComplex* B,
+                                  int               ldb,
+                                  hipDoubleComplex* X,
+                                  int               ldx,
+                                  void*             work,
+                                  size_t            lwork,
+                                  int*              niters,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnZZgels((cusolverDnHandle_t)handle,
+                                            m,
+                                            n,
+                                            nrhs,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            (cuDoubleComplex*)B,
+                                            ldb,
+                                            (cuDoubleComplex*)X,
+                                            ldx,
+                                            work,
+                                            lwork,
+                                            niters,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSSgelsBatched_bufferSize(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    int               nrhs,
+                                                    float*            A[],
+                                                    int               lda,
+                                                    float*            B[],
+                                                    int               ldb,
+                                                    float*            X[],
+                                                    int               ldx,
+                                                    size_t*           lwork,
+                                                    int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDDgelsBatched_bufferSize(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    int               nrhs,
+                                                    double*           A[],
+                                                    int               lda,
+                                                    double*           B[],
+                                                    int               ldb,
+                                                    double*           X[],
+                                                    int               ldx,
+                                                    size_t*           lwork,
+                                                    int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCCgelsBatched_bufferSize(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    int               nrhs,
+                                                    hipFloatComplex*  A[],
+                                                    int               lda,
+                                                    hipFloatComplex*  B[],
+                                                    int               ldb,
+                                                    hipFloatComplex*  X[],
+                                                    int               ldx,
+                                                    size_t*           lwork,
+                                                    int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZZgelsBatched_bufferSize(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    int               nrhs,
+                                                    hipDoubleComplex* A[],
+                                                    int               lda,
+                                                    hipDoubleComplex* B[],
+                                                    int               ldb,
+                                                    hipDoubleComplex* X[],
+                                                    int               ldx,
+                                                    size_t*           lwork,
+                                                    int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSSgelsBatched(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         int               nrhs,
+                                         float*            A[],
+                                         int               lda,
+                                         float*            B[],
+                                         int               ldb,
+                                         float*            X[],
+                                         int               ldx,
+                                         void*             work,
+                                         size_t            lwork,
+                                         int*              niters,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDDgelsBatched(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         int               nrhs,
+                                         double*           A[],
+                                         int               lda,
+                                         double*           B[],
+                                         int               ldb,
+                                         double*           X[],
+                                         int               ldx,
+                                         void*             work,
+                                         size_t            lwork,
+                                         int*              niters,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCCgelsBatched(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         int               nrhs,
+                                         hipFloatComplex*  A[],
+                                         int               lda,
+                                         hipFloatComplex*  B[],
+                                         int               ldb,
+                                         hipFloatComplex*  X[],
+                                         int               ldx,
+                                         void*             work,
+                                         size_t            lwork,
+                                         int*              niters,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZZgelsBatched(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         int               nrhs,
+                                         hipDoubleComplex* A[],
+                                         int               lda,
+                                         hipDoubleComplex* B[],
+                                         int               ldb,
+                                         hipDoubleComplex* X[],
+                                         int               ldx,
+                                         void*             work,
+                                         size_t            lwork,
+                                         int*              niters,
+                                         int*              devInfo,
+                                         int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GEQP3 ********************/
+hipsolverStatus_t hipsolverSgeqp3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqp3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqp3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqp3_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgeqp3(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  int*              jpvt,
+                                  float*            tau,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqp3(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  int*              jpvt,
+                                  double*           tau,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqp3(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  int*              jpvt,
+                                  hipFloatComplex*  tau,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqp3(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  int*              jpvt,
+                                  hipDoubleComplex* tau,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GEQP3_TRUNCATED ********************/
+hipsolverStatus_t hipsolverSgeqp3Truncated_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqp3Truncated_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqp3Truncated_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqp3Truncated_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgeqp3Truncated(hipsolverHandle_t handle,
+                                           int               m,
+                                           int               n,
+                                           float*            A,
+                                           int               lda,
+                                           float             tol,
+                                           int*              jpvt,
+                                           float*            tau,
+                                           int*              rank,
+                                           float*            work,
+                                           int               lwork,
+                                           int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqp3Truncated(hipsolverHandle_t handle,
+                                           int               m,
+                                           int               n,
+                                           double*           A,
+                                           int               lda,
+                                           double            tol,
+                                           int*              jpvt,
+                                           double*           tau,
+                                           int*              rank,
+                                           double*           work,
+                                           int               lwork,
+                                           int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqp3Truncated(hipsolverHandle_t handle,
+                                           int               m,
+                                           int               n,
+                                           hipFloatComplex*  A,
+                                           int               lda,
+                                           float             tol,
+                                           int*              jpvt,
+                                           hipFloatComplex*  tau,
+                                           int*              rank,
+                                           hipFloatComplex*  work,
+                                           int               lwork,
+                                           int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqp3Truncated(hipsolverHandle_t handle,
+                                           int               m,
+                                           int               n,
+                                           hipDoubleComplex* A,
+                                           int               lda,
+                                           double            tol,
+                                           int*              jpvt,
+                                           hipDoubleComplex* tau,
+                                           int*              rank,
+                                           hipDoubleComplex* work,
+                                           int               lwork,
+                                           int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GEQRF ********************/
+hipsolverStatus_t hipsolverSgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(
+        cusolverDnSgeqrf_bufferSize((cusolverDnHandle_t)handle, m, n, A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(
+        cusolverDnDgeqrf_bufferSize((cusolverDnHandle_t)handle, m, n, A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(
+        cusolverDnCgeqrf_bufferSize((cusolverDnHandle_t)handle, m, n, (cuComplex*)A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnZgeqrf_bufferSize(
+        (cusolverDnHandle_t)handle, m, n, (cuDoubleComplex*)A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgeqrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  float*            tau,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(
+        cusolverDnSgeqrf((cusolverDnHandle_t)handle, m, n, A, lda, tau, work, lwork, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  double*           tau,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(
+        cusolverDnDgeqrf((cusolverDnHandle_t)handle, m, n, A, lda, tau, work, lwork, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  hipFloatComplex*  tau,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnCgeqrf((cusolverDnHandle_t)handle,
+                                            m,
+                                            n,
+                                            (cuComplex*)A,
+                                            lda,
+                                            (cuComplex*)tau,
+                                            (cuComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  hipDoubleComplex* tau,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnZgeqrf((cusolverDnHandle_t)handle,
+                                            m,
+                                            n,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            (cuDoubleComplex*)tau,
+                                            (cuDoubleComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GEQRF_TSQR ********************/
+hipsolverStatus_t hipsolverSgeqrfTsqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnSgeqrf_bufferSize(
+        (cusolverDnHandle_t)handle, m, n, A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqrfTsqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnDgeqrf_bufferSize(
+        (cusolverDnHandle_t)handle, m, n, A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqrfTsqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnCgeqrf_bufferSize(
+        (cusolverDnHandle_t)handle, m, n, (cuComplex*)A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqrfTsqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnZgeqrf_bufferSize(
+        (cusolverDnHandle_t)handle, m, n, (cuDoubleComplex*)A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgeqrfTsqr(hipsolverHandle_t handle,
+                                      int               m,
+                                      int               n,
+                                      float*            A,
+                                      int               lda,
+                                      float*            tau,
+                                      float*            work,
+                                      int               lwork,
+                                      int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnSgeqrf(
+        (cusolverDnHandle_t)handle, m, n, A, lda, tau, work, lwork, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqrfTsqr(hipsolverHandle_t handle,
+                                      int               m,
+                                      int               n,
+                                      double*           A,
+                                      int               lda,
+                                      double*           tau,
+                                      double*           work,
+                                      int               lwork,
+                                      int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnDgeqrf(
+        (cusolverDnHandle_t)handle, m, n, A, lda, tau, work, lwork, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqrfTsqr(hipsolverHandle_t handle,
+                                      int               m,
+                                      int               n,
+                                      hipFloatComplex*  A,
+                                      int               lda,
+                                      hipFloatComplex*  tau,
+                                      hipFloatComplex*  work,
+                                      int               lwork,
+                                      int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnCgeqrf((cusolverDnHandle_t)handle,
+                                            m,
+                                            n,
+                                            (cuComplex*)A,
+                                            lda,
+                                            (cuComplex*)tau,
+                                            (cuComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqrfTsqr(hipsolverHandle_t handle,
+                                      int               m,
+                                      int               n,
+                                      hipDoubleComplex* A,
+                                      int               lda,
+                                      hipDoubleComplex* tau,
+                                      hipDoubleComplex* work,
+                                      int               lwork,
+                                      int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnZgeqrf((cusolverDnHandle_t)handle,
+                                            m,
+                                            n,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            (cuDoubleComplex*)tau,
+                                            (cuDoubleComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GESVD ********************/
+hipsolverStatus_t hipsolverSgesvd_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnSgesvd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgesvd_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnSgesvd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgesvd_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnSgesvd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgesvd_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnSgesvd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgesvd(hipsolverHandle_t handle,
+                                  signed char       jobu,
+                                  signed char       jobv,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  float*            S,
+                                  float*            U,
+                                  int               ldu,
+                                  float*            V,
+                                  int               ldv,
+                                  float*            work,
+                                  int               lwork,
+                                  float*            rwork,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnSgesvd((cusolverDnHandle_t)handle,
+                                            jobu,
+                                            jobv,
+                                            m,
+                                            n,
+                                            A,
+                                            lda,
+                                            S,
+                                            U,
+                                            ldu,
+                                            V,
+                                            ldv,
+                                            work,
+                                            lwork,
+                                            rwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgesvd(hipsolverHandle_t handle,
+                                  signed char       jobu,
+                                  signed char       jobv,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  double*           S,
+                                  double*           U,
+                                  int               ldu,
+                                  double*           V,
+                                  int               ldv,
+                                  double*           work,
+                                  int               lwork,
+                                  double*           rwork,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnDgesvd((cusolverDnHandle_t)handle,
+                                            jobu,
+                                            jobv,
+                                            m,
+                                            n,
+                                            A,
+                                            lda,
+                                            S,
+                                            U,
+                                            ldu,
+                                            V,
+                                            ldv,
+                                            work,
+                                            lwork,
+                                            rwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgesvd(hipsolverHandle_t handle,
+                                  signed char       jobu,
+                                  signed char       jobv,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  float*            S,
+                                  hipFloatComplex*  U,
+                                  int               ldu,
+                                  hipFloatComplex*  V,
+                                  int               ldv,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  float*            rwork,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnCgesvd((cusolverDnHandle_t)handle,
+                                            jobu,
+                                            jobv,
+                                            m,
+                                            n,
+                                            (cuComplex*)A,
+                                            lda,
+                                            S,
+                                            (cuComplex*)U,
+                                            ldu,
+                                            (cuComplex*)V,
+                                            ldv,
+                                            (cuComplex*)work,
+                                            lwork,
+                                            rwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgesvd(hipsolverHandle_t handle,
+                                  signed char       jobu,
+                                  signed char       jobv,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  double*           S,
+                                  hipDoubleComplex* U,
+                                  int               ldu,
+                                  hipDoubleComplex* V,
+                                  int               ldv,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  double*           rwork,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnZgesvd((cusolverDnHandle_t)handle,
+                                            jobu,
+                                            jobv,
+                                            m,
+                                            n,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            S,
+                                            (cuDoubleComplex*)U,
+                                            ldu,
+                                            (cuDoubleComplex*)V,
+                                            ldv,
+                                            (cuDoubleComplex*)work,
+                                            lwork,
+                                            rwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRF ********************/
+hipsolverStatus_t hipsolverSgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(
+        cusolverDnSgetrf_bufferSize((cusolverDnHandle_t)handle, m, n, A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(
+        cusolverDnDgetrf_bufferSize((cusolverDnHandle_t)handle, m, n, A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(
+        cusolverDnCgetrf_bufferSize((cusolverDnHandle_t)handle, m, n, (cuComplex*)A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnZgetrf_bufferSize(
+        (cusolverDnHandle_t)handle, m, n, (cuDoubleComplex*)A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(
+        cusolverDnSgetrf((cusolverDnHandle_t)handle, m, n, A, lda, work, devIpiv, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(
+        cusolverDnDgetrf((cusolverDnHandle_t)handle, m, n, A, lda, work, devIpiv, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnCgetrf(
+        (cusolverDnHandle_t)handle, m, n, (cuComplex*)A, lda, (cuComplex*)work, devIpiv, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnZgetrf((cusolverDnHandle_t)handle,
+                                            m,
+                                            n,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            (cuDoubleComplex*)work,
+                                            devIpiv,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRS ********************/
+hipsolverStatus_t hipsolverSgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             float*               A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             float*               B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             double*              A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             double*              B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             hipFloatComplex*     B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             hipDoubleComplex*    B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  float*               A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  float*               B,
+                                  int                  ldb,
+                                  float*               work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnSgetrs((cusolverDnHandle_t)handle,
+                                            hip2cuda_operation(trans),
+                                            n,
+                                            nrhs,
+                                            A,
+                                            lda,
+                                            devIpiv,
+                                            B,
+                                            ldb,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  double*              A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  double*              B,
+                                  int                  ldb,
+                                  double*              work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnDgetrs((cusolverDnHandle_t)handle,
+                                            hip2cuda_operation(trans),
+                                            n,
+                                            nrhs,
+                                            A,
+                                            lda,
+                                            devIpiv,
+                                            B,
+                                            ldb,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  hipFloatComplex*     A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  hipFloatComplex*     B,
+                                  int                  ldb,
+                                  hipFloatComplex*     work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnCgetrs((cusolverDnHandle_t)handle,
+                                            hip2cuda_operation(trans),
+                                            n,
+                                            nrhs,
+                                            (cuComplex*)A,
+                                            lda,
+                                            devIpiv,
+                                            (cuComplex*)B,
+                                            ldb,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  hipDoubleComplex*    A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  hipDoubleComplex*    B,
+                                  int                  ldb,
+                                  hipDoubleComplex*    work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnZgetrs((cusolverDnHandle_t)handle,
+                                            hip2cuda_operation(trans),
+                                            n,
+                                            nrhs,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            devIpiv,
+                                            (cuDoubleComplex*)B,
+                                            ldb,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRF_HOST ********************/
+hipsolverStatus_t hipsolverSgetrfHost(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* ipiv, int* info)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrfHost(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* ipiv, int* info)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrfHost(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* ipiv, int* info)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrfHost(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* ipiv, int* info)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRF_BATCHED_HOST ********************/
+hipsolverStatus_t hipsolverSgetrfBatchedHost(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             float*            A[],
+                                             int               lda,
+                                             int*              ipiv,
+                                             int               strideP,
+                                             int*              info,
+                                             int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZunmqr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  int                  k,
-                                  hipDoubleComplex*    A,
-                                  int                  lda,
-                                  hipDoubleComplex*    tau,
-                                  hipDoubleComplex*    C,
-                                  int                  ldc,
-                                  hipDoubleComplex*    work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverDgetrfBatchedHost(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             double*           A[],
+                                             int               lda,
+                                             int*              ipiv,
+                                             int               strideP,
+                                             int*              info,
+                                             int               batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnZunmqr((cusolverDnHandle_t)handle,
-                                            hip2cuda_side(side),
-                                            hip2cuda_operation(trans),
-                                            m,
-                                            n,
-                                            k,
-                                            (cuDoubleComplex*)A,
-                                            lda,
-                                            (cuDoubleComplex*)tau,
-                                            (cuDoubleComplex*)C,
-                                            ldc,
-                                            (cuDoubleComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** ORMTR/UNMTR ********************/
-hipsolverStatus_t hipsolverSormtr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverFillMode_t  uplo,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             float*               A,
-                                             int                  lda,
-                                             float*               tau,
-                                             float*               C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverCgetrfBatchedHost(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipFloatComplex*  A[],
+                                             int               lda,
+                                             int*              ipiv,
+                                             int               strideP,
+                                             int*              info,
+                                             int               batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnSormtr_bufferSize((cusolverDnHandle_t)handle,
-                                                       hip2cuda_side(side),
-                                                       hip2cuda_fill(uplo),
-                                                       hip2cuda_operation(trans),
-                                                       m,
-                                                       n,
-                                                       A,
-                                                       lda,
-                                                       tau,
-                                                       C,
-                                                       ldc,
-                                                       lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDormtr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverFillMode_t  uplo,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             double*              A,
-                                             int                  lda,
-                                             double*              tau,
-                                             double*              C,
-                                             int                  ldc,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverZgetrfBatchedHost(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipDoubleComplex* A[],
+                                             int               lda,
+                                             int*              ipiv,
+                                             int               strideP,
+                                             int*              info,
+                                             int               batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnDormtr_bufferSize((cusolverDnHandle_t)handle,
-                                                       hip2cuda_side(side),
-                                                       hip2cuda_fill(uplo),
-                                                       hip2cuda_operation(trans),
-                                                       m,
-                                                       n,
-                                                       A,
-                                                       lda,
-                                                       tau,
-                                                       C,
-                                                       ldc,
-                                                       lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCunmtr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverFillMode_t  uplo,
-                                             hipsolverOperation_t trans,
-                                             int                  m,
-                                             int                  n,
-                                             hipFloatComplex*     A,
-                                             int                  lda,
-                                             hipFloatComplex*     tau,
-                                             hipFloatComplex*     C,
-                                             int                  ldc,
-                                             int*                 lwork)
+/******************** GETRS_HOST ********************/
+hipsolverStatus_t hipsolverSgetrsHost(hipsolverHandle_t    handle,
+                                      hipsolverOperation_t trans,
+                                      int                  n,
+                                      int                  nrhs,
+                                      const float*         A,
+                                      int                  lda,
+                                      const int*           ipiv,
+                                      float*               B,
+                                      int                  ldb,
+                                      int*                 info)
 try
 {
-    return cuda2hip_status(cusolverDnCunmtr_bufferSize((cusolverDnHandle_t)handle,
-                                                       hip2cuda_side(side),
-                                                       hip2cuda_fill(uplo),
-                                                       hip2cuda_operation(trans),
-                                                       m,
-                                                       n,
-                                                       (cuComplex*)A,
-                                                       lda,
-                                                       (cuComplex*)tau,
-                                                       (cuComplex*)C,
-                                                       ldc,
-                                                       lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZunmtr_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverSideMode_t  side,
-                                             hipsolverFillMode_t  uplo,
+hipsolverStatus_t hipsolverDgetrsHost(hipsolverHandle_t    handle,
+                                      hipsolverOperation_t trans,
+                                      int                  n,
+                                      int                  nrhs,
+                                      const double*        A,
+                                      int                  lda,
+                                      const int*           ipiv,
+                                      double*              B,
+                                      int                  ldb,
+                                      int*                 info)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrsHost(hipsolverHandle_t      handle,
+                                      hipsolverOperation_t   trans,
+                                      int                    n,
+                                      int                    nrhs,
+                                      const hipFloatComplex* A,
+                                      int                    lda,
+                                      const int*             ipiv,
+                                      hipFloatComplex*       B,
+                                      int                    ldb,
+                                      int*                   info)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrsHost(hipsolverHandle_t       handle,
+                                      hipsolverOperation_t    trans,
+                                      int                     n,
+                                      int                     nrhs,
+                                      const hipDoubleComplex* A,
+                                      int                     lda,
+                                      const int*              ipiv,
+                                      hipDoubleComplex*       B,
+                                      int                     ldb,
+                                      int*                    info)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRS_BATCHED_HOST ********************/
+hipsolverStatus_t hipsolverSgetrsBatchedHost(hipsolverHandle_t    handle,
                                              hipsolverOperation_t trans,
-                                             int                  m,
                                              int                  n,
-                                             hipDoubleComplex*    A,
+                                             int                  nrhs,
+                                             float*               A[],
                                              int                  lda,
-                                             hipDoubleComplex*    tau,
-                                             hipDoubleComplex*    C,
-                                             int                  ldc,
-                                             int*                 lwork)
+                                             const int*           ipiv,
+                                             int                  strideP,
+                                             float*               B[],
+                                             int                  ldb,
+                                             int*                 info,
+                                             int                  batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnZunmtr_bufferSize((cusolverDnHandle_t)handle,
-                                                       hip2cuda_side(side),
-                                                       hip2cuda_fill(uplo),
-                                                       hip2cuda_operation(trans),
-                                                       m,
-                                                       n,
-                                                       (cuDoubleComplex*)A,
-                                                       lda,
-                                                       (cuDoubleComplex*)tau,
-                                                       (cuDoubleComplex*)C,
-                                                       ldc,
-                                                       lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSormtr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverFillMode_t  uplo,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  float*               A,
-                                  int                  lda,
-                                  float*               tau,
-                                  float*               C,
-                                  int                  ldc,
-                                  float*               work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverDgetrsBatchedHost(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             double*              A[],
+                                             int                  lda,
+                                             const int*           ipiv,
+                                             int                  strideP,
+                                             double*              B[],
+                                             int                  ldb,
+                                             int*                 info,
+                                             int                  batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnSormtr((cusolverDnHandle_t)handle,
-                                            hip2cuda_side(side),
-                                            hip2cuda_fill(uplo),
-                                            hip2cuda_operation(trans),
-                                            m,
-                                            n,
-                                            A,
-                                            lda,
-                                            tau,
-                                            C,
-                                            ldc,
-                                            work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDormtr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverFillMode_t  uplo,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  double*              A,
-                                  int                  lda,
-                                  double*              tau,
-                                  double*              C,
-                                  int                  ldc,
-                                  double*              work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverCgetrsBatchedHost(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipFloatComplex*     A[],
+                                             int                  lda,
+                                             const int*           ipiv,
+                                             int                  strideP,
+                                             hipFloatComplex*     B[],
+                                             int                  ldb,
+                                             int*                 info,
+                                             int                  batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnDormtr((cusolverDnHandle_t)handle,
-                                            hip2cuda_side(side),
-                                            hip2cuda_fill(uplo),
-                                            hip2cuda_operation(trans),
-                                            m,
-                                            n,
-                                            A,
-                                            lda,
-                                            tau,
-                                            C,
-                                            ldc,
-                                            work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCunmtr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverFillMode_t  uplo,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  hipFloatComplex*     A,
-                                  int                  lda,
-                                  hipFloatComplex*     tau,
-                                  hipFloatComplex*     C,
-                                  int                  ldc,
-                                  hipFloatComplex*     work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverZgetrsBatchedHost(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipDoubleComplex*    A[],
+                                             int                  lda,
+                                             const int*           ipiv,
+                                             int                  strideP,
+                                             hipDoubleComplex*    B[],
+                                             int                  ldb,
+                                             int*                 info,
+                                             int                  batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnCunmtr((cusolverDnHandle_t)handle,
-                                            hip2cuda_side(side),
-                                            hip2cuda_fill(uplo),
-                                            hip2cuda_operation(trans),
-                                            m,
-                                            n,
-                                            (cuComplex*)A,
-                                            lda,
-                                            (cuComplex*)tau,
-                                            (cuComplex*)C,
-                                            ldc,
-                                            (cuComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZunmtr(hipsolverHandle_t    handle,
-                                  hipsolverSideMode_t  side,
-                                  hipsolverFillMode_t  uplo,
-                                  hipsolverOperation_t trans,
-                                  int                  m,
-                                  int                  n,
-                                  hipDoubleComplex*    A,
-                                  int                  lda,
-                                  hipDoubleComplex*    tau,
-                                  hipDoubleComplex*    C,
-                                  int                  ldc,
-                                  hipDoubleComplex*    work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+/******************** GETRF_COMPACT ********************/
+hipsolverStatus_t hipsolverSgetrfCompact(hipsolverHandle_t handle,
+                                         int               n,
+                                         float*            Ac,
+                                         int*              devIpiv,
+                                         int*              devInfo,
+                                         int               batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnZunmtr((cusolverDnHandle_t)handle,
-                                            hip2cuda_side(side),
-                                            hip2cuda_fill(uplo),
-                                            hip2cuda_operation(trans),
-                                            m,
-                                            n,
-                                            (cuDoubleComplex*)A,
-                                            lda,
-                                            (cuDoubleComplex*)tau,
-                                            (cuDoubleComplex*)C,
-                                            ldc,
-                                            (cuDoubleComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** GEBRD ********************/
-hipsolverStatus_t hipsolverSgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+hipsolverStatus_t hipsolverDgetrfCompact(hipsolverHandle_t handle,
+                                         int               n,
+                                         double*           Ac,
+                                         int*              devIpiv,
+                                         int*              devInfo,
+                                         int               batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnSgebrd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+hipsolverStatus_t hipsolverCgetrfCompact(hipsolverHandle_t handle,
+                                         int               n,
+                                         hipFloatComplex*  Ac,
+                                         int*              devIpiv,
+                                         int*              devInfo,
+                                         int               batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnDgebrd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+hipsolverStatus_t hipsolverZgetrfCompact(hipsolverHandle_t handle,
+                                         int               n,
+                                         hipDoubleComplex* Ac,
+                                         int*              devIpiv,
+                                         int*              devInfo,
+                                         int               batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnCgebrd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgebrd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+/******************** GETRS_COMPACT ********************/
+hipsolverStatus_t hipsolverSgetrsCompact(hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         const float*         Ac,
+                                         const int*           devIpiv,
+                                         float*               Bc,
+                                         int*                 devInfo,
+                                         int                  batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnZgebrd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgebrd(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  float*            A,
-                                  int               lda,
-                                  float*            D,
-                                  float*            E,
-                                  float*            tauq,
-                                  float*            taup,
-                                  float*            work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverDgetrsCompact(hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         const double*        Ac,
+                                         const int*           devIpiv,
+                                         double*              Bc,
+                                         int*                 devInfo,
+                                         int                  batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnSgebrd(
-        (cusolverDnHandle_t)handle, m, n, A, lda, D, E, tauq, taup, work, lwork, devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgebrd(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  double*           A,
-                                  int               lda,
-                                  double*           D,
-                                  double*           E,
-                                  double*           tauq,
-                                  double*           taup,
-                                  double*           work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverCgetrsCompact(hipsolverHandle_t      handle,
+                                         hipsolverOperation_t   trans,
+                                         int                    n,
+                                         int                    nrhs,
+                                         const hipFloatComplex* Ac,
+                                         const int*             devIpiv,
+                                         hipFloatComplex*       Bc,
+                                         int*                   devInfo,
+                                         int                    batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnDgebrd(
-        (cusolverDnHandle_t)handle, m, n, A, lda, D, E, tauq, taup, work, lwork, devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgebrd(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipFloatComplex*  A,
-                                  int               lda,
-                                  float*            D,
-                                  float*            E,
-                                  hipFloatComplex*  tauq,
-                                  hipFloatComplex*  taup,
-                                  hipFloatComplex*  work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverZgetrsCompact(hipsolverHandle_t       handle,
+                                         hipsolverOperation_t    trans,
+                                         int                     n,
+                                         int                     nrhs,
+                                         const hipDoubleComplex* Ac,
+                                         const int*              devIpiv,
+                                         hipDoubleComplex*       Bc,
+                                         int*                    devInfo,
+                                         int                     batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnCgebrd((cusolverDnHandle_t)handle,
-                                            m,
-                                            n,
-                                            (cuComplex*)A,
-                                            lda,
-                                            D,
-                                            E,
-                                            (cuComplex*)tauq,
-                                            (cuComplex*)taup,
-                                            (cuComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgebrd(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipDoubleComplex* A,
-                                  int               lda,
-                                  double*           D,
-                                  double*           E,
-                                  hipDoubleComplex* tauq,
-                                  hipDoubleComplex* taup,
-                                  hipDoubleComplex* work,
-                                  int               lwork,
-                                  int*              devInfo)
+/******************** MG_GETRF ********************/
+hipsolverStatus_t hipsolverMgSgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               int                     m,
+                                               int                     n,
+                                               float*                  A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    ipiv[],
+                                               int*                    lwork)
 try
 {
-    return cuda2hip_status(cusolverDnZgebrd((cusolverDnHandle_t)handle,
-                                            m,
-                                            n,
-                                            (cuDoubleComplex*)A,
-                                            lda,
-                                            D,
-                                            E,
-                                            (cuDoubleComplex*)tauq,
-                                            (cuDoubleComplex*)taup,
-                                            (cuDoubleComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** GEQRF ********************/
-hipsolverStatus_t hipsolverSgeqrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverMgDgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               int                     m,
+                                               int                     n,
+                                               double*                 A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    ipiv[],
+                                               int*                    lwork)
 try
 {
-    return cuda2hip_status(
-        cusolverDnSgeqrf_bufferSize((cusolverDnHandle_t)handle, m, n, A, lda, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgeqrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverMgCgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               int                     m,
+                                               int                     n,
+                                               hipFloatComplex*        A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    ipiv[],
+                                               int*                    lwork)
 try
 {
-    return cuda2hip_status(
-        cusolverDnDgeqrf_bufferSize((cusolverDnHandle_t)handle, m, n, A, lda, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgeqrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverMgZgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               int                     m,
+                                               int                     n,
+                                               hipDoubleComplex*       A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    ipiv[],
+                                               int*                    lwork)
 try
 {
-    return cuda2hip_status(
-        cusolverDnCgeqrf_bufferSize((cusolverDnHandle_t)handle, m, n, (cuComplex*)A, lda, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgeqrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverMgSgetrf(hipsolverMgHandle_t     handle,
+                                    int                     m,
+                                    int                     n,
+                                    float*                  A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    int*                    ipiv[],
+                                    float*                  work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    return cuda2hip_status(cusolverDnZgeqrf_bufferSize(
-        (cusolverDnHandle_t)handle, m, n, (cuDoubleComplex*)A, lda, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgeqrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  float*            A,
-                                  int               lda,
-                                  float*            tau,
-                                  float*            work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverMgDgetrf(hipsolverMgHandle_t     handle,
+                                    int                     m,
+                                    int                     n,
+                                    double*                 A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    int*                    ipiv[],
+                                    double*                 work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    return cuda2hip_status(
-        cusolverDnSgeqrf((cusolverDnHandle_t)handle, m, n, A, lda, tau, work, lwork, devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgeqrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  double*           A,
-                                  int               lda,
-                                  double*           tau,
-                                  double*           work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverMgCgetrf(hipsolverMgHandle_t     handle,
+                                    int                     m,
+                                    int                     n,
+                                    hipFloatComplex*        A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    int*                    ipiv[],
+                                    hipFloatComplex*        work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    return cuda2hip_status(
-        cusolverDnDgeqrf((cusolverDnHandle_t)handle, m, n, A, lda, tau, work, lwork, devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgeqrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipFloatComplex*  A,
-                                  int               lda,
-                                  hipFloatComplex*  tau,
-                                  hipFloatComplex*  work,
-                                  int               lwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverMgZgetrf(hipsolverMgHandle_t     handle,
+                                    int                     m,
+                                    int                     n,
+                                    hipDoubleComplex*       A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    int*                    ipiv[],
+                                    hipDoubleComplex*       work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    return cuda2hip_status(cusolverDnCgeqrf((cusolverDnHandle_t)handle,
-                                            m,
-                                            n,
-                                            (cuComplex*)A,
-                                            lda,
-                                            (cuComplex*)tau,
-                                            (cuComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgeqrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipDoubleComplex* A,
-                                  int               lda,
-                                  hipDoubleComplex* tau,
-                                  hipDoubleComplex* work,
-                                  int               lwork,
-                                  int*              devInfo)
+/******************** MG_POTRF ********************/
+hipsolverStatus_t hipsolverMgSpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               float*                  A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    lwork)
 try
 {
-    return cuda2hip_status(cusolverDnZgeqrf((cusolverDnHandle_t)handle,
-                                            m,
-                                            n,
-                                            (cuDoubleComplex*)A,
-                                            lda,
-                                            (cuDoubleComplex*)tau,
-                                            (cuDoubleComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** GESVD ********************/
-hipsolverStatus_t hipsolverSgesvd_bufferSize(
-    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+hipsolverStatus_t hipsolverMgDpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               double*                 A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    lwork)
 try
 {
-    return cuda2hip_status(cusolverDnSgesvd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgesvd_bufferSize(
-    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+hipsolverStatus_t hipsolverMgCpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipFloatComplex*        A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    lwork)
 try
 {
-    return cuda2hip_status(cusolverDnSgesvd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgesvd_bufferSize(
-    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+hipsolverStatus_t hipsolverMgZpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipDoubleComplex*       A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               int*                    lwork)
 try
 {
-    return cuda2hip_status(cusolverDnSgesvd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgesvd_bufferSize(
-    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork)
+hipsolverStatus_t hipsolverMgSpotrf(hipsolverMgHandle_t     handle,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    float*                  A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    float*                  work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    return cuda2hip_status(cusolverDnSgesvd_bufferSize((cusolverDnHandle_t)handle, m, n, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgesvd(hipsolverHandle_t handle,
-                                  signed char       jobu,
-                                  signed char       jobv,
-                                  int               m,
-                                  int               n,
-                                  float*            A,
-                                  int               lda,
-                                  float*            S,
-                                  float*            U,
-                                  int               ldu,
-                                  float*            V,
-                                  int               ldv,
-                                  float*            work,
-                                  int               lwork,
-                                  float*            rwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverMgDpotrf(hipsolverMgHandle_t     handle,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    double*                 A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    double*                 work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    return cuda2hip_status(cusolverDnSgesvd((cusolverDnHandle_t)handle,
-                                            jobu,
-                                            jobv,
-                                            m,
-                                            n,
-                                            A,
-                                            lda,
-                                            S,
-                                            U,
-                                            ldu,
-                                            V,
-                                            ldv,
-                                            work,
-                                            lwork,
-                                            rwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverMgCpotrf(hipsolverMgHandle_t     handle,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    hipFloatComplex*        A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    hipFloatComplex*        work[],
+                                    int                     lwork,
+                                    int*                    info)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgesvd(hipsolverHandle_t handle,
-                                  signed char       jobu,
-                                  signed char       jobv,
-                                  int               m,
-                                  int               n,
-                                  double*           A,
-                                  int               lda,
-                                  double*           S,
-                                  double*           U,
-                                  int               ldu,
-                                  double*           V,
-                                  int               ldv,
-                                  double*           work,
-                                  int               lwork,
-                                  double*           rwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverMgZpotrf(hipsolverMgHandle_t     handle,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    hipDoubleComplex*       A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    hipDoubleComplex*       work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    return cuda2hip_status(cusolverDnDgesvd((cusolverDnHandle_t)handle,
-                                            jobu,
-                                            jobv,
-                                            m,
-                                            n,
-                                            A,
-                                            lda,
-                                            S,
-                                            U,
-                                            ldu,
-                                            V,
-                                            ldv,
-                                            work,
-                                            lwork,
-                                            rwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgesvd(hipsolverHandle_t handle,
-                                  signed char       jobu,
-                                  signed char       jobv,
-                                  int               m,
-                                  int               n,
-                                  hipFloatComplex*  A,
-                                  int               lda,
-                                  float*            S,
-                                  hipFloatComplex*  U,
-                                  int               ldu,
-                                  hipFloatComplex*  V,
-                                  int               ldv,
-                                  hipFloatComplex*  work,
-                                  int               lwork,
-                                  float*            rwork,
-                                  int*              devInfo)
+/******************** MG_SYEVD/MG_HEEVD ********************/
+hipsolverStatus_t hipsolverMgSsyevd_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               float*                  A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               float*                  W,
+                                               int*                    lwork)
 try
 {
-    return cuda2hip_status(cusolverDnCgesvd((cusolverDnHandle_t)handle,
-                                            jobu,
-                                            jobv,
-                                            m,
-                                            n,
-                                            (cuComplex*)A,
-                                            lda,
-                                            S,
-                                            (cuComplex*)U,
-                                            ldu,
-                                            (cuComplex*)V,
-                                            ldv,
-                                            (cuComplex*)work,
-                                            lwork,
-                                            rwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgesvd(hipsolverHandle_t handle,
-                                  signed char       jobu,
-                                  signed char       jobv,
-                                  int               m,
-                                  int               n,
-                                  hipDoubleComplex* A,
-                                  int               lda,
-                                  double*           S,
-                                  hipDoubleComplex* U,
-                                  int               ldu,
-                                  hipDoubleComplex* V,
-                                  int               ldv,
-                                  hipDoubleComplex* work,
-                                  int               lwork,
-                                  double*           rwork,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverMgDsyevd_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               double*                 A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               double*                 W,
+                                               int*                    lwork)
 try
 {
-    return cuda2hip_status(cusolverDnZgesvd((cusolverDnHandle_t)handle,
-                                            jobu,
-                                            jobv,
-                                            m,
-                                            n,
-                                            (cuDoubleComplex*)A,
-                                            lda,
-                                            S,
-                                            (cuDoubleComplex*)U,
-                                            ldu,
-                                            (cuDoubleComplex*)V,
-                                            ldv,
-                                            (cuDoubleComplex*)work,
-                                            lwork,
-                                            rwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** GETRF ********************/
-hipsolverStatus_t hipsolverSgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverMgCheevd_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipFloatComplex*        A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               float*                  W,
+                                               int*                    lwork)
 try
 {
-    return cuda2hip_status(
-        cusolverDnSgetrf_bufferSize((cusolverDnHandle_t)handle, m, n, A, lda, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverMgZheevd_bufferSize(hipsolverMgHandle_t     handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipDoubleComplex*       A[],
+                                               int                     ia,
+                                               int                     ja,
+                                               hipsolverMgMatrixDesc_t descA,
+                                               double*                 W,
+                                               int*                    lwork)
 try
 {
-    return cuda2hip_status(
-        cusolverDnDgetrf_bufferSize((cusolverDnHandle_t)handle, m, n, A, lda, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverMgSsyevd(hipsolverMgHandle_t     handle,
+                                    hipsolverEigMode_t      jobz,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    float*                  A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    float*                  W,
+                                    float*                  work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    return cuda2hip_status(
-        cusolverDnCgetrf_bufferSize((cusolverDnHandle_t)handle, m, n, (cuComplex*)A, lda, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverMgDsyevd(hipsolverMgHandle_t     handle,
+                                    hipsolverEigMode_t      jobz,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    double*                 A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    double*                 W,
+                                    double*                 work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    return cuda2hip_status(cusolverDnZgetrf_bufferSize(
-        (cusolverDnHandle_t)handle, m, n, (cuDoubleComplex*)A, lda, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgetrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  float*            A,
-                                  int               lda,
-                                  float*            work,
-                                  int               lwork,
-                                  int*              devIpiv,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverMgCheevd(hipsolverMgHandle_t     handle,
+                                    hipsolverEigMode_t      jobz,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    hipFloatComplex*        A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    float*                  W,
+                                    hipFloatComplex*        work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    return cuda2hip_status(
-        cusolverDnSgetrf((cusolverDnHandle_t)handle, m, n, A, lda, work, devIpiv, devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgetrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  double*           A,
-                                  int               lda,
-                                  double*           work,
-                                  int               lwork,
-                                  int*              devIpiv,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverMgZheevd(hipsolverMgHandle_t     handle,
+                                    hipsolverEigMode_t      jobz,
+                                    hipsolverFillMode_t     uplo,
+                                    int                     n,
+                                    hipDoubleComplex*       A[],
+                                    int                     ia,
+                                    int                     ja,
+                                    hipsolverMgMatrixDesc_t descA,
+                                    double*                 W,
+                                    hipDoubleComplex*       work[],
+                                    int                     lwork,
+                                    int*                    info)
 try
 {
-    return cuda2hip_status(
-        cusolverDnDgetrf((cusolverDnHandle_t)handle, m, n, A, lda, work, devIpiv, devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgetrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipFloatComplex*  A,
-                                  int               lda,
-                                  hipFloatComplex*  work,
-                                  int               lwork,
-                                  int*              devIpiv,
-                                  int*              devInfo)
+/******************** PACK_COMPACT ********************/
+hipsolverStatus_t hipsolverSpackCompact(hipsolverHandle_t handle,
+                                        int               m,
+                                        int               n,
+                                        const float*      A,
+                                        int               lda,
+                                        int               strideA,
+                                        float*            Ac,
+                                        int               batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnCgetrf(
-        (cusolverDnHandle_t)handle, m, n, (cuComplex*)A, lda, (cuComplex*)work, devIpiv, devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgetrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipDoubleComplex* A,
-                                  int               lda,
-                                  hipDoubleComplex* work,
-                                  int               lwork,
-                                  int*              devIpiv,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverDpackCompact(hipsolverHandle_t handle,
+                                        int               m,
+                                        int               n,
+                                        const double*     A,
+                                        int               lda,
+                                        int               strideA,
+                                        double*           Ac,
+                                        int               batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnZgetrf((cusolverDnHandle_t)handle,
-                                            m,
-                                            n,
-                                            (cuDoubleComplex*)A,
-                                            lda,
-                                            (cuDoubleComplex*)work,
-                                            devIpiv,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** GETRS ********************/
-hipsolverStatus_t hipsolverSgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             float*               A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             float*               B,
-                                             int                  ldb,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverCpackCompact(hipsolverHandle_t      handle,
+                                        int                    m,
+                                        int                    n,
+                                        const hipFloatComplex* A,
+                                        int                    lda,
+                                        int                    strideA,
+                                        hipFloatComplex*       Ac,
+                                        int                    batch_count)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             double*              A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             double*              B,
-                                             int                  ldb,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverZpackCompact(hipsolverHandle_t       handle,
+                                        int                     m,
+                                        int                     n,
+                                        const hipDoubleComplex* A,
+                                        int                     lda,
+                                        int                     strideA,
+                                        hipDoubleComplex*       Ac,
+                                        int                     batch_count)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             hipFloatComplex*     A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             hipFloatComplex*     B,
-                                             int                  ldb,
-                                             int*                 lwork)
+/******************** UNPACK_COMPACT ********************/
+hipsolverStatus_t hipsolverSunpackCompact(hipsolverHandle_t handle,
+                                          int               m,
+                                          int               n,
+                                          const float*      Ac,
+                                          float*            A,
+                                          int               lda,
+                                          int               strideA,
+                                          int               batch_count)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             hipDoubleComplex*    A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             hipDoubleComplex*    B,
-                                             int                  ldb,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverDunpackCompact(hipsolverHandle_t handle,
+                                          int               m,
+                                          int               n,
+                                          const double*     Ac,
+                                          double*           A,
+                                          int               lda,
+                                          int               strideA,
+                                          int               batch_count)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  float*               A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  float*               B,
-                                  int                  ldb,
-                                  float*               work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverCunpackCompact(hipsolverHandle_t      handle,
+                                          int                    m,
+                                          int                    n,
+                                          const hipFloatComplex* Ac,
+                                          hipFloatComplex*       A,
+                                          int                    lda,
+                                          int                    strideA,
+                                          int                    batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnSgetrs((cusolverDnHandle_t)handle,
-                                            hip2cuda_operation(trans),
-                                            n,
-                                            nrhs,
-                                            A,
-                                            lda,
-                                            devIpiv,
-                                            B,
-                                            ldb,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  double*              A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  double*              B,
-                                  int                  ldb,
-                                  double*              work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverZunpackCompact(hipsolverHandle_t       handle,
+                                          int                     m,
+                                          int                     n,
+                                          const hipDoubleComplex* Ac,
+                                          hipDoubleComplex*       A,
+                                          int                     lda,
+                                          int                     strideA,
+                                          int                     batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POSV_SUBMIT ********************/
+hipsolverStatus_t hipsolverSposvSubmit(hipsolverBatchQueue_t    queue,
+                                       hipsolverFillMode_t      uplo,
+                                       int                      n,
+                                       int                      nrhs,
+                                       float*                   A,
+                                       int                      lda,
+                                       float*                   B,
+                                       int                      ldb,
+                                       hipStream_t              stream,
+                                       hipsolverBatchRequest_t* request)
 try
 {
-    return cuda2hip_status(cusolverDnDgetrs((cusolverDnHandle_t)handle,
-                                            hip2cuda_operation(trans),
-                                            n,
-                                            nrhs,
-                                            A,
-                                            lda,
-                                            devIpiv,
-                                            B,
-                                            ldb,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  hipFloatComplex*     A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  hipFloatComplex*     B,
-                                  int                  ldb,
-                                  hipFloatComplex*     work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverDposvSubmit(hipsolverBatchQueue_t    queue,
+                                       hipsolverFillMode_t      uplo,
+                                       int                      n,
+                                       int                      nrhs,
+                                       double*                  A,
+                                       int                      lda,
+                                       double*                  B,
+                                       int                      ldb,
+                                       hipStream_t              stream,
+                                       hipsolverBatchRequest_t* request)
 try
 {
-    return cuda2hip_status(cusolverDnCgetrs((cusolverDnHandle_t)handle,
-                                            hip2cuda_operation(trans),
-                                            n,
-                                            nrhs,
-                                            (cuComplex*)A,
-                                            lda,
-                                            devIpiv,
-                                            (cuComplex*)B,
-                                            ldb,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  hipDoubleComplex*    A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  hipDoubleComplex*    B,
-                                  int                  ldb,
-                                  hipDoubleComplex*    work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverCposvSubmit(hipsolverBatchQueue_t    queue,
+                                       hipsolverFillMode_t      uplo,
+                                       int                      n,
+                                       int                      nrhs,
+                                       hipFloatComplex*         A,
+                                       int                      lda,
+                                       hipFloatComplex*         B,
+                                       int                      ldb,
+                                       hipStream_t              stream,
+                                       hipsolverBatchRequest_t* request)
 try
 {
-    return cuda2hip_status(cusolverDnZgetrs((cusolverDnHandle_t)handle,
-                                            hip2cuda_operation(trans),
-                                            n,
-                                            nrhs,
-                                            (cuDoubleComplex*)A,
-                                            lda,
-                                            devIpiv,
-                                            (cuDoubleComplex*)B,
-                                            ldb,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZposvSubmit(hipsolverBatchQueue_t    queue,
+                                       hipsolverFillMode_t      uplo,
+                                       int                      n,
+                                       int                      nrhs,
+                                       hipDoubleComplex*        A,
+                                       int                      lda,
+                                       hipDoubleComplex*        B,
+                                       int                      ldb,
+                                       hipStream_t              stream,
+                                       hipsolverBatchRequest_t* request)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
@@ -2427,6 +5035,209 @@ catch(...)
     return exception2hip_status();
 }
 
+/******************** POTRF_COMPACT ********************/
+hipsolverStatus_t hipsolverSpotrfCompact(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              Ac,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfCompact(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             Ac,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfCompact(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipFloatComplex*    Ac,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfCompact(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipDoubleComplex*   Ac,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_OUT_OF_CORE ********************/
+hipsolverStatus_t hipsolverSpotrfOutOfCore(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           float*              A,
+                                           int                 lda,
+                                           size_t              deviceBudget,
+                                           int*                info)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfOutOfCore(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           double*             A,
+                                           int                 lda,
+                                           size_t              deviceBudget,
+                                           int*                info)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfOutOfCore(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           hipFloatComplex*    A,
+                                           int                 lda,
+                                           size_t              deviceBudget,
+                                           int*                info)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfOutOfCore(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           hipDoubleComplex*   A,
+                                           int                 lda,
+                                           size_t              deviceBudget,
+                                           int*                info)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRS_OUT_OF_CORE ********************/
+hipsolverStatus_t hipsolverSpotrsOutOfCore(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           int                 nrhs,
+                                           const float*        A,
+                                           int                 lda,
+                                           float*              B,
+                                           int                 ldb,
+                                           size_t              deviceBudget,
+                                           int*                info)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrsOutOfCore(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           int                 nrhs,
+                                           const double*       A,
+                                           int                 lda,
+                                           double*             B,
+                                           int                 ldb,
+                                           size_t              deviceBudget,
+                                           int*                info)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrsOutOfCore(hipsolverHandle_t      handle,
+                                           hipsolverFillMode_t    uplo,
+                                           int                    n,
+                                           int                    nrhs,
+                                           const hipFloatComplex* A,
+                                           int                    lda,
+                                           hipFloatComplex*       B,
+                                           int                    ldb,
+                                           size_t                 deviceBudget,
+                                           int*                   info)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrsOutOfCore(hipsolverHandle_t       handle,
+                                           hipsolverFillMode_t     uplo,
+                                           int                     n,
+                                           int                     nrhs,
+                                           const hipDoubleComplex* A,
+                                           int                     lda,
+                                           hipDoubleComplex*       B,
+                                           int                     ldb,
+                                           size_t                  deviceBudget,
+                                           int*                    info)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
 /******************** SYEVD/HEEVD ********************/
 hipsolverStatus_t hipsolverSsyevd_bufferSize(hipsolverHandle_t   handle,
                                              hipsolverEigMode_t  jobz,
@@ -2859,40 +5670,218 @@ catch(...)
     return exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvd(hipsolverHandle_t   handle,
-                                                   hipsolverEigType_t  itype,
-                                                   hipsolverEigMode_t  jobz,
-                                                   hipsolverFillMode_t uplo,
-                                                   int                 n,
-                                                   hipDoubleComplex*   A,
-                                                   int                 lda,
-                                                   hipDoubleComplex*   B,
-                                                   int                 ldb,
-                                                   double*             D,
-                                                   hipDoubleComplex*   work,
-                                                   int                 lwork,
-                                                   int*                devInfo)
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvd(hipsolverHandle_t   handle,
+                                                   hipsolverEigType_t  itype,
+                                                   hipsolverEigMode_t  jobz,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipDoubleComplex*   A,
+                                                   int                 lda,
+                                                   hipDoubleComplex*   B,
+                                                   int                 ldb,
+                                                   double*             D,
+                                                   hipDoubleComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnZhegvd((cusolverDnHandle_t)handle,
+                                            hip2cuda_eform(itype),
+                                            hip2cuda_evect(jobz),
+                                            hip2cuda_fill(uplo),
+                                            n,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            (cuDoubleComplex*)B,
+                                            ldb,
+                                            D,
+                                            (cuDoubleComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** SYGVD_PIPELINED/HEGVD_PIPELINED ********************/
+hipsolverStatus_t hipsolverSsygvdPipelined_bufferSize(hipsolverHandle_t   handle,
+                                                      hipsolverEigType_t  itype,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      float*              A,
+                                                      int                 lda,
+                                                      float*              B,
+                                                      int                 ldb,
+                                                      float*              D,
+                                                      int*                lwork,
+                                                      int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsygvdPipelined_bufferSize(hipsolverHandle_t   handle,
+                                                      hipsolverEigType_t  itype,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      double*             A,
+                                                      int                 lda,
+                                                      double*             B,
+                                                      int                 ldb,
+                                                      double*             D,
+                                                      int*                lwork,
+                                                      int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverChegvdPipelined_bufferSize(hipsolverHandle_t   handle,
+                                                      hipsolverEigType_t  itype,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipFloatComplex*    A,
+                                                      int                 lda,
+                                                      hipFloatComplex*    B,
+                                                      int                 ldb,
+                                                      float*              D,
+                                                      int*                lwork,
+                                                      int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZhegvdPipelined_bufferSize(hipsolverHandle_t   handle,
+                                                      hipsolverEigType_t  itype,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipDoubleComplex*   A,
+                                                      int                 lda,
+                                                      hipDoubleComplex*   B,
+                                                      int                 ldb,
+                                                      double*             D,
+                                                      int*                lwork,
+                                                      int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsygvdPipelined(hipsolverHandle_t   handle,
+                                           hipsolverEigType_t  itype,
+                                           hipsolverEigMode_t  jobz,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           float*              A,
+                                           int                 lda,
+                                           float*              B,
+                                           int                 ldb,
+                                           float*              D,
+                                           float*              work,
+                                           int                 lwork,
+                                           int*                devInfo,
+                                           int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsygvdPipelined(hipsolverHandle_t   handle,
+                                           hipsolverEigType_t  itype,
+                                           hipsolverEigMode_t  jobz,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           double*             A,
+                                           int                 lda,
+                                           double*             B,
+                                           int                 ldb,
+                                           double*             D,
+                                           double*             work,
+                                           int                 lwork,
+                                           int*                devInfo,
+                                           int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverChegvdPipelined(hipsolverHandle_t   handle,
+                                           hipsolverEigType_t  itype,
+                                           hipsolverEigMode_t  jobz,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           hipFloatComplex*    A,
+                                           int                 lda,
+                                           hipFloatComplex*    B,
+                                           int                 ldb,
+                                           float*              D,
+                                           hipFloatComplex*    work,
+                                           int                 lwork,
+                                           int*                devInfo,
+                                           int                 batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnZhegvd((cusolverDnHandle_t)handle,
-                                            hip2cuda_eform(itype),
-                                            hip2cuda_evect(jobz),
-                                            hip2cuda_fill(uplo),
-                                            n,
-                                            (cuDoubleComplex*)A,
-                                            lda,
-                                            (cuDoubleComplex*)B,
-                                            ldb,
-                                            D,
-                                            (cuDoubleComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZhegvdPipelined(hipsolverHandle_t   handle,
+                                           hipsolverEigType_t  itype,
+                                           hipsolverEigMode_t  jobz,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           hipDoubleComplex*   A,
+                                           int                 lda,
+                                           hipDoubleComplex*   B,
+                                           int                 ldb,
+                                           double*             D,
+                                           hipDoubleComplex*   work,
+                                           int                 lwork,
+                                           int*                devInfo,
+                                           int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
+
 /******************** SYTRD/HETRD ********************/
 hipsolverStatus_t hipsolverSsytrd_bufferSize(hipsolverHandle_t   handle,
                                              hipsolverFillMode_t uplo,
@@ -3104,4 +6093,304 @@ catch(...)
     return exception2hip_status();
 }
 
+/******************** SYTRF ********************/
+hipsolverStatus_t hipsolverSsytrf_bufferSize(
+    hipsolverHandle_t handle, int n, float* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnSsytrf_bufferSize(
+        (cusolverDnHandle_t)handle, n, A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsytrf_bufferSize(
+    hipsolverHandle_t handle, int n, double* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnDsytrf_bufferSize(
+        (cusolverDnHandle_t)handle, n, A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCsytrf_bufferSize(
+    hipsolverHandle_t handle, int n, hipFloatComplex* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnCsytrf_bufferSize(
+        (cusolverDnHandle_t)handle, n, (cuComplex*)A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZsytrf_bufferSize(
+    hipsolverHandle_t handle, int n, hipDoubleComplex* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnZsytrf_bufferSize(
+        (cusolverDnHandle_t)handle, n, (cuDoubleComplex*)A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsytrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnSsytrf(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, devIpiv, work, lwork, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsytrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnDsytrf(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, devIpiv, work, lwork, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCsytrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnCsytrf((cusolverDnHandle_t)handle,
+                                            hip2cuda_fill(uplo),
+                                            n,
+                                            (cuComplex*)A,
+                                            lda,
+                                            devIpiv,
+                                            (cuComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZsytrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnZsytrf((cusolverDnHandle_t)handle,
+                                            hip2cuda_fill(uplo),
+                                            n,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            devIpiv,
+                                            (cuDoubleComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** SYTRS ********************/
+hipsolverStatus_t hipsolverSsytrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             float*              A,
+                                             int                 lda,
+                                             int*                devIpiv,
+                                             float*              B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsytrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             double*             A,
+                                             int                 lda,
+                                             int*                devIpiv,
+                                             double*             B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCsytrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             int*                devIpiv,
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZsytrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             int*                devIpiv,
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsytrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  float*              A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  float*              B,
+                                  int                 ldb,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsytrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  double*             A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  double*             B,
+                                  int                 ldb,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCsytrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  hipFloatComplex*    B,
+                                  int                 ldb,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZsytrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  int*                devIpiv,
+                                  hipDoubleComplex*   B,
+                                  int                 ldb,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
 } // extern C